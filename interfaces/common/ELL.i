@@ -62,7 +62,12 @@
     }
 }
 
-// ELL APIs 
+#ifdef SWIGPYTHON
+// Zero-copy buffer protocol support
+%include "buffers.i"
+#endif
+
+// ELL APIs
 %include "functions.i"
 %include "math.i"
 %include "predictors.i"
@@ -0,0 +1,63 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     buffers.i (interfaces)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Typemaps that accept any object implementing the Python buffer protocol (NumPy arrays,
+// array.array, memoryview, ...) and pass the underlying pointer straight through to C++,
+// avoiding a copy of the data on each call. The buffer must be contiguous and its element
+// type must match the declared pointer type.
+
+#ifdef SWIGPYTHON
+
+%define %ell_buffer_typemap(TYPE, PTR, SIZE, BUFFER_FLAGS)
+%typemap(in) (TYPE* PTR, size_t SIZE) {
+    Py_buffer view;
+    if (PyObject_GetBuffer($input, &view, BUFFER_FLAGS) < 0)
+    {
+        PyErr_Clear();
+        %argument_fail(SWIG_TypeError, "(TYPE* PTR, size_t SIZE)", $symname, $argnum);
+    }
+    if (view.itemsize != sizeof($*1_ltype))
+    {
+        PyBuffer_Release(&view);
+        SWIG_exception_fail(SWIG_TypeError, "in method '$symname', argument $argnum: buffer element size doesn't match the expected element type");
+    }
+    $1 = ($1_ltype)view.buf;
+    $2 = (size_t)(view.len / view.itemsize);
+    // the buffer object is a method argument, so it stays alive for the duration of the call
+    PyBuffer_Release(&view);
+}
+%typemap(typecheck, precedence=SWIG_TYPECHECK_POINTER) (TYPE* PTR, size_t SIZE) {
+    $1 = PyObject_CheckBuffer($input) ? 1 : 0;
+}
+%enddef
+
+// read-only input buffers
+%define %ell_input_buffer(TYPE, PTR, SIZE)
+%ell_buffer_typemap(const TYPE, PTR, SIZE, PyBUF_CONTIG_RO)
+%enddef
+
+// writable output buffers
+%define %ell_output_buffer(TYPE, PTR, SIZE)
+%ell_buffer_typemap(TYPE, PTR, SIZE, PyBUF_CONTIG)
+%enddef
+
+// zero-copy compute entry points in ModelInterface.h
+%ell_input_buffer(double, input, inputSize)
+%ell_input_buffer(float, input, inputSize)
+%ell_output_buffer(double, output, outputSize)
+%ell_output_buffer(float, output, outputSize)
+%ell_input_buffer(double, inputs, inputsSize)
+%ell_input_buffer(float, inputs, inputsSize)
+%ell_output_buffer(double, outputs, outputsSize)
+%ell_output_buffer(float, outputs, outputsSize)
+
+// bulk tensor ingestion in MathInterface.h
+%ell_input_buffer(double, data, dataSize)
+%ell_input_buffer(float, data, dataSize)
+
+#endif // SWIGPYTHON
@@ -10,6 +10,7 @@
 #ifndef SWIG
 
 // stl
+#include <cstddef>
 #include <vector>
 
 #endif
@@ -70,6 +71,27 @@ namespace api
         /// <param name="buffer"> The callback scalar value. </param>
         void InvokeOutput(OutputType value);
 
+        /// <summary> Sets the number of samples buffered between invocations of the output callback.
+        /// Outputs accumulate in native memory and the callback runs once per full batch, with a
+        /// buffer of batchSize * outputSize values, so the per-call boundary-crossing cost is paid
+        /// once per batch instead of once per sample. The default batch size of one invokes the
+        /// callback per sample, as before. </summary>
+        ///
+        /// <param name="batchSize"> The number of samples per output callback invocation. </param>
+        void SetOutputBatchSize(size_t batchSize);
+
+        /// <summary> Invokes the output callback with any buffered samples that do not yet form a
+        /// full batch. Call this when the stream of samples ends. </summary>
+        void FlushOutput();
+
+        /// <summary> Sets the number of samples requested per invocation of the input callback. The
+        /// callback is expected to fill its buffer with up to batchSize * inputSize values (it may
+        /// resize the buffer down to signal fewer samples); samples are then served from native
+        /// memory, one per InvokeInput, without crossing the language boundary. </summary>
+        ///
+        /// <param name="batchSize"> The number of samples per input callback invocation. </param>
+        void SetInputBatchSize(size_t batchSize);
+
     protected:
         /// <summary> Performs a one-time initialization of the forwarder </summary>
         ///
@@ -91,6 +113,13 @@ namespace api
         CallbackBase<OutputType>* _outputCallback;
 
         std::vector<OutputType> _outputBuffer;
+        size_t _outputSize = 0;
+        size_t _outputBatchSize = 1;
+        size_t _outputCount = 0; // number of samples currently buffered
+
+        std::vector<InputType> _inputBatchBuffer;
+        size_t _inputBatchSize = 1;
+        size_t _inputBatchPos = 0; // read position into the input batch buffer
     };
 }
 }
@@ -32,6 +32,15 @@ namespace math
 
         }
 
+        // Bulk construction from a raw buffer. The buffer typemaps in buffers.i map a Python
+        // buffer-protocol object (e.g. a numpy array) onto (data, dataSize), so the element
+        // values transfer with a single copy instead of one interop call per element.
+        Tensor(const ElementType* data, size_t dataSize, size_t rows, size_t columns, size_t channels) :
+            rows(rows), columns(columns), channels(channels), data(data, data + dataSize)
+        {
+
+        }
+
         const size_t rows;
         const size_t columns;
         const size_t channels;
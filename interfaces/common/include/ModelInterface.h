@@ -25,6 +25,7 @@
 #include "NeuralNetworkPredictorInterface.h"
 
 // stl
+#include <future>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -402,15 +403,104 @@ public:
     std::vector<double> ComputeDouble(const std::vector<double>& inputData);
     std::vector<float> ComputeFloat(const std::vector<float>& inputData);
 
+#if !defined(SWIG) || defined(SWIGPYTHON)
+    // Zero-copy variants: read the input and write the output through caller-provided buffers
+    // (from python, any contiguous object implementing the buffer protocol, such as a NumPy array)
+    void ComputeDouble(const double* input, size_t inputSize, double* output, size_t outputSize);
+    void ComputeFloat(const float* input, size_t inputSize, float* output, size_t outputSize);
+
+    // Batched variants: the inputs hold one example of GetInputSize() elements after another, and
+    // the results are written into the caller-provided output buffer in the same layout
+    void ComputeBatchDouble(const double* inputs, size_t inputsSize, double* outputs, size_t outputsSize);
+    void ComputeBatchFloat(const float* inputs, size_t inputsSize, float* outputs, size_t outputsSize);
+#endif
+
+    size_t GetInputSize() const;
+    size_t GetOutputSize() const;
+
 #ifndef SWIG
     ELL_CompiledMap() = default;
     ELL_CompiledMap(ell::model::IRCompiledMap map);
+    std::shared_ptr<ell::model::IRCompiledMap> GetInternalMap() const { return _map; }
 #endif
 
 private:
     std::shared_ptr<ell::model::IRCompiledMap> _map;
 };
 
+//
+// ELL_AsyncCompiledMap
+//
+
+class ELL_AsyncCompiledMapState;
+
+// A completion handle for one asynchronously submitted input
+class ELL_AsyncResultDouble
+{
+public:
+    ELL_AsyncResultDouble(const ELL_AsyncResultDouble& other) = default;
+
+    // Indicates whether the result is available without blocking
+    bool IsReady() const;
+
+    // Blocks until the result is available and returns it (rethrows any compute error)
+    std::vector<double> Get();
+
+#ifndef SWIG
+    ELL_AsyncResultDouble() = default;
+    ELL_AsyncResultDouble(std::shared_future<std::vector<double>> future);
+#endif
+
+private:
+#ifndef SWIG
+    std::shared_future<std::vector<double>> _future;
+#endif
+};
+
+class ELL_AsyncResultFloat
+{
+public:
+    ELL_AsyncResultFloat(const ELL_AsyncResultFloat& other) = default;
+
+    // Indicates whether the result is available without blocking
+    bool IsReady() const;
+
+    // Blocks until the result is available and returns it (rethrows any compute error)
+    std::vector<float> Get();
+
+#ifndef SWIG
+    ELL_AsyncResultFloat() = default;
+    ELL_AsyncResultFloat(std::shared_future<std::vector<float>> future);
+#endif
+
+private:
+#ifndef SWIG
+    std::shared_future<std::vector<float>> _future;
+#endif
+};
+
+// An asynchronous submission front end over a compiled map: Submit queues an input and returns a
+// completion handle immediately, execution happens on the process-wide thread pool with at most
+// maxConcurrency batches of this map in flight at once, and queued requests are coalesced (up to
+// maxBatchSize at a time) into single calls to the map's batched compute entry point
+class ELL_AsyncCompiledMap
+{
+public:
+    ELL_AsyncCompiledMap(const ELL_AsyncCompiledMap& other) = default;
+    ELL_AsyncCompiledMap(const ELL_CompiledMap& map, int maxConcurrency = 1, int maxBatchSize = 8);
+
+    ELL_AsyncResultDouble SubmitDouble(const std::vector<double>& inputData);
+    ELL_AsyncResultFloat SubmitFloat(const std::vector<float>& inputData);
+
+    // Blocks until every submitted input has completed
+    void WaitAll();
+
+private:
+#ifndef SWIG
+    std::shared_ptr<ELL_AsyncCompiledMapState> _state;
+#endif
+};
+
 //
 // Functions
 //
@@ -41,7 +41,18 @@ namespace predictors
         using UnderlyingInputParameters = typename ell::predictors::neural::InputLayer<ElementType>::InputParameters;
         using UnderlyingInputLayer = typename ell::predictors::neural::InputLayer<ElementType>;
 
+        // Creates an empty predictor whose layers are appended one at a time with AddLayer.
+        // Streaming construction lets importers release each layer's weights after the
+        // transfer, so peak memory stays at one layer's weights instead of the whole model.
+        NeuralNetworkPredictor() = default;
+
         NeuralNetworkPredictor(const std::vector<Layer*>& layers);
+
+        // Appends a single layer. The layer's weights are copied into the underlying
+        // predictor immediately, so the caller can discard its copy afterwards. Layers
+        // cannot be added once the predictor has been used.
+        void AddLayer(Layer* layer);
+
         std::vector<ElementType> Predict(const std::vector<double>& input);
         neural::LayerShape GetInputShape() const;
         neural::LayerShape GetOutputShape() const;
@@ -58,7 +69,15 @@ namespace predictors
 
         static void AddLayer(Layer* layer, const std::unique_ptr<UnderlyingInputLayer>& underlyingInputLayer, UnderlyingLayers& underlyingLayers);
 
-        std::shared_ptr<UnderlyingPredictor> _predictor;
+#ifndef SWIG
+        void EnsurePredictor() const;
+#endif
+
+        // layers under streaming construction, moved into the predictor on first use
+        mutable std::unique_ptr<UnderlyingInputLayer> _inputLayer;
+        mutable UnderlyingLayers _underlyingLayers;
+
+        mutable std::shared_ptr<UnderlyingPredictor> _predictor;
     };
 }
 }
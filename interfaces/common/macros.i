@@ -123,6 +123,35 @@
 %}
 %enddef
 
+// Macro for enabling tensor types to be constructed from numpy arrays. The raveled data is
+// passed through the buffer-protocol constructor declared in MathInterface.h (see buffers.i),
+// so the element values transfer with a single copy instead of one interop call per element.
+%define TENSOR_CONSTRUCTABLE_WITH_NUMPY(TypeName, NumpyDataType)
+%pythoncode %{
+    class TypeName(TypeName):
+        def __init__(self, numpyArray):
+            # str(type) avoids requiring import numpy (more robust check?)
+            if ('numpy.ndarray' in str(type(numpyArray))):
+                if (len(numpyArray.shape) == 1):
+                    rows, columns, channels = 1, 1, numpyArray.shape[0]
+                elif (len(numpyArray.shape) == 3):
+                    rows, columns, channels = numpyArray.shape
+                elif (len(numpyArray.shape) == 4):
+                    # Create a stacked 3 dimensional tensor
+                    rows, columns, channels = numpyArray.shape[0] * numpyArray.shape[1], numpyArray.shape[2], numpyArray.shape[3]
+                else:
+                    raise ValueError('Invalid number of dimensions!')
+                # ravel() makes the data contiguous; astype only copies when the dtype differs
+                data = numpyArray.ravel()
+                if (data.dtype.name != NumpyDataType):
+                    data = data.astype(NumpyDataType)
+                super(TypeName, self).__init__(data, rows, columns, channels)
+            else:
+                # fallback to non-numpy construction
+                super(TypeName, self).__init__(numpyArray)
+%}
+%enddef
+
 #else
 
 // Intentionally undefined because numpy is python-specific
@@ -1,2 +1,2 @@
-CONSTRUCTABLE_WITH_NUMPY(FloatTensor)
-CONSTRUCTABLE_WITH_NUMPY(DoubleTensor)
+TENSOR_CONSTRUCTABLE_WITH_NUMPY(FloatTensor, "float32")
+TENSOR_CONSTRUCTABLE_WITH_NUMPY(DoubleTensor, "float64")
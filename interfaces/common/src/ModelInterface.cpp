@@ -17,6 +17,7 @@
 
 // utilities
 #include "JsonArchiver.h"
+#include "ThreadPool.h"
 
 // model
 #include "InputNode.h"
@@ -30,7 +31,11 @@
 #include "SourceNode.h"
 
 // stl
+#include <algorithm>
 #include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
 
 namespace ELL_API
 {
@@ -747,6 +752,64 @@ std::vector<float> ELL_CompiledMap::ComputeFloat(const std::vector<float>& input
     return _map->Compute<float>(inputData);
 }
 
+void ELL_CompiledMap::ComputeDouble(const double* input, size_t inputSize, double* output, size_t outputSize)
+{
+    if (inputSize != _map->GetInputSize() || outputSize != _map->GetOutputSize())
+    {
+        throw std::invalid_argument("Error: buffer size doesn't match the map's input or output size");
+    }
+    _map->ComputeBatch<double, double>(input, output, 1);
+}
+
+void ELL_CompiledMap::ComputeFloat(const float* input, size_t inputSize, float* output, size_t outputSize)
+{
+    if (inputSize != _map->GetInputSize() || outputSize != _map->GetOutputSize())
+    {
+        throw std::invalid_argument("Error: buffer size doesn't match the map's input or output size");
+    }
+    _map->ComputeBatch<float, float>(input, output, 1);
+}
+
+void ELL_CompiledMap::ComputeBatchDouble(const double* inputs, size_t inputsSize, double* outputs, size_t outputsSize)
+{
+    auto inputSize = _map->GetInputSize();
+    if (inputSize == 0 || inputsSize % inputSize != 0)
+    {
+        throw std::invalid_argument("Error: input buffer size isn't a multiple of the map's input size");
+    }
+    auto count = inputsSize / inputSize;
+    if (outputsSize != count * _map->GetOutputSize())
+    {
+        throw std::invalid_argument("Error: output buffer size doesn't match the number of examples in the batch");
+    }
+    _map->ComputeBatch<double, double>(inputs, outputs, static_cast<int>(count));
+}
+
+void ELL_CompiledMap::ComputeBatchFloat(const float* inputs, size_t inputsSize, float* outputs, size_t outputsSize)
+{
+    auto inputSize = _map->GetInputSize();
+    if (inputSize == 0 || inputsSize % inputSize != 0)
+    {
+        throw std::invalid_argument("Error: input buffer size isn't a multiple of the map's input size");
+    }
+    auto count = inputsSize / inputSize;
+    if (outputsSize != count * _map->GetOutputSize())
+    {
+        throw std::invalid_argument("Error: output buffer size doesn't match the number of examples in the batch");
+    }
+    _map->ComputeBatch<float, float>(inputs, outputs, static_cast<int>(count));
+}
+
+size_t ELL_CompiledMap::GetInputSize() const
+{
+    return _map->GetInputSize();
+}
+
+size_t ELL_CompiledMap::GetOutputSize() const
+{
+    return _map->GetOutputSize();
+}
+
 std::string ELL_CompiledMap::GetCodeString()
 {
     std::stringstream s;
@@ -757,6 +820,232 @@ std::string ELL_CompiledMap::GetCodeString()
     return s.str();
 }
 
+//
+// ELL_AsyncCompiledMap
+//
+
+// Shared state behind an async compiled map: the pending request queues, the workers draining
+// them on the process-wide thread pool, and the per-map concurrency limit. Handles hold shared
+// futures, so results stay retrievable after the map itself goes away.
+class ELL_AsyncCompiledMapState : public std::enable_shared_from_this<ELL_AsyncCompiledMapState>
+{
+public:
+    ELL_AsyncCompiledMapState(std::shared_ptr<ell::model::IRCompiledMap> map, int maxConcurrency, int maxBatchSize)
+        : _map(std::move(map)), _maxConcurrency(std::max(1, maxConcurrency)), _maxBatchSize(std::max(1, maxBatchSize))
+    {
+        if (_map == nullptr)
+        {
+            throw std::invalid_argument("Error: cannot create an async map from an empty compiled map");
+        }
+    }
+
+    template <typename ElementType>
+    std::shared_future<std::vector<ElementType>> Submit(const std::vector<ElementType>& inputData)
+    {
+        if (inputData.size() != _map->GetInputSize())
+        {
+            throw std::invalid_argument("Error: input size doesn't match the map's input size");
+        }
+
+        std::shared_future<std::vector<ElementType>> future;
+        bool startWorker = false;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            auto& queue = GetQueue<ElementType>();
+            queue.emplace_back(Request<ElementType>{ inputData, {} });
+            future = queue.back().promise.get_future().share();
+            ++_numPending;
+            if (_numWorkers < _maxConcurrency)
+            {
+                ++_numWorkers;
+                startWorker = true;
+            }
+        }
+        if (startWorker)
+        {
+            auto self = shared_from_this();
+            ell::utilities::GetThreadPool().Submit([self]() { self->Drain(); });
+        }
+        return future;
+    }
+
+    void WaitAll()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _idle.wait(lock, [this] { return _numPending == 0; });
+    }
+
+private:
+    template <typename ElementType>
+    struct Request
+    {
+        std::vector<ElementType> input;
+        std::promise<std::vector<ElementType>> promise;
+    };
+
+    template <typename ElementType>
+    std::deque<Request<ElementType>>& GetQueue();
+
+    // worker loop: repeatedly coalesce queued requests into one batch and run it, until the
+    // queues are empty
+    void Drain()
+    {
+        while (true)
+        {
+            std::vector<Request<double>> doubleBatch;
+            std::vector<Request<float>> floatBatch;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                TakeBatch(_doubleQueue, doubleBatch);
+                if (doubleBatch.empty())
+                {
+                    TakeBatch(_floatQueue, floatBatch);
+                }
+                if (doubleBatch.empty() && floatBatch.empty())
+                {
+                    --_numWorkers;
+                    return;
+                }
+            }
+
+            if (!doubleBatch.empty())
+            {
+                ComputeBatch(doubleBatch);
+            }
+            else
+            {
+                ComputeBatch(floatBatch);
+            }
+        }
+    }
+
+    template <typename ElementType>
+    void TakeBatch(std::deque<Request<ElementType>>& queue, std::vector<Request<ElementType>>& batch)
+    {
+        while (!queue.empty() && batch.size() < static_cast<size_t>(_maxBatchSize))
+        {
+            batch.push_back(std::move(queue.front()));
+            queue.pop_front();
+        }
+    }
+
+    template <typename ElementType>
+    void ComputeBatch(std::vector<Request<ElementType>>& batch)
+    {
+        auto inputSize = _map->GetInputSize();
+        auto outputSize = _map->GetOutputSize();
+        std::vector<ElementType> inputs(batch.size() * inputSize);
+        std::vector<ElementType> outputs(batch.size() * outputSize);
+        for (size_t i = 0; i < batch.size(); ++i)
+        {
+            std::copy(batch[i].input.begin(), batch[i].input.end(), inputs.begin() + i * inputSize);
+        }
+
+        try
+        {
+            _map->ComputeBatch<ElementType, ElementType>(inputs.data(), outputs.data(), static_cast<int>(batch.size()));
+        }
+        catch (...)
+        {
+            for (auto& request : batch)
+            {
+                request.promise.set_exception(std::current_exception());
+            }
+            FinishRequests(batch.size());
+            return;
+        }
+
+        for (size_t i = 0; i < batch.size(); ++i)
+        {
+            batch[i].promise.set_value(std::vector<ElementType>(outputs.begin() + i * outputSize, outputs.begin() + (i + 1) * outputSize));
+        }
+        FinishRequests(batch.size());
+    }
+
+    void FinishRequests(size_t count)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _numPending -= count;
+        if (_numPending == 0)
+        {
+            _idle.notify_all();
+        }
+    }
+
+    std::shared_ptr<ell::model::IRCompiledMap> _map;
+    int _maxConcurrency;
+    int _maxBatchSize;
+
+    std::mutex _mutex;
+    std::condition_variable _idle;
+    std::deque<Request<double>> _doubleQueue;
+    std::deque<Request<float>> _floatQueue;
+    size_t _numPending = 0;
+    int _numWorkers = 0;
+};
+
+template <>
+std::deque<ELL_AsyncCompiledMapState::Request<double>>& ELL_AsyncCompiledMapState::GetQueue<double>()
+{
+    return _doubleQueue;
+}
+
+template <>
+std::deque<ELL_AsyncCompiledMapState::Request<float>>& ELL_AsyncCompiledMapState::GetQueue<float>()
+{
+    return _floatQueue;
+}
+
+ELL_AsyncResultDouble::ELL_AsyncResultDouble(std::shared_future<std::vector<double>> future)
+    : _future(std::move(future))
+{
+}
+
+bool ELL_AsyncResultDouble::IsReady() const
+{
+    return _future.valid() && _future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+std::vector<double> ELL_AsyncResultDouble::Get()
+{
+    return _future.get();
+}
+
+ELL_AsyncResultFloat::ELL_AsyncResultFloat(std::shared_future<std::vector<float>> future)
+    : _future(std::move(future))
+{
+}
+
+bool ELL_AsyncResultFloat::IsReady() const
+{
+    return _future.valid() && _future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+std::vector<float> ELL_AsyncResultFloat::Get()
+{
+    return _future.get();
+}
+
+ELL_AsyncCompiledMap::ELL_AsyncCompiledMap(const ELL_CompiledMap& map, int maxConcurrency, int maxBatchSize)
+    : _state(std::make_shared<ELL_AsyncCompiledMapState>(map.GetInternalMap(), maxConcurrency, maxBatchSize))
+{
+}
+
+ELL_AsyncResultDouble ELL_AsyncCompiledMap::SubmitDouble(const std::vector<double>& inputData)
+{
+    return ELL_AsyncResultDouble(_state->Submit<double>(inputData));
+}
+
+ELL_AsyncResultFloat ELL_AsyncCompiledMap::SubmitFloat(const std::vector<float>& inputData)
+{
+    return ELL_AsyncResultFloat(_state->Submit<float>(inputData));
+}
+
+void ELL_AsyncCompiledMap::WaitAll()
+{
+    _state->WaitAll();
+}
+
 //
 // Functions
 //
@@ -41,7 +41,8 @@ namespace api
         _inputCallback = &inputCallback;
         _inputBuffer = &inputBuffer;
         _outputCallback = &outputCallback;
-        _outputBuffer.resize(outputSize);
+        _outputSize = outputSize;
+        _outputBuffer.resize(outputSize * _outputBatchSize);
     }
 
     template <typename InputType, typename OutputType>
@@ -52,14 +53,40 @@ namespace api
             throw std::invalid_argument("InitializeOnce has not yet been called");
         }
 
-        bool result = _inputCallback->Run(*_inputBuffer);
-        if (result)
+        if (_inputBatchSize <= 1)
         {
-            // EFFICIENCY: any way to avoid the copy?
-            std::copy(_inputBuffer->begin(), _inputBuffer->end(), buffer);
+            bool result = _inputCallback->Run(*_inputBuffer);
+            if (result)
+            {
+                // EFFICIENCY: any way to avoid the copy?
+                std::copy(_inputBuffer->begin(), _inputBuffer->end(), buffer);
+            }
+
+            return result;
+        }
+
+        size_t inputSize = _inputBuffer->size();
+        if (_inputBatchPos + inputSize > _inputBatchBuffer.size())
+        {
+            // ask the callback to refill a full batch (it may resize the buffer down to signal
+            // fewer samples)
+            _inputBatchBuffer.resize(_inputBatchSize * inputSize);
+            _inputBatchPos = 0;
+            if (!_inputCallback->Run(_inputBatchBuffer))
+            {
+                _inputBatchBuffer.clear();
+                return false;
+            }
+            if (_inputBatchBuffer.size() < inputSize)
+            {
+                return false;
+            }
         }
 
-        return result;
+        // serve the next sample from native memory, without crossing the language boundary
+        std::copy(_inputBatchBuffer.begin() + _inputBatchPos, _inputBatchBuffer.begin() + _inputBatchPos + inputSize, buffer);
+        _inputBatchPos += inputSize;
+        return true;
     }
 
     template <typename InputType, typename OutputType>
@@ -70,9 +97,71 @@ namespace api
             throw std::invalid_argument("InitializeOnce has not yet been called");
         }
 
-        // EFFICIENCY: any way to avoid the copy?
-        _outputBuffer.assign(buffer, buffer + _outputBuffer.size());
+        if (_outputBatchSize <= 1)
+        {
+            // EFFICIENCY: any way to avoid the copy?
+            _outputBuffer.assign(buffer, buffer + _outputSize);
+            _outputCallback->Run(_outputBuffer);
+            return;
+        }
+
+        // accumulate the sample in native memory, invoking the callback once per full batch
+        std::copy(buffer, buffer + _outputSize, _outputBuffer.begin() + _outputCount * _outputSize);
+        if (++_outputCount == _outputBatchSize)
+        {
+            FlushOutput();
+        }
+    }
+
+    template <typename InputType, typename OutputType>
+    void CallbackForwarder<InputType, OutputType>::SetOutputBatchSize(size_t batchSize)
+    {
+        if (batchSize == 0)
+        {
+            throw std::invalid_argument("batchSize must be positive");
+        }
+
+        // deliver anything already buffered before the buffer is resized
+        if (_outputCallback != nullptr)
+        {
+            FlushOutput();
+        }
+        _outputBatchSize = batchSize;
+        _outputBuffer.resize(_outputSize * _outputBatchSize);
+    }
+
+    template <typename InputType, typename OutputType>
+    void CallbackForwarder<InputType, OutputType>::FlushOutput()
+    {
+        if (_outputCallback == nullptr)
+        {
+            throw std::invalid_argument("InitializeOnce has not yet been called");
+        }
+
+        if (_outputCount == 0)
+        {
+            return;
+        }
+
+        // a partial batch is delivered as a shorter buffer
+        size_t fullSize = _outputBuffer.size();
+        _outputBuffer.resize(_outputCount * _outputSize);
         _outputCallback->Run(_outputBuffer);
+        _outputBuffer.resize(fullSize);
+        _outputCount = 0;
+    }
+
+    template <typename InputType, typename OutputType>
+    void CallbackForwarder<InputType, OutputType>::SetInputBatchSize(size_t batchSize)
+    {
+        if (batchSize == 0)
+        {
+            throw std::invalid_argument("batchSize must be positive");
+        }
+
+        _inputBatchSize = batchSize;
+        _inputBatchBuffer.clear();
+        _inputBatchPos = 0;
     }
 
     template <typename InputType, typename OutputType>
@@ -34,58 +34,80 @@ namespace predictors
     {
         if (layers.size() > 0)
         {
-            auto& parameters = layers.front()->parameters;
-            // Construct the input layer
-            UnderlyingInputParameters inputParameters = 
-                { 
+            // Construct up the layers
+            for (size_t i = 0; i < layers.size(); i++)
+            {
+                AddLayer(layers[i]);
+            }
+        }
+        else
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "'layers' parameters does not contain any neural network layers");
+        }
+    }
+
+    template <typename ElementType>
+    void NeuralNetworkPredictor<ElementType>::AddLayer(Layer* layer)
+    {
+        if (layer == nullptr)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Encountered null layer in neural network predictor");
+        }
+        if (_predictor != nullptr)
+        {
+            throw utilities::LogicException(utilities::LogicExceptionErrors::illegalState, "Layers cannot be added after the predictor has been used");
+        }
+
+        if (_inputLayer == nullptr)
+        {
+            auto& parameters = layer->parameters;
+            // Construct the input layer from the first layer's input characteristics
+            UnderlyingInputParameters inputParameters =
+                {
                     {parameters.inputShape.rows - (2 * parameters.inputPaddingParameters.paddingSize), parameters.inputShape.columns - (2 * parameters.inputPaddingParameters.paddingSize), parameters.inputShape.channels},
                     underlying::NoPadding(),
                     {parameters.inputShape.rows, parameters.inputShape.columns, parameters.inputShape.channels },
                     parameters.inputPaddingParameters,
                     1.0
                 };
-            auto inputLayer = std::make_unique<underlying::InputLayer<ElementType>>(inputParameters);
+            _inputLayer = std::make_unique<underlying::InputLayer<ElementType>>(inputParameters);
+        }
 
-            UnderlyingLayers underlyingLayers;
+        AddLayer(layer, _inputLayer, _underlyingLayers);
+    }
 
-            // Construct up the layers
-            for (size_t i = 0; i < layers.size(); i++)
+    template <typename ElementType>
+    void NeuralNetworkPredictor<ElementType>::EnsurePredictor() const
+    {
+        if (_predictor == nullptr)
+        {
+            if (_inputLayer == nullptr)
             {
-                AddLayer(layers[i], inputLayer, underlyingLayers);
+                throw utilities::LogicException(utilities::LogicExceptionErrors::illegalState, "Predictor must be initialized before it is used");
             }
 
-            // Create the predictor
-            _predictor = std::make_shared<UnderlyingPredictor>(std::move(inputLayer), std::move(underlyingLayers));
-        }
-        else
-        {
-            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "'layers' parameters does not contain any neural network layers");
+            // Create the predictor, taking ownership of the streamed layers
+            _predictor = std::make_shared<UnderlyingPredictor>(std::move(_inputLayer), std::move(_underlyingLayers));
         }
     }
 
     template <typename ElementType>
     std::vector<ElementType> NeuralNetworkPredictor<ElementType>::Predict(const std::vector<double>& input)
     {
-        std::vector<ElementType> result;
+        EnsurePredictor();
+
         // Call the underlying predictor with the specified input.
         // Note that we return a copy and not a reference, since we cannot control what the
         // api caller is going to do with it.
-        if (_predictor != nullptr)
-        {
-            using UnderlyingDataVectorType = typename UnderlyingPredictor::DataVectorType;
-            UnderlyingDataVectorType dataInput(input);
-            result = _predictor->Predict(dataInput);
-        }
-        else
-        {
-            throw utilities::LogicException(utilities::LogicExceptionErrors::illegalState, "Predictor must be initialized before Predict method is called");
-        }
-        return result;
+        using UnderlyingDataVectorType = typename UnderlyingPredictor::DataVectorType;
+        UnderlyingDataVectorType dataInput(input);
+        return _predictor->Predict(dataInput);
     }
 
     template <typename ElementType>
     neural::LayerShape NeuralNetworkPredictor<ElementType>::GetInputShape() const
     {
+        EnsurePredictor();
         auto shape = _predictor->GetInputShape();
         return neural::LayerShape{shape[0], shape[1], shape[2]};
     }
@@ -93,6 +115,7 @@ namespace predictors
     template <typename ElementType>
     neural::LayerShape NeuralNetworkPredictor<ElementType>::GetOutputShape() const
     {
+        EnsurePredictor();
         auto shape = _predictor->GetOutputShape();
         return neural::LayerShape{shape[0], shape[1], shape[2]};
     }
@@ -224,6 +247,7 @@ namespace predictors
     template <typename ElementType>
     const ell::predictors::NeuralNetworkPredictor<ElementType>& NeuralNetworkPredictor<ElementType>::GetPredictor() const
     {
+        EnsurePredictor();
         return *_predictor;
     }
 #endif
@@ -0,0 +1,92 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     AsyncModelSaver.h (common)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// model
+#include "DynamicMap.h"
+#include "Model.h"
+
+// stl
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace ell
+{
+namespace common
+{
+    /// <summary> The state of an asynchronous save. </summary>
+    enum class AsyncSaveStatus
+    {
+        /// <summary> No save has been requested yet. </summary>
+        idle,
+        /// <summary> A save is in flight on the background thread. </summary>
+        saving,
+        /// <summary> The most recent save completed and the file was renamed into place. </summary>
+        succeeded,
+        /// <summary> The most recent save failed; the target file was left untouched. </summary>
+        failed
+    };
+
+    /// <summary> Saves models and maps on a background thread, so periodic checkpointing doesn't
+    /// stall the caller for the duration of serialization. The object to save is snapshotted when
+    /// the save is requested (a cheap copy: models share their nodes and neural layers share their
+    /// weights), serialized to a temporary file next to the target, and renamed into place on
+    /// completion -- so a crash or error mid-save never leaves a truncated archive under the
+    /// target filename. Requesting a new save while one is in flight first waits for the previous
+    /// one to finish. The caller must not mutate nodes already in the snapshotted model while a
+    /// save is in flight; appending new nodes is fine. </summary>
+    class AsyncModelSaver
+    {
+    public:
+        AsyncModelSaver() = default;
+        AsyncModelSaver(const AsyncModelSaver&) = delete;
+        AsyncModelSaver& operator=(const AsyncModelSaver&) = delete;
+
+        ~AsyncModelSaver();
+
+        /// <summary> Requests an asynchronous save of a model. As with `SaveModel`, files with an
+        /// ".ellb" extension are written in the compact binary format, all others as JSON, and the
+        /// sidecar index is written on a best-effort basis after the rename. </summary>
+        ///
+        /// <param name="model"> The model to save; copied as the snapshot. </param>
+        /// <param name="filename"> The filename. </param>
+        void SaveModelAsync(model::Model model, const std::string& filename);
+
+        /// <summary> Requests an asynchronous save of a map. </summary>
+        ///
+        /// <param name="map"> The map to save; copied as the snapshot. </param>
+        /// <param name="filename"> The filename. </param>
+        void SaveMapAsync(model::DynamicMap map, const std::string& filename);
+
+        /// <summary> Gets the status of the most recently requested save. </summary>
+        ///
+        /// <returns> The save status. </returns>
+        AsyncSaveStatus GetStatus() const;
+
+        /// <summary> Gets the error message from the most recent failed save, or the empty string. </summary>
+        ///
+        /// <returns> The error message. </returns>
+        std::string GetLastError() const;
+
+        /// <summary> Blocks until the in-flight save (if any) has finished. </summary>
+        void Wait();
+
+    private:
+        void BeginSave(const std::string& filename, std::function<void(std::ostream&)> serialize, std::function<void()> afterRename);
+        void SetResult(AsyncSaveStatus status, const std::string& error);
+
+        mutable std::mutex _mutex;
+        std::thread _worker;
+        AsyncSaveStatus _status = AsyncSaveStatus::idle;
+        std::string _lastError;
+    };
+}
+}
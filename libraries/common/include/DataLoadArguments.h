@@ -19,6 +19,14 @@ namespace ell
 /// <summary> common namespace </summary>
 namespace common
 {
+    /// <summary> The in-memory layout policy for a loaded dataset. </summary>
+    enum class DatasetLayout
+    {
+        contiguous, // one dataset, parsed in stream order on the calling thread
+        interleaved, // one dataset, with chunks parsed (and their example storage allocated) round-robin across the worker threads
+        sharded // one dataset shard per worker thread, each parsed and allocated by the worker that owns it
+    };
+
     /// <summary> A struct that holds command line parameters for loading data. </summary>
     struct DataLoadArguments
     {
@@ -28,6 +36,13 @@ namespace common
         /// <summary> The number of elements in an input data vector. </summary>
         std::string dataDimension = "";
 
+        /// <summary> The in-memory layout for the loaded dataset, honored by the trainer tools'
+        /// load path (GetDataset/GetMappedDataset with a layout argument). On machines with
+        /// first-touch memory placement (e.g. NUMA systems), interleaved spreads the example
+        /// pages across the workers' memory nodes, and sharded keeps each contiguous range's
+        /// pages on the node of the worker that parsed it. </summary>
+        DatasetLayout datasetLayout = DatasetLayout::contiguous;
+
         // not exposed on the command line
         size_t parsedDataDimension = 0;
     };
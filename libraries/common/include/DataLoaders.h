@@ -19,6 +19,7 @@
 
 
 // stl
+#include <functional>
 #include <string>
 #include <iostream>
 
@@ -33,6 +34,67 @@ namespace common
     /// <returns> The data iterator. </returns>
     data::AutoSupervisedExampleIterator GetExampleIterator(std::istream& stream);
 
+    /// <summary> A factory that makes an example iterator for one dataset format. </summary>
+    using ExampleIteratorFactory = std::function<data::AutoSupervisedExampleIterator(std::istream&)>;
+
+    /// <summary>
+    /// Registers a dataset parser under a format name, replacing any parser previously registered
+    /// under that name. The formats "sparse" (the generalized sparse text format), "csv" and
+    /// "libsvm" are registered by default.
+    /// </summary>
+    ///
+    /// <param name="formatName"> The format name to register the parser under. </param>
+    /// <param name="factory"> The factory that makes example iterators for the format. </param>
+    void RegisterDatasetParser(const std::string& formatName, ExampleIteratorFactory factory);
+
+    /// <summary>
+    /// Determines the dataset format of a file, by extension first (".csv" and ".libsvm"/".svm"
+    /// map to their formats) and by content otherwise: a comma in the first line of a seekable
+    /// stream means "csv", anything else means "sparse". Since every libsvm line is also a valid
+    /// generalized sparse line, libsvm cannot be sniffed from content and must be requested by
+    /// name or extension.
+    /// </summary>
+    ///
+    /// <param name="filename"> The name of the data file, or an empty string if unknown. </param>
+    /// <param name="stream"> Input stream holding the data; must be positioned at the start. </param>
+    ///
+    /// <returns> The name of the detected format. </returns>
+    std::string SniffDatasetFormat(const std::string& filename, std::istream& stream);
+
+    /// <summary> Gets a data iterator from an input stream, using the parser registered under the given format name. </summary>
+    ///
+    /// <param name="stream"> Input stream to load data from. </param>
+    /// <param name="formatName"> The dataset format name. </param>
+    ///
+    /// <returns> The data iterator. </returns>
+    data::AutoSupervisedExampleIterator GetExampleIterator(std::istream& stream, const std::string& formatName);
+
+    /// <summary>
+    /// Gets a factory that returns a fresh file-backed example iterator each time it is called,
+    /// reopening the file so every epoch starts back at the first example. Intended for trainers'
+    /// streaming mode, where the dataset is never held in memory.
+    /// </summary>
+    ///
+    /// <param name="filename"> The data file to iterate over. </param>
+    ///
+    /// <returns> The example iterator factory. </returns>
+    std::function<data::AutoSupervisedExampleIterator()> GetExampleIteratorFactory(const std::string& filename);
+
+    /// <summary>
+    /// Gets a rewindable cached example iterator factory for multi-epoch streaming training. The
+    /// first iterator parses the text file and simultaneously writes the examples to a binary
+    /// cache file; once an iterator has been fully consumed, later iterators walk the
+    /// memory-mapped binary cache instead, so the text is parsed exactly once no matter how many
+    /// epochs run. The cache file is created (or overwritten) by this factory; an epoch abandoned
+    /// part-way discards the partial cache and the next iterator parses the text again.
+    /// </summary>
+    ///
+    /// <param name="filename"> The text data file to iterate over. </param>
+    /// <param name="cacheFilename"> The path of the binary cache file to write and reuse. </param>
+    ///
+    /// <returns> The example iterator factory. </returns>
+    std::function<data::AutoSupervisedExampleIterator()> GetCachedExampleIteratorFactory(const std::string& filename, const std::string& cacheFilename);
+
     /// <summary> Gets a dataset from data load arguments. </summary>
     ///
     /// <typeparam name="DatasetType"> Dataset type. </typeparam>
@@ -41,6 +103,54 @@ namespace common
     /// <returns> The dataset. </returns>
     data::AutoSupervisedDataset GetDataset(std::istream& stream);
 
+    /// <summary> Gets a dataset from an input stream, using the parser registered under the given format name. </summary>
+    ///
+    /// <param name="stream"> Input stream to load data from. </param>
+    /// <param name="formatName"> The dataset format name. </param>
+    ///
+    /// <returns> The dataset. </returns>
+    data::AutoSupervisedDataset GetDataset(std::istream& stream, const std::string& formatName);
+
+    /// <summary>
+    /// Gets a dataset from an input stream, reading the stream in chunks of lines and parsing the
+    /// chunks on a pool of worker threads. Example order is the same as in the stream.
+    /// </summary>
+    ///
+    /// <param name="stream"> Input stream to load data from. </param>
+    /// <param name="numThreads"> Number of parser threads, or zero to use the hardware concurrency. </param>
+    ///
+    /// <returns> The dataset. </returns>
+    data::AutoSupervisedDataset GetDatasetParallel(std::istream& stream, size_t numThreads = 0);
+
+    /// <summary>
+    /// Gets a dataset as a vector of shards, one per worker thread, each covering a contiguous
+    /// range of the stream. Each shard is parsed and allocated entirely by the worker that owns
+    /// it, so on systems with first-touch memory placement (e.g. NUMA machines) a shard's pages
+    /// land on the memory node of its worker. Concatenating the shards in order reproduces the
+    /// stream order.
+    /// </summary>
+    ///
+    /// <param name="stream"> Input stream to load data from. </param>
+    /// <param name="numShards"> Number of shards, or zero to use one per pool thread. </param>
+    ///
+    /// <returns> The dataset shards. </returns>
+    std::vector<data::AutoSupervisedDataset> GetDatasetShards(std::istream& stream, size_t numShards = 0);
+
+    /// <summary>
+    /// Gets a dataset from an input stream, parsed according to the given layout policy:
+    /// contiguous parses in stream order on the calling thread, interleaved parses chunks
+    /// round-robin across the pool workers, and sharded parses one contiguous shard per worker
+    /// and then concatenates the shards. Moving the parsed examples out of their shards leaves
+    /// the example storage itself where the worker first touched it, so the sharded layout's
+    /// page placement survives the concatenation.
+    /// </summary>
+    ///
+    /// <param name="stream"> Input stream to load data from. </param>
+    /// <param name="layout"> The in-memory layout policy. </param>
+    ///
+    /// <returns> The dataset. </returns>
+    data::AutoSupervisedDataset GetDataset(std::istream& stream, DatasetLayout layout);
+
     /// <summary>
     /// Gets a dataset by loading it from an example iterator and running it through a map.
     /// </summary>
@@ -64,6 +174,21 @@ namespace common
     /// <returns> The dataset. </returns>
     template <typename MapType>
     data::AutoSupervisedDataset GetMappedDataset(std::istream& stream, const MapType& map);
+
+    /// <summary>
+    /// Gets a dataset by loading it from an input stream according to the given layout policy and
+    /// then running it through a map. The layout governs how the text is parsed and where the
+    /// parsed examples live; the map itself is computed on the calling thread.
+    /// </summary>
+    ///
+    /// <typeparam name="MapType"> Map type. </typeparam>
+    /// <param name="stream"> Input stream to load data from. </param>
+    /// <param name="map"> The map. </param>
+    /// <param name="layout"> The in-memory layout policy. </param>
+    ///
+    /// <returns> The dataset. </returns>
+    template <typename MapType>
+    data::AutoSupervisedDataset GetMappedDataset(std::istream& stream, const MapType& map, DatasetLayout layout);
 }
 }
 
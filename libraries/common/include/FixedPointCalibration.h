@@ -0,0 +1,42 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     FixedPointCalibration.h (common)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// data
+#include "Example.h"
+#include "ExampleIterator.h"
+
+// emitters
+#include "FixedPoint.h"
+
+// model
+#include "DynamicMap.h"
+
+// stl
+#include <map>
+#include <string>
+
+namespace ell
+{
+namespace common
+{
+    /// <summary> Runs sample data through a map and infers a Q format for every output port in its
+    /// model from the observed value ranges: each port gets the format with the most fractional bits
+    /// that covers its range without overflow. Ports are keyed by "&lt;node id&gt;.&lt;port name&gt;",
+    /// matching the keys of MapCompilerParameters::portQFormats. Used to pick formats for the
+    /// fixed-point compilation mode. </summary>
+    ///
+    /// <param name="map"> The map to calibrate. </param>
+    /// <param name="exampleIterator"> An iterator over the calibration examples. </param>
+    /// <param name="wordBits"> The width of the fixed-point representation. </param>
+    ///
+    /// <returns> The calibrated per-port formats. </returns>
+    std::map<std::string, emitters::QFormat> CalibrateQFormats(model::DynamicMap& map, data::AutoSupervisedExampleIterator exampleIterator, int wordBits = 32);
+}
+}
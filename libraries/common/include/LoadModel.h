@@ -18,13 +18,15 @@ namespace ell
 {
 namespace common
 {
-    /// <summary> Loads a model from a file, or creates a new one if given an empty filename. </summary>
+    /// <summary> Loads a model from a file, or creates a new one if given an empty filename.
+    /// The file format (binary or JSON) is detected from the file's signature. </summary>
     ///
     /// <param name="filename"> The filename. </param>
     /// <returns> The loaded model. </returns>
     model::Model LoadModel(const std::string& filename);
 
-    /// <summary> Saves a model to a file. </summary>
+    /// <summary> Saves a model to a file. Files with an ".ellb" extension are written in the
+    /// compact binary format, all others as JSON. </summary>
     ///
     /// <param name="model"> The model. </param>
     /// <param name="filename"> The filename. </param>
@@ -73,6 +75,34 @@ namespace common
     /// <param name="map"> The map. </param>
     /// <param name="outStream"> The stream. </param>
     void SaveMap(const model::DynamicMap& map, std::ostream& outStream);
+
+    /// <summary> The archive format version written by `SaveRefinedMap`. Bump this when the
+    /// refinement pass changes in a way that makes previously exported refined maps stale. </summary>
+    constexpr int refinedMapArchiveVersion = 1;
+
+    /// <summary> Gets the file extension (without the dot) that marks an archive written by
+    /// `SaveRefinedMap`. `LoadMap` uses the extension to recognize the stamped format. </summary>
+    ///
+    /// <returns> The refined map file extension. </returns>
+    std::string GetRefinedMapFileExtension();
+
+    /// <summary> Refines a copy of a map and saves the refined, compilation-ready graph (the
+    /// post-refinement model plus remapped port elements) together with a version stamp.
+    /// Production processes can then load the map straight into compilation instead of re-running
+    /// refinement on every start. The file must use the extension returned by
+    /// `GetRefinedMapFileExtension`, so that `LoadMap` recognizes the stamped format. </summary>
+    ///
+    /// <param name="map"> The map to refine and save. </param>
+    /// <param name="filename"> The filename. </param>
+    /// <param name="maxRefinementIterations"> The maximum number of refinement iterations. </param>
+    void SaveRefinedMap(model::DynamicMap map, const std::string& filename, int maxRefinementIterations = 10);
+
+    /// <summary> Refines a copy of a map and saves the refined graph with a version stamp to a stream. </summary>
+    ///
+    /// <param name="map"> The map to refine and save. </param>
+    /// <param name="outStream"> The stream. </param>
+    /// <param name="maxRefinementIterations"> The maximum number of refinement iterations. </param>
+    void SaveRefinedMap(model::DynamicMap map, std::ostream& outStream, int maxRefinementIterations = 10);
 }
 }
 
@@ -0,0 +1,98 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ModelIndex.h (common)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// model
+#include "Model.h"
+
+// utilities
+#include "IArchivable.h"
+
+// stl
+#include <string>
+#include <vector>
+
+namespace ell
+{
+namespace common
+{
+    /// <summary> A compact sidecar summary of an archived model: a structural hash, the input and
+    /// output port schemas, and a census of node types. The index is written next to the model at
+    /// save time and can be read without parsing the archive body, so scans over many archived
+    /// models (identity checks, schema queries, deduplication) don't pay for full deserialization. </summary>
+    struct ModelIndex : public utilities::IArchivable
+    {
+        /// <summary> A hex digest over the node types, port schemas and edge structure of the model.
+        /// Structurally identical models hash identically, regardless of node ids. </summary>
+        std::string structuralHash;
+
+        /// <summary> The number of nodes in the model. </summary>
+        size_t numNodes = 0;
+
+        /// <summary> One "type[size]" entry per input node, in model order. </summary>
+        std::vector<std::string> inputSchemas;
+
+        /// <summary> One "type[size]" entry per output node, in model order. </summary>
+        std::vector<std::string> outputSchemas;
+
+        /// <summary> The node census: each distinct node type name... </summary>
+        std::vector<std::string> nodeTypes;
+
+        /// <summary> ...and its number of occurrences. </summary>
+        std::vector<size_t> nodeTypeCounts;
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        static std::string GetTypeName() { return "ModelIndex"; }
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        virtual std::string GetRuntimeTypeName() const override { return GetTypeName(); }
+
+        /// <summary> Adds an object's properties to an `Archiver` </summary>
+        ///
+        /// <param name="archiver"> The `Archiver` to add the values from the object to </param>
+        virtual void WriteToArchive(utilities::Archiver& archiver) const override;
+
+        /// <summary> Sets the internal state of the object according to the archiver passed in </summary>
+        ///
+        /// <param name="archiver"> The `Archiver` to get state from </param>
+        virtual void ReadFromArchive(utilities::Unarchiver& archiver) override;
+    };
+
+    /// <summary> Builds the index of a model. </summary>
+    ///
+    /// <param name="model"> The model. </param>
+    ///
+    /// <returns> The model's index. </returns>
+    ModelIndex BuildModelIndex(const model::Model& model);
+
+    /// <summary> Returns the filename of the sidecar index of a model file. </summary>
+    ///
+    /// <param name="modelFilename"> The model filename. </param>
+    ///
+    /// <returns> The index filename. </returns>
+    std::string GetModelIndexFilename(const std::string& modelFilename);
+
+    /// <summary> Saves the index of a model to the sidecar file next to the model file. </summary>
+    ///
+    /// <param name="model"> The model. </param>
+    /// <param name="modelFilename"> The model filename. </param>
+    void SaveModelIndex(const model::Model& model, const std::string& modelFilename);
+
+    /// <summary> Loads the sidecar index of a model file, without touching the model file itself. </summary>
+    ///
+    /// <param name="modelFilename"> The model filename. </param>
+    ///
+    /// <returns> The model's index. </returns>
+    ModelIndex LoadModelIndex(const std::string& modelFilename);
+}
+}
@@ -0,0 +1,94 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ShardedDataset.h (common)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// stl
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace ell
+{
+namespace common
+{
+    /// <summary> One shard of a dataset: a half-open byte range of the dataset file and the
+    /// filename its worker writes its ordered outputs to. </summary>
+    struct DatasetShard
+    {
+        /// <summary> Zero-based shard index; outputs are merged in index order. </summary>
+        size_t index = 0;
+
+        /// <summary> First byte of the shard in the dataset file. </summary>
+        size_t startOffset = 0;
+
+        /// <summary> One past the last byte of the shard. </summary>
+        size_t endOffset = 0;
+
+        /// <summary> The file the worker processing this shard writes its output to. </summary>
+        std::string outputFilename;
+    };
+
+    /// <summary> A shard manifest: a dataset filename plus an ordered list of byte-range shards
+    /// that together cover it. The manifest is the unit of scheduling for distributed scoring:
+    /// every worker loads the same manifest (and the same compiled map), claims a shard index,
+    /// and writes that shard's output file; any machine can process any shard, so to absorb
+    /// stragglers, create several times more shards than workers and hand unfinished shards to
+    /// whichever worker goes idle. </summary>
+    struct ShardManifest
+    {
+        /// <summary> The dataset file the shards index into. </summary>
+        std::string datasetFilename;
+
+        /// <summary> The shards, in merge order. </summary>
+        std::vector<DatasetShard> shards;
+    };
+
+    /// <summary> Splits a dataset file into shards of roughly equal byte size, snapping each
+    /// boundary forward to the next line break so no example straddles two shards. </summary>
+    ///
+    /// <param name="datasetFilename"> The dataset filename. </param>
+    /// <param name="numShards"> The number of shards to create. </param>
+    /// <param name="outputPrefix"> Prefix for the shard output filenames; shard i writes to
+    /// "&lt;outputPrefix&gt;.&lt;i&gt;". </param>
+    ///
+    /// <returns> The manifest. </returns>
+    ShardManifest CreateShardManifest(const std::string& datasetFilename, size_t numShards, const std::string& outputPrefix);
+
+    /// <summary> Saves a shard manifest to a file, as one text line per shard. Lines starting
+    /// with '#' are comments. </summary>
+    ///
+    /// <param name="manifest"> The manifest. </param>
+    /// <param name="filename"> The filename. </param>
+    void SaveShardManifest(const ShardManifest& manifest, const std::string& filename);
+
+    /// <summary> Loads a shard manifest from a file. </summary>
+    ///
+    /// <param name="filename"> The filename. </param>
+    ///
+    /// <returns> The manifest. </returns>
+    ShardManifest LoadShardManifest(const std::string& filename);
+
+    /// <summary> Reads the bytes of one shard of the dataset. </summary>
+    ///
+    /// <param name="manifest"> The manifest. </param>
+    /// <param name="shardIndex"> The shard index. </param>
+    ///
+    /// <returns> The shard's bytes. </returns>
+    std::string ReadShard(const ShardManifest& manifest, size_t shardIndex);
+
+    /// <summary> Concatenates the shard output files in shard order into a single stream,
+    /// restoring the input order of the dataset. Throws if any shard output is missing, so an
+    /// incomplete run can't silently produce a truncated result. </summary>
+    ///
+    /// <param name="manifest"> The manifest. </param>
+    /// <param name="outputStream"> The stream to write the merged output to. </param>
+    void MergeShardOutputs(const ShardManifest& manifest, std::ostream& outputStream);
+}
+}
@@ -44,6 +44,15 @@ namespace common
 
         /// <summary> Generate verbose output. </summary>
         bool verbose;
+
+        /// <summary> Track instrumented allocations and log the run's allocation profile. </summary>
+        bool logAllocationProfile = false;
+
+        /// <summary> Number of epochs between telemetry reports to stderr (0 = no telemetry). </summary>
+        size_t telemetryInterval = 0;
+
+        /// <summary> Publish telemetry reports as JSON lines instead of readable text. </summary>
+        bool telemetryJson = false;
     };
 
     /// <summary> A version of TrainerArguments that adds its members to the command line parser. </summary>
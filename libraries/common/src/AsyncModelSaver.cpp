@@ -0,0 +1,146 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     AsyncModelSaver.cpp (common)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "AsyncModelSaver.h"
+#include "LoadModel.h"
+#include "ModelIndex.h"
+
+// utilities
+#include "BinaryArchiver.h"
+#include "Exception.h"
+#include "Files.h"
+
+// stl
+#include <cstdio>
+
+namespace ell
+{
+namespace common
+{
+    AsyncModelSaver::~AsyncModelSaver()
+    {
+        Wait();
+    }
+
+    void AsyncModelSaver::SaveModelAsync(model::Model model, const std::string& filename)
+    {
+        bool binaryFormat = (utilities::GetFileExtension(filename, true) == "ellb");
+        BeginSave(filename,
+                  [model = std::move(model), binaryFormat](std::ostream& stream) {
+                      if (binaryFormat)
+                      {
+                          utilities::BinaryArchiver archiver(stream);
+                          archiver.Archive(model);
+                      }
+                      else
+                      {
+                          SaveModel(model, stream);
+                      }
+                  },
+                  [model, filename]() {
+                      // as in SaveModel, the sidecar index is best-effort
+                      try
+                      {
+                          SaveModelIndex(model, filename);
+                      }
+                      catch (const utilities::Exception&)
+                      {
+                      }
+                  });
+    }
+
+    void AsyncModelSaver::SaveMapAsync(model::DynamicMap map, const std::string& filename)
+    {
+        BeginSave(filename,
+                  [map = std::move(map)](std::ostream& stream) {
+                      SaveMap(map, stream);
+                  },
+                  nullptr);
+    }
+
+    AsyncSaveStatus AsyncModelSaver::GetStatus() const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _status;
+    }
+
+    std::string AsyncModelSaver::GetLastError() const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _lastError;
+    }
+
+    void AsyncModelSaver::Wait()
+    {
+        if (_worker.joinable())
+        {
+            _worker.join();
+        }
+    }
+
+    void AsyncModelSaver::BeginSave(const std::string& filename, std::function<void(std::ostream&)> serialize, std::function<void()> afterRename)
+    {
+        Wait(); // back-to-back requests serialize; checkpoints are meant to be far apart
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _status = AsyncSaveStatus::saving;
+            _lastError = "";
+        }
+
+        _worker = std::thread([this, filename, serialize = std::move(serialize), afterRename = std::move(afterRename)]() {
+            auto temporaryFilename = filename + ".partial";
+            try
+            {
+                {
+                    auto stream = utilities::OpenOfstream(temporaryFilename);
+                    serialize(stream);
+                    if (!stream)
+                    {
+                        throw utilities::SystemException(utilities::SystemExceptionErrors::fileNotWritable, "Error writing file " + temporaryFilename);
+                    }
+                } // close the stream before renaming
+
+                // atomically replace the target, so a reader never sees a partial archive; some
+                // platforms won't rename over an existing file, so fall back to removing it first
+                if (std::rename(temporaryFilename.c_str(), filename.c_str()) != 0)
+                {
+                    std::remove(filename.c_str());
+                    if (std::rename(temporaryFilename.c_str(), filename.c_str()) != 0)
+                    {
+                        throw utilities::SystemException(utilities::SystemExceptionErrors::fileNotWritable, "Error renaming " + temporaryFilename + " to " + filename);
+                    }
+                }
+
+                if (afterRename != nullptr)
+                {
+                    afterRename();
+                }
+                SetResult(AsyncSaveStatus::succeeded, "");
+            }
+            catch (const utilities::Exception& exception)
+            {
+                std::remove(temporaryFilename.c_str());
+                SetResult(AsyncSaveStatus::failed, exception.GetMessage());
+            }
+            catch (const std::exception& exception)
+            {
+                std::remove(temporaryFilename.c_str());
+                SetResult(AsyncSaveStatus::failed, exception.what());
+            }
+        });
+    }
+
+    void AsyncModelSaver::SetResult(AsyncSaveStatus status, const std::string& error)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _status = status;
+        _lastError = error;
+    }
+}
+}
@@ -37,6 +37,14 @@ namespace common
             "dd",
             "Number of elements to read from each data vector",
             "");
+
+        parser.AddOption(
+            datasetLayout,
+            "datasetLayout",
+            "dl",
+            "In-memory layout for the loaded dataset",
+            { { "contiguous", DatasetLayout::contiguous }, { "interleaved", DatasetLayout::interleaved }, { "sharded", DatasetLayout::sharded } },
+            "contiguous");
     }
 
     utilities::CommandLineParseResult ParsedDataLoadArguments::PostProcess(const utilities::CommandLineParser& parser)
@@ -9,42 +9,438 @@
 #include "DataLoaders.h"
 
 // utilities
+#include "AllocationTracker.h"
+#include "Exception.h"
 #include "Files.h"
+#include "ThreadPool.h"
 
 // data
+#include "BinaryDataset.h"
 #include "Dataset.h"
 #include "SequentialLineIterator.h"
 
 #include "SingleLineParsingExampleIterator.h"
 #include "AutoDataVector.h"
 #include "WeightLabel.h"
+#include "CsvParsingIterator.h"
 #include "GeneralizedSparseParsingIterator.h"
+#include "LibsvmParsingIterator.h"
 
 // model
 #include "DynamicMap.h"
 
 // stl
+#include <algorithm>
+#include <cstdio>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <map>
 #include <memory>
 #include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
 
 namespace ell
 {
 namespace common
 {
-    data::AutoSupervisedExampleIterator GetExampleIterator(std::istream& stream)
+    namespace
     {
-        data::SequentialLineIterator textLineIterator(stream); 
+        template <typename ParsingIteratorType>
+        data::AutoSupervisedExampleIterator GetFormatExampleIterator(std::istream& stream)
+        {
+            // keep a few megabyte-sized blocks in flight on a background reader thread, so parsing
+            // overlaps with I/O and read stalls on slow (e.g. network) volumes don't serialize the load
+            data::SequentialLineIterator textLineIterator(stream, '\n', 4);
+
+            data::LabelParser metadataParser;
+
+            data::AutoDataVectorParser<ParsingIteratorType> dataVectorParser;
 
-        data::LabelParser metadataParser;
+            return data::MakeSingleLineParsingExampleIterator(std::move(textLineIterator), std::move(metadataParser), std::move(dataVectorParser));
+        }
+
+        std::map<std::string, ExampleIteratorFactory>& GetParserRegistry()
+        {
+            static std::map<std::string, ExampleIteratorFactory> registry{
+                { "sparse", GetFormatExampleIterator<data::GeneralizedSparseParsingIterator> },
+                { "csv", GetFormatExampleIterator<data::CsvParsingIterator> },
+                { "libsvm", GetFormatExampleIterator<data::LibsvmParsingIterator> }
+            };
+            return registry;
+        }
+    }
 
-        data::AutoDataVectorParser<data::GeneralizedSparseParsingIterator> dataVectorParser;
+    void RegisterDatasetParser(const std::string& formatName, ExampleIteratorFactory factory)
+    {
+        GetParserRegistry()[formatName] = std::move(factory);
+    }
+
+    std::string SniffDatasetFormat(const std::string& filename, std::istream& stream)
+    {
+        // the extension, when there is one, wins
+        auto dotPosition = filename.find_last_of('.');
+        if (dotPosition != std::string::npos)
+        {
+            auto extension = filename.substr(dotPosition + 1);
+            if (extension == "csv")
+            {
+                return "csv";
+            }
+            if (extension == "libsvm" || extension == "svm")
+            {
+                return "libsvm";
+            }
+        }
 
-        return data::MakeSingleLineParsingExampleIterator(std::move(textLineIterator), std::move(metadataParser), std::move(dataVectorParser));
+        // otherwise peek at the first line, restoring the stream position afterwards; a comma
+        // means csv, anything else is taken to be the native generalized sparse format
+        auto startPosition = stream.tellg();
+        if (startPosition != std::streampos(-1))
+        {
+            std::string firstLine;
+            std::getline(stream, firstLine);
+            stream.clear();
+            stream.seekg(startPosition);
+            if (firstLine.find(',') != std::string::npos)
+            {
+                return "csv";
+            }
+        }
+        return "sparse";
+    }
+
+    data::AutoSupervisedExampleIterator GetExampleIterator(std::istream& stream)
+    {
+        return GetFormatExampleIterator<data::GeneralizedSparseParsingIterator>(stream);
+    }
+
+    data::AutoSupervisedExampleIterator GetExampleIterator(std::istream& stream, const std::string& formatName)
+    {
+        auto& registry = GetParserRegistry();
+        auto entry = registry.find(formatName);
+        if (entry == registry.end())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "unknown dataset format: " + formatName);
+        }
+        return entry->second(stream);
     }
 
     data::AutoSupervisedDataset GetDataset(std::istream& stream)
     {
+        utilities::ScopedAllocationTag tag(utilities::AllocationTag::dataLoading);
         return data::MakeDataset(GetExampleIterator(stream));
     }
+
+    data::AutoSupervisedDataset GetDataset(std::istream& stream, const std::string& formatName)
+    {
+        utilities::ScopedAllocationTag tag(utilities::AllocationTag::dataLoading);
+        return data::MakeDataset(GetExampleIterator(stream, formatName));
+    }
+
+    namespace
+    {
+        // an example iterator that owns the file stream it parses, so it stays valid after the
+        // factory that created it goes away
+        class FileExampleIterator : public data::IExampleIterator<data::AutoSupervisedExample>
+        {
+        public:
+            FileExampleIterator(const std::string& filename, const std::string& formatName)
+                : _stream(std::make_unique<std::ifstream>(utilities::OpenIfstream(filename))), _iterator(GetExampleIterator(*_stream, formatName))
+            {
+            }
+
+            virtual bool IsValid() const override { return _iterator.IsValid(); }
+            virtual void Next() override { _iterator.Next(); }
+            virtual data::AutoSupervisedExample Get() const override { return _iterator.Get(); }
+
+        private:
+            std::unique_ptr<std::ifstream> _stream; // must outlive _iterator
+            data::AutoSupervisedExampleIterator _iterator;
+        };
+    }
+
+    std::function<data::AutoSupervisedExampleIterator()> GetExampleIteratorFactory(const std::string& filename)
+    {
+        if (!utilities::IsFileReadable(filename))
+        {
+            throw utilities::SystemException(utilities::SystemExceptionErrors::fileNotFound);
+        }
+
+        // sniff the format once, so reopening the file each epoch doesn't re-run detection
+        auto sniffStream = utilities::OpenIfstream(filename);
+        auto formatName = SniffDatasetFormat(filename, sniffStream);
+
+        return [filename, formatName]() {
+            return data::AutoSupervisedExampleIterator(std::make_unique<FileExampleIterator>(filename, formatName));
+        };
+    }
+
+    namespace
+    {
+        // an example iterator that copies every example it yields into a binary cache file as a
+        // side effect; the cache is only marked usable once the iteration reaches the end, so an
+        // abandoned epoch never leaves a truncated cache behind
+        class CachingExampleIterator : public data::IExampleIterator<data::AutoSupervisedExample>
+        {
+        public:
+            CachingExampleIterator(std::unique_ptr<FileExampleIterator> iterator, const std::string& cacheFilename, std::shared_ptr<bool> cacheReady)
+                : _iterator(std::move(iterator)), _writer(cacheFilename), _cacheFilename(cacheFilename), _cacheReady(std::move(cacheReady))
+            {
+                if (!_iterator->IsValid())
+                {
+                    Finish();
+                }
+            }
+
+            virtual ~CachingExampleIterator()
+            {
+                if (!*_cacheReady)
+                {
+                    // abandoned part-way: discard the partial cache
+                    _writer.Close();
+                    std::remove(_cacheFilename.c_str());
+                }
+            }
+
+            virtual bool IsValid() const override { return _iterator->IsValid(); }
+
+            virtual void Next() override
+            {
+                EnsureCurrentWritten();
+                _currentWritten = false;
+                _iterator->Next();
+                if (!_iterator->IsValid())
+                {
+                    Finish();
+                }
+            }
+
+            virtual data::AutoSupervisedExample Get() const override
+            {
+                // parse once, use for both the caller and the cache
+                _current = _iterator->Get();
+                _haveCurrent = true;
+                return _current;
+            }
+
+        private:
+            void EnsureCurrentWritten()
+            {
+                if (!_haveCurrent)
+                {
+                    _current = _iterator->Get();
+                    _haveCurrent = true;
+                }
+                if (!_currentWritten)
+                {
+                    _writer.WriteExample(_current);
+                    _currentWritten = true;
+                }
+                _haveCurrent = false;
+            }
+
+            void Finish()
+            {
+                _writer.Close();
+                *_cacheReady = true;
+            }
+
+            std::unique_ptr<FileExampleIterator> _iterator;
+            data::BinaryDatasetWriter _writer;
+            std::string _cacheFilename;
+            std::shared_ptr<bool> _cacheReady;
+            mutable data::AutoSupervisedExample _current;
+            mutable bool _haveCurrent = false;
+            bool _currentWritten = false;
+        };
+    }
+
+    std::function<data::AutoSupervisedExampleIterator()> GetCachedExampleIteratorFactory(const std::string& filename, const std::string& cacheFilename)
+    {
+        if (!utilities::IsFileReadable(filename))
+        {
+            throw utilities::SystemException(utilities::SystemExceptionErrors::fileNotFound);
+        }
+
+        // sniff the format once, so the parsing epoch doesn't re-run detection
+        auto sniffStream = utilities::OpenIfstream(filename);
+        auto formatName = SniffDatasetFormat(filename, sniffStream);
+
+        auto cacheReady = std::make_shared<bool>(false);
+        return [filename, formatName, cacheFilename, cacheReady]() {
+            if (*cacheReady)
+            {
+                // later epochs walk the memory-mapped binary cache; the iterator keeps the
+                // mapping alive, so the dataset object doesn't need to outlive this call
+                return data::MemoryMappedDataset<data::AutoSupervisedExample>(cacheFilename).GetExampleIterator();
+            }
+            auto fileIterator = std::make_unique<FileExampleIterator>(filename, formatName);
+            return data::AutoSupervisedExampleIterator(std::make_unique<CachingExampleIterator>(std::move(fileIterator), cacheFilename, cacheReady));
+        };
+    }
+
+    namespace
+    {
+        // parses a chunk of lines into examples, skipping blank and comment lines
+        std::vector<data::AutoSupervisedExample> ParseChunk(std::vector<std::string> lines)
+        {
+            std::vector<data::AutoSupervisedExample> examples;
+            examples.reserve(lines.size());
+            for (auto& line : lines)
+            {
+                data::TextLine textLine(std::move(line));
+                textLine.TrimLeadingWhitespace();
+                if (textLine.IsEndOfContent())
+                {
+                    continue;
+                }
+
+                auto metadata = data::LabelParser::Parse(textLine);
+                auto dataVector = data::AutoDataVectorParser<data::GeneralizedSparseParsingIterator>::Parse(textLine);
+                examples.emplace_back(std::move(dataVector), std::move(metadata));
+            }
+            return examples;
+        }
+
+        // parses a range of lines into a dataset, on the worker thread that will own the shard, so
+        // the shard's example storage is first-touched (and, on NUMA machines, placed) by that worker
+        data::AutoSupervisedDataset ParseShard(std::vector<std::string> lines)
+        {
+            utilities::ScopedAllocationTag tag(utilities::AllocationTag::dataLoading);
+            data::AutoSupervisedDataset shard;
+            for (auto& example : ParseChunk(std::move(lines)))
+            {
+                shard.AddExample(std::move(example));
+            }
+            return shard;
+        }
+    }
+
+    data::AutoSupervisedDataset GetDatasetParallel(std::istream& stream, size_t numThreads)
+    {
+        if (numThreads == 0)
+        {
+            numThreads = utilities::GetThreadPool().NumThreads();
+        }
+        if (numThreads <= 1)
+        {
+            return GetDataset(stream);
+        }
+
+        const size_t chunkSize = 1024;
+        data::AutoSupervisedDataset dataset;
+
+        // keep at most numThreads chunks in flight, and append parsed chunks in the order they
+        // were read, so example order matches the stream and memory use stays bounded
+        std::deque<std::future<std::vector<data::AutoSupervisedExample>>> inFlight;
+        bool moreLines = true;
+        while (moreLines || !inFlight.empty())
+        {
+            while (moreLines && inFlight.size() < numThreads)
+            {
+                std::vector<std::string> lines;
+                lines.reserve(chunkSize);
+                std::string line;
+                while (lines.size() < chunkSize && std::getline(stream, line))
+                {
+                    lines.push_back(std::move(line));
+                }
+                if (lines.size() < chunkSize)
+                {
+                    moreLines = false;
+                }
+                if (!lines.empty())
+                {
+                    inFlight.push_back(utilities::GetThreadPool().Submit(ParseChunk, std::move(lines)));
+                }
+            }
+
+            if (inFlight.empty())
+            {
+                break;
+            }
+            utilities::GetThreadPool().Wait(inFlight.front());
+            auto examples = inFlight.front().get();
+            inFlight.pop_front();
+            for (auto& example : examples)
+            {
+                dataset.AddExample(std::move(example));
+            }
+        }
+        return dataset;
+    }
+
+    std::vector<data::AutoSupervisedDataset> GetDatasetShards(std::istream& stream, size_t numShards)
+    {
+        if (numShards == 0)
+        {
+            numShards = utilities::GetThreadPool().NumThreads();
+        }
+        if (numShards <= 1)
+        {
+            std::vector<data::AutoSupervisedDataset> shards;
+            shards.push_back(GetDataset(stream));
+            return shards;
+        }
+
+        std::vector<std::string> lines;
+        std::string line;
+        while (std::getline(stream, line))
+        {
+            lines.push_back(std::move(line));
+        }
+
+        // split the lines into contiguous ranges and hand each range to its own worker, which
+        // parses it into the shard it returns -- the worker does all of the shard's allocation
+        numShards = std::min(numShards, std::max<size_t>(lines.size(), 1));
+        size_t shardSize = (lines.size() + numShards - 1) / numShards;
+        std::vector<std::future<data::AutoSupervisedDataset>> futures;
+        for (size_t begin = 0; begin < lines.size(); begin += shardSize)
+        {
+            auto end = std::min(begin + shardSize, lines.size());
+            std::vector<std::string> shardLines(std::make_move_iterator(lines.begin() + begin), std::make_move_iterator(lines.begin() + end));
+            futures.push_back(utilities::GetThreadPool().Submit(ParseShard, std::move(shardLines)));
+        }
+
+        std::vector<data::AutoSupervisedDataset> shards;
+        shards.reserve(futures.size());
+        for (auto& future : futures)
+        {
+            utilities::GetThreadPool().Wait(future);
+            shards.push_back(future.get());
+        }
+        return shards;
+    }
+
+    data::AutoSupervisedDataset GetDataset(std::istream& stream, DatasetLayout layout)
+    {
+        switch (layout)
+        {
+        case DatasetLayout::interleaved:
+            return GetDatasetParallel(stream);
+
+        case DatasetLayout::sharded:
+        {
+            // moving the examples out of their shards keeps the example storage on the pages the
+            // workers first touched; only the (small) vector of example objects is reallocated
+            data::AutoSupervisedDataset dataset;
+            for (auto& shard : GetDatasetShards(stream))
+            {
+                for (size_t i = 0; i < shard.NumExamples(); ++i)
+                {
+                    dataset.AddExample(std::move(shard.GetExample(i)));
+                }
+            }
+            return dataset;
+        }
+
+        default:
+            return GetDataset(stream);
+        }
+    }
 }
 }
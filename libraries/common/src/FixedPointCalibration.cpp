@@ -0,0 +1,78 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     FixedPointCalibration.cpp (common)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "FixedPointCalibration.h"
+
+// model
+#include "Node.h"
+#include "OutputPort.h"
+
+// stl
+#include <algorithm>
+#include <sstream>
+
+namespace ell
+{
+namespace common
+{
+    namespace
+    {
+        struct ValueRange
+        {
+            double minValue = 0.0;
+            double maxValue = 0.0;
+        };
+
+        std::string GetPortKey(const model::Node& node, const model::OutputPortBase& port)
+        {
+            std::stringstream ss;
+            ss << node.GetId() << "." << port.GetName();
+            return ss.str();
+        }
+    }
+
+    std::map<std::string, emitters::QFormat> CalibrateQFormats(model::DynamicMap& map, data::AutoSupervisedExampleIterator exampleIterator, int wordBits)
+    {
+        std::map<std::string, ValueRange> ranges;
+
+        while (exampleIterator.IsValid())
+        {
+            // computing the map output leaves every output port in the model holding its value
+            // for this example, so the intermediate ranges can be read off afterwards
+            map.SetInputValue(0, exampleIterator.Get().GetDataVector());
+            map.ComputeOutput<double>(0);
+
+            auto nodeIterator = map.GetModel().GetNodeIterator();
+            while (nodeIterator.IsValid())
+            {
+                const auto* node = nodeIterator.Get();
+                for (const auto* outputPort : node->GetOutputPorts())
+                {
+                    auto key = GetPortKey(*node, *outputPort);
+                    auto& range = ranges[key];
+                    for (auto value : outputPort->GetDoubleOutput())
+                    {
+                        range.minValue = std::min(range.minValue, value);
+                        range.maxValue = std::max(range.maxValue, value);
+                    }
+                }
+                nodeIterator.Next();
+            }
+
+            exampleIterator.Next();
+        }
+
+        std::map<std::string, emitters::QFormat> formats;
+        for (const auto& entry : ranges)
+        {
+            formats[entry.first] = emitters::QFormat::FromRange(entry.second.minValue, entry.second.maxValue, wordBits);
+        }
+        return formats;
+    }
+}
+}
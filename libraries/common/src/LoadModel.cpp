@@ -7,6 +7,7 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "LoadModel.h"
+#include "ModelIndex.h"
 
 // model
 #include "DynamicMap.h"
@@ -17,21 +18,31 @@
 // nodes
 #include "BinaryOperationNode.h"
 #include "BinaryPredicateNode.h"
+#include "BufferNode.h"
+#include "ConfidenceGateNode.h"
 #include "DelayNode.h"
 #include "DotProductNode.h"
+#include "ExponentialMovingAverageNode.h"
 #include "ExtremalValueNode.h"
 #include "ForestPredictorNode.h"
+#include "InputNormalizationNode.h"
 #include "L2NormNode.h"
 #include "LinearPredictorNode.h"
 #include "MovingAverageNode.h"
+#include "MovingExtremumNode.h"
 #include "MovingVarianceNode.h"
+#include "QuantileEstimatorNode.h"
+#include "WelfordVarianceNode.h"
 #include "MultiplexerNode.h"
 #include "NeuralNetworkPredictorNode.h"
 #include "ProtoNNPredictorNode.h"
 #include "ReorderDataNode.h"
 #include "SinkNode.h"
 #include "SourceNode.h"
+#include "SparseDotProductNode.h"
+#include "SparseLinearPredictorNode.h"
 #include "UnaryOperationNode.h"
+#include "WindowFunctionNode.h"
 
 // predictors
 #include "ForestPredictor.h"
@@ -41,6 +52,7 @@
 
 // utilities
 #include "Archiver.h"
+#include "BinaryArchiver.h"
 #include "Files.h"
 #include "JsonArchiver.h"
 
@@ -197,6 +209,12 @@ namespace common
         context.GetTypeFactory().AddType<model::Node, nodes::BinaryPredicateNode<int>>();
         context.GetTypeFactory().AddType<model::Node, nodes::BinaryPredicateNode<double>>();
 
+        context.GetTypeFactory().AddType<model::Node, nodes::BufferNode<float>>();
+        context.GetTypeFactory().AddType<model::Node, nodes::BufferNode<double>>();
+
+        context.GetTypeFactory().AddType<model::Node, nodes::ConfidenceGateNode<float>>();
+        context.GetTypeFactory().AddType<model::Node, nodes::ConfidenceGateNode<double>>();
+
         context.GetTypeFactory().AddType<model::Node, nodes::ConstantNode<bool>>();
         context.GetTypeFactory().AddType<model::Node, nodes::ConstantNode<int>>();
         context.GetTypeFactory().AddType<model::Node, nodes::ConstantNode<int64_t>>();
@@ -214,6 +232,12 @@ namespace common
         context.GetTypeFactory().AddType<model::Node, nodes::DotProductNode<float>>();
         context.GetTypeFactory().AddType<model::Node, nodes::DotProductNode<double>>();
 
+        context.GetTypeFactory().AddType<model::Node, nodes::ExponentialMovingAverageNode<float>>();
+        context.GetTypeFactory().AddType<model::Node, nodes::ExponentialMovingAverageNode<double>>();
+
+        context.GetTypeFactory().AddType<model::Node, nodes::InputNormalizationNode<float>>();
+        context.GetTypeFactory().AddType<model::Node, nodes::InputNormalizationNode<double>>();
+
         context.GetTypeFactory().AddType<model::Node, nodes::L2NormNode<double>>();
         context.GetTypeFactory().AddType<model::Node, nodes::L2NormNode<float>>();
 
@@ -228,9 +252,24 @@ namespace common
         context.GetTypeFactory().AddType<model::Node, nodes::MovingAverageNode<float>>();
         context.GetTypeFactory().AddType<model::Node, nodes::MovingAverageNode<double>>();
 
+        context.GetTypeFactory().AddType<model::Node, nodes::MovingMaxNode<float>>();
+        context.GetTypeFactory().AddType<model::Node, nodes::MovingMaxNode<double>>();
+
+        context.GetTypeFactory().AddType<model::Node, nodes::MovingMinNode<float>>();
+        context.GetTypeFactory().AddType<model::Node, nodes::MovingMinNode<double>>();
+
         context.GetTypeFactory().AddType<model::Node, nodes::MovingVarianceNode<float>>();
         context.GetTypeFactory().AddType<model::Node, nodes::MovingVarianceNode<double>>();
 
+        context.GetTypeFactory().AddType<model::Node, nodes::QuantileEstimatorNode<float>>();
+        context.GetTypeFactory().AddType<model::Node, nodes::QuantileEstimatorNode<double>>();
+
+        context.GetTypeFactory().AddType<model::Node, nodes::WelfordVarianceNode<float>>();
+        context.GetTypeFactory().AddType<model::Node, nodes::WelfordVarianceNode<double>>();
+
+        context.GetTypeFactory().AddType<model::Node, nodes::WindowFunctionNode<float>>();
+        context.GetTypeFactory().AddType<model::Node, nodes::WindowFunctionNode<double>>();
+
         context.GetTypeFactory().AddType<model::Node, nodes::NeuralNetworkPredictorNode<float>>();
         context.GetTypeFactory().AddType<model::Node, nodes::NeuralNetworkPredictorNode<double>>();
 
@@ -249,6 +288,11 @@ namespace common
         context.GetTypeFactory().AddType<model::Node, nodes::SourceNode<float, &SourceNode_EmptyCallback<float>>>();
         context.GetTypeFactory().AddType<model::Node, nodes::SourceNode<double, &SourceNode_EmptyCallback<double>>>();
 
+        context.GetTypeFactory().AddType<model::Node, nodes::SparseDotProductNode<float>>();
+        context.GetTypeFactory().AddType<model::Node, nodes::SparseDotProductNode<double>>();
+
+        context.GetTypeFactory().AddType<model::Node, nodes::SparseLinearPredictorNode>();
+
         context.GetTypeFactory().AddType<model::Node, nodes::SumNode<int>>();
         context.GetTypeFactory().AddType<model::Node, nodes::SumNode<int64_t>>();
         context.GetTypeFactory().AddType<model::Node, nodes::SumNode<float>>();
@@ -305,6 +349,8 @@ namespace common
         context.GetTypeFactory().AddType<model::Node, nodes::BinaryConvolutionalLayerNode<double>>();
         context.GetTypeFactory().AddType<model::Node, nodes::ConvolutionalLayerNode<float>>();
         context.GetTypeFactory().AddType<model::Node, nodes::ConvolutionalLayerNode<double>>();
+        context.GetTypeFactory().AddType<model::Node, nodes::DepthwiseConvolutionalLayerNode<float>>();
+        context.GetTypeFactory().AddType<model::Node, nodes::DepthwiseConvolutionalLayerNode<double>>();
         context.GetTypeFactory().AddType<model::Node, nodes::FullyConnectedLayerNode<float>>();
         context.GetTypeFactory().AddType<model::Node, nodes::FullyConnectedLayerNode<double>>();
         context.GetTypeFactory().AddType<model::Node, nodes::PoolingLayerNode<float, ell::predictors::neural::MeanPoolingFunction>>();
@@ -383,7 +429,26 @@ namespace common
             }
 
             auto filestream = utilities::OpenIfstream(filename);
-            return LoadArchivedModel<utilities::JsonUnarchiver>(filestream);
+            model::Model model;
+            if (utilities::BinaryUnarchiver::HasBinarySignature(filestream))
+            {
+                model = LoadArchivedModel<utilities::BinaryUnarchiver>(filestream);
+            }
+            else
+            {
+                model = LoadArchivedModel<utilities::JsonUnarchiver>(filestream);
+            }
+
+            // when a sidecar index exists, verify that the model still matches it
+            if (utilities::IsFileReadable(GetModelIndexFilename(filename)))
+            {
+                auto index = LoadModelIndex(filename);
+                if (index.structuralHash != BuildModelIndex(model).structuralHash)
+                {
+                    throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Error: model file does not match its sidecar index.");
+                }
+            }
+            return model;
         }
     }
 
@@ -394,7 +459,24 @@ namespace common
             throw utilities::SystemException(utilities::SystemExceptionErrors::fileNotWritable);
         }
         auto filestream = utilities::OpenOfstream(filename);
-        SaveModel(model, filestream);
+        if (utilities::GetFileExtension(filename, true) == "ellb")
+        {
+            SaveArchivedObject<utilities::BinaryArchiver>(model, filestream);
+        }
+        else
+        {
+            SaveModel(model, filestream);
+        }
+
+        // also write the sidecar index, so registry scans can read the model's identity and
+        // schema without parsing the archive body; the save succeeds even if the index can't be written
+        try
+        {
+            SaveModelIndex(model, filename);
+        }
+        catch (const utilities::Exception&)
+        {
+        }
     }
 
     void SaveModel(const model::Model& model, std::ostream& outStream)
@@ -484,5 +566,34 @@ namespace common
     {
         SaveArchivedObject<utilities::JsonArchiver>(map, outStream);
     }
+
+    std::string GetRefinedMapFileExtension()
+    {
+        return "rmap";
+    }
+
+    void SaveRefinedMap(model::DynamicMap map, const std::string& filename, int maxRefinementIterations)
+    {
+        if (!utilities::IsFileWritable(filename))
+        {
+            throw utilities::SystemException(utilities::SystemExceptionErrors::fileNotWritable);
+        }
+        if (utilities::GetFileExtension(filename, true) != GetRefinedMapFileExtension())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Error: refined maps must use the '" + GetRefinedMapFileExtension() + "' extension, so LoadMap can recognize the stamped format.");
+        }
+        auto filestream = utilities::OpenOfstream(filename);
+        SaveRefinedMap(std::move(map), filestream, maxRefinementIterations);
+    }
+
+    void SaveRefinedMap(model::DynamicMap map, std::ostream& outStream, int maxRefinementIterations)
+    {
+        // pay for refinement once, at export time; the stamp lets loaders reject archives
+        // produced by an incompatible refinement pass
+        map.Refine(maxRefinementIterations);
+        utilities::JsonArchiver archiver(outStream);
+        archiver["version"] << refinedMapArchiveVersion;
+        archiver["map"] << map;
+    }
 }
 }
@@ -0,0 +1,209 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ModelIndex.cpp (common)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "ModelIndex.h"
+
+// model
+#include "InputNode.h"
+#include "InputPort.h"
+#include "Node.h"
+#include "OutputNode.h"
+#include "OutputPort.h"
+#include "PortElements.h"
+
+// utilities
+#include "Exception.h"
+#include "Files.h"
+#include "JsonArchiver.h"
+
+// stl
+#include <cstdint>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <unordered_map>
+
+namespace ell
+{
+namespace common
+{
+    namespace
+    {
+        // 64-bit FNV-1a, accumulated field by field
+        constexpr uint64_t fnvOffsetBasis = 14695981039346656037ull;
+        constexpr uint64_t fnvPrime = 1099511628211ull;
+
+        void HashCombine(uint64_t& hash, const std::string& value)
+        {
+            for (char c : value)
+            {
+                hash = (hash ^ static_cast<unsigned char>(c)) * fnvPrime;
+            }
+            hash = (hash ^ 0xff) * fnvPrime; // field separator
+        }
+
+        void HashCombine(uint64_t& hash, uint64_t value)
+        {
+            for (int i = 0; i < 8; ++i)
+            {
+                hash = (hash ^ (value & 0xff)) * fnvPrime;
+                value >>= 8;
+            }
+        }
+
+        std::string PortTypeToString(model::Port::PortType type)
+        {
+            switch (type)
+            {
+            case model::Port::PortType::smallReal:
+                return "float";
+            case model::Port::PortType::real:
+                return "double";
+            case model::Port::PortType::integer:
+                return "int";
+            case model::Port::PortType::bigInt:
+                return "int64";
+            case model::Port::PortType::categorical:
+                return "categorical";
+            case model::Port::PortType::boolean:
+                return "bool";
+            default:
+                return "none";
+            }
+        }
+
+        std::string GetPortSchemaString(const model::Port& port)
+        {
+            std::stringstream ss;
+            ss << PortTypeToString(port.GetType()) << "[" << port.Size() << "]";
+            return ss.str();
+        }
+    }
+
+    void ModelIndex::WriteToArchive(utilities::Archiver& archiver) const
+    {
+        archiver["structuralHash"] << structuralHash;
+        archiver["numNodes"] << numNodes;
+        archiver["inputSchemas"] << inputSchemas;
+        archiver["outputSchemas"] << outputSchemas;
+        archiver["nodeTypes"] << nodeTypes;
+        archiver["nodeTypeCounts"] << nodeTypeCounts;
+    }
+
+    void ModelIndex::ReadFromArchive(utilities::Unarchiver& archiver)
+    {
+        archiver["structuralHash"] >> structuralHash;
+        archiver["numNodes"] >> numNodes;
+        archiver["inputSchemas"] >> inputSchemas;
+        archiver["outputSchemas"] >> outputSchemas;
+        archiver["nodeTypes"] >> nodeTypes;
+        archiver["nodeTypeCounts"] >> nodeTypeCounts;
+    }
+
+    ModelIndex BuildModelIndex(const model::Model& model)
+    {
+        ModelIndex index;
+        uint64_t hash = fnvOffsetBasis;
+
+        // node ids change on every save/load round trip, so the hash refers to nodes by their
+        // ordinal in the model's iteration order instead
+        std::unordered_map<const model::Node*, uint64_t> nodeOrdinals;
+        std::map<std::string, size_t> census;
+
+        auto nodeIterator = model.GetNodeIterator();
+        while (nodeIterator.IsValid())
+        {
+            const auto* node = nodeIterator.Get();
+            uint64_t ordinal = nodeOrdinals.size();
+            nodeOrdinals[node] = ordinal;
+
+            auto typeName = node->GetRuntimeTypeName();
+            ++census[typeName];
+            HashCombine(hash, typeName);
+
+            for (const auto* outputPort : node->GetOutputPorts())
+            {
+                HashCombine(hash, outputPort->GetName());
+                HashCombine(hash, static_cast<uint64_t>(outputPort->GetType()));
+                HashCombine(hash, outputPort->Size());
+            }
+
+            for (const auto* inputPort : node->GetInputPorts())
+            {
+                HashCombine(hash, inputPort->GetName());
+                for (const auto& range : inputPort->GetInputElements().GetRanges())
+                {
+                    const auto* referencedPort = range.ReferencedPort();
+                    HashCombine(hash, nodeOrdinals[referencedPort->GetNode()]);
+                    HashCombine(hash, referencedPort->GetName());
+                    HashCombine(hash, range.GetStartIndex());
+                    HashCombine(hash, range.Size());
+                }
+            }
+
+            if (dynamic_cast<const model::InputNodeBase*>(node) != nullptr)
+            {
+                index.inputSchemas.push_back(GetPortSchemaString(*node->GetOutputPorts()[0]));
+            }
+            if (dynamic_cast<const model::OutputNodeBase*>(node) != nullptr)
+            {
+                index.outputSchemas.push_back(GetPortSchemaString(*node->GetOutputPorts()[0]));
+            }
+
+            ++index.numNodes;
+            nodeIterator.Next();
+        }
+
+        for (const auto& entry : census)
+        {
+            index.nodeTypes.push_back(entry.first);
+            index.nodeTypeCounts.push_back(entry.second);
+        }
+
+        std::stringstream ss;
+        ss << std::hex << std::setfill('0') << std::setw(16) << hash;
+        index.structuralHash = ss.str();
+        return index;
+    }
+
+    std::string GetModelIndexFilename(const std::string& modelFilename)
+    {
+        return modelFilename + ".index";
+    }
+
+    void SaveModelIndex(const model::Model& model, const std::string& modelFilename)
+    {
+        auto indexFilename = GetModelIndexFilename(modelFilename);
+        if (!utilities::IsFileWritable(indexFilename))
+        {
+            throw utilities::SystemException(utilities::SystemExceptionErrors::fileNotWritable);
+        }
+
+        auto index = BuildModelIndex(model);
+        auto filestream = utilities::OpenOfstream(indexFilename);
+        utilities::JsonArchiver archiver(filestream);
+        archiver.Archive(index);
+    }
+
+    ModelIndex LoadModelIndex(const std::string& modelFilename)
+    {
+        auto indexFilename = GetModelIndexFilename(modelFilename);
+        if (!utilities::IsFileReadable(indexFilename))
+        {
+            throw utilities::SystemException(utilities::SystemExceptionErrors::fileNotFound);
+        }
+
+        auto filestream = utilities::OpenIfstream(indexFilename);
+        utilities::SerializationContext context;
+        utilities::JsonUnarchiver unarchiver(filestream, context);
+        ModelIndex index;
+        unarchiver.Unarchive(index);
+        return index;
+    }
+}
+}
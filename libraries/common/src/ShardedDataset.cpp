@@ -0,0 +1,158 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ShardedDataset.cpp (common)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "ShardedDataset.h"
+
+// utilities
+#include "Exception.h"
+#include "Files.h"
+
+// stl
+#include <sstream>
+
+namespace ell
+{
+namespace common
+{
+    namespace
+    {
+        // advances the offset to one past the next line break (or to the end of the stream),
+        // so shard boundaries never split an example
+        size_t SnapToLineBreak(std::istream& stream, size_t offset, size_t fileSize)
+        {
+            if (offset >= fileSize)
+            {
+                return fileSize;
+            }
+            stream.clear();
+            stream.seekg(offset);
+            std::string partialLine;
+            std::getline(stream, partialLine);
+            return stream.good() ? static_cast<size_t>(stream.tellg()) : fileSize;
+        }
+    }
+
+    ShardManifest CreateShardManifest(const std::string& datasetFilename, size_t numShards, const std::string& outputPrefix)
+    {
+        if (numShards == 0)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "number of shards must be positive");
+        }
+
+        auto stream = utilities::OpenIfstream(datasetFilename);
+        stream.seekg(0, std::ios::end);
+        size_t fileSize = static_cast<size_t>(stream.tellg());
+
+        ShardManifest manifest;
+        manifest.datasetFilename = datasetFilename;
+
+        size_t targetShardSize = (fileSize + numShards - 1) / numShards;
+        size_t startOffset = 0;
+        for (size_t index = 0; index < numShards && startOffset < fileSize; ++index)
+        {
+            size_t endOffset = SnapToLineBreak(stream, startOffset + targetShardSize, fileSize);
+            DatasetShard shard{ manifest.shards.size(), startOffset, endOffset, outputPrefix + "." + std::to_string(manifest.shards.size()) };
+            manifest.shards.push_back(shard);
+            startOffset = endOffset;
+        }
+
+        // a snap can swallow the remaining shards' worth of bytes; the last shard absorbs the rest
+        if (!manifest.shards.empty())
+        {
+            manifest.shards.back().endOffset = fileSize;
+        }
+        return manifest;
+    }
+
+    void SaveShardManifest(const ShardManifest& manifest, const std::string& filename)
+    {
+        auto stream = utilities::OpenOfstream(filename);
+        stream << "# ELL dataset shard manifest\n";
+        stream << "# shard <index> <startOffset> <endOffset> <outputFilename>\n";
+        stream << "dataset " << manifest.datasetFilename << "\n";
+        for (const auto& shard : manifest.shards)
+        {
+            stream << "shard " << shard.index << " " << shard.startOffset << " " << shard.endOffset << " " << shard.outputFilename << "\n";
+        }
+    }
+
+    ShardManifest LoadShardManifest(const std::string& filename)
+    {
+        auto stream = utilities::OpenIfstream(filename);
+        ShardManifest manifest;
+
+        std::string line;
+        while (std::getline(stream, line))
+        {
+            if (line.empty() || line[0] == '#')
+            {
+                continue;
+            }
+
+            std::istringstream lineStream(line);
+            std::string keyword;
+            lineStream >> keyword;
+            if (keyword == "dataset")
+            {
+                lineStream >> manifest.datasetFilename;
+            }
+            else if (keyword == "shard")
+            {
+                DatasetShard shard;
+                if (!(lineStream >> shard.index >> shard.startOffset >> shard.endOffset >> shard.outputFilename))
+                {
+                    throw utilities::InputException(utilities::InputExceptionErrors::badStringFormat, "Bad shard manifest entry: " + line);
+                }
+                manifest.shards.push_back(shard);
+            }
+            else
+            {
+                throw utilities::InputException(utilities::InputExceptionErrors::badStringFormat, "Bad shard manifest entry: " + line);
+            }
+        }
+
+        if (manifest.datasetFilename.empty())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::badStringFormat, "Shard manifest is missing its dataset entry");
+        }
+        return manifest;
+    }
+
+    std::string ReadShard(const ShardManifest& manifest, size_t shardIndex)
+    {
+        if (shardIndex >= manifest.shards.size())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::indexOutOfRange, "shard index exceeds the number of shards in the manifest");
+        }
+        const auto& shard = manifest.shards[shardIndex];
+
+        auto stream = utilities::OpenIfstream(manifest.datasetFilename);
+        stream.seekg(shard.startOffset);
+        std::string bytes(shard.endOffset - shard.startOffset, '\0');
+        stream.read(&bytes[0], bytes.size());
+        if (static_cast<size_t>(stream.gcount()) != bytes.size())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::badData, "dataset file is shorter than the shard manifest describes");
+        }
+        return bytes;
+    }
+
+    void MergeShardOutputs(const ShardManifest& manifest, std::ostream& outputStream)
+    {
+        for (const auto& shard : manifest.shards)
+        {
+            if (!utilities::IsFileReadable(shard.outputFilename))
+            {
+                throw utilities::InputException(utilities::InputExceptionErrors::badData, "missing output for shard " + std::to_string(shard.index) + ": " + shard.outputFilename);
+            }
+            auto shardStream = utilities::OpenIfstream(shard.outputFilename);
+            outputStream << shardStream.rdbuf();
+        }
+    }
+}
+}
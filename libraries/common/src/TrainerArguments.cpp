@@ -28,6 +28,27 @@ namespace common
             "Verbose output",
             false);
 
+        parser.AddOption(
+            logAllocationProfile,
+            "logAllocationProfile",
+            "lap",
+            "Track instrumented allocations and log the run's allocation profile to stderr",
+            false);
+
+        parser.AddOption(
+            telemetryInterval,
+            "telemetryInterval",
+            "ti",
+            "The number of epochs between progress telemetry reports to stderr (0 = no telemetry)",
+            0);
+
+        parser.AddOption(
+            telemetryJson,
+            "telemetryJson",
+            "tj",
+            "Publish telemetry reports as JSON lines instead of readable text",
+            false);
+
         parser.AddOption(
             lossFunctionArguments.lossFunction,
             "lossFunction",
@@ -33,5 +33,18 @@ namespace common
     {
         return GetMappedDataset(GetExampleIterator(stream), map);
     }
+
+    template <typename MapType>
+    data::AutoSupervisedDataset GetMappedDataset(std::istream& stream, const MapType& map, DatasetLayout layout)
+    {
+        if (layout == DatasetLayout::contiguous)
+        {
+            // no need to materialize the unmapped dataset - stream the examples through the map
+            return GetMappedDataset(GetExampleIterator(stream), map);
+        }
+
+        auto dataset = GetDataset(stream, layout);
+        return GetMappedDataset(dataset.GetExampleIterator(), map);
+    }
 }
 }
@@ -8,6 +8,7 @@
 
 // utilities
 #include "Archiver.h"
+#include "BinaryArchiver.h"
 #include "Files.h"
 #include "JsonArchiver.h"
 
@@ -35,6 +36,27 @@ namespace common
         }
     }
 
+    // STYLE internal use only from .tcc, so not declared inside header file
+    template <typename UnarchiverType, typename MapType>
+    MapType LoadArchivedRefinedMap(std::istream& stream)
+    {
+        utilities::SerializationContext context;
+        RegisterNodeTypes(context);
+        RegisterMapTypes(context);
+        UnarchiverType unarchiver(stream, context);
+
+        int version = 0;
+        unarchiver["version"] >> version;
+        if (version != refinedMapArchiveVersion)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::badData, "Error: refined map was exported by an incompatible refinement pass; re-export it with the current tools.");
+        }
+
+        MapType map;
+        unarchiver["map"] >> map;
+        return map;
+    }
+
     template <typename MapType>
     MapType LoadMap(const std::string& filename)
     {
@@ -49,6 +71,20 @@ namespace common
         }
 
         auto filestream = utilities::OpenIfstream(filename);
+        if (utilities::GetFileExtension(filename, true) == GetRefinedMapFileExtension())
+        {
+            // already-refined, stamped archive: goes straight to compilation, no refinement pass
+            if (utilities::BinaryUnarchiver::HasBinarySignature(filestream))
+            {
+                return LoadArchivedRefinedMap<utilities::BinaryUnarchiver, MapType>(filestream);
+            }
+            return LoadArchivedRefinedMap<utilities::JsonUnarchiver, MapType>(filestream);
+        }
+
+        if (utilities::BinaryUnarchiver::HasBinarySignature(filestream))
+        {
+            return LoadArchivedMap<utilities::BinaryUnarchiver, MapType>(filestream);
+        }
         return LoadArchivedMap<utilities::JsonUnarchiver, MapType>(filestream);
     }
 
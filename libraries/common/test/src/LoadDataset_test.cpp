@@ -18,7 +18,9 @@
 #include "Files.h"
 
 // stl
+#include <cstdio>
 #include <iostream>
+#include <sstream>
 
 namespace ell
 {
@@ -40,4 +42,28 @@ void TestLoadMappedDataset()
     auto stream = utilities::OpenIfstream("../../../examples/data/testData.txt");
     auto dataset = common::GetMappedDataset(stream, map);
 }
+
+void TestCachedExampleIteratorFactory()
+{
+    const std::string cacheFilename = "cachedIteratorTest.bin";
+    auto factory = common::GetCachedExampleIteratorFactory("../../../examples/data/testData.txt", cacheFilename);
+
+    auto print = [](data::AutoSupervisedExampleIterator iterator) {
+        std::stringstream stream;
+        while (iterator.IsValid())
+        {
+            iterator.Get().Print(stream);
+            stream << '\n';
+            iterator.Next();
+        }
+        return stream.str();
+    };
+
+    // the first epoch parses the text and fills the cache; the second walks the cache
+    auto firstEpoch = print(factory());
+    auto secondEpoch = print(factory());
+    testing::ProcessTest("TestCachedExampleIteratorFactory (epochs match)", !firstEpoch.empty() && firstEpoch == secondEpoch);
+
+    std::remove(cacheFilename.c_str());
+}
 }
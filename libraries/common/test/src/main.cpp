@@ -38,6 +38,7 @@ int main()
 
         TestLoadDataset();
         TestLoadMappedDataset();
+        TestCachedExampleIteratorFactory();
     }
     catch (const utilities::Exception& exception)
     {
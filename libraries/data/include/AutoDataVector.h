@@ -23,6 +23,16 @@ namespace ell
 {
 namespace data
 {
+    /// <summary> The representation families that an auto data vector can be asked to choose
+    /// between: `automatic` applies the per-vector density heuristic, while `dense` and `sparse`
+    /// force the respective family (the element type is still chosen from the values). </summary>
+    enum class RepresentationPreference
+    {
+        automatic,
+        dense,
+        sparse
+    };
+
     /// <summary> Base class for DataVectors that automatically determine their internal
     /// representation. </summary>
     ///
@@ -68,6 +78,15 @@ namespace data
         /// <param name="list"> The vector of values. </param>
         AutoDataVectorBase(std::vector<double> vec);
 
+        /// <summary> Constructs a data vector from a vector of values, forcing the representation
+        /// family. Each vector's density heuristic judges that vector in isolation, so a caller that
+        /// has observed the density of an entire dataset (see Dataset::Repack) can override the
+        /// dense/sparse decision; the element type is still chosen from the values. </summary>
+        ///
+        /// <param name="vec"> The vector of values. </param>
+        /// <param name="preference"> The representation family to use. </param>
+        AutoDataVectorBase(std::vector<double> vec, RepresentationPreference preference);
+
         /// <summary> Not Implemented. </summary>
         virtual void AppendElement(size_t index, double value) override;
 
@@ -160,7 +179,7 @@ namespace data
 
     private:
         // helper function used by ctors to choose the type of data vector to use
-        void FindBestRepresentation(DefaultDataVectorType defaultDataVector);
+        void FindBestRepresentation(DefaultDataVectorType defaultDataVector, RepresentationPreference preference = RepresentationPreference::automatic);
 
         template <typename DataVectorType, utilities::IsSame<DataVectorType, DefaultDataVectorType> Concept = true>
         void SetInternal(DefaultDataVectorType defaultDataVector)
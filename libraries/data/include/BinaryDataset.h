@@ -0,0 +1,211 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     BinaryDataset.h (data)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Dataset.h"
+#include "Example.h"
+#include "ExampleIterator.h"
+#include "IndexValue.h"
+
+// utilities
+#include "Exception.h"
+
+// stl
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+
+namespace ell
+{
+namespace data
+{
+    /// <summary>
+    /// A binary on-disk dataset format. Each example is stored as its weight, its label, and a
+    /// sequence of sparse index-value pairs, all as fixed-width little-endian fields, so a reader
+    /// can consume the file without any text parsing. Files written on one platform are readable
+    /// on any other platform with the same endianness.
+    /// </summary>
+
+    /// <summary> Writes a dataset to a file in the binary dataset format. </summary>
+    ///
+    /// <typeparam name="ExampleType"> The dataset example type, whose metadata must be WeightLabel. </typeparam>
+    /// <param name="dataset"> The dataset to write. </param>
+    /// <param name="filename"> The path of the file to write. </param>
+    template <typename ExampleType>
+    void WriteBinaryDataset(const Dataset<ExampleType>& dataset, const std::string& filename);
+
+    /// <summary> Writes a binary dataset file one example at a time, so a dataset can be written
+    /// while it is being parsed or generated, without ever materializing it in memory. The example
+    /// count in the header is patched in when the writer is closed. </summary>
+    class BinaryDatasetWriter
+    {
+    public:
+        /// <summary> Opens the file and writes the header; any existing file is overwritten. </summary>
+        ///
+        /// <param name="filename"> The path of the file to write. </param>
+        BinaryDatasetWriter(const std::string& filename);
+
+        ~BinaryDatasetWriter()
+        {
+            // swallow write errors when closing implicitly; call Close() directly to see them
+            try
+            {
+                Close();
+            }
+            catch (const utilities::InputException&)
+            {
+            }
+        }
+
+        BinaryDatasetWriter(const BinaryDatasetWriter&) = delete;
+        BinaryDatasetWriter& operator=(const BinaryDatasetWriter&) = delete;
+
+        /// <summary> Appends one example to the file. </summary>
+        ///
+        /// <typeparam name="ExampleType"> The example type, whose metadata must be WeightLabel. </typeparam>
+        /// <param name="example"> The example to append. </param>
+        template <typename ExampleType>
+        void WriteExample(const ExampleType& example);
+
+        /// <summary> Patches the example count into the header and closes the file. Called by the
+        /// destructor if not called explicitly; throws if the file could not be written. </summary>
+        void Close();
+
+        /// <summary> Gets the number of examples written so far. </summary>
+        ///
+        /// <returns> The number of examples. </returns>
+        size_t NumExamplesWritten() const { return static_cast<size_t>(_numExamples); }
+
+    private:
+        std::ofstream _stream;
+        uint64_t _numExamples = 0;
+    };
+
+    /// <summary> A read-only memory-mapped file. </summary>
+    class MemoryMappedFile
+    {
+    public:
+        /// <summary> Maps an existing file into memory for reading. </summary>
+        ///
+        /// <param name="filename"> The path of the file to map. </param>
+        MemoryMappedFile(const std::string& filename);
+
+        ~MemoryMappedFile();
+
+        MemoryMappedFile(const MemoryMappedFile&) = delete;
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+        /// <summary> Gets a pointer to the mapped contents of the file. </summary>
+        ///
+        /// <returns> Pointer to the first byte of the file. </returns>
+        const char* GetData() const { return _data; }
+
+        /// <summary> Gets the size of the file. </summary>
+        ///
+        /// <returns> The file size, in bytes. </returns>
+        size_t GetSize() const { return _size; }
+
+    private:
+        const char* _data = nullptr;
+        size_t _size = 0;
+#ifdef _WIN32
+        void* _fileHandle = nullptr;
+        void* _mappingHandle = nullptr;
+#endif
+    };
+
+    /// <summary>
+    /// A dataset backed by a memory-mapped file in the binary dataset format. Opening the dataset
+    /// only maps the file, so it is effectively instantaneous regardless of the file size; pages
+    /// are faulted in by the operating system as examples are iterated, never need to fit in heap
+    /// memory, and are shared between concurrent processes through the page cache.
+    /// </summary>
+    ///
+    /// <typeparam name="ExampleType"> The example type produced by the iterator. </typeparam>
+    template <typename ExampleType>
+    class MemoryMappedDataset
+    {
+    public:
+        /// <summary> Opens a dataset file written by WriteBinaryDataset. </summary>
+        ///
+        /// <param name="filename"> The path of the file to open. </param>
+        MemoryMappedDataset(const std::string& filename);
+
+        /// <summary> Returns the number of examples in the dataset. </summary>
+        ///
+        /// <returns> The number of examples. </returns>
+        size_t NumExamples() const { return _numExamples; }
+
+        /// <summary> Gets an iterator that traverses the examples directly over the mapped pages. </summary>
+        ///
+        /// <returns> The example iterator. </returns>
+        ExampleIterator<ExampleType> GetExampleIterator() const;
+
+    private:
+        std::shared_ptr<const MemoryMappedFile> _file;
+        size_t _numExamples = 0;
+    };
+
+    /// <summary> An index-value iterator over the sparse entries of a mapped example record. </summary>
+    class MappedIndexValueIterator : public IIndexValueIterator
+    {
+    public:
+        MappedIndexValueIterator(const char* current, size_t count)
+            : _current(current), _remaining(count) {}
+
+        /// <summary> Returns true if the iterator is currently pointing to a valid iterate. </summary>
+        ///
+        /// <returns> true if valid, false if not. </returns>
+        bool IsValid() const { return _remaining > 0; }
+
+        /// <summary> Proceeds to the Next iterate. </summary>
+        void Next();
+
+        /// <summary> Returns the current index-value pair. </summary>
+        ///
+        /// <returns> The current index-value pair. </returns>
+        IndexValue Get() const;
+
+    private:
+        const char* _current;
+        size_t _remaining;
+    };
+
+    /// <summary> An example iterator that walks the records of a memory-mapped dataset file. </summary>
+    ///
+    /// <typeparam name="ExampleType"> The example type produced by the iterator. </typeparam>
+    template <typename ExampleType>
+    class MappedExampleIterator : public IExampleIterator<ExampleType>
+    {
+    public:
+        MappedExampleIterator(std::shared_ptr<const MemoryMappedFile> file, const char* current, size_t numExamples);
+
+        /// <summary> Returns true if the iterator is currently pointing to a valid iterate. </summary>
+        ///
+        /// <returns> true if valid, false if not. </returns>
+        virtual bool IsValid() const override { return _remaining > 0; }
+
+        /// <summary> Proceeds to the Next iterate. </summary>
+        virtual void Next() override;
+
+        /// <summary> Constructs and returns the current example. </summary>
+        ///
+        /// <returns> The example. </returns>
+        virtual ExampleType Get() const override;
+
+    private:
+        std::shared_ptr<const MemoryMappedFile> _file; // keeps the mapping alive for the iterator's lifetime
+        const char* _current;
+        size_t _remaining;
+    };
+}
+}
+
+#include "../tcc/BinaryDataset.tcc"
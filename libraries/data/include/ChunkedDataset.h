@@ -0,0 +1,146 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ChunkedDataset.h (data)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Dataset.h"
+#include "Example.h"
+#include "ExampleIterator.h"
+
+// stl
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace ell
+{
+namespace data
+{
+    /// <summary> An append-optimized data set that stores its examples in fixed-size blocks that are
+    /// never relocated, so appending never invalidates references to existing examples. A single
+    /// writer thread may keep appending while reader threads take snapshot iterators: a snapshot
+    /// observes a consistent prefix of the examples that were fully appended when it was taken, and
+    /// stays valid as the writer continues. This supports continuous training on live data without
+    /// copying the data set. </summary>
+    ///
+    /// <typeparam name="DatasetExampleType"> The example type. </typeparam>
+    template <typename DatasetExampleT>
+    class ChunkedDataset : public DatasetBase
+    {
+    public:
+        using DatasetExampleType = DatasetExampleT;
+
+        /// <summary> The number of examples stored in each block. </summary>
+        static constexpr size_t blockSize = 1024;
+
+        /// <summary> Iterator over a snapshot of the data set: the prefix of examples that existed
+        /// when the snapshot was taken. </summary>
+        template <typename IteratorExampleType>
+        class SnapshotExampleIterator : public IExampleIterator<IteratorExampleType>
+        {
+        public:
+            /// <summary> Returns true if the iterator is currently pointing to a valid iterate. </summary>
+            ///
+            /// <returns> true if it succeeds, false if it fails. </returns>
+            virtual bool IsValid() const override { return _current < _end; }
+
+            /// <summary> Proceeds to the Next iterate. </summary>
+            virtual void Next() override { ++_current; }
+
+            /// <summary> Gets the current example pointed to by the iterator. </summary>
+            ///
+            /// <returns> The example. </returns>
+            virtual IteratorExampleType Get() const override;
+
+            using BlockType = std::vector<DatasetExampleType>;
+            SnapshotExampleIterator(std::vector<const BlockType*> blocks, size_t fromIndex, size_t size);
+
+        private:
+            // the block pointers are copied into the snapshot, so the iterator stays valid while
+            // the writer grows the data set's own block table
+            std::vector<const BlockType*> _blocks;
+            size_t _current;
+            size_t _end;
+        };
+
+        ChunkedDataset() = default;
+
+        ChunkedDataset(const ChunkedDataset&) = delete;
+
+        ChunkedDataset<DatasetExampleType>& operator=(const ChunkedDataset&) = delete;
+
+        /// <summary> Constructs an instance of ChunkedDataset by copying the examples produced by an iterator. </summary>
+        ///
+        /// <param name="exampleIterator"> The example iterator. </param>
+        ChunkedDataset(ExampleIterator<DatasetExampleType> exampleIterator);
+
+        /// <summary> Returns the number of fully appended examples in the data set. Safe to call
+        /// while the writer is appending. </summary>
+        ///
+        /// <returns> The number of examples. </returns>
+        size_t NumExamples() const { return _size.load(std::memory_order_acquire); }
+
+        /// <summary> Returns the maximal size of any example. </summary>
+        ///
+        /// <returns> The maximal size of any example. </returns>
+        size_t NumFeatures() const { return _numFeatures; }
+
+        /// <summary> Returns a const reference to an example. The reference stays valid as more
+        /// examples are appended. </summary>
+        ///
+        /// <param name="index"> Zero-based index of the example, which must be less than NumExamples(). </param>
+        ///
+        /// <returns> Const reference to the specified example. </returns>
+        const DatasetExampleType& GetExample(size_t index) const;
+
+        /// <summary> Adds an example at the bottom of the data set. Only one thread may append at a
+        /// time, but readers may take snapshot iterators concurrently. </summary>
+        ///
+        /// <param name="example"> The example. </param>
+        void AddExample(DatasetExampleType example);
+
+        /// <summary> Returns an iterator over a snapshot of the data set: the examples that were
+        /// fully appended when this call was made. The iterator stays valid, and its contents do not
+        /// change, while the writer continues to append. </summary>
+        ///
+        /// <param name="firstExample"> Zero-based index of the first example to iterate over. </param>
+        /// <param name="size"> The number of examples to iterate over, a value of zero means all
+        /// the way to the end of the snapshot. </param>
+        ///
+        /// <returns> The iterator. </returns>
+        template <typename IteratorExampleType = DatasetExampleType>
+        ExampleIterator<IteratorExampleType> GetExampleIterator(size_t fromIndex = 0, size_t size = 0) const;
+
+        /// <summary> Returns an AnyDataset that represents a snapshot of an interval of examples
+        /// from this dataset. The snapshot is taken when an example iterator is requested from the
+        /// AnyDataset. </summary>
+        ///
+        /// <param name="firstExample"> Zero-based index of the first example in the AnyDataset. </param>
+        /// <param name="size"> The number of examples to include, a value of zero means all
+        /// the way to the end. </param>
+        ///
+        /// <returns> The AnyDataset. </returns>
+        AnyDataset GetAnyDataset(size_t fromIndex = 0, size_t size = 0) const { return AnyDataset(this, fromIndex, size); }
+
+    private:
+        using BlockType = std::vector<DatasetExampleType>;
+
+        std::vector<std::unique_ptr<BlockType>> _blocks;
+        BlockType* _currentBlock = nullptr;
+        mutable std::mutex _blocksMutex; // guards growth of the block table and snapshot copies of it
+        std::atomic<size_t> _size{ 0 };
+        size_t _numFeatures = 0; // maintained by the writer only
+    };
+
+    // friendly name
+    typedef ChunkedDataset<AutoSupervisedExample> AutoSupervisedChunkedDataset;
+}
+}
+
+#include "../tcc/ChunkedDataset.tcc"
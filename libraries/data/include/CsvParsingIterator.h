@@ -0,0 +1,55 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     CsvParsingIterator.h (data)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "IndexValue.h"
+#include "TextLine.h"
+
+namespace ell
+{
+namespace data
+{
+    /// <summary>
+    /// A parsing index-value iterator for dense comma-separated values. Fields are assigned
+    /// consecutive indices starting at zero; empty fields (consecutive commas) parse as zero.
+    /// A delimiter left at the cursor by a preceding parse (e.g. the comma after the label) is
+    /// skipped on construction.
+    /// </summary>
+    class CsvParsingIterator : public IIndexValueIterator
+    {
+    public:
+        /// <summary> Constructs an instance of CsvParsingIterator for a given line of text. </summary>
+        ///
+        /// <param name="textLine"> A TextLine object that represents a line of text. </param>
+        CsvParsingIterator(TextLine& textLine);
+
+        CsvParsingIterator(CsvParsingIterator&) = default;
+
+        CsvParsingIterator(CsvParsingIterator&&) = default;
+
+        /// <summary> Is the iterator pointing to a valid index-value pair? </summary>
+        ///
+        /// <returns> True if valid, false if not. </returns>
+        bool IsValid() const { return _isValid; }
+
+        /// <summary> Proceeds to the Next iterate. </summary>
+        void Next();
+
+        /// <summary> Returns The current index-value pair. </summary>
+        ///
+        /// <returns> An IndexValue object. </returns>
+        IndexValue Get() const { return _currentIndexValue; }
+
+    private:
+        void ReadEntry(size_t nextIndex);
+        bool _isValid = true;
+        TextLine& _textLine;
+        IndexValue _currentIndexValue;
+    };
+}
+}
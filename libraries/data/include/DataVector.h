@@ -42,7 +42,10 @@ namespace data
             SparseFloatDataVector,
             SparseShortDataVector,
             SparseByteDataVector,
+            UncompressedSparseDoubleDataVector,
+            UncompressedSparseFloatDataVector,
             SparseBinaryDataVector,
+            DenseBinaryDataVector,
             AutoDataVector
         };
 
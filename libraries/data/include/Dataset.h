@@ -15,6 +15,9 @@
 
 // utilities
 #include "AbstractInvoker.h"
+#include "AllocationTracker.h"
+#include "HugePageAllocator.h"
+#include "PerformanceProbes.h"
 #include "TypeTraits.h"
 
 // stl
@@ -31,6 +34,16 @@ namespace data
     template <typename ExampleType>
     class Dataset;
 
+    // forward declaration of PackedDataset (defined in PackedDataset.h), which is registered with
+    // the AnyDataset invoker below
+    template <typename ElementType = float>
+    class PackedDataset;
+
+    // forward declaration of ChunkedDataset (defined in ChunkedDataset.h), which is registered with
+    // the AnyDataset invoker below
+    template <typename DatasetExampleType>
+    class ChunkedDataset;
+
     /// <summary> Polymorphic interface for datasets, enables dynamic_cast operations. </summary>
     struct DatasetBase
     {
@@ -48,6 +61,17 @@ namespace data
         /// <param name="size"> The number of examples referenced by the iterator. </param>
         AnyDataset(const DatasetBase* pDataset, size_t fromIndex, size_t size);
 
+        /// <summary> Constructs an instance of AnyDataset that skips a contiguous sub-range of
+        /// examples. This is a zero-copy view: the iterator walks the parent dataset and skips the
+        /// excluded range, so cross-validation folds can share one resident dataset. </summary>
+        ///
+        /// <param name="pDataset"> Pointer to an DatasetBase. </param>
+        /// <param name="fromIndex"> Zero-based index of the first example referenced by the iterator. </param>
+        /// <param name="size"> The number of examples in the range, before exclusion. </param>
+        /// <param name="excludeFromIndex"> Zero-based index of the first excluded example. </param>
+        /// <param name="excludeSize"> The number of excluded examples. </param>
+        AnyDataset(const DatasetBase* pDataset, size_t fromIndex, size_t size, size_t excludeFromIndex, size_t excludeSize);
+
         /// <summary> Gets an example iterator of a given example type. </summary>
         ///
         /// <typeparam name="ExampleType"> Example type. </typeparam>
@@ -56,15 +80,125 @@ namespace data
         template <typename ExampleType>
         ExampleIterator<ExampleType> GetExampleIterator() const;
 
-        /// <summary> Returns the number of examples in the dataset. </summary>
+        /// <summary> Returns the number of examples in the dataset, net of any excluded range. </summary>
         ///
         /// <returns> Number of examples. </returns>
-        size_t NumExamples() const { return _size; }
+        size_t NumExamples() const;
 
     private:
         const DatasetBase* _pDataset;
         size_t _fromIndex;
         size_t _size;
+        size_t _excludeFromIndex = 0;
+        size_t _excludeSize = 0;
+    };
+
+    /// <summary> A feature-major (columnar) copy of a range of examples: each feature's values across
+    /// the range occupy one contiguous array, so scanning a single feature over all of the examples is
+    /// a unit-stride walk instead of a visit to every example object. </summary>
+    ///
+    /// <typeparam name="MetadataType"> The example metadata type. </typeparam>
+    template <typename MetadataType>
+    class ColumnMajorDataset
+    {
+    public:
+        /// <summary> Returns the number of examples in the data set. </summary>
+        ///
+        /// <returns> The number of examples. </returns>
+        size_t NumExamples() const { return _metadata.size(); }
+
+        /// <summary> Returns the number of features. </summary>
+        ///
+        /// <returns> The number of features. </returns>
+        size_t NumFeatures() const { return _columns.size(); }
+
+        /// <summary> Returns a const reference to the contiguous array of values of one feature. </summary>
+        ///
+        /// <param name="featureIndex"> Zero-based index of the feature. </param>
+        ///
+        /// <returns> Const reference to the feature's values, one per example. </returns>
+        const std::vector<double>& GetColumn(size_t featureIndex) const { return _columns[featureIndex]; }
+
+        /// <summary> Returns a const reference to the metadata of one example. </summary>
+        ///
+        /// <param name="exampleIndex"> Zero-based index of the example. </param>
+        ///
+        /// <returns> Const reference to the example's metadata. </returns>
+        const MetadataType& GetMetadata(size_t exampleIndex) const { return _metadata[exampleIndex]; }
+
+    private:
+        // filled in by Dataset::ToColumnMajor
+        template <typename DatasetExampleType>
+        friend class Dataset;
+
+        std::vector<std::vector<double>> _columns;
+        std::vector<MetadataType> _metadata;
+    };
+
+    /// <summary> Returns the representation a data vector actually stores: the internal type for
+    /// auto data vectors, and the vector's own type otherwise. </summary>
+    ///
+    /// <param name="dataVector"> The data vector. </param>
+    ///
+    /// <returns> The stored representation type. </returns>
+    inline IDataVector::Type GetStoredRepresentation(const IDataVector& dataVector) { return dataVector.GetType(); }
+
+    template <typename DefaultDataVectorType>
+    IDataVector::Type GetStoredRepresentation(const AutoDataVectorBase<DefaultDataVectorType>& dataVector) { return dataVector.GetInternalType(); }
+
+    /// <summary> Density statistics recorded while a dataset is loaded: per-column non-zero counts
+    /// and the mix of representations stored by the data vectors. Auto data vectors choose their
+    /// representation one vector at a time, so these dataset-wide observations are what reveals
+    /// when the per-vector choices are wrong for the workload (see Dataset::Repack). </summary>
+    class DatasetDensityStatistics
+    {
+    public:
+        /// <summary> Returns the number of examples observed. </summary>
+        ///
+        /// <returns> The number of examples. </returns>
+        size_t NumExamples() const { return _numExamples; }
+
+        /// <summary> Returns the number of columns observed. </summary>
+        ///
+        /// <returns> The number of columns. </returns>
+        size_t NumColumns() const { return _columnNonZeroCounts.size(); }
+
+        /// <summary> Returns the fraction of examples in which a column is non-zero. </summary>
+        ///
+        /// <param name="columnIndex"> Zero-based index of the column. </param>
+        ///
+        /// <returns> The column density. </returns>
+        double GetColumnDensity(size_t columnIndex) const;
+
+        /// <summary> Returns the fraction of non-zero entries over all examples and columns. </summary>
+        ///
+        /// <returns> The overall density. </returns>
+        double GetOverallDensity() const;
+
+        /// <summary> Returns the number of data vectors stored in a given representation. </summary>
+        ///
+        /// <param name="type"> The representation type. </param>
+        ///
+        /// <returns> The number of data vectors of that representation. </returns>
+        size_t GetRepresentationCount(IDataVector::Type type) const { return _representationCounts[static_cast<size_t>(type)]; }
+
+        /// <summary> Prints a human readable report of the statistics. </summary>
+        ///
+        /// <param name="os"> [in,out] Stream to write to. </param>
+        void Print(std::ostream& os) const;
+
+    private:
+        // filled in by Dataset::AddExample and Dataset::Repack
+        template <typename DatasetExampleType>
+        friend class Dataset;
+
+        void AddExample(const std::vector<double>& values, IDataVector::Type representation);
+        void ClearRepresentationCounts();
+        void RecordRepresentation(IDataVector::Type representation) { ++_representationCounts[static_cast<size_t>(representation)]; }
+
+        std::vector<size_t> _columnNonZeroCounts;
+        std::vector<size_t> _representationCounts = std::vector<size_t>(static_cast<size_t>(IDataVector::Type::AutoDataVector) + 1, 0);
+        size_t _numExamples = 0;
     };
 
     /// <summary> A data set of a specific example type. </summary>
@@ -90,9 +224,14 @@ namespace data
             /// <summary> Gets the current example pointer to by the iterator. </summary>
             ///
             /// <returns> The example. </returns>
-            virtual IteratorExampleType Get() const override { return _current->template CopyAs<IteratorExampleType>(); }
-
-            using InternalIteratorType = typename std::vector<DatasetExampleType>::const_iterator;
+            virtual IteratorExampleType Get() const override
+            {
+                static utilities::PerformanceProbe getExampleProbe("Dataset::ExampleIterator::Get");
+                utilities::ScopedPerformanceProbe measure(getExampleProbe);
+                return _current->template CopyAs<IteratorExampleType>();
+            }
+
+            using InternalIteratorType = typename utilities::HugePageVector<DatasetExampleType>::const_iterator;
             DatasetExampleIterator(InternalIteratorType begin, InternalIteratorType end);
 
         private:
@@ -191,6 +330,35 @@ namespace data
         /// <returns> The iterator. </returns>
         AnyDataset GetAnyDataset(size_t fromIndex = 0, size_t size = 0) const { return AnyDataset(this, fromIndex, size); }
 
+        /// <summary> Returns a zero-copy view of the examples outside of one cross-validation fold.
+        /// The view iterates over this dataset and skips the held-out fold, so k-fold training
+        /// shares one resident dataset instead of copying k-1 folds per split. </summary>
+        ///
+        /// <param name="foldIndex"> Zero-based index of the held-out fold. </param>
+        /// <param name="numFolds"> The number of folds. </param>
+        ///
+        /// <returns> An AnyDataset view of the training examples. </returns>
+        AnyDataset GetTrainingFoldDataset(size_t foldIndex, size_t numFolds) const;
+
+        /// <summary> Returns a zero-copy view of the examples in one cross-validation fold. </summary>
+        ///
+        /// <param name="foldIndex"> Zero-based index of the held-out fold. </param>
+        /// <param name="numFolds"> The number of folds. </param>
+        ///
+        /// <returns> An AnyDataset view of the held-out examples. </returns>
+        AnyDataset GetEvaluationFoldDataset(size_t foldIndex, size_t numFolds) const;
+
+        /// <summary> Returns a feature-major (columnar) copy of a range of examples, which supports
+        /// unit-stride scans of a single feature across the range. Implicit zeros beyond an example's
+        /// prefix length are filled in explicitly, up to NumFeatures(). </summary>
+        ///
+        /// <param name="fromIndex"> Zero-based index of the first example to copy. </param>
+        /// <param name="size"> The number of examples to copy, a value of zero means all
+        /// the way to the end. </param>
+        ///
+        /// <returns> The feature-major copy. </returns>
+        ColumnMajorDataset<typename DatasetExampleType::MetadataType> ToColumnMajor(size_t fromIndex = 0, size_t size = 0) const;
+
         /// <summary> Adds an example at the bottom of the matrix. </summary>
         ///
         /// <param name="example"> The example. </param>
@@ -199,6 +367,19 @@ namespace data
         /// <summary> Erases all of the examples in the Dataset. </summary>
         void Reset();
 
+        /// <summary> Returns the density statistics recorded as examples were added. </summary>
+        ///
+        /// <returns> Const reference to the statistics. </returns>
+        const DatasetDensityStatistics& GetDensityStatistics() const { return _densityStatistics; }
+
+        /// <summary> Rebuilds the representation of every example's data vector wholesale, forcing
+        /// the dense or sparse family according to the overall density observed while the dataset
+        /// was loaded. Each data vector chooses its representation in isolation at construction, so
+        /// when the feature distribution drifts, much of a dataset can end up in a representation
+        /// that is wrong for the workload as a whole; repacking applies one dataset-wide choice.
+        /// Only meaningful when the example's data vector type is an auto data vector. </summary>
+        void Repack();
+
         /// <summary> Permutes the rows of the matrix so that a prefix of them is uniformly distributed. </summary>
         ///
         /// <param name="rng"> [in,out] The random number generator. </param>
@@ -221,6 +402,35 @@ namespace data
         /// <param name="rangeSize"> Number of examples in the range from which the example is chosen. </param>
         void RandomSwap(std::default_random_engine& rng, size_t targetExampleIndex, size_t rangeFirstIndex, size_t rangeSize);
 
+        /// <summary> Shuffles the view order of the examples without moving them. Unlike `RandomPermute`,
+        /// only an index array is shuffled, so the per-epoch cost is O(n) indices rather than O(bytes) of
+        /// example payloads. The shuffled order is observed through `GetViewExample`. </summary>
+        ///
+        /// <param name="rng"> [in,out] The random number generator. </param>
+        /// <param name="blockSize"> When greater than one, runs of blockSize physically-adjacent examples
+        /// stay contiguous in the view and only the block order is shuffled, trading some randomness for
+        /// cache locality. </param>
+        void RandomPermuteView(std::default_random_engine& rng, size_t blockSize = 1);
+
+        /// <summary> Resets the view order to the physical order of the examples. </summary>
+        void ResetView() { _viewOrder.clear(); }
+
+        /// <summary> Returns a reference to an example, in the view order set by `RandomPermuteView`
+        /// (or the physical order, if the view was never permuted). </summary>
+        ///
+        /// <param name="index"> Zero-based index into the view. </param>
+        ///
+        /// <returns> Reference to the specified example. </returns>
+        DatasetExampleType& GetViewExample(size_t index);
+
+        /// <summary> Returns a const reference to an example, in the view order set by `RandomPermuteView`
+        /// (or the physical order, if the view was never permuted). </summary>
+        ///
+        /// <param name="index"> Zero-based index into the view. </param>
+        ///
+        /// <returns> Const reference to the specified example. </returns>
+        const DatasetExampleType& GetViewExample(size_t index) const;
+
         /// <summary> Sorts an interval of examples by a certain key. </summary>
         ///
         /// <typeparam name="SortKeyType"> Type of the sort key. </typeparam>
@@ -252,8 +462,10 @@ namespace data
     private:
         size_t CorrectRangeSize(size_t fromIndex, size_t size) const;
 
-        std::vector<DatasetExampleType> _examples;
+        utilities::HugePageVector<DatasetExampleType> _examples; // huge-page backed, since the example array is most of a training run's residency
+        std::vector<size_t> _viewOrder; // empty means the view is the physical order
         size_t _numFeatures = 0;
+        DatasetDensityStatistics _densityStatistics;
     };
 
     // friendly name
@@ -281,3 +493,8 @@ namespace data
 }
 
 #include "../tcc/Dataset.tcc"
+
+// included here (after the tcc) so that PackedDataset and ChunkedDataset are complete types
+// wherever the AnyDataset invoker above gets instantiated
+#include "ChunkedDataset.h"
+#include "PackedDataset.h"
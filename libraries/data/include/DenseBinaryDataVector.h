@@ -0,0 +1,222 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     DenseBinaryDataVector.h (data)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "DataVector.h"
+#include "IndexValue.h"
+
+// stl
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+
+namespace ell
+{
+namespace data
+{
+    // forward declaration
+    class DenseBinaryDataVector;
+
+    template <IterationPolicy policy>
+    class DenseBinaryDataVectorIterator;
+
+    /// <summary> An iterator over the set bits of a DenseBinaryDataVector, which iterates over all
+    /// the entries of the vector. </summary>
+    template <>
+    class DenseBinaryDataVectorIterator<IterationPolicy::all> : public IIndexValueIterator
+    {
+    public:
+        DenseBinaryDataVectorIterator(const DenseBinaryDataVectorIterator<IterationPolicy::all>&) = default;
+
+        /// <summary> Returns true if the iterator is currently pointing to a valid iterate. </summary>
+        ///
+        /// <returns> true if valid, false if not. </returns>
+        bool IsValid() const { return _index < _size; }
+
+        /// <summary> Proceeds to the Next iterate. </summary>
+        void Next() { ++_index; }
+
+        /// <summary> Returns the current iterate. </summary>
+        ///
+        /// <returns> The current iterate. </returns>
+        IndexValue Get() const;
+
+    private:
+        DenseBinaryDataVectorIterator(const uint64_t* words, size_t numWords, size_t size);
+        friend DenseBinaryDataVector;
+
+        // members
+        const uint64_t* _words;
+        size_t _numWords;
+        size_t _size;
+        size_t _index = 0;
+    };
+
+    /// <summary> An iterator over the set bits of a DenseBinaryDataVector, which skips the zero
+    /// entries. Each step peels the lowest set bit off the current 64-bit word, so iteration cost
+    /// is proportional to the number of set bits, not the dimension. </summary>
+    template <>
+    class DenseBinaryDataVectorIterator<IterationPolicy::skipZeros> : public IIndexValueIterator
+    {
+    public:
+        DenseBinaryDataVectorIterator(const DenseBinaryDataVectorIterator<IterationPolicy::skipZeros>&) = default;
+
+        /// <summary> Returns true if the iterator is currently pointing to a valid iterate. </summary>
+        ///
+        /// <returns> true if valid, false if not. </returns>
+        bool IsValid() const { return _index < _size; }
+
+        /// <summary> Proceeds to the Next iterate. </summary>
+        void Next();
+
+        /// <summary> Returns the current iterate. </summary>
+        ///
+        /// <returns> The current iterate. </returns>
+        IndexValue Get() const { return IndexValue{ _index, 1.0 }; }
+
+    private:
+        DenseBinaryDataVectorIterator(const uint64_t* words, size_t numWords, size_t size);
+        friend DenseBinaryDataVector;
+        void AdvanceToNextSetBit();
+
+        // members
+        const uint64_t* _words;
+        size_t _numWords;
+        size_t _size;
+        size_t _wordIndex = 0;
+        uint64_t _currentWord = 0; // the not-yet-visited bits of the current word
+        size_t _index = 0;
+    };
+
+    /// <summary> Implements a binary vector as a bitmap of 64-bit words. Compared to
+    /// SparseBinaryDataVector, which stores the set indices in a compressed list, the bitmap
+    /// supports word-level operations: dot products against binary vectors are AND plus popcount,
+    /// and dot products against real vectors peel set bits off whole words without decoding any
+    /// indices. The bitmap pays off when the vector isn't extremely sparse (denser than about one
+    /// set bit per 64-bit word). </summary>
+    class DenseBinaryDataVector : public DataVectorBase<DenseBinaryDataVector>
+    {
+    public:
+        DenseBinaryDataVector() = default;
+
+        DenseBinaryDataVector(DenseBinaryDataVector&& other) = default;
+
+        DenseBinaryDataVector(const DenseBinaryDataVector& other) = delete;
+
+        /// <summary> Constructs a DenseBinaryDataVector from an index value iterator. </summary>
+        ///
+        /// <typeparam name="IndexValueIteratorType"> Type of index value iterator. </typeparam>
+        /// <param name="indexValueIterator"> The index value iterator. </param>
+        template <typename IndexValueIteratorType, IsIndexValueIterator<IndexValueIteratorType> Concept = true>
+        DenseBinaryDataVector(IndexValueIteratorType indexValueIterator);
+
+        /// <summary> Constructs a data vector from an initializer list of index value pairs. </summary>
+        ///
+        /// <param name="list"> The initializer list. </param>
+        DenseBinaryDataVector(std::initializer_list<IndexValue> list);
+
+        /// <summary> Constructs a data vector from an initializer list of values. </summary>
+        ///
+        /// <param name="list"> The initializer list of values. </param>
+        DenseBinaryDataVector(std::initializer_list<double> list);
+
+        /// <summary> Constructs a data vector from a vector of index value pairs. </summary>
+        ///
+        /// <param name="vec"> The vector of index value pairs. </param>
+        DenseBinaryDataVector(std::vector<IndexValue> vec);
+
+        /// <summary> Constructs a data vector from a vector of values. </summary>
+        ///
+        /// <param name="vec"> The vector of values. </param>
+        DenseBinaryDataVector(std::vector<double> vec);
+
+        template <IterationPolicy policy>
+        using Iterator = DenseBinaryDataVectorIterator<policy>;
+
+        /// <summary>
+        /// Returns an indexValue iterator that points to the beginning of the vector, which iterates
+        /// over a prefix of the vector.
+        /// </summary>
+        ///
+        /// <typeparam name="policy"> The iteration policy. </typeparam>
+        /// <param name="size"> The prefix size. </param>
+        ///
+        /// <returns> The iterator. </returns>
+        template <IterationPolicy policy>
+        Iterator<policy> GetIterator(size_t size) const;
+
+        /// <summary>
+        /// Returns an indexValue iterator that points to the beginning of the vector, which iterates
+        /// over a prefix of length PrefixLength().
+        /// </summary>
+        ///
+        /// <typeparam name="policy"> The iteration policy. </typeparam>
+        ///
+        /// <returns> The iterator. </returns>
+        template <IterationPolicy policy>
+        Iterator<policy> GetIterator() const;
+
+        /// <summary> Sets the element at the given index to 1.0. Calls to this function must have a
+        /// monotonically increasing argument. The value argument must equal 1.0. </summary>
+        ///
+        /// <param name="index"> Zero-based index of the element. </param>
+        /// <param name="value"> The value. </param>
+        virtual void AppendElement(size_t index, double value) override;
+
+        /// <summary>
+        /// A data vector has infinite dimension and ends with a suffix of zeros. This function returns
+        /// the first index in this suffix. Equivalently, the returned value is one plus the index of the
+        /// last non-zero element.
+        /// </summary>
+        ///
+        /// <returns> The first index of the suffix of zeros at the end of this vector. </returns>
+        virtual size_t PrefixLength() const override { return _prefixLength; }
+
+        /// <summary> Computes the vector squared 2-norm. </summary>
+        ///
+        /// <returns> The squared 2-norm of the vector. </returns>
+        virtual double Norm2Squared() const override { return static_cast<double>(_numSetBits); }
+
+        /// <summary> Computes the dot product with a real vector, by peeling the set bits off one
+        /// 64-bit word at a time. </summary>
+        ///
+        /// <param name="vector"> The other vector. </param>
+        ///
+        /// <returns> A dot product. </returns>
+        virtual double Dot(const math::UnorientedConstVectorReference<double> vector) const override;
+
+        /// <summary> Computes the dot product with another binary vector, as word-level AND plus
+        /// popcount. </summary>
+        ///
+        /// <param name="other"> The other binary vector. </param>
+        ///
+        /// <returns> The number of indices set in both vectors. </returns>
+        double Dot(const DenseBinaryDataVector& other) const;
+
+        /// <summary> Adds this data vector to a math::RowVector </summary>
+        ///
+        /// <param name="vector"> [in,out] The vector that this DataVector is added to. </param>
+        virtual void AddTo(math::RowVectorReference<double> vector) const override;
+
+        /// <summary> Gets the data vector type. </summary>
+        ///
+        /// <returns> The data vector type. </returns>
+        virtual IDataVector::Type GetType() const override { return IDataVector::Type::DenseBinaryDataVector; }
+
+    private:
+        using DataVectorBase<DenseBinaryDataVector>::AppendElements;
+
+        std::vector<uint64_t> _words;
+        size_t _prefixLength = 0;
+        size_t _numSetBits = 0;
+    };
+}
+}
+
+#include "../tcc/DenseBinaryDataVector.tcc"
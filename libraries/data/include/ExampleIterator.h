@@ -9,6 +9,7 @@
 #pragma once
 
 // utilities
+#include "HugePageAllocator.h"
 #include "IIterator.h"
 #include "StlContainerIterator.h"
 
@@ -16,9 +17,10 @@ namespace ell
 {
 namespace data
 {
-    /// <summary> An iterator over examples whose Get() function returns a const reference to an example. </summary>
+    /// <summary> An iterator over examples whose Get() function returns a const reference to an example.
+    /// The iterator walks the dataset's (huge-page backed) example array. </summary>
     template <typename ExampleType>
-    using ExampleReferenceIterator = utilities::VectorReferenceIterator<ExampleType>;
+    using ExampleReferenceIterator = utilities::StlContainerReferenceIterator<typename utilities::HugePageVector<ExampleType>::const_iterator>;
 
     /// <summary> Interface for example iterators whose Get() function returns an example (rather than a const reference). </summary>
     ///
@@ -61,6 +63,46 @@ namespace data
     };
 
     using AutoSupervisedExampleIterator = ExampleIterator<AutoSupervisedExample>;
+
+    /// <summary> An example iterator that walks a range of a dataset while skipping a contiguous
+    /// excluded sub-range. This is the mechanism behind zero-copy cross-validation folds: the
+    /// training view of fold k is an iterator over the parent dataset that skips the held-out
+    /// fold, so no examples are copied. </summary>
+    ///
+    /// <typeparam name="ExampleType"> Example type. </typeparam>
+    template <typename ExampleType>
+    class FoldExampleIterator : public IExampleIterator<ExampleType>
+    {
+    public:
+        /// <summary> Constructs an instance of FoldExampleIterator. </summary>
+        ///
+        /// <param name="iterator"> The iterator over the enclosing range. </param>
+        /// <param name="fromIndex"> The absolute index, in the parent dataset, of the enclosing range's first example. </param>
+        /// <param name="excludeFromIndex"> The absolute index of the first excluded example. </param>
+        /// <param name="excludeSize"> The number of excluded examples. </param>
+        FoldExampleIterator(ExampleIterator<ExampleType> iterator, size_t fromIndex, size_t excludeFromIndex, size_t excludeSize);
+
+        /// <summary> Returns true if the iterator is currently pointing to a valid iterate. </summary>
+        ///
+        /// <returns> true if the iterator is currently pointing to a valid iterate. </returns>
+        virtual bool IsValid() const override { return _iterator.IsValid(); }
+
+        /// <summary> Proceeds to the Next iterate, skipping over the excluded range. </summary>
+        virtual void Next() override;
+
+        /// <summary> Returns the current example. </summary>
+        ///
+        /// <returns> An example. </returns>
+        virtual ExampleType Get() const override { return _iterator.Get(); }
+
+    private:
+        void SkipExcluded();
+
+        ExampleIterator<ExampleType> _iterator;
+        size_t _index;
+        size_t _excludeFromIndex;
+        size_t _excludeEnd;
+    };
 }
 }
 
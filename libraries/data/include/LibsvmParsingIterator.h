@@ -0,0 +1,54 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     LibsvmParsingIterator.h (data)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "IndexValue.h"
+#include "TextLine.h"
+
+namespace ell
+{
+namespace data
+{
+    /// <summary>
+    /// A parsing index-value iterator for the libsvm sparse format: whitespace-separated
+    /// `index:value` entries with one-based, strictly increasing indices. Indices are shifted
+    /// down by one, so entry `1:x` lands at index zero.
+    /// </summary>
+    class LibsvmParsingIterator : public IIndexValueIterator
+    {
+    public:
+        /// <summary> Constructs an instance of LibsvmParsingIterator for a given line of text. </summary>
+        ///
+        /// <param name="textLine"> A TextLine object that represents a line of text. </param>
+        LibsvmParsingIterator(TextLine& textLine);
+
+        LibsvmParsingIterator(LibsvmParsingIterator&) = default;
+
+        LibsvmParsingIterator(LibsvmParsingIterator&&) = default;
+
+        /// <summary> Is the iterator pointing to a valid index-value pair? </summary>
+        ///
+        /// <returns> True if valid, false if not. </returns>
+        bool IsValid() const { return _isValid; }
+
+        /// <summary> Proceeds to the Next iterate. </summary>
+        void Next();
+
+        /// <summary> Returns The current index-value pair. </summary>
+        ///
+        /// <returns> An IndexValue object. </returns>
+        IndexValue Get() const { return _currentIndexValue; }
+
+    private:
+        void ReadEntry(size_t nextIndex);
+        bool _isValid = true;
+        TextLine& _textLine;
+        IndexValue _currentIndexValue;
+    };
+}
+}
@@ -0,0 +1,180 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     PackedDataset.h (data)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Dataset.h"
+#include "Example.h"
+#include "ExampleIterator.h"
+#include "WeightLabel.h"
+
+// utilities
+#include "HugePageAllocator.h"
+
+// stl
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace ell
+{
+namespace data
+{
+    /// <summary> A dataset for the homogeneous dense case, where every example has a value for
+    /// every feature. All of the feature values live in one contiguous row-major array, and each
+    /// example is a small (offset, weight, label) record into it, so there is no per-example data
+    /// vector object and no shared_ptr control block. Example order can be permuted by moving the
+    /// records, without touching the values. </summary>
+    ///
+    /// <typeparam name="ElementType"> The feature value storage type. </typeparam>
+    template <typename ElementType>
+    class PackedDataset : public DatasetBase
+    {
+    public:
+        /// <summary> Iterator class, exposing the packed rows as supervised examples. </summary>
+        template <typename IteratorExampleType>
+        class PackedExampleIterator : public IExampleIterator<IteratorExampleType>
+        {
+        public:
+            /// <summary> Returns true if the iterator is currently pointing to a valid iterate. </summary>
+            ///
+            /// <returns> true if it succeeds, false if it fails. </returns>
+            virtual bool IsValid() const override { return _current < _end; }
+
+            /// <summary> Proceeds to the Next iterate. </summary>
+            virtual void Next() override { ++_current; }
+
+            /// <summary> Gets the current example pointed to by the iterator. </summary>
+            ///
+            /// <returns> The example. </returns>
+            virtual IteratorExampleType Get() const override;
+
+            PackedExampleIterator(const PackedDataset<ElementType>* pDataset, size_t begin, size_t end);
+
+        private:
+            const PackedDataset<ElementType>* _pDataset;
+            size_t _current;
+            size_t _end;
+        };
+
+        PackedDataset() = default;
+
+        PackedDataset(PackedDataset&&) = default;
+
+        PackedDataset(const PackedDataset&) = delete;
+
+        /// <summary> Constructs an instance of PackedDataset by densifying the examples of an iterator. </summary>
+        ///
+        /// <param name="exampleIterator"> The example iterator. </param>
+        template <typename ExampleType>
+        explicit PackedDataset(ExampleIterator<ExampleType> exampleIterator);
+
+        PackedDataset<ElementType>& operator=(PackedDataset&&) = default;
+
+        PackedDataset<ElementType>& operator=(const PackedDataset&) = delete;
+
+        /// <summary> Returns the number of examples in the data set. </summary>
+        ///
+        /// <returns> The number of examples. </returns>
+        size_t NumExamples() const { return _records.size(); }
+
+        /// <summary> Returns the number of features, which is also the length of each row. </summary>
+        ///
+        /// <returns> The number of features. </returns>
+        size_t NumFeatures() const { return _numFeatures; }
+
+        /// <summary> Returns a pointer to the contiguous feature values of one example. </summary>
+        ///
+        /// <param name="index"> Zero-based index of the example. </param>
+        ///
+        /// <returns> Pointer to NumFeatures() values, valid until the next AddExample call. </returns>
+        const ElementType* GetRow(size_t index) const { return _values.data() + _records[index].offset; }
+
+        /// <summary> Returns a reference to the metadata of one example. </summary>
+        ///
+        /// <param name="index"> Zero-based index of the example. </param>
+        ///
+        /// <returns> Reference to the example's metadata. </returns>
+        WeightLabel& GetMetadata(size_t index) { return _records[index].metadata; }
+
+        /// <summary> Returns a const reference to the metadata of one example. </summary>
+        ///
+        /// <param name="index"> Zero-based index of the example. </param>
+        ///
+        /// <returns> Const reference to the example's metadata. </returns>
+        const WeightLabel& GetMetadata(size_t index) const { return _records[index].metadata; }
+
+        /// <summary> Returns an iterator that traverses the examples. </summary>
+        ///
+        /// <param name="fromIndex"> Zero-based index of the first example to iterate over. </param>
+        /// <param name="size"> The number of examples to iterate over, a value of zero means all
+        /// the way to the end. </param>
+        ///
+        /// <returns> The iterator. </returns>
+        template <typename IteratorExampleType = DenseSupervisedExample>
+        ExampleIterator<IteratorExampleType> GetExampleIterator(size_t fromIndex = 0, size_t size = 0) const;
+
+        /// <summary> Returns an AnyDataset that represents an interval of examples from this dataset.
+        /// Only the default (float) element type is registered with AnyDataset. </summary>
+        ///
+        /// <param name="fromIndex"> Zero-based index of the first example in the AnyDataset. </param>
+        /// <param name="size"> The number of examples to include, a value of zero means all
+        /// the way to the end. </param>
+        ///
+        /// <returns> The AnyDataset. </returns>
+        AnyDataset GetAnyDataset(size_t fromIndex = 0, size_t size = 0) const { return AnyDataset(this, fromIndex, CorrectRangeSize(fromIndex, size)); }
+
+        /// <summary> Adds an example at the bottom of the dataset. Values beyond the current number
+        /// of features grow all of the rows; values missing from the end of the row are treated as
+        /// zeros. </summary>
+        ///
+        /// <param name="values"> The example's feature values. </param>
+        /// <param name="metadata"> The example's weight and label. </param>
+        void AddExample(const std::vector<double>& values, WeightLabel metadata);
+
+        /// <summary> Erases all of the examples in the dataset. </summary>
+        void Reset();
+
+        /// <summary> Permutes the example records so that a prefix of them is uniformly distributed.
+        /// Only the (offset, weight, label) records move; the values stay in place. </summary>
+        ///
+        /// <param name="rng"> [in,out] The random number generator. </param>
+        /// <param name="prefixSize"> Size of the prefix that should be uniformly distributed, zero to
+        /// permute the entire data set. </param>
+        void RandomPermute(std::default_random_engine& rng, size_t prefixSize = 0);
+
+    private:
+        struct ExampleRecord
+        {
+            size_t offset; // index of the example's first value in the values array
+            WeightLabel metadata;
+        };
+
+        size_t CorrectRangeSize(size_t fromIndex, size_t size) const;
+        void GrowNumFeatures(size_t numFeatures);
+
+        utilities::HugePageVector<ElementType> _values; // all feature values, row-major, NumFeatures() per example; huge-page backed once it grows large
+        utilities::HugePageVector<ExampleRecord> _records;
+        size_t _numFeatures = 0;
+    };
+
+    // friendly name for the variant registered with AnyDataset
+    typedef PackedDataset<float> DensePackedDataset;
+
+    /// <summary> Helper function that creates a PackedDataset from an example iterator. </summary>
+    ///
+    /// <typeparam name="ExampleType"> The example type. </typeparam>
+    /// <param name="exampleIterator"> The example iterator. </param>
+    ///
+    /// <returns> A PackedDataset. </returns>
+    template <typename ExampleType>
+    DensePackedDataset MakePackedDataset(ExampleIterator<ExampleType> exampleIterator);
+}
+}
+
+#include "../tcc/PackedDataset.tcc"
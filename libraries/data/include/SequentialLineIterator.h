@@ -19,7 +19,12 @@ namespace ell
 {
 namespace data
 {
-    /// <summary> An iterator that reads a long text line by line. </summary>
+    class LineBlockPrefetcher;
+
+    /// <summary> An iterator that reads a long text line by line. The stream is read in large
+    /// blocks and each line is handed out as a zero-copy window into the shared block. Optionally,
+    /// blocks are read ahead on a background thread through a bounded queue, so parsing and I/O
+    /// overlap and read stalls (e.g. on network file systems) don't serialize with the consumer. </summary>
     class SequentialLineIterator
     {
     public:
@@ -27,12 +32,17 @@ namespace data
         ///
         /// <param name="stream"> The input stream. </param>
         /// <param name="delim"> The delimiter. </param>
-        SequentialLineIterator(std::istream& stream, char delim = '\n');
+        /// <param name="prefetchBlocks"> Number of megabyte-sized blocks to keep in flight on a
+        /// background reader thread, or zero to read synchronously. While the iterator is alive, the
+        /// reader thread owns the stream, so the caller must not read from it concurrently. </param>
+        SequentialLineIterator(std::istream& stream, char delim = '\n', size_t prefetchBlocks = 0);
 
-        SequentialLineIterator(SequentialLineIterator&&) = default;
+        SequentialLineIterator(SequentialLineIterator&&);
 
         SequentialLineIterator(const SequentialLineIterator&) = delete; // this ctor is deleted because a private member of this class cannot be copied
 
+        ~SequentialLineIterator();
+
         /// <summary> Returns true if the iterator is currently pointing to a valid iterate. </summary>
         ///
         /// <returns> true if it succeeds, false if it fails. </returns>
@@ -44,13 +54,19 @@ namespace data
         /// <summary> Returns a TextLine that contains the current line. </summary>
         ///
         /// <returns> A TextLine </returns>
-        TextLine GetTextLine() const { return _currentLine; } 
+        TextLine GetTextLine() const { return _currentLine; }
 
     private:
+        std::shared_ptr<std::string> AcquireNextBlock(std::string& leftover); // returns nullptr at end of stream
+
         std::istream& _stream;
         bool _isValid = true;
         TextLine _currentLine;
         char _delim;
+
+        std::shared_ptr<std::string> _block; // the current block, shared with the TextLines handed out
+        size_t _position = 0; // start of the first unconsumed line in the block
+        std::unique_ptr<LineBlockPrefetcher> _prefetcher; // null when reading synchronously
     };
 }
 }
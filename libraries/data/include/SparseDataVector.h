@@ -14,6 +14,7 @@
 
 // utilities
 #include "CompressedIntegerList.h"
+#include "IntegerList.h"
 
 // stl
 #include <cstddef>
@@ -181,6 +182,24 @@ namespace data
         /// <param name="value"> The element value. </param>
         virtual void AppendElement(size_t index, double value) override;
 
+        /// <summary> Adds this data vector to a math::RowVector. When the index list supports
+        /// block decoding, the additions run as a blocked scatter/accumulate kernel over whole
+        /// decoded blocks instead of stepping the iterator one element at a time. </summary>
+        ///
+        /// <param name="vector"> [in,out] The vector to which this data vector is added. </param>
+        virtual void AddTo(math::RowVectorReference<double> vector) const override;
+
+        /// <summary> Adds a transformed version of this data vector to a math::RowVector, using
+        /// the blocked kernel for the skipZeros policy when the index list supports block
+        /// decoding. </summary>
+        ///
+        /// <typeparam name="policy"> The iteration policy. </typeparam>
+        /// <typeparam name="TransformationType"> The transformation type. </typeparam>
+        /// <param name="vector"> [in,out] The vector to which the transformed data vector is added. </param>
+        /// <param name="transformation"> The transformation. </param>
+        template <IterationPolicy policy, typename TransformationType>
+        void AddTransformedTo(math::RowVectorReference<double> vector, TransformationType transformation) const;
+
         /// <summary>
         /// A data vector has infinite dimension and ends with a suffix of zeros. This function returns
         /// the first index in this suffix. Equivalently, the returned value is one plus the index of the
@@ -192,6 +211,18 @@ namespace data
 
     private:
         using DataVectorBase<SparseDataVector<ElementType, IndexListType>>::AppendElements;
+
+        // tag-dispatched implementations: true_type runs the blocked kernel over decoded index
+        // blocks, false_type falls back to the element-at-a-time base class loop
+        void AddToImpl(math::RowVectorReference<double> vector, std::true_type hasBlockDecoding) const;
+        void AddToImpl(math::RowVectorReference<double> vector, std::false_type hasBlockDecoding) const;
+
+        template <IterationPolicy policy, typename TransformationType>
+        void AddTransformedToImpl(math::RowVectorReference<double> vector, TransformationType transformation, std::true_type useBlockedKernel) const;
+
+        template <IterationPolicy policy, typename TransformationType>
+        void AddTransformedToImpl(math::RowVectorReference<double> vector, TransformationType transformation, std::false_type useBlockedKernel) const;
+
         IndexListType _indexList;
         std::vector<ElementType> _values;
     };
@@ -239,6 +270,32 @@ namespace data
         /// <returns> The data vector type. </returns>
         virtual IDataVector::Type GetType() const override { return IDataVector::Type::SparseByteDataVector; }
     };
+
+    /// <summary> A sparse data vector with double elements, whose indices are stored uncompressed. Iterating
+    /// over its nonzeros is a plain pointer walk, which trades memory for speed when the indices don't
+    /// compress well. </summary>
+    struct UncompressedSparseDoubleDataVector : public SparseDataVector<double, utilities::IntegerList>
+    {
+        using SparseDataVector<double, utilities::IntegerList>::SparseDataVector;
+
+        /// <summary> Gets the data vector type. </summary>
+        ///
+        /// <returns> The data vector type. </returns>
+        virtual IDataVector::Type GetType() const override { return IDataVector::Type::UncompressedSparseDoubleDataVector; }
+    };
+
+    /// <summary> A sparse data vector with float elements, whose indices are stored uncompressed. Iterating
+    /// over its nonzeros is a plain pointer walk, which trades memory for speed when the indices don't
+    /// compress well. </summary>
+    struct UncompressedSparseFloatDataVector : public SparseDataVector<float, utilities::IntegerList>
+    {
+        using SparseDataVector<float, utilities::IntegerList>::SparseDataVector;
+
+        /// <summary> Gets the data vector type. </summary>
+        ///
+        /// <returns> The data vector type. </returns>
+        virtual IDataVector::Type GetType() const override { return IDataVector::Type::UncompressedSparseFloatDataVector; }
+    };
 }
 }
 
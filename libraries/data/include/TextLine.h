@@ -28,9 +28,18 @@ namespace data
         /// <param name="string"> The string. </param>
         TextLine(std::string string);
 
-        /// <summary> Gets a const reference to the underlying string. </summary>
+        /// <summary> Constructs an instance of TextLine as a zero-copy window into a shared buffer.
+        /// The line starts at the given offset and must be terminated by a null character inside the
+        /// buffer. </summary>
         ///
-        /// <returns> The underlying string. </returns>
+        /// <param name="buffer"> The shared buffer that holds the line (and possibly other lines). </param>
+        /// <param name="offset"> The offset of the first character of the line. </param>
+        TextLine(std::shared_ptr<const std::string> buffer, size_t offset);
+
+        /// <summary> Gets a const reference to the underlying storage. For zero-copy lines, this is
+        /// the shared buffer that contains the line, not the line itself. </summary>
+        ///
+        /// <returns> The underlying storage. </returns>
         const std::string& GetString() const { return *_string; }
 
         /// <summary> Query if this TextLine contains a valid string. </summary>
@@ -82,10 +91,11 @@ namespace data
         /// <summary> Gets the total number of characters in the line. </summary>
         ///
         /// <returns> The text line size. </returns>
-        size_t Size() const { return _string->length(); }
+        size_t Size() const;
 
     private:
-        std::shared_ptr<const std::string> _string = nullptr; 
+        std::shared_ptr<const std::string> _string = nullptr;
+        const char* _lineStart = nullptr;
         const char* _currentChar = nullptr;
     };
 }
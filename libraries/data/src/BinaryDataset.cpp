@@ -0,0 +1,110 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     BinaryDataset.cpp (data)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "BinaryDataset.h"
+
+// utilities
+#include "Exception.h"
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace ell
+{
+namespace data
+{
+#ifdef _WIN32
+    MemoryMappedFile::MemoryMappedFile(const std::string& filename)
+    {
+        HANDLE fileHandle = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (fileHandle == INVALID_HANDLE_VALUE)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "error opening file " + filename);
+        }
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart == 0)
+        {
+            CloseHandle(fileHandle);
+            throw utilities::InputException(utilities::InputExceptionErrors::badData, "error mapping file " + filename);
+        }
+
+        HANDLE mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mappingHandle == nullptr)
+        {
+            CloseHandle(fileHandle);
+            throw utilities::InputException(utilities::InputExceptionErrors::badData, "error mapping file " + filename);
+        }
+
+        auto data = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+        if (data == nullptr)
+        {
+            CloseHandle(mappingHandle);
+            CloseHandle(fileHandle);
+            throw utilities::InputException(utilities::InputExceptionErrors::badData, "error mapping file " + filename);
+        }
+
+        _data = static_cast<const char*>(data);
+        _size = static_cast<size_t>(fileSize.QuadPart);
+        _fileHandle = fileHandle;
+        _mappingHandle = mappingHandle;
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        if (_data != nullptr)
+        {
+            UnmapViewOfFile(_data);
+            CloseHandle(_mappingHandle);
+            CloseHandle(_fileHandle);
+        }
+    }
+#else
+    MemoryMappedFile::MemoryMappedFile(const std::string& filename)
+    {
+        int fileDescriptor = open(filename.c_str(), O_RDONLY);
+        if (fileDescriptor < 0)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "error opening file " + filename);
+        }
+
+        struct stat fileInfo;
+        if (fstat(fileDescriptor, &fileInfo) != 0 || fileInfo.st_size == 0)
+        {
+            close(fileDescriptor);
+            throw utilities::InputException(utilities::InputExceptionErrors::badData, "error mapping file " + filename);
+        }
+
+        auto data = mmap(nullptr, static_cast<size_t>(fileInfo.st_size), PROT_READ, MAP_SHARED, fileDescriptor, 0);
+        close(fileDescriptor); // the mapping keeps its own reference to the file
+        if (data == MAP_FAILED)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::badData, "error mapping file " + filename);
+        }
+
+        _data = static_cast<const char*>(data);
+        _size = static_cast<size_t>(fileInfo.st_size);
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        if (_data != nullptr)
+        {
+            munmap(const_cast<char*>(_data), _size);
+        }
+    }
+#endif
+}
+}
@@ -0,0 +1,71 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     CsvParsingIterator.cpp (data)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "CsvParsingIterator.h"
+
+namespace ell
+{
+namespace data
+{
+    CsvParsingIterator::CsvParsingIterator(TextLine& textLine) : _textLine(textLine)
+    {
+        _textLine.TrimLeadingWhitespace();
+
+        // skip the delimiter that terminated the preceding field (e.g. the label)
+        if (_textLine.Peek() == ',')
+        {
+            _textLine.AdvancePosition();
+            _textLine.TrimLeadingWhitespace();
+        }
+
+        if (_textLine.IsEndOfContent())
+        {
+            _isValid = false;
+        }
+        else
+        {
+            ReadEntry(0);
+        }
+    }
+
+    void CsvParsingIterator::Next()
+    {
+        if (_textLine.IsEndOfContent())
+        {
+            _isValid = false;
+        }
+        else
+        {
+            ReadEntry(_currentIndexValue.index + 1);
+        }
+    }
+
+    void CsvParsingIterator::ReadEntry(size_t nextIndex)
+    {
+        _currentIndexValue.index = nextIndex;
+
+        // an empty field (consecutive commas) parses as zero
+        if (_textLine.Peek() == ',')
+        {
+            _currentIndexValue.value = 0;
+        }
+        else
+        {
+            _textLine.ParseAdvance(_currentIndexValue.value);
+        }
+
+        // advance past the delimiter of the field just read
+        _textLine.TrimLeadingWhitespace();
+        if (_textLine.Peek() == ',')
+        {
+            _textLine.AdvancePosition();
+            _textLine.TrimLeadingWhitespace();
+        }
+    }
+}
+}
@@ -8,6 +8,11 @@
 
 #include "Dataset.h"
 
+// stl
+#include <algorithm>
+#include <numeric>
+#include <string>
+
 namespace ell
 {
 namespace data
@@ -16,5 +21,125 @@ namespace data
         : _pDataset(pDataset), _fromIndex(fromIndex), _size(size)
     {
     }
+
+    AnyDataset::AnyDataset(const DatasetBase* pDataset, size_t fromIndex, size_t size, size_t excludeFromIndex, size_t excludeSize)
+        : _pDataset(pDataset), _fromIndex(fromIndex), _size(size), _excludeFromIndex(excludeFromIndex), _excludeSize(excludeSize)
+    {
+    }
+
+    size_t AnyDataset::NumExamples() const
+    {
+        if (_excludeSize == 0)
+        {
+            return _size;
+        }
+
+        auto overlapBegin = std::max(_excludeFromIndex, _fromIndex);
+        auto overlapEnd = std::min(_excludeFromIndex + _excludeSize, _fromIndex + _size);
+        auto overlap = overlapEnd > overlapBegin ? overlapEnd - overlapBegin : 0;
+        return _size - overlap;
+    }
+
+    namespace
+    {
+        std::string GetRepresentationName(IDataVector::Type type)
+        {
+            switch (type)
+            {
+            case IDataVector::Type::DoubleDataVector:
+                return "DoubleDataVector";
+            case IDataVector::Type::FloatDataVector:
+                return "FloatDataVector";
+            case IDataVector::Type::ShortDataVector:
+                return "ShortDataVector";
+            case IDataVector::Type::ByteDataVector:
+                return "ByteDataVector";
+            case IDataVector::Type::SparseDoubleDataVector:
+                return "SparseDoubleDataVector";
+            case IDataVector::Type::SparseFloatDataVector:
+                return "SparseFloatDataVector";
+            case IDataVector::Type::SparseShortDataVector:
+                return "SparseShortDataVector";
+            case IDataVector::Type::SparseByteDataVector:
+                return "SparseByteDataVector";
+            case IDataVector::Type::UncompressedSparseDoubleDataVector:
+                return "UncompressedSparseDoubleDataVector";
+            case IDataVector::Type::UncompressedSparseFloatDataVector:
+                return "UncompressedSparseFloatDataVector";
+            case IDataVector::Type::SparseBinaryDataVector:
+                return "SparseBinaryDataVector";
+            case IDataVector::Type::DenseBinaryDataVector:
+                return "DenseBinaryDataVector";
+            case IDataVector::Type::AutoDataVector:
+                return "AutoDataVector";
+            default:
+                return "unknown";
+            }
+        }
+    }
+
+    double DatasetDensityStatistics::GetColumnDensity(size_t columnIndex) const
+    {
+        if (_numExamples == 0)
+        {
+            return 0.0;
+        }
+        return static_cast<double>(_columnNonZeroCounts[columnIndex]) / _numExamples;
+    }
+
+    double DatasetDensityStatistics::GetOverallDensity() const
+    {
+        if (_numExamples == 0 || _columnNonZeroCounts.empty())
+        {
+            return 0.0;
+        }
+        auto numNonZeros = std::accumulate(_columnNonZeroCounts.cbegin(), _columnNonZeroCounts.cend(), size_t{ 0 });
+        return static_cast<double>(numNonZeros) / (_numExamples * _columnNonZeroCounts.size());
+    }
+
+    void DatasetDensityStatistics::Print(std::ostream& os) const
+    {
+        os << "examples: " << NumExamples() << ", columns: " << NumColumns() << ", overall density: " << GetOverallDensity() << "\n";
+
+        os << "representation mix:";
+        for (size_t type = 0; type < _representationCounts.size(); ++type)
+        {
+            if (_representationCounts[type] > 0)
+            {
+                os << " " << GetRepresentationName(static_cast<IDataVector::Type>(type)) << ": " << _representationCounts[type];
+            }
+        }
+        os << "\n";
+
+        os << "column densities:";
+        for (size_t columnIndex = 0; columnIndex < NumColumns(); ++columnIndex)
+        {
+            os << " " << GetColumnDensity(columnIndex);
+        }
+        os << "\n";
+    }
+
+    void DatasetDensityStatistics::AddExample(const std::vector<double>& values, IDataVector::Type representation)
+    {
+        if (_columnNonZeroCounts.size() < values.size())
+        {
+            _columnNonZeroCounts.resize(values.size(), 0);
+        }
+        for (size_t columnIndex = 0; columnIndex < values.size(); ++columnIndex)
+        {
+            if (values[columnIndex] != 0)
+            {
+                ++_columnNonZeroCounts[columnIndex];
+            }
+        }
+
+        RecordRepresentation(representation);
+        ++_numExamples;
+    }
+
+    void DatasetDensityStatistics::ClearRepresentationCounts()
+    {
+        std::fill(_representationCounts.begin(), _representationCounts.end(), size_t{ 0 });
+    }
 }
 }
\ No newline at end of file
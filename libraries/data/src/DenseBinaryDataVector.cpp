@@ -0,0 +1,198 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     DenseBinaryDataVector.cpp (data)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// include DataVector.h first so that its tcc, which refers to all the concrete data vector types,
+// sees this file's class declared before the switch in InvokeWithThis is parsed
+#include "DataVector.h"
+
+#include "DenseBinaryDataVector.h"
+
+// stl
+#include <algorithm>
+#include <cassert>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace ell
+{
+namespace data
+{
+    namespace
+    {
+        const size_t bitsPerWord = 64;
+
+        size_t CountTrailingZeros(uint64_t word)
+        {
+#if defined(_MSC_VER)
+            unsigned long index;
+            _BitScanForward64(&index, word);
+            return index;
+#else
+            return __builtin_ctzll(word);
+#endif
+        }
+
+        size_t PopCount(uint64_t word)
+        {
+#if defined(_MSC_VER)
+            return __popcnt64(word);
+#else
+            return __builtin_popcountll(word);
+#endif
+        }
+    }
+
+    //
+    // DenseBinaryDataVectorIterator
+    //
+
+    DenseBinaryDataVectorIterator<IterationPolicy::all>::DenseBinaryDataVectorIterator(const uint64_t* words, size_t numWords, size_t size)
+        : _words(words), _numWords(numWords), _size(size)
+    {
+    }
+
+    IndexValue DenseBinaryDataVectorIterator<IterationPolicy::all>::Get() const
+    {
+        size_t wordIndex = _index / bitsPerWord;
+        if (wordIndex >= _numWords)
+        {
+            return IndexValue{ _index, 0.0 };
+        }
+        uint64_t bit = (_words[wordIndex] >> (_index % bitsPerWord)) & 1;
+        return IndexValue{ _index, bit != 0 ? 1.0 : 0.0 };
+    }
+
+    DenseBinaryDataVectorIterator<IterationPolicy::skipZeros>::DenseBinaryDataVectorIterator(const uint64_t* words, size_t numWords, size_t size)
+        : _words(words), _numWords(numWords), _size(size)
+    {
+        _currentWord = numWords > 0 ? words[0] : 0;
+        AdvanceToNextSetBit();
+    }
+
+    void DenseBinaryDataVectorIterator<IterationPolicy::skipZeros>::Next()
+    {
+        // clear the lowest set bit of the current word and find the next one
+        _currentWord &= _currentWord - 1;
+        AdvanceToNextSetBit();
+    }
+
+    void DenseBinaryDataVectorIterator<IterationPolicy::skipZeros>::AdvanceToNextSetBit()
+    {
+        while (_currentWord == 0)
+        {
+            ++_wordIndex;
+            if (_wordIndex >= _numWords)
+            {
+                _index = _size;
+                return;
+            }
+            _currentWord = _words[_wordIndex];
+        }
+        _index = _wordIndex * bitsPerWord + CountTrailingZeros(_currentWord);
+    }
+
+    //
+    // DenseBinaryDataVector
+    //
+
+    DenseBinaryDataVector::DenseBinaryDataVector(std::initializer_list<IndexValue> list)
+    {
+        AppendElements(std::move(list));
+    }
+
+    DenseBinaryDataVector::DenseBinaryDataVector(std::initializer_list<double> list)
+    {
+        AppendElements(std::move(list));
+    }
+
+    DenseBinaryDataVector::DenseBinaryDataVector(std::vector<IndexValue> vec)
+    {
+        AppendElements(std::move(vec));
+    }
+
+    DenseBinaryDataVector::DenseBinaryDataVector(std::vector<double> vec)
+    {
+        AppendElements(std::move(vec));
+    }
+
+    void DenseBinaryDataVector::AppendElement(size_t index, double value)
+    {
+        if (value == 0)
+        {
+            return;
+        }
+
+        assert(value == 1);
+        assert(index >= _prefixLength);
+
+        size_t wordIndex = index / bitsPerWord;
+        if (wordIndex >= _words.size())
+        {
+            _words.resize(wordIndex + 1, 0);
+        }
+        _words[wordIndex] |= static_cast<uint64_t>(1) << (index % bitsPerWord);
+        _prefixLength = index + 1;
+        ++_numSetBits;
+    }
+
+    double DenseBinaryDataVector::Dot(const math::UnorientedConstVectorReference<double> vector) const
+    {
+        double result = 0.0;
+        size_t size = vector.Size();
+
+        for (size_t wordIndex = 0; wordIndex < _words.size(); ++wordIndex)
+        {
+            uint64_t word = _words[wordIndex];
+            while (word != 0)
+            {
+                size_t index = wordIndex * bitsPerWord + CountTrailingZeros(word);
+                if (index >= size)
+                {
+                    return result;
+                }
+                result += vector[index];
+                word &= word - 1;
+            }
+        }
+        return result;
+    }
+
+    double DenseBinaryDataVector::Dot(const DenseBinaryDataVector& other) const
+    {
+        size_t numCommonWords = std::min(_words.size(), other._words.size());
+        size_t count = 0;
+        for (size_t wordIndex = 0; wordIndex < numCommonWords; ++wordIndex)
+        {
+            count += PopCount(_words[wordIndex] & other._words[wordIndex]);
+        }
+        return static_cast<double>(count);
+    }
+
+    void DenseBinaryDataVector::AddTo(math::RowVectorReference<double> vector) const
+    {
+        size_t size = vector.Size();
+
+        for (size_t wordIndex = 0; wordIndex < _words.size(); ++wordIndex)
+        {
+            uint64_t word = _words[wordIndex];
+            while (word != 0)
+            {
+                size_t index = wordIndex * bitsPerWord + CountTrailingZeros(word);
+                if (index >= size)
+                {
+                    return;
+                }
+                vector[index] += 1.0;
+                word &= word - 1;
+            }
+        }
+    }
+}
+}
@@ -0,0 +1,73 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     LibsvmParsingIterator.cpp (data)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "LibsvmParsingIterator.h"
+
+// utilities
+#include "Exception.h"
+
+namespace ell
+{
+namespace data
+{
+    LibsvmParsingIterator::LibsvmParsingIterator(TextLine& textLine) : _textLine(textLine)
+    {
+        _textLine.TrimLeadingWhitespace();
+        if (_textLine.IsEndOfContent())
+        {
+            _isValid = false;
+        }
+        else
+        {
+            ReadEntry(0);
+            _textLine.TrimLeadingWhitespace();
+        }
+    }
+
+    void LibsvmParsingIterator::Next()
+    {
+        if (_textLine.IsEndOfContent())
+        {
+            _isValid = false;
+        }
+        else
+        {
+            ReadEntry(_currentIndexValue.index + 1);
+            _textLine.TrimLeadingWhitespace();
+        }
+    }
+
+    void LibsvmParsingIterator::ReadEntry(size_t nextIndex)
+    {
+        // read the one-based index
+        size_t oneBasedIndex;
+        auto stepSize = _textLine.TryParse(oneBasedIndex);
+        if (stepSize == 0)
+        {
+            throw utilities::DataFormatException(utilities::DataFormatErrors::badFormat, "expected a libsvm index");
+        }
+        if (_textLine.Peek(stepSize) != ':')
+        {
+            throw utilities::DataFormatException(utilities::DataFormatErrors::badFormat, "expected ':' after a libsvm index");
+        }
+        _textLine.AdvancePosition(stepSize + 1);
+
+        if (oneBasedIndex == 0)
+        {
+            throw utilities::DataFormatException(utilities::DataFormatErrors::illegalValue, "libsvm indices are one-based");
+        }
+        if (oneBasedIndex - 1 < nextIndex)
+        {
+            throw utilities::DataFormatException(utilities::DataFormatErrors::illegalValue, "libsvm indices must be strictly increasing");
+        }
+        _currentIndexValue.index = oneBasedIndex - 1;
+
+        _textLine.ParseAdvance(_currentIndexValue.value);
+    }
+}
+}
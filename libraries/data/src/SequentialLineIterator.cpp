@@ -11,28 +11,190 @@
 // utilities
 #include "Files.h"
 
+// stl
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <queue>
+#include <thread>
+
 namespace ell
 {
 namespace data
 {
-    SequentialLineIterator::SequentialLineIterator(std::istream& stream, char delim)
+    namespace
+    {
+        const size_t blockSize = 64 * 1024;
+        const size_t prefetchBlockSize = 1024 * 1024;
+    }
+
+    /// <summary> Reads megabyte-sized blocks of a stream ahead of the consumer on a background
+    /// thread, handing them over through a bounded queue. The large sequential reads also give the
+    /// operating system's readahead a clear access pattern to work with. </summary>
+    class LineBlockPrefetcher
+    {
+    public:
+        LineBlockPrefetcher(std::istream& stream, size_t maxQueuedBlocks)
+            : _maxQueuedBlocks(std::max<size_t>(1, maxQueuedBlocks)), _readerThread([this, &stream] { ReadBlocks(stream); })
+        {
+        }
+
+        ~LineBlockPrefetcher()
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _cancel = true;
+            }
+            _spaceAvailable.notify_all();
+            _readerThread.join();
+        }
+
+        // returns the next block in stream order, blocking until one is ready, or nullptr at end of stream
+        std::shared_ptr<std::string> NextBlock()
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _blockAvailable.wait(lock, [this] { return !_queue.empty() || _endOfStream; });
+            if (_queue.empty())
+            {
+                return nullptr;
+            }
+            auto block = std::move(_queue.front());
+            _queue.pop();
+            _spaceAvailable.notify_all();
+            return block;
+        }
+
+    private:
+        void ReadBlocks(std::istream& stream)
+        {
+            while (stream)
+            {
+                auto block = std::make_shared<std::string>();
+                block->resize(prefetchBlockSize);
+                stream.read(&(*block)[0], static_cast<std::streamsize>(prefetchBlockSize));
+                block->resize(static_cast<size_t>(stream.gcount()));
+                if (block->empty())
+                {
+                    break;
+                }
+
+                std::unique_lock<std::mutex> lock(_mutex);
+                _spaceAvailable.wait(lock, [this] { return _queue.size() < _maxQueuedBlocks || _cancel; });
+                if (_cancel)
+                {
+                    return;
+                }
+                _queue.push(std::move(block));
+                _blockAvailable.notify_all();
+            }
+
+            std::lock_guard<std::mutex> lock(_mutex);
+            _endOfStream = true;
+            _blockAvailable.notify_all();
+        }
+
+        size_t _maxQueuedBlocks;
+        std::queue<std::shared_ptr<std::string>> _queue;
+        std::mutex _mutex;
+        std::condition_variable _blockAvailable;
+        std::condition_variable _spaceAvailable;
+        bool _endOfStream = false;
+        bool _cancel = false;
+        std::thread _readerThread; // initialized last, so the thread only sees fully constructed state
+    };
+
+    SequentialLineIterator::SequentialLineIterator(std::istream& stream, char delim, size_t prefetchBlocks)
         : _stream(stream), _delim(delim)
     {
+        if (prefetchBlocks > 0)
+        {
+            _prefetcher = std::make_unique<LineBlockPrefetcher>(stream, prefetchBlocks);
+        }
         Next();
     }
 
+    SequentialLineIterator::SequentialLineIterator(SequentialLineIterator&&) = default;
+
+    SequentialLineIterator::~SequentialLineIterator() = default;
+
     void SequentialLineIterator::Next()
     {
-        std::string nextLine;
-        std::getline(_stream, nextLine, _delim);
+        for (;;)
+        {
+            if (_block != nullptr && _position < _block->size())
+            {
+                auto data = _block->data();
+                auto delimiter = static_cast<const char*>(std::memchr(data + _position, _delim, _block->size() - _position));
+                if (delimiter != nullptr)
+                {
+                    // replace the delimiter with a null terminator in place, so the line can be
+                    // handed out as a zero-copy window into the block; this only touches the part
+                    // of the block that hasn't been handed out yet
+                    auto delimiterPosition = static_cast<size_t>(delimiter - data);
+                    (*_block)[delimiterPosition] = '\0';
+                    _currentLine = TextLine(_block, _position);
+                    _position = delimiterPosition + 1;
+                    return;
+                }
+            }
+
+            // no complete line left in the current block: carry the partial tail over into the
+            // front of a fresh block and continue with the next chunk of the stream
+            std::string leftover;
+            if (_block != nullptr && _position < _block->size())
+            {
+                leftover = _block->substr(_position);
+            }
+            _block = nullptr;
+            _position = 0;
+
+            auto block = AcquireNextBlock(leftover);
+            if (block == nullptr)
+            {
+                if (leftover.empty())
+                {
+                    _isValid = false;
+                }
+                else
+                {
+                    // final line with no trailing delimiter; std::string guarantees a null terminator
+                    _currentLine = TextLine(std::make_shared<const std::string>(std::move(leftover)), 0);
+                }
+                return;
+            }
+            _block = std::move(block);
+        }
+    }
 
-        if (_stream.fail())
+    std::shared_ptr<std::string> SequentialLineIterator::AcquireNextBlock(std::string& leftover)
+    {
+        if (_prefetcher != nullptr)
         {
-            _isValid = false;
-            return;
+            auto prefetched = _prefetcher->NextBlock();
+            if (prefetched == nullptr)
+            {
+                return nullptr;
+            }
+            if (leftover.empty())
+            {
+                return prefetched; // hand the prefetched buffer out directly
+            }
+            auto block = std::make_shared<std::string>(std::move(leftover));
+            block->append(*prefetched);
+            return block;
         }
 
-        _currentLine = TextLine(std::move(nextLine));
+        if (!_stream)
+        {
+            return nullptr;
+        }
+        auto block = std::make_shared<std::string>(std::move(leftover));
+        auto prefixSize = block->size();
+        block->resize(prefixSize + blockSize);
+        _stream.read(&(*block)[prefixSize], static_cast<std::streamsize>(blockSize));
+        block->resize(prefixSize + static_cast<size_t>(_stream.gcount()));
+        return block;
     }
 }
 }
@@ -11,17 +11,24 @@
 // utilities
 #include "CStringParser.h"
 
+// stl
+#include <cstring>
+
 namespace ell
 {
 namespace data
 {
-    TextLine::TextLine(std::string string) : _string(std::make_shared<const std::string>(std::move(string))), _currentChar(_string->c_str())
+    TextLine::TextLine(std::string string) : _string(std::make_shared<const std::string>(std::move(string))), _lineStart(_string->c_str()), _currentChar(_lineStart)
+    {
+    }
+
+    TextLine::TextLine(std::shared_ptr<const std::string> buffer, size_t offset) : _string(std::move(buffer)), _lineStart(_string->c_str() + offset), _currentChar(_lineStart)
     {
     }
 
-    char TextLine::Peek(size_t increment) const 
-    { 
-        return *(_currentChar + increment); 
+    char TextLine::Peek(size_t increment) const
+    {
+        return *(_currentChar + increment);
     }
 
     bool TextLine::IsEndOfContent() const
@@ -38,7 +45,7 @@ namespace data
 
     size_t TextLine::GetCurrentPosition() const
     {
-        return static_cast<size_t>(_currentChar - _string->c_str());
+        return static_cast<size_t>(_currentChar - _lineStart);
     }
 
     void TextLine::AdvancePosition(size_t increment)
@@ -46,5 +53,9 @@ namespace data
         _currentChar += increment;
     }
 
+    size_t TextLine::Size() const
+    {
+        return std::strlen(_lineStart);
+    }
+}
 }
-}
\ No newline at end of file
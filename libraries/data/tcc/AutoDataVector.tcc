@@ -9,6 +9,7 @@
 #define APPROXIMATION_TOLERANCE 1.0e-9
 #define SPARSE_THRESHOLD 0.2
 
+#include "DenseBinaryDataVector.h"
 #include "DenseDataVector.h"
 #include "SparseBinaryDataVector.h"
 #include "SparseDataVector.h"
@@ -59,6 +60,13 @@ namespace data
         FindBestRepresentation(std::move(defaultDataVector));
     }
 
+    template <typename DefaultDataVectorType>
+    AutoDataVectorBase<DefaultDataVectorType>::AutoDataVectorBase(std::vector<double> vec, RepresentationPreference preference)
+    {
+        DefaultDataVectorType defaultDataVector(std::move(vec));
+        FindBestRepresentation(std::move(defaultDataVector), preference);
+    }
+
     template <typename DefaultDataVectorType>
     void AutoDataVectorBase<DefaultDataVectorType>::AppendElement(size_t index, double value)
     {
@@ -118,9 +126,11 @@ namespace data
     }
 
     template <typename DefaultDataVectorType>
-    void AutoDataVectorBase<DefaultDataVectorType>::FindBestRepresentation(DefaultDataVectorType defaultDataVector)
+    void AutoDataVectorBase<DefaultDataVectorType>::FindBestRepresentation(DefaultDataVectorType defaultDataVector, RepresentationPreference preference)
     {
         size_t numNonZeros = 0;
+        size_t compressedIndexBytes = 0;
+        size_t previousIndex = 0;
         bool includesNonFloats = false;
         bool includesNonShorts = false;
         bool includesNonBytes = false;
@@ -129,8 +139,15 @@ namespace data
         auto iter = GetIterator<DefaultDataVectorType, IterationPolicy::skipZeros>(defaultDataVector);
         while (iter.IsValid())
         {
+            size_t index = iter.Get().index;
             double value = iter.Get().value;
 
+            // estimate the size of the variable-length encoding that CompressedIntegerList uses to
+            // store the index increments (2-bit length prefix followed by the increment itself)
+            size_t indexDelta = index - previousIndex;
+            compressedIndexBytes += indexDelta < (1 << 6) ? 1 : indexDelta < (1 << 14) ? 2 : indexDelta < (static_cast<size_t>(1) << 30) ? 4 : 8;
+            previousIndex = index;
+
             ++numNonZeros;
             includesNonFloats |= DoesCastModifyValue<float>(value);
             includesNonShorts |= DoesCastModifyValue<short>(value);
@@ -140,8 +157,14 @@ namespace data
             iter.Next();
         }
 
+        // compressed indices have to be decoded on every iteration, so they only pay off when they
+        // shrink the index storage by more than half
+        bool indicesCompressWell = 2 * compressedIndexBytes < numNonZeros * sizeof(size_t);
+
         // dense
-        if (numNonZeros > SPARSE_THRESHOLD * defaultDataVector.PrefixLength())
+        bool dense = preference == RepresentationPreference::dense ||
+                     (preference == RepresentationPreference::automatic && numNonZeros > SPARSE_THRESHOLD * defaultDataVector.PrefixLength());
+        if (dense)
         {
             if (includesNonFloats)
             {
@@ -155,10 +178,14 @@ namespace data
             {
                 SetInternal<ShortDataVector>(std::move(defaultDataVector));
             }
-            else
+            else if (includesNonBinary)
             {
                 SetInternal<ByteDataVector>(std::move(defaultDataVector));
             }
+            else
+            {
+                SetInternal<DenseBinaryDataVector>(std::move(defaultDataVector));
+            }
         }
 
         // sparse
@@ -166,11 +193,25 @@ namespace data
         {
             if (includesNonFloats)
             {
-                SetInternal<SparseDoubleDataVector>(std::move(defaultDataVector));
+                if (indicesCompressWell)
+                {
+                    SetInternal<SparseDoubleDataVector>(std::move(defaultDataVector));
+                }
+                else
+                {
+                    SetInternal<UncompressedSparseDoubleDataVector>(std::move(defaultDataVector));
+                }
             }
             else if (includesNonShorts)
             {
-                SetInternal<SparseFloatDataVector>(std::move(defaultDataVector));
+                if (indicesCompressWell)
+                {
+                    SetInternal<SparseFloatDataVector>(std::move(defaultDataVector));
+                }
+                else
+                {
+                    SetInternal<UncompressedSparseFloatDataVector>(std::move(defaultDataVector));
+                }
             }
             else if (includesNonBytes)
             {
@@ -182,7 +223,17 @@ namespace data
             }
             else
             {
-                SetInternal<SparseBinaryDataVector>(std::move(defaultDataVector));
+                // a bitmap beats a compressed index list once there's about one set bit per
+                // 64-bit word; below that the index list is smaller and faster to scan (when the
+                // sparse family is forced, the index list is used unconditionally)
+                if (preference != RepresentationPreference::sparse && numNonZeros * 64 >= defaultDataVector.PrefixLength())
+                {
+                    SetInternal<DenseBinaryDataVector>(std::move(defaultDataVector));
+                }
+                else
+                {
+                    SetInternal<SparseBinaryDataVector>(std::move(defaultDataVector));
+                }
             }
         }
     }
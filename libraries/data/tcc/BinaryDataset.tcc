@@ -0,0 +1,190 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     BinaryDataset.tcc (data)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// utilities
+#include "Exception.h"
+
+// stl
+#include <cstring>
+#include <fstream>
+
+namespace ell
+{
+namespace data
+{
+    namespace binaryDatasetImpl
+    {
+        // file layout: 8 byte magic, uint64 example count, then one record per example; every
+        // field is 8 bytes wide, so all fields stay naturally aligned within the mapping
+        constexpr char magic[8] = { 'E', 'L', 'L', 'D', 'S', '0', '1', '\0' };
+        constexpr size_t headerSize = sizeof(magic) + sizeof(uint64_t);
+        constexpr size_t indexValuePairSize = sizeof(uint64_t) + sizeof(double);
+
+        template <typename FieldType>
+        void WriteField(std::ofstream& stream, FieldType value)
+        {
+            stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+        }
+
+        template <typename FieldType>
+        FieldType ReadField(const char* data)
+        {
+            FieldType value;
+            std::memcpy(&value, data, sizeof(value));
+            return value;
+        }
+    }
+
+    //
+    // BinaryDatasetWriter
+    //
+
+    inline BinaryDatasetWriter::BinaryDatasetWriter(const std::string& filename)
+        : _stream(filename, std::ios::binary)
+    {
+        if (!_stream.is_open())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "error opening file " + filename);
+        }
+
+        _stream.write(binaryDatasetImpl::magic, sizeof(binaryDatasetImpl::magic));
+        binaryDatasetImpl::WriteField(_stream, static_cast<uint64_t>(0)); // patched by Close()
+    }
+
+    template <typename ExampleType>
+    void BinaryDatasetWriter::WriteExample(const ExampleType& example)
+    {
+        binaryDatasetImpl::WriteField(_stream, example.GetMetadata().weight);
+        binaryDatasetImpl::WriteField(_stream, example.GetMetadata().label);
+
+        // write the nonzero entries as index-value pairs; going through a sparse copy keeps
+        // this generic over all data vector types, including auto data vectors
+        auto sparseVector = example.GetDataVector().template CopyAs<SparseDoubleDataVector>();
+        uint64_t count = 0;
+        auto countingIterator = GetIterator<SparseDoubleDataVector, IterationPolicy::skipZeros>(sparseVector);
+        while (countingIterator.IsValid())
+        {
+            ++count;
+            countingIterator.Next();
+        }
+        binaryDatasetImpl::WriteField(_stream, count);
+
+        auto indexValueIterator = GetIterator<SparseDoubleDataVector, IterationPolicy::skipZeros>(sparseVector);
+        while (indexValueIterator.IsValid())
+        {
+            auto indexValue = indexValueIterator.Get();
+            binaryDatasetImpl::WriteField(_stream, static_cast<uint64_t>(indexValue.index));
+            binaryDatasetImpl::WriteField(_stream, indexValue.value);
+            indexValueIterator.Next();
+        }
+
+        ++_numExamples;
+    }
+
+    inline void BinaryDatasetWriter::Close()
+    {
+        if (!_stream.is_open())
+        {
+            return;
+        }
+
+        _stream.seekp(sizeof(binaryDatasetImpl::magic));
+        binaryDatasetImpl::WriteField(_stream, _numExamples);
+        bool good = static_cast<bool>(_stream);
+        _stream.close();
+        if (!good)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::badData, "error writing binary dataset file");
+        }
+    }
+
+    template <typename ExampleType>
+    void WriteBinaryDataset(const Dataset<ExampleType>& dataset, const std::string& filename)
+    {
+        BinaryDatasetWriter writer(filename);
+        auto exampleIterator = dataset.GetExampleReferenceIterator();
+        while (exampleIterator.IsValid())
+        {
+            writer.WriteExample(exampleIterator.Get());
+            exampleIterator.Next();
+        }
+        writer.Close();
+    }
+
+    //
+    // MappedIndexValueIterator
+    //
+
+    inline void MappedIndexValueIterator::Next()
+    {
+        _current += binaryDatasetImpl::indexValuePairSize;
+        --_remaining;
+    }
+
+    inline IndexValue MappedIndexValueIterator::Get() const
+    {
+        auto index = binaryDatasetImpl::ReadField<uint64_t>(_current);
+        auto value = binaryDatasetImpl::ReadField<double>(_current + sizeof(uint64_t));
+        return IndexValue{ static_cast<size_t>(index), value };
+    }
+
+    //
+    // MappedExampleIterator
+    //
+
+    template <typename ExampleType>
+    MappedExampleIterator<ExampleType>::MappedExampleIterator(std::shared_ptr<const MemoryMappedFile> file, const char* current, size_t numExamples)
+        : _file(std::move(file)), _current(current), _remaining(numExamples)
+    {
+    }
+
+    template <typename ExampleType>
+    void MappedExampleIterator<ExampleType>::Next()
+    {
+        auto count = binaryDatasetImpl::ReadField<uint64_t>(_current + 2 * sizeof(double));
+        _current += 3 * sizeof(uint64_t) + count * binaryDatasetImpl::indexValuePairSize;
+        --_remaining;
+    }
+
+    template <typename ExampleType>
+    ExampleType MappedExampleIterator<ExampleType>::Get() const
+    {
+        using DataVectorType = typename ExampleType::DataVectorType;
+        using MetadataType = typename ExampleType::MetadataType;
+
+        auto weight = binaryDatasetImpl::ReadField<double>(_current);
+        auto label = binaryDatasetImpl::ReadField<double>(_current + sizeof(double));
+        auto count = binaryDatasetImpl::ReadField<uint64_t>(_current + 2 * sizeof(double));
+
+        MappedIndexValueIterator indexValueIterator(_current + 3 * sizeof(uint64_t), static_cast<size_t>(count));
+        return ExampleType(DataVectorType(std::move(indexValueIterator)), MetadataType{ weight, label });
+    }
+
+    //
+    // MemoryMappedDataset
+    //
+
+    template <typename ExampleType>
+    MemoryMappedDataset<ExampleType>::MemoryMappedDataset(const std::string& filename)
+        : _file(std::make_shared<const MemoryMappedFile>(filename))
+    {
+        if (_file->GetSize() < binaryDatasetImpl::headerSize || std::memcmp(_file->GetData(), binaryDatasetImpl::magic, sizeof(binaryDatasetImpl::magic)) != 0)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::badData, "file " + filename + " is not a binary dataset file");
+        }
+        _numExamples = static_cast<size_t>(binaryDatasetImpl::ReadField<uint64_t>(_file->GetData() + sizeof(binaryDatasetImpl::magic)));
+    }
+
+    template <typename ExampleType>
+    ExampleIterator<ExampleType> MemoryMappedDataset<ExampleType>::GetExampleIterator() const
+    {
+        auto iterator = std::make_unique<MappedExampleIterator<ExampleType>>(_file, _file->GetData() + binaryDatasetImpl::headerSize, _numExamples);
+        return ExampleIterator<ExampleType>(std::move(iterator));
+    }
+}
+}
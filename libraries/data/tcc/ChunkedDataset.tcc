@@ -0,0 +1,117 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ChunkedDataset.tcc (data)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// utilities
+#include "Exception.h"
+
+// stl
+#include <algorithm>
+
+namespace ell
+{
+namespace data
+{
+    template <typename DatasetExampleType>
+    template <typename IteratorExampleType>
+    ChunkedDataset<DatasetExampleType>::SnapshotExampleIterator<IteratorExampleType>::SnapshotExampleIterator(std::vector<const BlockType*> blocks, size_t fromIndex, size_t size)
+        : _blocks(std::move(blocks)), _current(fromIndex), _end(fromIndex + size)
+    {
+    }
+
+    template <typename DatasetExampleType>
+    template <typename IteratorExampleType>
+    IteratorExampleType ChunkedDataset<DatasetExampleType>::SnapshotExampleIterator<IteratorExampleType>::Get() const
+    {
+        const auto& example = (*_blocks[_current / blockSize])[_current % blockSize];
+        return example.template CopyAs<IteratorExampleType>();
+    }
+
+    template <typename DatasetExampleType>
+    ChunkedDataset<DatasetExampleType>::ChunkedDataset(ExampleIterator<DatasetExampleType> exampleIterator)
+    {
+        while (exampleIterator.IsValid())
+        {
+            AddExample(exampleIterator.Get());
+            exampleIterator.Next();
+        }
+    }
+
+    template <typename DatasetExampleType>
+    const DatasetExampleType& ChunkedDataset<DatasetExampleType>::GetExample(size_t index) const
+    {
+        if (index >= NumExamples())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::indexOutOfRange);
+        }
+
+        const BlockType* block;
+        {
+            std::lock_guard<std::mutex> lock(_blocksMutex);
+            block = _blocks[index / blockSize].get();
+        }
+        // blocks are never relocated, so the reference stays valid after the lock is released
+        return (*block)[index % blockSize];
+    }
+
+    template <typename DatasetExampleType>
+    void ChunkedDataset<DatasetExampleType>::AddExample(DatasetExampleType example)
+    {
+        size_t numFeatures = example.GetDataVector().PrefixLength();
+        size_t size = _size.load(std::memory_order_relaxed);
+
+        if (size % blockSize == 0)
+        {
+            // start a new block; reserving its full capacity up front means its examples are
+            // never relocated by later appends
+            auto block = std::make_unique<BlockType>();
+            block->reserve(blockSize);
+            std::lock_guard<std::mutex> lock(_blocksMutex);
+            _currentBlock = block.get();
+            _blocks.push_back(std::move(block));
+        }
+
+        _currentBlock->push_back(std::move(example));
+
+        if (_numFeatures < numFeatures)
+        {
+            _numFeatures = numFeatures;
+        }
+
+        // publish the example: a snapshot taken after this store sees it fully constructed
+        _size.store(size + 1, std::memory_order_release);
+    }
+
+    template <typename DatasetExampleType>
+    template <typename IteratorExampleType>
+    ExampleIterator<IteratorExampleType> ChunkedDataset<DatasetExampleType>::GetExampleIterator(size_t fromIndex, size_t size) const
+    {
+        size_t snapshotSize = NumExamples();
+        fromIndex = std::min(fromIndex, snapshotSize);
+        if (size == 0 || size > snapshotSize - fromIndex)
+        {
+            size = snapshotSize - fromIndex;
+        }
+
+        // copy the block pointers under the lock - the blocks themselves are never relocated, so
+        // the snapshot stays valid while the writer keeps appending
+        std::vector<const BlockType*> blocks;
+        {
+            std::lock_guard<std::mutex> lock(_blocksMutex);
+            size_t numBlocks = (fromIndex + size + blockSize - 1) / blockSize;
+            blocks.reserve(numBlocks);
+            for (size_t i = 0; i < numBlocks; ++i)
+            {
+                blocks.push_back(_blocks[i].get());
+            }
+        }
+
+        using IteratorType = SnapshotExampleIterator<IteratorExampleType>;
+        return ExampleIterator<IteratorExampleType>(std::make_unique<IteratorType>(std::move(blocks), fromIndex, size));
+    }
+}
+}
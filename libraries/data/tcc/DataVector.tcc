@@ -6,6 +6,7 @@
 //
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include "DenseBinaryDataVector.h"
 #include "DenseDataVector.h"
 #include "SparseBinaryDataVector.h"
 #include "SparseDataVector.h"
@@ -45,9 +46,18 @@ namespace data
             case Type::SparseByteDataVector:
                 return lambda(static_cast<const SparseByteDataVector*>(this));
 
+            case Type::UncompressedSparseDoubleDataVector:
+                return lambda(static_cast<const UncompressedSparseDoubleDataVector*>(this));
+
+            case Type::UncompressedSparseFloatDataVector:
+                return lambda(static_cast<const UncompressedSparseFloatDataVector*>(this));
+
             case Type::SparseBinaryDataVector:
                 return lambda(static_cast<const SparseBinaryDataVector*>(this));
 
+            case Type::DenseBinaryDataVector:
+                return lambda(static_cast<const DenseBinaryDataVector*>(this));
+
             default:
                 throw utilities::LogicException(utilities::LogicExceptionErrors::illegalState, "attempted to cast unsupported data vector type");
         }
@@ -12,6 +12,7 @@
 // stl
 #include <algorithm>
 #include <cassert>
+#include <numeric>
 #include <random>
 #include <stdexcept>
 
@@ -29,9 +30,16 @@ namespace data
         // all Dataset types for which GetAnyDataset() is called must be listed below, in the variadic template argument.
         using Invoker = utilities::AbstractInvoker<DatasetBase,
             Dataset<data::AutoSupervisedExample>,
-            Dataset<data::DenseSupervisedExample>>;
+            Dataset<data::DenseSupervisedExample>,
+            PackedDataset<float>,
+            ChunkedDataset<data::AutoSupervisedExample>>;
 
-        return Invoker::Invoke<ExampleIterator<ExampleType>>(getExampleIterator, _pDataset);
+        auto iterator = Invoker::Invoke<ExampleIterator<ExampleType>>(getExampleIterator, _pDataset);
+        if (_excludeSize == 0)
+        {
+            return iterator;
+        }
+        return ExampleIterator<ExampleType>(std::make_unique<FoldExampleIterator<ExampleType>>(std::move(iterator), _fromIndex, _excludeFromIndex, _excludeSize));
     }
 
     template <typename DatasetExampleType>
@@ -61,7 +69,9 @@ namespace data
     void Dataset<DatasetExampleType>::Swap(Dataset& other)
     {
         std::swap(_examples, other._examples);
+        std::swap(_viewOrder, other._viewOrder);
         std::swap(_numFeatures, other._numFeatures);
+        std::swap(_densityStatistics, other._densityStatistics);
     }
 
     template <typename DatasetExampleType>
@@ -103,10 +113,61 @@ namespace data
         return ExampleReferenceIterator<DatasetExampleType>(_examples.cbegin() + fromIndex, _examples.cbegin() + fromIndex + size);
     }
 
+    template <typename DatasetExampleType>
+    AnyDataset Dataset<DatasetExampleType>::GetTrainingFoldDataset(size_t foldIndex, size_t numFolds) const
+    {
+        if (numFolds == 0 || foldIndex >= numFolds)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "foldIndex must be smaller than numFolds");
+        }
+
+        auto foldBegin = foldIndex * NumExamples() / numFolds;
+        auto foldEnd = (foldIndex + 1) * NumExamples() / numFolds;
+        return AnyDataset(this, 0, NumExamples(), foldBegin, foldEnd - foldBegin);
+    }
+
+    template <typename DatasetExampleType>
+    AnyDataset Dataset<DatasetExampleType>::GetEvaluationFoldDataset(size_t foldIndex, size_t numFolds) const
+    {
+        if (numFolds == 0 || foldIndex >= numFolds)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "foldIndex must be smaller than numFolds");
+        }
+
+        auto foldBegin = foldIndex * NumExamples() / numFolds;
+        auto foldEnd = (foldIndex + 1) * NumExamples() / numFolds;
+        return AnyDataset(this, foldBegin, foldEnd - foldBegin);
+    }
+
+    template <typename DatasetExampleType>
+    auto Dataset<DatasetExampleType>::ToColumnMajor(size_t fromIndex, size_t size) const -> ColumnMajorDataset<typename DatasetExampleType::MetadataType>
+    {
+        size = CorrectRangeSize(fromIndex, size);
+
+        ColumnMajorDataset<typename DatasetExampleType::MetadataType> columnMajorDataset;
+        columnMajorDataset._columns.resize(_numFeatures, std::vector<double>(size));
+        columnMajorDataset._metadata.reserve(size);
+
+        for (size_t i = 0; i < size; ++i)
+        {
+            const auto& example = _examples[fromIndex + i];
+            auto values = example.GetDataVector().ToArray(_numFeatures);
+            for (size_t j = 0; j < _numFeatures; ++j)
+            {
+                columnMajorDataset._columns[j][i] = values[j];
+            }
+            columnMajorDataset._metadata.push_back(example.GetMetadata());
+        }
+
+        return columnMajorDataset;
+    }
+
     template <typename DatasetExampleType>
     void Dataset<DatasetExampleType>::AddExample(DatasetExampleType example)
     {
         size_t numFeatures = example.GetDataVector().PrefixLength();
+        utilities::RecordAllocation(sizeof(DatasetExampleType) + numFeatures * sizeof(double)); // approximate: the example record plus its data vector
+        _densityStatistics.AddExample(example.GetDataVector().ToArray(), GetStoredRepresentation(example.GetDataVector()));
         _examples.push_back(std::move(example));
 
         if (_numFeatures < numFeatures)
@@ -120,6 +181,24 @@ namespace data
     {
         _examples.clear();
         _numFeatures = 0;
+        _densityStatistics = DatasetDensityStatistics();
+    }
+
+    template <typename DatasetExampleType>
+    void Dataset<DatasetExampleType>::Repack()
+    {
+        // wholesale decision for the entire dataset, using the same density threshold that the
+        // auto data vectors apply per vector
+        auto preference = _densityStatistics.GetOverallDensity() > SPARSE_THRESHOLD ? RepresentationPreference::dense : RepresentationPreference::sparse;
+
+        _densityStatistics.ClearRepresentationCounts();
+        for (size_t index = 0; index < _examples.size(); ++index)
+        {
+            auto& example = _examples[index];
+            auto pRepacked = std::make_shared<typename DatasetExampleType::DataVectorType>(example.GetDataVector().ToArray(), preference);
+            _densityStatistics.RecordRepresentation(GetStoredRepresentation(*pRepacked));
+            _examples[index] = DatasetExampleType(pRepacked, example.GetMetadata());
+        }
     }
 
     template <typename DatasetExampleType>
@@ -164,6 +243,52 @@ namespace data
         swap(_examples[targetExampleIndex], _examples[j]);
     }
 
+    template <typename DatasetExampleType>
+    void Dataset<DatasetExampleType>::RandomPermuteView(std::default_random_engine& rng, size_t blockSize)
+    {
+        auto numExamples = NumExamples();
+        if (blockSize <= 1)
+        {
+            if (_viewOrder.size() != numExamples)
+            {
+                _viewOrder.resize(numExamples);
+                std::iota(_viewOrder.begin(), _viewOrder.end(), size_t{ 0 });
+            }
+            std::shuffle(_viewOrder.begin(), _viewOrder.end(), rng);
+            return;
+        }
+
+        // block mode: rebuild the view from the physical order each time, so the preserved runs are
+        // runs of physically-adjacent examples and keep their locality
+        auto numBlocks = (numExamples + blockSize - 1) / blockSize;
+        std::vector<size_t> blockOrder(numBlocks);
+        std::iota(blockOrder.begin(), blockOrder.end(), size_t{ 0 });
+        std::shuffle(blockOrder.begin(), blockOrder.end(), rng);
+
+        _viewOrder.clear();
+        _viewOrder.reserve(numExamples);
+        for (auto block : blockOrder)
+        {
+            auto blockEnd = std::min((block + 1) * blockSize, numExamples);
+            for (size_t index = block * blockSize; index < blockEnd; ++index)
+            {
+                _viewOrder.push_back(index);
+            }
+        }
+    }
+
+    template <typename DatasetExampleType>
+    DatasetExampleType& Dataset<DatasetExampleType>::GetViewExample(size_t index)
+    {
+        return _viewOrder.empty() ? _examples[index] : _examples[_viewOrder[index]];
+    }
+
+    template <typename DatasetExampleType>
+    const DatasetExampleType& Dataset<DatasetExampleType>::GetViewExample(size_t index) const
+    {
+        return _viewOrder.empty() ? _examples[index] : _examples[_viewOrder[index]];
+    }
+
     template <typename DatasetExampleType>
     template <typename SortKeyType>
     void Dataset<DatasetExampleType>::Sort(SortKeyType sortKey, size_t fromIndex, size_t size)
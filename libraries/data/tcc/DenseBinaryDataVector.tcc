@@ -0,0 +1,31 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     DenseBinaryDataVector.tcc (data)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ell
+{
+namespace data
+{
+    template <typename IndexValueIteratorType, IsIndexValueIterator<IndexValueIteratorType> Concept>
+    DenseBinaryDataVector::DenseBinaryDataVector(IndexValueIteratorType indexValueIterator)
+    {
+        AppendElements(std::move(indexValueIterator));
+    }
+
+    template <IterationPolicy policy>
+    auto DenseBinaryDataVector::GetIterator(size_t size) const -> Iterator<policy>
+    {
+        return Iterator<policy>(_words.data(), _words.size(), size);
+    }
+
+    template <IterationPolicy policy>
+    auto DenseBinaryDataVector::GetIterator() const -> Iterator<policy>
+    {
+        return GetIterator<policy>(PrefixLength());
+    }
+}
+}
@@ -15,5 +15,30 @@ namespace data
         : _iterator(std::move(iterator))
     {
     }
+
+    template <typename ExampleType>
+    FoldExampleIterator<ExampleType>::FoldExampleIterator(ExampleIterator<ExampleType> iterator, size_t fromIndex, size_t excludeFromIndex, size_t excludeSize)
+        : _iterator(std::move(iterator)), _index(fromIndex), _excludeFromIndex(excludeFromIndex), _excludeEnd(excludeFromIndex + excludeSize)
+    {
+        SkipExcluded();
+    }
+
+    template <typename ExampleType>
+    void FoldExampleIterator<ExampleType>::Next()
+    {
+        _iterator.Next();
+        ++_index;
+        SkipExcluded();
+    }
+
+    template <typename ExampleType>
+    void FoldExampleIterator<ExampleType>::SkipExcluded()
+    {
+        while (_iterator.IsValid() && _index >= _excludeFromIndex && _index < _excludeEnd)
+        {
+            _iterator.Next();
+            ++_index;
+        }
+    }
 }
 }
@@ -0,0 +1,135 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     PackedDataset.tcc (data)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// utilities
+#include "Exception.h"
+
+// stl
+#include <algorithm>
+#include <cassert>
+
+namespace ell
+{
+namespace data
+{
+    template <typename ElementType>
+    template <typename IteratorExampleType>
+    PackedDataset<ElementType>::PackedExampleIterator<IteratorExampleType>::PackedExampleIterator(const PackedDataset<ElementType>* pDataset, size_t begin, size_t end)
+        : _pDataset(pDataset), _current(begin), _end(end)
+    {
+    }
+
+    template <typename ElementType>
+    template <typename IteratorExampleType>
+    IteratorExampleType PackedDataset<ElementType>::PackedExampleIterator<IteratorExampleType>::Get() const
+    {
+        const auto& record = _pDataset->_records[_current];
+        const ElementType* pRow = _pDataset->_values.data() + record.offset;
+        std::vector<double> row(pRow, pRow + _pDataset->_numFeatures);
+
+        using DataVectorType = typename IteratorExampleType::DataVectorType;
+        using MetadataType = typename IteratorExampleType::MetadataType;
+        return IteratorExampleType(DataVectorType(std::move(row)), MetadataType(record.metadata));
+    }
+
+    template <typename ElementType>
+    template <typename ExampleType>
+    PackedDataset<ElementType>::PackedDataset(ExampleIterator<ExampleType> exampleIterator)
+    {
+        while (exampleIterator.IsValid())
+        {
+            auto example = exampleIterator.Get();
+            AddExample(example.GetDataVector().ToArray(), WeightLabel(example.GetMetadata()));
+            exampleIterator.Next();
+        }
+    }
+
+    template <typename ElementType>
+    template <typename IteratorExampleType>
+    ExampleIterator<IteratorExampleType> PackedDataset<ElementType>::GetExampleIterator(size_t fromIndex, size_t size) const
+    {
+        size = CorrectRangeSize(fromIndex, size);
+        return ExampleIterator<IteratorExampleType>(std::make_unique<PackedExampleIterator<IteratorExampleType>>(this, fromIndex, fromIndex + size));
+    }
+
+    template <typename ElementType>
+    void PackedDataset<ElementType>::AddExample(const std::vector<double>& values, WeightLabel metadata)
+    {
+        if (values.size() > _numFeatures)
+        {
+            GrowNumFeatures(values.size());
+        }
+
+        size_t offset = _values.size();
+        _values.resize(offset + _numFeatures, 0);
+        std::transform(values.cbegin(), values.cend(), _values.begin() + offset, [](double value) { return static_cast<ElementType>(value); });
+        _records.push_back({ offset, metadata });
+    }
+
+    template <typename ElementType>
+    void PackedDataset<ElementType>::Reset()
+    {
+        _values.clear();
+        _records.clear();
+        _numFeatures = 0;
+    }
+
+    template <typename ElementType>
+    void PackedDataset<ElementType>::RandomPermute(std::default_random_engine& rng, size_t prefixSize)
+    {
+        size_t numExamples = NumExamples();
+        if (prefixSize > numExamples || prefixSize == 0)
+        {
+            prefixSize = numExamples;
+        }
+
+        for (size_t i = 0; i < prefixSize; ++i)
+        {
+            std::uniform_int_distribution<size_t> dist(i, numExamples - 1);
+            size_t j = dist(rng);
+            std::swap(_records[i], _records[j]);
+        }
+    }
+
+    template <typename ElementType>
+    size_t PackedDataset<ElementType>::CorrectRangeSize(size_t fromIndex, size_t size) const
+    {
+        if (size == 0 || fromIndex + size > NumExamples())
+        {
+            return NumExamples() - fromIndex;
+        }
+        return size;
+    }
+
+    template <typename ElementType>
+    void PackedDataset<ElementType>::GrowNumFeatures(size_t numFeatures)
+    {
+        assert(numFeatures > _numFeatures);
+        if (!_records.empty())
+        {
+            // rewrite the values array with the wider row stride; this is rare when loading a
+            // uniformly dense file, where the first example already has the full width
+            utilities::HugePageVector<ElementType> newValues(_records.size() * numFeatures, 0);
+            for (size_t i = 0; i < _records.size(); ++i)
+            {
+                size_t newOffset = i * numFeatures;
+                std::copy(_values.cbegin() + _records[i].offset, _values.cbegin() + _records[i].offset + _numFeatures, newValues.begin() + newOffset);
+                _records[i].offset = newOffset;
+            }
+            _values = std::move(newValues);
+        }
+        _numFeatures = numFeatures;
+    }
+
+    template <typename ExampleType>
+    DensePackedDataset MakePackedDataset(ExampleIterator<ExampleType> exampleIterator)
+    {
+        return DensePackedDataset(std::move(exampleIterator));
+    }
+}
+}
@@ -136,6 +136,91 @@ namespace data
         _values.push_back(storedValue);
     }
 
+    template <typename ElementType, typename IndexListType>
+    void SparseDataVector<ElementType, IndexListType>::AddTo(math::RowVectorReference<double> vector) const
+    {
+        AddToImpl(vector, std::is_same<IndexListType, utilities::CompressedIntegerList>{});
+    }
+
+    template <typename ElementType, typename IndexListType>
+    void SparseDataVector<ElementType, IndexListType>::AddToImpl(math::RowVectorReference<double> vector, std::true_type) const
+    {
+        AddTransformedToImpl<IterationPolicy::skipZeros>(vector, [](IndexValue x) { return x.value; }, std::true_type{});
+    }
+
+    template <typename ElementType, typename IndexListType>
+    void SparseDataVector<ElementType, IndexListType>::AddToImpl(math::RowVectorReference<double> vector, std::false_type) const
+    {
+        DataVectorBase<SparseDataVector<ElementType, IndexListType>>::AddTo(vector);
+    }
+
+    template <typename ElementType, typename IndexListType>
+    template <IterationPolicy policy, typename TransformationType>
+    void SparseDataVector<ElementType, IndexListType>::AddTransformedTo(math::RowVectorReference<double> vector, TransformationType transformation) const
+    {
+        AddTransformedToImpl<policy>(vector, std::move(transformation), std::integral_constant<bool, policy == IterationPolicy::skipZeros && std::is_same<IndexListType, utilities::CompressedIntegerList>::value>{});
+    }
+
+    template <typename ElementType, typename IndexListType>
+    template <IterationPolicy policy, typename TransformationType>
+    void SparseDataVector<ElementType, IndexListType>::AddTransformedToImpl(math::RowVectorReference<double> vector, TransformationType transformation, std::true_type) const
+    {
+        // blocked scatter/accumulate: consume the decoded index blocks as flat arrays, with an
+        // unrolled accumulate loop that prefetches the target cache lines a few elements ahead
+        auto size = vector.Size();
+        auto indexIterator = _indexList.GetIterator();
+        const ElementType* values = _values.data();
+        while (indexIterator.IsValid())
+        {
+            size_t count;
+            const size_t* indices = indexIterator.GetBlock(count);
+
+            if (count > 0 && indices[count - 1] >= size)
+            {
+                // the indices are increasing, so once one falls outside the target we're done
+                for (size_t i = 0; i < count; ++i)
+                {
+                    if (indices[i] >= size)
+                    {
+                        return;
+                    }
+                    vector[indices[i]] += transformation(IndexValue{ indices[i], static_cast<double>(values[i]) });
+                }
+                return;
+            }
+
+            constexpr size_t prefetchDistance = 8;
+            size_t i = 0;
+            for (; i + 4 <= count; i += 4)
+            {
+#if defined(__GNUC__) || defined(__clang__)
+                if (i + prefetchDistance < count)
+                {
+                    __builtin_prefetch(&vector[indices[i + prefetchDistance]], 1);
+                }
+#endif
+                vector[indices[i]] += transformation(IndexValue{ indices[i], static_cast<double>(values[i]) });
+                vector[indices[i + 1]] += transformation(IndexValue{ indices[i + 1], static_cast<double>(values[i + 1]) });
+                vector[indices[i + 2]] += transformation(IndexValue{ indices[i + 2], static_cast<double>(values[i + 2]) });
+                vector[indices[i + 3]] += transformation(IndexValue{ indices[i + 3], static_cast<double>(values[i + 3]) });
+            }
+            for (; i < count; ++i)
+            {
+                vector[indices[i]] += transformation(IndexValue{ indices[i], static_cast<double>(values[i]) });
+            }
+
+            values += count;
+            indexIterator.NextBlock();
+        }
+    }
+
+    template <typename ElementType, typename IndexListType>
+    template <IterationPolicy policy, typename TransformationType>
+    void SparseDataVector<ElementType, IndexListType>::AddTransformedToImpl(math::RowVectorReference<double> vector, TransformationType transformation, std::false_type) const
+    {
+        DataVectorBase<SparseDataVector<ElementType, IndexListType>>::template AddTransformedTo<policy>(vector, std::move(transformation));
+    }
+
     template <typename ElementType, typename IndexListType>
     size_t SparseDataVector<ElementType, IndexListType>::PrefixLength() const
     {
@@ -14,5 +14,6 @@ void IDataVectorTests();
 void DataVectorCopyAsTests();
 void AutoDataVectorTest();
 void TransformedDataVectorTest();
+void SparseDataVectorBlockedAddToTest();
 void IteratorTests();
 }
\ No newline at end of file
@@ -11,4 +11,18 @@
 namespace ell
 {
 void DatasetCastingTests();
+
+void DatasetColumnMajorTest();
+
+void DatasetPermutationViewTest();
+
+void DatasetFoldViewTest();
+
+void DatasetDensityStatisticsTest();
+
+void PackedDatasetTest();
+
+void ChunkedDatasetTest();
+
+void BinaryDatasetTest();
 }
\ No newline at end of file
@@ -10,6 +10,9 @@
 namespace ell
 {
     void DataVectorParseTest();
+    void CsvParseTest();
+    void LibsvmParseTest();
     void AutoDataVectorParseTest();
+    void SequentialLineIteratorTest();
     void SingleFileParseTest();
 }
\ No newline at end of file
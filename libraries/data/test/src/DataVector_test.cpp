@@ -12,6 +12,7 @@
 #include "AutoDataVector.h"
 #include "DataVector.h"
 #include "DataVectorOperations.h"
+#include "DenseBinaryDataVector.h"
 #include "DenseDataVector.h"
 #include "SparseBinaryDataVector.h"
 #include "SparseDataVector.h"
@@ -96,6 +97,8 @@ void IDataVectorTests()
     IDataVectorTest<data::SparseFloatDataVector>();
     IDataVectorTest<data::SparseShortDataVector>();
     IDataVectorTest<data::SparseByteDataVector>();
+    IDataVectorTest<data::UncompressedSparseDoubleDataVector>();
+    IDataVectorTest<data::UncompressedSparseFloatDataVector>();
     IDataVectorTest<data::AutoDataVector>();
 
     IDataVectorBinaryTest<data::DoubleDataVector>();
@@ -106,8 +109,16 @@ void IDataVectorTests()
     IDataVectorBinaryTest<data::SparseFloatDataVector>();
     IDataVectorBinaryTest<data::SparseShortDataVector>();
     IDataVectorBinaryTest<data::SparseByteDataVector>();
+    IDataVectorBinaryTest<data::UncompressedSparseDoubleDataVector>();
+    IDataVectorBinaryTest<data::UncompressedSparseFloatDataVector>();
     IDataVectorBinaryTest<data::AutoDataVector>();
     IDataVectorBinaryTest<data::SparseBinaryDataVector>();
+    IDataVectorBinaryTest<data::DenseBinaryDataVector>();
+
+    // word-level dot product of two bitmap vectors
+    data::DenseBinaryDataVector b1{ { 0, 1 }, { 3, 1 }, { 64, 1 }, { 100, 1 } };
+    data::DenseBinaryDataVector b2{ { 3, 1 }, { 64, 1 }, { 101, 1 } };
+    testing::ProcessTest("Testing DenseBinaryDataVector::Dot(DenseBinaryDataVector)", testing::IsEqual(b1.Dot(b2), 2.0));
 }
 
 template <typename DataVectorType1, typename DataVectorType2>
@@ -162,7 +173,10 @@ void DataVectorCopyAsTestDispatch(InitType maxType)
     DataVectorCopyAsTest<DataVectorType, data::SparseFloatDataVector>(fractionalInit);
     DataVectorCopyAsTest<DataVectorType, data::SparseShortDataVector>(integeralInit);
     DataVectorCopyAsTest<DataVectorType, data::SparseByteDataVector>(integeralInit);
+    DataVectorCopyAsTest<DataVectorType, data::UncompressedSparseDoubleDataVector>(fractionalInit);
+    DataVectorCopyAsTest<DataVectorType, data::UncompressedSparseFloatDataVector>(fractionalInit);
     DataVectorCopyAsTest<DataVectorType, data::SparseBinaryDataVector>(binaryInit, false);
+    DataVectorCopyAsTest<DataVectorType, data::DenseBinaryDataVector>(binaryInit, false);
 }
 
 void DataVectorCopyAsTests()
@@ -176,7 +190,10 @@ void DataVectorCopyAsTests()
     DataVectorCopyAsTestDispatch<data::SparseFloatDataVector>(InitType::fractional);
     DataVectorCopyAsTestDispatch<data::SparseShortDataVector>(InitType::integral);
     DataVectorCopyAsTestDispatch<data::SparseByteDataVector>(InitType::integral);
+    DataVectorCopyAsTestDispatch<data::UncompressedSparseDoubleDataVector>(InitType::fractional);
+    DataVectorCopyAsTestDispatch<data::UncompressedSparseFloatDataVector>(InitType::fractional);
     DataVectorCopyAsTestDispatch<data::SparseBinaryDataVector>(InitType::binary);
+    DataVectorCopyAsTestDispatch<data::DenseBinaryDataVector>(InitType::binary);
 }
 
 void AutoDataVectorTest()
@@ -206,7 +223,18 @@ void AutoDataVectorTest()
     testing::ProcessTest("AutoDataVector ctor", v8.GetInternalType() == data::IDataVector::Type::SparseByteDataVector);
 
     data::AutoDataVector v9{ 0, 0, 0, 0, 0, 1, 0, 0, 0 };
-    testing::ProcessTest("AutoDataVector ctor", v9.GetInternalType() == data::IDataVector::Type::SparseBinaryDataVector);
+    testing::ProcessTest("AutoDataVector ctor", v9.GetInternalType() == data::IDataVector::Type::DenseBinaryDataVector);
+
+    // sparse vectors whose index increments are too big to benefit from compression get uncompressed index storage
+    data::AutoDataVector v10(std::vector<data::IndexValue>{ { 20000, 1.2345678901 }, { 40000, 2.3456789012 } });
+    testing::ProcessTest("AutoDataVector ctor", v10.GetInternalType() == data::IDataVector::Type::UncompressedSparseDoubleDataVector);
+
+    data::AutoDataVector v11(std::vector<data::IndexValue>{ { 20000, 1.5 }, { 40000, 2.5 } });
+    testing::ProcessTest("AutoDataVector ctor", v11.GetInternalType() == data::IDataVector::Type::UncompressedSparseFloatDataVector);
+
+    // binary vectors with fewer than one set bit per 64-bit word stay in the index-list representation
+    data::AutoDataVector v12(std::vector<data::IndexValue>{ { 20000, 1 }, { 40000, 1 } });
+    testing::ProcessTest("AutoDataVector ctor", v12.GetInternalType() == data::IDataVector::Type::SparseBinaryDataVector);
 }
 
 void TransformedDataVectorTest()
@@ -259,6 +287,48 @@ void IteratorTest()
     testing::ProcessTest("IteratorTest<" + name + ">", std::equal(b.begin(), b.end(), c.begin()));
 }
 
+void SparseDataVectorBlockedAddToTest()
+{
+    // more nonzeros than one decoded index block holds, so the blocked kernel crosses
+    // block boundaries; compare against a reference accumulation through the iterator
+    const size_t numNonzeros = 300;
+    data::SparseDoubleDataVector u;
+    for (size_t i = 0; i < numNonzeros; ++i)
+    {
+        u.AppendElement(3 * i, static_cast<double>(i % 7) + 0.5);
+    }
+
+    math::RowVector<double> w(3 * numNonzeros);
+    u.AddTo(w);
+
+    math::RowVector<double> r(3 * numNonzeros);
+    auto iterator = data::GetIterator<data::SparseDoubleDataVector, data::IterationPolicy::skipZeros>(u);
+    while (iterator.IsValid())
+    {
+        r[iterator.Get().index] += iterator.Get().value;
+        iterator.Next();
+    }
+    testing::ProcessTest("SparseDataVectorBlockedAddToTest: AddTo", testing::IsEqual(w.ToArray(), r.ToArray()));
+
+    // a target smaller than the prefix length truncates mid-block
+    math::RowVector<double> wShort(200);
+    u.AddTo(wShort);
+    math::RowVector<double> rShort(200);
+    for (size_t i = 0; i < numNonzeros && 3 * i < 200; ++i)
+    {
+        rShort[3 * i] += static_cast<double>(i % 7) + 0.5;
+    }
+    testing::ProcessTest("SparseDataVectorBlockedAddToTest: truncated AddTo", testing::IsEqual(wShort.ToArray(), rShort.ToArray()));
+
+    // the transformed path through operator* uses the same blocked kernel
+    math::RowVector<double> wScaled(3 * numNonzeros);
+    wScaled += 2.0 * u;
+    math::RowVector<double> rScaled(3 * numNonzeros);
+    rScaled += r;
+    rScaled += r;
+    testing::ProcessTest("SparseDataVectorBlockedAddToTest: scaled AddTo", testing::IsEqual(wScaled.ToArray(), rScaled.ToArray()));
+}
+
 void IteratorTests()
 {
     IteratorTest<data::DoubleDataVector>();
@@ -270,5 +340,6 @@ void IteratorTests()
     IteratorTest<data::SparseShortDataVector>();
     IteratorTest<data::SparseByteDataVector>();
     IteratorTest<data::SparseBinaryDataVector>();
+    IteratorTest<data::DenseBinaryDataVector>();
 }
 }
\ No newline at end of file
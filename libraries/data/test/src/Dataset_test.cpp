@@ -7,13 +7,19 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "Dataset_test.h"
+#include "BinaryDataset.h"
+#include "ChunkedDataset.h"
 #include "Dataset.h"
+#include "PackedDataset.h"
 
 // testing
 #include "testing.h"
 
 // stl
+#include <cstdio>
+#include <random>
 #include <sstream>
+#include <vector>
 
 namespace ell
 {
@@ -66,4 +72,299 @@ void DatasetCastingTests()
     DatasetCastingTestDispatch<data::AutoSupervisedExample>();
     DatasetCastingTestDispatch<data::DenseSupervisedExample>();
 }
+
+void DatasetColumnMajorTest()
+{
+    data::Dataset<data::AutoSupervisedExample> dataset;
+    dataset.AddExample(data::AutoSupervisedExample(data::AutoDataVector{ 1, 0, 2 }, data::WeightLabel{ 1, 1 }));
+    dataset.AddExample(data::AutoSupervisedExample(data::AutoDataVector{ 0, 3 }, data::WeightLabel{ 2, -1 }));
+    dataset.AddExample(data::AutoSupervisedExample(data::AutoDataVector{ 4, 5, 6 }, data::WeightLabel{ 3, 1 }));
+
+    auto columnMajorDataset = dataset.ToColumnMajor();
+    testing::ProcessTest("Dataset::ToColumnMajor() NumExamples", columnMajorDataset.NumExamples() == dataset.NumExamples());
+    testing::ProcessTest("Dataset::ToColumnMajor() NumFeatures", columnMajorDataset.NumFeatures() == dataset.NumFeatures());
+    testing::ProcessTest("Dataset::ToColumnMajor() GetColumn", testing::IsEqual(columnMajorDataset.GetColumn(0), std::vector<double>{ 1, 0, 4 }));
+    testing::ProcessTest("Dataset::ToColumnMajor() GetColumn", testing::IsEqual(columnMajorDataset.GetColumn(1), std::vector<double>{ 0, 3, 5 }));
+    testing::ProcessTest("Dataset::ToColumnMajor() GetColumn", testing::IsEqual(columnMajorDataset.GetColumn(2), std::vector<double>{ 2, 0, 6 }));
+    testing::ProcessTest("Dataset::ToColumnMajor() GetMetadata", columnMajorDataset.GetMetadata(1).weight == 2 && columnMajorDataset.GetMetadata(1).label == -1);
+
+    auto columnMajorSuffix = dataset.ToColumnMajor(1);
+    testing::ProcessTest("Dataset::ToColumnMajor(fromIndex) NumExamples", columnMajorSuffix.NumExamples() == 2);
+    testing::ProcessTest("Dataset::ToColumnMajor(fromIndex) GetColumn", testing::IsEqual(columnMajorSuffix.GetColumn(1), std::vector<double>{ 3, 5 }));
+}
+
+void DatasetPermutationViewTest()
+{
+    const size_t numExamples = 200;
+    data::Dataset<data::AutoSupervisedExample> dataset;
+    for (size_t i = 0; i < numExamples; ++i)
+    {
+        dataset.AddExample(data::AutoSupervisedExample(data::AutoDataVector{ static_cast<double>(i) }, data::WeightLabel{ 1, static_cast<double>(i) }));
+    }
+
+    std::default_random_engine rng(123);
+    dataset.RandomPermuteView(rng);
+
+    // the view is a permutation, and the examples themselves haven't moved
+    std::vector<bool> seen(numExamples, false);
+    bool physicalOrderIntact = true;
+    bool viewIsPermutation = true;
+    for (size_t i = 0; i < numExamples; ++i)
+    {
+        auto viewLabel = static_cast<size_t>(dataset.GetViewExample(i).GetMetadata().label);
+        if (viewLabel >= numExamples || seen[viewLabel])
+        {
+            viewIsPermutation = false;
+            break;
+        }
+        seen[viewLabel] = true;
+        physicalOrderIntact &= (static_cast<size_t>(dataset[i].GetMetadata().label) == i);
+    }
+    testing::ProcessTest("Dataset::RandomPermuteView() is a permutation", viewIsPermutation);
+    testing::ProcessTest("Dataset::RandomPermuteView() leaves examples in place", physicalOrderIntact);
+
+    // block mode: runs of blockSize physically-adjacent examples stay contiguous
+    const size_t blockSize = 64;
+    dataset.RandomPermuteView(rng, blockSize);
+    bool blocksContiguous = true;
+    for (size_t i = 1; i < numExamples; ++i)
+    {
+        auto viewLabel = static_cast<size_t>(dataset.GetViewExample(i).GetMetadata().label);
+        auto previousViewLabel = static_cast<size_t>(dataset.GetViewExample(i - 1).GetMetadata().label);
+        if (viewLabel % blockSize != 0 && viewLabel != previousViewLabel + 1)
+        {
+            blocksContiguous = false;
+            break;
+        }
+    }
+    testing::ProcessTest("Dataset::RandomPermuteView() keeps blocks contiguous", blocksContiguous);
+
+    // ResetView restores the physical order
+    dataset.ResetView();
+    bool viewReset = true;
+    for (size_t i = 0; i < numExamples; ++i)
+    {
+        viewReset &= (static_cast<size_t>(dataset.GetViewExample(i).GetMetadata().label) == i);
+    }
+    testing::ProcessTest("Dataset::ResetView()", viewReset);
+}
+
+void DatasetFoldViewTest()
+{
+    const size_t numExamples = 10;
+    const size_t numFolds = 3;
+    data::Dataset<data::AutoSupervisedExample> dataset;
+    for (size_t i = 0; i < numExamples; ++i)
+    {
+        dataset.AddExample(data::AutoSupervisedExample(data::AutoDataVector{ static_cast<double>(i) }, data::WeightLabel{ 1, static_cast<double>(i) }));
+    }
+
+    // every example lands in exactly one evaluation fold, and in the training view of every other fold
+    std::vector<size_t> evaluationCounts(numExamples, 0);
+    std::vector<size_t> trainingCounts(numExamples, 0);
+    bool sizesMatch = true;
+    for (size_t fold = 0; fold < numFolds; ++fold)
+    {
+        auto trainingView = dataset.GetTrainingFoldDataset(fold, numFolds);
+        auto evaluationView = dataset.GetEvaluationFoldDataset(fold, numFolds);
+        testing::ProcessTest("Dataset fold views partition the dataset", trainingView.NumExamples() + evaluationView.NumExamples() == numExamples);
+
+        size_t trainingCount = 0;
+        auto trainingIterator = trainingView.GetExampleIterator<data::AutoSupervisedExample>();
+        while (trainingIterator.IsValid())
+        {
+            ++trainingCounts[static_cast<size_t>(trainingIterator.Get().GetMetadata().label)];
+            ++trainingCount;
+            trainingIterator.Next();
+        }
+        sizesMatch &= (trainingCount == trainingView.NumExamples());
+
+        auto evaluationIterator = evaluationView.GetExampleIterator<data::AutoSupervisedExample>();
+        while (evaluationIterator.IsValid())
+        {
+            ++evaluationCounts[static_cast<size_t>(evaluationIterator.Get().GetMetadata().label)];
+            evaluationIterator.Next();
+        }
+    }
+    testing::ProcessTest("Dataset::GetTrainingFoldDataset() NumExamples matches the iterator", sizesMatch);
+
+    bool coverageCorrect = true;
+    for (size_t i = 0; i < numExamples; ++i)
+    {
+        coverageCorrect &= (evaluationCounts[i] == 1 && trainingCounts[i] == numFolds - 1);
+    }
+    testing::ProcessTest("Dataset fold views cover each example once per fold", coverageCorrect);
+
+    // the views are zero-copy: a trainer-style copy built from the training view sees the
+    // surviving examples in their original order
+    auto trainingView = dataset.GetTrainingFoldDataset(1, numFolds);
+    data::Dataset<data::AutoSupervisedExample> trainingCopy(trainingView);
+    testing::ProcessTest("Dataset::GetTrainingFoldDataset() skips the held-out fold",
+        trainingCopy.NumExamples() == 7 && trainingCopy[2].GetMetadata().label == 2 && trainingCopy[3].GetMetadata().label == 6);
+}
+
+void DatasetDensityStatisticsTest()
+{
+    // short dense-binary examples in a wide dataset: each vector's own density heuristic picks a
+    // dense representation, but the dataset as a whole is sparse
+    data::Dataset<data::AutoSupervisedExample> dataset;
+    for (size_t i = 0; i < 4; ++i)
+    {
+        dataset.AddExample(data::AutoSupervisedExample(data::AutoDataVector{ 1, 1 }, data::WeightLabel{ 1, 1 }));
+    }
+    dataset.AddExample(data::AutoSupervisedExample(data::AutoDataVector(std::vector<data::IndexValue>{ { 99, 1.0 } }), data::WeightLabel{ 1, -1 }));
+
+    const auto& statistics = dataset.GetDensityStatistics();
+    testing::ProcessTest("DatasetDensityStatistics::NumExamples()", statistics.NumExamples() == 5);
+    testing::ProcessTest("DatasetDensityStatistics::NumColumns()", statistics.NumColumns() == 100);
+    testing::ProcessTest("DatasetDensityStatistics::GetColumnDensity()", statistics.GetColumnDensity(0) == 0.8 && statistics.GetColumnDensity(99) == 0.2 && statistics.GetColumnDensity(50) == 0);
+    testing::ProcessTest("DatasetDensityStatistics::GetOverallDensity()", testing::IsEqual(statistics.GetOverallDensity(), 9.0 / 500.0));
+    testing::ProcessTest("DatasetDensityStatistics::GetRepresentationCount()",
+        statistics.GetRepresentationCount(data::IDataVector::Type::DenseBinaryDataVector) == 4 && statistics.GetRepresentationCount(data::IDataVector::Type::SparseBinaryDataVector) == 1);
+
+    std::stringstream report;
+    statistics.Print(report);
+    testing::ProcessTest("DatasetDensityStatistics::Print()", !report.str().empty());
+
+    // repacking applies one dataset-wide dense/sparse choice; the observed overall density is well
+    // below the sparse threshold, so every example converts to a sparse representation
+    dataset.Repack();
+    bool repackedSparse = true;
+    for (size_t i = 0; i < dataset.NumExamples(); ++i)
+    {
+        repackedSparse &= (dataset[i].GetDataVector().GetInternalType() == data::IDataVector::Type::SparseBinaryDataVector);
+    }
+    testing::ProcessTest("Dataset::Repack() converts to sparse", repackedSparse);
+    testing::ProcessTest("Dataset::Repack() updates the representation mix", statistics.GetRepresentationCount(data::IDataVector::Type::SparseBinaryDataVector) == 5);
+    testing::ProcessTest("Dataset::Repack() preserves values", testing::IsEqual(dataset[0].GetDataVector().ToArray(2), std::vector<double>{ 1, 1 }) && dataset[4].GetDataVector().ToArray()[99] == 1.0);
+
+    // the forced-representation constructor overrides the per-vector heuristic directly
+    std::vector<double> values(100, 0.0);
+    values[99] = 3.5;
+    data::AutoDataVector automatic(values);
+    data::AutoDataVector forcedDense(values, data::RepresentationPreference::dense);
+    testing::ProcessTest("AutoDataVector(vector, RepresentationPreference)",
+        automatic.GetInternalType() == data::IDataVector::Type::SparseFloatDataVector && forcedDense.GetInternalType() == data::IDataVector::Type::FloatDataVector);
+}
+
+void PackedDatasetTest()
+{
+    data::Dataset<data::AutoSupervisedExample> dataset;
+    dataset.AddExample(data::AutoSupervisedExample(data::AutoDataVector{ 1, 0, 2 }, data::WeightLabel{ 1, 1 }));
+    dataset.AddExample(data::AutoSupervisedExample(data::AutoDataVector{ 0, 3 }, data::WeightLabel{ 2, -1 }));
+    dataset.AddExample(data::AutoSupervisedExample(data::AutoDataVector{ 4, 5, 6 }, data::WeightLabel{ 3, 1 }));
+
+    data::DensePackedDataset packedDataset(dataset.GetExampleIterator());
+    testing::ProcessTest("PackedDataset::NumExamples()", packedDataset.NumExamples() == dataset.NumExamples());
+    testing::ProcessTest("PackedDataset::NumFeatures()", packedDataset.NumFeatures() == dataset.NumFeatures());
+
+    // the second example was added before the dataset grew to 3 features, so its row was repacked
+    const float* pRow = packedDataset.GetRow(1);
+    testing::ProcessTest("PackedDataset::GetRow()", pRow[0] == 0 && pRow[1] == 3 && pRow[2] == 0);
+    testing::ProcessTest("PackedDataset::GetMetadata()", packedDataset.GetMetadata(1).weight == 2 && packedDataset.GetMetadata(1).label == -1);
+
+    // iterating over the packed dataset reproduces the original examples
+    data::Dataset<data::DenseSupervisedExample> roundTripDataset(packedDataset.GetExampleIterator());
+    data::Dataset<data::DenseSupervisedExample> denseDataset(dataset.GetAnyDataset());
+    std::stringstream ss1, ss2;
+    denseDataset.Print(ss1);
+    roundTripDataset.Print(ss2);
+    testing::ProcessTest("PackedDataset::GetExampleIterator()", ss1.str() == ss2.str());
+
+    // the packed dataset works through the AnyDataset interface
+    data::Dataset<data::DenseSupervisedExample> anyDatasetCopy(packedDataset.GetAnyDataset(1, 2));
+    testing::ProcessTest("PackedDataset::GetAnyDataset()", anyDatasetCopy.NumExamples() == 2 && anyDatasetCopy[1].GetMetadata().label == 1);
+
+    // permuting moves the records but not the values
+    std::default_random_engine rng(123);
+    packedDataset.RandomPermute(rng);
+    double labelSum = 0;
+    for (size_t i = 0; i < packedDataset.NumExamples(); ++i)
+    {
+        labelSum += packedDataset.GetMetadata(i).label;
+    }
+    testing::ProcessTest("PackedDataset::RandomPermute()", labelSum == 1);
+}
+
+void ChunkedDatasetTest()
+{
+    data::AutoSupervisedChunkedDataset dataset;
+    for (size_t i = 0; i < 3; ++i)
+    {
+        dataset.AddExample(data::AutoSupervisedExample(data::AutoDataVector{ 1.0 * i, 2.0 }, data::WeightLabel{ 1, i % 2 == 0 ? 1.0 : -1.0 }));
+    }
+    testing::ProcessTest("ChunkedDataset::NumExamples()", dataset.NumExamples() == 3);
+    testing::ProcessTest("ChunkedDataset::NumFeatures()", dataset.NumFeatures() == 2);
+
+    // a snapshot sees a consistent prefix while the writer keeps appending
+    auto snapshot = dataset.GetExampleIterator();
+    const auto& example = dataset.GetExample(1);
+    const auto* pExample = &example;
+    for (size_t i = 0; i < 2 * data::AutoSupervisedChunkedDataset::blockSize; ++i)
+    {
+        dataset.AddExample(data::AutoSupervisedExample(data::AutoDataVector{ 7.0, 8.0, 9.0 }, data::WeightLabel{ 1, 1 }));
+    }
+
+    size_t snapshotCount = 0;
+    double labelSum = 0;
+    while (snapshot.IsValid())
+    {
+        labelSum += snapshot.Get().GetMetadata().label;
+        snapshot.Next();
+        ++snapshotCount;
+    }
+    testing::ProcessTest("ChunkedDataset snapshot prefix", snapshotCount == 3 && labelSum == 1);
+
+    // appending never relocates existing examples
+    testing::ProcessTest("ChunkedDataset stable references", &dataset.GetExample(1) == pExample);
+    testing::ProcessTest("ChunkedDataset grows", dataset.NumExamples() == 3 + 2 * data::AutoSupervisedChunkedDataset::blockSize);
+
+    // the chunked dataset works through the AnyDataset interface
+    data::Dataset<data::DenseSupervisedExample> anyDatasetCopy(dataset.GetAnyDataset(1, 2));
+    testing::ProcessTest("ChunkedDataset::GetAnyDataset()", anyDatasetCopy.NumExamples() == 2 && anyDatasetCopy[0].GetMetadata().label == -1);
+}
+
+void BinaryDatasetTest()
+{
+    data::Dataset<data::AutoSupervisedExample> dataset;
+    dataset.AddExample(GetExample<data::AutoSupervisedExample>());
+    dataset.AddExample(GetExample<data::AutoSupervisedExample>());
+    dataset.AddExample(GetExample<data::AutoSupervisedExample>());
+
+    std::string filename = "binaryDatasetTest.bin";
+    data::WriteBinaryDataset(dataset, filename);
+
+    data::MemoryMappedDataset<data::AutoSupervisedExample> mappedDataset(filename);
+    testing::ProcessTest("MemoryMappedDataset::NumExamples()", mappedDataset.NumExamples() == dataset.NumExamples());
+
+    data::Dataset<data::AutoSupervisedExample> roundTripDataset(mappedDataset.GetExampleIterator());
+
+    std::stringstream ss1, ss2;
+    dataset.Print(ss1);
+    roundTripDataset.Print(ss2);
+    testing::ProcessTest("MemoryMappedDataset::GetExampleIterator()", ss1.str() == ss2.str());
+
+    std::remove(filename.c_str());
+
+    // the incremental writer produces the same file as the whole-dataset writer
+    std::string incrementalFilename = "binaryDatasetWriterTest.bin";
+    {
+        data::BinaryDatasetWriter writer(incrementalFilename);
+        auto exampleIterator = dataset.GetExampleIterator();
+        while (exampleIterator.IsValid())
+        {
+            writer.WriteExample(exampleIterator.Get());
+            exampleIterator.Next();
+        }
+        testing::ProcessTest("BinaryDatasetWriter::NumExamplesWritten()", writer.NumExamplesWritten() == dataset.NumExamples());
+    }
+
+    data::MemoryMappedDataset<data::AutoSupervisedExample> incrementalDataset(incrementalFilename);
+    data::Dataset<data::AutoSupervisedExample> incrementalCopy(incrementalDataset.GetExampleIterator());
+    std::stringstream ss3;
+    incrementalCopy.Print(ss3);
+    testing::ProcessTest("BinaryDatasetWriter round trip", ss1.str() == ss3.str());
+
+    std::remove(incrementalFilename.c_str());
+}
 }
\ No newline at end of file
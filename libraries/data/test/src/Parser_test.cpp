@@ -9,7 +9,9 @@
 #include "Parser_test.h"
 
 // data
+#include "CsvParsingIterator.h"
 #include "GeneralizedSparseParsingIterator.h"
+#include "LibsvmParsingIterator.h"
 #include "TextLine.h"
 #include "SequentialLineIterator.h"
 #include "SingleLineParsingExampleIterator.h"
@@ -102,6 +104,60 @@ namespace ell
         BadFormatTest("Bad format test 11", "10 10 1:20  /");  // bad comment
     }
 
+    template <typename ParsingIteratorType>
+    std::vector<double> ParseToArray(std::string string)
+    {
+        auto line = data::TextLine(std::move(string));
+        ParsingIteratorType iterator(line);
+        std::vector<double> vector;
+        while (iterator.IsValid())
+        {
+            auto indexValue = iterator.Get();
+            vector.resize(indexValue.index + 1);
+            vector[indexValue.index] = indexValue.value;
+            iterator.Next();
+        }
+        return vector;
+    }
+
+    void CsvParseTest()
+    {
+        testing::ProcessTest("Csv parse test 1", testing::IsEqual(ParseToArray<data::CsvParsingIterator>("1,2,3"), { 1, 2, 3 }));
+        testing::ProcessTest("Csv parse test 2", testing::IsEqual(ParseToArray<data::CsvParsingIterator>("1.5, -2.5, 3e1"), { 1.5, -2.5, 30 }));
+        testing::ProcessTest("Csv parse test 3", testing::IsEqual(ParseToArray<data::CsvParsingIterator>(",1,,2"), { 1, 0, 2 })); // leading comma (after a label), empty field
+        testing::ProcessTest("Csv parse test 4", testing::IsEqual(ParseToArray<data::CsvParsingIterator>("  4 , 5 "), { 4, 5 }));
+        testing::ProcessTest("Csv parse test 5", testing::IsEqual(ParseToArray<data::CsvParsingIterator>(""), {}));
+    }
+
+    void LibsvmParseTest()
+    {
+        testing::ProcessTest("Libsvm parse test 1", testing::IsEqual(ParseToArray<data::LibsvmParsingIterator>("1:10 2:20"), { 10, 20 }));
+        testing::ProcessTest("Libsvm parse test 2", testing::IsEqual(ParseToArray<data::LibsvmParsingIterator>("2:10\t4:-20.5"), { 0, 10, 0, -20.5 }));
+        testing::ProcessTest("Libsvm parse test 3", testing::IsEqual(ParseToArray<data::LibsvmParsingIterator>(""), {}));
+
+        bool exceptionThrown = false;
+        try
+        {
+            ParseToArray<data::LibsvmParsingIterator>("0:10"); // indices are one-based
+        }
+        catch (...)
+        {
+            exceptionThrown = true;
+        }
+        testing::ProcessTest("Libsvm parse test 4", exceptionThrown);
+
+        exceptionThrown = false;
+        try
+        {
+            ParseToArray<data::LibsvmParsingIterator>("2:10 2:20"); // indices must increase
+        }
+        catch (...)
+        {
+            exceptionThrown = true;
+        }
+        testing::ProcessTest("Libsvm parse test 5", exceptionThrown);
+    }
+
     void AutoDataVectorParseTest()
     {
         auto parser = data::AutoDataVectorParser<data::GeneralizedSparseParsingIterator>();
@@ -117,6 +173,46 @@ namespace ell
             && dataVector2.GetInternalType() == data::IDataVector::Type::SparseByteDataVector);
     }
 
+    void SequentialLineIteratorTestImpl(size_t prefetchBlocks)
+    {
+        // enough lines to span several of the iterator's internal blocks, plus a final line with no
+        // trailing newline
+        const size_t numLines = 20000;
+        std::stringstream stream;
+        for (size_t i = 0; i < numLines; ++i)
+        {
+            stream << "line number " << i << " with some padding characters\n";
+        }
+        stream << "last line";
+
+        size_t count = 0;
+        bool contentsMatch = true;
+        for (data::SequentialLineIterator lineIterator(stream, '\n', prefetchBlocks); lineIterator.IsValid(); lineIterator.Next())
+        {
+            auto line = lineIterator.GetTextLine();
+            auto expected = (count < numLines) ? "line number " + std::to_string(count) + " with some padding characters" : std::string("last line");
+            if (line.Size() != expected.size())
+            {
+                contentsMatch = false;
+            }
+            else
+            {
+                for (size_t i = 0; i < expected.size(); ++i)
+                {
+                    if (line.Peek(i) != expected[i]) contentsMatch = false;
+                }
+            }
+            ++count;
+        }
+        testing::ProcessTest("SequentialLineIterator test", count == numLines + 1 && contentsMatch);
+    }
+
+    void SequentialLineIteratorTest()
+    {
+        SequentialLineIteratorTestImpl(0); // synchronous reads
+        SequentialLineIteratorTestImpl(2); // background prefetch through the bounded queue
+    }
+
     void SingleFileParseTest()
     {
         auto string = R"aw(
@@ -24,11 +24,22 @@ int main()
     DataVectorCopyAsTests();
     AutoDataVectorTest();
     TransformedDataVectorTest();
+    SparseDataVectorBlockedAddToTest();
     IteratorTests();
     ExampleCopyAsTests();
     DatasetCastingTests();
+    DatasetColumnMajorTest();
+    DatasetPermutationViewTest();
+    DatasetFoldViewTest();
+    DatasetDensityStatisticsTest();
+    PackedDatasetTest();
+    ChunkedDatasetTest();
+    BinaryDatasetTest();
     DataVectorParseTest();
+    CsvParseTest();
+    LibsvmParseTest();
     AutoDataVectorParseTest();
+    SequentialLineIteratorTest();
     SingleFileParseTest();
 
     if (testing::DidTestFail())
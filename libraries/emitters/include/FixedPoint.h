@@ -0,0 +1,71 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     FixedPoint.h (emitters)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// stl
+#include <cstdint>
+
+namespace ell
+{
+namespace emitters
+{
+    /// <summary> Describes a Q-format fixed-point representation: a signed integer of wordBits bits,
+    /// of which fractionalBits are to the right of the binary point. Used by the fixed-point
+    /// compilation mode to emit integer arithmetic for FPU-less targets; the format of each port is
+    /// inferred from calibrated value ranges. </summary>
+    struct QFormat
+    {
+        /// <summary> The total width of the representation, in bits. </summary>
+        int wordBits = 32;
+
+        /// <summary> The number of bits to the right of the binary point. </summary>
+        int fractionalBits = 0;
+
+        /// <summary> Returns the scale factor of the format (the real value of the least significant bit is 1/Scale()). </summary>
+        ///
+        /// <returns> The scale factor. </returns>
+        double Scale() const;
+
+        /// <summary> Returns the largest representable quantized value. </summary>
+        ///
+        /// <returns> The largest quantized value. </returns>
+        int64_t MaxQuantized() const;
+
+        /// <summary> Returns the smallest representable quantized value. </summary>
+        ///
+        /// <returns> The smallest quantized value. </returns>
+        int64_t MinQuantized() const;
+
+        /// <summary> Quantizes a real value to this format, saturating at the representable range. </summary>
+        ///
+        /// <param name="value"> The real value. </param>
+        ///
+        /// <returns> The quantized value. </returns>
+        int64_t Quantize(double value) const;
+
+        /// <summary> Recovers the real value of a quantized value. </summary>
+        ///
+        /// <param name="quantizedValue"> The quantized value. </param>
+        ///
+        /// <returns> The real value. </returns>
+        double Dequantize(int64_t quantizedValue) const;
+
+        /// <summary> Chooses the format with the most fractional bits that can represent a value range
+        /// without overflow: the integer bits cover the range's magnitude and the remaining bits go to
+        /// the fraction. </summary>
+        ///
+        /// <param name="minValue"> The smallest calibrated value. </param>
+        /// <param name="maxValue"> The largest calibrated value. </param>
+        /// <param name="wordBits"> The total width of the representation, in bits. </param>
+        ///
+        /// <returns> The chosen format. </returns>
+        static QFormat FromRange(double minValue, double maxValue, int wordBits = 32);
+    };
+}
+}
@@ -0,0 +1,32 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     HardwareCounters.h (emitters)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// stl
+#include <cstdint>
+
+//
+// Host runtime implementations of the hardware performance counter functions that profiled, compiled
+// models call (see IRRuntime::GetCacheMissCountFunction and IRRuntime::GetBranchMissCountFunction).
+// The jitter resolves these symbols from the host process; statically-compiled models that enable
+// profiling must be linked against an object providing them.
+//
+// On Linux (including ARM), the counters are read through the perf_event interface. On platforms
+// without an implementation, the functions return 0 and the profile reports show zero counts.
+//
+extern "C" {
+
+/// <summary> Returns the number of last-level cache misses incurred by this thread so far, or 0 if
+/// hardware counters are unavailable. </summary>
+int64_t ELL_GetCacheMissCount();
+
+/// <summary> Returns the number of branch mispredictions incurred by this thread so far, or 0 if
+/// hardware counters are unavailable. </summary>
+int64_t ELL_GetBranchMissCount();
+}
@@ -16,6 +16,11 @@
 #include "llvm/Target/TargetMachine.h" // for CodeGenFileType
 #include "llvm/Target/TargetOptions.h" // for FloatABI::ABIType and FPOpFusion::FpOpFusionMode
 
+// stl
+#include <ostream>
+#include <string>
+#include <vector>
+
 namespace ell
 {
 namespace emitters
@@ -52,5 +57,40 @@ namespace emitters
 
     /// <summary> Compile the given module to the given stream </summary>
     void GenerateMachineCode(llvm::raw_ostream& os, IRModuleEmitter& module, OutputFileType fileType, const MachineCodeOutputOptions& options);
+
+    /// <summary> The machine-code footprint of one group of compiled functions (typically all of
+    /// the functions lowered from one node type). </summary>
+    struct CodeSizeEntry
+    {
+        std::string name; // the node type, or the symbol name for functions not lowered from a node
+        size_t numFunctions = 0; // number of function bodies in the group
+        size_t size = 0; // total bytes of machine code
+    };
+
+    /// <summary> A per-node-type machine-code size report for a compiled module. </summary>
+    struct CodeSizeReport
+    {
+        std::vector<CodeSizeEntry> entries; // sorted by size, largest first
+        size_t totalSize = 0; // bytes of machine code in all functions
+    };
+
+    /// <summary> Computes per-node-type machine-code sizes by generating object code for the module
+    /// and reading the function symbol sizes back out of it. Like GenerateMachineCode, this may
+    /// modify the module, so run it after (or instead of) the real code emission. </summary>
+    ///
+    /// <param name="module"> The module to measure. </param>
+    /// <param name="options"> The machine code output options. </param>
+    ///
+    /// <returns> The size report. </returns>
+    CodeSizeReport GetCodeSizeReport(IRModuleEmitter& module, const MachineCodeOutputOptions& options);
+
+    /// <summary> Writes a per-node-type machine-code size report to a stream, with a verdict
+    /// against a code-size budget when one is given. </summary>
+    ///
+    /// <param name="os"> [in,out] The stream to write the report to. </param>
+    /// <param name="module"> The module to measure. </param>
+    /// <param name="options"> The machine code output options. </param>
+    /// <param name="codeSizeBudget"> The code-size budget, in bytes (0 == no budget). </param>
+    void WriteCodeSizeReport(std::ostream& os, IRModuleEmitter& module, const MachineCodeOutputOptions& options, size_t codeSizeBudget = 0);
 }
 }
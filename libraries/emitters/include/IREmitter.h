@@ -474,6 +474,13 @@ namespace emitters
         /// <param name="pos"> Pointer to the instruction to place new instructions after. </param>
         void SetCurrentInsertPoint(llvm::Instruction* pos);
 
+        /// <summary> Sets or clears the fast-math flags applied to floating-point instructions
+        /// emitted from here on. When set, the optimizer may reassociate expressions and contract
+        /// multiply-adds, and assumes no NaNs or infinities are produced. </summary>
+        ///
+        /// <param name="enable"> true to emit fast-math instructions, false to restore strict semantics. </param>
+        void SetFastMathFlags(bool enable);
+
         /// <summary> Emits a call to a given function. </summary>
         ///
         /// <param name="pFunction"> Pointer to the function being called. </param>
@@ -673,6 +680,17 @@ namespace emitters
         /// <returns> Pointer to the resulting llvm::CallInst. </returns>
         llvm::CallInst* MemorySet(llvm::Value* pDestination, llvm::Value* value, llvm::Value* size);
 
+        /// <summary> Emits an llvm.prefetch instruction, which hints the target to fetch the cache
+        /// line holding an address before it is accessed. </summary>
+        ///
+        /// <param name="pModule"> The module being emitted. </param>
+        /// <param name="pAddress"> Pointer to the value that holds the address to prefetch. </param>
+        /// <param name="forWrite"> true to prefetch for a write, false to prefetch for a read. </param>
+        /// <param name="locality"> Temporal locality hint, from 0 (no reuse expected) to 3 (high reuse expected). </param>
+        ///
+        /// <returns> Pointer to the resulting llvm::CallInst. </returns>
+        llvm::CallInst* Prefetch(llvm::Module* pModule, llvm::Value* pAddress, bool forWrite, int locality);
+
         /// <summary> Gets the underlying LLVMContext. </summary>
         ///
         /// <returns> Reference to the underlying llvm::LLVMContext. </returns>
@@ -30,12 +30,18 @@ namespace emitters
         /// </summary>
         ///
         /// <param name="module"> [in,out] The module. </param>
-        IRExecutionEngine(IRModuleEmitter&& module);
+        /// <param name="useSharedEngine"> If true, run the module in the process-shared execution
+        /// engine (see `IRSharedExecutionEngine`) instead of building a private LLVM backend. </param>
+        IRExecutionEngine(IRModuleEmitter&& module, bool useSharedEngine = false);
 
         /// <summary> Inject the primary "owner" module into the execution engine. </summary>
         ///
         /// <param name="pModule"> The module. </param>
-        IRExecutionEngine(std::unique_ptr<llvm::Module> pModule);
+        /// <param name="useSharedEngine"> If true, run the module in the process-shared execution
+        /// engine (see `IRSharedExecutionEngine`) instead of building a private LLVM backend. </param>
+        IRExecutionEngine(std::unique_ptr<llvm::Module> pModule, bool useSharedEngine = false);
+
+        ~IRExecutionEngine();
 
         /// <summary>
         /// Similar to LLI.exe. Set the CPU type, architecture and so on that the execution engine should
@@ -53,6 +59,14 @@ namespace emitters
         /// <param name="pModule"> The module to add. </param>
         void AddModule(std::unique_ptr<llvm::Module> pModule);
 
+        /// <summary> Removes a module from the execution engine and deletes its IR. Code already
+        /// jitted for the module stays resident (an MCJIT limitation). </summary>
+        ///
+        /// <param name="pModule"> The module to remove. </param>
+        ///
+        /// <returns> true if the module was found and removed. </returns>
+        bool RemoveModule(llvm::Module* pModule);
+
         /// <summary>
         /// Return the address of a named function, JITTing code as needed. Returns 0 if not found.
         /// </summary>
@@ -90,6 +104,10 @@ namespace emitters
 
         std::unique_ptr<llvm::EngineBuilder> _pBuilder;
         std::unique_ptr<llvm::ExecutionEngine> _pEngine;
+
+        // set when this instance is a lightweight view onto the process-shared engine
+        bool _useSharedEngine = false;
+        size_t _sharedModuleHandle = 0;
     };
 }
 }
@@ -15,6 +15,11 @@
 #include "LLVMInclude.h"
 #include "Variable.h"
 
+// stl
+#include <functional>
+#include <string>
+#include <vector>
+
 namespace ell
 {
 namespace emitters
@@ -209,6 +214,36 @@ namespace emitters
         /// <returns> Pointer to the return value of the operator. </returns>
         llvm::Value* Operator(TypedOperator type, llvm::iterator_range<llvm::Function::arg_iterator>& arguments);
 
+        /// <summary> Emit a saturating Q-format fixed-point multiply: the product is computed at
+        /// double width, shifted right by the number of fractional bits, and clamped to the
+        /// representable range before being narrowed back to the word width. </summary>
+        ///
+        /// <param name="pLeftValue"> Pointer to the left quantized argument (an integer of wordBits bits). </param>
+        /// <param name="pRightValue"> Pointer to the right quantized argument. </param>
+        /// <param name="fractionalBits"> The number of fractional bits of the operands. </param>
+        /// <param name="wordBits"> The width of the fixed-point representation. </param>
+        ///
+        /// <returns> Pointer to the quantized product. </returns>
+        llvm::Value* FixedPointMultiply(llvm::Value* pLeftValue, llvm::Value* pRightValue, int fractionalBits, int wordBits = 32);
+
+        /// <summary> Emit a saturating fixed-point add of two values in the same Q format. </summary>
+        ///
+        /// <param name="pLeftValue"> Pointer to the left quantized argument (an integer of wordBits bits). </param>
+        /// <param name="pRightValue"> Pointer to the right quantized argument. </param>
+        /// <param name="wordBits"> The width of the fixed-point representation. </param>
+        ///
+        /// <returns> Pointer to the quantized sum. </returns>
+        llvm::Value* FixedPointAdd(llvm::Value* pLeftValue, llvm::Value* pRightValue, int wordBits = 32);
+
+        /// <summary> Emit a clamp of a double-width intermediate value to the representable range of a
+        /// wordBits-wide fixed-point value, then narrow it to that width. </summary>
+        ///
+        /// <param name="pValue"> Pointer to the 64-bit intermediate value. </param>
+        /// <param name="wordBits"> The width of the fixed-point representation. </param>
+        ///
+        /// <returns> Pointer to the saturated, narrowed value. </returns>
+        llvm::Value* FixedPointSaturate(llvm::Value* pValue, int wordBits = 32);
+
         /// <summary>
         /// Emit binary operator over 2 equal sized vector arguments. The operator is applied to each
         /// pair of scalars. Also supply an aggregator function.
@@ -682,6 +717,18 @@ namespace emitters
         /// <returns> A for loop emitter. </returns>
         IRForLoopEmitter ForLoop();
 
+        /// <summary> Emits a loop over the range [0, count) whose iterations may be split across worker threads. </summary>
+        ///
+        /// <param name="count"> The number of iterations. Iterations must be independent of each other. </param>
+        /// <param name="capturedValues"> Pointer-typed values the loop body uses. They are passed to the
+        /// worker threads through a context block, so the body must read them from the values it is given
+        /// rather than from the enclosing scope. </param>
+        /// <param name="body"> A function that emits the loop body. It is called with the function being
+        /// emitted into (which may be a separate task function), the iteration index, and the captured values. </param>
+        ///
+        /// <remarks> If the target device's thread count is 1 (the default), an ordinary serial loop is emitted. </remarks>
+        void ParallelFor(int count, const std::vector<llvm::Value*>& capturedValues, std::function<void(IRFunctionEmitter&, llvm::Value*, const std::vector<llvm::Value*>&)> body);
+
         /// <summary> Gets an if statement emitter. </summary>
         ///
         /// <returns> An if statement emitter. </returns>
@@ -804,6 +851,15 @@ namespace emitters
         template <typename ValueType>
         void MemorySet(llvm::Value* pDestinationPointer, int destinationOffset, llvm::Value* value, int count);
 
+        /// <summary> Emits a software prefetch of the cache line holding an element of an array.
+        /// Used ahead of strided walks whose step is too large for the hardware prefetcher to
+        /// follow; prefetching past the end of the array is harmless. </summary>
+        ///
+        /// <param name="pPointer"> Pointer to the base address of the array. </param>
+        /// <param name="pOffset"> Offset of the element to prefetch. </param>
+        /// <param name="forWrite"> true to prefetch for writing, false to prefetch for reading. </param>
+        void Prefetch(llvm::Value* pPointer, llvm::Value* pOffset, bool forWrite = false);
+
         /// <summary> Inserts arbitrary function-level metadata into generated IR code. </summary>
         ///
         /// <param name="tag"> The tag of the metadata to set. </param>
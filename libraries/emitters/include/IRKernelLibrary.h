@@ -0,0 +1,60 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     IRKernelLibrary.h (emitters)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// stl
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace ell
+{
+namespace emitters
+{
+    class IRExecutionEngine;
+
+    /// <summary> A per-process library of precompiled runtime kernels (dot products, softmax,
+    /// pooling windows). When several maps run in the same process, each map's module normally
+    /// carries its own copy of these kernels and the JIT optimizes every copy again. The library
+    /// instead compiles the canonical kernels once, publishes their addresses as process symbols,
+    /// and lets map modules link to them by external reference (enabled per module with the
+    /// `useSharedKernelLibrary` compiler setting), so per-map JIT work shrinks to linking. The
+    /// kernels are compiled for the host, so the setting is only valid for modules that run in
+    /// this process's JIT. </summary>
+    class IRKernelLibrary
+    {
+    public:
+        IRKernelLibrary(const IRKernelLibrary&) = delete;
+        IRKernelLibrary& operator=(const IRKernelLibrary&) = delete;
+
+        /// <summary> Get the process-wide kernel library instance. </summary>
+        ///
+        /// <returns> The kernel library. </returns>
+        static IRKernelLibrary& GetInstance();
+
+        /// <summary> Compile the kernels and publish their addresses as process symbols, if this
+        /// has not happened yet. Called by `IRRuntime` before it declares a kernel by reference;
+        /// safe to call from multiple threads. </summary>
+        void EnsureCompiled();
+
+        /// <summary> Get the linker symbol under which a kernel is published. </summary>
+        ///
+        /// <param name="kernelName"> The plain kernel name, e.g. "DotProductF". </param>
+        ///
+        /// <returns> The process-wide symbol name for the kernel. </returns>
+        static std::string GetKernelSymbolName(const std::string& kernelName);
+
+    private:
+        IRKernelLibrary() = default;
+
+        std::mutex _mutex;
+        std::unique_ptr<IRExecutionEngine> _pEngine; // keeps the compiled kernel code alive for the process lifetime
+    };
+}
+}
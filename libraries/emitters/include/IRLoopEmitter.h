@@ -63,6 +63,15 @@ namespace emitters
         /// <returns> Pointer to the llvm::BasicBlock that represents the for loop. </returns>
         llvm::BasicBlock* Begin(const int iStartAt, const int iMaxValue, const int stepSize);
 
+        /// <summary> Emits the beginning of a for loop over a runtime range, with a given step size. </summary>
+        ///
+        /// <param name="pStartAt"> Pointer to an llvm::Value that contains the start iteration value. </param>
+        /// <param name="pMaxValue"> Pointer to an llvm::Value that contains the max iteration value. </param>
+        /// <param name="stepSize"> Size of the step. </param>
+        ///
+        /// <returns> Pointer to the llvm::BasicBlock that represents the for loop. </returns>
+        llvm::BasicBlock* Begin(llvm::Value* pStartAt, llvm::Value* pMaxValue, const int stepSize);
+
         /// <summary> Emits the beginning of a for loop that uses a mutable test value. </summary>
         ///
         /// <typeparam name="ValueType"> The C++ type for pStart, pIncrement, and the value referenced by pTestValuePointer. </param>
@@ -78,6 +87,12 @@ namespace emitters
         /// <summary> Emit the end of this for loop. </summary>
         void End();
 
+        /// <summary> Attaches llvm.loop vectorization and unrolling hints to this loop. </summary>
+        ///
+        /// <param name="vectorWidth"> The SIMD width, in elements, to request from the vectorizer. Pass 0 to leave vectorization to the optimizer. </param>
+        /// <param name="unrollFactor"> The unroll count to request. Pass 0 to leave unrolling to the optimizer. </param>
+        void SetVectorizationHints(int vectorWidth, int unrollFactor = 0);
+
         /// <summary> Resets this emitter, to start a new for loop. </summary>
         void Clear();
 
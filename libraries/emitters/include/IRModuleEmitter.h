@@ -24,6 +24,7 @@
 #include <memory>
 #include <stack>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -33,6 +34,17 @@ namespace emitters
 {
     class IRExecutionEngine;
 
+    /// <summary> One array in the module's patchable weight segment: a writable global plus its
+    /// slice of the weight blob. The blob is the entries laid out in registration order, each
+    /// aligned to 8 bytes. </summary>
+    struct WeightsSegmentEntry
+    {
+        std::string name;
+        llvm::GlobalVariable* global;
+        size_t byteOffset;
+        size_t byteSize;
+    };
+
     /// <summary> Object used to emit LLVM Module level instructions. </summary>
     class IRModuleEmitter : public ModuleEmitter
     {
@@ -188,6 +200,20 @@ namespace emitters
         template <typename ValueType>
         llvm::GlobalVariable* ConstantArray(const std::string& name, const std::vector<ValueType>& value);
 
+        /// <summary>
+        /// Emit a read-only array constant through the module's constant pool. Identical blobs are
+        /// emitted once per module, and the pooled global gets a content-derived name with
+        /// linkonce_odr linkage, so when several modules linked into one binary pool the same blob
+        /// (an ensemble sharing embedding weights, say) the linker keeps a single copy.
+        /// </summary>
+        ///
+        /// <typeparam name="ValueType"> Type of each array entry. </typeparam>
+        /// <param name="value"> The array constant value. </param>
+        ///
+        /// <returns> Pointer to the llvm::GlobalVariable that represents the pooled constant. </returns>
+        template <typename ValueType>
+        llvm::GlobalVariable* SharedConstantArray(const std::vector<ValueType>& value);
+
         /// <summary> Emit a named global variable of the given type. </summary>
         ///
         /// <param name="type"> The variable type. </param>
@@ -240,6 +266,44 @@ namespace emitters
         template <typename ValueType>
         llvm::GlobalVariable* GlobalArray(const std::string& name, const std::vector<ValueType>& value);
 
+        //
+        // Patchable weight segment
+        //
+
+        /// <summary> Emit a named array into the module's patchable weight segment. Unlike
+        /// `ConstantArray`, the global is writable and its position in the weight blob is recorded,
+        /// so a deployed module can take a retrained blob at runtime without recompiling. </summary>
+        ///
+        /// <typeparam name="ValueType"> Type of each array entry. </typeparam>
+        /// <param name="name"> The array name. </param>
+        /// <param name="value"> The initial (compile-time) weight values. </param>
+        ///
+        /// <returns> Pointer to the llvm::GlobalVariable that represents the weights. </returns>
+        template <typename ValueType>
+        llvm::GlobalVariable* WeightsArray(const std::string& name, const std::vector<ValueType>& value);
+
+        /// <summary> Gets the entries in the patchable weight segment, in blob layout order. </summary>
+        ///
+        /// <returns> The weight segment entries. </returns>
+        const std::vector<WeightsSegmentEntry>& GetWeightsSegment() const { return _weightsSegment; }
+
+        /// <summary> Gets the total size in bytes of the weight blob. </summary>
+        ///
+        /// <returns> The blob size in bytes. </returns>
+        size_t GetWeightsSegmentSize() const { return _weightsSegmentSize; }
+
+        /// <summary> Sets an explicit version string for the weight segment. </summary>
+        ///
+        /// <param name="version"> The version string. </param>
+        void SetWeightsVersion(const std::string& version) { _weightsVersion = version; }
+
+        /// <summary> Gets the weight segment's version string. If no explicit version was set, the
+        /// version is derived from the segment's layout, so a blob produced for one compiled graph
+        /// can't silently be patched into a different one. </summary>
+        ///
+        /// <returns> The version string. </returns>
+        std::string GetWeightsVersion() const;
+
         //
         // Functions
         //
@@ -424,6 +488,14 @@ namespace emitters
         /// <param name="optimizer"> The optimizer. </param>
         void Optimize(IRModuleOptimizer& optimizer);
 
+        /// <summary> Run module optimization passes at the given effort level. At the aggressive
+        /// level, functions and globals that aren't part of the module's public API are first
+        /// given internal linkage, so the per-node functions can be inlined into the map function
+        /// and stores to the port globals forwarded to the loads that consume them. </summary>
+        ///
+        /// <param name="level"> The optimization effort level. </param>
+        void Optimize(ModuleOptimizationLevel level);
+
         /// <summary>
         /// Set the target machine and arch for this module. This aids the system in optimizations and
         /// Jitting etc.
@@ -552,6 +624,10 @@ namespace emitters
         template <typename T>
         llvm::Value* EmitRef(VectorElementVariable<T>& var);
 
+        /// Emit IR for a reference to a range of elements inside a vector.
+        template <typename T>
+        llvm::Value* EmitRef(VectorRefVariable<T>& var);
+
         IRFunctionEmitter Function(const std::string& name, VariableType returnType, bool isPublic = false);
         IRFunctionEmitter Function(const std::string& name, VariableType returnType, const ValueTypeList& arguments, bool isPublic = false);
         IRFunctionEmitter Function(const std::string& name, VariableType returnType, const NamedVariableTypeList& arguments, bool isPublic = false);
@@ -566,6 +642,10 @@ namespace emitters
         // Lower-level internal functions
         //
         llvm::GlobalVariable* Global(const std::string& name, llvm::Type* pType, llvm::Constant* pInitial, bool isConst);
+        llvm::GlobalVariable* SharedConstant(const std::string& name, llvm::Type* pType, llvm::Constant* pInitial);
+        static std::string ConstantPoolName(int typeId, const void* pData, size_t byteSize);
+        void RecordWeightsEntry(const std::string& name, llvm::GlobalVariable* pGlobal, size_t byteSize);
+        void InternalizeNonApiSymbols();
         IRFunctionEmitter Function(const std::string& name, VariableType returnType, const ValueTypeList* pArguments, bool isPublic);
         llvm::Function::LinkageTypes Linkage(bool isPublic);
         llvm::ConstantAggregateZero* InitializeArray(llvm::ArrayType* pType);
@@ -585,6 +665,10 @@ namespace emitters
 
         IRVariableTable _literals; // Symbol table - name to literals
         IRVariableTable _globals; // Symbol table - name to global variables
+        std::unordered_map<llvm::Constant*, llvm::GlobalVariable*> _constantPool; // pooled literal blobs, keyed by their (uniqued) initializers
+        std::vector<WeightsSegmentEntry> _weightsSegment; // patchable weight globals, in blob layout order
+        size_t _weightsSegmentSize = 0;
+        std::string _weightsVersion;
         IRRuntime _runtime; // Manages emission of runtime functions
 
         std::unique_ptr<llvm::Module> _pModule; // The LLVM Module being emitted
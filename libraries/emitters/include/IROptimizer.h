@@ -64,17 +64,24 @@ namespace emitters
     class IRModuleOptimizer
     {
     public:
-        /// <summary> Add common optimizations to the optimizer pipeline. </summary>
+        /// <summary> Add common module-level optimizations to the optimizer pipeline. </summary>
         void AddStandardPasses();
 
+        /// <summary> Add aggressive whole-module optimizations: a high inlining threshold so the
+        /// per-node functions get folded into the map function, plus the interprocedural cleanup
+        /// passes (global opt, GVN, dead store elimination) that inlining unlocks. Most effective
+        /// when the module's non-API symbols have been given internal linkage first. </summary>
+        void AddAggressivePasses();
+
         /// <summary> Optimize a given module. </summary>
         ///
         /// <param name="pModule"> pointer to an llvm module. </param>
         void Run(llvm::Module* pModule);
 
     private:
-        llvm::ModulePassManager _passes;
-        llvm::ModuleAnalysisManager _analysis;
+        void AddPassesForLevel(unsigned optLevel, unsigned inlineThreshold);
+
+        llvm::legacy::PassManager _passes;
     };
 }
 }
\ No newline at end of file
@@ -38,6 +38,80 @@ namespace emitters
         /// <returns> An LLVM function pointer to the current time function. </returns>
         llvm::Function* GetCurrentTimeFunction(); // returns a double containing the current time (in _milliseconds_ from some arbitrary start time)
 
+        /// <summary> Get a pointer to the parallel-for function, which splits an index range into
+        /// contiguous slices and runs a task function over them on worker threads. </summary>
+        ///
+        /// <returns> An LLVM function pointer to the parallel-for function. </returns>
+        llvm::Function* GetParallelForFunction(); // void ParallelFor(int32 begin, int32 end, int32 numThreads, int8* context, void (*task)(int32, int32, int8*))
+
+        //
+        // Pipeline queues
+        //
+
+        /// <summary> Get the type of the single-producer single-consumer queue used to hand samples
+        /// between pipeline stages: `{ slots, slotSize, capacity, head, tail, stop }`, a fixed-size
+        /// ring of byte slots where only the consumer writes `head` and only the producer writes
+        /// `tail`, so push and pop need no lock. </summary>
+        ///
+        /// <returns> The LLVM struct type for a pipeline queue. </returns>
+        llvm::StructType* GetPipelineQueueType();
+
+        /// <summary> Get a pointer to the function that initializes a pipeline queue over
+        /// caller-provided slot storage. </summary>
+        ///
+        /// <returns> An LLVM function pointer to the queue init function. </returns>
+        llvm::Function* GetPipelineQueueInitFunction(); // void PipelineQueueInit(queue*, int8* slots, int32 slotSize, int32 capacity)
+
+        /// <summary> Get a pointer to the function that copies an item into a pipeline queue,
+        /// spin-waiting while the queue is full. Returns 0 without copying if the queue was
+        /// stopped. </summary>
+        ///
+        /// <returns> An LLVM function pointer to the queue push function. </returns>
+        llvm::Function* GetPipelineQueuePushFunction(); // int32 PipelineQueuePush(queue*, int8* item)
+
+        /// <summary> Get a pointer to the function that copies the oldest item out of a pipeline
+        /// queue, spin-waiting while the queue is empty. Returns 0 without copying if the queue was
+        /// stopped and has been drained. </summary>
+        ///
+        /// <returns> An LLVM function pointer to the queue pop function. </returns>
+        llvm::Function* GetPipelineQueuePopFunction(); // int32 PipelineQueuePop(queue*, int8* item)
+
+        /// <summary> Get a pointer to the function that stops a pipeline queue, releasing any
+        /// spinning producer or consumer. </summary>
+        ///
+        /// <returns> An LLVM function pointer to the queue stop function. </returns>
+        llvm::Function* GetPipelineQueueStopFunction(); // void PipelineQueueStop(queue*)
+
+        /// <summary> Get a pointer to the function that reads the hardware cache-miss counter. The
+        /// function is an external symbol (`ELL_GetCacheMissCount`) implemented by the host runtime in
+        /// HardwareCounters.cpp; it returns a monotonically increasing count, or 0 when hardware
+        /// counters are unavailable. </summary>
+        ///
+        /// <returns> An LLVM function pointer to the cache-miss count function. </returns>
+        llvm::Function* GetCacheMissCountFunction(); // int64 ELL_GetCacheMissCount()
+
+        /// <summary> Get a pointer to the function that reads the hardware branch-misprediction
+        /// counter. The function is an external symbol (`ELL_GetBranchMissCount`) implemented by the
+        /// host runtime in HardwareCounters.cpp; it returns a monotonically increasing count, or 0 when
+        /// hardware counters are unavailable. </summary>
+        ///
+        /// <returns> An LLVM function pointer to the branch-miss count function. </returns>
+        llvm::Function* GetBranchMissCountFunction(); // int64 ELL_GetBranchMissCount()
+
+        //
+        // Freestanding runtime shims
+        //
+
+        /// <summary> Get a pointer to the static-arena allocation function emitted for freestanding
+        /// targets: a bump-pointer allocator over a zero-initialized global byte array whose size is
+        /// `TargetDevice::freestandingArenaSize`. Returns null when the arena is exhausted, so callers
+        /// fail loudly instead of corrupting memory. Requesting any freestanding shim also emits the
+        /// exported constant `ELL_FreestandingABIVersion`, which firmware implementing the shims can
+        /// check before calling into the module. </summary>
+        ///
+        /// <returns> An LLVM function pointer to the arena allocation function. </returns>
+        llvm::Function* GetArenaAllocateFunction(); // int8* ArenaAllocate(int64 sizeInBytes)
+
         //
         // Standard math functions
         //
@@ -54,6 +128,13 @@ namespace emitters
         template <typename ValueType>
         llvm::Function* GetExpFunction();
 
+        /// <summary> Get a fast polynomial approximation of exp, emitted once per module. It trades
+        /// full precision for a short branch-free body (the same approximation as math::FastMath::Exp,
+        /// accurate to about 1e-6 relative error), which the vectorizer can inline into loops. Used by
+        /// the compiled activation and softmax nodes when the `useFastMath` compiler setting is on. </summary>
+        template <typename ValueType>
+        llvm::Function* GetFastExpFunction();
+
         /// <summary> Get the log function </summary>
         template <typename ValueType>
         llvm::Function* GetLogFunction();
@@ -61,11 +142,40 @@ namespace emitters
         //
         // Dot product
         //
-        
+
         /// <summary> Get the dot product function </summary>
         template <typename ValueType>
         llvm::Function* GetDotProductFunction();
 
+        //
+        // Neural-net kernels
+        //
+
+        /// <summary> Get the function that computes a numerically-stable softmax in place over a
+        /// vector: each element is replaced by `exp(x - max) / sum(exp(x - max))`. </summary>
+        template <typename ValueType>
+        llvm::Function* GetSoftmaxFunction(); // void Softmax(int32 count, T* pValues)
+
+        /// <summary> Get the function that returns the maximum over a strided pooling window:
+        /// the largest of `pValues[i * increment]` for `i` in `[0, count)`. </summary>
+        template <typename ValueType>
+        llvm::Function* GetMaxPoolWindowFunction(); // T MaxPoolWindow(int32 count, T* pValues, int32 increment)
+
+        //
+        // Precision boundary kernels
+        //
+
+        /// <summary> Get the function that quantizes a contiguous array to int8: each value is
+        /// divided by the scale, rounded to the nearest integer, shifted by the zero point and
+        /// saturated to [-128, 127]. </summary>
+        template <typename ValueType>
+        llvm::Function* GetQuantizeFunction(); // void Quantize(int32 count, T* pInput, int8* pOutput, T scale, int32 zeroPoint)
+
+        /// <summary> Get the function that dequantizes a contiguous int8 array: each value is
+        /// shifted by the zero point and multiplied by the scale. </summary>
+        template <typename ValueType>
+        llvm::Function* GetDequantizeFunction(); // void Dequantize(int32 count, int8* pInput, T* pOutput, T scale, int32 zeroPoint)
+
         //
         // BLAS functions
         //
@@ -89,20 +199,62 @@ namespace emitters
         llvm::Function* GetAbsFunction(VariableType argType);
         llvm::Function* GetExpFunction(VariableType argType);
         llvm::Function* GetLogFunction(VariableType argType);
+        llvm::Function* GetFastExpFunction(VariableType argType);
+        llvm::Function* EmitFastExpFunction(VariableType argType);
 
         llvm::Function* EmitDotProductFunction();
         llvm::Function* EmitDotProductFunctionF();
 
+        llvm::Function* GetSoftmaxFunction(VariableType argType);
+        llvm::Function* EmitSoftmaxFunction(VariableType argType);
+        llvm::Function* GetMaxPoolWindowFunction(VariableType argType);
+        llvm::Function* EmitMaxPoolWindowFunction(VariableType argType);
+
+        llvm::Function* GetQuantizeFunction(VariableType argType);
+        llvm::Function* EmitQuantizeFunction(VariableType argType);
+        llvm::Function* GetDequantizeFunction(VariableType argType);
+        llvm::Function* EmitDequantizeFunction(VariableType argType);
+
+        // declares a kernel from the per-process kernel library by reference, making sure the
+        // library has been compiled and its symbols published first
+        llvm::Function* GetSharedKernelFunction(const std::string& kernelName, llvm::FunctionType* functionType);
+        bool UseSharedKernelLibrary() const;
+
         llvm::Function* GetSGEMVFunction();
         llvm::Function* GetSGEMMFunction();
         llvm::Function* GetDGEMVFunction();
         llvm::Function* GetDGEMMFunction();
 
+        // emits the exported ABI version constant for the freestanding shim set, once per module
+        void EnsureShimABIVersion();
+
         IRModuleEmitter& _module;
 
+        llvm::Function* EmitParallelForThreadEntryFunction(llvm::StructType* taskArgType);
+
         llvm::Function* _pDotProductFunctionFloat = nullptr;
         llvm::Function* _pDotProductFunction = nullptr;
         llvm::Function* _pGetCurrentTimeFunction = nullptr;
+        llvm::Function* _pParallelForFunction = nullptr;
+        llvm::StructType* _pPipelineQueueType = nullptr;
+        llvm::Function* _pPipelineQueueInitFunction = nullptr;
+        llvm::Function* _pPipelineQueuePushFunction = nullptr;
+        llvm::Function* _pPipelineQueuePopFunction = nullptr;
+        llvm::Function* _pPipelineQueueStopFunction = nullptr;
+        llvm::Function* _pCacheMissCountFunction = nullptr;
+        llvm::Function* _pBranchMissCountFunction = nullptr;
+        llvm::Function* _pFastExpFunctionFloat = nullptr;
+        llvm::Function* _pFastExpFunctionDouble = nullptr;
+        llvm::Function* _pSoftmaxFunctionFloat = nullptr;
+        llvm::Function* _pSoftmaxFunctionDouble = nullptr;
+        llvm::Function* _pMaxPoolWindowFunctionFloat = nullptr;
+        llvm::Function* _pMaxPoolWindowFunctionDouble = nullptr;
+        llvm::Function* _pQuantizeFunctionFloat = nullptr;
+        llvm::Function* _pQuantizeFunctionDouble = nullptr;
+        llvm::Function* _pDequantizeFunctionFloat = nullptr;
+        llvm::Function* _pDequantizeFunctionDouble = nullptr;
+        llvm::Function* _pArenaAllocateFunction = nullptr;
+        llvm::GlobalVariable* _pShimABIVersion = nullptr;
     };
 }
 }
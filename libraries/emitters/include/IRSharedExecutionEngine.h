@@ -0,0 +1,92 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     IRSharedExecutionEngine.h (emitters)
+//  Authors:  Umesh Madan
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "IRExecutionEngine.h"
+
+// llvm
+#include "llvm/IR/Module.h"
+
+// stl
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace ell
+{
+namespace emitters
+{
+    /// <summary>
+    /// The process-shared execution engine: one LLVM JIT backend that hosts the modules of many
+    /// compiled maps at once, instead of each map building its own backend. Maps add and remove
+    /// their modules dynamically, so a process running dozens of maps pays for a single backend's
+    /// memory and initialization. Symbols are privatized per module when it is added, so identically
+    /// named maps can coexist; look functions up through the handle returned by `AddModule`.
+    /// All operations are thread-safe.
+    /// </summary>
+    class IRSharedExecutionEngine
+    {
+    public:
+        /// <summary> A handle identifying a module hosted by the shared engine. </summary>
+        typedef size_t ModuleHandle;
+
+        IRSharedExecutionEngine(const IRSharedExecutionEngine&) = delete;
+        IRSharedExecutionEngine& operator=(const IRSharedExecutionEngine&) = delete;
+
+        /// <summary> Gets the process-wide shared engine. </summary>
+        ///
+        /// <returns> The shared engine instance. </returns>
+        static IRSharedExecutionEngine& GetInstance();
+
+        /// <summary> Adds a module to the shared engine. Every symbol the module defines is given a
+        /// handle-specific prefix, so modules with identical names never collide. </summary>
+        ///
+        /// <param name="pModule"> The module to add. </param>
+        ///
+        /// <returns> The handle used to look up the module's functions and to remove it. </returns>
+        ModuleHandle AddModule(std::unique_ptr<llvm::Module> pModule);
+
+        /// <summary> Removes a module, releasing its IR. Code already jitted for the module stays
+        /// resident (an MCJIT limitation), but the IR and the handle are freed. </summary>
+        ///
+        /// <param name="handle"> The handle returned by `AddModule`. </param>
+        void RemoveModule(ModuleHandle handle);
+
+        /// <summary>
+        /// Return the address of a named function in the given module, JITting code as needed.
+        /// Returns 0 if not found.
+        /// </summary>
+        ///
+        /// <param name="handle"> The handle of the module to search. </param>
+        /// <param name="name"> Name of the requested function, as the module defined it. </param>
+        ///
+        /// <returns> The function address. </returns>
+        uint64_t GetFunctionAddress(ModuleHandle handle, const std::string& name);
+
+        /// <summary> Return the address of a named function in the given module. Throws if not found. </summary>
+        ///
+        /// <param name="handle"> The handle of the module to search. </param>
+        /// <param name="name"> Name of the requested function, as the module defined it. </param>
+        ///
+        /// <returns> The function address. </returns>
+        uint64_t ResolveFunctionAddress(ModuleHandle handle, const std::string& name);
+
+    private:
+        IRSharedExecutionEngine() = default;
+
+        static std::string GetSymbolPrefix(ModuleHandle handle);
+        void PrivatizeSymbols(llvm::Module& module, ModuleHandle handle);
+
+        std::mutex _mutex;
+        std::unique_ptr<IRExecutionEngine> _pEngine; // owns the single backend; lives for the process lifetime
+        ModuleHandle _nextHandle = 1;
+        std::unordered_map<ModuleHandle, llvm::Module*> _modules;
+    };
+}
+}
@@ -25,19 +25,37 @@ namespace emitters
         ir,
         bitcode,
         assembly,
+        objectCode,
         cHeader,
         swigInterface
     };
 
+    /// <summary> How much whole-module optimization to run after the map has been emitted. </summary>
+    enum class ModuleOptimizationLevel
+    {
+        none, // only the per-function passes run as each function is completed
+        standard, // module-level cleanup passes at the default inlining threshold
+        aggressive // internalize non-API symbols and inline the per-node functions into the map function
+    };
+
     /// <summary> Standard compiler switches. </summary>
     struct CompilerParameters
     {
         bool unrollLoops = false;
+        size_t unrollLimit = 0; // when unrollLoops is on, vectors longer than this are emitted as loops anyway (0 == no limit); keeps unrolling from inflating code size on wide ports
         bool inlineOperators = true;
         bool useBlas = false;
         bool useHalide = false;
+        bool useFastMath = false;
+        bool useBranchlessSelects = false; // compile scalar multiplexers (decision-tree splits) as predicated select instructions, speculatively evaluating both arms; trades a little extra arithmetic for no branch mispredicts on forest-heavy maps
+        bool useSharedExecutionEngine = false; // jit this map in the single process-shared execution engine (IRSharedExecutionEngine) instead of building a private LLVM backend per map; saves backend init time and memory when a process runs many maps
+        bool useSharedKernelLibrary = false; // link the runtime kernels (dot products, softmax, pooling windows) to the per-process precompiled copy in IRKernelLibrary instead of emitting them into this module; only valid for modules that run in this process's JIT
         bool optimize = true;
         bool includeDiagnosticInfo = false;
+        bool patchableWeights = false; // emit model constants as writable globals in a versioned weight segment, so new weights can be swapped in without recompiling
+        bool useFixedPoint = false; // emit Q-format integer arithmetic instead of float ops, for FPU-less targets; requires calibrated per-port formats
+        int fixedPointWordBits = 32; // the width of the fixed-point representation
+        std::string tuningDatabaseFilename = ""; // optional kernel tuning entries merged over the shipped per-device defaults
 
         TargetDevice targetDevice;
     };
@@ -10,13 +10,59 @@
 #include "EmitterException.h"
 
 // stl
-#include <unordered_map>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace ell
 {
 namespace emitters
 {
-    ///<summary>A table for managing compiler symbols: named values</summary>
+    /// <summary> Hashes a symbol name. The result is never zero, which the symbol table reserves
+    /// for empty slots. </summary>
+    ///
+    /// <param name="name"> The symbol name. </param>
+    ///
+    /// <returns> The hash of the name. </returns>
+    inline size_t HashSymbolName(const std::string& name)
+    {
+        // FNV-1a
+        size_t hash = static_cast<size_t>(14695981039346656037ull);
+        for (auto c : name)
+        {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= static_cast<size_t>(1099511628211ull);
+        }
+        return hash == 0 ? 1 : hash;
+    }
+
+    ///<summary>A symbol name with its hash computed once up front. Emitters that look the same
+    /// name up in several tables (or look it up repeatedly) intern it first, so the tables compare
+    /// integers and only fall back to string comparison on a hash match.</summary>
+    class InternedSymbol
+    {
+    public:
+        /// <summary> Interns a symbol name. </summary>
+        ///
+        /// <param name="name"> The symbol name. </param>
+        InternedSymbol(const std::string& name)
+            : _name(name), _hash(HashSymbolName(name)) {}
+
+        /// <summary> Gets the symbol's name. </summary>
+        const std::string& GetName() const { return _name; }
+
+        /// <summary> Gets the symbol's precomputed hash. </summary>
+        size_t GetHash() const { return _hash; }
+
+    private:
+        std::string _name;
+        size_t _hash;
+    };
+
+    ///<summary>A table for managing compiler symbols: named values. Implemented as an
+    /// open-addressing hash table with robin-hood probing, so lookups touch a few contiguous
+    /// slots instead of chasing bucket chains.</summary>
     template <class ValueType, ValueType DefaultValue = ValueType(0)>
     class SymbolTable
     {
@@ -38,12 +84,25 @@ namespace emitters
         /// <returns> The symbol associated with the name. </returns>
         ValueType Get(const std::string& name) const;
 
+        /// <summary> Get a symbol's value from an interned symbol, else return the default. </summary>
+        ///
+        /// <param name="symbol"> The interned symbol. </param>
+        ///
+        /// <returns> The symbol associated with the name. </returns>
+        ValueType Get(const InternedSymbol& symbol) const;
+
         /// <summary> Adds a new symbol ot the symbol table. </summary>
         ///
         /// <param name="name"> The name of the symbol. </param>
         /// <param name="value"> The value of the symbol. </param>
         void Add(const std::string& name, ValueType value);
 
+        /// <summary> Adds a new symbol ot the symbol table. </summary>
+        ///
+        /// <param name="symbol"> The interned symbol. </param>
+        /// <param name="value"> The value of the symbol. </param>
+        void Add(const InternedSymbol& symbol, ValueType value);
+
         /// <summary> Gets a unique name from a prefix. </summary>
         ///
         /// <param name="namePrefix"> The name prefix. </param>
@@ -58,6 +117,13 @@ namespace emitters
         /// <returns> true if the symbol is in this table, false if not. </returns>
         bool Contains(const std::string& name) const;
 
+        /// <summary> Returns true if the table contains the given interned symbol. </summary>
+        ///
+        /// <param name="symbol"> The interned symbol. </param>
+        ///
+        /// <returns> true if the symbol is in this table, false if not. </returns>
+        bool Contains(const InternedSymbol& symbol) const;
+
         /// <summary> Remove a symbol with a given name from the symbol table. </summary>
         ///
         /// <param name="name"> The symbol name. </param>
@@ -67,7 +133,20 @@ namespace emitters
         void Clear();
 
     private:
-        std::unordered_map<std::string, ValueType> _map;
+        struct Slot
+        {
+            size_t hash = 0; // 0 == empty slot
+            std::string name;
+            ValueType value = DefaultValue;
+        };
+
+        size_t FindSlot(size_t hash, const std::string& name) const; // returns _slots.size() if not found
+        void Insert(size_t hash, std::string name, ValueType value);
+        size_t ProbeDistance(size_t hash, size_t slotIndex) const;
+        void GrowIfNeeded();
+
+        std::vector<Slot> _slots;
+        size_t _count = 0;
     };
 }
 }
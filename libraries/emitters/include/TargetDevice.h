@@ -9,6 +9,7 @@
 #pragma once
 
 // stl
+#include <algorithm>
 #include <string>
 
 namespace ell
@@ -25,6 +26,33 @@ namespace emitters
         std::string cpu = "";
         std::string features = "";
         size_t numBits = 0;
+        size_t numThreads = 1; // number of worker threads parallel loops may use (1 == emit serial code)
+        bool freestanding = false; // no hosted OS services: the clock resolves to an external C shim the
+                                   // firmware provides, and scratch memory comes from a static arena
+                                   // instead of malloc (see IRRuntime)
+        size_t freestandingArenaSize = 1 << 16; // size, in bytes, of the static scratch arena emitted for freestanding targets
     };
+
+    /// <summary> Gets the preferred SIMD width, in elements, for loops over elements of the given size on the device. </summary>
+    ///
+    /// <param name="device"> The target device. </param>
+    /// <param name="elementSizeInBytes"> The size of the loop's element type, in bytes. </param>
+    ///
+    /// <returns> The number of elements that fit in one of the device's vector registers. </returns>
+    inline size_t GetPreferredVectorWidth(const TargetDevice& device, size_t elementSizeInBytes)
+    {
+        // vector register width in bytes for the device's SIMD extension; SSE2 and NEON are both 128-bit,
+        // so that's the default when the features string doesn't say otherwise
+        size_t registerBytes = 16;
+        if (device.features.find("avx512") != std::string::npos)
+        {
+            registerBytes = 64;
+        }
+        else if (device.features.find("avx") != std::string::npos)
+        {
+            registerBytes = 32;
+        }
+        return std::max<size_t>(registerBytes / elementSizeInBytes, 1);
+    }
 }
 }
@@ -0,0 +1,52 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     TargetTuning.h (emitters)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "TargetDevice.h"
+
+// stl
+#include <string>
+
+namespace ell
+{
+namespace emitters
+{
+    /// <summary> Per-device tuning parameters for emitted kernels. </summary>
+    struct KernelTuningParameters
+    {
+        size_t gemmColumnBlockSize = 0; // cache block for the column loop of emitted (non-BLAS) GEMM; 0 == unblocked
+        size_t gemmUnrollFactor = 0; // unroll hint for the GEMM inner (reduction) loop; 0 == leave it to the optimizer
+        size_t convolutionFilterBatchSize = 0; // filters processed per scratch-buffer pass in diagonal convolution; 0 == all at once
+        size_t gemmRowTileSize = 0; // rows of the output computed per register tile in the packed GEMM kernel; 0 == use the untiled kernel
+        size_t gemmKBlockSize = 0; // reduction block packed into the kernel's stack panel; 0 == pack the whole reduction at once
+        size_t prefetchDistance = 0; // iterations ahead to software-prefetch in large-stride tensor walks the hardware prefetcher can't follow; 0 == emit no prefetches
+    };
+
+    /// <summary> Looks up the tuning parameters for a target device. </summary>
+    ///
+    /// Entries are matched against the device's name, then its cpu, then its architecture;
+    /// if none match, built-in defaults are returned.
+    ///
+    /// <param name="device"> The target device. </param>
+    ///
+    /// <returns> The tuning parameters to use for the device. </returns>
+    KernelTuningParameters GetKernelTuningParameters(const TargetDevice& device);
+
+    /// <summary> Merges tuning entries from a file over the shipped defaults. </summary>
+    ///
+    /// Each non-comment line of the file is one entry:
+    ///
+    ///     &lt;profile&gt; &lt;gemmColumnBlockSize&gt; &lt;gemmUnrollFactor&gt; &lt;convolutionFilterBatchSize&gt; &lt;gemmRowTileSize&gt; &lt;gemmKBlockSize&gt; &lt;prefetchDistance&gt;
+    ///
+    /// where profile is a device name, cpu, or architecture. Lines starting with '#' are ignored.
+    ///
+    /// <param name="filename"> Path to the tuning database file. </param>
+    void LoadKernelTuningDatabase(const std::string& filename);
+}
+}
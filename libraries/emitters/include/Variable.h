@@ -168,6 +168,9 @@ namespace emitters
         /// <summary> Add a reference to vector element </summary>
         Variable* AddVectorElementVariable(VariableType type, Variable& src, int offset);
 
+        /// <summary> Add a reference to a range of elements inside a vector </summary>
+        Variable* AddVectorRefVariable(VariableType type, Variable& src, int offset, int size);
+
     private:
         std::vector<std::shared_ptr<Variable>> _variables;
     };
@@ -58,6 +58,25 @@ namespace emitters
         std::vector<ElementType> _initialData;
     };
 
+    /// <summary> A vector variable that refers to a range of elements inside another vector variable </summary>
+    template <typename T>
+    class VectorRefVariable : public VectorVariable<T>
+    {
+    public:
+        /// <summary> Create a new reference to size elements of the source vector, starting at the given offset </summary>
+        VectorRefVariable(Variable& src, int offset, int size);
+
+        /// <summary> The source vector this is an offset into </summary>
+        Variable& Src() const { return _src; }
+
+        /// <summary> Offset into the source vector </summary>
+        int Offset() const { return _offset; }
+
+    private:
+        Variable& _src;
+        int _offset;
+    };
+
     /// <summary>
     /// A vector variable that is typically emitted as a static const or global - depending on the language
     /// </summary>
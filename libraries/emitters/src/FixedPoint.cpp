@@ -0,0 +1,64 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     FixedPoint.cpp (emitters)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "FixedPoint.h"
+
+// stl
+#include <algorithm>
+#include <cmath>
+
+namespace ell
+{
+namespace emitters
+{
+    double QFormat::Scale() const
+    {
+        return std::ldexp(1.0, fractionalBits);
+    }
+
+    int64_t QFormat::MaxQuantized() const
+    {
+        return (int64_t{ 1 } << (wordBits - 1)) - 1;
+    }
+
+    int64_t QFormat::MinQuantized() const
+    {
+        return -(int64_t{ 1 } << (wordBits - 1));
+    }
+
+    int64_t QFormat::Quantize(double value) const
+    {
+        double scaled = std::round(value * Scale());
+        scaled = std::min(scaled, static_cast<double>(MaxQuantized()));
+        scaled = std::max(scaled, static_cast<double>(MinQuantized()));
+        return static_cast<int64_t>(scaled);
+    }
+
+    double QFormat::Dequantize(int64_t quantizedValue) const
+    {
+        return static_cast<double>(quantizedValue) / Scale();
+    }
+
+    QFormat QFormat::FromRange(double minValue, double maxValue, int wordBits)
+    {
+        double magnitude = std::max(std::abs(minValue), std::abs(maxValue));
+
+        // number of bits needed to the left of the binary point (at least one, plus the sign bit)
+        int integerBits = 1;
+        if (magnitude >= 1.0)
+        {
+            integerBits = static_cast<int>(std::floor(std::log2(magnitude))) + 2;
+        }
+
+        QFormat format;
+        format.wordBits = wordBits;
+        format.fractionalBits = std::max(wordBits - 1 - integerBits, 0);
+        return format;
+    }
+}
+}
@@ -0,0 +1,91 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     HardwareCounters.cpp (emitters)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "HardwareCounters.h"
+
+#if defined(__linux__)
+
+#include <cstring>
+
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace
+{
+// A single perf_event hardware counter for the calling thread. Opened lazily on first read and kept
+// open for the lifetime of the process. If the counter can't be opened (no permissions, counters not
+// supported by the kernel or hardware), reads return 0.
+class PerfEventCounter
+{
+public:
+    PerfEventCounter(uint64_t config)
+    {
+        perf_event_attr attributes;
+        std::memset(&attributes, 0, sizeof(attributes));
+        attributes.type = PERF_TYPE_HARDWARE;
+        attributes.size = sizeof(attributes);
+        attributes.config = config;
+        attributes.exclude_kernel = 1;
+        attributes.exclude_hv = 1;
+        _fd = static_cast<int>(syscall(__NR_perf_event_open, &attributes, 0, -1, -1, 0));
+    }
+
+    ~PerfEventCounter()
+    {
+        if (_fd >= 0)
+        {
+            close(_fd);
+        }
+    }
+
+    int64_t Read() const
+    {
+        if (_fd < 0)
+        {
+            return 0;
+        }
+
+        int64_t value = 0;
+        if (read(_fd, &value, sizeof(value)) != sizeof(value))
+        {
+            return 0;
+        }
+        return value;
+    }
+
+private:
+    int _fd = -1;
+};
+}
+
+int64_t ELL_GetCacheMissCount()
+{
+    static PerfEventCounter counter(PERF_COUNT_HW_CACHE_MISSES);
+    return counter.Read();
+}
+
+int64_t ELL_GetBranchMissCount()
+{
+    static PerfEventCounter counter(PERF_COUNT_HW_BRANCH_MISSES);
+    return counter.Read();
+}
+
+#else
+
+int64_t ELL_GetCacheMissCount()
+{
+    return 0;
+}
+
+int64_t ELL_GetBranchMissCount()
+{
+    return 0;
+}
+
+#endif
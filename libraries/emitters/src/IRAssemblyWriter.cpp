@@ -35,6 +35,10 @@
 
 #include "llvm/Pass.h"
 
+#include "llvm/Object/ObjectFile.h"
+#include "llvm/Object/SymbolSize.h"
+
+#include "llvm/Support/Error.h"
 #include "llvm/Support/Host.h"
 #include "llvm/Support/TargetRegistry.h"
 #include "llvm/Support/TargetSelect.h"
@@ -43,7 +47,9 @@
 #include "llvm/Target/TargetMachine.h"
 
 // stl
+#include <algorithm>
 #include <functional>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -92,6 +98,26 @@ namespace emitters
             options.MCOptions.PreserveAsmComments = true; // Note: not the default
             return options;
         }
+
+        // Recover the node type from a compiled node function's symbol name. Node functions are
+        // named "_Node__<node type>_in_..._out_..." (see CompilableNode::GetCompiledFunctionName);
+        // anything else is reported under its own symbol name.
+        std::string GetNodeTypeFromFunctionName(const std::string& functionName)
+        {
+            const std::string nodeFunctionPrefix = "_Node__";
+            if (functionName.compare(0, nodeFunctionPrefix.size(), nodeFunctionPrefix) != 0)
+            {
+                return functionName;
+            }
+
+            auto nodeType = functionName.substr(nodeFunctionPrefix.size());
+            auto portSuffix = nodeType.find("_in_");
+            if (portSuffix != std::string::npos)
+            {
+                nodeType = nodeType.substr(0, portSuffix);
+            }
+            return nodeType;
+        }
     }
 
     //
@@ -192,5 +218,88 @@ namespace emitters
         // Write memory buffer to our output stream
         os << buffer;
     }
+
+    //
+    // Code size reporting
+    //
+
+    CodeSizeReport GetCodeSizeReport(IRModuleEmitter& moduleEmitter, const MachineCodeOutputOptions& options)
+    {
+        // generate object code into a memory buffer and read the function symbol sizes back out
+        llvm::SmallVector<char, 0> buffer;
+        llvm::raw_svector_ostream bufferedStream(buffer);
+        GenerateMachineCode(bufferedStream, moduleEmitter, OutputFileType::CGFT_ObjectFile, options);
+
+        llvm::MemoryBufferRef bufferRef(llvm::StringRef(buffer.data(), buffer.size()), moduleEmitter.GetLLVMModule()->getName());
+        auto objectFile = llvm::object::ObjectFile::createObjectFile(bufferRef);
+        if (!objectFile)
+        {
+            llvm::consumeError(objectFile.takeError());
+            throw EmitterException(EmitterError::unexpected, "Couldn't parse the emitted object code");
+        }
+
+        CodeSizeReport report;
+        std::map<std::string, CodeSizeEntry> groups;
+        for (const auto& symbolSize : llvm::object::computeSymbolSizes(*(objectFile.get())))
+        {
+            auto symbol = symbolSize.first;
+            auto symbolType = symbol.getType();
+            if (!symbolType)
+            {
+                llvm::consumeError(symbolType.takeError());
+                continue;
+            }
+            if (symbolType.get() != llvm::object::SymbolRef::ST_Function)
+            {
+                continue;
+            }
+
+            auto symbolName = symbol.getName();
+            if (!symbolName)
+            {
+                llvm::consumeError(symbolName.takeError());
+                continue;
+            }
+
+            auto groupName = GetNodeTypeFromFunctionName(symbolName.get().str());
+            auto& entry = groups[groupName];
+            entry.name = groupName;
+            entry.numFunctions += 1;
+            entry.size += symbolSize.second;
+            report.totalSize += symbolSize.second;
+        }
+
+        report.entries.reserve(groups.size());
+        for (const auto& group : groups)
+        {
+            report.entries.push_back(group.second);
+        }
+        std::sort(report.entries.begin(), report.entries.end(), [](const CodeSizeEntry& a, const CodeSizeEntry& b) { return a.size > b.size; });
+        return report;
+    }
+
+    void WriteCodeSizeReport(std::ostream& os, IRModuleEmitter& moduleEmitter, const MachineCodeOutputOptions& options, size_t codeSizeBudget)
+    {
+        auto report = GetCodeSizeReport(moduleEmitter, options);
+
+        os << "Code size by node type:\n";
+        for (const auto& entry : report.entries)
+        {
+            os << "  " << entry.name << ": " << entry.size << " bytes in " << entry.numFunctions << (entry.numFunctions == 1 ? " function\n" : " functions\n");
+        }
+        os << "Total function code: " << report.totalSize << " bytes\n";
+
+        if (codeSizeBudget != 0)
+        {
+            if (report.totalSize > codeSizeBudget)
+            {
+                os << "Over the " << codeSizeBudget << "-byte budget by " << (report.totalSize - codeSizeBudget) << " bytes\n";
+            }
+            else
+            {
+                os << "Within the " << codeSizeBudget << "-byte budget, with " << (codeSizeBudget - report.totalSize) << " bytes to spare\n";
+            }
+        }
+    }
 }
 }
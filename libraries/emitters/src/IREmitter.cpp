@@ -149,11 +149,12 @@ namespace emitters
 
     llvm::Value* IREmitter::Literal(const std::string& value)
     {
-        llvm::Value* literal = _stringLiterals.Get(value);
+        InternedSymbol symbol(value); // hash once for the lookup and the (possible) insert
+        llvm::Value* literal = _stringLiterals.Get(symbol);
         if (literal == nullptr)
         {
             literal = _irBuilder.CreateGlobalStringPtr(value);
-            _stringLiterals.Add(value, literal);
+            _stringLiterals.Add(symbol, literal);
         }
         return literal;
     }
@@ -697,6 +698,19 @@ namespace emitters
         }
     }
 
+    void IREmitter::SetFastMathFlags(bool enable)
+    {
+        llvm::FastMathFlags flags;
+        if (enable)
+        {
+            // this LLVM version has no separate reassociation or contraction bits - unsafe-algebra
+            // is the whole package, including the no-NaNs and no-infinities assumptions; that is
+            // why numerically sensitive node types can opt out per node
+            flags.setUnsafeAlgebra();
+        }
+        _irBuilder.setFastMathFlags(flags);
+    }
+
     //
     // Calling functions
     //
@@ -743,6 +757,15 @@ namespace emitters
         return _irBuilder.CreateMemSet(pDestination, value, size, 0, true);
     }
 
+    llvm::CallInst* IREmitter::Prefetch(llvm::Module* pModule, llvm::Value* pAddress, bool forWrite, int locality)
+    {
+        assert(pModule != nullptr);
+        assert(pAddress != nullptr);
+        auto pPrefetchFunction = llvm::Intrinsic::getDeclaration(pModule, llvm::Intrinsic::prefetch);
+        auto pByteAddress = Cast(pAddress, VariableType::BytePointer);
+        return _irBuilder.CreateCall(pPrefetchFunction, { pByteAddress, Literal(forWrite ? 1 : 0), Literal(locality), Literal(1) }); // last argument: 1 == data cache
+    }
+
     llvm::Function* IREmitter::GetIntrinsic(llvm::Module* pModule, llvm::Intrinsic::ID id, const ValueTypeList& arguments)
     {
         assert(pModule != nullptr);
@@ -8,6 +8,7 @@
 
 #include "IRExecutionEngine.h"
 #include "IRModuleEmitter.h"
+#include "IRSharedExecutionEngine.h"
 
 // llvm
 #include "llvm/Support/TargetSelect.h"
@@ -26,13 +27,22 @@ namespace emitters
         throw emitters::EmitterException(emitters::EmitterError::unexpected, msg);
     }
 
-    IRExecutionEngine::IRExecutionEngine(IRModuleEmitter&& module)
-        : IRExecutionEngine(module.TransferOwnership())
+    IRExecutionEngine::IRExecutionEngine(IRModuleEmitter&& module, bool useSharedEngine)
+        : IRExecutionEngine(module.TransferOwnership(), useSharedEngine)
     {
     }
 
-    IRExecutionEngine::IRExecutionEngine(std::unique_ptr<llvm::Module> pModule)
+    IRExecutionEngine::IRExecutionEngine(std::unique_ptr<llvm::Module> pModule, bool useSharedEngine)
+        : _useSharedEngine(useSharedEngine)
     {
+        if (_useSharedEngine)
+        {
+            // this instance is just a view onto the process-shared engine: register the module
+            // there and route all lookups through its handle
+            _sharedModuleHandle = IRSharedExecutionEngine::GetInstance().AddModule(std::move(pModule));
+            return;
+        }
+
         llvm::InitializeNativeTarget();
         llvm::InitializeNativeTargetAsmPrinter();
 
@@ -48,8 +58,21 @@ namespace emitters
         }
     }
 
+    IRExecutionEngine::~IRExecutionEngine()
+    {
+        if (_useSharedEngine)
+        {
+            IRSharedExecutionEngine::GetInstance().RemoveModule(_sharedModuleHandle);
+        }
+    }
+
     void IRExecutionEngine::SelectTarget(const llvm::Triple& targetTriple, const std::string& cpuArchitecture, const std::string& cpuName, const std::vector<std::string>& attributes)
     {
+        if (_useSharedEngine)
+        {
+            // the shared engine always targets the host
+            throw EmitterException(EmitterError::notSupported, "cannot select a target on a shared-engine view");
+        }
         llvm::SmallVector<std::string, 4> attrs;
         for (auto attribute : attributes)
         {
@@ -61,12 +84,37 @@ namespace emitters
     void IRExecutionEngine::AddModule(std::unique_ptr<llvm::Module> pModule)
     {
         assert(pModule != nullptr);
+        if (_useSharedEngine)
+        {
+            // a shared-engine view fronts exactly one module; additional modules get their own view
+            throw EmitterException(EmitterError::notSupported, "cannot add modules to a shared-engine view");
+        }
         EnsureEngine();
         _pEngine->addModule(std::move(pModule));
     }
 
+    bool IRExecutionEngine::RemoveModule(llvm::Module* pModule)
+    {
+        assert(pModule != nullptr);
+        if (_pEngine == nullptr)
+        {
+            return false;
+        }
+        if (_pEngine->removeModule(pModule))
+        {
+            // the engine returns ownership of the removed module
+            delete pModule;
+            return true;
+        }
+        return false;
+    }
+
     uint64_t IRExecutionEngine::GetFunctionAddress(const std::string& name)
     {
+        if (_useSharedEngine)
+        {
+            return IRSharedExecutionEngine::GetInstance().GetFunctionAddress(_sharedModuleHandle, name);
+        }
         EnsureEngine();
         return _pEngine->getFunctionAddress(name);
     }
@@ -198,6 +198,33 @@ namespace emitters
         return Operator(type, l, r);
     }
 
+    llvm::Value* IRFunctionEmitter::FixedPointMultiply(llvm::Value* pLeftValue, llvm::Value* pRightValue, int fractionalBits, int wordBits)
+    {
+        // widen to 64 bits so the full product is available before shifting the binary point back
+        auto left = CastValue<int, int64_t>(pLeftValue);
+        auto right = CastValue<int, int64_t>(pRightValue);
+        auto product = Operator(TypedOperator::multiply, left, right);
+        auto shifted = Operator(TypedOperator::arithmeticShiftRight, product, Literal(static_cast<int64_t>(fractionalBits)));
+        return FixedPointSaturate(shifted, wordBits);
+    }
+
+    llvm::Value* IRFunctionEmitter::FixedPointAdd(llvm::Value* pLeftValue, llvm::Value* pRightValue, int wordBits)
+    {
+        auto left = CastValue<int, int64_t>(pLeftValue);
+        auto right = CastValue<int, int64_t>(pRightValue);
+        auto sum = Operator(TypedOperator::add, left, right);
+        return FixedPointSaturate(sum, wordBits);
+    }
+
+    llvm::Value* IRFunctionEmitter::FixedPointSaturate(llvm::Value* pValue, int wordBits)
+    {
+        int64_t maxValue = (int64_t{ 1 } << (wordBits - 1)) - 1;
+        int64_t minValue = -(int64_t{ 1 } << (wordBits - 1));
+        auto clampedHigh = Select(Comparison(TypedComparison::greaterThan, pValue, Literal(maxValue)), Literal(maxValue), pValue);
+        auto clamped = Select(Comparison(TypedComparison::lessThan, clampedHigh, Literal(minValue)), Literal(minValue), clampedHigh);
+        return CastValue<int64_t, int>(clamped);
+    }
+
     void IRFunctionEmitter::VectorOperator(TypedOperator type, size_t size, llvm::Value* pLeftValue, llvm::Value* pRightValue, std::function<void(llvm::Value*, llvm::Value*)> aggregator)
     {
         assert(pLeftValue != nullptr);
@@ -525,8 +552,8 @@ namespace emitters
         EntryBlockScope scope(*this);
 
         // don't do this for emitted variables!
-        auto name = _locals.GetUniqueName(namePrefix);
-        auto result = _pEmitter->StackAllocate(type, name);
+        InternedSymbol name(_locals.GetUniqueName(namePrefix));
+        auto result = _pEmitter->StackAllocate(type, name.GetName());
         _locals.Add(name, result);
         return result;
     }
@@ -534,8 +561,8 @@ namespace emitters
     llvm::AllocaInst* IRFunctionEmitter::Variable(llvm::Type* type, const std::string& namePrefix)
     {
         EntryBlockScope scope(*this);
-        auto name = _locals.GetUniqueName(namePrefix);
-        auto result = _pEmitter->StackAllocate(type, name);
+        InternedSymbol name(_locals.GetUniqueName(namePrefix));
+        auto result = _pEmitter->StackAllocate(type, name.GetName());
         _locals.Add(name, result);
         return result;
     }
@@ -728,6 +755,77 @@ namespace emitters
         return IRForLoopEmitter(*this);
     }
 
+    void IRFunctionEmitter::ParallelFor(int count, const std::vector<llvm::Value*>& capturedValues, std::function<void(IRFunctionEmitter&, llvm::Value*, const std::vector<llvm::Value*>&)> body)
+    {
+        auto& module = GetModule();
+        int numThreads = static_cast<int>(module.GetCompilerParameters().targetDevice.numThreads);
+        if (numThreads <= 1 || count < 2)
+        {
+            // Emit an ordinary loop in place
+            auto loop = ForLoop();
+            loop.Begin(count);
+            {
+                body(*this, loop.LoadIterationVariable(), capturedValues);
+            }
+            loop.End();
+            return;
+        }
+
+        auto& context = GetLLVMContext();
+        auto& irBuilder = GetEmitter().GetIRBuilder();
+        auto int32Type = llvm::Type::getInt32Ty(context);
+        auto voidType = llvm::Type::getVoidTy(context);
+        auto bytePtrType = llvm::Type::getInt8PtrTy(context);
+
+        // Find an unused name for the task function
+        std::string baseName = module.GetModuleName() + "_ParallelForTask";
+        std::string taskFunctionName = baseName;
+        int nameSuffix = 1;
+        while (module.GetFunction(taskFunctionName) != nullptr)
+        {
+            taskFunctionName = baseName + std::to_string(nameSuffix++);
+        }
+
+        // Emit the task function: it runs the body over its [begin, end) slice, reading the
+        // captured values back out of the context block
+        auto taskFunction = module.BeginFunction(taskFunctionName, voidType, std::vector<llvm::Type*>{ int32Type, int32Type, bytePtrType });
+        {
+            auto arguments = taskFunction.Arguments().begin();
+            llvm::Argument& sliceBegin = *arguments++;
+            llvm::Argument& sliceEnd = *arguments++;
+            llvm::Argument& taskContext = *arguments++;
+
+            auto taskContextArray = irBuilder.CreateBitCast(&taskContext, bytePtrType->getPointerTo());
+            std::vector<llvm::Value*> taskCapturedValues;
+            for (size_t index = 0; index < capturedValues.size(); ++index)
+            {
+                auto capturedValue = taskFunction.ValueAt(taskContextArray, static_cast<int>(index));
+                taskCapturedValues.push_back(irBuilder.CreateBitCast(capturedValue, capturedValues[index]->getType()));
+            }
+
+            auto sliceSize = taskFunction.Operator(TypedOperator::subtract, &sliceEnd, &sliceBegin);
+            auto loop = taskFunction.ForLoop();
+            loop.Begin(sliceSize);
+            {
+                auto index = taskFunction.Operator(TypedOperator::add, &sliceBegin, loop.LoadIterationVariable());
+                body(taskFunction, index, taskCapturedValues);
+            }
+            loop.End();
+            taskFunction.Return();
+        }
+        module.EndFunction();
+
+        // Pack the captured values into a context block and hand the range to the runtime
+        int numCapturedValues = static_cast<int>(capturedValues.size());
+        auto contextArray = Variable(VariableType::BytePointer, numCapturedValues == 0 ? 1 : numCapturedValues);
+        for (int index = 0; index < numCapturedValues; ++index)
+        {
+            SetValueAt(contextArray, index, irBuilder.CreateBitCast(capturedValues[index], bytePtrType));
+        }
+        auto taskContext = irBuilder.CreateBitCast(contextArray, bytePtrType);
+        Call(module.GetRuntime().GetParallelForFunction(), { Literal(0), Literal(count), Literal(numThreads), taskContext, taskFunction.GetFunction() });
+    }
+
     IRIfEmitter IRFunctionEmitter::If()
     {
         return IRIfEmitter(*this);
@@ -752,12 +850,23 @@ namespace emitters
 
     llvm::Value* IRFunctionEmitter::Malloc(VariableType type, int64_t size)
     {
+        if (GetModule().GetCompilerParameters().targetDevice.freestanding)
+        {
+            // freestanding targets have no heap; scratch memory comes from the module's static arena
+            auto allocateFunction = GetModule().GetRuntime().GetArenaAllocateFunction();
+            return Cast(Call(allocateFunction, { Literal(size) }), type);
+        }
         IRValueList arguments = { Literal(size) };
         return Cast(Call(MallocFnName, arguments), type);
     }
 
     void IRFunctionEmitter::Free(llvm::Value* pValue)
     {
+        if (GetModule().GetCompilerParameters().targetDevice.freestanding)
+        {
+            // arena allocations live for the lifetime of the module; frees are no-ops
+            return;
+        }
         Call(FreeFnName, Cast(pValue, VariableType::BytePointer));
     }
 
@@ -779,6 +888,12 @@ namespace emitters
         return Call(PrintfFnName, callArgs);
     }
 
+    void IRFunctionEmitter::Prefetch(llvm::Value* pPointer, llvm::Value* pOffset, bool forWrite)
+    {
+        // locality hint 3: the prefetched line is about to be used, so keep it resident
+        _pEmitter->Prefetch(GetLLVMModule(), PointerOffset(pPointer, pOffset), forWrite, 3);
+    }
+
     void IRFunctionEmitter::PrintForEach(const std::string& formatString, llvm::Value* pVector, int size)
     {
         llvm::Value* pFormat = Literal(formatString);
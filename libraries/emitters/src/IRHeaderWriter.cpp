@@ -243,6 +243,26 @@ namespace emitters
                 }
             }
 
+            // Declare the pooled constants shared across modules (see IRModuleEmitter::SharedConstantArray),
+            // so deployments can reference one blob from several compiled maps
+            bool wroteSharedConstantsComment = false;
+            for (auto& global : pModule->globals())
+            {
+                if (global.isConstant() && global.hasLinkOnceODRLinkage() && global.hasName() && global.getValueType()->isArrayTy())
+                {
+                    if (!wroteSharedConstantsComment)
+                    {
+                        os << "\n";
+                        os << "//\n// Shared constants\n//\n\n";
+                        wroteSharedConstantsComment = true;
+                    }
+                    std::string globalName = global.getName();
+                    os << "extern const ";
+                    WriteLLVMVariableDeclaration(os, global.getValueType(), globalName);
+                    os << ";\n";
+                }
+            }
+
             os << "\n";
             os << "//\n// Functions\n//\n\n";
             // Now write out function signatures
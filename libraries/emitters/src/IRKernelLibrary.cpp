@@ -0,0 +1,69 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     IRKernelLibrary.cpp (emitters)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "IRKernelLibrary.h"
+#include "IRExecutionEngine.h"
+#include "IRModuleEmitter.h"
+
+// llvm
+#include "llvm/Support/DynamicLibrary.h"
+
+// stl
+#include <vector>
+
+namespace ell
+{
+namespace emitters
+{
+    // The kernel module's name doubles as the namespace prefix of every kernel it emits, so the
+    // published symbols come out as e.g. "ELL_DotProductF"
+    static const std::string& c_kernelModuleName = "ELL";
+
+    IRKernelLibrary& IRKernelLibrary::GetInstance()
+    {
+        static IRKernelLibrary instance;
+        return instance;
+    }
+
+    std::string IRKernelLibrary::GetKernelSymbolName(const std::string& kernelName)
+    {
+        return c_kernelModuleName + "_" + kernelName;
+    }
+
+    void IRKernelLibrary::EnsureCompiled()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_pEngine != nullptr)
+        {
+            return;
+        }
+
+        // Emit the canonical kernels into a module of their own. The module's compiler parameters
+        // are the defaults, so its runtime emits real kernel bodies rather than declarations.
+        IRModuleEmitter module(c_kernelModuleName);
+        auto& runtime = module.GetRuntime();
+        std::vector<std::string> kernelNames;
+        kernelNames.push_back(runtime.GetDotProductFunction<int>()->getName().str());
+        kernelNames.push_back(runtime.GetDotProductFunction<double>()->getName().str());
+        kernelNames.push_back(runtime.GetSoftmaxFunction<float>()->getName().str());
+        kernelNames.push_back(runtime.GetSoftmaxFunction<double>()->getName().str());
+        kernelNames.push_back(runtime.GetMaxPoolWindowFunction<float>()->getName().str());
+        kernelNames.push_back(runtime.GetMaxPoolWindowFunction<double>()->getName().str());
+
+        // JIT the module for the host, then publish each kernel's address so that the jitters of
+        // later map modules resolve their external kernel declarations to this one copy
+        auto pEngine = std::make_unique<IRExecutionEngine>(std::move(module));
+        for (const auto& kernelName : kernelNames)
+        {
+            auto address = pEngine->ResolveFunctionAddress(kernelName);
+            llvm::sys::DynamicLibrary::AddSymbol(kernelName, reinterpret_cast<void*>(address));
+        }
+        _pEngine = std::move(pEngine);
+    }
+}
+}
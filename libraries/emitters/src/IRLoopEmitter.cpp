@@ -8,6 +8,10 @@
 #include "IRLoopEmitter.h"
 #include "IRFunctionEmitter.h"
 
+// llvm
+#include "llvm/IR/Constants.h"
+#include "llvm/IR/Metadata.h"
+
 namespace ell
 {
 namespace emitters
@@ -27,6 +31,40 @@ namespace emitters
         _functionEmitter.SetCurrentBlock(_pAfterBlock);
     }
 
+    void IRForLoopEmitter::SetVectorizationHints(int vectorWidth, int unrollFactor)
+    {
+        assert(_pIncrementBlock != nullptr && "Vectorization hints must be set after Begin()");
+
+        auto& context = _functionEmitter.GetLLVMContext();
+        auto int32Type = llvm::Type::getInt32Ty(context);
+
+        // the first operand of the llvm.loop node is a self-reference, filled in below
+        std::vector<llvm::Metadata*> hints;
+        hints.push_back(nullptr);
+        if (vectorWidth > 0)
+        {
+            hints.push_back(llvm::MDNode::get(context, { llvm::MDString::get(context, "llvm.loop.vectorize.enable"),
+                                                         llvm::ConstantAsMetadata::get(llvm::ConstantInt::get(llvm::Type::getInt1Ty(context), 1)) }));
+            hints.push_back(llvm::MDNode::get(context, { llvm::MDString::get(context, "llvm.loop.vectorize.width"),
+                                                         llvm::ConstantAsMetadata::get(llvm::ConstantInt::get(int32Type, vectorWidth)) }));
+        }
+        if (unrollFactor > 0)
+        {
+            hints.push_back(llvm::MDNode::get(context, { llvm::MDString::get(context, "llvm.loop.unroll.count"),
+                                                         llvm::ConstantAsMetadata::get(llvm::ConstantInt::get(int32Type, unrollFactor)) }));
+        }
+        if (hints.size() == 1)
+        {
+            return; // nothing requested
+        }
+
+        auto loopMetadata = llvm::MDNode::get(context, hints);
+        loopMetadata->replaceOperandWith(0, loopMetadata);
+
+        // the hints go on the loop's latch branch (the back edge to the condition block)
+        _pIncrementBlock->getTerminator()->setMetadata("llvm.loop", loopMetadata);
+    }
+
     void IRForLoopEmitter::Clear()
     {
         _pInitializationBlock = nullptr;
@@ -59,6 +97,18 @@ namespace emitters
         return PrepareBody();
     }
 
+    llvm::BasicBlock* IRForLoopEmitter::Begin(llvm::Value* pStartAt, llvm::Value* pMaxValue, const int stepSize)
+    {
+        assert(pStartAt != nullptr);
+        assert(pMaxValue != nullptr);
+
+        CreateBlocks();
+        EmitIterationVariable(VariableType::Int32, pStartAt);
+        EmitCondition(TypedComparison::lessThan, pMaxValue);
+        EmitIncrement(VariableType::Int32, _functionEmitter.Literal(stepSize));
+        return PrepareBody();
+    }
+
     llvm::BasicBlock* IRForLoopEmitter::Begin(llvm::Value* pRepeatCount)
     {
         assert(pRepeatCount != nullptr);
@@ -13,6 +13,7 @@
 #include "IRExecutionEngine.h"
 #include "IRHeaderWriter.h"
 #include "IRLoader.h"
+#include "IRMetadata.h"
 #include "IRSwigInterfaceWriter.h"
 
 // utilities
@@ -28,6 +29,9 @@
 
 // stl
 #include <chrono>
+#include <cstdint>
+#include <sstream>
+#include <unordered_set>
 
 namespace ell
 {
@@ -355,6 +359,75 @@ namespace emitters
         return new llvm::GlobalVariable(*GetLLVMModule(), pType, isConst, llvm::GlobalValue::InternalLinkage, pInitial, name); // TODO: make sure we really want to return a new'd pointer
     }
 
+    llvm::GlobalVariable* IRModuleEmitter::SharedConstant(const std::string& name, llvm::Type* pType, llvm::Constant* pInitial)
+    {
+        // llvm uniques constants per context, so identical blobs arrive here with the same initializer pointer
+        auto search = _constantPool.find(pInitial);
+        if (search != _constantPool.end())
+        {
+            return search->second;
+        }
+
+        // linkonce_odr: when several modules linked into one binary pool the same blob under the
+        // same content-derived name, the linker keeps a single read-only copy
+        auto pGlobal = new llvm::GlobalVariable(*GetLLVMModule(), pType, true, llvm::GlobalValue::LinkOnceODRLinkage, pInitial, name);
+        _constantPool[pInitial] = pGlobal;
+        return pGlobal;
+    }
+
+    std::string IRModuleEmitter::ConstantPoolName(int typeId, const void* pData, size_t byteSize)
+    {
+        // FNV-1a over the payload: the name must be deterministic across modules, and keyed on the
+        // element type and size as well so unrelated blobs in one deployment can't alias
+        auto bytes = static_cast<const uint8_t*>(pData);
+        uint64_t hash = 0xcbf29ce484222325ULL;
+        for (size_t i = 0; i < byteSize; ++i)
+        {
+            hash = (hash ^ bytes[i]) * 0x100000001b3ULL;
+        }
+
+        std::stringstream name;
+        name << "c_pool_" << typeId << "_" << byteSize << "_" << std::hex << hash;
+        return name.str();
+    }
+
+    void IRModuleEmitter::RecordWeightsEntry(const std::string& name, llvm::GlobalVariable* pGlobal, size_t byteSize)
+    {
+        // the blob layout is the registration order, with each entry aligned to 8 bytes
+        size_t byteOffset = (_weightsSegmentSize + 7) & ~size_t{ 7 };
+        _weightsSegment.push_back({ name, pGlobal, byteOffset, byteSize });
+        _weightsSegmentSize = byteOffset + byteSize;
+    }
+
+    std::string IRModuleEmitter::GetWeightsVersion() const
+    {
+        if (!_weightsVersion.empty())
+        {
+            return _weightsVersion;
+        }
+
+        // no explicit version: derive one from the segment layout (FNV-1a over the entry names and
+        // sizes), so any change to the graph's weight structure changes the version
+        uint64_t hash = 0xcbf29ce484222325ULL;
+        auto mixIn = [&hash](const void* pData, size_t byteSize) {
+            auto bytes = static_cast<const uint8_t*>(pData);
+            for (size_t i = 0; i < byteSize; ++i)
+            {
+                hash = (hash ^ bytes[i]) * 0x100000001b3ULL;
+            }
+        };
+        for (const auto& entry : _weightsSegment)
+        {
+            mixIn(entry.name.data(), entry.name.size());
+            mixIn(&entry.byteOffset, sizeof(entry.byteOffset));
+            mixIn(&entry.byteSize, sizeof(entry.byteSize));
+        }
+
+        std::stringstream version;
+        version << "w_" << _weightsSegmentSize << "_" << std::hex << hash;
+        return version.str();
+    }
+
     //
     // Functions
     //
@@ -470,6 +543,7 @@ namespace emitters
             case ModuleOutputFormat::assembly:
             case ModuleOutputFormat::bitcode:
             case ModuleOutputFormat::ir:
+            case ModuleOutputFormat::objectCode:
             {
                 WriteToFile(filePath, format, options);
                 break;
@@ -499,7 +573,7 @@ namespace emitters
 
     void IRModuleEmitter::WriteToFile(const std::string& filePath, ModuleOutputFormat format, const MachineCodeOutputOptions& options)
     {
-        auto openFlags = (ModuleOutputFormat::ir == format) ? llvm::sys::fs::F_None : llvm::sys::fs::F_Text;
+        auto openFlags = (ModuleOutputFormat::ir == format || ModuleOutputFormat::objectCode == format) ? llvm::sys::fs::F_None : llvm::sys::fs::F_Text;
         std::error_code error;
         llvm::tool_output_file out(filePath, error, openFlags);
         if (error)
@@ -573,6 +647,10 @@ namespace emitters
             // TODO: fuse or replace options with compiler options
             GenerateMachineCode(os, *this, OutputFileType::CGFT_AssemblyFile, options);
         }
+        else if (ModuleOutputFormat::objectCode == format)
+        {
+            GenerateMachineCode(os, *this, OutputFileType::CGFT_ObjectFile, options);
+        }
         else
         {
             throw new EmitterException(EmitterError::notSupported);
@@ -612,6 +690,65 @@ namespace emitters
         optimizer.Run(GetLLVMModule());
     }
 
+    void IRModuleEmitter::Optimize(ModuleOptimizationLevel level)
+    {
+        if (level == ModuleOptimizationLevel::none)
+        {
+            return;
+        }
+
+        IRModuleOptimizer optimizer;
+        if (level == ModuleOptimizationLevel::aggressive)
+        {
+            InternalizeNonApiSymbols();
+            optimizer.AddAggressivePasses();
+        }
+        else
+        {
+            optimizer.AddStandardPasses();
+        }
+        Optimize(optimizer);
+    }
+
+    void IRModuleEmitter::InternalizeNonApiSymbols()
+    {
+        // Functions tagged for declaration in the generated header are the module's public API;
+        // everything else only exists to serve them. Giving the rest internal linkage lets the
+        // inliner absorb the single-call node functions and lets the interprocedural passes treat
+        // the port globals as local storage, forwarding each node's stores to the consuming
+        // node's loads. Patchable weight globals keep their linkage so they stay addressable by
+        // name from outside the module.
+        auto pModule = GetLLVMModule();
+        for (auto& function : *pModule)
+        {
+            if (function.isDeclaration() || function.hasLocalLinkage())
+            {
+                continue;
+            }
+            if (function.getMetadata(c_declareInHeaderTagName) == nullptr)
+            {
+                function.setLinkage(llvm::GlobalValue::InternalLinkage);
+            }
+        }
+
+        std::unordered_set<llvm::GlobalVariable*> weightsGlobals;
+        for (const auto& entry : _weightsSegment)
+        {
+            weightsGlobals.insert(entry.global);
+        }
+        for (auto& global : pModule->globals())
+        {
+            if (global.isDeclaration() || global.hasLocalLinkage())
+            {
+                continue;
+            }
+            if (weightsGlobals.find(&global) == weightsGlobals.end())
+            {
+                global.setLinkage(llvm::GlobalValue::InternalLinkage);
+            }
+        }
+    }
+
     //
     // Code execution
     //
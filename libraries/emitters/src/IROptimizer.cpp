@@ -11,6 +11,8 @@
 #include "LLVMInclude.h"
 
 // llvm
+#include "llvm/Transforms/IPO.h"
+#include "llvm/Transforms/IPO/PassManagerBuilder.h"
 #include "llvm/Transforms/Scalar.h"
 #include "llvm/Transforms/Scalar/GVN.h"
 
@@ -222,12 +224,33 @@ namespace emitters
 
     void IRModuleOptimizer::AddStandardPasses()
     {
+        AddPassesForLevel(2, 225); // the default -O2 inlining threshold
+    }
+
+    void IRModuleOptimizer::AddAggressivePasses()
+    {
+        // Each per-node function is called exactly once, from the map function, so a high
+        // threshold effectively flattens the model into one function. Once flattened, GVN and
+        // dead store elimination can forward each node's stores to its output port global
+        // straight into the consuming node's loads, provided the globals have internal linkage.
+        AddPassesForLevel(3, 2000);
+    }
+
+    void IRModuleOptimizer::AddPassesForLevel(unsigned optLevel, unsigned inlineThreshold)
+    {
+        PassManagerBuilder builder;
+        builder.OptLevel = optLevel;
+        builder.SizeLevel = 0;
+        builder.Inliner = createFunctionInliningPass(static_cast<int>(inlineThreshold));
+        builder.LoopVectorize = optLevel > 2;
+        builder.SLPVectorize = optLevel > 2;
+        builder.populateModulePassManager(_passes);
     }
 
     void IRModuleOptimizer::Run(llvm::Module* pModule)
     {
         assert(pModule != nullptr);
-        _passes.run(*pModule, _analysis);
+        _passes.run(*pModule);
     }
 }
 }
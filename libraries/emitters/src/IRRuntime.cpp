@@ -7,10 +7,12 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "IRRuntime.h"
+#include "IRKernelLibrary.h"
 #include "IRMetadata.h"
 #include "IRModuleEmitter.h"
 
 #include <iostream>
+#include <limits>
 #include <time.h>
 
 namespace ell
@@ -21,10 +23,37 @@ namespace emitters
     static const std::string& lVectorName = "pLVector";
     static const std::string& rVectorName = "pRVector";
     static const std::string& resultName = "pResult";
+    static const std::string& valuesName = "pValues";
+    static const std::string& incrementName = "increment";
+    static const std::string& inputName = "pInput";
+    static const std::string& outputName = "pOutput";
+    static const std::string& scaleName = "scale";
+    static const std::string& zeroPointName = "zeroPoint";
 
     static const std::string& dotProductFloatName = "DotProductF";
     static const std::string& dotProductIntName = "DotProduct";
     static const std::string& getTimeFunctionName = "GetTime";
+    static const std::string& fastExpFloatName = "FastExpF";
+    static const std::string& fastExpDoubleName = "FastExp";
+    static const std::string& softmaxFloatName = "SoftmaxF";
+    static const std::string& softmaxDoubleName = "Softmax";
+    static const std::string& maxPoolWindowFloatName = "MaxPoolWindowF";
+    static const std::string& maxPoolWindowDoubleName = "MaxPoolWindow";
+    static const std::string& quantizeFloatName = "QuantizeF";
+    static const std::string& quantizeDoubleName = "Quantize";
+    static const std::string& dequantizeFloatName = "DequantizeF";
+    static const std::string& dequantizeDoubleName = "Dequantize";
+    static const std::string& parallelForFunctionName = "ParallelFor";
+    static const std::string& parallelForThreadEntryName = "ParallelForThreadEntry";
+    static const std::string& pipelineQueueInitName = "PipelineQueueInit";
+    static const std::string& pipelineQueuePushName = "PipelineQueuePush";
+    static const std::string& pipelineQueuePopName = "PipelineQueuePop";
+    static const std::string& pipelineQueueStopName = "PipelineQueueStop";
+    static const std::string& arenaAllocateName = "ArenaAllocate";
+
+    // version of the C ABI between a freestanding module and the firmware shims it links against
+    // (clock, callbacks, arena); bump when a shim signature changes
+    static const int32_t c_freestandingShimABIVersion = 1;
 
     IRRuntime::IRRuntime(IRModuleEmitter& module)
         : _module(module)
@@ -36,8 +65,31 @@ namespace emitters
         return _module.GetModuleName();
     }
 
+    bool IRRuntime::UseSharedKernelLibrary() const
+    {
+        return _module.GetCompilerParameters().useSharedKernelLibrary;
+    }
+
+    llvm::Function* IRRuntime::GetSharedKernelFunction(const std::string& kernelName, llvm::FunctionType* functionType)
+    {
+        // the kernel library compiles the kernels once per process and publishes their addresses,
+        // so this module only carries a declaration and the jitter resolves it at link time
+        IRKernelLibrary::GetInstance().EnsureCompiled();
+        auto symbolName = IRKernelLibrary::GetKernelSymbolName(kernelName);
+        _module.DeclareFunction(symbolName, functionType);
+        return _module.GetFunction(symbolName);
+    }
+
     llvm::Function* IRRuntime::EmitDotProductFunctionF()
     {
+        if (UseSharedKernelLibrary())
+        {
+            ValueTypeList argTypes = { VariableType::Int32, VariableType::DoublePointer, VariableType::DoublePointer, VariableType::DoublePointer };
+            auto types = _module.GetIREmitter().GetLLVMTypes(argTypes);
+            auto functionType = llvm::FunctionType::get(_module.GetIREmitter().Type(VariableType::Void), types, false);
+            return GetSharedKernelFunction(dotProductFloatName, functionType);
+        }
+
         auto functionName = GetNamespacePrefix() + "_" + dotProductFloatName;
         NamedVariableTypeList argList = { { countName, VariableType::Int32 },
                                           { lVectorName, VariableType::DoublePointer },
@@ -60,6 +112,14 @@ namespace emitters
 
     llvm::Function* IRRuntime::EmitDotProductFunction()
     {
+        if (UseSharedKernelLibrary())
+        {
+            ValueTypeList argTypes = { VariableType::Int32, VariableType::Int32Pointer, VariableType::Int32Pointer, VariableType::Int32Pointer };
+            auto types = _module.GetIREmitter().GetLLVMTypes(argTypes);
+            auto functionType = llvm::FunctionType::get(_module.GetIREmitter().Type(VariableType::Void), types, false);
+            return GetSharedKernelFunction(dotProductIntName, functionType);
+        }
+
         auto functionName = GetNamespacePrefix() + "_" + dotProductIntName;
         NamedVariableTypeList argList = { { countName, VariableType::Int32 },
                                           { lVectorName, VariableType::Int32Pointer },
@@ -86,6 +146,19 @@ namespace emitters
             auto& emitter = _module.GetIREmitter();
             auto& context = _module.GetLLVMContext();
             auto& irBuilder = emitter.GetIRBuilder();
+
+            if (_module.GetCompilerParameters().targetDevice.freestanding)
+            {
+                // freestanding targets have no clock_gettime; the firmware provides the clock shim
+                // (the same symbol the hosted reference implementation in ClockInterface.h defines)
+                EnsureShimABIVersion();
+                auto doubleType = llvm::Type::getDoubleTy(context);
+                llvm::FunctionType* clockType = llvm::FunctionType::get(doubleType, {}, false);
+                _module.DeclareFunction("ELL_GetSteadyClockMilliseconds", clockType);
+                _pGetCurrentTimeFunction = _module.GetFunction("ELL_GetSteadyClockMilliseconds");
+                return _pGetCurrentTimeFunction;
+            }
+
             auto int32Type = llvm::Type::getInt32Ty(context);
             auto int64Type = llvm::Type::getInt64Ty(context);
 
@@ -138,6 +211,408 @@ namespace emitters
         return _pGetCurrentTimeFunction;
     }
 
+    void IRRuntime::EnsureShimABIVersion()
+    {
+        if (_pShimABIVersion == nullptr)
+        {
+            // exported so firmware implementing the shims can assert compatibility at link or load
+            // time before calling into the module
+            _pShimABIVersion = _module.Constant("ELL_FreestandingABIVersion", c_freestandingShimABIVersion);
+        }
+    }
+
+    llvm::Function* IRRuntime::GetArenaAllocateFunction()
+    {
+        if (_pArenaAllocateFunction == nullptr)
+        {
+            EnsureShimABIVersion();
+            auto& irBuilder = _module.GetIREmitter().GetIRBuilder();
+            auto& context = _module.GetLLVMContext();
+            auto int64Type = llvm::Type::getInt64Ty(context);
+            auto bytePtrType = llvm::Type::getInt8PtrTy(context);
+
+            auto arenaSize = static_cast<int64_t>(_module.GetCompilerParameters().targetDevice.freestandingArenaSize);
+            auto arena = _module.GlobalArray(VariableType::Byte, GetNamespacePrefix() + "_arena", static_cast<size_t>(arenaSize));
+            auto offsetGlobal = _module.Global(VariableType::Int64, GetNamespacePrefix() + "_arenaOffset");
+
+            auto functionName = GetNamespacePrefix() + "_" + arenaAllocateName;
+            auto function = _module.BeginFunction(functionName, bytePtrType, std::vector<llvm::Type*>{ int64Type });
+
+            auto arguments = function.Arguments().begin();
+            llvm::Argument& size = *arguments++;
+
+            // bump-pointer allocation, rounded up to 8-byte alignment
+            auto alignedSize = function.Operator(TypedOperator::logicalAnd,
+                                                 function.Operator(TypedOperator::add, &size, function.Literal<int64_t>(7)),
+                                                 function.Literal<int64_t>(~static_cast<int64_t>(7)));
+            auto offset = function.Load(offsetGlobal);
+            auto newOffset = function.Operator(TypedOperator::add, offset, alignedSize);
+
+            auto exhaustedBlock = function.Block("exhausted");
+            auto fitBlock = function.Block("fit");
+            auto isExhausted = irBuilder.CreateICmpSGT(newOffset, function.Literal<int64_t>(arenaSize));
+            function.Branch(isExhausted, exhaustedBlock, fitBlock);
+
+            // null on exhaustion, so callers fail loudly instead of corrupting memory
+            function.SetCurrentBlock(exhaustedBlock);
+            function.Return(llvm::ConstantPointerNull::get(bytePtrType));
+
+            function.SetCurrentBlock(fitBlock);
+            function.Store(offsetGlobal, newOffset);
+            auto resultPointer = irBuilder.CreateInBoundsGEP(arena, { function.Literal<int64_t>(0), offset });
+            function.Return(irBuilder.CreatePointerCast(resultPointer, bytePtrType));
+            _module.EndFunction();
+            _pArenaAllocateFunction = function.GetFunction();
+        }
+        return _pArenaAllocateFunction;
+    }
+
+    llvm::Function* IRRuntime::GetCacheMissCountFunction()
+    {
+        if (_pCacheMissCountFunction == nullptr)
+        {
+            auto& context = _module.GetLLVMContext();
+            auto int64Type = llvm::Type::getInt64Ty(context);
+
+            // Declared as an external symbol so that the host runtime (HardwareCounters.cpp) provides
+            // the implementation, both for the jitter and for statically-linked deployments
+            llvm::FunctionType* functionType = llvm::FunctionType::get(int64Type, {}, false);
+            _module.DeclareFunction("ELL_GetCacheMissCount", functionType);
+            _pCacheMissCountFunction = _module.GetFunction("ELL_GetCacheMissCount");
+        }
+        return _pCacheMissCountFunction;
+    }
+
+    llvm::Function* IRRuntime::GetBranchMissCountFunction()
+    {
+        if (_pBranchMissCountFunction == nullptr)
+        {
+            auto& context = _module.GetLLVMContext();
+            auto int64Type = llvm::Type::getInt64Ty(context);
+
+            llvm::FunctionType* functionType = llvm::FunctionType::get(int64Type, {}, false);
+            _module.DeclareFunction("ELL_GetBranchMissCount", functionType);
+            _pBranchMissCountFunction = _module.GetFunction("ELL_GetBranchMissCount");
+        }
+        return _pBranchMissCountFunction;
+    }
+
+    llvm::Function* IRRuntime::EmitParallelForThreadEntryFunction(llvm::StructType* taskArgType)
+    {
+        auto& emitter = _module.GetIREmitter();
+        auto& context = _module.GetLLVMContext();
+        auto& irBuilder = emitter.GetIRBuilder();
+        auto bytePtrType = llvm::Type::getInt8PtrTy(context);
+
+        // The pthreads start routine: unpack the argument block and run the task over its slice
+        auto functionName = GetNamespacePrefix() + "_" + parallelForThreadEntryName;
+        auto function = _module.BeginFunction(functionName, bytePtrType, std::vector<llvm::Type*>{ bytePtrType });
+
+        auto arguments = function.Arguments().begin();
+        llvm::Argument& threadArg = *arguments++;
+        auto taskArg = irBuilder.CreateBitCast(&threadArg, taskArgType->getPointerTo());
+        auto begin = function.Load(irBuilder.CreateInBoundsGEP(taskArgType, taskArg, { function.Literal(0), function.Literal(0) }));
+        auto end = function.Load(irBuilder.CreateInBoundsGEP(taskArgType, taskArg, { function.Literal(0), function.Literal(1) }));
+        auto taskContext = function.Load(irBuilder.CreateInBoundsGEP(taskArgType, taskArg, { function.Literal(0), function.Literal(2) }));
+        auto task = function.Load(irBuilder.CreateInBoundsGEP(taskArgType, taskArg, { function.Literal(0), function.Literal(3) }));
+        irBuilder.CreateCall(task, { begin, end, taskContext });
+        function.Return(llvm::ConstantPointerNull::get(bytePtrType));
+        _module.EndFunction();
+
+        return function.GetFunction();
+    }
+
+    llvm::Function* IRRuntime::GetParallelForFunction()
+    {
+        if (_pParallelForFunction == nullptr)
+        {
+            auto& emitter = _module.GetIREmitter();
+            auto& context = _module.GetLLVMContext();
+            auto& irBuilder = emitter.GetIRBuilder();
+            auto int32Type = llvm::Type::getInt32Ty(context);
+            auto voidType = llvm::Type::getVoidTy(context);
+            auto bytePtrType = llvm::Type::getInt8PtrTy(context);
+
+            const auto plus = TypedOperator::add;
+            const auto minus = TypedOperator::subtract;
+            const auto times = TypedOperator::multiply;
+            const auto divide = TypedOperator::divideSigned;
+
+            // A task function processes the half-open slice [begin, end) of the index range
+            auto taskFunctionType = llvm::FunctionType::get(voidType, { int32Type, int32Type, bytePtrType }, false);
+            auto taskFunctionPtrType = taskFunctionType->getPointerTo();
+
+            // Per-thread argument block: { begin, end, context, task }
+            auto taskArgType = llvm::StructType::create(context, { int32Type, int32Type, bytePtrType, taskFunctionPtrType }, GetNamespacePrefix() + "_ParallelForTaskArg");
+
+            // pthread_t and the start routine's return value are modeled as i8* (pointer-sized on the targets we emit for)
+            auto threadEntryType = llvm::FunctionType::get(bytePtrType, { bytePtrType }, false);
+            llvm::FunctionType* pthreadCreateType = llvm::FunctionType::get(int32Type, { bytePtrType->getPointerTo(), bytePtrType, threadEntryType->getPointerTo(), bytePtrType }, false);
+            _module.DeclareFunction("pthread_create", pthreadCreateType);
+            llvm::FunctionType* pthreadJoinType = llvm::FunctionType::get(int32Type, { bytePtrType, bytePtrType->getPointerTo() }, false);
+            _module.DeclareFunction("pthread_join", pthreadJoinType);
+            auto pthreadCreateFunction = _module.GetFunction("pthread_create");
+            auto pthreadJoinFunction = _module.GetFunction("pthread_join");
+
+            auto threadEntryFunction = EmitParallelForThreadEntryFunction(taskArgType);
+
+            auto functionName = GetNamespacePrefix() + "_" + parallelForFunctionName;
+            auto function = _module.BeginFunction(functionName, voidType, std::vector<llvm::Type*>{ int32Type, int32Type, int32Type, bytePtrType, taskFunctionPtrType });
+
+            auto arguments = function.Arguments().begin();
+            llvm::Argument& begin = *arguments++;
+            llvm::Argument& end = *arguments++;
+            llvm::Argument& numThreads = *arguments++;
+            llvm::Argument& taskContext = *arguments++;
+            llvm::Argument& task = *arguments++;
+
+            auto count = function.Operator(minus, &end, &begin);
+
+            // Clamp the number of slices to [1, count]
+            auto tooMany = irBuilder.CreateICmpSGT(&numThreads, count);
+            llvm::Value* numSlices = irBuilder.CreateSelect(tooMany, count, &numThreads);
+            auto tooFew = irBuilder.CreateICmpSLT(numSlices, function.Literal(1));
+            numSlices = irBuilder.CreateSelect(tooFew, function.Literal(1), numSlices);
+            auto numWorkers = function.Operator(minus, numSlices, function.Literal(1));
+
+            // Storage for the worker thread handles and argument blocks
+            auto threads = irBuilder.CreateAlloca(bytePtrType, numSlices);
+            auto taskArgs = irBuilder.CreateAlloca(taskArgType, numSlices);
+
+            // Launch slices 1 .. numSlices-1 on worker threads; slice boundaries are begin + sliceIndex*count/numSlices
+            auto launchLoop = function.ForLoop();
+            launchLoop.Begin(numWorkers);
+            {
+                auto sliceIndex = function.Operator(plus, launchLoop.LoadIterationVariable(), function.Literal(1));
+                auto nextSliceIndex = function.Operator(plus, sliceIndex, function.Literal(1));
+                auto sliceBegin = function.Operator(plus, &begin, function.Operator(divide, function.Operator(times, sliceIndex, count), numSlices));
+                auto sliceEnd = function.Operator(plus, &begin, function.Operator(divide, function.Operator(times, nextSliceIndex, count), numSlices));
+
+                auto taskArg = irBuilder.CreateInBoundsGEP(taskArgType, taskArgs, sliceIndex);
+                function.Store(irBuilder.CreateInBoundsGEP(taskArgType, taskArg, { function.Literal(0), function.Literal(0) }), sliceBegin);
+                function.Store(irBuilder.CreateInBoundsGEP(taskArgType, taskArg, { function.Literal(0), function.Literal(1) }), sliceEnd);
+                function.Store(irBuilder.CreateInBoundsGEP(taskArgType, taskArg, { function.Literal(0), function.Literal(2) }), &taskContext);
+                function.Store(irBuilder.CreateInBoundsGEP(taskArgType, taskArg, { function.Literal(0), function.Literal(3) }), &task);
+
+                auto threadPtr = irBuilder.CreateInBoundsGEP(bytePtrType, threads, sliceIndex);
+                function.Call(pthreadCreateFunction, { threadPtr, llvm::ConstantPointerNull::get(bytePtrType), threadEntryFunction, irBuilder.CreateBitCast(taskArg, bytePtrType) });
+            }
+            launchLoop.End();
+
+            // Run slice 0 on the calling thread, then wait for the workers
+            auto firstSliceEnd = function.Operator(plus, &begin, function.Operator(divide, count, numSlices));
+            irBuilder.CreateCall(&task, { &begin, firstSliceEnd, &taskContext });
+
+            auto joinLoop = function.ForLoop();
+            joinLoop.Begin(numWorkers);
+            {
+                auto sliceIndex = function.Operator(plus, joinLoop.LoadIterationVariable(), function.Literal(1));
+                auto threadValue = function.Load(irBuilder.CreateInBoundsGEP(bytePtrType, threads, sliceIndex));
+                function.Call(pthreadJoinFunction, { threadValue, llvm::ConstantPointerNull::get(bytePtrType->getPointerTo()) });
+            }
+            joinLoop.End();
+
+            function.Return();
+            _module.EndFunction();
+            _pParallelForFunction = function.GetFunction();
+        }
+        return _pParallelForFunction;
+    }
+
+    llvm::StructType* IRRuntime::GetPipelineQueueType()
+    {
+        if (_pPipelineQueueType == nullptr)
+        {
+            auto& context = _module.GetLLVMContext();
+            auto int32Type = llvm::Type::getInt32Ty(context);
+            auto bytePtrType = llvm::Type::getInt8PtrTy(context);
+
+            // { slots, slotSize, capacity, head, tail, stop }; the ring is full when advancing the
+            // tail would reach the head, so the capacity is one larger than the usable queue length
+            _pPipelineQueueType = llvm::StructType::create(context, { bytePtrType, int32Type, int32Type, int32Type, int32Type, int32Type }, GetNamespacePrefix() + "_PipelineQueue");
+        }
+        return _pPipelineQueueType;
+    }
+
+    llvm::Function* IRRuntime::GetPipelineQueueInitFunction()
+    {
+        if (_pPipelineQueueInitFunction == nullptr)
+        {
+            auto& irBuilder = _module.GetIREmitter().GetIRBuilder();
+            auto& context = _module.GetLLVMContext();
+            auto int32Type = llvm::Type::getInt32Ty(context);
+            auto voidType = llvm::Type::getVoidTy(context);
+            auto bytePtrType = llvm::Type::getInt8PtrTy(context);
+            auto queueType = GetPipelineQueueType();
+
+            auto functionName = GetNamespacePrefix() + "_" + pipelineQueueInitName;
+            auto function = _module.BeginFunction(functionName, voidType, std::vector<llvm::Type*>{ queueType->getPointerTo(), bytePtrType, int32Type, int32Type });
+
+            auto arguments = function.Arguments().begin();
+            llvm::Argument& queue = *arguments++;
+            llvm::Argument& slots = *arguments++;
+            llvm::Argument& slotSize = *arguments++;
+            llvm::Argument& capacity = *arguments++;
+
+            auto field = [&](int index) { return irBuilder.CreateInBoundsGEP(queueType, &queue, { function.Literal(0), function.Literal(index) }); };
+            function.Store(field(0), &slots);
+            function.Store(field(1), &slotSize);
+            function.Store(field(2), &capacity);
+            function.Store(field(3), function.Literal(0));
+            function.Store(field(4), function.Literal(0));
+            function.Store(field(5), function.Literal(0));
+            function.Return();
+            _module.EndFunction();
+            _pPipelineQueueInitFunction = function.GetFunction();
+        }
+        return _pPipelineQueueInitFunction;
+    }
+
+    llvm::Function* IRRuntime::GetPipelineQueuePushFunction()
+    {
+        if (_pPipelineQueuePushFunction == nullptr)
+        {
+            auto& irBuilder = _module.GetIREmitter().GetIRBuilder();
+            auto& context = _module.GetLLVMContext();
+            auto int32Type = llvm::Type::getInt32Ty(context);
+            auto bytePtrType = llvm::Type::getInt8PtrTy(context);
+            auto queueType = GetPipelineQueueType();
+
+            auto functionName = GetNamespacePrefix() + "_" + pipelineQueuePushName;
+            auto function = _module.BeginFunction(functionName, int32Type, std::vector<llvm::Type*>{ queueType->getPointerTo(), bytePtrType });
+
+            auto arguments = function.Arguments().begin();
+            llvm::Argument& queue = *arguments++;
+            llvm::Argument& item = *arguments++;
+
+            auto field = [&](int index) { return irBuilder.CreateInBoundsGEP(queueType, &queue, { function.Literal(0), function.Literal(index) }); };
+            auto slots = function.Load(field(0));
+            auto slotSize = function.Load(field(1));
+            auto capacity = function.Load(field(2));
+
+            // only the producer writes the tail, so it can be read with an ordinary load
+            auto tail = function.Load(field(4));
+            auto nextTail = irBuilder.CreateSRem(function.Operator(TypedOperator::add, tail, function.Literal(1)), capacity);
+
+            auto spinBlock = function.Block("spin");
+            auto stopCheckBlock = function.Block("stopCheck");
+            auto copyBlock = function.Block("copy");
+            auto stoppedBlock = function.Block("stopped");
+            function.Branch(spinBlock);
+
+            // spin while the ring is full; the head moves when the consumer frees a slot
+            function.SetCurrentBlock(spinBlock);
+            auto head = irBuilder.CreateLoad(field(3), true);
+            auto isFull = irBuilder.CreateICmpEQ(nextTail, head);
+            function.Branch(isFull, stopCheckBlock, copyBlock);
+
+            function.SetCurrentBlock(stopCheckBlock);
+            auto stop = irBuilder.CreateLoad(field(5), true);
+            auto isStopped = irBuilder.CreateICmpNE(stop, function.Literal(0));
+            function.Branch(isStopped, stoppedBlock, spinBlock);
+
+            // copy the item into the tail slot, then publish it by advancing the tail; the fence
+            // keeps the copy from being reordered past the index store on weakly-ordered targets
+            function.SetCurrentBlock(copyBlock);
+            auto slotOffset = function.Operator(TypedOperator::multiply, tail, slotSize);
+            function.MemoryCopy<uint8_t>(&item, function.PointerOffset(slots, slotOffset), slotSize);
+            irBuilder.CreateFence(llvm::AtomicOrdering::Release);
+            irBuilder.CreateStore(nextTail, field(4), true);
+            function.Return(function.Literal(1));
+
+            function.SetCurrentBlock(stoppedBlock);
+            function.Return(function.Literal(0));
+            _module.EndFunction();
+            _pPipelineQueuePushFunction = function.GetFunction();
+        }
+        return _pPipelineQueuePushFunction;
+    }
+
+    llvm::Function* IRRuntime::GetPipelineQueuePopFunction()
+    {
+        if (_pPipelineQueuePopFunction == nullptr)
+        {
+            auto& irBuilder = _module.GetIREmitter().GetIRBuilder();
+            auto& context = _module.GetLLVMContext();
+            auto int32Type = llvm::Type::getInt32Ty(context);
+            auto bytePtrType = llvm::Type::getInt8PtrTy(context);
+            auto queueType = GetPipelineQueueType();
+
+            auto functionName = GetNamespacePrefix() + "_" + pipelineQueuePopName;
+            auto function = _module.BeginFunction(functionName, int32Type, std::vector<llvm::Type*>{ queueType->getPointerTo(), bytePtrType });
+
+            auto arguments = function.Arguments().begin();
+            llvm::Argument& queue = *arguments++;
+            llvm::Argument& item = *arguments++;
+
+            auto field = [&](int index) { return irBuilder.CreateInBoundsGEP(queueType, &queue, { function.Literal(0), function.Literal(index) }); };
+            auto slots = function.Load(field(0));
+            auto slotSize = function.Load(field(1));
+            auto capacity = function.Load(field(2));
+
+            // only the consumer writes the head, so it can be read with an ordinary load
+            auto head = function.Load(field(3));
+
+            auto spinBlock = function.Block("spin");
+            auto stopCheckBlock = function.Block("stopCheck");
+            auto copyBlock = function.Block("copy");
+            auto stoppedBlock = function.Block("stopped");
+            function.Branch(spinBlock);
+
+            // spin while the ring is empty; the tail moves when the producer publishes an item.
+            // A stopped queue is still drained, so no items in flight are lost
+            function.SetCurrentBlock(spinBlock);
+            auto tail = irBuilder.CreateLoad(field(4), true);
+            auto isEmpty = irBuilder.CreateICmpEQ(head, tail);
+            function.Branch(isEmpty, stopCheckBlock, copyBlock);
+
+            function.SetCurrentBlock(stopCheckBlock);
+            auto stop = irBuilder.CreateLoad(field(5), true);
+            auto isStopped = irBuilder.CreateICmpNE(stop, function.Literal(0));
+            function.Branch(isStopped, stoppedBlock, spinBlock);
+
+            // copy the head slot out, then free it by advancing the head; the fences pair with the
+            // producer's so the copy sees the published bytes and finishes before the slot is reused
+            function.SetCurrentBlock(copyBlock);
+            irBuilder.CreateFence(llvm::AtomicOrdering::Acquire);
+            auto slotOffset = function.Operator(TypedOperator::multiply, head, slotSize);
+            function.MemoryCopy<uint8_t>(function.PointerOffset(slots, slotOffset), &item, slotSize);
+            irBuilder.CreateFence(llvm::AtomicOrdering::Release);
+            auto nextHead = irBuilder.CreateSRem(function.Operator(TypedOperator::add, head, function.Literal(1)), capacity);
+            irBuilder.CreateStore(nextHead, field(3), true);
+            function.Return(function.Literal(1));
+
+            function.SetCurrentBlock(stoppedBlock);
+            function.Return(function.Literal(0));
+            _module.EndFunction();
+            _pPipelineQueuePopFunction = function.GetFunction();
+        }
+        return _pPipelineQueuePopFunction;
+    }
+
+    llvm::Function* IRRuntime::GetPipelineQueueStopFunction()
+    {
+        if (_pPipelineQueueStopFunction == nullptr)
+        {
+            auto& irBuilder = _module.GetIREmitter().GetIRBuilder();
+            auto& context = _module.GetLLVMContext();
+            auto voidType = llvm::Type::getVoidTy(context);
+            auto queueType = GetPipelineQueueType();
+
+            auto functionName = GetNamespacePrefix() + "_" + pipelineQueueStopName;
+            auto function = _module.BeginFunction(functionName, voidType, std::vector<llvm::Type*>{ queueType->getPointerTo() });
+
+            auto arguments = function.Arguments().begin();
+            llvm::Argument& queue = *arguments++;
+            auto stopField = irBuilder.CreateInBoundsGEP(queueType, &queue, { function.Literal(0), function.Literal(5) });
+            irBuilder.CreateStore(function.Literal(1), stopField, true);
+            function.Return();
+            _module.EndFunction();
+            _pPipelineQueueStopFunction = function.GetFunction();
+        }
+        return _pPipelineQueueStopFunction;
+    }
+
     llvm::Function* IRRuntime::GetSqrtFunction(VariableType argType)
     {
         return _module.GetIntrinsic(llvm::Intrinsic::sqrt, { argType });
@@ -158,6 +633,344 @@ namespace emitters
         return _module.GetIntrinsic(llvm::Intrinsic::log, { argType });
     }
 
+    llvm::Function* IRRuntime::GetFastExpFunction(VariableType argType)
+    {
+        auto& pFunction = (argType == VariableType::Float) ? _pFastExpFunctionFloat : _pFastExpFunctionDouble;
+        if (pFunction == nullptr)
+        {
+            pFunction = EmitFastExpFunction(argType);
+        }
+        return pFunction;
+    }
+
+    llvm::Function* IRRuntime::EmitFastExpFunction(VariableType argType)
+    {
+        // Emits the same Cephes-style approximation as math::FastMath::Exp: reduce to
+        // exp(x) = 2^n * exp(r) with |r| <= ln(2)/2, evaluate a degree-6 polynomial for exp(r), and
+        // build 2^n by writing the biased exponent bits directly. The body is branch-free (clamping
+        // and the floor fix-up are selects), so the optimizer can inline and vectorize it.
+        bool isFloat = (argType == VariableType::Float);
+        auto functionName = GetNamespacePrefix() + "_" + (isFloat ? fastExpFloatName : fastExpDoubleName);
+        NamedVariableTypeList argList = { { "x", argType } };
+        auto function = _module.BeginFunction(functionName, argType, argList);
+
+        auto literal = [&function, isFloat](double value) -> llvm::Value* {
+            return isFloat ? function.Literal(static_cast<float>(value)) : function.Literal(value);
+        };
+
+        auto arguments = function.Arguments().begin();
+        llvm::Value* x = &(*arguments);
+
+        // clamp to the single-precision representable range, so the exponent arithmetic below
+        // cannot overflow
+        auto tooSmall = function.Comparison(TypedComparison::lessThanFloat, x, literal(-87.0));
+        x = function.Select(tooSmall, literal(-87.0), x);
+        auto tooBig = function.Comparison(TypedComparison::greaterThanFloat, x, literal(88.0));
+        x = function.Select(tooBig, literal(88.0), x);
+
+        // n = round(x / ln(2)) = floor(x * log2(e) + 0.5)
+        auto scaled = function.Operator(TypedOperator::addFloat, function.Operator(TypedOperator::multiplyFloat, x, literal(1.44269504088896341)), literal(0.5));
+        auto floorFunction = _module.GetIntrinsic(llvm::Intrinsic::floor, { argType });
+        auto nFloat = function.Call(floorFunction, { scaled });
+        auto n = function.CastFloatToInt(nFloat, VariableType::Int32);
+
+        // r = x - n * ln(2), with ln(2) split into a high and a low part for accuracy
+        auto r = function.Operator(TypedOperator::subtractFloat, x, function.Operator(TypedOperator::multiplyFloat, nFloat, literal(0.693359375)));
+        r = function.Operator(TypedOperator::subtractFloat, r, function.Operator(TypedOperator::multiplyFloat, nFloat, literal(-2.12194440e-4)));
+
+        // exp(r) ~ 1 + r + r^2 * p(r)
+        auto polynomial = literal(1.9875691500e-4);
+        for (double coefficient : { 1.3981999507e-3, 8.3334519073e-3, 4.1665795894e-2, 1.6666665459e-1, 5.0000001201e-1 })
+        {
+            polynomial = function.Operator(TypedOperator::addFloat, function.Operator(TypedOperator::multiplyFloat, polynomial, r), literal(coefficient));
+        }
+        auto rSquared = function.Operator(TypedOperator::multiplyFloat, r, r);
+        auto expR = function.Operator(TypedOperator::addFloat, function.Operator(TypedOperator::multiplyFloat, polynomial, rSquared), function.Operator(TypedOperator::addFloat, r, literal(1.0)));
+
+        // 2^n, by placing the biased exponent into the floating point bit pattern
+        auto& irBuilder = _module.GetIREmitter().GetIRBuilder();
+        auto& context = _module.GetLLVMContext();
+        llvm::Value* powerOfTwo = nullptr;
+        if (isFloat)
+        {
+            auto bits = irBuilder.CreateShl(irBuilder.CreateAdd(n, function.Literal(127)), 23);
+            powerOfTwo = irBuilder.CreateBitCast(bits, llvm::Type::getFloatTy(context));
+        }
+        else
+        {
+            auto n64 = irBuilder.CreateSExt(n, llvm::Type::getInt64Ty(context));
+            auto bits = irBuilder.CreateShl(irBuilder.CreateAdd(n64, function.Literal(static_cast<int64_t>(1023))), 52);
+            powerOfTwo = irBuilder.CreateBitCast(bits, llvm::Type::getDoubleTy(context));
+        }
+
+        function.Return(function.Operator(TypedOperator::multiplyFloat, expR, powerOfTwo));
+        _module.EndFunction();
+        return function.GetFunction();
+    }
+
+    llvm::Function* IRRuntime::GetSoftmaxFunction(VariableType argType)
+    {
+        auto& pFunction = (argType == VariableType::Float) ? _pSoftmaxFunctionFloat : _pSoftmaxFunctionDouble;
+        if (pFunction == nullptr)
+        {
+            pFunction = EmitSoftmaxFunction(argType);
+        }
+        return pFunction;
+    }
+
+    llvm::Function* IRRuntime::EmitSoftmaxFunction(VariableType argType)
+    {
+        bool isFloat = (argType == VariableType::Float);
+        auto pointerType = isFloat ? VariableType::FloatPointer : VariableType::DoublePointer;
+        const auto& kernelName = isFloat ? softmaxFloatName : softmaxDoubleName;
+
+        if (UseSharedKernelLibrary())
+        {
+            ValueTypeList argTypes = { VariableType::Int32, pointerType };
+            auto types = _module.GetIREmitter().GetLLVMTypes(argTypes);
+            auto functionType = llvm::FunctionType::get(_module.GetIREmitter().Type(VariableType::Void), types, false);
+            return GetSharedKernelFunction(kernelName, functionType);
+        }
+
+        auto functionName = GetNamespacePrefix() + "_" + kernelName;
+        NamedVariableTypeList argList = { { countName, VariableType::Int32 },
+                                          { valuesName, pointerType } };
+        auto function = _module.BeginFunction(functionName, VariableType::Void, argList);
+
+        auto literal = [&function, isFloat](double value) -> llvm::Value* {
+            return isFloat ? function.Literal(static_cast<float>(value)) : function.Literal(value);
+        };
+
+        auto arguments = function.Arguments().begin();
+        llvm::Argument& count = *arguments++;
+        llvm::Argument& values = *arguments++;
+
+        // pass 1: find the largest element, so the exponentials below cannot overflow
+        auto maxVariable = function.Variable(argType, "max");
+        function.Store(maxVariable, isFloat ? function.Literal(std::numeric_limits<float>::lowest()) : function.Literal(std::numeric_limits<double>::lowest()));
+        auto maxLoop = function.ForLoop();
+        maxLoop.Begin(&count);
+        {
+            auto value = function.Load(function.PointerOffset(&values, maxLoop.LoadIterationVariable()));
+            auto currentMax = function.Load(maxVariable);
+            auto isGreater = function.Comparison(TypedComparison::greaterThanFloat, value, currentMax);
+            function.Store(maxVariable, function.Select(isGreater, value, currentMax));
+        }
+        maxLoop.End();
+
+        // pass 2: exponentiate in place and accumulate the sum
+        auto expFunction = GetExpFunction(argType);
+        auto sumVariable = function.Variable(argType, "sum");
+        function.Store(sumVariable, literal(0.0));
+        auto expLoop = function.ForLoop();
+        expLoop.Begin(&count);
+        {
+            auto valuePointer = function.PointerOffset(&values, expLoop.LoadIterationVariable());
+            auto shifted = function.Operator(TypedOperator::subtractFloat, function.Load(valuePointer), function.Load(maxVariable));
+            auto exponential = function.Call(expFunction, { shifted });
+            function.Store(valuePointer, exponential);
+            function.Store(sumVariable, function.Operator(TypedOperator::addFloat, function.Load(sumVariable), exponential));
+        }
+        expLoop.End();
+
+        // pass 3: normalize
+        auto normalizeLoop = function.ForLoop();
+        normalizeLoop.Begin(&count);
+        {
+            auto valuePointer = function.PointerOffset(&values, normalizeLoop.LoadIterationVariable());
+            function.Store(valuePointer, function.Operator(TypedOperator::divideFloat, function.Load(valuePointer), function.Load(sumVariable)));
+        }
+        normalizeLoop.End();
+
+        function.Return();
+        _module.EndFunction();
+        return function.GetFunction();
+    }
+
+    llvm::Function* IRRuntime::GetMaxPoolWindowFunction(VariableType argType)
+    {
+        auto& pFunction = (argType == VariableType::Float) ? _pMaxPoolWindowFunctionFloat : _pMaxPoolWindowFunctionDouble;
+        if (pFunction == nullptr)
+        {
+            pFunction = EmitMaxPoolWindowFunction(argType);
+        }
+        return pFunction;
+    }
+
+    llvm::Function* IRRuntime::EmitMaxPoolWindowFunction(VariableType argType)
+    {
+        bool isFloat = (argType == VariableType::Float);
+        auto pointerType = isFloat ? VariableType::FloatPointer : VariableType::DoublePointer;
+        const auto& kernelName = isFloat ? maxPoolWindowFloatName : maxPoolWindowDoubleName;
+
+        if (UseSharedKernelLibrary())
+        {
+            ValueTypeList argTypes = { VariableType::Int32, pointerType, VariableType::Int32 };
+            auto types = _module.GetIREmitter().GetLLVMTypes(argTypes);
+            auto functionType = llvm::FunctionType::get(_module.GetIREmitter().Type(argType), types, false);
+            return GetSharedKernelFunction(kernelName, functionType);
+        }
+
+        auto functionName = GetNamespacePrefix() + "_" + kernelName;
+        NamedVariableTypeList argList = { { countName, VariableType::Int32 },
+                                          { valuesName, pointerType },
+                                          { incrementName, VariableType::Int32 } };
+        auto function = _module.BeginFunction(functionName, argType, argList);
+
+        auto arguments = function.Arguments().begin();
+        llvm::Argument& count = *arguments++;
+        llvm::Argument& values = *arguments++;
+        llvm::Argument& increment = *arguments++;
+
+        auto maxVariable = function.Variable(argType, "max");
+        function.Store(maxVariable, isFloat ? function.Literal(std::numeric_limits<float>::lowest()) : function.Literal(std::numeric_limits<double>::lowest()));
+
+        auto loop = function.ForLoop();
+        loop.Begin(&count);
+        {
+            auto offset = function.Operator(TypedOperator::multiply, loop.LoadIterationVariable(), &increment);
+            auto value = function.Load(function.PointerOffset(&values, offset));
+            auto currentMax = function.Load(maxVariable);
+            auto isGreater = function.Comparison(TypedComparison::greaterThanFloat, value, currentMax);
+            function.Store(maxVariable, function.Select(isGreater, value, currentMax));
+        }
+        loop.End();
+
+        function.Return(function.Load(maxVariable));
+        _module.EndFunction();
+        return function.GetFunction();
+    }
+
+    llvm::Function* IRRuntime::GetQuantizeFunction(VariableType argType)
+    {
+        auto& pFunction = (argType == VariableType::Float) ? _pQuantizeFunctionFloat : _pQuantizeFunctionDouble;
+        if (pFunction == nullptr)
+        {
+            pFunction = EmitQuantizeFunction(argType);
+        }
+        return pFunction;
+    }
+
+    llvm::Function* IRRuntime::EmitQuantizeFunction(VariableType argType)
+    {
+        bool isFloat = (argType == VariableType::Float);
+        auto pointerType = isFloat ? VariableType::FloatPointer : VariableType::DoublePointer;
+        const auto& kernelName = isFloat ? quantizeFloatName : quantizeDoubleName;
+
+        if (UseSharedKernelLibrary())
+        {
+            ValueTypeList argTypes = { VariableType::Int32, pointerType, VariableType::Char8Pointer, argType, VariableType::Int32 };
+            auto types = _module.GetIREmitter().GetLLVMTypes(argTypes);
+            auto functionType = llvm::FunctionType::get(_module.GetIREmitter().Type(VariableType::Void), types, false);
+            return GetSharedKernelFunction(kernelName, functionType);
+        }
+
+        auto functionName = GetNamespacePrefix() + "_" + kernelName;
+        NamedVariableTypeList argList = { { countName, VariableType::Int32 },
+                                          { inputName, pointerType },
+                                          { outputName, VariableType::Char8Pointer },
+                                          { scaleName, argType },
+                                          { zeroPointName, VariableType::Int32 } };
+        auto function = _module.BeginFunction(functionName, VariableType::Void, argList);
+
+        auto literal = [&function, isFloat](double value) -> llvm::Value* {
+            return isFloat ? function.Literal(static_cast<float>(value)) : function.Literal(value);
+        };
+
+        auto arguments = function.Arguments().begin();
+        llvm::Argument& count = *arguments++;
+        llvm::Argument& input = *arguments++;
+        llvm::Argument& output = *arguments++;
+        llvm::Argument& scale = *arguments++;
+        llvm::Argument& zeroPoint = *arguments++;
+
+        // hoist the division and the saturation bounds out of the loop; the body is then a
+        // multiply, round, clamp and narrowing store per element, which vectorizes cleanly
+        auto inverseScale = function.Operator(TypedOperator::divideFloat, literal(1.0), &scale);
+        auto lowest = function.CastIntToFloat(function.Operator(TypedOperator::subtract, function.Literal(-128), &zeroPoint), argType, true);
+        auto highest = function.CastIntToFloat(function.Operator(TypedOperator::subtract, function.Literal(127), &zeroPoint), argType, true);
+
+        auto loop = function.ForLoop();
+        loop.Begin(&count);
+        {
+            auto index = loop.LoadIterationVariable();
+            auto scaled = function.Operator(TypedOperator::multiplyFloat, function.Load(function.PointerOffset(&input, index)), inverseScale);
+
+            // round half away from zero (the behavior of std::round): shift by +/- 0.5, then let
+            // the float-to-int cast truncate toward zero
+            auto isNonNegative = function.Comparison(TypedComparison::greaterThanOrEqualsFloat, scaled, literal(0.0));
+            auto rounded = function.Operator(TypedOperator::addFloat, scaled, function.Select(isNonNegative, literal(0.5), literal(-0.5)));
+
+            // clamp before converting, so out-of-range values saturate instead of wrapping
+            auto tooHigh = function.Comparison(TypedComparison::greaterThanFloat, rounded, highest);
+            auto tooLow = function.Comparison(TypedComparison::lessThanFloat, rounded, lowest);
+            auto clamped = function.Select(tooHigh, highest, function.Select(tooLow, lowest, rounded));
+
+            auto quantized = function.Operator(TypedOperator::add, function.CastFloatToInt(clamped, VariableType::Int32), &zeroPoint);
+            function.Store(function.PointerOffset(&output, index), function.Cast(quantized, VariableType::Char8));
+        }
+        loop.End();
+
+        function.Return();
+        _module.EndFunction();
+        return function.GetFunction();
+    }
+
+    llvm::Function* IRRuntime::GetDequantizeFunction(VariableType argType)
+    {
+        auto& pFunction = (argType == VariableType::Float) ? _pDequantizeFunctionFloat : _pDequantizeFunctionDouble;
+        if (pFunction == nullptr)
+        {
+            pFunction = EmitDequantizeFunction(argType);
+        }
+        return pFunction;
+    }
+
+    llvm::Function* IRRuntime::EmitDequantizeFunction(VariableType argType)
+    {
+        bool isFloat = (argType == VariableType::Float);
+        auto pointerType = isFloat ? VariableType::FloatPointer : VariableType::DoublePointer;
+        const auto& kernelName = isFloat ? dequantizeFloatName : dequantizeDoubleName;
+
+        if (UseSharedKernelLibrary())
+        {
+            ValueTypeList argTypes = { VariableType::Int32, VariableType::Char8Pointer, pointerType, argType, VariableType::Int32 };
+            auto types = _module.GetIREmitter().GetLLVMTypes(argTypes);
+            auto functionType = llvm::FunctionType::get(_module.GetIREmitter().Type(VariableType::Void), types, false);
+            return GetSharedKernelFunction(kernelName, functionType);
+        }
+
+        auto functionName = GetNamespacePrefix() + "_" + kernelName;
+        NamedVariableTypeList argList = { { countName, VariableType::Int32 },
+                                          { inputName, VariableType::Char8Pointer },
+                                          { outputName, pointerType },
+                                          { scaleName, argType },
+                                          { zeroPointName, VariableType::Int32 } };
+        auto function = _module.BeginFunction(functionName, VariableType::Void, argList);
+
+        auto arguments = function.Arguments().begin();
+        llvm::Argument& count = *arguments++;
+        llvm::Argument& input = *arguments++;
+        llvm::Argument& output = *arguments++;
+        llvm::Argument& scale = *arguments++;
+        llvm::Argument& zeroPoint = *arguments++;
+
+        auto loop = function.ForLoop();
+        loop.Begin(&count);
+        {
+            auto index = loop.LoadIterationVariable();
+            auto quantized = function.Cast(function.Load(function.PointerOffset(&input, index)), VariableType::Int32);
+            auto shifted = function.Operator(TypedOperator::subtract, quantized, &zeroPoint);
+            auto value = function.Operator(TypedOperator::multiplyFloat, function.CastIntToFloat(shifted, argType, true), &scale);
+            function.Store(function.PointerOffset(&output, index), value);
+        }
+        loop.End();
+
+        function.Return();
+        _module.EndFunction();
+        return function.GetFunction();
+    }
+
     //
     // BLAS
     //
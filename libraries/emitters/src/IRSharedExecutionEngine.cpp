@@ -0,0 +1,100 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     IRSharedExecutionEngine.cpp (emitters)
+//  Authors:  Umesh Madan
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "IRSharedExecutionEngine.h"
+#include "EmitterException.h"
+
+namespace ell
+{
+namespace emitters
+{
+    IRSharedExecutionEngine& IRSharedExecutionEngine::GetInstance()
+    {
+        static IRSharedExecutionEngine instance;
+        return instance;
+    }
+
+    std::string IRSharedExecutionEngine::GetSymbolPrefix(ModuleHandle handle)
+    {
+        return "__shared" + std::to_string(handle) + "_";
+    }
+
+    void IRSharedExecutionEngine::PrivatizeSymbols(llvm::Module& module, ModuleHandle handle)
+    {
+        // Prefix every symbol the module defines, so two maps compiled with the same module name
+        // can live in one engine. Declarations keep their names: they refer to symbols defined
+        // elsewhere (libc, intrinsics, the shared kernel library) and must still resolve there.
+        auto prefix = GetSymbolPrefix(handle);
+        for (auto& function : module.functions())
+        {
+            if (!function.isDeclaration())
+            {
+                function.setName(prefix + function.getName().str());
+            }
+        }
+        for (auto& global : module.globals())
+        {
+            if (!global.isDeclaration() && !global.getName().startswith("llvm."))
+            {
+                global.setName(prefix + global.getName().str());
+            }
+        }
+    }
+
+    IRSharedExecutionEngine::ModuleHandle IRSharedExecutionEngine::AddModule(std::unique_ptr<llvm::Module> pModule)
+    {
+        assert(pModule != nullptr);
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto handle = _nextHandle++;
+        PrivatizeSymbols(*pModule, handle);
+        _modules[handle] = pModule.get();
+        if (_pEngine == nullptr)
+        {
+            // the first module bootstraps the backend; later modules just join it
+            _pEngine = std::make_unique<IRExecutionEngine>(std::move(pModule));
+        }
+        else
+        {
+            _pEngine->AddModule(std::move(pModule));
+        }
+        return handle;
+    }
+
+    void IRSharedExecutionEngine::RemoveModule(ModuleHandle handle)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto iterator = _modules.find(handle);
+        if (iterator == _modules.end())
+        {
+            return;
+        }
+        _pEngine->RemoveModule(iterator->second);
+        _modules.erase(iterator);
+    }
+
+    uint64_t IRSharedExecutionEngine::GetFunctionAddress(ModuleHandle handle, const std::string& name)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_modules.find(handle) == _modules.end())
+        {
+            return 0;
+        }
+        return _pEngine->GetFunctionAddress(GetSymbolPrefix(handle) + name);
+    }
+
+    uint64_t IRSharedExecutionEngine::ResolveFunctionAddress(ModuleHandle handle, const std::string& name)
+    {
+        auto functionAddress = GetFunctionAddress(handle, name);
+        if (functionAddress == 0)
+        {
+            throw EmitterException(EmitterError::functionNotFound);
+        }
+        return functionAddress;
+    }
+}
+}
@@ -8,6 +8,7 @@
 
 #include "ModuleEmitter.h"
 #include "EmitterException.h"
+#include "TargetTuning.h"
 
 // utilities
 #include "Files.h"
@@ -58,6 +59,11 @@ namespace emitters
     {
         _parameters = parameters;
 
+        if (_parameters.tuningDatabaseFilename != "")
+        {
+            LoadKernelTuningDatabase(_parameters.tuningDatabaseFilename);
+        }
+
         if (_parameters.targetDevice.numBits == 0)
         {
             _parameters.targetDevice.numBits = c_defaultNumBits;
@@ -141,6 +147,10 @@ namespace emitters
         {
             return ModuleOutputFormat::assembly;
         }
+        else if (extension == "o" || extension == "obj")
+        {
+            return ModuleOutputFormat::objectCode;
+        }
         else if (extension == "h")
         {
             return ModuleOutputFormat::cHeader;
@@ -0,0 +1,86 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     TargetTuning.cpp (emitters)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "TargetTuning.h"
+
+// utilities
+#include "Exception.h"
+#include "Files.h"
+
+// stl
+#include <map>
+#include <sstream>
+
+namespace ell
+{
+namespace emitters
+{
+    namespace
+    {
+        std::map<std::string, KernelTuningParameters>& GetTuningDatabase()
+        {
+            // shipped defaults; entries loaded from a user database file are merged over these.
+            // Cortex-M parts have no data cache worth blocking for and little headroom for unrolled
+            // code, so their entries keep the kernels small; the A-class and desktop entries trade
+            // code size for cache blocking, a packed register-tiled GEMM kernel, and a broken-up
+            // reduction dependency chain. The in-order A-class cores also get software prefetches
+            // on large-stride walks, since their hardware prefetchers only track unit-stride
+            // streams; desktop prefetchers handle strides on their own, so x86_64 leaves them off.
+            // The fallback entry leaves the tiled kernel off.
+            static std::map<std::string, KernelTuningParameters> database =
+            {
+                { "cortex-m0", { 0, 0, 4, 0, 0, 0 } },
+                { "cortex-m4", { 0, 2, 4, 0, 0, 0 } },
+                { "cortex-a53", { 64, 4, 8, 4, 128, 8 } },
+                { "cortex-a72", { 128, 4, 8, 4, 256, 4 } },
+                { "x86_64", { 128, 4, 0, 4, 256, 0 } },
+                { "", { 64, 4, 0, 0, 0, 0 } } // fallback when nothing matches
+            };
+            return database;
+        }
+    }
+
+    KernelTuningParameters GetKernelTuningParameters(const TargetDevice& device)
+    {
+        auto& database = GetTuningDatabase();
+        for (const auto& profile : { device.deviceName, device.cpu, device.architecture })
+        {
+            auto entry = database.find(profile);
+            if (!profile.empty() && entry != database.end())
+            {
+                return entry->second;
+            }
+        }
+        return database[""];
+    }
+
+    void LoadKernelTuningDatabase(const std::string& filename)
+    {
+        auto stream = utilities::OpenIfstream(filename);
+        auto& database = GetTuningDatabase();
+
+        std::string line;
+        while (std::getline(stream, line))
+        {
+            if (line.empty() || line[0] == '#')
+            {
+                continue;
+            }
+
+            std::istringstream lineStream(line);
+            std::string profile;
+            KernelTuningParameters parameters;
+            if (!(lineStream >> profile >> parameters.gemmColumnBlockSize >> parameters.gemmUnrollFactor >> parameters.convolutionFilterBatchSize >> parameters.gemmRowTileSize >> parameters.gemmKBlockSize >> parameters.prefetchDistance))
+            {
+                throw utilities::InputException(utilities::InputExceptionErrors::badStringFormat, "Bad tuning database entry: " + line);
+            }
+            database[profile] = parameters;
+        }
+    }
+}
+}
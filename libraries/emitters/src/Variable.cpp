@@ -132,5 +132,24 @@ namespace emitters
                 throw EmitterException(EmitterError::valueTypeNotSupported);
         }
     }
+
+    Variable* VariableAllocator::AddVectorRefVariable(VariableType type, Variable& src, int offset, int size)
+    {
+        switch (type)
+        {
+            case VariableType::Double:
+                return AddVariable<VectorRefVariable<double>>(src, offset, size);
+            case VariableType::Float:
+                return AddVariable<VectorRefVariable<float>>(src, offset, size);
+            case VariableType::Int32:
+                return AddVariable<VectorRefVariable<int>>(src, offset, size);
+            case VariableType::Int64:
+                return AddVariable<VectorRefVariable<int64_t>>(src, offset, size);
+            case VariableType::Byte:
+                return AddVariable<VectorRefVariable<uint8_t>>(src, offset, size);
+            default:
+                throw EmitterException(EmitterError::valueTypeNotSupported);
+        }
+    }
 }
 }
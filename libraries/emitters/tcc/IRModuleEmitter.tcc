@@ -31,6 +31,21 @@ namespace emitters
         return Global(name, _emitter.ArrayType(GetVariableType<ValueType>(), value.size()), _emitter.Literal(value), false);
     }
 
+    template <typename ValueType>
+    llvm::GlobalVariable* IRModuleEmitter::WeightsArray(const std::string& name, const std::vector<ValueType>& value)
+    {
+        auto pGlobal = Global(name, _emitter.ArrayType(GetVariableType<ValueType>(), value.size()), _emitter.Literal(value), false);
+        RecordWeightsEntry(name, pGlobal, value.size() * sizeof(ValueType));
+        return pGlobal;
+    }
+
+    template <typename ValueType>
+    llvm::GlobalVariable* IRModuleEmitter::SharedConstantArray(const std::vector<ValueType>& value)
+    {
+        auto name = ConstantPoolName(static_cast<int>(GetVariableType<ValueType>()), value.data(), value.size() * sizeof(ValueType));
+        return SharedConstant(name, _emitter.ArrayType(GetVariableType<ValueType>(), value.size()), _emitter.Literal(value));
+    }
+
     //
     // Private methods
     //
@@ -99,6 +114,17 @@ namespace emitters
                 _literals.Add(var.EmittedName(), pVal);
                 break;
 
+            case VariableScope::local:
+                if (var.IsVectorRef())
+                {
+                    pVal = EmitRef<T>(static_cast<VectorRefVariable<T>&>(var));
+                }
+                else
+                {
+                    throw EmitterException(EmitterError::variableScopeNotSupported);
+                }
+                break;
+
             case VariableScope::global:
                 if (var.HasInitValue())
                 {
@@ -162,7 +188,12 @@ namespace emitters
     template <typename T>
     llvm::Value* IRModuleEmitter::EmitLiteralVector(LiteralVectorVariable<T>& var)
     {
-        return ConstantArray(var.EmittedName(), var.Data());
+        if (GetCompilerParameters().patchableWeights)
+        {
+            // writable and unpooled, so each logical weight array owns a distinct slice of the blob
+            return WeightsArray(var.EmittedName(), var.Data());
+        }
+        return SharedConstantArray(var.Data());
     }
 
     template <typename T>
@@ -184,5 +215,13 @@ namespace emitters
         llvm::Value* pSrcVar = EnsureEmitted(var.Src());
         return currentFunction.PtrOffsetA(pSrcVar, currentFunction.Literal(var.Offset()), var.EmittedName());
     }
+
+    template <typename T>
+    llvm::Value* IRModuleEmitter::EmitRef(VectorRefVariable<T>& var)
+    {
+        auto& currentFunction = GetCurrentFunction();
+        llvm::Value* pSrcVar = EnsureEmitted(var.Src());
+        return currentFunction.PtrOffsetA(pSrcVar, currentFunction.Literal(var.Offset()), var.EmittedName());
+    }
 }
 }
@@ -28,12 +28,42 @@ namespace emitters
         return GetExpFunction(GetVariableType<ValueType>());
     }
 
+    template <typename ValueType>
+    llvm::Function* IRRuntime::GetFastExpFunction()
+    {
+        return GetFastExpFunction(GetVariableType<ValueType>());
+    }
+
     template <typename ValueType>
     llvm::Function* IRRuntime::GetLogFunction()
     {
         return GetLogFunction(GetVariableType<ValueType>());
     }
 
+    template <typename ValueType>
+    llvm::Function* IRRuntime::GetSoftmaxFunction()
+    {
+        return GetSoftmaxFunction(GetVariableType<ValueType>());
+    }
+
+    template <typename ValueType>
+    llvm::Function* IRRuntime::GetMaxPoolWindowFunction()
+    {
+        return GetMaxPoolWindowFunction(GetVariableType<ValueType>());
+    }
+
+    template <typename ValueType>
+    llvm::Function* IRRuntime::GetQuantizeFunction()
+    {
+        return GetQuantizeFunction(GetVariableType<ValueType>());
+    }
+
+    template <typename ValueType>
+    llvm::Function* IRRuntime::GetDequantizeFunction()
+    {
+        return GetDequantizeFunction(GetVariableType<ValueType>());
+    }
+
     template <typename ValueType>
     llvm::Function* IRRuntime::GetDotProductFunction()
     {
@@ -12,41 +12,58 @@ namespace emitters
 {
     template <typename ValueType, ValueType DefaultValue>
     SymbolTable<ValueType, DefaultValue>::SymbolTable(std::initializer_list<SymbolValue> values)
-        : _map(values)
     {
+        for (const auto& value : values)
+        {
+            Add(value.first, value.second);
+        }
     }
 
     template <typename ValueType, ValueType DefaultValue>
     ValueType SymbolTable<ValueType, DefaultValue>::Get(const std::string& name) const
     {
-        ValueType value = DefaultValue;
-        auto search = _map.find(name);
-        if (search != _map.end())
+        auto slotIndex = FindSlot(HashSymbolName(name), name);
+        return slotIndex == _slots.size() ? DefaultValue : _slots[slotIndex].value;
+    }
+
+    template <typename ValueType, ValueType DefaultValue>
+    ValueType SymbolTable<ValueType, DefaultValue>::Get(const InternedSymbol& symbol) const
+    {
+        auto slotIndex = FindSlot(symbol.GetHash(), symbol.GetName());
+        return slotIndex == _slots.size() ? DefaultValue : _slots[slotIndex].value;
+    }
+
+    template <typename ValueType, ValueType DefaultValue>
+    void SymbolTable<ValueType, DefaultValue>::Add(const std::string& name, ValueType value)
+    {
+        auto hash = HashSymbolName(name);
+        if (FindSlot(hash, name) != _slots.size())
         {
-            value = search->second;
+            throw EmitterException(EmitterError::duplicateSymbol);
         }
-        return value;
+        GrowIfNeeded();
+        Insert(hash, name, std::move(value));
     }
 
     template <typename ValueType, ValueType DefaultValue>
-    void SymbolTable<ValueType, DefaultValue>::Add(const std::string& name, ValueType value)
+    void SymbolTable<ValueType, DefaultValue>::Add(const InternedSymbol& symbol, ValueType value)
     {
-        if (_map.count(name) > 0)
+        if (FindSlot(symbol.GetHash(), symbol.GetName()) != _slots.size())
         {
             throw EmitterException(EmitterError::duplicateSymbol);
         }
-        _map[std::move(name)] = std::move(value);
+        GrowIfNeeded();
+        Insert(symbol.GetHash(), symbol.GetName(), std::move(value));
     }
 
     template <typename ValueType, ValueType DefaultValue>
     std::string SymbolTable<ValueType, DefaultValue>::GetUniqueName(const std::string& namePrefix) const
     {
-        // return namePrefix;
         int index = 0;
-        while(true)
+        while (true)
         {
             auto name = namePrefix + "_" + std::to_string(index);
-            if(!Contains(name))
+            if (!Contains(name))
             {
                 return name;
             }
@@ -60,21 +77,139 @@ namespace emitters
         return (Get(name) != DefaultValue);
     }
 
+    template <typename ValueType, ValueType DefaultValue>
+    bool SymbolTable<ValueType, DefaultValue>::Contains(const InternedSymbol& symbol) const
+    {
+        return (Get(symbol) != DefaultValue);
+    }
 
     template <typename ValueType, ValueType DefaultValue>
     void SymbolTable<ValueType, DefaultValue>::Remove(const std::string& name)
     {
-        auto search = _map.find(name);
-        if (search != _map.end())
+        auto slotIndex = FindSlot(HashSymbolName(name), name);
+        if (slotIndex == _slots.size())
         {
-            _map.erase(search);
+            return;
         }
+
+        // backward-shift deletion: pull displaced slots back toward their home, so probe
+        // sequences stay contiguous without tombstones
+        auto mask = _slots.size() - 1;
+        auto current = slotIndex;
+        auto next = (current + 1) & mask;
+        while (_slots[next].hash != 0 && ProbeDistance(_slots[next].hash, next) > 0)
+        {
+            _slots[current] = std::move(_slots[next]);
+            current = next;
+            next = (next + 1) & mask;
+        }
+        _slots[current] = Slot{};
+        --_count;
     }
 
     template <typename ValueType, ValueType DefaultValue>
     void SymbolTable<ValueType, DefaultValue>::Clear()
     {
-        _map.clear();
+        _slots.clear();
+        _count = 0;
+    }
+
+    template <typename ValueType, ValueType DefaultValue>
+    size_t SymbolTable<ValueType, DefaultValue>::FindSlot(size_t hash, const std::string& name) const
+    {
+        if (_slots.empty())
+        {
+            return _slots.size();
+        }
+
+        auto mask = _slots.size() - 1;
+        auto slotIndex = hash & mask;
+        size_t distance = 0;
+        while (true)
+        {
+            const auto& slot = _slots[slotIndex];
+            if (slot.hash == 0)
+            {
+                return _slots.size();
+            }
+            if (slot.hash == hash && slot.name == name)
+            {
+                return slotIndex;
+            }
+            if (ProbeDistance(slot.hash, slotIndex) < distance)
+            {
+                // robin-hood invariant: a match would have displaced this slot, so stop early
+                return _slots.size();
+            }
+            slotIndex = (slotIndex + 1) & mask;
+            ++distance;
+        }
+    }
+
+    template <typename ValueType, ValueType DefaultValue>
+    void SymbolTable<ValueType, DefaultValue>::Insert(size_t hash, std::string name, ValueType value)
+    {
+        auto mask = _slots.size() - 1;
+        auto slotIndex = hash & mask;
+        size_t distance = 0;
+        while (true)
+        {
+            auto& slot = _slots[slotIndex];
+            if (slot.hash == 0)
+            {
+                slot.hash = hash;
+                slot.name = std::move(name);
+                slot.value = std::move(value);
+                ++_count;
+                return;
+            }
+
+            // robin-hood displacement: take from the rich (short probe) and give to the poor
+            auto slotDistance = ProbeDistance(slot.hash, slotIndex);
+            if (slotDistance < distance)
+            {
+                std::swap(hash, slot.hash);
+                std::swap(name, slot.name);
+                std::swap(value, slot.value);
+                distance = slotDistance;
+            }
+            slotIndex = (slotIndex + 1) & mask;
+            ++distance;
+        }
+    }
+
+    template <typename ValueType, ValueType DefaultValue>
+    size_t SymbolTable<ValueType, DefaultValue>::ProbeDistance(size_t hash, size_t slotIndex) const
+    {
+        auto mask = _slots.size() - 1;
+        return (slotIndex + _slots.size() - (hash & mask)) & mask;
+    }
+
+    template <typename ValueType, ValueType DefaultValue>
+    void SymbolTable<ValueType, DefaultValue>::GrowIfNeeded()
+    {
+        const size_t initialSize = 16;
+        if (_slots.empty())
+        {
+            _slots.resize(initialSize);
+            return;
+        }
+
+        if (4 * (_count + 1) <= 3 * _slots.size()) // max load factor 3/4
+        {
+            return;
+        }
+
+        std::vector<Slot> oldSlots(2 * _slots.size());
+        std::swap(oldSlots, _slots);
+        _count = 0;
+        for (auto& slot : oldSlots)
+        {
+            if (slot.hash != 0)
+            {
+                Insert(slot.hash, std::move(slot.name), std::move(slot.value));
+            }
+        }
     }
 }
 }
@@ -20,6 +20,15 @@ namespace emitters
     {
     }
 
+    //
+    // VectorRefVariable
+    //
+    template <typename T>
+    VectorRefVariable<T>::VectorRefVariable(Variable& src, int offset, int size)
+        : VectorVariable<T>(VariableScope::local, size, Variable::VariableFlags::isVectorRef), _src(src), _offset(offset)
+    {
+    }
+
     //
     // InitializedVectorVariable
     //
@@ -9,6 +9,7 @@
 #pragma once
 
 // stl
+#include <random>
 #include <string>
 #include <vector>
 
@@ -20,6 +21,16 @@ namespace evaluators
     class AUCAggregator
     {
     public:
+        /// <summary> Constructs an aggregator that stores every example and computes the exact AUC. </summary>
+        AUCAggregator() = default;
+
+        /// <summary> Constructs an aggregator that computes AUC over a bounded uniform sample of the examples. </summary>
+        ///
+        /// <param name="maxExamples"> The maximum number of examples to store. Once more than this many
+        /// updates arrive, a uniform reservoir sample is maintained, so memory use and sort cost are
+        /// constant in the dataset size at the price of a small sampling error in the AUC. </param>
+        AUCAggregator(size_t maxExamples);
+
         /// <summary> Updates this aggregator. </summary>
         ///
         /// <param name="prediction"> The real valued prediction. </param>
@@ -51,6 +62,9 @@ namespace evaluators
         };
 
         mutable std::vector<Aggregate> _aggregates; // mutable because Get() const has to sort this vector
+        size_t _maxExamples = 0; // 0 means store everything and compute the exact AUC
+        size_t _count = 0;
+        std::default_random_engine _random;
     };
 }
 }
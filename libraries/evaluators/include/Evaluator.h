@@ -36,6 +36,14 @@ namespace evaluators
         /// <param name="predictor"> The predictor. </param>
         virtual void Evaluate(const PredictorType& predictor) = 0;
 
+        /// <summary> Invokes each of the aggregators on a batch of precomputed predictions (e.g., the batched
+        /// output of a compiled map) and logs the result, without making per-example calls to a predictor. </summary>
+        ///
+        /// <param name="predictions"> The predictions, one per example. </param>
+        /// <param name="labels"> The labels, one per example. </param>
+        /// <param name="weights"> The example weights; if empty, all examples have weight 1. </param>
+        virtual void EvaluateBatch(const std::vector<double>& predictions, const std::vector<double>& labels, const std::vector<double>& weights = {}) = 0;
+
         /// <summary> Gets the goodness of the most recent evaluation, according to the first aggregator. </summary>
         ///
         /// <returns> The goodness of the most recent evaluation. </returns>
@@ -76,6 +84,14 @@ namespace evaluators
         /// <param name="predictor"> The predictor. </param>
         virtual void Evaluate(const PredictorType& predictor) override;
 
+        /// <summary> Invokes each of the aggregators on a batch of precomputed predictions (e.g., the batched
+        /// output of a compiled map) and logs the result, without making per-example calls to a predictor. </summary>
+        ///
+        /// <param name="predictions"> The predictions, one per example. </param>
+        /// <param name="labels"> The labels, one per example. </param>
+        /// <param name="weights"> The example weights; if empty, all examples have weight 1. </param>
+        virtual void EvaluateBatch(const std::vector<double>& predictions, const std::vector<double>& labels, const std::vector<double>& weights = {}) override;
+
         /// <summary> Gets the goodness of the most recent evaluation, according to the first aggregator. </summary>
         ///
         /// <returns> The goodness of the most recent evaluation. </returns>
@@ -103,43 +119,7 @@ namespace evaluators
         template <size_t Index>
         using AggregatorType = typename std::tuple_element<Index, std::tuple<AggregatorTypes...>>::type;
 
-        struct ElementUpdaterParameters
-        {
-            double prediction;
-            double label;
-            double weight;
-        };
-
-        template <typename AggregatorT>
-        class ElementUpdater
-        {
-        public:
-            ElementUpdater(AggregatorT& aggregator, const ElementUpdaterParameters& params);
-            void operator()();
-
-        private:
-            ElementUpdaterParameters _params;
-            AggregatorT& _aggregator;
-        };
-
-        template <typename AggregatorT>
-        class ElementResetter
-        {
-        public:
-            ElementResetter(AggregatorT& aggregator);
-
-            void operator()();
-
-        private:
-            AggregatorT& _aggregator;
-        };
-
-        template <std::size_t Index>
-        auto GetElementUpdateFunction(const ElementUpdaterParameters& params) -> ElementUpdater<AggregatorType<Index>>;
-
-        template <std::size_t Index>
-        auto GetElementResetFunction() -> ElementResetter<AggregatorType<Index>>;
-
+        // updates each aggregator in place, without constructing per-example updater objects
         template <std::size_t... Sequence>
         void DispatchUpdate(double prediction, double label, double weight, std::index_sequence<Sequence...>);
 
@@ -158,6 +138,16 @@ namespace evaluators
         size_t _evaluateCounter = 0;
         typename std::tuple<AggregatorTypes...> _aggregatorTuple;
         std::vector<std::vector<std::vector<double>>> _values;
+
+    private:
+        // runs the hot loop over flat arrays of predictions/labels/weights and logs the aggregated result
+        void UpdateAll(const std::vector<double>& predictions, const std::vector<double>& labels, const std::vector<double>& weights);
+
+        // flat copies of the example metadata, so the hot loop doesn't walk the example objects,
+        // and a prediction buffer whose storage is reused across evaluations
+        std::vector<double> _exampleLabels;
+        std::vector<double> _exampleWeights;
+        std::vector<double> _predictionBuffer;
     };
 
     /// <summary> Makes an evaluator. </summary>
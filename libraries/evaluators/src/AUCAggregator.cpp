@@ -15,9 +15,28 @@ namespace ell
 {
 namespace evaluators
 {
+    AUCAggregator::AUCAggregator(size_t maxExamples)
+        : _maxExamples(maxExamples)
+    {
+    }
+
     void AUCAggregator::Update(double prediction, double label, double weight)
     {
-        _aggregates.push_back(Aggregate{ prediction, label, weight });
+        ++_count;
+        if (_maxExamples == 0 || _aggregates.size() < _maxExamples)
+        {
+            _aggregates.push_back(Aggregate{ prediction, label, weight });
+        }
+        else
+        {
+            // reservoir sampling: replace a random element with probability _maxExamples / _count,
+            // which keeps the stored examples a uniform sample of the examples seen so far
+            auto index = std::uniform_int_distribution<size_t>(0, _count - 1)(_random);
+            if (index < _maxExamples)
+            {
+                _aggregates[index] = Aggregate{ prediction, label, weight };
+            }
+        }
     }
 
     std::vector<double> AUCAggregator::GetResult() const
@@ -58,6 +77,7 @@ namespace evaluators
     void AUCAggregator::Reset()
     {
         _aggregates.resize(0);
+        _count = 0;
     }
 
     bool AUCAggregator::Aggregate::operator<(const Aggregate& other) const
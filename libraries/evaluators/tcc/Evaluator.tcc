@@ -9,7 +9,7 @@
 #include "BinaryErrorAggregator.h"
 
 // utilities
-#include "FunctionUtils.h"
+#include "Exception.h"
 
 namespace ell
 {
@@ -21,6 +21,20 @@ namespace evaluators
     {
         static_assert(sizeof...(AggregatorTypes) > 0, "Evaluator must contains at least one aggregator");
 
+        // copy the example metadata into flat arrays once, so the evaluation hot loop reads
+        // contiguous doubles instead of walking the example objects
+        auto numExamples = _dataset.NumExamples();
+        _exampleLabels.reserve(numExamples);
+        _exampleWeights.reserve(numExamples);
+        auto iterator = _dataset.GetExampleReferenceIterator();
+        while (iterator.IsValid())
+        {
+            const auto& metadata = iterator.Get().GetMetadata();
+            _exampleLabels.push_back(metadata.label);
+            _exampleWeights.push_back(metadata.weight);
+            iterator.Next();
+        }
+
         if (_evaluatorParameters.addZeroEvaluation)
         {
             EvaluateZero();
@@ -36,18 +50,42 @@ namespace evaluators
             return;
         }
 
+        // compute all of the predictions first, then update the aggregators over flat arrays
+        _predictionBuffer.clear();
+        _predictionBuffer.reserve(_dataset.NumExamples());
         auto iterator = _dataset.GetExampleReferenceIterator();
-
         while (iterator.IsValid())
         {
-            const auto& example = iterator.Get();
+            _predictionBuffer.push_back(predictor.Predict(iterator.Get().GetDataVector()));
+            iterator.Next();
+        }
 
-            double weight = example.GetMetadata().weight;
-            double label = example.GetMetadata().label;
-            double prediction = predictor.Predict(example.GetDataVector());
+        UpdateAll(_predictionBuffer, _exampleLabels, _exampleWeights);
+    }
 
-            DispatchUpdate(prediction, label, weight, std::make_index_sequence<sizeof...(AggregatorTypes)>());
-            iterator.Next();
+    template <typename PredictorType, typename... AggregatorTypes>
+    void Evaluator<PredictorType, AggregatorTypes...>::EvaluateBatch(const std::vector<double>& predictions, const std::vector<double>& labels, const std::vector<double>& weights)
+    {
+        ++_evaluateCounter;
+        if (_evaluateCounter % _evaluatorParameters.evaluationFrequency != 0)
+        {
+            return;
+        }
+
+        if (predictions.size() != labels.size())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::sizeMismatch, "number of predictions must match number of labels");
+        }
+        if (!weights.empty() && weights.size() != predictions.size())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::sizeMismatch, "number of weights must match number of predictions");
+        }
+
+        auto numExamples = predictions.size();
+        for (size_t index = 0; index < numExamples; ++index)
+        {
+            double weight = weights.empty() ? 1.0 : weights[index];
+            DispatchUpdate(predictions[index], labels[index], weight, std::make_index_sequence<sizeof...(AggregatorTypes)>());
         }
         Aggregate(std::make_index_sequence<sizeof...(AggregatorTypes)>());
     }
@@ -109,73 +147,30 @@ namespace evaluators
     template <typename PredictorType, typename... AggregatorTypes>
     void Evaluator<PredictorType, AggregatorTypes...>::EvaluateZero()
     {
-        auto iterator = _dataset.GetExampleIterator();
-
-        while (iterator.IsValid())
-        {
-            const auto& example = iterator.Get();
-
-            double weight = example.GetMetadata().weight;
-            double label = example.GetMetadata().label;
-
-            DispatchUpdate(0.0, label, weight, std::make_index_sequence<sizeof...(AggregatorTypes)>());
-            iterator.Next();
-        }
-        Aggregate(std::make_index_sequence<sizeof...(AggregatorTypes)>());
-    }
-
-    template <typename PredictorType, typename... AggregatorTypes>
-    template <typename AggregatorT>
-    Evaluator<PredictorType, AggregatorTypes...>::ElementUpdater<AggregatorT>::ElementUpdater(AggregatorT& aggregator, const ElementUpdaterParameters& params)
-            : _params(params), _aggregator(aggregator) 
-            {
-            }
-
-
-    template <typename PredictorType, typename... AggregatorTypes>
-    template <typename AggregatorT>
-    void Evaluator<PredictorType, AggregatorTypes...>::ElementUpdater<AggregatorT>::operator()()
-    {
-        _aggregator.Update(_params.prediction, _params.label, _params.weight);
-    }
-
-    template <typename PredictorType, typename... AggregatorTypes>
-    template <typename AggregatorT>
-    Evaluator<PredictorType, AggregatorTypes...>::ElementResetter<AggregatorT>::ElementResetter(AggregatorT& aggregator)
-            : _aggregator(aggregator)
-    {
-    }
-
-
-    template <typename PredictorType, typename... AggregatorTypes>
-    template <typename AggregatorT>
-    void Evaluator<PredictorType, AggregatorTypes...>::ElementResetter<AggregatorT>::operator()()
-    {
-        _aggregator.Reset();
+        _predictionBuffer.assign(_dataset.NumExamples(), 0.0);
+        UpdateAll(_predictionBuffer, _exampleLabels, _exampleWeights);
     }
 
     template <typename PredictorType, typename... AggregatorTypes>
-    template <std::size_t Index>
-    auto Evaluator<PredictorType, AggregatorTypes...>::GetElementUpdateFunction(const ElementUpdaterParameters& params) -> ElementUpdater<AggregatorType<Index>>
+    void Evaluator<PredictorType, AggregatorTypes...>::UpdateAll(const std::vector<double>& predictions, const std::vector<double>& labels, const std::vector<double>& weights)
     {
-        return {std::get<Index>(_aggregatorTuple), params};
-    }
-
-    template <typename PredictorType, typename... AggregatorTypes>
-    template <std::size_t Index>
-    auto Evaluator<PredictorType, AggregatorTypes...>::GetElementResetFunction() -> ElementResetter<AggregatorType<Index>>
-    {
-        return {std::get<Index>(_aggregatorTuple)};
+        auto numExamples = predictions.size();
+        for (size_t index = 0; index < numExamples; ++index)
+        {
+            DispatchUpdate(predictions[index], labels[index], weights[index], std::make_index_sequence<sizeof...(AggregatorTypes)>());
+        }
+        Aggregate(std::make_index_sequence<sizeof...(AggregatorTypes)>());
     }
 
     template <typename PredictorType, typename... AggregatorTypes>
     template <std::size_t... Sequence>
     void Evaluator<PredictorType, AggregatorTypes...>::DispatchUpdate(double prediction, double label, double weight, std::index_sequence<Sequence...>)
     {
-        // Call (X.Update(), 0) for each X in _aggregatorTuple
-        ElementUpdaterParameters params{ prediction, label, weight };
-        utilities::InOrderFunctionEvaluator(GetElementUpdateFunction<Sequence>(params)...);
-        // [this, prediction, label, weight]() { std::get<Sequence>(_aggregatorTuple).Update(prediction, label, weight); }...); // GCC bug prevents compilation
+        // Call X.Update() in place for each X in _aggregatorTuple; expanding inside a braced
+        // initializer list guarantees in-order evaluation without building per-example updater objects
+        // (a lambda pack expansion would be more natural, but a GCC bug prevents compilation)
+        int dummy[] = { (std::get<Sequence>(_aggregatorTuple).Update(prediction, label, weight), 0)... };
+        (void)dummy;
     }
 
     template <typename PredictorType, typename... AggregatorTypes>
@@ -185,9 +180,9 @@ namespace evaluators
         // Call X.GetResult() for each X in _aggregatorTuple
         _values.push_back({ std::get<Sequence>(_aggregatorTuple).GetResult()... });
 
-        // Call X.Reset() for each X in _aggregatorTuple
-        utilities::InOrderFunctionEvaluator(GetElementResetFunction<Sequence>()...);
-        // utilities::InOrderFunctionEvaluator([this]() { std::get<Sequence>(_aggregatorTuple).Reset(); }...); // GCC bug prevents compilation
+        // Call X.Reset() in place for each X in _aggregatorTuple
+        int dummy[] = { (std::get<Sequence>(_aggregatorTuple).Reset(), 0)... };
+        (void)dummy;
     }
 
     template <typename PredictorType, typename... AggregatorTypes>
@@ -10,4 +10,6 @@
 namespace ell
 {
 void TestEvaluators();
+void TestAUCAggregator();
+void TestEvaluateBatch();
 }
\ No newline at end of file
@@ -19,13 +19,18 @@
 #include "LinearPredictor.h"
 
 // evaluators
+#include "AUCAggregator.h"
 #include "Evaluator.h"
 
 // testing
 #include "testing.h"
 
+// utilities
+#include "Exception.h"
+
 // stl
 #include <iostream>
+#include <random>
 
 namespace ell
 {
@@ -52,4 +57,81 @@ void TestEvaluators()
     std::cout << "Goodness: " << evaluator->GetGoodness() << std::endl;
     testing::ProcessTest("Evaluator sanity check", !testing::IsEqual(evaluator->GetGoodness(), 0.0, 1e-8));
 }
+
+void TestAUCAggregator()
+{
+    // a perfectly separated stream has AUC 1 no matter which examples the reservoir keeps
+    evaluators::AUCAggregator boundedAggregator(100);
+    for (int i = 0; i < 10000; ++i)
+    {
+        double label = (i % 2 == 0) ? 1.0 : -1.0;
+        double prediction = label + 0.001 * (i % 100);
+        boundedAggregator.Update(prediction, label, 1.0);
+    }
+    testing::ProcessTest("Bounded AUC aggregator on separable stream", testing::IsEqual(boundedAggregator.GetResult()[0], 1.0));
+
+    // on a noisy stream, the sampled AUC must stay close to the exact AUC
+    evaluators::AUCAggregator exactAggregator;
+    boundedAggregator = evaluators::AUCAggregator(2000);
+    std::default_random_engine engine(123);
+    std::normal_distribution<double> noise(0.0, 1.0);
+    for (int i = 0; i < 50000; ++i)
+    {
+        double label = (i % 2 == 0) ? 1.0 : -1.0;
+        double prediction = label + noise(engine);
+        exactAggregator.Update(prediction, label, 1.0);
+        boundedAggregator.Update(prediction, label, 1.0);
+    }
+    double exactAUC = exactAggregator.GetResult()[0];
+    double sampledAUC = boundedAggregator.GetResult()[0];
+    testing::ProcessTest("Bounded AUC aggregator close to exact AUC", testing::IsEqual(exactAUC, sampledAUC, 5.0e-2));
+}
+
+void TestEvaluateBatch()
+{
+    // Create a dataset
+    using ExampleType = data::DenseSupervisedDataset::DatasetExampleType;
+    data::DenseSupervisedDataset dataset;
+    dataset.AddExample(ExampleType{ { 1.0, 1.0 }, data::WeightLabel{ 1.0, -1.0 } });
+    dataset.AddExample(ExampleType{ { -1.0, -1.0 }, data::WeightLabel{ 1.0, 1.0 } });
+    dataset.AddExample(ExampleType{ { 0.5, -0.5 }, data::WeightLabel{ 2.0, 1.0 } });
+
+    evaluators::EvaluatorParameters evaluatorParams{ 1, false };
+    common::LossFunctionArguments lossFunctionArguments;
+    lossFunctionArguments.lossFunction = common::LossFunctionArguments::LossFunction::squared;
+    predictors::LinearPredictor predictor({ 1.0, 1.0 }, 1.0);
+
+    // evaluating a batch of precomputed predictions must agree with evaluating the predictor directly
+    auto evaluator = common::MakeEvaluator<predictors::LinearPredictor>(dataset.GetAnyDataset(), evaluatorParams, lossFunctionArguments);
+    evaluator->Evaluate(predictor);
+
+    auto batchEvaluator = common::MakeEvaluator<predictors::LinearPredictor>(dataset.GetAnyDataset(), evaluatorParams, lossFunctionArguments);
+    std::vector<double> predictions;
+    std::vector<double> labels;
+    std::vector<double> weights;
+    auto iterator = dataset.GetExampleIterator();
+    while (iterator.IsValid())
+    {
+        const auto& example = iterator.Get();
+        predictions.push_back(predictor.Predict(example.GetDataVector()));
+        labels.push_back(example.GetMetadata().label);
+        weights.push_back(example.GetMetadata().weight);
+        iterator.Next();
+    }
+    batchEvaluator->EvaluateBatch(predictions, labels, weights);
+
+    testing::ProcessTest("Batch evaluation matches per-example evaluation", testing::IsEqual(evaluator->GetGoodness(), batchEvaluator->GetGoodness(), 1.0e-8));
+
+    // mismatched batch sizes are rejected
+    bool threw = false;
+    try
+    {
+        batchEvaluator->EvaluateBatch(predictions, std::vector<double>(predictions.size() + 1));
+    }
+    catch (const utilities::InputException&)
+    {
+        threw = true;
+    }
+    testing::ProcessTest("Batch evaluation size mismatch throws", threw);
+}
 }
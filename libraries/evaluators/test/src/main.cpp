@@ -24,6 +24,8 @@ int main()
     try
     {
         TestEvaluators();
+        TestAUCAggregator();
+        TestEvaluateBatch();
     }
     catch (const utilities::Exception& exception)
     {
@@ -8,6 +8,9 @@
 
 #pragma once
 
+// math
+#include "Vector.h"
+
 namespace ell
 {
 namespace functions
@@ -37,6 +40,21 @@ namespace functions
         /// <returns> The loss derivative. </returns>
         double GetDerivative(double prediction, double label) const;
 
+        /// <summary> Returns the sum of losses over a batch of predictions. </summary>
+        ///
+        /// <param name="predictions"> The predictions. </param>
+        /// <param name="labels"> The labels, one per prediction. </param>
+        ///
+        /// <returns> The summed loss. </returns>
+        double operator()(math::ConstVectorReference<double, math::VectorOrientation::column> predictions, math::ConstVectorReference<double, math::VectorOrientation::column> labels) const;
+
+        /// <summary> Computes the loss derivative at each prediction of a batch. </summary>
+        ///
+        /// <param name="predictions"> The predictions. </param>
+        /// <param name="labels"> The labels, one per prediction. </param>
+        /// <param name="derivatives"> [out] The loss derivative at each prediction. </param>
+        void GetDerivative(math::ConstVectorReference<double, math::VectorOrientation::column> predictions, math::ConstVectorReference<double, math::VectorOrientation::column> labels, math::VectorReference<double, math::VectorOrientation::column> derivatives) const;
+
         /// <summary> Returns the value of the loss conjugate at a given point. </summary>
         ///
         /// <param name="dual"> The dual variable. </param>
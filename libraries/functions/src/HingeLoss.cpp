@@ -37,5 +37,25 @@ namespace functions
             return 0.0;
         }
     }
+
+    double HingeLoss::operator()(math::ConstVectorReference<double, math::VectorOrientation::column> predictions, math::ConstVectorReference<double, math::VectorOrientation::column> labels) const
+    {
+        double sum = 0;
+        auto size = predictions.Size();
+        for (size_t i = 0; i < size; ++i)
+        {
+            sum += (*this)(predictions[i], labels[i]);
+        }
+        return sum;
+    }
+
+    void HingeLoss::GetDerivative(math::ConstVectorReference<double, math::VectorOrientation::column> predictions, math::ConstVectorReference<double, math::VectorOrientation::column> labels, math::VectorReference<double, math::VectorOrientation::column> derivatives) const
+    {
+        auto size = predictions.Size();
+        for (size_t i = 0; i < size; ++i)
+        {
+            derivatives[i] = GetDerivative(predictions[i], labels[i]);
+        }
+    }
 }
 }
@@ -49,6 +49,26 @@ namespace functions
         }
     }
 
+    double LogLoss::operator()(math::ConstVectorReference<double, math::VectorOrientation::column> predictions, math::ConstVectorReference<double, math::VectorOrientation::column> labels) const
+    {
+        double sum = 0;
+        auto size = predictions.Size();
+        for (size_t i = 0; i < size; ++i)
+        {
+            sum += (*this)(predictions[i], labels[i]);
+        }
+        return sum;
+    }
+
+    void LogLoss::GetDerivative(math::ConstVectorReference<double, math::VectorOrientation::column> predictions, math::ConstVectorReference<double, math::VectorOrientation::column> labels, math::VectorReference<double, math::VectorOrientation::column> derivatives) const
+    {
+        auto size = predictions.Size();
+        for (size_t i = 0; i < size; ++i)
+        {
+            derivatives[i] = GetDerivative(predictions[i], labels[i]);
+        }
+    }
+
     double LogLoss::Conjugate(double dual, double label) const
     {
         double x = dual * label;
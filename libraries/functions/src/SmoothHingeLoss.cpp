@@ -52,6 +52,26 @@ namespace functions
         }
     }
 
+    double SmoothHingeLoss::operator()(math::ConstVectorReference<double, math::VectorOrientation::column> predictions, math::ConstVectorReference<double, math::VectorOrientation::column> labels) const
+    {
+        double sum = 0;
+        auto size = predictions.Size();
+        for (size_t i = 0; i < size; ++i)
+        {
+            sum += (*this)(predictions[i], labels[i]);
+        }
+        return sum;
+    }
+
+    void SmoothHingeLoss::GetDerivative(math::ConstVectorReference<double, math::VectorOrientation::column> predictions, math::ConstVectorReference<double, math::VectorOrientation::column> labels, math::VectorReference<double, math::VectorOrientation::column> derivatives) const
+    {
+        auto size = predictions.Size();
+        for (size_t i = 0; i < size; ++i)
+        {
+            derivatives[i] = GetDerivative(predictions[i], labels[i]);
+        }
+    }
+
     double SmoothHingeLoss::Conjugate(double dual, double label) const
     {
         double x = dual * label;
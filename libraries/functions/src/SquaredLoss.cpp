@@ -26,6 +26,27 @@ namespace functions
         return prediction - label;
     }
 
+    double SquaredLoss::operator()(math::ConstVectorReference<double, math::VectorOrientation::column> predictions, math::ConstVectorReference<double, math::VectorOrientation::column> labels) const
+    {
+        double sum = 0;
+        auto size = predictions.Size();
+        for (size_t i = 0; i < size; ++i)
+        {
+            double residual = predictions[i] - labels[i];
+            sum += 0.5 * residual * residual;
+        }
+        return sum;
+    }
+
+    void SquaredLoss::GetDerivative(math::ConstVectorReference<double, math::VectorOrientation::column> predictions, math::ConstVectorReference<double, math::VectorOrientation::column> labels, math::VectorReference<double, math::VectorOrientation::column> derivatives) const
+    {
+        auto size = predictions.Size();
+        for (size_t i = 0; i < size; ++i)
+        {
+            derivatives[i] = predictions[i] - labels[i];
+        }
+    }
+
     double SquaredLoss::Conjugate(double dual, double label) const
     {
         return (0.5 * dual + label) * dual;
@@ -97,6 +97,31 @@ void SmoothHingeLossTest()
     testing::ProcessTest("Testing functions::SmoothHingeLoss::GetDerivative(0,-1)", testing::IsEqual(smoothHingeLoss.GetDerivative(0, -1), 1.0));
 }
 
+// checks that the batch loss overloads agree with the scalar ones
+template<typename LossType>
+void BatchLossTest(LossType loss)
+{
+    math::ColumnVector<double> predictions{ -2.0, -0.5, 0.0, 0.5, 2.0 };
+    math::ColumnVector<double> labels{ 1.0, -1.0, 1.0, -1.0, 1.0 };
+    math::ColumnVector<double> derivatives(predictions.Size());
+
+    double scalarSum = 0;
+    for (size_t i = 0; i < predictions.Size(); ++i)
+    {
+        scalarSum += loss(predictions[i], labels[i]);
+    }
+
+    loss.GetDerivative(predictions, labels, derivatives);
+    bool derivativesMatch = true;
+    for (size_t i = 0; i < predictions.Size(); ++i)
+    {
+        derivativesMatch &= testing::IsEqual(derivatives[i], loss.GetDerivative(predictions[i], labels[i]));
+    }
+
+    testing::ProcessTest("Testing " + std::string(typeid(LossType).name()) + " batch operator()", testing::IsEqual(loss(predictions, labels), scalarSum));
+    testing::ProcessTest("Testing " + std::string(typeid(LossType).name()) + " batch GetDerivative()", derivativesMatch);
+}
+
 template<typename LossType>
 void DerivativeTest(LossType loss, double prediction, double label)
 {
@@ -226,6 +251,11 @@ int main()
     DerivativeTest(functions::SquaredLoss(), { -2.0, 0.2, 2.0 }, { -1.0, 0.2, 1.0 });
     DerivativeTest(functions::SmoothHingeLoss(), { -2.0, 0.2, 2.0 }, { -1.0, 2.0, 1.0 });
 
+    BatchLossTest(functions::HingeLoss());
+    BatchLossTest(functions::LogLoss());
+    BatchLossTest(functions::SquaredLoss());
+    BatchLossTest(functions::SmoothHingeLoss());
+
     LossConjugateTest(functions::SquaredLoss(), { -1.0, 0.1, 1.0 }, { -1.0, 0.1, 1.0 }, { -2.0, 0.1, 2.0 });
     LossConjugateTest(functions::LogLoss(), { -1.0, 0.1, 0.0 }, { 1.0, 0.1, 1.0 }, { -2.0, 0.1, 2.0 });
     LossConjugateTest(functions::LogLoss(), { 0.0, 0.1, 1.0 }, { -1.0, 0.1, -1.0 }, { -2.0, 0.1, 2.0 });
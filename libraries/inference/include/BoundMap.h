@@ -0,0 +1,60 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     BoundMap.h (inference)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "CompiledMapLibrary.h"
+
+// stl
+#include <vector>
+
+namespace ell
+{
+namespace inference
+{
+    /// <summary> Owns input and output buffers sized for a loaded compiled map and runs the map
+    /// between them, mirroring the `SetInputValue` / `ComputeOutput` usage of `DynamicMap` without
+    /// the model library. The buffers are allocated once, so steady-state inference doesn't
+    /// allocate. </summary>
+    ///
+    /// <typeparam name="ElementType"> The map's input and output element type; must match the
+    /// type the map was compiled with. </typeparam>
+    template <typename ElementType>
+    class BoundMap
+    {
+    public:
+        /// <summary> Binds buffers to a loaded compiled map. The map library must outlive this
+        /// object. </summary>
+        ///
+        /// <param name="library"> The loaded compiled map. </param>
+        BoundMap(const CompiledMapLibrary& library);
+
+        /// <summary> Returns the input buffer, for writing input values in place. </summary>
+        ///
+        /// <returns> The input buffer, of size `GetInputSize()`. </returns>
+        std::vector<ElementType>& GetInput() { return _input; }
+
+        /// <summary> Copies values into the input buffer. </summary>
+        ///
+        /// <param name="inputValues"> The input values; must match the map's input size. </param>
+        void SetInputValue(const std::vector<ElementType>& inputValues);
+
+        /// <summary> Runs the compiled map on the input buffer. </summary>
+        ///
+        /// <returns> The output buffer, valid until the next call. </returns>
+        const std::vector<ElementType>& ComputeOutput();
+
+    private:
+        const CompiledMapLibrary* _library;
+        std::vector<ElementType> _input;
+        std::vector<ElementType> _output;
+    };
+}
+}
+
+#include "../tcc/BoundMap.tcc"
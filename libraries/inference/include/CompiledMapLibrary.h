@@ -0,0 +1,104 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     CompiledMapLibrary.h (inference)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// stl
+#include <cstddef>
+#include <string>
+
+namespace ell
+{
+namespace inference
+{
+    /// <summary>
+    /// Loads a map that was compiled ahead of time into a shared library and exposes its exported
+    /// model API: the predict entry point, the batch entry point and the size accessors. This is
+    /// the deployment-side counterpart of IRMapCompiler: a binary that only runs pre-compiled
+    /// maps links this library (a few kilobytes, no LLVM) instead of the model/emitters stack,
+    /// and pays no jit or LLVM initialization cost at startup.
+    /// </summary>
+    class CompiledMapLibrary
+    {
+    public:
+        /// <summary> Loads a compiled map from a shared library and resolves its model API. </summary>
+        ///
+        /// <param name="path"> The path of the shared library holding the compiled map. </param>
+        /// <param name="moduleName"> The module name the map was compiled with; the size accessors
+        /// are exported as `<moduleName>_GetInputSize` and so on. </param>
+        /// <param name="mapFunctionName"> The name of the predict function. </param>
+        CompiledMapLibrary(const std::string& path, const std::string& moduleName, const std::string& mapFunctionName = "predict");
+
+        CompiledMapLibrary(const CompiledMapLibrary&) = delete;
+        CompiledMapLibrary& operator=(const CompiledMapLibrary&) = delete;
+        CompiledMapLibrary(CompiledMapLibrary&& other);
+        CompiledMapLibrary& operator=(CompiledMapLibrary&& other);
+        ~CompiledMapLibrary();
+
+        /// <summary> Returns the size of the map's input vector. </summary>
+        ///
+        /// <returns> The input size. </returns>
+        size_t GetInputSize() const;
+
+        /// <summary> Returns the size of the map's output vector. </summary>
+        ///
+        /// <returns> The output size. </returns>
+        size_t GetOutputSize() const;
+
+        /// <summary> Returns the number of nodes in the model the map was compiled from. </summary>
+        ///
+        /// <returns> The number of nodes. </returns>
+        size_t GetNumNodes() const;
+
+        /// <summary> Indicates whether the compiled map exports a batch entry point (scalar-input
+        /// maps don't). </summary>
+        ///
+        /// <returns> true if `PredictBatch` can be called. </returns>
+        bool HasBatchFunction() const { return _predictBatch != nullptr; }
+
+        /// <summary> Runs the compiled map on one input. The element type must match the type the
+        /// map was compiled with. </summary>
+        ///
+        /// <typeparam name="ElementType"> The map's input and output element type. </typeparam>
+        /// <param name="input"> Pointer to `GetInputSize()` input values. </param>
+        /// <param name="output"> Pointer to the output array of `GetOutputSize()` values. </param>
+        template <typename ElementType>
+        void Predict(const ElementType* input, ElementType* output) const;
+
+        /// <summary> Runs the compiled map on a batch of inputs through the batch entry point,
+        /// which loops inside the compiled code. </summary>
+        ///
+        /// <typeparam name="ElementType"> The map's input and output element type. </typeparam>
+        /// <param name="inputs"> Pointer to `count * GetInputSize()` input values. </param>
+        /// <param name="outputs"> Pointer to the output array of `count * GetOutputSize()` values. </param>
+        /// <param name="count"> The number of inputs in the batch. </param>
+        template <typename ElementType>
+        void PredictBatch(const ElementType* inputs, ElementType* outputs, int count) const;
+
+        /// <summary> Resolves an arbitrary symbol exported by the compiled map, such as the
+        /// weight-patching or profiling API functions. </summary>
+        ///
+        /// <param name="name"> The symbol name. </param>
+        ///
+        /// <returns> The symbol's address, or null if the library doesn't export it. </returns>
+        void* ResolveSymbol(const std::string& name) const;
+
+    private:
+        void* RequireSymbol(const std::string& name, const std::string& path) const;
+
+        void* _handle = nullptr;
+        void* _predict = nullptr;
+        void* _predictBatch = nullptr;
+        void* _getInputSize = nullptr;
+        void* _getOutputSize = nullptr;
+        void* _getNumNodes = nullptr;
+    };
+}
+}
+
+#include "../tcc/CompiledMapLibrary.tcc"
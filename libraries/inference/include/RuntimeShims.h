@@ -0,0 +1,26 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     RuntimeShims.h (inference)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+/// <summary>
+/// Hosted implementations of the C runtime shims a compiled map may reference (see IRRuntime):
+/// the clock functions that profiling-enabled and freestanding-profile modules call by symbol.
+/// Linking this library provides one definition of each shim, so a deployment binary doesn't need
+/// the emitters library (or ClockInterface.h, which defines the same symbols - don't use both).
+/// The definitions live in a translation unit rather than a header so that every compiled map in
+/// a process resolves to the same implementation.
+/// </summary>
+extern "C" {
+
+/// <summary> Returns a monotonic timestamp in milliseconds. </summary>
+double ELL_GetSteadyClockMilliseconds();
+
+/// <summary> Returns the wall-clock time in milliseconds since the epoch. </summary>
+double ELL_GetSystemClockMilliseconds();
+}
@@ -0,0 +1,154 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     CompiledMapLibrary.cpp (inference)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "CompiledMapLibrary.h"
+
+// utilities
+#include "Exception.h"
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+namespace ell
+{
+namespace inference
+{
+    namespace
+    {
+        void* OpenLibrary(const std::string& path)
+        {
+#if defined(_WIN32)
+            return LoadLibraryA(path.c_str());
+#else
+            return dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+#endif
+        }
+
+        void CloseLibrary(void* handle)
+        {
+#if defined(_WIN32)
+            FreeLibrary(static_cast<HMODULE>(handle));
+#else
+            dlclose(handle);
+#endif
+        }
+
+        void* FindSymbol(void* handle, const std::string& name)
+        {
+#if defined(_WIN32)
+            return reinterpret_cast<void*>(GetProcAddress(static_cast<HMODULE>(handle), name.c_str()));
+#else
+            return dlsym(handle, name.c_str());
+#endif
+        }
+    }
+
+    CompiledMapLibrary::CompiledMapLibrary(const std::string& path, const std::string& moduleName, const std::string& mapFunctionName)
+    {
+        _handle = OpenLibrary(path);
+        if (_handle == nullptr)
+        {
+            throw utilities::SystemException(utilities::SystemExceptionErrors::fileNotFound, "couldn't load compiled map library: " + path);
+        }
+
+        try
+        {
+            _predict = RequireSymbol(mapFunctionName, path);
+            _getInputSize = RequireSymbol(moduleName + "_GetInputSize", path);
+            _getOutputSize = RequireSymbol(moduleName + "_GetOutputSize", path);
+            _getNumNodes = RequireSymbol(moduleName + "_GetNumNodes", path);
+            _predictBatch = FindSymbol(_handle, mapFunctionName + "_batch"); // optional: scalar-input maps don't export it
+        }
+        catch (...)
+        {
+            CloseLibrary(_handle);
+            _handle = nullptr;
+            throw;
+        }
+    }
+
+    CompiledMapLibrary::CompiledMapLibrary(CompiledMapLibrary&& other)
+        : _handle(other._handle), _predict(other._predict), _predictBatch(other._predictBatch), _getInputSize(other._getInputSize), _getOutputSize(other._getOutputSize), _getNumNodes(other._getNumNodes)
+    {
+        other._handle = nullptr;
+        other._predict = nullptr;
+        other._predictBatch = nullptr;
+        other._getInputSize = nullptr;
+        other._getOutputSize = nullptr;
+        other._getNumNodes = nullptr;
+    }
+
+    CompiledMapLibrary& CompiledMapLibrary::operator=(CompiledMapLibrary&& other)
+    {
+        if (this != &other)
+        {
+            if (_handle != nullptr)
+            {
+                CloseLibrary(_handle);
+            }
+            _handle = other._handle;
+            _predict = other._predict;
+            _predictBatch = other._predictBatch;
+            _getInputSize = other._getInputSize;
+            _getOutputSize = other._getOutputSize;
+            _getNumNodes = other._getNumNodes;
+            other._handle = nullptr;
+            other._predict = nullptr;
+            other._predictBatch = nullptr;
+            other._getInputSize = nullptr;
+            other._getOutputSize = nullptr;
+            other._getNumNodes = nullptr;
+        }
+        return *this;
+    }
+
+    CompiledMapLibrary::~CompiledMapLibrary()
+    {
+        if (_handle != nullptr)
+        {
+            CloseLibrary(_handle);
+        }
+    }
+
+    size_t CompiledMapLibrary::GetInputSize() const
+    {
+        using SizeFunction = int (*)();
+        return static_cast<size_t>(reinterpret_cast<SizeFunction>(_getInputSize)());
+    }
+
+    size_t CompiledMapLibrary::GetOutputSize() const
+    {
+        using SizeFunction = int (*)();
+        return static_cast<size_t>(reinterpret_cast<SizeFunction>(_getOutputSize)());
+    }
+
+    size_t CompiledMapLibrary::GetNumNodes() const
+    {
+        using SizeFunction = int (*)();
+        return static_cast<size_t>(reinterpret_cast<SizeFunction>(_getNumNodes)());
+    }
+
+    void* CompiledMapLibrary::ResolveSymbol(const std::string& name) const
+    {
+        return FindSymbol(_handle, name);
+    }
+
+    void* CompiledMapLibrary::RequireSymbol(const std::string& name, const std::string& path) const
+    {
+        auto symbol = FindSymbol(_handle, name);
+        if (symbol == nullptr)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::badData, "compiled map library " + path + " doesn't export " + name);
+        }
+        return symbol;
+    }
+}
+}
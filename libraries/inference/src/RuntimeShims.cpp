@@ -0,0 +1,25 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     RuntimeShims.cpp (inference)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "RuntimeShims.h"
+
+// stl
+#include <chrono>
+
+extern "C" {
+
+double ELL_GetSteadyClockMilliseconds()
+{
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+double ELL_GetSystemClockMilliseconds()
+{
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+}
+}
@@ -0,0 +1,39 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     BoundMap.tcc (inference)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// utilities
+#include "Exception.h"
+
+namespace ell
+{
+namespace inference
+{
+    template <typename ElementType>
+    BoundMap<ElementType>::BoundMap(const CompiledMapLibrary& library)
+        : _library(&library), _input(library.GetInputSize()), _output(library.GetOutputSize())
+    {
+    }
+
+    template <typename ElementType>
+    void BoundMap<ElementType>::SetInputValue(const std::vector<ElementType>& inputValues)
+    {
+        if (inputValues.size() != _input.size())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::sizeMismatch, "input size doesn't match the compiled map's input size");
+        }
+        _input = inputValues;
+    }
+
+    template <typename ElementType>
+    const std::vector<ElementType>& BoundMap<ElementType>::ComputeOutput()
+    {
+        _library->Predict(_input.data(), _output.data());
+        return _output;
+    }
+}
+}
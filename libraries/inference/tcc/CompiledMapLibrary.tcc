@@ -0,0 +1,34 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     CompiledMapLibrary.tcc (inference)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// utilities
+#include "Exception.h"
+
+namespace ell
+{
+namespace inference
+{
+    template <typename ElementType>
+    void CompiledMapLibrary::Predict(const ElementType* input, ElementType* output) const
+    {
+        using PredictFunction = void (*)(const ElementType*, ElementType*);
+        reinterpret_cast<PredictFunction>(_predict)(input, output);
+    }
+
+    template <typename ElementType>
+    void CompiledMapLibrary::PredictBatch(const ElementType* inputs, ElementType* outputs, int count) const
+    {
+        if (_predictBatch == nullptr)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "compiled map doesn't export a batch entry point");
+        }
+        using BatchFunction = void (*)(const ElementType*, ElementType*, int);
+        reinterpret_cast<BatchFunction>(_predictBatch)(inputs, outputs, count);
+    }
+}
+}
@@ -0,0 +1,48 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     InferenceTestMap.cpp (inference_test)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// A stand-in for a map compiled ahead of time by IRMapCompiler: exports the same model API
+// (predict, predict_batch and the size accessors, module name "stub") so the loader can be tested
+// without the compiler toolchain.
+
+#if defined(_WIN32)
+#define TEST_MAP_EXPORT __declspec(dllexport)
+#else
+#define TEST_MAP_EXPORT
+#endif
+
+extern "C" {
+
+TEST_MAP_EXPORT int stub_GetInputSize()
+{
+    return 3;
+}
+
+TEST_MAP_EXPORT int stub_GetOutputSize()
+{
+    return 1;
+}
+
+TEST_MAP_EXPORT int stub_GetNumNodes()
+{
+    return 4;
+}
+
+TEST_MAP_EXPORT void predict(const double* input, double* output)
+{
+    output[0] = input[0] + 2 * input[1] + 3 * input[2];
+}
+
+TEST_MAP_EXPORT void predict_batch(const double* inputs, double* outputs, int count)
+{
+    for (int i = 0; i < count; ++i)
+    {
+        predict(inputs + i * 3, outputs + i);
+    }
+}
+}
@@ -0,0 +1,105 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     main.cpp (inference_test)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// inference
+#include "BoundMap.h"
+#include "CompiledMapLibrary.h"
+
+// utilities
+#include "Exception.h"
+
+// testing
+#include "testing.h"
+
+// stl
+#include <vector>
+
+using namespace ell;
+
+void TestCompiledMapLibrary()
+{
+    inference::CompiledMapLibrary library(INFERENCE_TEST_MAP_LIBRARY, "stub");
+    testing::ProcessTest("CompiledMapLibrary::GetInputSize()", library.GetInputSize() == 3);
+    testing::ProcessTest("CompiledMapLibrary::GetOutputSize()", library.GetOutputSize() == 1);
+    testing::ProcessTest("CompiledMapLibrary::GetNumNodes()", library.GetNumNodes() == 4);
+    testing::ProcessTest("CompiledMapLibrary::HasBatchFunction()", library.HasBatchFunction());
+
+    std::vector<double> input{ 1, 2, 3 };
+    double output = 0;
+    library.Predict(input.data(), &output);
+    testing::ProcessTest("CompiledMapLibrary::Predict()", output == 14);
+
+    std::vector<double> batchInputs{ 1, 2, 3, 1, 0, 0 };
+    std::vector<double> batchOutputs(2);
+    library.PredictBatch(batchInputs.data(), batchOutputs.data(), 2);
+    testing::ProcessTest("CompiledMapLibrary::PredictBatch()", batchOutputs[0] == 14 && batchOutputs[1] == 1);
+
+    testing::ProcessTest("CompiledMapLibrary::ResolveSymbol()", library.ResolveSymbol("predict") != nullptr && library.ResolveSymbol("noSuchSymbol") == nullptr);
+}
+
+void TestCompiledMapLibraryErrors()
+{
+    bool missingLibraryThrew = false;
+    try
+    {
+        inference::CompiledMapLibrary missing("noSuchLibrary.dll", "stub");
+    }
+    catch (const utilities::SystemException&)
+    {
+        missingLibraryThrew = true;
+    }
+    testing::ProcessTest("CompiledMapLibrary missing library throws", missingLibraryThrew);
+
+    bool missingSymbolThrew = false;
+    try
+    {
+        inference::CompiledMapLibrary wrongModule(INFERENCE_TEST_MAP_LIBRARY, "noSuchModule");
+    }
+    catch (const utilities::InputException&)
+    {
+        missingSymbolThrew = true;
+    }
+    testing::ProcessTest("CompiledMapLibrary missing symbol throws", missingSymbolThrew);
+}
+
+void TestBoundMap()
+{
+    inference::CompiledMapLibrary library(INFERENCE_TEST_MAP_LIBRARY, "stub");
+    inference::BoundMap<double> map(library);
+
+    map.SetInputValue({ 1, 2, 3 });
+    testing::ProcessTest("BoundMap::ComputeOutput()", map.ComputeOutput() == std::vector<double>{ 14 });
+
+    map.GetInput()[0] = 4;
+    testing::ProcessTest("BoundMap::ComputeOutput() after in-place input update", map.ComputeOutput() == std::vector<double>{ 17 });
+
+    bool sizeMismatchThrew = false;
+    try
+    {
+        map.SetInputValue({ 1, 2 });
+    }
+    catch (const utilities::InputException&)
+    {
+        sizeMismatchThrew = true;
+    }
+    testing::ProcessTest("BoundMap::SetInputValue() size mismatch throws", sizeMismatchThrew);
+}
+
+int main()
+{
+    TestCompiledMapLibrary();
+    TestCompiledMapLibraryErrors();
+    TestBoundMap();
+
+    if (testing::DidTestFail())
+    {
+        return 1;
+    }
+
+    return 0;
+}
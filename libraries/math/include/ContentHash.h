@@ -0,0 +1,66 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ContentHash.h (math)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Matrix.h"
+#include "Tensor.h"
+#include "Vector.h"
+
+// utilities
+#include "FastHash.h"
+
+// stl
+#include <cstdint>
+
+namespace ell
+{
+namespace math
+{
+    /// <summary> Hashes a vector's dimension and contents. Two vectors with equal contents hash
+    /// equally regardless of their stride, so a fingerprint doesn't depend on where the data
+    /// lives; contiguous vectors hash at memory bandwidth. </summary>
+    ///
+    /// <typeparam name="ElementType"> The element type. </typeparam>
+    /// <typeparam name="orientation"> The vector orientation. </typeparam>
+    /// <param name="vector"> The vector to hash. </param>
+    /// <param name="seed"> The seed. </param>
+    ///
+    /// <returns> The 64-bit content hash. </returns>
+    template <typename ElementType, VectorOrientation orientation>
+    uint64_t HashContents(ConstVectorReference<ElementType, orientation> vector, uint64_t seed = 0);
+
+    /// <summary> Hashes a matrix's dimensions and contents, in the matrix's storage order. Two
+    /// matrices with the same layout and equal contents hash equally regardless of any interval
+    /// padding; contiguous matrices hash at memory bandwidth. </summary>
+    ///
+    /// <typeparam name="ElementType"> The element type. </typeparam>
+    /// <typeparam name="layout"> The matrix layout. </typeparam>
+    /// <param name="matrix"> The matrix to hash. </param>
+    /// <param name="seed"> The seed. </param>
+    ///
+    /// <returns> The 64-bit content hash. </returns>
+    template <typename ElementType, MatrixLayout layout>
+    uint64_t HashContents(ConstMatrixReference<ElementType, layout> matrix, uint64_t seed = 0);
+
+    /// <summary> Hashes a tensor's dimensions and contents, by hashing its matrix view. </summary>
+    ///
+    /// <typeparam name="ElementType"> The element type. </typeparam>
+    /// <typeparam name="dimension0"> Tensor dimension 0. </typeparam>
+    /// <typeparam name="dimension1"> Tensor dimension 1. </typeparam>
+    /// <typeparam name="dimension2"> Tensor dimension 2. </typeparam>
+    /// <param name="tensor"> The tensor to hash. </param>
+    /// <param name="seed"> The seed. </param>
+    ///
+    /// <returns> The 64-bit content hash. </returns>
+    template <typename ElementType, Dimension dimension0, Dimension dimension1, Dimension dimension2>
+    uint64_t HashContents(ConstTensorReference<ElementType, dimension0, dimension1, dimension2> tensor, uint64_t seed = 0);
+}
+}
+
+#include "../tcc/ContentHash.tcc"
@@ -0,0 +1,83 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     FastMath.h (math)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// stl
+#include <cstddef>
+
+namespace ell
+{
+namespace math
+{
+    /// <summary>
+    /// Fast polynomial approximations of the transcendental functions that dominate neural
+    /// inference (exp, and the sigmoid and tanh activations built on it). The scalar forms are
+    /// branch-free, so the vector forms below auto-vectorize cleanly; both are accurate to about
+    /// single precision (relative error below 1e-6), which is ample for activations and softmax.
+    /// Use std::exp and friends when full double precision matters.
+    /// </summary>
+    struct FastMath
+    {
+        /// <summary> Approximates exp(x). Arguments are clamped to roughly [-87, 88] (the range
+        /// representable in single precision), so large negative inputs flush to zero and large
+        /// positive inputs saturate instead of overflowing. </summary>
+        ///
+        /// <typeparam name="ElementType"> Element type, float or double. </typeparam>
+        /// <param name="x"> The exponent. </param>
+        ///
+        /// <returns> An approximation of e^x. </returns>
+        template <typename ElementType>
+        static ElementType Exp(ElementType x);
+
+        /// <summary> Approximates the logistic sigmoid 1 / (1 + exp(-x)). </summary>
+        ///
+        /// <typeparam name="ElementType"> Element type, float or double. </typeparam>
+        /// <param name="x"> The input value. </param>
+        ///
+        /// <returns> An approximation of sigmoid(x). </returns>
+        template <typename ElementType>
+        static ElementType Sigmoid(ElementType x);
+
+        /// <summary> Approximates the hyperbolic tangent. </summary>
+        ///
+        /// <typeparam name="ElementType"> Element type, float or double. </typeparam>
+        /// <param name="x"> The input value. </param>
+        ///
+        /// <returns> An approximation of tanh(x). </returns>
+        template <typename ElementType>
+        static ElementType Tanh(ElementType x);
+
+        /// <summary> Applies the exp approximation in place to a contiguous vector. </summary>
+        ///
+        /// <typeparam name="ElementType"> Element type, float or double. </typeparam>
+        /// <param name="v"> [in,out] Pointer to the first element of the vector. </param>
+        /// <param name="size"> The number of elements in the vector. </param>
+        template <typename ElementType>
+        static void Exp(ElementType* v, size_t size);
+
+        /// <summary> Applies the sigmoid approximation in place to a contiguous vector. </summary>
+        ///
+        /// <typeparam name="ElementType"> Element type, float or double. </typeparam>
+        /// <param name="v"> [in,out] Pointer to the first element of the vector. </param>
+        /// <param name="size"> The number of elements in the vector. </param>
+        template <typename ElementType>
+        static void Sigmoid(ElementType* v, size_t size);
+
+        /// <summary> Applies the tanh approximation in place to a contiguous vector. </summary>
+        ///
+        /// <typeparam name="ElementType"> Element type, float or double. </typeparam>
+        /// <param name="v"> [in,out] Pointer to the first element of the vector. </param>
+        /// <param name="size"> The number of elements in the vector. </param>
+        template <typename ElementType>
+        static void Tanh(ElementType* v, size_t size);
+    };
+}
+}
+
+#include "../tcc/FastMath.tcc"
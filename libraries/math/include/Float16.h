@@ -0,0 +1,76 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     Float16.h (math)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// stl
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ell
+{
+namespace math
+{
+    /// <summary>
+    /// An IEEE 754 half-precision value, used as a storage format: values are stored in 16 bits
+    /// and widened to float for computation, halving the memory footprint and bandwidth of large
+    /// read-mostly buffers (weights, activations) at the cost of reduced precision (11 significant
+    /// bits, exponent range roughly 6e-5 to 65504). The conversions are portable bit manipulation;
+    /// no arithmetic is defined on the type itself.
+    /// </summary>
+    struct Float16
+    {
+        uint16_t bits = 0;
+    };
+
+    /// <summary> Widens a half-precision value to single precision (exact). </summary>
+    ///
+    /// <param name="value"> The half-precision value. </param>
+    ///
+    /// <returns> The single-precision value. </returns>
+    float ToFloat32(Float16 value);
+
+    /// <summary> Narrows a single-precision value to half precision, rounding to nearest even.
+    /// Values above the half-precision range become infinity, values below the smallest subnormal
+    /// flush to zero, and NaN stays NaN. </summary>
+    ///
+    /// <param name="value"> The single-precision value. </param>
+    ///
+    /// <returns> The half-precision value. </returns>
+    Float16 ToFloat16(float value);
+
+    /// <summary> Narrows a contiguous array of single-precision values to half precision. </summary>
+    ///
+    /// <param name="values"> Pointer to the first single-precision value. </param>
+    /// <param name="size"> The number of values. </param>
+    ///
+    /// <returns> The half-precision values. </returns>
+    std::vector<Float16> ToFloat16(const float* values, size_t size);
+
+    /// <summary> Widens a contiguous array of half-precision values to single precision. </summary>
+    ///
+    /// <param name="values"> Pointer to the first half-precision value. </param>
+    /// <param name="size"> The number of values. </param>
+    /// <param name="output"> Pointer to the output array of `size` single-precision values. </param>
+    void ToFloat32(const Float16* values, size_t size, float* output);
+
+    /// <summary> Rounds a value through half precision, returning the value that half-precision
+    /// storage would reproduce. </summary>
+    ///
+    /// <typeparam name="ElementType"> Element type, float or double. </typeparam>
+    /// <param name="value"> The value to round. </param>
+    ///
+    /// <returns> The value after a round trip through half precision. </returns>
+    template <typename ElementType>
+    ElementType RoundToFloat16(ElementType value)
+    {
+        return static_cast<ElementType>(ToFloat32(ToFloat16(static_cast<float>(value))));
+    }
+}
+}
@@ -10,6 +10,7 @@
 #include "Vector.h"
 
 // utilities
+#include "HugePageAllocator.h"
 #include "IArchivable.h"
 
 // stl
@@ -104,16 +105,19 @@ namespace math
         MatrixBase(size_t numRows, size_t numColumns, ElementType* pData = nullptr);
 
     protected:
+        void Swap(MatrixBase<ElementType, MatrixLayout::columnMajor>& other);
+
         using RectangularMatrixBase<ElementType>::_numRows;
         using RectangularMatrixBase<ElementType>::_numColumns;
         using RectangularMatrixBase<ElementType>::_increment;
 
         static constexpr VectorOrientation _intervalOrientation = VectorOrientation::column;
 
-        const size_t _numIntervals = _numColumns;
-        const size_t _intervalSize = _numRows;
+        // cached copies of the layout at construction time; Swap must keep them in sync
+        size_t _numIntervals = _numColumns;
+        size_t _intervalSize = _numRows;
         static constexpr size_t _rowIncrement = 1;
-        const size_t _columnIncrement = _increment;
+        size_t _columnIncrement = _increment;
     };
 
     /// <summary> Base class for row major rectangular dense matrices. </summary>
@@ -133,15 +137,18 @@ namespace math
         MatrixBase(size_t numRows, size_t numColumns, ElementType* pData = nullptr);
 
     protected:
+        void Swap(MatrixBase<ElementType, MatrixLayout::rowMajor>& other);
+
         using RectangularMatrixBase<ElementType>::_numRows;
         using RectangularMatrixBase<ElementType>::_numColumns;
         using RectangularMatrixBase<ElementType>::_increment;
 
         static constexpr VectorOrientation _intervalOrientation = VectorOrientation::row;
 
-        const size_t _numIntervals = _numRows;
-        const size_t _intervalSize = _numColumns;
-        const size_t _rowIncrement = _increment;
+        // cached copies of the layout at construction time; Swap must keep them in sync
+        size_t _numIntervals = _numRows;
+        size_t _intervalSize = _numColumns;
+        size_t _rowIncrement = _increment;
         static constexpr size_t _columnIncrement = 1;
     };
 
@@ -620,15 +627,13 @@ namespace math
         /// <param name="other"> The matrix being copied. </param>
         Matrix(ConstMatrixReference<ElementType, TransposeMatrixLayout<layout>::value> other);
 
-        /// <summary> Assignment operator. </summary>
+        /// <summary> Assignment operator (copy-and-swap, so it also accepts rvalues). </summary>
         ///
         /// <param name="other"> The other matrix. </param>
         ///
         /// <returns> A reference to this matrix. </returns>
         Matrix<ElementType, layout>& operator=(Matrix<ElementType, layout> other);
 
-        Matrix<ElementType, layout>& operator=(Matrix<ElementType, layout>&& other) = default;
-
         /// <summary> Swaps the contents of this matrix with the contents of another matrix. </summary>
         ///
         /// <param name="other"> [in,out] The other matrix. </param>
@@ -637,14 +642,14 @@ namespace math
         /// <summary> Returns a copy of the contents of the Matrix. </summary>
         ///
         /// <returns> A std::vector with a copy of the contents of the Matrix. </returns>
-        std::vector<ElementType> ToArray() const { return _data; }
+        std::vector<ElementType> ToArray() const { return { _data.begin(), _data.end() }; }
 
     private:
         using RectangularMatrixBase<ElementType>::_pData;
         using RectangularMatrixBase<ElementType>::_numRows;
         using RectangularMatrixBase<ElementType>::_numColumns;
         using RectangularMatrixBase<ElementType>::_increment;
-        std::vector<ElementType> _data;
+        utilities::HugePageVector<ElementType> _data; // huge-page backed, since weight matrices dominate memory residency
     };
 
     /// <summary> A class that implements helper functions for archiving/unarchiving Matrix instances. </summary>
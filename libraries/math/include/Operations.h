@@ -129,9 +129,26 @@ namespace math
     enum class ImplementationType
     {
         native,
+        nativeParallel,
         openBlas
     };
 
+    /// <summary> Blocking and threading parameters for the parallel native matrix-matrix multiply. </summary>
+    struct GemmBlockParameters
+    {
+        /// <summary> Number of rows of C computed per cache block. </summary>
+        size_t rowBlockSize = 64;
+
+        /// <summary> Number of columns of C computed per cache block. </summary>
+        size_t columnBlockSize = 128;
+
+        /// <summary> Extent of the inner (shared) dimension processed per cache block. </summary>
+        size_t innerBlockSize = 256;
+
+        /// <summary> Number of worker threads, or zero to use the hardware concurrency. </summary>
+        size_t numThreads = 0;
+    };
+
     /// <summary> Forward declaration of OperationsImplementation, for subsequent specialization. </summary>
     ///
     /// <typeparam name="implementation"> Type of implementation. </typeparam>
@@ -216,6 +233,20 @@ namespace math
         template <typename ElementType, MatrixLayout layout>
         static void Multiply(ElementType s, ConstMatrixReference<ElementType, layout> M, ConstVectorReference<ElementType, VectorOrientation::column> v, ElementType t, VectorReference<ElementType, VectorOrientation::column> u);
 
+        /// <summary> Generalized matrix column-vector multiplication without argument validation,
+        /// u = s * M * v + t * u. The checked `Multiply` overload validates and then calls this;
+        /// call sites that have already established the operand sizes can call it directly. </summary>
+        ///
+        /// <typeparam name="ElementType"> Matrix and vector element type. </typeparam>
+        /// <typeparam name="layout"> Matrix layout. </typeparam>
+        /// <param name="s"> The scalar that multiplies the matrix. </param>
+        /// <param name="M"> The matrix. </param>
+        /// <param name="v"> The column vector that multiplies the matrix on the right. </param>
+        /// <param name="t"> The scalar that multiplies the left hand side vector u. </param>
+        /// <param name="u"> [in,out] A column vector, multiplied by t and used to store the result. </param>
+        template <typename ElementType, MatrixLayout layout>
+        static void MultiplyUnchecked(ElementType s, ConstMatrixReference<ElementType, layout> M, ConstVectorReference<ElementType, VectorOrientation::column> v, ElementType t, VectorReference<ElementType, VectorOrientation::column> u);
+
         /// <summary> Generalized matrix matrix multiplication, C = s * A * B + t * C. </summary>
         ///
         /// <typeparam name="ElementType"> Matrix element type. </typeparam>
@@ -230,6 +261,57 @@ namespace math
         static void Multiply(ElementType s, ConstMatrixReference<ElementType, layoutA> A, ConstMatrixReference<ElementType, layoutB> B, ElementType t, MatrixReference<ElementType, layoutA> C);
     };
 
+    /// <summary>
+    /// Multithreaded native implementation of vector and matrix operations. Identical to the native
+    /// implementation except for matrix-matrix multiplication, which uses a cache-blocked kernel and
+    /// partitions the output across worker threads.
+    /// </summary>
+    template <>
+    struct OperationsImplementation<ImplementationType::nativeParallel> : public OperationsImplementation<ImplementationType::native>
+    {
+        using CommonOperations::Add;
+        using DerivedOperations<OperationsImplementation<ImplementationType::native>>::Add;
+        using DerivedOperations<OperationsImplementation<ImplementationType::native>>::Multiply;
+        using DerivedOperations<OperationsImplementation<ImplementationType::native>>::MultiplyAdd;
+        using OperationsImplementation<ImplementationType::native>::Multiply;
+
+        /// <summary> Gets the implementation name. </summary>
+        ///
+        /// <returns> The implementation name. </returns>
+        static std::string GetImplementationName() { return "NativeParallel"; }
+
+        /// <summary> Generalized matrix matrix multiplication, C = s * A * B + t * C, blocked and multithreaded. </summary>
+        ///
+        /// <typeparam name="ElementType"> Matrix element type. </typeparam>
+        /// <typeparam name="layoutA"> Matrix layout of first matrix. </typeparam>
+        /// <typeparam name="layoutB"> Matrix layout of second matrix. </typeparam>
+        /// <param name="s"> The scalar that multiplies the matrix. </param>
+        /// <param name="A"> The first matrix. </param>
+        /// <param name="B"> The second matrix. </param>
+        /// <param name="t"> The scalar that multiplies C. </param>
+        /// <param name="C"> [in,out] A matrix, multiplied by t and used to store the result in the layout of first matrix. </param>
+        template <typename ElementType, MatrixLayout layoutA, MatrixLayout layoutB>
+        static void Multiply(ElementType s, ConstMatrixReference<ElementType, layoutA> A, ConstMatrixReference<ElementType, layoutB> B, ElementType t, MatrixReference<ElementType, layoutA> C);
+
+        /// <summary> Generalized matrix matrix multiplication, C = s * A * B + t * C, with explicit blocking parameters. </summary>
+        ///
+        /// <typeparam name="ElementType"> Matrix element type. </typeparam>
+        /// <typeparam name="layoutA"> Matrix layout of first matrix. </typeparam>
+        /// <typeparam name="layoutB"> Matrix layout of second matrix. </typeparam>
+        /// <param name="s"> The scalar that multiplies the matrix. </param>
+        /// <param name="A"> The first matrix. </param>
+        /// <param name="B"> The second matrix. </param>
+        /// <param name="t"> The scalar that multiplies C. </param>
+        /// <param name="C"> [in,out] A matrix, multiplied by t and used to store the result in the layout of first matrix. </param>
+        /// <param name="parameters"> Blocking and threading parameters. </param>
+        template <typename ElementType, MatrixLayout layoutA, MatrixLayout layoutB>
+        static void Multiply(ElementType s, ConstMatrixReference<ElementType, layoutA> A, ConstMatrixReference<ElementType, layoutB> B, ElementType t, MatrixReference<ElementType, layoutA> C, GemmBlockParameters parameters);
+
+    private:
+        template <typename ElementType, MatrixLayout layoutA, MatrixLayout layoutB>
+        static void MultiplyRowBand(ElementType s, ConstMatrixReference<ElementType, layoutA> A, ConstMatrixReference<ElementType, layoutB> B, ElementType t, MatrixReference<ElementType, layoutA> C, size_t firstRow, size_t numRows, const GemmBlockParameters& parameters);
+    };
+
 #ifdef USE_BLAS
     /// OpenBlas implementation of vector and matrix operations. Function arguments follow the following
     /// naming conventions: r,s,t represent scalars; u,v,w represent vectors; M,A,B represent matrices.
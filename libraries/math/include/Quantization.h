@@ -0,0 +1,60 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     Quantization.h (math)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// stl
+#include <cstddef>
+#include <cstdint>
+
+namespace ell
+{
+namespace math
+{
+    /// <summary> Returns the largest absolute value in a contiguous array, typically used to pick
+    /// a quantization scale. Returns 0 for an empty array. </summary>
+    ///
+    /// <typeparam name="ElementType"> The element type, float or double. </typeparam>
+    /// <param name="values"> Pointer to the first value. </param>
+    /// <param name="size"> The number of values. </param>
+    ///
+    /// <returns> The largest absolute value. </returns>
+    template <typename ElementType>
+    ElementType MaxAbsValue(const ElementType* values, size_t size);
+
+    /// <summary> Quantizes a contiguous array to int8: each value is divided by the scale, rounded
+    /// to the nearest integer, shifted by the zero point and saturated to [-128, 127]. With a zero
+    /// point of 0 and a scale of maxAbs / 127 the saturation never engages; it protects the
+    /// conversion when values exceed the range the scale was chosen for. The loop body is a
+    /// divide-free multiply, round and clamp per element, so compilers vectorize it. </summary>
+    ///
+    /// <typeparam name="ElementType"> The element type, float or double. </typeparam>
+    /// <param name="input"> Pointer to the first input value. </param>
+    /// <param name="output"> Pointer to the output array of `size` int8 values. </param>
+    /// <param name="size"> The number of values. </param>
+    /// <param name="scale"> The quantization scale; one int8 step represents this much. </param>
+    /// <param name="zeroPoint"> The int8 value that represents zero. </param>
+    template <typename ElementType>
+    void QuantizeValues(const ElementType* input, int8_t* output, size_t size, ElementType scale, int8_t zeroPoint = 0);
+
+    /// <summary> Dequantizes a contiguous int8 array: each value is shifted by the zero point and
+    /// multiplied by the scale. The exact inverse of `QuantizeValues` up to the rounding it
+    /// performed. </summary>
+    ///
+    /// <typeparam name="ElementType"> The element type, float or double. </typeparam>
+    /// <param name="input"> Pointer to the first int8 value. </param>
+    /// <param name="output"> Pointer to the output array of `size` values. </param>
+    /// <param name="size"> The number of values. </param>
+    /// <param name="scale"> The quantization scale; one int8 step represents this much. </param>
+    /// <param name="zeroPoint"> The int8 value that represents zero. </param>
+    template <typename ElementType>
+    void DequantizeValues(const int8_t* input, ElementType* output, size_t size, ElementType scale, int8_t zeroPoint = 0);
+}
+}
+
+#include "../tcc/Quantization.tcc"
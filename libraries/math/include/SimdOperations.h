@@ -0,0 +1,112 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     SimdOperations.h (math)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// stl
+#include <cstddef>
+
+namespace ell
+{
+namespace math
+{
+    /// <summary>
+    /// Queries the processor for SIMD capabilities at runtime. The result is computed once and
+    /// cached, so repeated calls are cheap enough to use inside the native operation kernels:
+    /// the intrinsics-based kernels below check it on entry and fall back to their scalar
+    /// versions when the processor lacks the instruction set targeted at compile time.
+    /// </summary>
+    struct SimdSupport
+    {
+        /// <summary> Checks whether the vectorized kernels can run on the current processor. </summary>
+        ///
+        /// <returns> true if the instruction set targeted at compile time is available at runtime. </returns>
+        static bool HasVectorInstructions();
+    };
+
+    /// <summary>
+    /// Vectorized kernels for dense, contiguous (unit-increment) data. These are the workhorses
+    /// behind the native implementations in Operations.h, used when BLAS is unavailable or when
+    /// the operands are small enough that BLAS call overhead dominates. Each kernel has an
+    /// intrinsics-based implementation for AVX2 (x86) and NEON (ARM), and falls back to an
+    /// unrolled scalar loop elsewhere.
+    /// </summary>
+    struct SimdKernels
+    {
+        /// <summary> Adds a scaled contiguous vector to another, u += s * v. </summary>
+        ///
+        /// <typeparam name="ElementType"> Vector element type. </typeparam>
+        /// <param name="s"> The scalar that multiplies v. </param>
+        /// <param name="v"> Pointer to the first element of the right hand side vector. </param>
+        /// <param name="u"> [in,out] Pointer to the first element of the left hand side vector. </param>
+        /// <param name="size"> The number of elements in each vector. </param>
+        template <typename ElementType>
+        static void AddScaled(ElementType s, const ElementType* v, ElementType* u, size_t size);
+
+        /// <summary> Computes the dot product of two contiguous vectors. </summary>
+        ///
+        /// <typeparam name="ElementType"> Vector element type. </typeparam>
+        /// <param name="u"> Pointer to the first element of the first vector. </param>
+        /// <param name="v"> Pointer to the first element of the second vector. </param>
+        /// <param name="size"> The number of elements in each vector. </param>
+        ///
+        /// <returns> The dot product. </returns>
+        template <typename ElementType>
+        static ElementType Dot(const ElementType* u, const ElementType* v, size_t size);
+
+        /// <summary> Multiplies a contiguous vector by a scalar, v *= s. </summary>
+        ///
+        /// <typeparam name="ElementType"> Vector element type. </typeparam>
+        /// <param name="s"> The scalar that multiplies the vector. </param>
+        /// <param name="v"> [in,out] Pointer to the first element of the vector. </param>
+        /// <param name="size"> The number of elements in the vector. </param>
+        template <typename ElementType>
+        static void Scale(ElementType s, ElementType* v, size_t size);
+
+        /// <summary> Multiplies a contiguous vector by a scalar and adds a bias, v = s * v + b. </summary>
+        ///
+        /// <typeparam name="ElementType"> Vector element type. </typeparam>
+        /// <param name="s"> The scalar that multiplies the vector. </param>
+        /// <param name="b"> The scalar added to each element. </param>
+        /// <param name="v"> [in,out] Pointer to the first element of the vector. </param>
+        /// <param name="size"> The number of elements in the vector. </param>
+        template <typename ElementType>
+        static void ScaleAdd(ElementType s, ElementType b, ElementType* v, size_t size);
+
+        /// <summary> Elementwise fused scale-add of contiguous vectors, v[i] = s[i] * v[i] + b[i]. </summary>
+        ///
+        /// <typeparam name="ElementType"> Vector element type. </typeparam>
+        /// <param name="s"> Pointer to the first element of the scale vector. </param>
+        /// <param name="b"> Pointer to the first element of the bias vector. </param>
+        /// <param name="v"> [in,out] Pointer to the first element of the vector being transformed. </param>
+        /// <param name="size"> The number of elements in each vector. </param>
+        template <typename ElementType>
+        static void ScaleAdd(const ElementType* s, const ElementType* b, ElementType* v, size_t size);
+
+    private:
+        // unrolled scalar versions, used for element types without an intrinsics-based kernel and
+        // as the runtime fallback when SimdSupport::HasVectorInstructions() returns false
+        template <typename ElementType>
+        static void AddScaledScalar(ElementType s, const ElementType* v, ElementType* u, size_t size);
+
+        template <typename ElementType>
+        static ElementType DotScalar(const ElementType* u, const ElementType* v, size_t size);
+
+        template <typename ElementType>
+        static void ScaleScalar(ElementType s, ElementType* v, size_t size);
+
+        template <typename ElementType>
+        static void ScaleAddScalar(ElementType s, ElementType b, ElementType* v, size_t size);
+
+        template <typename ElementType>
+        static void ScaleAddScalar(const ElementType* s, const ElementType* b, ElementType* v, size_t size);
+    };
+}
+}
+
+#include "../tcc/SimdOperations.tcc"
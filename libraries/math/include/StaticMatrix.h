@@ -0,0 +1,83 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     StaticMatrix.h (math)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Matrix.h"
+
+// stl
+#include <array>
+#include <initializer_list>
+
+namespace ell
+{
+namespace math
+{
+    /// <summary> A matrix whose shape is fixed at compile time and whose elements live inline in the
+    /// object, avoiding heap allocation. It shares the `MatrixReference` interface, so all of the
+    /// matrix operations apply, and because the shape is a compile-time constant the element loops
+    /// can be fully unrolled by the compiler. </summary>
+    ///
+    /// <typeparam name="ElementType"> Matrix element type. </typeparam>
+    /// <typeparam name="rows"> Number of rows. </typeparam>
+    /// <typeparam name="columns"> Number of columns. </typeparam>
+    /// <typeparam name="layout"> Matrix layout. </typeparam>
+    template <typename ElementType, size_t rows, size_t columns, MatrixLayout layout>
+    class StaticMatrix : public MatrixReference<ElementType, layout>
+    {
+    public:
+        /// <summary> Constructs an all-zeros matrix. </summary>
+        StaticMatrix();
+
+        /// <summary> Constructs a matrix from an initialization list. </summary>
+        ///
+        /// <param name="list"> A list of initialization lists (row by row), which must have the matrix shape. </param>
+        StaticMatrix(std::initializer_list<std::initializer_list<ElementType>> list);
+
+        /// <summary> Copy Constructor. </summary>
+        ///
+        /// <param name="other"> The matrix being copied. </param>
+        StaticMatrix(const StaticMatrix<ElementType, rows, columns, layout>& other);
+
+        /// <summary> Assignment operator. </summary>
+        ///
+        /// <param name="other"> The other matrix. </param>
+        ///
+        /// <returns> A reference to this matrix. </returns>
+        StaticMatrix<ElementType, rows, columns, layout>& operator=(const StaticMatrix<ElementType, rows, columns, layout>& other);
+
+        /// <summary> Gets the number of rows, as a compile-time constant. </summary>
+        ///
+        /// <returns> The number of rows. </returns>
+        constexpr static size_t StaticNumRows() { return rows; }
+
+        /// <summary> Gets the number of columns, as a compile-time constant. </summary>
+        ///
+        /// <returns> The number of columns. </returns>
+        constexpr static size_t StaticNumColumns() { return columns; }
+
+    private:
+        using RectangularMatrixBase<ElementType>::_pData;
+
+        // member variables
+        std::array<ElementType, rows * columns> _data;
+    };
+
+    //
+    // friendly names
+    //
+
+    template <typename ElementType, size_t rows, size_t columns>
+    using StaticColumnMatrix = StaticMatrix<ElementType, rows, columns, MatrixLayout::columnMajor>;
+
+    template <typename ElementType, size_t rows, size_t columns>
+    using StaticRowMatrix = StaticMatrix<ElementType, rows, columns, MatrixLayout::rowMajor>;
+}
+}
+
+#include "../tcc/StaticMatrix.tcc"
@@ -0,0 +1,82 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     StaticVector.h (math)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Vector.h"
+
+// stl
+#include <array>
+#include <initializer_list>
+
+namespace ell
+{
+namespace math
+{
+    /// <summary> A vector whose size is fixed at compile time and whose elements live inline in the
+    /// object, avoiding heap allocation. It shares the `VectorReference` interface, so all of the
+    /// vector operations apply, and because the size is a compile-time constant the element loops
+    /// can be fully unrolled by the compiler. </summary>
+    ///
+    /// <typeparam name="ElementType"> Vector element type. </typeparam>
+    /// <typeparam name="vectorSize"> Vector size. </typeparam>
+    /// <typeparam name="orientation"> The orientation, row or column. </typeparam>
+    template <typename ElementType, size_t vectorSize, VectorOrientation orientation>
+    class StaticVector : public VectorReference<ElementType, orientation>
+    {
+    public:
+        /// <summary> Constructs an all-zeros vector. </summary>
+        StaticVector();
+
+        /// <summary> Constructs a vector from an initializer list. </summary>
+        ///
+        /// <param name="list"> The initalizer list, which must have vectorSize elements. </param>
+        StaticVector(std::initializer_list<ElementType> list);
+
+        /// <summary> Constructs a vector by copying a vector reference of the same size. </summary>
+        ///
+        /// <param name="other"> The vector reference to copy. </param>
+        StaticVector(ConstVectorReference<ElementType, orientation> other);
+
+        /// <summary> Copy Constructor. </summary>
+        ///
+        /// <param name="other"> The vector being copied. </param>
+        StaticVector(const StaticVector<ElementType, vectorSize, orientation>& other);
+
+        /// <summary> Assignment operator. </summary>
+        ///
+        /// <param name="other"> The other vector. </param>
+        ///
+        /// <returns> A reference to this vector. </returns>
+        StaticVector<ElementType, vectorSize, orientation>& operator=(const StaticVector<ElementType, vectorSize, orientation>& other);
+
+        /// <summary> Gets the vector size, as a compile-time constant. </summary>
+        ///
+        /// <returns> The vector size. </returns>
+        constexpr static size_t StaticSize() { return vectorSize; }
+
+    private:
+        using ConstVectorReference<ElementType, orientation>::_pData;
+
+        // member variables
+        std::array<ElementType, vectorSize> _data;
+    };
+
+    //
+    // friendly names
+    //
+
+    template <typename ElementType, size_t vectorSize>
+    using StaticColumnVector = StaticVector<ElementType, vectorSize, VectorOrientation::column>;
+
+    template <typename ElementType, size_t vectorSize>
+    using StaticRowVector = StaticVector<ElementType, vectorSize, VectorOrientation::row>;
+}
+}
+
+#include "../tcc/StaticVector.tcc"
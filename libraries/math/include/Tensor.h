@@ -19,6 +19,7 @@
 // utilities
 #include "Debug.h"
 #include "Exception.h"
+#include "HugePageAllocator.h"
 #include "IArchivable.h"
 
 namespace ell
@@ -677,7 +678,7 @@ namespace math
         /// <summary> Returns a copy of the contents of the Tensor. </summary>
         ///
         /// <returns> A std::vector with a copy of the contents of the Tensor. </returns>
-        std::vector<ElementType> ToArray() const { return _data; }
+        std::vector<ElementType> ToArray() const { return { _data.begin(), _data.end() }; }
 
     private:
         Tensor(size_t numRows, size_t numColumns, size_t numChannels, ElementType* pData) : TensorReference<ElementType, dimension0, dimension1, dimension2>(numRows, numColumns, numChannels, pData) {};
@@ -685,9 +686,9 @@ namespace math
         // abbreviation
         using ConstTensorRef = ConstTensorReference<ElementType, dimension0, dimension1, dimension2>;
         
-        // the array used to store the tensor
+        // the array used to store the tensor (huge-page backed, since weight tensors dominate memory residency)
         using ConstTensorRef::_contents;
-        std::vector<ElementType> _data;
+        utilities::HugePageVector<ElementType> _data;
     };
 
     /// <summary> A class that implements helper functions for archiving/unarchiving Tensor instances. </summary>
@@ -133,6 +133,101 @@ namespace math
         /// <param name="T"> The Tensor. </param>
         template<Dimension vectorOrientation, typename ElementType, Dimension dimension0, Dimension dimension1>
         static void MultiplyAdd(UnorientedConstVectorReference<ElementType> s, UnorientedConstVectorReference<ElementType> b, TensorReference<ElementType, dimension0, dimension1, vectorOrientation> T);
+
+        /// <summary> Applies the fused transformation M = s[i] * M + b[i], where M is the i'th Tensor slice, in a
+        /// single pass over the Tensor. When the vectors are applied along the first dimension in the Tensor layout
+        /// (e.g. the channel dimension of a ChannelColumnRow tensor), the inner loops run over unit-stride data and
+        /// use the vectorized kernels. </summary>
+        ///
+        /// <typeparam name="vectorOrientation"> The orientation in which to apply the vectors. </typeparam>
+        /// <typeparam name="ElementType"> The element type. </typeparam>
+        /// <typeparam name="dimension1"> The second dimension in the Tensor layout. </typeparam>
+        /// <typeparam name="dimension2"> The third dimension in the Tensor layout. </typeparam>
+        /// <param name="s"> The vector of elements that multiply the Tensor slices </param>
+        /// <param name="b"> The vector of elements to add to the Tensor slices </param>
+        /// <param name="T"> The Tensor. </param>
+        template<Dimension vectorOrientation, typename ElementType, Dimension dimension1, Dimension dimension2>
+        static void ScaleAdd(UnorientedConstVectorReference<ElementType> s, UnorientedConstVectorReference<ElementType> b, TensorReference<ElementType, vectorOrientation, dimension1, dimension2> T);
+
+        /// <summary> Applies the fused transformation M = s[i] * M + b[i], where M is the i'th Tensor slice, in a
+        /// single pass over the Tensor. </summary>
+        ///
+        /// <typeparam name="vectorOrientation"> The orientation in which to apply the vectors. </typeparam>
+        /// <typeparam name="ElementType"> The element type. </typeparam>
+        /// <typeparam name="dimension0"> The first dimension in the Tensor layout. </typeparam>
+        /// <typeparam name="dimension2"> The third dimension in the Tensor layout. </typeparam>
+        /// <param name="s"> The vector of elements that multiply the Tensor slices </param>
+        /// <param name="b"> The vector of elements to add to the Tensor slices </param>
+        /// <param name="T"> The Tensor. </param>
+        template<Dimension vectorOrientation, typename ElementType, Dimension dimension0, Dimension dimension2>
+        static void ScaleAdd(UnorientedConstVectorReference<ElementType> s, UnorientedConstVectorReference<ElementType> b, TensorReference<ElementType, dimension0, vectorOrientation, dimension2> T);
+
+        /// <summary> Applies the fused transformation M = s[i] * M + b[i], where M is the i'th Tensor slice, in a
+        /// single pass over the Tensor. </summary>
+        ///
+        /// <typeparam name="vectorOrientation"> The orientation in which to apply the vectors. </typeparam>
+        /// <typeparam name="ElementType"> The element type. </typeparam>
+        /// <typeparam name="dimension0"> The first dimension in the Tensor layout. </typeparam>
+        /// <typeparam name="dimension1"> The second dimension in the Tensor layout. </typeparam>
+        /// <param name="s"> The vector of elements that multiply the Tensor slices </param>
+        /// <param name="b"> The vector of elements to add to the Tensor slices </param>
+        /// <param name="T"> The Tensor. </param>
+        template<Dimension vectorOrientation, typename ElementType, Dimension dimension0, Dimension dimension1>
+        static void ScaleAdd(UnorientedConstVectorReference<ElementType> s, UnorientedConstVectorReference<ElementType> b, TensorReference<ElementType, dimension0, dimension1, vectorOrientation> T);
+
+        /// <summary> Copies one Tensor into another of the same dimensions. Both arguments may be
+        /// strided sub-tensor views (e.g. the unpadded interior of a padded tensor); contiguous
+        /// runs are copied in bulk. </summary>
+        ///
+        /// <typeparam name="ElementType"> The element type. </typeparam>
+        /// <typeparam name="dimension0"> The first dimension in the Tensor layout. </typeparam>
+        /// <typeparam name="dimension1"> The second dimension in the Tensor layout. </typeparam>
+        /// <typeparam name="dimension2"> The third dimension in the Tensor layout. </typeparam>
+        /// <param name="input"> The Tensor to copy from. </param>
+        /// <param name="output"> The Tensor to copy to. </param>
+        template<typename ElementType, Dimension dimension0, Dimension dimension1, Dimension dimension2>
+        static void Copy(ConstTensorReference<ElementType, dimension0, dimension1, dimension2> input, TensorReference<ElementType, dimension0, dimension1, dimension2> output);
+
+        /// <summary> Out-of-place vector-Tensor addition, output = input + v[i], where i indexes the
+        /// first dimension in the Tensor layout. A single stride-aware pass over both views, so
+        /// layers can consume a sub-tensor view and produce a padded view without a separate copy. </summary>
+        ///
+        /// <typeparam name="vectorOrientation"> The orientation in which to apply the vector. </typeparam>
+        /// <typeparam name="ElementType"> The element type. </typeparam>
+        /// <typeparam name="dimension1"> The second dimension in the Tensor layout. </typeparam>
+        /// <typeparam name="dimension2"> The third dimension in the Tensor layout. </typeparam>
+        /// <param name="v"> The vector to add. </param>
+        /// <param name="input"> The Tensor to read. </param>
+        /// <param name="output"> The Tensor to write. </param>
+        template<Dimension vectorOrientation, typename ElementType, Dimension dimension1, Dimension dimension2>
+        static void Add(UnorientedConstVectorReference<ElementType> v, ConstTensorReference<ElementType, vectorOrientation, dimension1, dimension2> input, TensorReference<ElementType, vectorOrientation, dimension1, dimension2> output);
+
+        /// <summary> Out-of-place vector-Tensor multiplication, output = input * v[i], where i indexes
+        /// the first dimension in the Tensor layout. A single stride-aware pass over both views. </summary>
+        ///
+        /// <typeparam name="vectorOrientation"> The orientation in which to apply the vector. </typeparam>
+        /// <typeparam name="ElementType"> The element type. </typeparam>
+        /// <typeparam name="dimension1"> The second dimension in the Tensor layout. </typeparam>
+        /// <typeparam name="dimension2"> The third dimension in the Tensor layout. </typeparam>
+        /// <param name="v"> The vector to multiply by. </param>
+        /// <param name="input"> The Tensor to read. </param>
+        /// <param name="output"> The Tensor to write. </param>
+        template<Dimension vectorOrientation, typename ElementType, Dimension dimension1, Dimension dimension2>
+        static void Multiply(UnorientedConstVectorReference<ElementType> v, ConstTensorReference<ElementType, vectorOrientation, dimension1, dimension2> input, TensorReference<ElementType, vectorOrientation, dimension1, dimension2> output);
+
+        /// <summary> Out-of-place fused transformation output = s[i] * input + b[i], where i indexes
+        /// the first dimension in the Tensor layout. A single stride-aware pass over both views. </summary>
+        ///
+        /// <typeparam name="vectorOrientation"> The orientation in which to apply the vectors. </typeparam>
+        /// <typeparam name="ElementType"> The element type. </typeparam>
+        /// <typeparam name="dimension1"> The second dimension in the Tensor layout. </typeparam>
+        /// <typeparam name="dimension2"> The third dimension in the Tensor layout. </typeparam>
+        /// <param name="s"> The vector of elements that multiply the Tensor slices. </param>
+        /// <param name="b"> The vector of elements to add to the Tensor slices. </param>
+        /// <param name="input"> The Tensor to read. </param>
+        /// <param name="output"> The Tensor to write. </param>
+        template<Dimension vectorOrientation, typename ElementType, Dimension dimension1, Dimension dimension2>
+        static void ScaleAdd(UnorientedConstVectorReference<ElementType> s, UnorientedConstVectorReference<ElementType> b, ConstTensorReference<ElementType, vectorOrientation, dimension1, dimension2> input, TensorReference<ElementType, vectorOrientation, dimension1, dimension2> output);
     };
 }
 }
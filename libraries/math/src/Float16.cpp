@@ -0,0 +1,125 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     Float16.cpp (math)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Float16.h"
+
+// stl
+#include <cstring>
+
+namespace ell
+{
+namespace math
+{
+    float ToFloat32(Float16 value)
+    {
+        uint32_t sign = static_cast<uint32_t>(value.bits & 0x8000) << 16;
+        uint32_t exponent = (value.bits >> 10) & 0x1f;
+        uint32_t mantissa = value.bits & 0x3ff;
+
+        uint32_t bits;
+        if (exponent == 0x1f) // infinity or NaN
+        {
+            bits = sign | 0x7f800000 | (mantissa << 13);
+        }
+        else if (exponent == 0)
+        {
+            if (mantissa == 0) // zero
+            {
+                bits = sign;
+            }
+            else // subnormal: normalize by shifting the mantissa up to its implicit leading 1
+            {
+                exponent = 127 - 15 + 1;
+                while ((mantissa & 0x400) == 0)
+                {
+                    mantissa <<= 1;
+                    --exponent;
+                }
+                mantissa &= 0x3ff;
+                bits = sign | (exponent << 23) | (mantissa << 13);
+            }
+        }
+        else // normal
+        {
+            bits = sign | ((exponent - 15 + 127) << 23) | (mantissa << 13);
+        }
+
+        float result;
+        std::memcpy(&result, &bits, sizeof(result));
+        return result;
+    }
+
+    Float16 ToFloat16(float value)
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        uint16_t sign = static_cast<uint16_t>((bits >> 16) & 0x8000);
+        uint32_t exponent = (bits >> 23) & 0xff;
+        uint32_t mantissa = bits & 0x7fffff;
+
+        if (exponent == 0xff) // infinity or NaN
+        {
+            uint16_t halfMantissa = (mantissa == 0) ? 0 : 0x200; // keep NaN distinct from infinity
+            return { static_cast<uint16_t>(sign | 0x7c00 | halfMantissa) };
+        }
+
+        int halfExponent = static_cast<int>(exponent) - 127 + 15;
+        if (halfExponent >= 0x1f) // too large: overflow to infinity
+        {
+            return { static_cast<uint16_t>(sign | 0x7c00) };
+        }
+
+        if (halfExponent <= 0)
+        {
+            if (halfExponent < -10) // too small for a subnormal: flush to zero
+            {
+                return { sign };
+            }
+
+            // subnormal: shift in the implicit leading 1 and round to nearest even
+            mantissa |= 0x800000;
+            int shift = 14 - halfExponent;
+            uint16_t halfMantissa = static_cast<uint16_t>(mantissa >> shift);
+            uint32_t remainder = mantissa & ((1u << shift) - 1);
+            uint32_t halfway = 1u << (shift - 1);
+            if (remainder > halfway || (remainder == halfway && (halfMantissa & 1) != 0))
+            {
+                ++halfMantissa; // a carry out of the mantissa lands in the exponent, which is correct
+            }
+            return { static_cast<uint16_t>(sign | halfMantissa) };
+        }
+
+        // normal: round the mantissa to 10 bits, to nearest even
+        uint16_t half = static_cast<uint16_t>(sign | (halfExponent << 10) | (mantissa >> 13));
+        uint32_t remainder = mantissa & 0x1fff;
+        if (remainder > 0x1000 || (remainder == 0x1000 && (half & 1) != 0))
+        {
+            ++half; // a rounding carry out of the exponent turns overflow into infinity, which is correct
+        }
+        return { half };
+    }
+
+    std::vector<Float16> ToFloat16(const float* values, size_t size)
+    {
+        std::vector<Float16> result(size);
+        for (size_t index = 0; index < size; ++index)
+        {
+            result[index] = ToFloat16(values[index]);
+        }
+        return result;
+    }
+
+    void ToFloat32(const Float16* values, size_t size, float* output)
+    {
+        for (size_t index = 0; index < size; ++index)
+        {
+            output[index] = ToFloat32(values[index]);
+        }
+    }
+}
+}
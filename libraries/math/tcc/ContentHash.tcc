@@ -0,0 +1,77 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ContentHash.tcc (math)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ell
+{
+namespace math
+{
+    template <typename ElementType, VectorOrientation orientation>
+    uint64_t HashContents(ConstVectorReference<ElementType, orientation> vector, uint64_t seed)
+    {
+        utilities::FastHash hash(seed);
+        uint64_t size = vector.Size();
+        hash.Update(&size, sizeof(size));
+
+        if (vector.GetIncrement() == 1)
+        {
+            hash.Update(vector.GetDataPointer(), vector.Size() * sizeof(ElementType));
+        }
+        else
+        {
+            for (size_t index = 0; index < vector.Size(); ++index)
+            {
+                ElementType value = vector[index];
+                hash.Update(&value, sizeof(value));
+            }
+        }
+        return hash.Digest();
+    }
+
+    template <typename ElementType, MatrixLayout layout>
+    uint64_t HashContents(ConstMatrixReference<ElementType, layout> matrix, uint64_t seed)
+    {
+        utilities::FastHash hash(seed);
+        uint64_t numRows = matrix.NumRows();
+        uint64_t numColumns = matrix.NumColumns();
+        hash.Update(&numRows, sizeof(numRows));
+        hash.Update(&numColumns, sizeof(numColumns));
+
+        if (matrix.IsContiguous())
+        {
+            hash.Update(matrix.GetDataPointer(), matrix.NumRows() * matrix.NumColumns() * sizeof(ElementType));
+        }
+        else
+        {
+            // hash one storage interval (row or column, depending on layout) at a time, skipping
+            // the padding between intervals, so padded and unpadded copies hash identically
+            size_t numIntervals = layout == MatrixLayout::rowMajor ? matrix.NumRows() : matrix.NumColumns();
+            size_t intervalSize = layout == MatrixLayout::rowMajor ? matrix.NumColumns() : matrix.NumRows();
+            const ElementType* data = matrix.GetDataPointer();
+            for (size_t interval = 0; interval < numIntervals; ++interval)
+            {
+                hash.Update(data + interval * matrix.GetIncrement(), intervalSize * sizeof(ElementType));
+            }
+        }
+        return hash.Digest();
+    }
+
+    template <typename ElementType, Dimension dimension0, Dimension dimension1, Dimension dimension2>
+    uint64_t HashContents(ConstTensorReference<ElementType, dimension0, dimension1, dimension2> tensor, uint64_t seed)
+    {
+        // fold the 3-dimensional shape into the seed, then hash the contents through the matrix view
+        utilities::FastHash hash(seed);
+        uint64_t numRows = tensor.NumRows();
+        uint64_t numColumns = tensor.NumColumns();
+        uint64_t numChannels = tensor.NumChannels();
+        hash.Update(&numRows, sizeof(numRows));
+        hash.Update(&numColumns, sizeof(numColumns));
+        hash.Update(&numChannels, sizeof(numChannels));
+        return HashContents(tensor.ReferenceAsMatrix(), hash.Digest());
+    }
+}
+}
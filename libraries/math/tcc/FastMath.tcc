@@ -0,0 +1,119 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     FastMath.tcc (math)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// stl
+#include <cstdint>
+#include <cstring>
+
+namespace ell
+{
+namespace math
+{
+    namespace detail
+    {
+        // Builds 2^n by writing the biased exponent directly into the floating point
+        // representation. n must already be clamped to the representable range.
+        inline float MakePowerOfTwo(int n, float)
+        {
+            int32_t bits = static_cast<int32_t>(n + 127) << 23;
+            float result;
+            std::memcpy(&result, &bits, sizeof(result));
+            return result;
+        }
+
+        inline double MakePowerOfTwo(int n, double)
+        {
+            int64_t bits = static_cast<int64_t>(n + 1023) << 52;
+            double result;
+            std::memcpy(&result, &bits, sizeof(result));
+            return result;
+        }
+    }
+
+    template <typename ElementType>
+    ElementType FastMath::Exp(ElementType x)
+    {
+        // Cephes-style approximation: reduce to exp(x) = 2^n * exp(r) with |r| <= ln(2)/2, then
+        // evaluate a degree-6 polynomial for exp(r). ln(2) is split into a high and a low part so
+        // the reduction stays accurate. Every step is branch-free, so a loop over this function
+        // vectorizes.
+        constexpr ElementType log2e = static_cast<ElementType>(1.44269504088896341);
+        constexpr ElementType ln2Hi = static_cast<ElementType>(0.693359375);
+        constexpr ElementType ln2Lo = static_cast<ElementType>(-2.12194440e-4);
+
+        // clamp to the single-precision representable range, so the exponent arithmetic in
+        // MakePowerOfTwo cannot overflow
+        constexpr ElementType lowerBound = static_cast<ElementType>(-87.0);
+        constexpr ElementType upperBound = static_cast<ElementType>(88.0);
+        x = x < lowerBound ? lowerBound : (x > upperBound ? upperBound : x);
+
+        // n = round(x / ln(2)) = floor(x * log2(e) + 0.5)
+        ElementType scaled = x * log2e + static_cast<ElementType>(0.5);
+        int n = static_cast<int>(scaled);
+        n -= (static_cast<ElementType>(n) > scaled) ? 1 : 0; // truncation rounds toward zero; fix up to floor
+        ElementType nFloat = static_cast<ElementType>(n);
+
+        // r = x - n * ln(2), in two steps for accuracy
+        ElementType r = x - nFloat * ln2Hi;
+        r -= nFloat * ln2Lo;
+
+        // exp(r) ~ 1 + r + r^2 * p(r)
+        ElementType p = static_cast<ElementType>(1.9875691500e-4);
+        p = p * r + static_cast<ElementType>(1.3981999507e-3);
+        p = p * r + static_cast<ElementType>(8.3334519073e-3);
+        p = p * r + static_cast<ElementType>(4.1665795894e-2);
+        p = p * r + static_cast<ElementType>(1.6666665459e-1);
+        p = p * r + static_cast<ElementType>(5.0000001201e-1);
+        ElementType result = p * r * r + r + static_cast<ElementType>(1.0);
+
+        return result * detail::MakePowerOfTwo(n, ElementType{});
+    }
+
+    template <typename ElementType>
+    ElementType FastMath::Sigmoid(ElementType x)
+    {
+        // the clamp inside Exp makes this numerically stable at both tails
+        return static_cast<ElementType>(1.0) / (static_cast<ElementType>(1.0) + Exp(-x));
+    }
+
+    template <typename ElementType>
+    ElementType FastMath::Tanh(ElementType x)
+    {
+        // tanh(x) = (1 - exp(-2x)) / (1 + exp(-2x))
+        ElementType e = Exp(static_cast<ElementType>(-2.0) * x);
+        return (static_cast<ElementType>(1.0) - e) / (static_cast<ElementType>(1.0) + e);
+    }
+
+    template <typename ElementType>
+    void FastMath::Exp(ElementType* v, size_t size)
+    {
+        for (size_t i = 0; i < size; ++i)
+        {
+            v[i] = Exp(v[i]);
+        }
+    }
+
+    template <typename ElementType>
+    void FastMath::Sigmoid(ElementType* v, size_t size)
+    {
+        for (size_t i = 0; i < size; ++i)
+        {
+            v[i] = Sigmoid(v[i]);
+        }
+    }
+
+    template <typename ElementType>
+    void FastMath::Tanh(ElementType* v, size_t size)
+    {
+        for (size_t i = 0; i < size; ++i)
+        {
+            v[i] = Tanh(v[i]);
+        }
+    }
+}
+}
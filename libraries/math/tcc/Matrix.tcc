@@ -54,6 +54,24 @@ namespace math
     {
     }
 
+    template <typename ElementType>
+    void MatrixBase<ElementType, MatrixLayout::rowMajor>::Swap(MatrixBase<ElementType, MatrixLayout::rowMajor>& other)
+    {
+        RectangularMatrixBase<ElementType>::Swap(other);
+        std::swap(_numIntervals, other._numIntervals);
+        std::swap(_intervalSize, other._intervalSize);
+        std::swap(_rowIncrement, other._rowIncrement);
+    }
+
+    template <typename ElementType>
+    void MatrixBase<ElementType, MatrixLayout::columnMajor>::Swap(MatrixBase<ElementType, MatrixLayout::columnMajor>& other)
+    {
+        RectangularMatrixBase<ElementType>::Swap(other);
+        std::swap(_numIntervals, other._numIntervals);
+        std::swap(_intervalSize, other._intervalSize);
+        std::swap(_columnIncrement, other._columnIncrement);
+    }
+
     //
     // ConstMatrixReference
     //
@@ -405,14 +423,14 @@ namespace math
 
     template <typename ElementType, MatrixLayout layout>
     Matrix<ElementType, layout>::Matrix(size_t numRows, size_t numColumns, const std::vector<ElementType>& data)
-        : MatrixReference<ElementType, layout>(numRows, numColumns, nullptr), _data(data)
+        : MatrixReference<ElementType, layout>(numRows, numColumns, nullptr), _data(data.begin(), data.end())
     {
         _pData = _data.data();
     }
 
     template <typename ElementType, MatrixLayout layout>
     Matrix<ElementType, layout>::Matrix(size_t numRows, size_t numColumns, std::vector<ElementType>&& data)
-        : MatrixReference<ElementType, layout>(numRows, numColumns, nullptr), _data(std::move(data))
+        : MatrixReference<ElementType, layout>(numRows, numColumns, nullptr), _data(data.begin(), data.end())
     {
         _pData = _data.data();
     }
@@ -469,7 +487,7 @@ namespace math
     template <typename ElementType, MatrixLayout layout>
     void Matrix<ElementType, layout>::Swap(Matrix<ElementType, layout>& other)
     {
-        RectangularMatrixBase<ElementType>::Swap(other);
+        MatrixBase<ElementType, layout>::Swap(other);
         std::swap(_data, other._data);
     }
 
@@ -6,10 +6,19 @@
 //
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+// math
+#include "SimdOperations.h"
+
 // utilities
 #include "Debug.h"
 #include "Exception.h"
 
+// stl
+#include <algorithm>
+#include <future>
+#include <thread>
+#include <vector>
+
 namespace ell
 {
 namespace math
@@ -76,6 +85,10 @@ namespace math
         {
             DerivedClass::Multiply(s, v);
         }
+        else if (v.GetIncrement() == 1)
+        {
+            SimdKernels::ScaleAdd(s, b, v.GetDataPointer(), v.Size());
+        }
         else
         {
             v.Transform([s, b](ElementType x) { return (s*x) + b; });
@@ -153,9 +166,12 @@ namespace math
     template <typename ElementType, VectorOrientation orientation>
     void OperationsImplementation<ImplementationType::native>::Add(ElementType s, ConstVectorReference<ElementType, orientation> v, VectorReference<ElementType, orientation> u)
     {
-        if (v.Size() != u.Size())
+        THROW_IF_INVALID(v.Size() != u.Size(), utilities::InputExceptionErrors::sizeMismatch);
+
+        if (u.GetIncrement() == 1 && v.GetIncrement() == 1)
         {
-            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "vectors u and v are not the same size.");
+            SimdKernels::AddScaled(s, v.GetDataPointer(), u.GetDataPointer(), u.Size());
+            return;
         }
 
         ElementType* uData = u.GetDataPointer();
@@ -173,9 +189,11 @@ namespace math
     template <typename ElementType>
     ElementType OperationsImplementation<ImplementationType::native>::Dot(UnorientedConstVectorReference<ElementType> u, UnorientedConstVectorReference<ElementType> v)
     {
-        if (v.Size() != u.Size())
+        THROW_IF_INVALID(v.Size() != u.Size(), utilities::InputExceptionErrors::sizeMismatch);
+
+        if (u.GetIncrement() == 1 && v.GetIncrement() == 1)
         {
-            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "vectors u and v are not the same size.");
+            return SimdKernels::Dot(u.GetDataPointer(), v.GetDataPointer(), u.Size());
         }
 
         const ElementType* uData = u.GetDataPointer();
@@ -196,6 +214,12 @@ namespace math
     template <typename ElementType, VectorOrientation orientation>
     void OperationsImplementation<ImplementationType::native>::Multiply(ElementType s, VectorReference<ElementType, orientation> v)
     {
+        if (v.GetIncrement() == 1)
+        {
+            SimdKernels::Scale(s, v.GetDataPointer(), v.Size());
+            return;
+        }
+
         v *= s;
     }
 
@@ -208,11 +232,14 @@ namespace math
     template <typename ElementType, MatrixLayout layout>
     void OperationsImplementation<ImplementationType::native>::Multiply(ElementType s, ConstMatrixReference<ElementType, layout> M, ConstVectorReference<ElementType, VectorOrientation::column> v, ElementType t, VectorReference<ElementType, VectorOrientation::column> u)
     {
-        if (M.NumRows() != u.Size() || M.NumColumns() != v.Size())
-        {
-            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Incompatible matrix and vectors sizes.");
-        }
+        THROW_IF_INVALID(M.NumRows() != u.Size() || M.NumColumns() != v.Size(), utilities::InputExceptionErrors::sizeMismatch);
+
+        MultiplyUnchecked(s, M, v, t, u);
+    }
 
+    template <typename ElementType, MatrixLayout layout>
+    void OperationsImplementation<ImplementationType::native>::MultiplyUnchecked(ElementType s, ConstMatrixReference<ElementType, layout> M, ConstVectorReference<ElementType, VectorOrientation::column> v, ElementType t, VectorReference<ElementType, VectorOrientation::column> u)
+    {
         for (size_t i = 0; i < M.NumRows(); ++i)
         {
             auto row = M.GetRow(i);
@@ -223,10 +250,7 @@ namespace math
     template <typename ElementType, MatrixLayout layoutA, MatrixLayout layoutB>
     void OperationsImplementation<ImplementationType::native>::Multiply(ElementType s, ConstMatrixReference<ElementType, layoutA> A, ConstMatrixReference<ElementType, layoutB> B, ElementType t, MatrixReference<ElementType, layoutA> C)
     {
-        if (A.NumColumns() != B.NumRows() || A.NumRows() != C.NumRows() || B.NumColumns() != C.NumColumns())
-        {
-            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Incompatible matrix sizes.");
-        }
+        THROW_IF_INVALID(A.NumColumns() != B.NumRows() || A.NumRows() != C.NumRows() || B.NumColumns() != C.NumColumns(), utilities::InputExceptionErrors::sizeMismatch);
 
         for (size_t i = 0; i < A.NumRows(); ++i)
         {
@@ -239,6 +263,89 @@ namespace math
         }
     }
 
+    //
+    // Parallel native implementations of operations
+    //
+
+    template <typename ElementType, MatrixLayout layoutA, MatrixLayout layoutB>
+    void OperationsImplementation<ImplementationType::nativeParallel>::Multiply(ElementType s, ConstMatrixReference<ElementType, layoutA> A, ConstMatrixReference<ElementType, layoutB> B, ElementType t, MatrixReference<ElementType, layoutA> C)
+    {
+        Multiply(s, A, B, t, C, GemmBlockParameters());
+    }
+
+    template <typename ElementType, MatrixLayout layoutA, MatrixLayout layoutB>
+    void OperationsImplementation<ImplementationType::nativeParallel>::Multiply(ElementType s, ConstMatrixReference<ElementType, layoutA> A, ConstMatrixReference<ElementType, layoutB> B, ElementType t, MatrixReference<ElementType, layoutA> C, GemmBlockParameters parameters)
+    {
+        THROW_IF_INVALID(A.NumColumns() != B.NumRows() || A.NumRows() != C.NumRows() || B.NumColumns() != C.NumColumns(), utilities::InputExceptionErrors::sizeMismatch);
+
+        size_t numThreads = parameters.numThreads != 0 ? parameters.numThreads : std::thread::hardware_concurrency();
+        if (numThreads == 0)
+        {
+            numThreads = 1;
+        }
+
+        // don't spawn threads that would each get less than one row block
+        numThreads = std::min(numThreads, (C.NumRows() + parameters.rowBlockSize - 1) / parameters.rowBlockSize);
+
+        if (numThreads <= 1)
+        {
+            MultiplyRowBand(s, A, B, t, C, 0, C.NumRows(), parameters);
+            return;
+        }
+
+        // partition the output panel row-wise across the workers
+        size_t rowsPerThread = (C.NumRows() + numThreads - 1) / numThreads;
+        std::vector<std::future<void>> futures;
+        for (size_t firstRow = 0; firstRow < C.NumRows(); firstRow += rowsPerThread)
+        {
+            size_t numRows = std::min(rowsPerThread, C.NumRows() - firstRow);
+            futures.push_back(std::async(std::launch::async, MultiplyRowBand<ElementType, layoutA, layoutB>, s, A, B, t, C, firstRow, numRows, std::cref(parameters)));
+        }
+        for (auto& future : futures)
+        {
+            future.get();
+        }
+    }
+
+    template <typename ElementType, MatrixLayout layoutA, MatrixLayout layoutB>
+    void OperationsImplementation<ImplementationType::nativeParallel>::MultiplyRowBand(ElementType s, ConstMatrixReference<ElementType, layoutA> A, ConstMatrixReference<ElementType, layoutB> B, ElementType t, MatrixReference<ElementType, layoutA> C, size_t firstRow, size_t numRows, const GemmBlockParameters& parameters)
+    {
+        size_t lastRow = firstRow + numRows;
+        size_t numColumns = C.NumColumns();
+        size_t innerSize = A.NumColumns();
+
+        for (size_t i = firstRow; i < lastRow; ++i)
+        {
+            OperationsImplementation<ImplementationType::native>::Multiply(t, C.GetRow(i));
+        }
+
+        // loop over cache-sized blocks of the output and the shared dimension; within a block, the
+        // i-k-j loop order streams through contiguous rows of B and C when they are row major
+        for (size_t iBlock = firstRow; iBlock < lastRow; iBlock += parameters.rowBlockSize)
+        {
+            size_t iEnd = std::min(iBlock + parameters.rowBlockSize, lastRow);
+            for (size_t kBlock = 0; kBlock < innerSize; kBlock += parameters.innerBlockSize)
+            {
+                size_t kEnd = std::min(kBlock + parameters.innerBlockSize, innerSize);
+                for (size_t jBlock = 0; jBlock < numColumns; jBlock += parameters.columnBlockSize)
+                {
+                    size_t jEnd = std::min(jBlock + parameters.columnBlockSize, numColumns);
+                    for (size_t i = iBlock; i < iEnd; ++i)
+                    {
+                        for (size_t k = kBlock; k < kEnd; ++k)
+                        {
+                            ElementType a = s * A(i, k);
+                            for (size_t j = jBlock; j < jEnd; ++j)
+                            {
+                                C(i, j) += a * B(k, j);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
 #ifdef USE_BLAS
     //
     // OpenBLAS wrappers
@@ -0,0 +1,64 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     Quantization.tcc (math)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// stl
+#include <cmath>
+
+namespace ell
+{
+namespace math
+{
+    template <typename ElementType>
+    ElementType MaxAbsValue(const ElementType* values, size_t size)
+    {
+        // independent maximum chains, so the compiler can keep four vector accumulators in flight
+        ElementType max0 = 0;
+        ElementType max1 = 0;
+        ElementType max2 = 0;
+        ElementType max3 = 0;
+        size_t i = 0;
+        for (; i + 4 <= size; i += 4)
+        {
+            max0 = std::max(max0, std::abs(values[i]));
+            max1 = std::max(max1, std::abs(values[i + 1]));
+            max2 = std::max(max2, std::abs(values[i + 2]));
+            max3 = std::max(max3, std::abs(values[i + 3]));
+        }
+        ElementType result = std::max(std::max(max0, max1), std::max(max2, max3));
+        for (; i < size; ++i)
+        {
+            result = std::max(result, std::abs(values[i]));
+        }
+        return result;
+    }
+
+    template <typename ElementType>
+    void QuantizeValues(const ElementType* input, int8_t* output, size_t size, ElementType scale, int8_t zeroPoint)
+    {
+        const ElementType inverseScale = 1 / scale;
+        const ElementType lowest = static_cast<ElementType>(-128 - zeroPoint);
+        const ElementType highest = static_cast<ElementType>(127 - zeroPoint);
+        for (size_t i = 0; i < size; ++i)
+        {
+            // clamp before converting, so out-of-range values saturate instead of wrapping
+            ElementType quantized = std::round(input[i] * inverseScale);
+            quantized = std::min(std::max(quantized, lowest), highest);
+            output[i] = static_cast<int8_t>(static_cast<int32_t>(quantized) + zeroPoint);
+        }
+    }
+
+    template <typename ElementType>
+    void DequantizeValues(const int8_t* input, ElementType* output, size_t size, ElementType scale, int8_t zeroPoint)
+    {
+        for (size_t i = 0; i < size; ++i)
+        {
+            output[i] = static_cast<ElementType>(static_cast<int32_t>(input[i]) - zeroPoint) * scale;
+        }
+    }
+}
+}
@@ -0,0 +1,485 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     SimdOperations.tcc (math)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
+namespace ell
+{
+namespace math
+{
+    //
+    // SimdSupport
+    //
+
+    inline bool SimdSupport::HasVectorInstructions()
+    {
+#if defined(__AVX2__)
+        // the binary was compiled for AVX2 - confirm that the processor we actually run on has it
+#if defined(_MSC_VER)
+        static const bool hasAvx2 = [] {
+            int info[4];
+            __cpuidex(info, 7, 0);
+            return (info[1] & (1 << 5)) != 0; // EBX bit 5 = AVX2
+        }();
+#else
+        static const bool hasAvx2 = __builtin_cpu_supports("avx2");
+#endif
+        return hasAvx2;
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+        // NEON availability is implied by the compilation target
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    //
+    // Scalar fallback kernels, unrolled so that independent accumulator chains can be scheduled
+    // (and autovectorized) by the compiler
+    //
+
+    template <typename ElementType>
+    void SimdKernels::AddScaledScalar(ElementType s, const ElementType* v, ElementType* u, size_t size)
+    {
+        size_t i = 0;
+        for (; i + 4 <= size; i += 4)
+        {
+            u[i] += s * v[i];
+            u[i + 1] += s * v[i + 1];
+            u[i + 2] += s * v[i + 2];
+            u[i + 3] += s * v[i + 3];
+        }
+        for (; i < size; ++i)
+        {
+            u[i] += s * v[i];
+        }
+    }
+
+    template <typename ElementType>
+    ElementType SimdKernels::DotScalar(const ElementType* u, const ElementType* v, size_t size)
+    {
+        ElementType result0 = 0;
+        ElementType result1 = 0;
+        ElementType result2 = 0;
+        ElementType result3 = 0;
+        size_t i = 0;
+        for (; i + 4 <= size; i += 4)
+        {
+            result0 += u[i] * v[i];
+            result1 += u[i + 1] * v[i + 1];
+            result2 += u[i + 2] * v[i + 2];
+            result3 += u[i + 3] * v[i + 3];
+        }
+        ElementType result = (result0 + result1) + (result2 + result3);
+        for (; i < size; ++i)
+        {
+            result += u[i] * v[i];
+        }
+        return result;
+    }
+
+    template <typename ElementType>
+    void SimdKernels::ScaleScalar(ElementType s, ElementType* v, size_t size)
+    {
+        size_t i = 0;
+        for (; i + 4 <= size; i += 4)
+        {
+            v[i] *= s;
+            v[i + 1] *= s;
+            v[i + 2] *= s;
+            v[i + 3] *= s;
+        }
+        for (; i < size; ++i)
+        {
+            v[i] *= s;
+        }
+    }
+
+    template <typename ElementType>
+    void SimdKernels::ScaleAddScalar(ElementType s, ElementType b, ElementType* v, size_t size)
+    {
+        size_t i = 0;
+        for (; i + 4 <= size; i += 4)
+        {
+            v[i] = s * v[i] + b;
+            v[i + 1] = s * v[i + 1] + b;
+            v[i + 2] = s * v[i + 2] + b;
+            v[i + 3] = s * v[i + 3] + b;
+        }
+        for (; i < size; ++i)
+        {
+            v[i] = s * v[i] + b;
+        }
+    }
+
+    template <typename ElementType>
+    void SimdKernels::ScaleAddScalar(const ElementType* s, const ElementType* b, ElementType* v, size_t size)
+    {
+        size_t i = 0;
+        for (; i + 4 <= size; i += 4)
+        {
+            v[i] = s[i] * v[i] + b[i];
+            v[i + 1] = s[i + 1] * v[i + 1] + b[i + 1];
+            v[i + 2] = s[i + 2] * v[i + 2] + b[i + 2];
+            v[i + 3] = s[i + 3] * v[i + 3] + b[i + 3];
+        }
+        for (; i < size; ++i)
+        {
+            v[i] = s[i] * v[i] + b[i];
+        }
+    }
+
+    //
+    // Generic kernels: element types without an intrinsics-based specialization below go
+    // straight to the scalar loops
+    //
+
+    template <typename ElementType>
+    void SimdKernels::AddScaled(ElementType s, const ElementType* v, ElementType* u, size_t size)
+    {
+        AddScaledScalar(s, v, u, size);
+    }
+
+    template <typename ElementType>
+    ElementType SimdKernels::Dot(const ElementType* u, const ElementType* v, size_t size)
+    {
+        return DotScalar(u, v, size);
+    }
+
+    template <typename ElementType>
+    void SimdKernels::Scale(ElementType s, ElementType* v, size_t size)
+    {
+        ScaleScalar(s, v, size);
+    }
+
+    template <typename ElementType>
+    void SimdKernels::ScaleAdd(ElementType s, ElementType b, ElementType* v, size_t size)
+    {
+        ScaleAddScalar(s, b, v, size);
+    }
+
+    template <typename ElementType>
+    void SimdKernels::ScaleAdd(const ElementType* s, const ElementType* b, ElementType* v, size_t size)
+    {
+        ScaleAddScalar(s, b, v, size);
+    }
+
+#if defined(__AVX2__)
+    //
+    // AVX2 kernels, 8 floats / 4 doubles per instruction, with FMA where the operation calls for
+    // it. Each one consults SimdSupport on entry so that a binary compiled for AVX2 degrades to
+    // the scalar loops, rather than faulting, on a processor without it.
+    //
+
+    template <>
+    inline void SimdKernels::AddScaled(float s, const float* v, float* u, size_t size)
+    {
+        if (!SimdSupport::HasVectorInstructions())
+        {
+            return AddScaledScalar(s, v, u, size);
+        }
+
+        const __m256 ss = _mm256_set1_ps(s);
+        size_t i = 0;
+        for (; i + 8 <= size; i += 8)
+        {
+            __m256 uu = _mm256_loadu_ps(u + i);
+            uu = _mm256_fmadd_ps(ss, _mm256_loadu_ps(v + i), uu);
+            _mm256_storeu_ps(u + i, uu);
+        }
+        for (; i < size; ++i)
+        {
+            u[i] += s * v[i];
+        }
+    }
+
+    template <>
+    inline void SimdKernels::AddScaled(double s, const double* v, double* u, size_t size)
+    {
+        if (!SimdSupport::HasVectorInstructions())
+        {
+            return AddScaledScalar(s, v, u, size);
+        }
+
+        const __m256d ss = _mm256_set1_pd(s);
+        size_t i = 0;
+        for (; i + 4 <= size; i += 4)
+        {
+            __m256d uu = _mm256_loadu_pd(u + i);
+            uu = _mm256_fmadd_pd(ss, _mm256_loadu_pd(v + i), uu);
+            _mm256_storeu_pd(u + i, uu);
+        }
+        for (; i < size; ++i)
+        {
+            u[i] += s * v[i];
+        }
+    }
+
+    template <>
+    inline float SimdKernels::Dot(const float* u, const float* v, size_t size)
+    {
+        if (!SimdSupport::HasVectorInstructions())
+        {
+            return DotScalar(u, v, size);
+        }
+
+        __m256 sum = _mm256_setzero_ps();
+        size_t i = 0;
+        for (; i + 8 <= size; i += 8)
+        {
+            sum = _mm256_fmadd_ps(_mm256_loadu_ps(u + i), _mm256_loadu_ps(v + i), sum);
+        }
+        alignas(32) float partial[8];
+        _mm256_store_ps(partial, sum);
+        float result = ((partial[0] + partial[1]) + (partial[2] + partial[3])) + ((partial[4] + partial[5]) + (partial[6] + partial[7]));
+        for (; i < size; ++i)
+        {
+            result += u[i] * v[i];
+        }
+        return result;
+    }
+
+    template <>
+    inline double SimdKernels::Dot(const double* u, const double* v, size_t size)
+    {
+        if (!SimdSupport::HasVectorInstructions())
+        {
+            return DotScalar(u, v, size);
+        }
+
+        __m256d sum = _mm256_setzero_pd();
+        size_t i = 0;
+        for (; i + 4 <= size; i += 4)
+        {
+            sum = _mm256_fmadd_pd(_mm256_loadu_pd(u + i), _mm256_loadu_pd(v + i), sum);
+        }
+        alignas(32) double partial[4];
+        _mm256_store_pd(partial, sum);
+        double result = (partial[0] + partial[1]) + (partial[2] + partial[3]);
+        for (; i < size; ++i)
+        {
+            result += u[i] * v[i];
+        }
+        return result;
+    }
+
+    template <>
+    inline void SimdKernels::Scale(float s, float* v, size_t size)
+    {
+        if (!SimdSupport::HasVectorInstructions())
+        {
+            return ScaleScalar(s, v, size);
+        }
+
+        const __m256 ss = _mm256_set1_ps(s);
+        size_t i = 0;
+        for (; i + 8 <= size; i += 8)
+        {
+            _mm256_storeu_ps(v + i, _mm256_mul_ps(ss, _mm256_loadu_ps(v + i)));
+        }
+        for (; i < size; ++i)
+        {
+            v[i] *= s;
+        }
+    }
+
+    template <>
+    inline void SimdKernels::Scale(double s, double* v, size_t size)
+    {
+        if (!SimdSupport::HasVectorInstructions())
+        {
+            return ScaleScalar(s, v, size);
+        }
+
+        const __m256d ss = _mm256_set1_pd(s);
+        size_t i = 0;
+        for (; i + 4 <= size; i += 4)
+        {
+            _mm256_storeu_pd(v + i, _mm256_mul_pd(ss, _mm256_loadu_pd(v + i)));
+        }
+        for (; i < size; ++i)
+        {
+            v[i] *= s;
+        }
+    }
+
+    template <>
+    inline void SimdKernels::ScaleAdd(float s, float b, float* v, size_t size)
+    {
+        if (!SimdSupport::HasVectorInstructions())
+        {
+            return ScaleAddScalar(s, b, v, size);
+        }
+
+        const __m256 ss = _mm256_set1_ps(s);
+        const __m256 bb = _mm256_set1_ps(b);
+        size_t i = 0;
+        for (; i + 8 <= size; i += 8)
+        {
+            _mm256_storeu_ps(v + i, _mm256_fmadd_ps(ss, _mm256_loadu_ps(v + i), bb));
+        }
+        for (; i < size; ++i)
+        {
+            v[i] = s * v[i] + b;
+        }
+    }
+
+    template <>
+    inline void SimdKernels::ScaleAdd(double s, double b, double* v, size_t size)
+    {
+        if (!SimdSupport::HasVectorInstructions())
+        {
+            return ScaleAddScalar(s, b, v, size);
+        }
+
+        const __m256d ss = _mm256_set1_pd(s);
+        const __m256d bb = _mm256_set1_pd(b);
+        size_t i = 0;
+        for (; i + 4 <= size; i += 4)
+        {
+            _mm256_storeu_pd(v + i, _mm256_fmadd_pd(ss, _mm256_loadu_pd(v + i), bb));
+        }
+        for (; i < size; ++i)
+        {
+            v[i] = s * v[i] + b;
+        }
+    }
+
+    template <>
+    inline void SimdKernels::ScaleAdd(const float* s, const float* b, float* v, size_t size)
+    {
+        if (!SimdSupport::HasVectorInstructions())
+        {
+            return ScaleAddScalar(s, b, v, size);
+        }
+
+        size_t i = 0;
+        for (; i + 8 <= size; i += 8)
+        {
+            _mm256_storeu_ps(v + i, _mm256_fmadd_ps(_mm256_loadu_ps(s + i), _mm256_loadu_ps(v + i), _mm256_loadu_ps(b + i)));
+        }
+        for (; i < size; ++i)
+        {
+            v[i] = s[i] * v[i] + b[i];
+        }
+    }
+
+    template <>
+    inline void SimdKernels::ScaleAdd(const double* s, const double* b, double* v, size_t size)
+    {
+        if (!SimdSupport::HasVectorInstructions())
+        {
+            return ScaleAddScalar(s, b, v, size);
+        }
+
+        size_t i = 0;
+        for (; i + 4 <= size; i += 4)
+        {
+            _mm256_storeu_pd(v + i, _mm256_fmadd_pd(_mm256_loadu_pd(s + i), _mm256_loadu_pd(v + i), _mm256_loadu_pd(b + i)));
+        }
+        for (; i < size; ++i)
+        {
+            v[i] = s[i] * v[i] + b[i];
+        }
+    }
+
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    //
+    // NEON kernels, 4 floats per instruction. Doubles stay on the scalar fallback because
+    // float64x2 is only available on AArch64 and the scalar loop keeps the code uniform.
+    // No runtime check here: NEON availability is implied by the compilation target.
+    //
+
+    template <>
+    inline void SimdKernels::AddScaled(float s, const float* v, float* u, size_t size)
+    {
+        const float32x4_t ss = vdupq_n_f32(s);
+        size_t i = 0;
+        for (; i + 4 <= size; i += 4)
+        {
+            vst1q_f32(u + i, vmlaq_f32(vld1q_f32(u + i), ss, vld1q_f32(v + i)));
+        }
+        for (; i < size; ++i)
+        {
+            u[i] += s * v[i];
+        }
+    }
+
+    template <>
+    inline float SimdKernels::Dot(const float* u, const float* v, size_t size)
+    {
+        float32x4_t sum = vdupq_n_f32(0);
+        size_t i = 0;
+        for (; i + 4 <= size; i += 4)
+        {
+            sum = vmlaq_f32(sum, vld1q_f32(u + i), vld1q_f32(v + i));
+        }
+        float partial[4];
+        vst1q_f32(partial, sum);
+        float result = (partial[0] + partial[1]) + (partial[2] + partial[3]);
+        for (; i < size; ++i)
+        {
+            result += u[i] * v[i];
+        }
+        return result;
+    }
+
+    template <>
+    inline void SimdKernels::Scale(float s, float* v, size_t size)
+    {
+        const float32x4_t ss = vdupq_n_f32(s);
+        size_t i = 0;
+        for (; i + 4 <= size; i += 4)
+        {
+            vst1q_f32(v + i, vmulq_f32(ss, vld1q_f32(v + i)));
+        }
+        for (; i < size; ++i)
+        {
+            v[i] *= s;
+        }
+    }
+
+    template <>
+    inline void SimdKernels::ScaleAdd(float s, float b, float* v, size_t size)
+    {
+        const float32x4_t ss = vdupq_n_f32(s);
+        const float32x4_t bb = vdupq_n_f32(b);
+        size_t i = 0;
+        for (; i + 4 <= size; i += 4)
+        {
+            vst1q_f32(v + i, vmlaq_f32(bb, ss, vld1q_f32(v + i)));
+        }
+        for (; i < size; ++i)
+        {
+            v[i] = s * v[i] + b;
+        }
+    }
+
+    template <>
+    inline void SimdKernels::ScaleAdd(const float* s, const float* b, float* v, size_t size)
+    {
+        size_t i = 0;
+        for (; i + 4 <= size; i += 4)
+        {
+            vst1q_f32(v + i, vmlaq_f32(vld1q_f32(b + i), vld1q_f32(s + i), vld1q_f32(v + i)));
+        }
+        for (; i < size; ++i)
+        {
+            v[i] = s[i] * v[i] + b[i];
+        }
+    }
+#endif
+}
+}
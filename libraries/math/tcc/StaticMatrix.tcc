@@ -0,0 +1,57 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     StaticMatrix.tcc (math)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ell
+{
+namespace math
+{
+    template <typename ElementType, size_t rows, size_t columns, MatrixLayout layout>
+    StaticMatrix<ElementType, rows, columns, layout>::StaticMatrix()
+        : MatrixReference<ElementType, layout>(rows, columns, nullptr), _data{}
+    {
+        _pData = _data.data();
+    }
+
+    template <typename ElementType, size_t rows, size_t columns, MatrixLayout layout>
+    StaticMatrix<ElementType, rows, columns, layout>::StaticMatrix(std::initializer_list<std::initializer_list<ElementType>> list)
+        : MatrixReference<ElementType, layout>(rows, columns, nullptr), _data{}
+    {
+        DEBUG_THROW(list.size() != rows, utilities::InputException(utilities::InputExceptionErrors::sizeMismatch, "incorrect number of rows in initializer list"));
+
+        _pData = _data.data();
+
+        size_t i = 0;
+        for (auto rowIter = list.begin(); rowIter < list.end(); ++rowIter)
+        {
+            DEBUG_THROW(rowIter->size() != columns, utilities::InputException(utilities::InputExceptionErrors::sizeMismatch, "incorrect number of elements in initializer list"));
+
+            size_t j = 0;
+            for (auto elementIter = rowIter->begin(); elementIter < rowIter->end(); ++elementIter)
+            {
+                (*this)(i, j) = *elementIter;
+                ++j;
+            }
+            ++i;
+        }
+    }
+
+    template <typename ElementType, size_t rows, size_t columns, MatrixLayout layout>
+    StaticMatrix<ElementType, rows, columns, layout>::StaticMatrix(const StaticMatrix<ElementType, rows, columns, layout>& other)
+        : MatrixReference<ElementType, layout>(rows, columns, nullptr), _data(other._data)
+    {
+        _pData = _data.data();
+    }
+
+    template <typename ElementType, size_t rows, size_t columns, MatrixLayout layout>
+    StaticMatrix<ElementType, rows, columns, layout>& StaticMatrix<ElementType, rows, columns, layout>::operator=(const StaticMatrix<ElementType, rows, columns, layout>& other)
+    {
+        _data = other._data;
+        return *this;
+    }
+}
+}
@@ -0,0 +1,57 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     StaticVector.tcc (math)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ell
+{
+namespace math
+{
+    template <typename ElementType, size_t vectorSize, VectorOrientation orientation>
+    StaticVector<ElementType, vectorSize, orientation>::StaticVector()
+        : VectorReference<ElementType, orientation>(nullptr, vectorSize, 1), _data{}
+    {
+        _pData = _data.data();
+    }
+
+    template <typename ElementType, size_t vectorSize, VectorOrientation orientation>
+    StaticVector<ElementType, vectorSize, orientation>::StaticVector(std::initializer_list<ElementType> list)
+        : VectorReference<ElementType, orientation>(nullptr, vectorSize, 1), _data{}
+    {
+        DEBUG_THROW(list.size() != vectorSize, utilities::InputException(utilities::InputExceptionErrors::sizeMismatch, "incorrect number of elements in initializer list"));
+
+        _pData = _data.data();
+        std::copy(list.begin(), list.end(), _data.begin());
+    }
+
+    template <typename ElementType, size_t vectorSize, VectorOrientation orientation>
+    StaticVector<ElementType, vectorSize, orientation>::StaticVector(ConstVectorReference<ElementType, orientation> other)
+        : VectorReference<ElementType, orientation>(nullptr, vectorSize, 1), _data{}
+    {
+        DEBUG_THROW(other.Size() != vectorSize, utilities::InputException(utilities::InputExceptionErrors::sizeMismatch, "vector sizes must be the same"));
+
+        _pData = _data.data();
+        for (size_t i = 0; i < vectorSize; ++i)
+        {
+            _data[i] = other[i];
+        }
+    }
+
+    template <typename ElementType, size_t vectorSize, VectorOrientation orientation>
+    StaticVector<ElementType, vectorSize, orientation>::StaticVector(const StaticVector<ElementType, vectorSize, orientation>& other)
+        : VectorReference<ElementType, orientation>(nullptr, vectorSize, 1), _data(other._data)
+    {
+        _pData = _data.data();
+    }
+
+    template <typename ElementType, size_t vectorSize, VectorOrientation orientation>
+    StaticVector<ElementType, vectorSize, orientation>& StaticVector<ElementType, vectorSize, orientation>::operator=(const StaticVector<ElementType, vectorSize, orientation>& other)
+    {
+        _data = other._data;
+        return *this;
+    }
+}
+}
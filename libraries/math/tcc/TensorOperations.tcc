@@ -7,6 +7,10 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "Operations.h"
+#include "SimdOperations.h"
+
+// stl
+#include <algorithm>
 
 namespace ell
 {
@@ -77,24 +81,51 @@ namespace math
 
     template<Dimension vectorOrientation, typename ElementType, Dimension dimension1, Dimension dimension2>
     void TensorOperations::MultiplyAdd(UnorientedConstVectorReference<ElementType> s, UnorientedConstVectorReference<ElementType> b, TensorReference<ElementType, vectorOrientation, dimension1, dimension2> T)
+    {
+        ScaleAdd<vectorOrientation>(s, b, T);
+    }
+
+    template<Dimension vectorOrientation, typename ElementType, Dimension dimension1, Dimension dimension2>
+    void TensorOperations::ScaleAdd(UnorientedConstVectorReference<ElementType> s, UnorientedConstVectorReference<ElementType> b, TensorReference<ElementType, vectorOrientation, dimension1, dimension2> T)
     {
         auto layout = T.GetLayout();
         DEBUG_THROW(s.Size() != layout[0] || b.Size() != layout[0], utilities::InputException(utilities::InputExceptionErrors::sizeMismatch, "vectors and tensor dimensions must be the same"));
 
+        // the vectors are applied along the first dimension in the layout, so each column of each
+        // primary slice is a unit-stride run the elementwise kernel can process in one pass
         for (size_t i = 0; i < layout[2]; ++i)
         {
             auto M = T.GetPrimarySlice(i);
             for (size_t j = 0; j < layout[1]; ++j)
             {
                 auto u = M.GetColumn(j);
-                for (size_t k = 0; k < layout[0]; ++k)
+                if (u.GetIncrement() == 1 && s.GetIncrement() == 1 && b.GetIncrement() == 1)
+                {
+                    SimdKernels::ScaleAdd(s.GetDataPointer(), b.GetDataPointer(), u.GetDataPointer(), layout[0]);
+                }
+                else
                 {
-                    u[k] = s[k] * u[k] + b[k];
+                    for (size_t k = 0; k < layout[0]; ++k)
+                    {
+                        u[k] = s[k] * u[k] + b[k];
+                    }
                 }
             }
         }
     }
 
+    template<Dimension vectorOrientation, typename ElementType, Dimension dimension0, Dimension dimension2>
+    void TensorOperations::ScaleAdd(UnorientedConstVectorReference<ElementType> s, UnorientedConstVectorReference<ElementType> b, TensorReference<ElementType, dimension0, vectorOrientation, dimension2> T)
+    {
+        MultiplyAdd<vectorOrientation>(s, b, T);
+    }
+
+    template<Dimension vectorOrientation, typename ElementType, Dimension dimension0, Dimension dimension1>
+    void TensorOperations::ScaleAdd(UnorientedConstVectorReference<ElementType> s, UnorientedConstVectorReference<ElementType> b, TensorReference<ElementType, dimension0, dimension1, vectorOrientation> T)
+    {
+        MultiplyAdd<vectorOrientation>(s, b, T);
+    }
+
     template<Dimension vectorOrientation, typename ElementType, Dimension dimension0, Dimension dimension2>
     void TensorOperations::Multiply(UnorientedConstVectorReference<ElementType> v, TensorReference<ElementType, dimension0, vectorOrientation, dimension2> T)
     {
@@ -134,5 +165,103 @@ namespace math
             Operations::Add(v[i], T.template GetSlice<dimension0, dimension2>(i));
         }
     }
+
+    template<typename ElementType, Dimension dimension0, Dimension dimension1, Dimension dimension2>
+    void TensorOperations::Copy(ConstTensorReference<ElementType, dimension0, dimension1, dimension2> input, TensorReference<ElementType, dimension0, dimension1, dimension2> output)
+    {
+        auto layout = input.GetLayout();
+        DEBUG_THROW(layout != output.GetLayout(), utilities::InputException(utilities::InputExceptionErrors::sizeMismatch, "input and output tensor dimensions must be the same"));
+
+        for (size_t i = 0; i < layout[2]; ++i)
+        {
+            auto inputSlice = input.GetPrimarySlice(i);
+            auto outputSlice = output.GetPrimarySlice(i);
+            for (size_t j = 0; j < layout[1]; ++j)
+            {
+                auto u = inputSlice.GetColumn(j);
+                auto w = outputSlice.GetColumn(j);
+                if (u.GetIncrement() == 1 && w.GetIncrement() == 1)
+                {
+                    std::copy(u.GetDataPointer(), u.GetDataPointer() + layout[0], w.GetDataPointer());
+                }
+                else
+                {
+                    for (size_t k = 0; k < layout[0]; ++k)
+                    {
+                        w[k] = u[k];
+                    }
+                }
+            }
+        }
+    }
+
+    template<Dimension vectorOrientation, typename ElementType, Dimension dimension1, Dimension dimension2>
+    void TensorOperations::Add(UnorientedConstVectorReference<ElementType> v, ConstTensorReference<ElementType, vectorOrientation, dimension1, dimension2> input, TensorReference<ElementType, vectorOrientation, dimension1, dimension2> output)
+    {
+        auto layout = input.GetLayout();
+        DEBUG_THROW(v.Size() != layout[0], utilities::InputException(utilities::InputExceptionErrors::sizeMismatch, "vector and tensor dimensions must be the same"));
+        DEBUG_THROW(layout != output.GetLayout(), utilities::InputException(utilities::InputExceptionErrors::sizeMismatch, "input and output tensor dimensions must be the same"));
+
+        for (size_t i = 0; i < layout[2]; ++i)
+        {
+            auto inputSlice = input.GetPrimarySlice(i);
+            auto outputSlice = output.GetPrimarySlice(i);
+            for (size_t j = 0; j < layout[1]; ++j)
+            {
+                auto u = inputSlice.GetColumn(j);
+                auto w = outputSlice.GetColumn(j);
+                for (size_t k = 0; k < layout[0]; ++k)
+                {
+                    w[k] = u[k] + v[k];
+                }
+            }
+        }
+    }
+
+    template<Dimension vectorOrientation, typename ElementType, Dimension dimension1, Dimension dimension2>
+    void TensorOperations::Multiply(UnorientedConstVectorReference<ElementType> v, ConstTensorReference<ElementType, vectorOrientation, dimension1, dimension2> input, TensorReference<ElementType, vectorOrientation, dimension1, dimension2> output)
+    {
+        auto layout = input.GetLayout();
+        DEBUG_THROW(v.Size() != layout[0], utilities::InputException(utilities::InputExceptionErrors::sizeMismatch, "vector and tensor dimensions must be the same"));
+        DEBUG_THROW(layout != output.GetLayout(), utilities::InputException(utilities::InputExceptionErrors::sizeMismatch, "input and output tensor dimensions must be the same"));
+
+        for (size_t i = 0; i < layout[2]; ++i)
+        {
+            auto inputSlice = input.GetPrimarySlice(i);
+            auto outputSlice = output.GetPrimarySlice(i);
+            for (size_t j = 0; j < layout[1]; ++j)
+            {
+                auto u = inputSlice.GetColumn(j);
+                auto w = outputSlice.GetColumn(j);
+                for (size_t k = 0; k < layout[0]; ++k)
+                {
+                    w[k] = u[k] * v[k];
+                }
+            }
+        }
+    }
+
+    template<Dimension vectorOrientation, typename ElementType, Dimension dimension1, Dimension dimension2>
+    void TensorOperations::ScaleAdd(UnorientedConstVectorReference<ElementType> s, UnorientedConstVectorReference<ElementType> b, ConstTensorReference<ElementType, vectorOrientation, dimension1, dimension2> input, TensorReference<ElementType, vectorOrientation, dimension1, dimension2> output)
+    {
+        auto layout = input.GetLayout();
+        DEBUG_THROW(s.Size() != layout[0] || b.Size() != layout[0], utilities::InputException(utilities::InputExceptionErrors::sizeMismatch, "vectors and tensor dimensions must be the same"));
+        DEBUG_THROW(layout != output.GetLayout(), utilities::InputException(utilities::InputExceptionErrors::sizeMismatch, "input and output tensor dimensions must be the same"));
+
+        for (size_t i = 0; i < layout[2]; ++i)
+        {
+            auto inputSlice = input.GetPrimarySlice(i);
+            auto outputSlice = output.GetPrimarySlice(i);
+            for (size_t j = 0; j < layout[1]; ++j)
+            {
+                auto u = inputSlice.GetColumn(j);
+                auto w = outputSlice.GetColumn(j);
+                for (size_t k = 0; k < layout[0]; ++k)
+                {
+                    w[k] = s[k] * u[k] + b[k];
+                }
+            }
+        }
+    }
 }
 }
\ No newline at end of file
@@ -0,0 +1,31 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ContentHash_test.h (math_test)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// math
+#include "ContentHash.h"
+
+using namespace ell;
+
+/// <summary> Checks the underlying hash against known xxHash64 test vectors. </summary>
+void TestFastHashKnownValues();
+
+/// <summary> Tests hashing of vector contents. </summary>
+template <typename ElementType>
+void TestVectorContentHash();
+
+/// <summary> Tests hashing of matrix contents, including padded submatrix views. </summary>
+template <typename ElementType, math::MatrixLayout layout>
+void TestMatrixContentHash();
+
+/// <summary> Tests hashing of tensor contents. </summary>
+template <typename ElementType>
+void TestTensorContentHash();
+
+#include "../tcc/ContentHash_test.tcc"
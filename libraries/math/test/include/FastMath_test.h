@@ -0,0 +1,25 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     FastMath_test.h (math_test)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// math
+#include "FastMath.h"
+
+using namespace ell;
+
+template <typename ElementType>
+void TestFastExp();
+
+template <typename ElementType>
+void TestFastSigmoid();
+
+template <typename ElementType>
+void TestFastTanh();
+
+#include "../tcc/FastMath_test.tcc"
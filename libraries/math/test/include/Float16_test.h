@@ -0,0 +1,20 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     Float16_test.h (math_test)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// math
+#include "Float16.h"
+
+using namespace ell;
+
+void TestFloat16Conversions();
+
+void TestFloat16Rounding();
+
+#include "../tcc/Float16_test.tcc"
@@ -8,12 +8,17 @@
 #pragma once
 
 #include "Matrix.h"
+#include "StaticMatrix.h"
+#include "StaticVector.h"
 
 using namespace ell;
 
 template <typename ElementType, math::MatrixLayout layout>
 void TestMatrix1();
 
+template <typename ElementType, math::MatrixLayout layout>
+void TestStaticMatrix();
+
 template <typename ElementType, math::MatrixLayout layout>
 void TestMatrix2();
 
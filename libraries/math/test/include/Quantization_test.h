@@ -0,0 +1,20 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     Quantization_test.h (math_test)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// math
+#include "Quantization.h"
+
+using namespace ell;
+
+/// <summary> Tests the quantize/dequantize boundary kernels. </summary>
+template <typename ElementType>
+void TestQuantization();
+
+#include "../tcc/Quantization_test.tcc"
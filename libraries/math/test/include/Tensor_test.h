@@ -39,6 +39,15 @@ void TestTensorVectorMultiply();
 template<typename ElementType, math::Dimension dimension0, math::Dimension dimension1, math::Dimension dimension2>
 void TestTensorVectorMultiplyAdd();
 
+template<typename ElementType, math::Dimension dimension0, math::Dimension dimension1, math::Dimension dimension2>
+void TestTensorVectorScaleAdd();
+
+template<typename ElementType, math::Dimension dimension0, math::Dimension dimension1, math::Dimension dimension2>
+void TestTensorCopy();
+
+template<typename ElementType>
+void TestTensorVectorOutOfPlace();
+
 template<typename ElementType, math::Dimension dimension0, math::Dimension dimension1, math::Dimension dimension2>
 void TestTensorArchiver();
 
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "Operations.h"
+#include "StaticVector.h"
 #include "Vector.h"
 
 using namespace ell;
@@ -15,6 +16,9 @@ using namespace ell;
 template <typename ElementType, math::VectorOrientation orientation>
 void TestVector();
 
+template <typename ElementType, math::VectorOrientation orientation>
+void TestStaticVector();
+
 template <typename ElementType, math::ImplementationType implementation>
 void TestVectorOperations();
 
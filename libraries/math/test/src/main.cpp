@@ -9,6 +9,10 @@
 #include "Vector_test.h"
 #include "Matrix_test.h"
 #include "Tensor_test.h"
+#include "FastMath_test.h"
+#include "Float16_test.h"
+#include "ContentHash_test.h"
+#include "Quantization_test.h"
 
 using namespace ell;
 
@@ -23,6 +27,11 @@ int main()
     TestVector<float, math::VectorOrientation::column>();
     TestVector<double, math::VectorOrientation::column>();
 
+    TestStaticVector<float, math::VectorOrientation::row>();
+    TestStaticVector<double, math::VectorOrientation::row>();
+    TestStaticVector<float, math::VectorOrientation::column>();
+    TestStaticVector<double, math::VectorOrientation::column>();
+
     TestVectorOperations<float, math::ImplementationType::native>();
     TestVectorOperations<double, math::ImplementationType::native>();
     TestVectorOperations<float, math::ImplementationType::openBlas>();
@@ -65,6 +74,11 @@ int main()
     TestMatrix2<double, math::MatrixLayout::rowMajor>();
     TestMatrix2<double, math::MatrixLayout::columnMajor>();
 
+    TestStaticMatrix<float, math::MatrixLayout::rowMajor>();
+    TestStaticMatrix<float, math::MatrixLayout::columnMajor>();
+    TestStaticMatrix<double, math::MatrixLayout::rowMajor>();
+    TestStaticMatrix<double, math::MatrixLayout::columnMajor>();
+
     TestMatrixArchiver<float, math::MatrixLayout::rowMajor>();
     TestMatrixArchiver<float, math::MatrixLayout::columnMajor>();
     TestMatrixArchiver<double, math::MatrixLayout::rowMajor>();
@@ -113,6 +127,10 @@ int main()
     TestMatrixMatrixMultiply<double, math::MatrixLayout::rowMajor, math::MatrixLayout::columnMajor, math::ImplementationType::native>();
     TestMatrixMatrixMultiply<double, math::MatrixLayout::columnMajor, math::MatrixLayout::rowMajor, math::ImplementationType::native>();
     TestMatrixMatrixMultiply<double, math::MatrixLayout::columnMajor, math::MatrixLayout::columnMajor, math::ImplementationType::native>();
+    TestMatrixMatrixMultiply<double, math::MatrixLayout::rowMajor, math::MatrixLayout::rowMajor, math::ImplementationType::nativeParallel>();
+    TestMatrixMatrixMultiply<double, math::MatrixLayout::rowMajor, math::MatrixLayout::columnMajor, math::ImplementationType::nativeParallel>();
+    TestMatrixMatrixMultiply<double, math::MatrixLayout::columnMajor, math::MatrixLayout::rowMajor, math::ImplementationType::nativeParallel>();
+    TestMatrixMatrixMultiply<double, math::MatrixLayout::columnMajor, math::MatrixLayout::columnMajor, math::ImplementationType::nativeParallel>();
     TestMatrixMatrixMultiply<double, math::MatrixLayout::rowMajor, math::MatrixLayout::rowMajor, math::ImplementationType::openBlas>();
     TestMatrixMatrixMultiply<double, math::MatrixLayout::rowMajor, math::MatrixLayout::columnMajor, math::ImplementationType::openBlas>();
     TestMatrixMatrixMultiply<double, math::MatrixLayout::columnMajor, math::MatrixLayout::rowMajor, math::ImplementationType::openBlas>();
@@ -163,12 +181,60 @@ int main()
     TestTensorVectorMultiplyAdd<double, math::Dimension::channel, math::Dimension::column, math::Dimension::row>();
     TestTensorVectorMultiplyAdd<float, math::Dimension::column, math::Dimension::row, math::Dimension::channel>();
     TestTensorVectorMultiplyAdd<float, math::Dimension::channel, math::Dimension::column, math::Dimension::row>();
+    TestTensorVectorScaleAdd<double, math::Dimension::column, math::Dimension::row, math::Dimension::channel>();
+    TestTensorVectorScaleAdd<double, math::Dimension::channel, math::Dimension::column, math::Dimension::row>();
+    TestTensorVectorScaleAdd<float, math::Dimension::column, math::Dimension::row, math::Dimension::channel>();
+    TestTensorVectorScaleAdd<float, math::Dimension::channel, math::Dimension::column, math::Dimension::row>();
+
+    TestTensorCopy<double, math::Dimension::column, math::Dimension::row, math::Dimension::channel>();
+    TestTensorCopy<double, math::Dimension::channel, math::Dimension::column, math::Dimension::row>();
+    TestTensorCopy<float, math::Dimension::column, math::Dimension::row, math::Dimension::channel>();
+    TestTensorCopy<float, math::Dimension::channel, math::Dimension::column, math::Dimension::row>();
+    TestTensorVectorOutOfPlace<double>();
+    TestTensorVectorOutOfPlace<float>();
 
     TestTensorArchiver<double, math::Dimension::column, math::Dimension::row, math::Dimension::channel>();
     TestTensorArchiver<double, math::Dimension::channel, math::Dimension::column, math::Dimension::row>();
     TestTensorArchiver<float, math::Dimension::column, math::Dimension::row, math::Dimension::channel>();
     TestTensorArchiver<float, math::Dimension::channel, math::Dimension::column, math::Dimension::row>();
 
+    //
+    // FastMath tests
+    //
+
+    TestFastExp<float>();
+    TestFastExp<double>();
+    TestFastSigmoid<float>();
+    TestFastSigmoid<double>();
+    TestFastTanh<float>();
+    TestFastTanh<double>();
+
+    //
+    // Float16 tests
+    //
+
+    TestFloat16Conversions();
+    TestFloat16Rounding();
+
+    //
+    // ContentHash tests
+    //
+
+    TestFastHashKnownValues();
+    TestVectorContentHash<float>();
+    TestVectorContentHash<double>();
+    TestMatrixContentHash<float, math::MatrixLayout::rowMajor>();
+    TestMatrixContentHash<double, math::MatrixLayout::columnMajor>();
+    TestTensorContentHash<float>();
+    TestTensorContentHash<double>();
+
+    //
+    // Quantization tests
+    //
+
+    TestQuantization<float>();
+    TestQuantization<double>();
+
     if (testing::DidTestFail())
     {
         return 1;
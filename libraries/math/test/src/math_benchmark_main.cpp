@@ -0,0 +1,246 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     math_benchmark_main.cpp (math)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// math
+#include "Matrix.h"
+#include "Operations.h"
+#include "Vector.h"
+
+// utilities
+#include "MillisecondTimer.h"
+
+// stl
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace ell;
+
+// Times the math::Operations kernels (dot, axpy, gemv, gemm) for each implementation across a
+// doubling size sweep and both matrix layouts, and prints one CSV row per measurement to stdout:
+//
+//     kernel,elementType,layout,implementation,size,repetitions,timePerCallMs,gflops
+//
+// After the sweep, a summary of crossover points (sizes where the fastest implementation for a
+// kernel/layout combination changes) is printed to stderr, so per-platform implementation
+// selection thresholds can be read off a run instead of guessed.
+//
+// Usage: math_benchmark [maxSize]
+//
+// maxSize defaults to 4096; pass a smaller power of two for a quick run.
+
+namespace
+{
+    // Approximate floating point operation count per measurement; repetitions are scaled so small
+    // kernels are timed over many calls and large ones over few.
+    constexpr double targetOpsPerMeasurement = 2.0e8;
+
+    struct Measurement
+    {
+        std::string kernel;
+        std::string elementType;
+        std::string layout;
+        std::string implementation;
+        size_t size;
+        double timePerCallMs;
+        double gflops;
+    };
+
+    std::vector<Measurement> measurements;
+
+    std::default_random_engine randomEngine(123);
+
+    template <typename ElementType>
+    ElementType GetRandomValue()
+    {
+        std::uniform_real_distribution<ElementType> distribution(-1, 1);
+        return distribution(randomEngine);
+    }
+
+    template <typename ElementType>
+    const char* GetElementTypeName();
+
+    template <>
+    const char* GetElementTypeName<float>() { return "float"; }
+
+    template <>
+    const char* GetElementTypeName<double>() { return "double"; }
+
+    template <math::MatrixLayout layout>
+    const char* GetLayoutName();
+
+    template <>
+    const char* GetLayoutName<math::MatrixLayout::rowMajor>() { return "rowMajor"; }
+
+    template <>
+    const char* GetLayoutName<math::MatrixLayout::columnMajor>() { return "columnMajor"; }
+
+    size_t GetRepetitions(double opsPerCall)
+    {
+        return std::max<size_t>(1, static_cast<size_t>(targetOpsPerMeasurement / opsPerCall));
+    }
+
+    template <typename BodyType>
+    void Measure(const std::string& kernel, const std::string& elementType, const std::string& layout, const std::string& implementation, size_t size, double opsPerCall, BodyType body)
+    {
+        size_t repetitions = GetRepetitions(opsPerCall);
+        body(); // warmup
+
+        utilities::NanosecondTimer timer;
+        for (size_t i = 0; i < repetitions; ++i)
+        {
+            body();
+        }
+        timer.Stop();
+
+        double totalMs = timer.Elapsed() * 1.0e-6;
+        double timePerCallMs = totalMs / repetitions;
+        double gflops = (timePerCallMs > 0) ? opsPerCall / (timePerCallMs * 1.0e6) : 0;
+
+        measurements.push_back({ kernel, elementType, layout, implementation, size, timePerCallMs, gflops });
+
+        std::cout << kernel << "," << elementType << "," << layout << "," << implementation << "," << size << "," << repetitions << ","
+                  << std::setprecision(6) << timePerCallMs << "," << gflops << "\n";
+    }
+
+    template <typename ElementType, math::ImplementationType implementation>
+    void BenchmarkVectorKernels(size_t size)
+    {
+        using Ops = math::OperationsImplementation<implementation>;
+        auto implementationName = Ops::GetImplementationName();
+        auto elementTypeName = GetElementTypeName<ElementType>();
+
+        math::RowVector<ElementType> u(size);
+        math::RowVector<ElementType> v(size);
+        u.Generate(GetRandomValue<ElementType>);
+        v.Generate(GetRandomValue<ElementType>);
+
+        volatile ElementType sink = 0;
+        Measure("dot", elementTypeName, "-", implementationName, size, 2.0 * size, [&] {
+            sink = Ops::Dot(u, v);
+        });
+        (void)sink;
+
+        Measure("axpy", elementTypeName, "-", implementationName, size, 2.0 * size, [&] {
+            Ops::Add(static_cast<ElementType>(0.5), v.GetConstReference(), u.GetReference());
+        });
+    }
+
+    template <typename ElementType, math::MatrixLayout layout, math::ImplementationType implementation>
+    void BenchmarkGemv(size_t size)
+    {
+        using Ops = math::OperationsImplementation<implementation>;
+
+        math::Matrix<ElementType, layout> M(size, size);
+        math::ColumnVector<ElementType> v(size);
+        math::ColumnVector<ElementType> u(size);
+        M.Generate(GetRandomValue<ElementType>);
+        v.Generate(GetRandomValue<ElementType>);
+
+        Measure("gemv", GetElementTypeName<ElementType>(), GetLayoutName<layout>(), Ops::GetImplementationName(), size, 2.0 * size * size, [&] {
+            Ops::Multiply(static_cast<ElementType>(1), M.GetConstReference(), v.GetConstReference(), static_cast<ElementType>(0), u.GetReference());
+        });
+    }
+
+    template <typename ElementType, math::MatrixLayout layout, math::ImplementationType implementation>
+    void BenchmarkGemm(size_t size)
+    {
+        using Ops = math::OperationsImplementation<implementation>;
+
+        math::Matrix<ElementType, layout> A(size, size);
+        math::Matrix<ElementType, layout> B(size, size);
+        math::Matrix<ElementType, layout> C(size, size);
+        A.Generate(GetRandomValue<ElementType>);
+        B.Generate(GetRandomValue<ElementType>);
+
+        Measure("gemm", GetElementTypeName<ElementType>(), GetLayoutName<layout>(), Ops::GetImplementationName(), size, 2.0 * size * size * size, [&] {
+            Ops::Multiply(static_cast<ElementType>(1), A.GetConstReference(), B.GetConstReference(), static_cast<ElementType>(0), C.GetReference());
+        });
+    }
+
+    template <typename ElementType>
+    void RunSweep(size_t maxSize)
+    {
+        for (size_t size = 8; size <= maxSize; size *= 2)
+        {
+            BenchmarkVectorKernels<ElementType, math::ImplementationType::native>(size);
+            BenchmarkVectorKernels<ElementType, math::ImplementationType::openBlas>(size);
+
+            BenchmarkGemv<ElementType, math::MatrixLayout::rowMajor, math::ImplementationType::native>(size);
+            BenchmarkGemv<ElementType, math::MatrixLayout::rowMajor, math::ImplementationType::openBlas>(size);
+            BenchmarkGemv<ElementType, math::MatrixLayout::columnMajor, math::ImplementationType::native>(size);
+            BenchmarkGemv<ElementType, math::MatrixLayout::columnMajor, math::ImplementationType::openBlas>(size);
+
+            BenchmarkGemm<ElementType, math::MatrixLayout::rowMajor, math::ImplementationType::native>(size);
+            BenchmarkGemm<ElementType, math::MatrixLayout::rowMajor, math::ImplementationType::nativeParallel>(size);
+            BenchmarkGemm<ElementType, math::MatrixLayout::rowMajor, math::ImplementationType::openBlas>(size);
+            BenchmarkGemm<ElementType, math::MatrixLayout::columnMajor, math::ImplementationType::native>(size);
+            BenchmarkGemm<ElementType, math::MatrixLayout::columnMajor, math::ImplementationType::nativeParallel>(size);
+            BenchmarkGemm<ElementType, math::MatrixLayout::columnMajor, math::ImplementationType::openBlas>(size);
+        }
+    }
+
+    void ReportCrossovers()
+    {
+        // Group measurements by kernel/elementType/layout; within each group, walk the size sweep
+        // in order and report every size at which the fastest implementation changes.
+        std::map<std::string, std::map<size_t, std::pair<std::string, double>>> fastest;
+        for (const auto& m : measurements)
+        {
+            auto key = m.kernel + "," + m.elementType + "," + m.layout;
+            auto& entry = fastest[key][m.size];
+            if (entry.first.empty() || m.timePerCallMs < entry.second)
+            {
+                entry = { m.implementation, m.timePerCallMs };
+            }
+        }
+
+        std::cerr << "\nCrossover points (size at which the fastest implementation changes):\n";
+        for (const auto& group : fastest)
+        {
+            std::string previous;
+            for (const auto& sizeEntry : group.second)
+            {
+                const auto& winner = sizeEntry.second.first;
+                if (!previous.empty() && winner != previous)
+                {
+                    std::cerr << "    " << group.first << ": " << previous << " -> " << winner << " at size " << sizeEntry.first << "\n";
+                }
+                previous = winner;
+            }
+            std::cerr << "    " << group.first << ": fastest at size " << group.second.rbegin()->first << " is " << group.second.rbegin()->second.first << "\n";
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    size_t maxSize = 4096;
+    if (argc > 1)
+    {
+        maxSize = static_cast<size_t>(std::strtoul(argv[1], nullptr, 10));
+        if (maxSize < 8)
+        {
+            std::cerr << "usage: math_benchmark [maxSize >= 8]\n";
+            return 1;
+        }
+    }
+
+    std::cout << "kernel,elementType,layout,implementation,size,repetitions,timePerCallMs,gflops\n";
+
+    RunSweep<float>(maxSize);
+    RunSweep<double>(maxSize);
+
+    ReportCrossovers();
+    return 0;
+}
@@ -0,0 +1,84 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ContentHash_test.tcc (math_test)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// math
+#include "Matrix.h"
+#include "Tensor.h"
+#include "Vector.h"
+
+// utilities
+#include "FastHash.h"
+
+// testing
+#include "testing.h"
+
+inline void TestFastHashKnownValues()
+{
+    // reference values from the xxHash64 specification
+    auto emptyHash = ell::utilities::FastHash::Hash(nullptr, 0);
+    testing::ProcessTest("FastHash::Hash(\"\")", emptyHash == 0xEF46DB3751D8E999ULL);
+
+    const char* abc = "abc";
+    auto abcHash = ell::utilities::FastHash::Hash(abc, 3);
+    testing::ProcessTest("FastHash::Hash(\"abc\")", abcHash == 0x44BC2CF5AD770999ULL);
+
+    // incremental hashing gives the same answer as one-shot hashing
+    ell::utilities::FastHash hasher;
+    hasher.Update(abc, 1);
+    hasher.Update(abc + 1, 2);
+    testing::ProcessTest("FastHash::Update() incremental", hasher.Digest() == abcHash);
+}
+
+template <typename ElementType>
+void TestVectorContentHash()
+{
+    math::ColumnVector<ElementType> u{ 1, 2, 3, 4 };
+    math::ColumnVector<ElementType> v{ 1, 2, 3, 4 };
+    math::ColumnVector<ElementType> w{ 1, 2, 3, 5 };
+
+    testing::ProcessTest("HashContents(Vector) equal contents", math::HashContents(u) == math::HashContents(v));
+    testing::ProcessTest("HashContents(Vector) different contents", math::HashContents(u) != math::HashContents(w));
+    testing::ProcessTest("HashContents(Vector) different seeds", math::HashContents(u, 1) != math::HashContents(u, 2));
+}
+
+template <typename ElementType, math::MatrixLayout layout>
+void TestMatrixContentHash()
+{
+    math::Matrix<ElementType, layout> M{
+        { 1, 2, 3 },
+        { 4, 5, 6 }
+    };
+
+    math::Matrix<ElementType, layout> N(4, 5);
+    N.GetSubMatrix(1, 1, 2, 3).CopyFrom(M);
+    auto paddedView = N.GetSubMatrix(1, 1, 2, 3);
+
+    // a padded submatrix view hashes the same as a contiguous copy of its contents
+    testing::ProcessTest("HashContents(Matrix) padded view", math::HashContents(M) == math::HashContents(paddedView));
+
+    N(2, 2) += 1;
+    testing::ProcessTest("HashContents(Matrix) different contents", math::HashContents(M) != math::HashContents(paddedView));
+}
+
+template <typename ElementType>
+void TestTensorContentHash()
+{
+    auto S = math::ChannelColumnRowTensor<ElementType>{
+        { { 1, 2 }, { 3, 4 } },
+        { { 5, 6 }, { 7, 8 } }
+    };
+    auto T = math::ChannelColumnRowTensor<ElementType>{
+        { { 1, 2 }, { 3, 4 } },
+        { { 5, 6 }, { 7, 8 } }
+    };
+
+    testing::ProcessTest("HashContents(Tensor) equal contents", math::HashContents(S) == math::HashContents(T));
+
+    T(1, 1, 1) += 1;
+    testing::ProcessTest("HashContents(Tensor) different contents", math::HashContents(S) != math::HashContents(T));
+}
@@ -0,0 +1,96 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     FastMath_test.tcc (math_test)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// testing
+#include "testing.h"
+
+// stl
+#include <cmath>
+#include <vector>
+
+template <typename ElementType>
+void TestFastExp()
+{
+    const double relativeTolerance = 1.0e-6;
+
+    bool accurate = true;
+    for (double x = -30.0; x <= 30.0; x += 0.05)
+    {
+        double approximation = math::FastMath::Exp(static_cast<ElementType>(x));
+        double exact = std::exp(x);
+        if (std::abs(approximation - exact) > relativeTolerance * exact)
+        {
+            accurate = false;
+            break;
+        }
+    }
+    testing::ProcessTest("FastMath::Exp() accuracy", accurate);
+
+    // large negative arguments flush to zero, large positive ones saturate without overflowing
+    auto tiny = math::FastMath::Exp(static_cast<ElementType>(-1000.0));
+    auto huge = math::FastMath::Exp(static_cast<ElementType>(1000.0));
+    testing::ProcessTest("FastMath::Exp() range clamping", tiny >= 0 && tiny < 1.0e-30 && std::isfinite(huge));
+
+    // the in-place vector form matches the scalar form
+    std::vector<ElementType> values{ -5, -1, 0, static_cast<ElementType>(0.5), 3 };
+    auto expected = values;
+    math::FastMath::Exp(values.data(), values.size());
+    bool vectorMatches = true;
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        vectorMatches &= (values[i] == math::FastMath::Exp(expected[i]));
+    }
+    testing::ProcessTest("FastMath::Exp() vector form", vectorMatches);
+}
+
+template <typename ElementType>
+void TestFastSigmoid()
+{
+    const double tolerance = 1.0e-6;
+
+    bool accurate = true;
+    for (double x = -30.0; x <= 30.0; x += 0.05)
+    {
+        double approximation = math::FastMath::Sigmoid(static_cast<ElementType>(x));
+        double exact = 1.0 / (1.0 + std::exp(-x));
+        if (std::abs(approximation - exact) > tolerance)
+        {
+            accurate = false;
+            break;
+        }
+    }
+    testing::ProcessTest("FastMath::Sigmoid() accuracy", accurate);
+
+    // stable at both tails
+    auto low = math::FastMath::Sigmoid(static_cast<ElementType>(-1000.0));
+    auto high = math::FastMath::Sigmoid(static_cast<ElementType>(1000.0));
+    testing::ProcessTest("FastMath::Sigmoid() saturation", low >= 0 && low < 1.0e-30 && testing::IsEqual(static_cast<double>(high), 1.0));
+}
+
+template <typename ElementType>
+void TestFastTanh()
+{
+    const double tolerance = 1.0e-6;
+
+    bool accurate = true;
+    for (double x = -15.0; x <= 15.0; x += 0.05)
+    {
+        double approximation = math::FastMath::Tanh(static_cast<ElementType>(x));
+        double exact = std::tanh(x);
+        if (std::abs(approximation - exact) > tolerance)
+        {
+            accurate = false;
+            break;
+        }
+    }
+    testing::ProcessTest("FastMath::Tanh() accuracy", accurate);
+
+    auto low = math::FastMath::Tanh(static_cast<ElementType>(-1000.0));
+    auto high = math::FastMath::Tanh(static_cast<ElementType>(1000.0));
+    testing::ProcessTest("FastMath::Tanh() saturation", testing::IsEqual(static_cast<double>(low), -1.0) && testing::IsEqual(static_cast<double>(high), 1.0));
+}
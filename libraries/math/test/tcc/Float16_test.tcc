@@ -0,0 +1,67 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     Float16_test.tcc (math_test)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// testing
+#include "testing.h"
+
+// stl
+#include <cmath>
+#include <vector>
+
+void TestFloat16Conversions()
+{
+    // every finite half-precision value (normal and subnormal) widens exactly, so
+    // widening and re-narrowing must reproduce the original bit pattern
+    bool exact = true;
+    for (uint32_t bits = 0; bits <= 0xffff; ++bits)
+    {
+        math::Float16 half{ static_cast<uint16_t>(bits) };
+        if ((bits & 0x7c00) == 0x7c00 && (bits & 0x3ff) != 0)
+        {
+            // NaN: the payload isn't preserved, but NaN-ness must be
+            exact &= std::isnan(math::ToFloat32(half));
+            continue;
+        }
+        exact &= (math::ToFloat16(math::ToFloat32(half)).bits == half.bits);
+    }
+    testing::ProcessTest("Float16 widen/narrow round trip", exact);
+
+    // specials
+    testing::ProcessTest("Float16 zero", math::ToFloat32(math::ToFloat16(0.0f)) == 0.0f);
+    testing::ProcessTest("Float16 largest normal", math::ToFloat32(math::ToFloat16(65504.0f)) == 65504.0f);
+    testing::ProcessTest("Float16 overflow to infinity", std::isinf(math::ToFloat32(math::ToFloat16(1.0e6f))));
+    testing::ProcessTest("Float16 flush to zero", math::ToFloat32(math::ToFloat16(1.0e-8f)) == 0.0f);
+    testing::ProcessTest("Float16 NaN", std::isnan(math::ToFloat32(math::ToFloat16(std::nanf("")))));
+    testing::ProcessTest("Float16 negative", math::ToFloat32(math::ToFloat16(-2.5f)) == -2.5f);
+
+    // the bulk forms match the scalar forms
+    std::vector<float> values{ -1.0f, 0.0f, 0.1f, 3.14159f, 1000.0f };
+    auto halves = math::ToFloat16(values.data(), values.size());
+    std::vector<float> widened(values.size());
+    math::ToFloat32(halves.data(), halves.size(), widened.data());
+    bool bulkMatches = true;
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        bulkMatches &= (widened[i] == math::ToFloat32(math::ToFloat16(values[i])));
+    }
+    testing::ProcessTest("Float16 bulk conversion", bulkMatches);
+}
+
+void TestFloat16Rounding()
+{
+    // half precision has a 10-bit mantissa, so the spacing just above 1.0 is 2^-10; exactly
+    // halfway values round to the neighbor with an even mantissa
+    float oneUlp = 1.0f / 1024;
+    testing::ProcessTest("Float16 round halfway down to even", math::RoundToFloat16(1.0f + oneUlp / 2) == 1.0f);
+    testing::ProcessTest("Float16 round halfway up to even", math::RoundToFloat16(1.0f + 3 * oneUlp / 2) == 1.0f + 2 * oneUlp);
+    testing::ProcessTest("Float16 round above halfway", math::RoundToFloat16(1.0f + 3 * oneUlp / 4) == 1.0f + oneUlp);
+
+    // the double overload goes through the same storage format
+    testing::ProcessTest("Float16 double round trip", math::RoundToFloat16(2.5) == 2.5);
+    testing::ProcessTest("Float16 double rounding", math::RoundToFloat16(1.0 + static_cast<double>(oneUlp) / 2) == 1.0);
+}
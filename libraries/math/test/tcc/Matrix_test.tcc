@@ -82,6 +82,43 @@ void TestMatrix1()
     M.Generate(generator);
 }
 
+template <typename ElementType, math::MatrixLayout layout>
+void TestStaticMatrix()
+{
+    math::StaticMatrix<ElementType, 3, 3, layout> M{
+        { 1, 2, 3 },
+        { 4, 5, 6 },
+        { 7, 8, 9 }
+    };
+
+    math::Matrix<ElementType, layout> R0{
+        { 1, 2, 3 },
+        { 4, 5, 6 },
+        { 7, 8, 9 }
+    };
+    testing::ProcessTest("StaticMatrix initializer list", M == R0);
+
+    // static matrices work with the regular matrix operations
+    math::Operations::Multiply(static_cast<ElementType>(2), M);
+    math::Matrix<ElementType, layout> R1{
+        { 2, 4, 6 },
+        { 8, 10, 12 },
+        { 14, 16, 18 }
+    };
+    testing::ProcessTest("Operations::Multiply(StaticMatrix)", M == R1);
+
+    math::StaticVector<ElementType, 3, math::VectorOrientation::column> v{ 1, 0, 1 };
+    math::StaticVector<ElementType, 3, math::VectorOrientation::column> u;
+    math::Operations::Multiply(static_cast<ElementType>(1), M, v, static_cast<ElementType>(0), u);
+    math::ColumnVector<ElementType> r{ 8, 20, 32 };
+    testing::ProcessTest("Operations::Multiply(StaticMatrix, StaticVector)", u == r);
+
+    // copies get their own storage
+    auto N = M;
+    N.Fill(0);
+    testing::ProcessTest("StaticMatrix copy", M == R1 && N(0, 0) == 0);
+}
+
 template <typename ElementType, math::MatrixLayout layout>
 void TestMatrix2()
 {
@@ -0,0 +1,60 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     Quantization_test.tcc (math_test)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// testing
+#include "testing.h"
+
+// stl
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+template <typename ElementType>
+void TestQuantization()
+{
+    std::vector<ElementType> values{ 1, -2, static_cast<ElementType>(2.5), -4, 0 };
+    testing::ProcessTest("MaxAbsValue()", math::MaxAbsValue(values.data(), values.size()) == 4);
+    testing::ProcessTest("MaxAbsValue() of empty array", math::MaxAbsValue(values.data(), 0) == 0);
+
+    // quantize with a scale of 4/127, the scale MaxAbsValue implies for this data
+    ElementType scale = static_cast<ElementType>(4) / 127;
+    std::vector<int8_t> quantized(values.size());
+    math::QuantizeValues(values.data(), quantized.data(), values.size(), scale);
+    std::vector<int8_t> expected{ 32, -64, 79, -127, 0 };
+    testing::ProcessTest("QuantizeValues()", quantized == expected);
+
+    // dequantizing recovers the values to within half a quantization step
+    std::vector<ElementType> recovered(values.size());
+    math::DequantizeValues(quantized.data(), recovered.data(), quantized.size(), scale);
+    bool roundTripPassed = true;
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        roundTripPassed &= std::abs(recovered[i] - values[i]) <= scale / 2;
+    }
+    testing::ProcessTest("DequantizeValues() round trip", roundTripPassed);
+
+    // values beyond the range the scale was chosen for saturate instead of wrapping
+    std::vector<ElementType> outOfRange{ 1000, -1000 };
+    std::vector<int8_t> saturated(outOfRange.size());
+    math::QuantizeValues(outOfRange.data(), saturated.data(), outOfRange.size(), scale);
+    testing::ProcessTest("QuantizeValues() saturation", saturated[0] == 127 && saturated[1] == -128);
+
+    // a nonzero zero point shifts the representable range
+    std::vector<ElementType> nonNegative{ 0, 2, 4 };
+    std::vector<int8_t> shifted(nonNegative.size());
+    math::QuantizeValues(nonNegative.data(), shifted.data(), nonNegative.size(), scale, -128);
+    testing::ProcessTest("QuantizeValues() with zero point", shifted[0] == -128 && shifted[2] == -1);
+    std::vector<ElementType> recoveredShifted(shifted.size());
+    math::DequantizeValues(shifted.data(), recoveredShifted.data(), shifted.size(), scale, -128);
+    bool zeroPointPassed = true;
+    for (size_t i = 0; i < nonNegative.size(); ++i)
+    {
+        zeroPointPassed &= std::abs(recoveredShifted[i] - nonNegative[i]) <= scale / 2;
+    }
+    testing::ProcessTest("DequantizeValues() with zero point", zeroPointPassed);
+}
@@ -430,6 +430,105 @@ void TestTensorVectorMultiplyAdd()
     testing::ProcessTest("void TestTensorVectoMultiplyAdd() with subtensor", TR == R3);
 }
 
+template<typename ElementType, math::Dimension dimension0, math::Dimension dimension1, math::Dimension dimension2>
+void TestTensorVectorScaleAdd()
+{
+    auto T = math::Tensor<ElementType, dimension0, dimension1, dimension2>(2, 3, 4);
+    T.Fill(1);
+    auto s1 = math::Vector<ElementType, math::VectorOrientation::row>{ 1,2 };
+    auto b1 = math::Vector<ElementType, math::VectorOrientation::row>{ 3,4 };
+    math::TensorOperations::ScaleAdd<math::Dimension::row>(s1, b1, T);
+    auto R1 = math::Tensor<ElementType, dimension0, dimension1, dimension2>{ { { 4,4,4,4 },{ 4,4,4,4 },{ 4,4,4,4 } },
+                                                                             { { 6,6,6,6 },{ 6,6,6,6 },{ 6,6,6,6 } } };
+    testing::ProcessTest("void TestTensorVectorScaleAdd()", T == R1);
+
+    T.Fill(1);
+    auto s2 = math::Vector<ElementType, math::VectorOrientation::row>{ 1,2,3 };
+    auto b2 = math::Vector<ElementType, math::VectorOrientation::row>{ 4,5,6 };
+    math::TensorOperations::ScaleAdd<math::Dimension::column>(s2, b2, T);
+    auto R2 = math::Tensor<ElementType, dimension0, dimension1, dimension2>{ { { 5,5,5,5 },{ 7,7,7,7 },{ 9,9,9,9 } },
+                                                                             { { 5,5,5,5 },{ 7,7,7,7 },{ 9,9,9,9 } } };
+    testing::ProcessTest("void TestTensorVectorScaleAdd()", T == R2);
+
+    T.Fill(1);
+    auto s3 = math::Vector<ElementType, math::VectorOrientation::row>{ 1,2,3,4 };
+    auto b3 = math::Vector<ElementType, math::VectorOrientation::row>{ 1,1,2,2 };
+    math::TensorOperations::ScaleAdd<math::Dimension::channel>(s3, b3, T);
+    auto R3 = math::Tensor<ElementType, dimension0, dimension1, dimension2>{ { { 2,3,5,6 },{ 2,3,5,6 },{ 2,3,5,6 } },
+                                                                             { { 2,3,5,6 },{ 2,3,5,6 },{ 2,3,5,6 } } };
+    testing::ProcessTest("void TestTensorVectorScaleAdd()", T == R3);
+
+    // subtensors, where the slices being transformed are not contiguous
+    auto TT = math::Tensor<ElementType, dimension0, dimension1, dimension2>(10, 10, 10);
+    auto TR = TT.GetSubTensor({ 5,3,1 }, { 2,3,4 });
+
+    TR.Fill(1);
+    math::TensorOperations::ScaleAdd<math::Dimension::row>(s1, b1, TR);
+    testing::ProcessTest("void TestTensorVectorScaleAdd() with subtensor", TR == R1);
+
+    TR.Fill(1);
+    math::TensorOperations::ScaleAdd<math::Dimension::column>(s2, b2, TR);
+    testing::ProcessTest("void TestTensorVectorScaleAdd() with subtensor", TR == R2);
+
+    TR.Fill(1);
+    math::TensorOperations::ScaleAdd<math::Dimension::channel>(s3, b3, TR);
+    testing::ProcessTest("void TestTensorVectorScaleAdd() with subtensor", TR == R3);
+}
+
+template<typename ElementType, math::Dimension dimension0, math::Dimension dimension1, math::Dimension dimension2>
+void TestTensorCopy()
+{
+    // both the source and destination are strided subtensor views
+    auto A = math::Tensor<ElementType, dimension0, dimension1, dimension2>(10, 10, 10);
+    A.Fill(7);
+    auto in = A.GetSubTensor({ 1,2,3 }, { 2,3,4 });
+    in.Fill(3);
+
+    auto B = math::Tensor<ElementType, dimension0, dimension1, dimension2>(10, 10, 10);
+    B.Fill(0);
+    auto out = B.GetSubTensor({ 5,3,1 }, { 2,3,4 });
+
+    math::TensorOperations::Copy(in, out);
+    testing::ProcessTest("void TestTensorCopy()", out == in);
+    testing::ProcessTest("void TestTensorCopy() leaves surroundings untouched", B(0, 0, 0) == 0 && B(9, 9, 9) == 0);
+}
+
+template<typename ElementType>
+void TestTensorVectorOutOfPlace()
+{
+    // the out-of-place kernels apply the vectors along the first dimension in the layout
+    using TensorType = math::Tensor<ElementType, math::Dimension::channel, math::Dimension::column, math::Dimension::row>;
+    auto In = TensorType(2, 3, 4);
+    In.Fill(1);
+    auto s = math::Vector<ElementType, math::VectorOrientation::row>{ 1,2,3,4 };
+    auto b = math::Vector<ElementType, math::VectorOrientation::row>{ 1,1,2,2 };
+
+    auto Out = TensorType(2, 3, 4);
+    math::TensorOperations::ScaleAdd<math::Dimension::channel>(s, b, In, Out);
+    auto R1 = TensorType{ { { 2,3,5,6 },{ 2,3,5,6 },{ 2,3,5,6 } },
+                          { { 2,3,5,6 },{ 2,3,5,6 },{ 2,3,5,6 } } };
+    testing::ProcessTest("void TestTensorVectorOutOfPlace() ScaleAdd", Out == R1 && In(0, 0, 0) == 1);
+
+    math::TensorOperations::Add<math::Dimension::channel>(b, In, Out);
+    auto R2 = TensorType{ { { 2,2,3,3 },{ 2,2,3,3 },{ 2,2,3,3 } },
+                          { { 2,2,3,3 },{ 2,2,3,3 },{ 2,2,3,3 } } };
+    testing::ProcessTest("void TestTensorVectorOutOfPlace() Add", Out == R2);
+
+    math::TensorOperations::Multiply<math::Dimension::channel>(s, In, Out);
+    auto R3 = TensorType{ { { 1,2,3,4 },{ 1,2,3,4 },{ 1,2,3,4 } },
+                          { { 1,2,3,4 },{ 1,2,3,4 },{ 1,2,3,4 } } };
+    testing::ProcessTest("void TestTensorVectorOutOfPlace() Multiply", Out == R3);
+
+    // strided views on both sides
+    auto InBig = TensorType(10, 10, 10);
+    auto OutBig = TensorType(10, 10, 10);
+    auto in = InBig.GetSubTensor({ 1,1,1 }, { 2,3,4 });
+    in.Fill(1);
+    auto out = OutBig.GetSubTensor({ 4,2,0 }, { 2,3,4 });
+    math::TensorOperations::ScaleAdd<math::Dimension::channel>(s, b, in, out);
+    testing::ProcessTest("void TestTensorVectorOutOfPlace() ScaleAdd with subtensors", out == R1);
+}
+
 template<typename ElementType, math::Dimension dimension0, math::Dimension dimension1, math::Dimension dimension2>
 void TestTensorArchiver()
 {
@@ -47,6 +47,33 @@ void TestVector()
     u.Generate(generator);
 }
 
+template <typename ElementType, math::VectorOrientation orientation>
+void TestStaticVector()
+{
+    math::StaticVector<ElementType, 3, orientation> v{ 1, 2, 3 };
+    math::Vector<ElementType, orientation> r0{ 1, 2, 3 };
+    testing::ProcessTest("StaticVector initializer list", v == r0);
+
+    v.Fill(2);
+    math::Vector<ElementType, orientation> r1{ 2, 2, 2 };
+    testing::ProcessTest("StaticVector::Fill", v == r1);
+
+    // static vectors work with the regular vector operations
+    math::StaticVector<ElementType, 3, orientation> u{ 1, 1, 1 };
+    math::Operations::Add(static_cast<ElementType>(2), u, v);
+    math::Vector<ElementType, orientation> r2{ 4, 4, 4 };
+    testing::ProcessTest("Operations::Add(StaticVector)", v == r2);
+
+    // copies get their own storage
+    auto w = v;
+    w.Fill(0);
+    testing::ProcessTest("StaticVector copy", v == r2 && w[0] == 0);
+
+    // copying from a runtime-sized reference of the same size
+    math::StaticVector<ElementType, 3, orientation> x(r0.GetConstReference());
+    testing::ProcessTest("StaticVector from VectorReference", x == r0);
+}
+
 template <typename ElementType, math::ImplementationType implementation>
 void TestVectorOperations()
 {
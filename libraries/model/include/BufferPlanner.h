@@ -0,0 +1,135 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     BufferPlanner.h (model)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// model
+#include "Model.h"
+#include "OutputPort.h"
+#include "Port.h"
+
+// stl
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace ell
+{
+namespace model
+{
+    /// <summary> The location assigned to an output port within a shared buffer arena. </summary>
+    struct BufferAllocation
+    {
+        size_t offset = 0;
+        size_t size = 0;
+    };
+
+    /// <summary>
+    /// A static buffer plan: the size of the shared arena required for each port type, and the
+    /// arena offset assigned to each planned port. Produced by `BufferPlanner`.
+    /// </summary>
+    class BufferPlan
+    {
+    public:
+        /// <summary> Indicates whether the plan assigns an arena location to the given port. </summary>
+        ///
+        /// <param name="port"> The port to look up. </param>
+        /// <returns> true if the port has an arena location. </returns>
+        bool HasAllocation(const OutputPortBase& port) const;
+
+        /// <summary> Gets the arena location assigned to the given port. </summary>
+        ///
+        /// <param name="port"> The port to look up. </param>
+        /// <returns> The offset and size, in elements, of the port's buffer within the arena for its type. </returns>
+        BufferAllocation GetAllocation(const OutputPortBase& port) const;
+
+        /// <summary> Gets the port types that require an arena. </summary>
+        std::vector<Port::PortType> GetArenaTypes() const;
+
+        /// <summary> Gets the required arena size, in elements, for the given port type. </summary>
+        size_t GetArenaSize(Port::PortType type) const;
+
+        /// <summary> Gets the total size of the shared arenas, in bytes. </summary>
+        size_t GetArenaMemorySize() const;
+
+        /// <summary> Gets the total size the planned buffers would occupy without reuse, in bytes. </summary>
+        size_t GetUnsharedMemorySize() const;
+
+        /// <summary> Indicates whether the plan chose to recompute the given port at each consumer
+        /// instead of keeping its output buffered across its whole lifetime. The compiler must
+        /// re-emit the port's producer before each consuming node to refill the (reused) arena
+        /// slot. </summary>
+        ///
+        /// <param name="port"> The port to look up. </param>
+        /// <returns> true if the port is recomputed at its consumers. </returns>
+        bool IsRecomputed(const OutputPortBase& port) const;
+
+        /// <summary> Gets the number of ports the plan chose to recompute. </summary>
+        size_t GetNumRecomputedPorts() const { return _recomputedPorts.size(); }
+
+    private:
+        friend class BufferPlanner;
+
+        std::unordered_map<const OutputPortBase*, BufferAllocation> _allocations;
+        std::map<Port::PortType, size_t> _arenaSizes;
+        std::unordered_set<const OutputPortBase*> _recomputedPorts;
+        size_t _unsharedMemorySize = 0;
+    };
+
+    /// <summary>
+    /// Computes static buffer plans for a model's intermediate results. Port lifetimes are derived
+    /// from the topological order the compiler visits nodes in, and ports with non-overlapping
+    /// lifetimes are assigned overlapping offsets in a shared arena, so a deep model's
+    /// intermediate buffers don't all occupy memory simultaneously.
+    /// </summary>
+    class BufferPlanner
+    {
+    public:
+        /// <summary>
+        /// Computes a buffer plan for the model's intermediate output ports. Scalar ports and
+        /// ports for which excludePort returns true (typically ports bound to function arguments)
+        /// keep their own storage and are not planned.
+        /// </summary>
+        ///
+        /// <param name="model"> The model to plan buffers for. </param>
+        /// <param name="excludePort"> A predicate indicating ports that must keep their own storage. </param>
+        /// <returns> The buffer plan. </returns>
+        static BufferPlan PlanBuffers(const Model& model, const std::function<bool(const OutputPortBase&)>& excludePort);
+
+        /// <summary>
+        /// Computes a buffer plan over an explicit node emission order, for compilers that reorder
+        /// nodes (see `NodeScheduler`). Lifetimes, and hence arena reuse, follow the given order.
+        /// </summary>
+        ///
+        /// <param name="nodeOrder"> The model's nodes, in the order the compiler will emit them. </param>
+        /// <param name="excludePort"> A predicate indicating ports that must keep their own storage. </param>
+        /// <returns> The buffer plan. </returns>
+        static BufferPlan PlanBuffers(const std::vector<const Node*>& nodeOrder, const std::function<bool(const OutputPortBase&)>& excludePort);
+
+        /// <summary>
+        /// Computes a buffer plan under a peak-memory budget. When the planned arenas exceed the
+        /// budget, ports produced by recomputable nodes (cheap, stateless nodes whose own inputs
+        /// are not arena-planned, so their operands are still available later) are chosen for
+        /// recompute: the port's arena slot is only reserved around each consuming node, and the
+        /// compiler re-emits the producer before each consumer to refill the slot, so long
+        /// branch/skip connections stop holding activations alive. Choices are greedy, largest
+        /// buffered lifetime first, until the plan fits the budget or candidates run out.
+        /// </summary>
+        ///
+        /// <param name="nodeOrder"> The model's nodes, in the order the compiler will emit them. </param>
+        /// <param name="excludePort"> A predicate indicating ports that must keep their own storage. </param>
+        /// <param name="isRecomputable"> A predicate indicating nodes cheap enough to recompute at each consumer. </param>
+        /// <param name="peakMemoryBudgetBytes"> The arena budget, in bytes; 0 == no budget. </param>
+        /// <returns> The buffer plan. </returns>
+        static BufferPlan PlanBuffers(const std::vector<const Node*>& nodeOrder, const std::function<bool(const OutputPortBase&)>& excludePort, const std::function<bool(const Node&)>& isRecomputable, size_t peakMemoryBudgetBytes);
+    };
+}
+}
@@ -44,6 +44,24 @@ namespace model
         /// <summary> Indicates if this node is able to compile itself to code. </summary>
         virtual bool IsCompilable() const { return true; }
 
+        /// <summary> Indicates if this node computes each output element from the input elements at the
+        /// same index, with no state shared between elements. Elementwise nodes are candidates for being
+        /// fused into a single loop with adjacent elementwise nodes. </summary>
+        virtual bool IsElementwise() const { return false; }
+
+        /// <summary> Emits the code that computes one output element of an elementwise node. The compiler
+        /// calls this from inside a fused loop, once per node in the chain. Nodes that return `true` from
+        /// `IsElementwise` must override this method. </summary>
+        ///
+        /// <param name="compiler"> The compiler to use when compiling the node </param>
+        /// <param name="function"> The function currently being emitted </param>
+        /// <param name="index"> The loop induction variable indexing the current element </param>
+        /// <param name="chainValue"> The current element's value as computed by the upstream node in the
+        /// fused chain, standing in for element `index` of this node's first input port, or `nullptr` if
+        /// this node heads the chain and must load its own inputs </param>
+        /// <returns> The value of element `index` of this node's output </returns>
+        virtual llvm::Value* CompileElementwise(IRMapCompiler& compiler, emitters::IRFunctionEmitter& function, llvm::Value* index, llvm::Value* chainValue);
+
     protected:
         CompilableNode(const std::vector<InputPortBase*>& inputs, const std::vector<OutputPortBase*>& outputs)
             : Node(inputs, outputs) {}
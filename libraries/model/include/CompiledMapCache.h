@@ -0,0 +1,68 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     CompiledMapCache.h (model)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "DynamicMap.h"
+#include "IRCompiledMap.h"
+#include "MapCompiler.h"
+
+// stl
+#include <string>
+
+namespace ell
+{
+namespace model
+{
+    /// <summary>
+    /// A persistent on-disk cache of compiled maps. Entries are keyed by a hash of the serialized
+    /// model together with the compiler and target device settings, and store the emitted IR, so a
+    /// repeat compile of an unchanged model skips lowering and optimization entirely and goes
+    /// straight to JIT relocation.
+    /// </summary>
+    class CompiledMapCache
+    {
+    public:
+        /// <summary> Constructs a cache rooted at the given directory, which must already exist. </summary>
+        ///
+        /// <param name="directory"> The directory in which cache entries are stored. </param>
+        CompiledMapCache(std::string directory);
+
+        /// <summary> Computes the cache key for a map compiled with the given settings. </summary>
+        ///
+        /// <param name="map"> The map. </param>
+        /// <param name="settings"> The compiler settings. </param>
+        ///
+        /// <returns> A string key that changes whenever the model or the settings change. </returns>
+        static std::string GetCacheKey(const DynamicMap& map, const MapCompilerParameters& settings);
+
+        /// <summary> Checks whether the cache holds an entry for the given key. </summary>
+        ///
+        /// <param name="key"> The cache key. </param>
+        ///
+        /// <returns> true if an entry exists. </returns>
+        bool HasEntry(const std::string& key) const;
+
+        /// <summary>
+        /// Gets a compiled map for the given map and settings, loading the emitted code from the
+        /// cache when an entry exists and compiling (and populating the cache) otherwise.
+        /// </summary>
+        ///
+        /// <param name="map"> The map to compile. </param>
+        /// <param name="settings"> The compiler settings. </param>
+        ///
+        /// <returns> The compiled map. </returns>
+        IRCompiledMap GetOrCompile(DynamicMap map, const MapCompilerParameters& settings) const;
+
+    private:
+        std::string GetEntryPath(const std::string& key) const;
+
+        std::string _directory;
+    };
+}
+}
@@ -17,8 +17,10 @@
 #include "DataVector.h"
 
 // utilities
+#include "AllocationTracker.h"
 #include "Exception.h"
 #include "IArchivable.h"
+#include "PerformanceProbes.h"
 #include "StlIndexValueIterator.h"
 #include "TypeTraits.h"
 
@@ -32,6 +34,66 @@ namespace ell
 {
 namespace model
 {
+    // forward declaration
+    class DynamicMap;
+
+    /// <summary> A pre-resolved, type-checked reference to one of a map's inputs. Obtained once from
+    /// `DynamicMap::BindInput`, then passed to `DynamicMap::SetInputValue` to set input values with no
+    /// per-call name lookup, type check, or allocation. The handle is only valid as long as the map it
+    /// was bound from, and is invalidated by `Refine` and `Transform`. </summary>
+    template <typename ValueType>
+    class BoundInput
+    {
+    public:
+        BoundInput() = default;
+
+        /// <summary> Indicates if this handle is bound to an input. </summary>
+        ///
+        /// <returns> true if the handle is bound. </returns>
+        bool IsValid() const { return _node != nullptr; }
+
+        /// <summary> Returns the size of the bound input. </summary>
+        ///
+        /// <returns> The dimensionality of the input. </returns>
+        size_t Size() const { return _node->Size(); }
+
+    private:
+        friend class DynamicMap;
+        BoundInput(InputNode<ValueType>* node)
+            : _node(node) {}
+
+        InputNode<ValueType>* _node = nullptr;
+    };
+
+    /// <summary> A pre-resolved, type-checked reference to one of a map's outputs. Obtained once from
+    /// `DynamicMap::BindOutput`, then passed to `DynamicMap::ComputeOutput` to read output values with
+    /// no per-call name lookup, type check, or port elements copy. The handle is only valid as long as
+    /// the map it was bound from, and is invalidated by `Refine` and `Transform`. </summary>
+    template <typename ValueType>
+    class BoundOutput
+    {
+    public:
+        BoundOutput() = default;
+
+        /// <summary> Indicates if this handle is bound to an output. </summary>
+        ///
+        /// <returns> true if the handle is bound. </returns>
+        bool IsValid() const { return _isValid; }
+
+        /// <summary> Returns the size of the bound output. </summary>
+        ///
+        /// <returns> The dimensionality of the output. </returns>
+        size_t Size() const { return _elements.Size(); }
+
+    private:
+        friend class DynamicMap;
+        BoundOutput(PortElementsBase elements)
+            : _elements(std::move(elements)), _isValid(true) {}
+
+        PortElementsBase _elements;
+        bool _isValid = false;
+    };
+
     /// <summary> Class that wraps a model and its designated outputs </summary>
     class DynamicMap : public utilities::IArchivable
     {
@@ -60,6 +122,26 @@ namespace model
 
         virtual ~DynamicMap() = default;
 
+        /// <summary> Creates a map that shares the given model's nodes instead of deep-copying them.
+        /// A model's node table holds its nodes by shared pointer, so each shared map owns only its
+        /// binding tables — serving one frozen model under many differently-bound maps costs bindings,
+        /// not graphs. The bindings refer to the original model's nodes directly, and the model is not
+        /// pruned. Because inputs and cached outputs live on the shared nodes, maps sharing a model
+        /// must not be computed concurrently, and the shared model must not be mutated; any
+        /// transformation (`Refine`, `Transform`, `FoldConstants`, ...) gives the map a private copy
+        /// first. Copies of a shared map share as well. </summary>
+        ///
+        /// <param name="model"> The model to share </param>
+        /// <param name="inputs"> A vector of name/value pairs for the inputs this map uses </param>
+        /// <param name="outputs"> A vector of name/value pairs for the outputs this map generates </param>
+        /// <returns> A map sharing the model's nodes. </returns>
+        static DynamicMap FromSharedModel(const Model& model, const std::vector<std::pair<std::string, InputNodeBase*>>& inputs, const std::vector<std::pair<std::string, PortElementsBase>>& outputs);
+
+        /// <summary> Indicates if this map shares its model's nodes with other maps. </summary>
+        ///
+        /// <returns> true if the model's nodes are shared. </returns>
+        bool IsModelShared() const { return _sharesModel; }
+
         /// <summary> Gets the model wrapped by this map </summary>
         ///
         /// <returns> The `Model` </returns>
@@ -94,6 +176,32 @@ namespace model
         /// <returns> The dimensionality of the map's output port </returns>
         size_t GetOutputSize() const;
 
+        /// <summary> Enables or disables incremental computation. When enabled, nodes without compute
+        /// state are only recomputed when their inputs have changed since the previous computation,
+        /// which cuts per-invocation latency when consecutive inputs share most values. Stateful nodes
+        /// (delays, moving averages, etc.) are always recomputed. </summary>
+        ///
+        /// <param name="enable"> true to enable incremental computation </param>
+        void SetIncrementalCompute(bool enable) { _incrementalCompute = enable; }
+
+        /// <summary> Indicates if incremental computation is enabled. </summary>
+        ///
+        /// <returns> true if incremental computation is enabled </returns>
+        bool IsIncrementalCompute() const { return _incrementalCompute; }
+
+        /// <summary> Enables or disables parallel computation. When enabled, Compute executes the
+        /// iteration plan as a task graph on the shared thread pool, computing independent branches
+        /// of the model concurrently. Incremental computation takes precedence when both are
+        /// enabled, since its change tracking is not thread-safe. </summary>
+        ///
+        /// <param name="enable"> true to enable parallel computation </param>
+        void SetParallelCompute(bool enable) { _parallelCompute = enable; }
+
+        /// <summary> Indicates if parallel computation is enabled. </summary>
+        ///
+        /// <returns> true if parallel computation is enabled </returns>
+        bool IsParallelCompute() const { return _parallelCompute; }
+
         /// <summary> Refines the model wrapped by this map. </summary>
         ///
         /// <param name="maxIterations"> The maximum number of refinement iterations. </param>
@@ -105,12 +213,36 @@ namespace model
         /// <param name="maxIterations"> The maximum number of refinement iterations. </param>
         void Refine(const TransformContext& context, int maxIterations = 10);
 
+        /// <summary> Eliminates common subexpressions in the model wrapped by this map, merging duplicate stateless nodes. </summary>
+        void EliminateCommonSubexpressions();
+
+        /// <summary> Folds constant subgraphs in the model wrapped by this map into precomputed constant
+        /// nodes, and prunes away nodes left unreachable from the map's outputs. </summary>
+        void FoldConstants();
+
         /// <summary> Transforms the model wrapped by this map by applying a transformation function to each node </summary>
         ///
         /// <param name="transformFunction"> The function to apply on each node </param>
         /// <param name="context"> The TransformContext to use during the transformation </param>
         void Transform(const std::function<void(const Node&, ModelTransformer&)>& transformFunction, const TransformContext& context);
 
+        /// <summary> Extracts a sub-map containing only the ancestor cone of the chosen outputs. The
+        /// returned map copies that slice of the model, keeps just the inputs that feed it, and can be
+        /// computed or compiled immediately — e.g. the embedding front half of a cascade, deployed at
+        /// a higher rate than the full model. This map is unchanged. </summary>
+        ///
+        /// <param name="outputs"> Name/elements pairs for the outputs of the sub-map, given in terms
+        /// of this map's model. </param>
+        /// <returns> The sub-map. </returns>
+        DynamicMap ExtractSubmap(const std::vector<std::pair<std::string, PortElementsBase>>& outputs) const;
+
+        /// <summary> Extracts a sub-map containing only the ancestor cone of some of this map's named
+        /// outputs. </summary>
+        ///
+        /// <param name="outputNames"> The names of the outputs to keep. </param>
+        /// <returns> The sub-map. </returns>
+        DynamicMap ExtractSubmap(const std::vector<std::string>& outputNames) const;
+
         //
         // ELL-Internal routines for getting information about inputs / outputs of the map
         // and doing type-safe operations.
@@ -228,6 +360,84 @@ namespace model
         template <typename DataVectorType, data::IsDataVector<DataVectorType> Concept = true>
         DataVectorType ComputeOutput(const std::string& outputName) const;
 
+        /// <summary> Computes one of the map's outputs from its current input values into a caller-owned
+        /// buffer. The buffer is resized to fit the output; when its capacity already suffices, no
+        /// allocation occurs, making this the allocation-free alternative to the vector-returning
+        /// overloads for tight evaluation loops. </summary>
+        ///
+        /// <param name="index"> The index of the output </param>
+        /// <param name="outputValues"> The buffer to write the output values into </param>
+        template <typename ValueType, utilities::IsFundamental<ValueType> = 0>
+        void ComputeOutput(int index, std::vector<ValueType>& outputValues) const;
+
+        /// <summary> Computes one of the map's outputs from its current input values into a caller-owned
+        /// buffer. The buffer is resized to fit the output; when its capacity already suffices, no
+        /// allocation occurs, making this the allocation-free alternative to the vector-returning
+        /// overloads for tight evaluation loops. </summary>
+        ///
+        /// <param name="outputName"> The name of the output </param>
+        /// <param name="outputValues"> The buffer to write the output values into </param>
+        template <typename ValueType, utilities::IsFundamental<ValueType> = 0>
+        void ComputeOutput(const std::string& outputName, std::vector<ValueType>& outputValues) const;
+
+        //
+        // Bound-port handles: resolve names and types once, then set inputs and read outputs with
+        // no per-call lookups or allocations
+        //
+
+        /// <summary> Resolves an input name to a handle for repeated low-latency use. </summary>
+        ///
+        /// <typeparam name="ValueType"> The datatype of the input node </typeparam>
+        /// <param name="inputName"> The name assigned to the input node </param>
+        /// <returns> A handle to pass to `SetInputValue` </returns>
+        template <typename ValueType>
+        BoundInput<ValueType> BindInput(const std::string& inputName) const;
+
+        /// <summary> Resolves an input index to a handle for repeated low-latency use. </summary>
+        ///
+        /// <typeparam name="ValueType"> The datatype of the input node </typeparam>
+        /// <param name="index"> The index of the input node </param>
+        /// <returns> A handle to pass to `SetInputValue` </returns>
+        template <typename ValueType>
+        BoundInput<ValueType> BindInput(int index) const;
+
+        /// <summary> Resolves an output name to a handle for repeated low-latency use. </summary>
+        ///
+        /// <typeparam name="ValueType"> The datatype of the output </typeparam>
+        /// <param name="outputName"> The name of the output </param>
+        /// <returns> A handle to pass to `ComputeOutput` </returns>
+        template <typename ValueType>
+        BoundOutput<ValueType> BindOutput(const std::string& outputName) const;
+
+        /// <summary> Resolves an output index to a handle for repeated low-latency use. </summary>
+        ///
+        /// <typeparam name="ValueType"> The datatype of the output </typeparam>
+        /// <param name="index"> The index of the output </param>
+        /// <returns> A handle to pass to `ComputeOutput` </returns>
+        template <typename ValueType>
+        BoundOutput<ValueType> BindOutput(int index) const;
+
+        /// <summary> Sets a bound input's values from a caller-owned buffer. The name resolution and
+        /// type check happened at bind time, so this call performs no lookups and no allocations
+        /// (after the input node's internal storage has grown to its steady-state size). </summary>
+        ///
+        /// <typeparam name="ValueType"> The datatype of the input node </typeparam>
+        /// <param name="input"> The handle returned by `BindInput` </param>
+        /// <param name="inputValues"> A pointer to the values to set on the input node </param>
+        /// <param name="numValues"> The number of values; must equal the input's size </param>
+        template <typename ValueType>
+        void SetInputValue(const BoundInput<ValueType>& input, const ValueType* inputValues, size_t numValues) const;
+
+        /// <summary> Computes a bound output into a caller-owned buffer. The name resolution and port
+        /// elements copy happened at bind time, so this call performs no lookups; the buffer is only
+        /// reallocated when its capacity doesn't suffice. </summary>
+        ///
+        /// <typeparam name="ValueType"> The datatype of the output </typeparam>
+        /// <param name="output"> The handle returned by `BindOutput` </param>
+        /// <param name="outputValues"> The buffer to write the output values into </param>
+        template <typename ValueType>
+        void ComputeOutput(const BoundOutput<ValueType>& output, std::vector<ValueType>& outputValues) const;
+
         /// <summary> Returns a `PortElements` object representing the indicated map output </summary>
         ///
         /// <param name="outputIndex"> The zero-based index of the map output </param>
@@ -274,6 +484,9 @@ namespace model
         template <typename DataVectorType, data::IsDataVector<DataVectorType> Concept = true>
         DataVectorType ComputeOutput(const PortElementsBase& elements) const;
 
+        template <typename ValueType, utilities::IsFundamental<ValueType> = 1>
+        void ComputeOutput(const PortElementsBase& elements, std::vector<ValueType>& outputValues) const;
+
         void AddInput(const std::string& inputName, InputNodeBase* inputNode);
         void AddOutput(const std::string& outputName, PortElementsBase outputElements);
         void Prune(); // prune away unused parts of internal model
@@ -293,6 +506,12 @@ namespace model
         virtual std::vector<float> ComputeFloatOutput(const PortElementsBase& outputs) const;
         virtual std::vector<double> ComputeDoubleOutput(const PortElementsBase& outputs) const;
 
+        virtual void ComputeBoolOutput(const PortElementsBase& outputs, std::vector<bool>& outputValues) const;
+        virtual void ComputeIntOutput(const PortElementsBase& outputs, std::vector<int>& outputValues) const;
+        virtual void ComputeInt64Output(const PortElementsBase& outputs, std::vector<int64_t>& outputValues) const;
+        virtual void ComputeFloatOutput(const PortElementsBase& outputs, std::vector<float>& outputValues) const;
+        virtual void ComputeDoubleOutput(const PortElementsBase& outputs, std::vector<double>& outputValues) const;
+
     private:
         Model _model;
 
@@ -304,6 +523,21 @@ namespace model
         std::vector<std::string> _outputNames;
         std::unordered_map<std::string, PortElementsBase> _outputElementsMap;
 
+        bool _incrementalCompute = false;
+        bool _parallelCompute = false;
+        bool _sharesModel = false; // see FromSharedModel; cleared when a transformation makes the model private
+
+        // Frozen iteration plan: the model's nodes in dependency order, computed once and reused by
+        // every evaluation, so the per-inference graph overhead is a linear array walk instead of a
+        // repeated traversal. Cleared (and lazily rebuilt) whenever the wrapped model changes.
+        mutable std::vector<const Node*> _dependencyOrder;
+
+        void EnsureDependencyOrder() const;
+        void InvalidateDependencyOrder() { _dependencyOrder.clear(); }
+
+        template <typename ValueType>
+        void ComputeElements(const PortElementsBase& outputs, std::vector<ValueType>& outputValues) const;
+
         std::vector<const Node*> GetOutputNodes();
         void FixTransformedIO(ModelTransformer& transformer);
     };
@@ -29,10 +29,14 @@
 #include "TypeName.h"
 
 // stl
+#include <atomic>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <ostream>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 namespace ell
@@ -111,6 +115,40 @@ namespace model
         /// <returns> true if active, false if not. </returns>
         virtual bool IsValid() const override;
 
+        /// <summary> Computes the map's output for a batch of inputs, using the compiled batch entry point. </summary>
+        ///
+        /// <typeparam name="InputType"> The input element type, which must match the map's input port type. </typeparam>
+        /// <typeparam name="OutputType"> The output element type, which must match the map's output port type. </typeparam>
+        /// <param name="inputs"> Pointer to the inputs, stored contiguously, one example of GetInputSize() elements after another. </param>
+        /// <param name="outputs"> [out] Pointer to the outputs, one example of GetOutputSize() elements after another. </param>
+        /// <param name="count"> The number of examples in the batch. </param>
+        template <typename InputType, typename OutputType>
+        void ComputeBatch(const InputType* inputs, OutputType* outputs, int count) const;
+
+        /// <summary> Computes the map's output for a batch of inputs, using the compiled batch entry point. </summary>
+        ///
+        /// <typeparam name="InputType"> The input element type, which must match the map's input port type. </typeparam>
+        /// <typeparam name="OutputType"> The output element type, which must match the map's output port type. </typeparam>
+        /// <param name="inputs"> The inputs, stored contiguously, one example of GetInputSize() elements after another. </param>
+        ///
+        /// <returns> The outputs, one example of GetOutputSize() elements after another. </returns>
+        template <typename InputType, typename OutputType>
+        std::vector<OutputType> ComputeBatch(const std::vector<InputType>& inputs) const;
+
+        /// <summary> Computes the map's output for a single input. Unlike `Compute`, this is safe to call
+        /// concurrently from multiple threads on a shared map instance: the first call from each thread
+        /// lazily jits a thread-private instance of the compiled module, so every thread runs against its
+        /// own copy of the module's mutable global state, and the input and output are passed through
+        /// function arguments instead of the shared cached buffers. The model is only compiled once. </summary>
+        ///
+        /// <typeparam name="OutputType"> The output element type, which must match the map's output port type. </typeparam>
+        /// <typeparam name="InputType"> The input element type, which must match the map's input port type. </typeparam>
+        /// <param name="inputValues"> The input values. </param>
+        ///
+        /// <returns> A vector of output values. </returns>
+        template <typename OutputType, typename InputType, utilities::IsFundamental<OutputType> OutputConcept = 0, utilities::IsFundamental<InputType> InputConcept = 0>
+        std::vector<OutputType> ComputeMultiThreaded(const std::vector<InputType>& inputValues) const;
+
         /// <summary> Gets a reference to the underlying IRModuleEmitter. </summary>
         ///
         /// <returns> Reference to an IRModuleEmitter. </returns>
@@ -173,6 +211,31 @@ namespace model
         /// <summary> Reset the performance counters for all the node types to zero. </summary>
         void ResetNodeTypeProfilingInfo();
 
+        //
+        // Weight patching support
+        //
+
+        /// <summary> Gets the version string of the map's patchable weight segment. A weight blob is
+        /// only valid for a map reporting the same version. Only available if the map was compiled
+        /// with the `patchableWeights` compiler setting. </summary>
+        ///
+        /// <returns> The weight segment version string. </returns>
+        std::string GetWeightsVersion();
+
+        /// <summary> Gets the size in bytes of a weight blob for this map. </summary>
+        ///
+        /// <returns> The blob size in bytes. </returns>
+        size_t GetWeightsSize();
+
+        /// <summary> Swaps a new weight blob into the jitted module without recompiling: each weight
+        /// array's slice of the blob is copied over the live global with a single memcpy. </summary>
+        ///
+        /// <param name="weights"> Pointer to the weight blob. </param>
+        /// <param name="size"> The blob size in bytes; must equal GetWeightsSize(). </param>
+        ///
+        /// <returns> true if the weights were patched, false if the blob size didn't match. </returns>
+        bool PatchWeights(const void* weights, size_t size);
+
     protected:
         virtual void SetNodeInput(model::InputNode<bool>* node, const std::vector<bool>& inputValues) const override;
         virtual void SetNodeInput(model::InputNode<int>* node, const std::vector<int>& inputValues) const override;
@@ -186,8 +249,15 @@ namespace model
         virtual std::vector<float> ComputeFloatOutput(const model::PortElementsBase& outputs) const override;
         virtual std::vector<double> ComputeDoubleOutput(const model::PortElementsBase& outputs) const override;
 
+        virtual void ComputeBoolOutput(const model::PortElementsBase& outputs, std::vector<bool>& outputValues) const override;
+        virtual void ComputeIntOutput(const model::PortElementsBase& outputs, std::vector<int>& outputValues) const override;
+        virtual void ComputeInt64Output(const model::PortElementsBase& outputs, std::vector<int64_t>& outputValues) const override;
+        virtual void ComputeFloatOutput(const model::PortElementsBase& outputs, std::vector<float>& outputValues) const override;
+        virtual void ComputeDoubleOutput(const model::PortElementsBase& outputs, std::vector<double>& outputValues) const override;
+
     private:
         friend class IRMapCompiler;
+        friend class CompiledMapCache;
     
         template <typename ClockType>
         friend class IRSteppableMapCompiler;
@@ -205,10 +275,24 @@ namespace model
         template <typename InputType>
         using ComputeFunction = std::function<void(const InputType*)>;
 
+        // A thread-private jitted instance of the compiled module, used by ComputeMultiThreaded. Each
+        // thread gets its own copy of the module's mutable globals, so threads never share state.
+        struct ThreadContext
+        {
+            std::unique_ptr<emitters::IRExecutionEngine> executionEngine;
+            uint64_t functionAddress = 0;
+        };
+
+        ThreadContext& GetThreadContext() const;
+
         std::string _moduleName = "ELL";
         std::unique_ptr<emitters::IRModuleEmitter> _module;
 
         mutable std::unique_ptr<emitters::IRExecutionEngine> _executionEngine;
+        mutable std::atomic<uint64_t> _batchFunctionAddress{ 0 }; // resolved lazily by ComputeBatch; atomic because gateway-style callers invoke ComputeBatch concurrently
+
+        mutable std::mutex _threadContextMutex;
+        mutable std::unordered_map<std::thread::id, std::unique_ptr<ThreadContext>> _threadContexts;
 
         // Only one of the entries in each of these tuples is active, depending on the input and output types of the map
         mutable std::tuple<ComputeFunction<bool>, ComputeFunction<int>, ComputeFunction<int64_t>, ComputeFunction<float>, ComputeFunction<double>> _computeInputFunction;
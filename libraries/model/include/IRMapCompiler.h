@@ -26,11 +26,15 @@
 
 // stl
 #include <string>
+#include <unordered_set>
+#include <vector>
 
 namespace ell
 {
 namespace model
 {
+    class CompilableNode;
+
     /// <summary> Compiles ELL Models to LLVM IR </summary>
     class IRMapCompiler : public MapCompiler
     {
@@ -60,6 +64,16 @@ namespace model
         // Routines useful to Node implementers
         //
 
+        /// <summary> Indicates whether a loop over the given number of elements should be emitted
+        /// fully unrolled. False unless the unrollLoops compiler setting is on; when it is on, the
+        /// unrollLimit setting (and, under a code-size budget, a conservative default limit) caps
+        /// the unrolled length. </summary>
+        ///
+        /// <param name="size"> The number of loop iterations. </param>
+        ///
+        /// <returns> true if the loop should be unrolled. </returns>
+        bool ShouldUnrollLoop(size_t size) const;
+
         /// <summary> Returns the ModuleEmitter associated with this map. </summary>
         ///
         /// <returns> The ModuleEmitter associated with this map. </returns>
@@ -131,6 +145,29 @@ namespace model
         /// <returns> The `IRBlockRegion` that computes `element` if that block is mergeable, `nullptr` otherwise. </returns>
         emitters::IRBlockRegion* GetMergeableNodeRegion(const PortElementBase& element);
 
+        /// <summary> Indicates if the given node heads a chain of two or more adjacent elementwise nodes
+        /// that can be fused into a single loop. </summary>
+        ///
+        /// <param name="node"> The first node of the candidate chain. </param>
+        /// <returns> `true` if the node heads a fusable elementwise chain. </returns>
+        bool CanFuseElementwiseChain(const Node& node) const;
+
+        /// <summary> Tries to compile the chain of elementwise nodes headed by the given node into a
+        /// single fused loop, instead of one loop per node. On success, the downstream chain members are
+        /// marked as compiled and their intermediate results stay in registers instead of being written
+        /// to memory. </summary>
+        ///
+        /// <param name="node"> The first node of the candidate chain. </param>
+        /// <returns> `true` if a chain of two or more nodes was found and compiled. </returns>
+        bool TryCompileElementwiseChain(const Node& node);
+
+        /// <summary> Indicates if the given node's code was already emitted as part of a fused
+        /// elementwise loop, in which case the node must not be compiled again. </summary>
+        ///
+        /// <param name="node"> The node. </param>
+        /// <returns> `true` if the node was compiled into a fused loop emitted by an upstream node. </returns>
+        bool IsNodeInFusedRegion(const Node& node) const { return _fusedNodes.find(&node) != _fusedNodes.end(); }
+
         /// <summary> Gets a reference to the underlying llvm context. </summary>
         ///
         /// <returns> Reference to the underlying llvm context. </returns>
@@ -146,6 +183,7 @@ namespace model
         virtual void OnEndCompileModel(const Model& model) override;
         virtual void OnBeginCompileNode(const Node& node) override;
         virtual void OnEndCompileNode(const Node& node) override;
+        virtual void EmitPipelineFunctions(DynamicMap& map, const std::string& functionName, emitters::NamedVariableTypeList& mainFunctionArguments) override;
         virtual void PushScope() override;
         virtual void PopScope() override;
         virtual emitters::ModuleEmitter* GetModuleEmitter() override { return &_moduleEmitter; }
@@ -163,13 +201,32 @@ namespace model
         NodeMap<emitters::IRBlockRegion*>& GetCurrentNodeBlocks();
         const Node* GetUniqueParent(const Node& node);
         bool TryMergeNodeIntoRegion(emitters::IRBlockRegion* pDestination, const Node& src);
+        std::vector<const CompilableNode*> GetElementwiseChain(const Node& node) const;
+
+        // byte layout of a queue slot that carries boundary-crossing values between pipeline stages
+        struct PipelineSlotEntry
+        {
+            const OutputPortBase* port;
+            size_t offset; // byte offset of the port's value within the slot
+            size_t size; // size of the port's value, in bytes
+        };
+
+        void EmitPipelineSyncFunction(const std::string& functionName, emitters::NamedVariableTypeList& mainFunctionArguments);
+        void EmitPipelineAsyncFunctions(DynamicMap& map, const std::string& functionName, emitters::NamedVariableTypeList& mainFunctionArguments);
+        void CopyPortValue(emitters::IRFunctionEmitter& function, const OutputPortBase& port, emitters::Variable& sourceVariable, emitters::Variable& destinationVariable);
+        llvm::Value* GetAddressableValue(emitters::IRFunctionEmitter& function, emitters::Variable& variable);
 
         void EmitGetInputSizeFunction(const DynamicMap& map);
         void EmitGetOutputSizeFunction(const DynamicMap& map);
         void EmitGetNumNodesFunction(const DynamicMap& map);
+        void EmitBatchPredictFunction(const DynamicMap& map);
+        void EmitWeightsAPIFunctions();
 
         // stack of node regions
         std::vector<NodeMap<emitters::IRBlockRegion*>> _nodeRegions;
+
+        // nodes whose code was emitted as part of a fused elementwise loop
+        std::unordered_set<const Node*> _fusedNodes;
     };
 }
 }
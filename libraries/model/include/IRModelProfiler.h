@@ -20,6 +20,7 @@
 #include "llvm/IR/Value.h"
 
 // stl
+#include <functional>
 #include <string>
 
 // External API for profiling functions
@@ -32,11 +33,14 @@ struct NodeInfo
     const char* nodeType;
 };
 
-/// <summary> A struct that holds summary information about a node's runtime performance </summary>
+/// <summary> A struct that holds summary information about a node's runtime performance. The
+/// hardware counter fields are zero on platforms where hardware counters are unavailable. </summary>
 struct PerformanceCounters
 {
     int count;
     double totalTime;
+    int64_t totalCacheMisses;
+    int64_t totalBranchMisses;
 };
 }
 
@@ -77,16 +81,13 @@ namespace model
 
         PerformanceCountersEmitter(emitters::IRModuleEmitter& module, llvm::Value* performanceCountersPtr, llvm::StructType* performanceCountersType);
         void Init(emitters::IRFunctionEmitter& function);
-        void Start(emitters::IRFunctionEmitter& function, llvm::Value* startTime);
-        void End(emitters::IRFunctionEmitter& function, llvm::Value* startTime);
+        void Start(emitters::IRFunctionEmitter& function);
+        void End(emitters::IRFunctionEmitter& function, llvm::Value* elapsedTime, llvm::Value* elapsedCacheMisses, llvm::Value* elapsedBranchMisses);
         void Reset(emitters::IRFunctionEmitter& function);
 
         emitters::IRModuleEmitter* _module = nullptr;
         llvm::Value* _performanceCountersPtr = nullptr;
         llvm::StructType* _performanceCountersType = nullptr;
-
-        // Temporary value used during processing
-        llvm::Value* _startTime = nullptr;
     };
 
     /// <summary> A utility class that holds a NodeInfoEmitter and a PerformanceCounterEmitter. </summary>
@@ -98,8 +99,8 @@ namespace model
 
     private:
         void Init(emitters::IRFunctionEmitter& function);
-        void Start(emitters::IRFunctionEmitter& function, llvm::Value* startTime);
-        void End(emitters::IRFunctionEmitter& function, llvm::Value* endTime);
+        void Start(emitters::IRFunctionEmitter& function);
+        void End(emitters::IRFunctionEmitter& function, llvm::Value* elapsedTime, llvm::Value* elapsedCacheMisses, llvm::Value* elapsedBranchMisses);
         void Reset(emitters::IRFunctionEmitter& function);
 
         friend class ModelProfiler;
@@ -123,7 +124,10 @@ namespace model
         /// <param name="module"> The `IRModuleEmitter` to compile the model profiling information into. </param>
         /// <param name="model"> The model to profile </param>
         /// <param name="enableProfiling"> Indicates whether profiling should be enabled for this model. </param>
-        ModelProfiler(emitters::IRModuleEmitter& module, Model& model, bool enableProfiling);
+        /// <param name="sampleInterval"> Instrument only every Nth invocation; unsampled invocations pay
+        /// one global counter update and a flag test per node instead of the clock and hardware counter
+        /// reads. 1 (the default) instruments every invocation, exactly as before. </param>
+        ModelProfiler(emitters::IRModuleEmitter& module, Model& model, bool enableProfiling, size_t sampleInterval = 1);
 
         /// <summary> Indicates if profiling is enabled. </summary>
         ///
@@ -179,8 +183,10 @@ namespace model
         void EmitGetNumNodeTypesFunction();
 
         void EmitGetModelPerformanceCountersFunction();
+        void EmitGetInvocationCountFunction();
         void EmitPrintModelProfilingInfoFunction();
         void EmitResetModelProfilingInfoFunction();
+        void EmitWriteProfilingMetricsFunction();
 
         void EmitGetNodeInfoFunction();
         void EmitGetNodePerformanceCountersFunction();
@@ -193,16 +199,36 @@ namespace model
         void EmitResetNodeTypeProfilingInfoFunction();
 
         llvm::Value* CallGetCurrentTime(emitters::IRFunctionEmitter& function);
+        llvm::Value* CallGetCacheMissCount(emitters::IRFunctionEmitter& function);
+        llvm::Value* CallGetBranchMissCount(emitters::IRFunctionEmitter& function);
+
+        // Reads the clock and hardware counters into the given scratch globals; with sampling,
+        // the reads are guarded by the sample-active flag
+        void EmitStartReadings(emitters::IRFunctionEmitter& function, llvm::GlobalVariable* startTimeVar, llvm::GlobalVariable* startCacheMissesVar, llvm::GlobalVariable* startBranchMissesVar, const std::function<void()>& startCounters);
+        void EmitEndReadings(emitters::IRFunctionEmitter& function, llvm::GlobalVariable* startTimeVar, llvm::GlobalVariable* startCacheMissesVar, llvm::GlobalVariable* startBranchMissesVar, const std::function<void(llvm::Value*, llvm::Value*, llvm::Value*)>& endCounters);
 
         emitters::IRModuleEmitter* _module = nullptr;
         Model* _model = nullptr;
         bool _profilingEnabled = false;
+        size_t _sampleInterval = 1;
 
         llvm::StructType* _nodeInfoType = nullptr;
         llvm::StructType* _performanceCountersType = nullptr;
 
         llvm::GlobalVariable* _modelPerformanceCountersArray = nullptr;
 
+        // Sampling state: total invocation count, whether the current invocation is instrumented,
+        // and scratch storage for the start-of-region readings (separate sets for the model and the
+        // current node, since node regions nest inside the model region)
+        llvm::GlobalVariable* _invocationCountVar = nullptr;
+        llvm::GlobalVariable* _sampleActiveVar = nullptr;
+        llvm::GlobalVariable* _modelStartTimeVar = nullptr;
+        llvm::GlobalVariable* _modelStartCacheMissesVar = nullptr;
+        llvm::GlobalVariable* _modelStartBranchMissesVar = nullptr;
+        llvm::GlobalVariable* _nodeStartTimeVar = nullptr;
+        llvm::GlobalVariable* _nodeStartCacheMissesVar = nullptr;
+        llvm::GlobalVariable* _nodeStartBranchMissesVar = nullptr;
+
         llvm::GlobalVariable* _nodeInfoArray = nullptr;
         llvm::GlobalVariable* _nodePerformanceCountersArray = nullptr;
 
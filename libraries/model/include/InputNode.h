@@ -18,6 +18,7 @@
 #include "IArchivable.h"
 #include "TypeName.h"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <vector>
@@ -83,6 +84,14 @@ namespace model
         /// <param name="inputValues"> The values for this node to output </param>
         void SetInput(std::vector<ValueType> inputValues);
 
+        /// <summary> Sets the values output by this node from a caller-owned buffer. The values are
+        /// copied into this node's internal storage, whose capacity is reused across calls, so no
+        /// allocation occurs after the first call. </summary>
+        ///
+        /// <param name="begin"> A pointer to the first value. </param>
+        /// <param name="end"> A pointer one past the last value. </param>
+        void SetInput(const ValueType* begin, const ValueType* end);
+
         /// <summary> Gets the name of this type (for serialization). </summary>
         ///
         /// <returns> The name of this type. </returns>
@@ -111,6 +120,7 @@ namespace model
     protected:
         virtual void Compute() const override;
         virtual void Compile(IRMapCompiler& compiler, emitters::IRFunctionEmitter& function) override;
+        virtual bool HasComputeState() const override { return false; }
 
     private:
         std::vector<ValueType> _inputValues;
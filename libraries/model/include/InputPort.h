@@ -137,6 +137,20 @@ namespace model
         /// <returns> The iterator. </returns>
         PortElementsBase::Iterator GetIterator() const { return _input.GetIterator(); }
 
+        /// <summary> Indicates whether this port's input is a contiguous slice of a single port's
+        /// output, in which case its values can be read in place via `GetContiguousDataPointer`
+        /// instead of copied out with `GetValue`. </summary>
+        ///
+        /// <returns> true if the input elements are contiguous. </returns>
+        bool IsContiguous() const { return _input.IsContiguous(); }
+
+        /// <summary> Returns a pointer to this port's values inside the referenced port's output
+        /// buffer, the zero-copy alternative to `GetValue` for contiguous inputs. The pointer is
+        /// only valid until the referenced port's output is recomputed. </summary>
+        ///
+        /// <returns> A pointer to `Size()` values, or nullptr if the input isn't contiguous. </returns>
+        const ValueType* GetContiguousDataPointer() const;
+
         /// <summary> Gets the name of this type (for serialization). </summary>
         ///
         /// <returns> The name of this type. </returns>
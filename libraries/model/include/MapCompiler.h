@@ -10,11 +10,13 @@
 
 // emitters
 #include "EmitterTypes.h"
+#include "FixedPoint.h"
 #include "ModuleEmitter.h"
 #include "TargetDevice.h"
 #include "Variable.h"
 
 // model
+#include "BufferPlanner.h"
 #include "DynamicMap.h"
 #include "Model.h"
 #include "Node.h"
@@ -22,9 +24,11 @@
 #include "PortElements.h"
 
 // stl
+#include <map>
 #include <stack>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace ell
 {
@@ -36,8 +40,62 @@ namespace model
         std::string mapFunctionName = "predict";
         bool inlineNodes = false;
         bool fuseLinearFunctionNodes = false;
+        bool eliminateCommonSubexpressions = false; // merge duplicate stateless nodes before compiling
+        bool foldConstants = false; // precompute constant subgraphs and prune dead nodes before compiling
         bool profile = false;
 
+        // with profile, instrument only every Nth invocation: unsampled runs skip the clock and
+        // hardware counter reads entirely, so the counters keep reporting real per-node latencies
+        // at production overhead; 1 instruments every invocation
+        size_t profileSampleInterval = 1;
+        bool planBuffers = false; // assign intermediate results to a shared arena with offset reuse
+        bool optimizeNodeOrder = false; // reorder independent nodes to shrink the live-buffer footprint
+
+        // cluster large floating-point constant vectors into a small codebook and store packed
+        // codebook indices instead of raw weights, decoded into RAM on first use; 0 disables,
+        // otherwise 4, 6, or 8 bits per index
+        size_t weightClusterBits = 0;
+        size_t weightClusterThreshold = 256; // minimum number of elements before clustering applies
+
+        // split the compiled map into pipeline stages that can run on different cores: each entry
+        // is the id of the node that ends a stage (in the model's visit order), with the rest of
+        // the model forming the final stage; empty == no pipelining
+        std::vector<std::string> pipelineStageBoundaryNodes;
+        size_t pipelineQueueLength = 4; // samples in flight between adjacent pipeline stages
+
+        // whole-module optimization effort applied after all node functions have been emitted;
+        // the aggressive level internalizes non-API symbols and inlines the per-node functions
+        // so stores to port globals can be forwarded across node boundaries
+        emitters::ModuleOptimizationLevel moduleOptimizationLevel = emitters::ModuleOptimizationLevel::none;
+
+        // calibrated Q formats for the fixed-point compilation mode, keyed by "<node id>.<port name>";
+        // ports without an entry fall back to the word's default format
+        std::map<std::string, emitters::QFormat> portQFormats;
+
+        // node types whose floating-point instructions keep strict IEEE semantics even when the
+        // useFastMath compiler setting is on; entries may be a full runtime type name or the name
+        // without template arguments (e.g. "SoftmaxLayerNode"). Softmax stays strict by default
+        // because reassociating its max-subtracted reduction reintroduces the overflow it guards
+        // against.
+        std::unordered_set<std::string> strictFloatNodeTypes = { "SoftmaxLayerNode" };
+
+        // peak intermediate-buffer budget, in bytes (0 == no budget; requires planBuffers). When
+        // the planned arenas exceed the budget, outputs of recomputable nodes are re-emitted at
+        // each consumer instead of staying buffered, trading compute for memory on deep models
+        // whose branch/skip connections hold activations alive
+        size_t peakMemoryBudget = 0;
+
+        // node types cheap enough to recompute at each consumer when over the memory budget;
+        // entries may be a full runtime type name or the name without template arguments
+        std::unordered_set<std::string> recomputableNodeTypes = { "BinaryOperationNode", "UnaryOperationNode", "ReorderDataNode" };
+
+        // emitted machine-code budget, in bytes (0 == no budget). When set, every node is lowered
+        // to a per-configuration function shared by all identically-configured nodes (inlineNodes
+        // is ignored), so N clones of a node cost one body plus N calls, and loop unrolling is
+        // capped even when unrollLoops is on (see CompilerParameters::unrollLimit). The budget
+        // itself is checked against the object code by emitters::WriteCodeSizeReport.
+        size_t codeSizeBudget = 0;
+
         emitters::CompilerParameters compilerSettings;
     };
 
@@ -58,6 +116,15 @@ namespace model
         /// <returns> The MapCompilerParameters struct used by the map compiler to control code generation. </returns>
         MapCompilerParameters GetMapCompilerParameters() const { return _parameters; }
 
+        /// <summary> Gets the calibrated Q format for an output port, for the fixed-point
+        /// compilation mode. Ports without a calibrated entry get the default format for the
+        /// configured word width. </summary>
+        ///
+        /// <param name="port"> The output port. </param>
+        ///
+        /// <returns> The port's Q format. </returns>
+        emitters::QFormat GetPortQFormat(const OutputPortBase& port) const;
+
         //
         // Routines for Node implementers
         //
@@ -95,6 +162,23 @@ namespace model
     protected:
         MapCompiler(const MapCompilerParameters& settings);
 
+        /// <summary> Describes a port whose value crosses a pipeline stage boundary. </summary>
+        struct PipelineBoundaryPort
+        {
+            const OutputPortBase* port;
+            size_t producerStage;
+            size_t consumerStage;
+            emitters::Variable* producerVariable; // where the producing stage writes the value
+            emitters::Variable* consumerVariable; // private mirror the consuming stage reads from
+        };
+
+        /// <summary> Gets the nodes assigned to each pipeline stage, in emission order. </summary>
+        const std::vector<std::vector<const Node*>>& GetPipelineStages() const { return _pipelineStages; }
+
+        /// <summary> Gets the ports whose values cross a pipeline stage boundary, with the
+        /// variables each side uses. </summary>
+        const std::vector<PipelineBoundaryPort>& GetPipelineBoundaryPorts() const { return _pipelineBoundaryPorts; }
+
         /// <summary>
         /// Create a variable to store computed output for the given output port. The variable
         /// will be emitted lazily.
@@ -114,6 +198,11 @@ namespace model
         virtual void OnEndCompileModel(const Model& model) {}
         virtual void OnBeginCompileNode(const Node& node) {}
         virtual void OnEndCompileNode(const Node& node) {}
+
+        /// <summary> Emits the glue for a pipelined map: the synchronous wrapper that runs the
+        /// stages in order, and the queue-based API that runs them on worker threads. Called after
+        /// the per-stage functions have been compiled. </summary>
+        virtual void EmitPipelineFunctions(DynamicMap& map, const std::string& functionName, emitters::NamedVariableTypeList& mainFunctionArguments);
         virtual void PushScope();
         virtual void PopScope();
         virtual emitters::ModuleEmitter* GetModuleEmitter() = 0;
@@ -128,10 +217,27 @@ namespace model
         friend class CompilableNode;
 
         void CompileNodes(Model& model);
+        void CompileNode(const Node& node);
+        void CompilePipelinedMap(DynamicMap& map, const std::string& functionName);
+        void ComputePipelineStages(Model& model);
+        size_t GetNodePipelineStage(const Node& node) const;
         emitters::Variable* AllocateNodeFunctionArgument(emitters::ModuleEmitter& emitter, const OutputPortBase* pPort, ArgType argType);
         emitters::Variable* AllocateNodeFunctionArgument(emitters::ModuleEmitter& emitter, const PortElementBase& element, ArgType argType);
+        void PlanBuffers(DynamicMap& map);
 
         MapCompilerParameters _parameters;
+        // when pipelineStageBoundaryNodes is set, the nodes assigned to each stage, the stage each
+        // node belongs to, and the ports whose values cross from one stage to the next
+        std::vector<std::vector<const Node*>> _pipelineStages;
+        std::unordered_map<const Node*, size_t> _nodeStageMap;
+        std::vector<PipelineBoundaryPort> _pipelineBoundaryPorts;
+        std::unordered_set<const OutputPortBase*> _pipelineCrossingPorts;
+        // when optimizeNodeOrder is set, the scheduled emission order for the model's nodes;
+        // empty otherwise, meaning the model's own topological order is used
+        std::vector<const Node*> _nodeOrder;
+        // liveness-based buffer plan for intermediate results, plus the shared arena variable for each port type
+        BufferPlan _bufferPlan;
+        std::map<Port::PortType, emitters::Variable*> _arenaVariables;
         // map from ports to runtime variables, for all ports in the model
         // stored as a stack, with the top of the stack being the innermost scope
         std::vector<std::unordered_map<const Port*, emitters::Variable*>> _portToVarMaps; // Do we need separate elementToVarMaps?
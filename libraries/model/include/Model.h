@@ -15,10 +15,12 @@
 // utilities
 #include "IArchivable.h"
 #include "IIterator.h"
+#include "MemoryArena.h"
 
 // stl
 #include <map>
 #include <memory>
+#include <new>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -74,6 +76,17 @@ namespace model
         template <typename NodeType, typename... Args>
         NodeType* AddNode(Args&&... args);
 
+        /// <summary> Switches the model to arena allocation: subsequent nodes (and the ports they
+        /// contain) are bump-allocated from an arena owned by the model, and their memory is
+        /// released wholesale when the last model sharing the arena is destroyed. This speeds up
+        /// construction and refinement of large models, which allocate many small nodes. </summary>
+        void EnableArenaAllocation();
+
+        /// <summary> Indicates whether this model allocates its nodes from an arena. </summary>
+        ///
+        /// <returns> true if arena allocation is enabled. </returns>
+        bool ArenaAllocationEnabled() const { return _arena != nullptr; }
+
         /// <summary> Looks up a node by id </summary>
         ///
         /// <param name="id"> The id of the node </param>
@@ -123,6 +136,109 @@ namespace model
         template <typename ValueType>
         std::vector<ValueType> ComputeOutput(const PortElementsBase& elements) const;
 
+        /// <summary> Computes part of the output of the model into a caller-owned buffer. The buffer is
+        /// resized to fit the output; when its capacity already suffices, no allocation occurs. </summary>
+        ///
+        /// <param name="elements"> The output port elements to get the computed value from </param>
+        /// <param name="output"> The buffer to write the computed output into </param>
+        template <typename ValueType>
+        void ComputeOutput(const PortElements<ValueType>& elements, std::vector<ValueType>& output) const;
+
+        /// <summary> Computes part of the output of the model into a caller-owned buffer. The buffer is
+        /// resized to fit the output; when its capacity already suffices, no allocation occurs. </summary>
+        ///
+        /// <param name="elements"> The output port elements to get the computed value from </param>
+        /// <param name="output"> The buffer to write the computed output into </param>
+        template <typename ValueType>
+        void ComputeOutput(const PortElementsBase& elements, std::vector<ValueType>& output) const;
+
+        /// <summary> Returns part of the output computed by the model, skipping nodes whose inputs are
+        /// unchanged since the previous incremental computation. Only nodes without compute state are
+        /// skipped (see `Node::HasComputeState`); stateful nodes are always recomputed. </summary>
+        ///
+        /// <param name="elements"> The output port elements to get the computed value form </param>
+        template <typename ValueType>
+        std::vector<ValueType> ComputeOutputIncremental(const PortElements<ValueType>& elements) const;
+
+        /// <summary> Returns part of the output computed by the model, skipping nodes whose inputs are
+        /// unchanged since the previous incremental computation. Only nodes without compute state are
+        /// skipped (see `Node::HasComputeState`); stateful nodes are always recomputed. </summary>
+        ///
+        /// <param name="elements"> The output port elements to get the computed value form </param>
+        template <typename ValueType>
+        std::vector<ValueType> ComputeOutputIncremental(const PortElementsBase& elements) const;
+
+        /// <summary> Incrementally computes part of the output of the model into a caller-owned buffer.
+        /// The buffer is resized to fit the output; when its capacity already suffices, no allocation
+        /// occurs. </summary>
+        ///
+        /// <param name="elements"> The output port elements to get the computed value from </param>
+        /// <param name="output"> The buffer to write the computed output into </param>
+        template <typename ValueType>
+        void ComputeOutputIncremental(const PortElements<ValueType>& elements, std::vector<ValueType>& output) const;
+
+        /// <summary> Incrementally computes part of the output of the model into a caller-owned buffer.
+        /// The buffer is resized to fit the output; when its capacity already suffices, no allocation
+        /// occurs. </summary>
+        ///
+        /// <param name="elements"> The output port elements to get the computed value from </param>
+        /// <param name="output"> The buffer to write the computed output into </param>
+        template <typename ValueType>
+        void ComputeOutputIncremental(const PortElementsBase& elements, std::vector<ValueType>& output) const;
+
+        /// <summary> Computes the output using a precomputed dependency order instead of running a
+        /// traversal: every node in the plan is computed, in plan order, and the requested elements
+        /// are then gathered from the output ports. The plan must come from `GetDependencyOrder` on
+        /// this (unmodified) model. </summary>
+        ///
+        /// <typeparam name="ValueType"> The output type. </typeparam>
+        /// <param name="elements"> The output port elements. </param>
+        /// <param name="output"> [out] The output buffer to fill, reusing its capacity when possible. </param>
+        /// <param name="dependencyOrder"> The precomputed dependency order to compute. </param>
+        template <typename ValueType>
+        void ComputeOutput(const PortElements<ValueType>& elements, std::vector<ValueType>& output, const std::vector<const Node*>& dependencyOrder) const;
+
+        /// <summary> Incremental version of the plan-based `ComputeOutput`: nodes whose inputs are
+        /// unchanged since the previous computation are skipped (see `Node::HasComputeState`). </summary>
+        ///
+        /// <typeparam name="ValueType"> The output type. </typeparam>
+        /// <param name="elements"> The output port elements. </param>
+        /// <param name="output"> [out] The output buffer to fill, reusing its capacity when possible. </param>
+        /// <param name="dependencyOrder"> The precomputed dependency order to compute. </param>
+        template <typename ValueType>
+        void ComputeOutputIncremental(const PortElements<ValueType>& elements, std::vector<ValueType>& output, const std::vector<const Node*>& dependencyOrder) const;
+
+        /// <summary> Parallel version of the plan-based `ComputeOutput`: the plan is executed as a
+        /// task graph on the shared thread pool, computing nodes whose dependencies are satisfied
+        /// concurrently. Cheap ready nodes are packed together into tasks of a minimum estimated
+        /// cost, so wide maps of small nodes don't drown in dispatch overhead. Falls back to the
+        /// sequential walk when the pool has fewer than two workers. Safe because a node's
+        /// `Compute` writes only its own output ports and reads only its parents' (already
+        /// computed) outputs. </summary>
+        ///
+        /// <typeparam name="ValueType"> The output type. </typeparam>
+        /// <param name="elements"> The output port elements. </param>
+        /// <param name="output"> [out] The output buffer to fill, reusing its capacity when possible. </param>
+        /// <param name="dependencyOrder"> The precomputed dependency order to compute. </param>
+        template <typename ValueType>
+        void ComputeOutputParallel(const PortElements<ValueType>& elements, std::vector<ValueType>& output, const std::vector<const Node*>& dependencyOrder) const;
+
+        /// <summary> Returns all of the model's nodes in dependency order, as a flat array of pointers.
+        /// The order stays valid as long as the model isn't modified; it feeds the plan-based
+        /// `ComputeOutput` overloads, turning repeated evaluations into a linear array walk. </summary>
+        ///
+        /// <returns> The nodes in dependency order. </returns>
+        std::vector<const Node*> GetDependencyOrder() const;
+
+        /// <summary> Marks a node's cached output as stale, along with every node downstream of it
+        /// (found by a reverse traversal over the per-node dependent lists). The next incremental
+        /// computation then recomputes just the invalidated slice of the model against the other
+        /// nodes' cached outputs. Call this after editing a node's parameters or inputs in place,
+        /// so single-node edits don't force a full recompute. </summary>
+        ///
+        /// <param name="node"> The edited node. </param>
+        void InvalidateNode(const Node& node) const;
+
         /// <summary>
         /// Visits all the nodes in the model in dependency order. No nodes will be visited until all
         /// its inputs have first been visited.
@@ -210,10 +326,24 @@ namespace model
     private:
         friend class NodeIterator;
 
+        // Copies the values of the given (already computed) elements from the output ports into the
+        // output buffer, reusing the buffer's existing capacity when possible
+        template <typename ValueType>
+        void GatherOutput(const PortElements<ValueType>& elements, std::vector<ValueType>& output) const;
+
+        // Executes a precomputed dependency order as a task graph on the shared thread pool,
+        // running nodes whose dependencies are satisfied concurrently
+        void ComputePlanParallel(const std::vector<const Node*>& dependencyOrder) const;
+
         // The id->node map acts both as the main container that holds the shared pointers to nodes, and as the index
         // to look nodes up by id.
         // We keep it sorted by id to make visiting all nodes deterministically ordered
         std::map<Node::NodeId, std::shared_ptr<Node>, std::less<Node::NodeId>> _idToNodeMap;
+
+        // When arena allocation is enabled, node storage comes from this arena. The arena is
+        // shared (and kept alive) by the deleters of the nodes allocated from it, so copies of
+        // the model remain valid and the memory is released wholesale with the last reference.
+        std::shared_ptr<utilities::MemoryArena> _arena;
     };
 
     /// <summary> A serialization context used during model deserialization. Wraps an existing `SerializationContext`
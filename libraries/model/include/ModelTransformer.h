@@ -107,6 +107,12 @@ namespace model
         /// <param name="newElements"> The elements in the new model to be mapped from the old model port. </param>
         void MapNodeOutput(const OutputPortBase* oldPort, const PortElementsBase& newElements);
 
+        /// <summary> Checks if an old model port has a mapping to the new model. </summary>
+        ///
+        /// <param name="oldPort"> The port in the old model to look up. </param>
+        /// <returns> true if the port has been mapped. </returns>
+        bool HasMapping(const OutputPortBase* oldPort) const;
+
         /// <summary> Merges two partial port mappings. Takes a map A->B and a map B->C and creates the map A->C. </summary>
         ///
         /// <param name="oldMap"> The port mapping from the original model to an intermediate state. </param>
@@ -170,6 +176,34 @@ namespace model
         /// <returns> The refined Model. </returns>
         Model RefineModel(Model model, const TransformContext& context, int maxIterations = 10);
 
+        /// <summary>
+        /// Returns a copy of the input model with common subexpressions eliminated: nodes that are
+        /// pure functions of their inputs (see `Node::HasComputeState`) and have the same type,
+        /// parameters, and input port elements as an earlier node are not copied, and their
+        /// consumers are rewired to the earlier node's outputs. Input and output nodes are never
+        /// merged, since they form the model's external interface.
+        /// </summary>
+        ///
+        /// <param name="model"> The model. </param>
+        /// <param name="context"> The context. </param>
+        ///
+        /// <returns> The optimized Model. </returns>
+        Model EliminateCommonSubexpressions(Model model, const TransformContext& context);
+
+        /// <summary>
+        /// Returns a copy of the input model with constant subgraphs folded: nodes whose transformed
+        /// inputs are all constant nodes (see `Node::Fold`) are replaced by constant nodes holding
+        /// their precomputed output. Nodes visit in dependency order, so a chain of foldable nodes
+        /// collapses in a single pass. Nodes that can't fold are copied unchanged; folding doesn't
+        /// remove the original constants, so follow with a prune to drop the ones left unused.
+        /// </summary>
+        ///
+        /// <param name="model"> The model. </param>
+        /// <param name="context"> The context. </param>
+        ///
+        /// <returns> The optimized Model. </returns>
+        Model FoldConstants(const Model& model, const TransformContext& context);
+
         /// <summary> Transforms the model by applying a transformation function to each node </summary>
         ///
         /// <param name="model"> The model to transform. </param>
@@ -235,6 +269,11 @@ namespace model
         template <typename NodeType, typename... Args>
         NodeType* AddNode(Args&&... args);
 
+        /// <summary> Copies a node into the transformed model by invoking its Copy method. Called by transform functions for nodes they leave unchanged. </summary>
+        ///
+        /// <param name="node"> The node to copy. </param>
+        void CopyNode(const Node& node);
+
         /// <summary> Sets up an old-to-new model output mapping. Called by node implementors </summary>
         ///
         /// <param name="oldPort"> The port in the old model to map to the new model. </param>
@@ -270,6 +309,9 @@ namespace model
         // Collect nodes that are't compilable
         std::vector<const Node*> FindUncompilableNodes(const Model& model, const TransformContext& context) const;
 
+        // Get the node in the new model that an old node was copied to, or nullptr if it wasn't copied one-to-one
+        const Node* GetCorrespondingCopiedNode(const Node& node) const;
+
         Model _model;
         TransformContext _context;
         PortOutputsMap _elementsMap;
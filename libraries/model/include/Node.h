@@ -140,6 +140,9 @@ namespace model
         /// <summary> Indicates if this node is able to compile itself to code. </summary>
         virtual bool IsCompilable() const { return false; }
 
+        /// <summary> Indicates if this node's output is a fixed constant value. </summary>
+        virtual bool IsConstant() const { return false; }
+
         /// <summary> Makes a copy of this node into the model being constructed by the transformer </summary>
         ///
         /// <param name="transformer"> The `ModelTransformer` object currently creating a new model </param>
@@ -150,16 +153,36 @@ namespace model
         /// <param name="os"> The stream to write data to. </param>
         void Print(std::ostream& os) const;
 
+        /// <summary> Indicates if this node's output changed the last time it was evaluated incrementally.
+        /// Only meaningful during incremental computation (see `Model::ComputeOutputIncremental`). </summary>
+        ///
+        /// <returns> true if the output changed during the last incremental evaluation </returns>
+        bool OutputChanged() const { return _outputChanged; }
+
     protected:
         Node(const std::vector<InputPortBase*>& inputs, const std::vector<OutputPortBase*>& outputs);
 
         /// <summary> Refines this node in the model being constructed by the transformer </summary>
         virtual bool Refine(ModelTransformer& transformer) const;
 
+        /// <summary> Replaces this node in the model being constructed by the transformer with a constant
+        /// node holding its computed output, if its transformed inputs are all constants. Returns false
+        /// (without adding anything to the new model) if the node can't be folded. </summary>
+        virtual bool Fold(ModelTransformer& transformer) const;
+
         /// <summary> Computes the output of this node and stores it in the output ports </summary>
         virtual void Compute() const = 0;
         virtual bool HasState() const;
 
+        /// <summary> Indicates if this node's `Compute` carries state between invocations. Nodes without
+        /// compute state produce the same output whenever their inputs are unchanged, so incremental
+        /// computation can skip them. The default is conservative: always recompute. </summary>
+        virtual bool HasComputeState() const;
+
+        /// <summary> Marks this node's cached output as invalid, forcing the next incremental
+        /// computation to recompute it (and its dependents) </summary>
+        void InvalidateOutput() const { _outputComputed = false; }
+
         void AddInputPort(InputPortBase* input);
         void AddOutputPort(OutputPortBase* output);
 
@@ -170,12 +193,16 @@ namespace model
         void RegisterDependencies() const;
         void InvokeCopy(ModelTransformer& transformer) const;
         bool InvokeRefine(ModelTransformer& transformer) const;
+        bool InvokeFold(ModelTransformer& transformer) const;
+        void ComputeIfInputsChanged() const;
 
         NodeId _id;
         std::vector<InputPortBase*> _inputs;
         std::vector<OutputPortBase*> _outputs;
 
         mutable std::vector<const Node*> _dependentNodes;
+        mutable bool _outputComputed = false; // true if the output ports hold a valid cached value from an incremental computation
+        mutable bool _outputChanged = true;
     };
 }
 }
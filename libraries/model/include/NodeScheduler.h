@@ -0,0 +1,41 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     NodeScheduler.h (model)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// model
+#include "Model.h"
+#include "Node.h"
+
+// stl
+#include <vector>
+
+namespace ell
+{
+namespace model
+{
+    /// <summary>
+    /// Computes a dependency-respecting emission order for a model's nodes that improves on the
+    /// default topological order for models with branches. When several nodes are ready, the
+    /// scheduler prefers a consumer of the most recently emitted node (so intermediate results are
+    /// read while still warm) and, failing that, the node that reduces the live intermediate-buffer
+    /// footprint the most. The resulting order can be fed to `BufferPlanner::PlanBuffers`, where
+    /// shorter lifetimes translate directly into a smaller shared arena.
+    /// </summary>
+    class NodeScheduler
+    {
+    public:
+        /// <summary> Computes an emission order for the model's nodes. </summary>
+        ///
+        /// <param name="model"> The model to schedule. </param>
+        /// <returns> The model's nodes, in a valid dependency order. Ties are broken by the
+        /// model's own topological order, so a model without branches is returned unchanged. </returns>
+        static std::vector<const Node*> ScheduleNodes(const Model& model);
+    };
+}
+}
@@ -93,6 +93,7 @@ namespace model
     protected:
         virtual void Compute() const override;
         virtual void Compile(IRMapCompiler& compiler, emitters::IRFunctionEmitter& function) override;
+        virtual bool HasComputeState() const override { return false; }
 
         InputPort<ValueType> _input;
         OutputPort<ValueType> _output;
@@ -313,6 +313,21 @@ namespace model
         /// <returns> A std::vector of PortRange objects </returns>
         const std::vector<PortRange>& GetRanges() const { return _ranges; }
 
+        /// <summary> Indicates if the elements form a single contiguous run of one port's output </summary>
+        ///
+        /// <returns> true if every element comes from the same port, in order, with no gaps </returns>
+        bool IsContiguous() const { return _contiguousPort != nullptr; }
+
+        /// <summary> Gets the port referenced by all the elements, when the elements are contiguous </summary>
+        ///
+        /// <returns> The referenced port, or nullptr if the elements aren't contiguous </returns>
+        const OutputPortBase* GetContiguousPort() const { return _contiguousPort; }
+
+        /// <summary> Gets the port index of the first element, when the elements are contiguous </summary>
+        ///
+        /// <returns> The start index of the elements within the referenced port </returns>
+        size_t GetContiguousStartIndex() const { return _contiguousStart; }
+
         /// <summary> Reserves space for the given number of ranges </summary>
         ///
         /// <param name="numRanges"> The number of ranges to reserve space for </param>
@@ -359,6 +374,12 @@ namespace model
     private:
         std::vector<PortRange> _ranges;
         size_t _size = 0;
+
+        // cached contiguity info, maintained by ComputeSize/AddRange: non-null when all the ranges
+        // reference a single port back-to-back, letting GetElement resolve indices in O(1) instead
+        // of walking the range list
+        const OutputPortBase* _contiguousPort = nullptr;
+        size_t _contiguousStart = 0;
     };
 
     /// <summary> Represents a statically-typed set of values from one or more output ports </summary>
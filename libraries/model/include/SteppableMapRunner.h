@@ -0,0 +1,144 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     SteppableMapRunner.h (model)
+//  Authors:  Lisa Ong
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "SteppableMap.h"
+
+// stl
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ell
+{
+namespace model
+{
+    /// <summary> How a SteppableMapRunner waits for the next interval deadline. </summary>
+    enum class RunnerWaitMode
+    {
+        /// <summary> Block in the OS until the deadline. Lowest CPU use, but wakeup jitter is at
+        /// the mercy of the scheduler (typically tens of microseconds, worse under load). </summary>
+        sleep,
+
+        /// <summary> Sleep until shortly before the deadline, then wait the rest out by polling
+        /// the clock in userspace: yielding while the deadline is still comfortably away, then
+        /// spinning. Trades a busy core for microsecond-level activation jitter. </summary>
+        spin
+    };
+
+    /// <summary> Runs a SteppableMap on a dedicated execution thread with deadline-based scheduling.
+    ///
+    /// The caller's thread never computes the model: the runner thread wakes at each interval
+    /// deadline, performs the compute, and publishes the result into a double buffer. GetResult
+    /// returns the most recently completed result and only contends with the runner thread for the
+    /// brief buffer swap, never for the compute itself. Deadlines that the compute overruns are
+    /// counted (along with the worst observed lateness) so callers can detect when the model can't
+    /// keep up with its interval. </summary>
+    template <typename OutputType, typename ClockType = std::chrono::steady_clock>
+    class SteppableMapRunner
+    {
+    public:
+        using StepTimepointType = std::chrono::time_point<ClockType>;
+
+        /// <summary> Constructor </summary>
+        ///
+        /// <param name="map"> The steppable map to run. Must outlive the runner. </param>
+        /// <param name="outputIndex"> The index of the map output to compute and buffer. </param>
+        SteppableMapRunner(SteppableMap<ClockType>& map, size_t outputIndex = 0);
+
+        SteppableMapRunner(const SteppableMapRunner&) = delete;
+        SteppableMapRunner& operator=(const SteppableMapRunner&) = delete;
+
+        ~SteppableMapRunner();
+
+        /// <summary> Starts the execution thread. Does nothing if the runner is already running. </summary>
+        void Start();
+
+        /// <summary> Stops the execution thread, waiting for an in-progress compute to finish. </summary>
+        void Stop();
+
+        /// <summary> Sets how the execution thread waits for each deadline. Must be called before
+        /// Start. </summary>
+        ///
+        /// <param name="mode"> The wait mode to use. </param>
+        void SetWaitMode(RunnerWaitMode mode) { _waitMode = mode; }
+
+        /// <summary> Sets how long before the deadline the spin wait takes over from the OS sleep
+        /// (ignored in sleep mode). Larger margins absorb more scheduler jitter at the cost of more
+        /// busy-waiting; the default of 200 microseconds covers typical wakeup latency. </summary>
+        ///
+        /// <param name="margin"> The spin margin. </param>
+        void SetSpinMargin(std::chrono::microseconds margin) { _spinMargin = margin; }
+
+        /// <summary> Gets the native handle of the execution thread, so the host can apply
+        /// platform-specific thread affinity or real-time priority. Only valid while the runner is
+        /// running. </summary>
+        ///
+        /// <returns> The execution thread's native handle. </returns>
+        std::thread::native_handle_type GetThreadNativeHandle() { return _thread.native_handle(); }
+
+        /// <summary> Indicates whether the execution thread is running. </summary>
+        ///
+        /// <returns> true if the runner has been started and not yet stopped. </returns>
+        bool IsRunning() const { return _running; }
+
+        /// <summary> Gets the result of the most recently completed step. Never blocks the compute:
+        /// the runner thread writes into the other half of a double buffer and only the buffer swap
+        /// is serialized. Returns an empty vector if no step has completed yet. </summary>
+        ///
+        /// <returns> The most recently published output values. </returns>
+        std::vector<OutputType> GetResult() const;
+
+        /// <summary> Gets the number of steps completed since Start was called. </summary>
+        ///
+        /// <returns> The number of completed steps. </returns>
+        size_t GetNumSteps() const { return _numSteps; }
+
+        /// <summary> Gets the number of interval deadlines the compute overran. After a miss the
+        /// schedule is re-anchored to the current time, so a single long compute counts once rather
+        /// than cascading. </summary>
+        ///
+        /// <returns> The number of missed deadlines. </returns>
+        size_t GetNumMissedDeadlines() const { return _numMissedDeadlines; }
+
+        /// <summary> Gets the worst observed lateness: the largest amount by which a step finished
+        /// past its deadline. </summary>
+        ///
+        /// <returns> The maximum lateness. </returns>
+        DurationType GetMaxLateness() const { return DurationType(_maxLatenessTicks); }
+
+    private:
+        void Run();
+        void WaitUntil(const StepTimepointType& deadline);
+
+        SteppableMap<ClockType>& _map;
+        size_t _outputIndex;
+        DurationType _interval;
+        RunnerWaitMode _waitMode = RunnerWaitMode::sleep;
+        std::chrono::microseconds _spinMargin{ 200 };
+
+        std::thread _thread;
+        std::atomic<bool> _running{ false };
+
+        // double buffer: the runner thread writes into the back buffer without holding the lock,
+        // then takes the lock just long enough to flip the front buffer index
+        mutable std::mutex _bufferMutex;
+        std::vector<OutputType> _buffers[2];
+        int _frontBuffer = 0;
+
+        std::atomic<size_t> _numSteps{ 0 };
+        std::atomic<size_t> _numMissedDeadlines{ 0 };
+        std::atomic<typename DurationType::rep> _maxLatenessTicks{ 0 };
+    };
+}
+}
+
+#include "../tcc/SteppableMapRunner.tcc"
@@ -0,0 +1,317 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     BufferPlanner.cpp (model)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "BufferPlanner.h"
+#include "InputPort.h"
+#include "Node.h"
+
+// stl
+#include <algorithm>
+
+namespace ell
+{
+namespace model
+{
+    namespace
+    {
+        size_t GetPortTypeSize(Port::PortType type)
+        {
+            switch (type)
+            {
+                case Port::PortType::smallReal:
+                    return 4;
+                case Port::PortType::real:
+                    return 8;
+                case Port::PortType::integer:
+                    return 4;
+                case Port::PortType::bigInt:
+                    return 8;
+                case Port::PortType::categorical:
+                    return 4;
+                case Port::PortType::boolean:
+                    return 1;
+                default:
+                    return 0;
+            }
+        }
+    }
+
+    //
+    // BufferPlan
+    //
+    bool BufferPlan::HasAllocation(const OutputPortBase& port) const
+    {
+        return _allocations.find(&port) != _allocations.end();
+    }
+
+    BufferAllocation BufferPlan::GetAllocation(const OutputPortBase& port) const
+    {
+        auto search = _allocations.find(&port);
+        if (search == _allocations.end())
+        {
+            return BufferAllocation{};
+        }
+        return search->second;
+    }
+
+    std::vector<Port::PortType> BufferPlan::GetArenaTypes() const
+    {
+        std::vector<Port::PortType> types;
+        for (const auto& arena : _arenaSizes)
+        {
+            types.push_back(arena.first);
+        }
+        return types;
+    }
+
+    size_t BufferPlan::GetArenaSize(Port::PortType type) const
+    {
+        auto search = _arenaSizes.find(type);
+        if (search == _arenaSizes.end())
+        {
+            return 0;
+        }
+        return search->second;
+    }
+
+    size_t BufferPlan::GetArenaMemorySize() const
+    {
+        size_t memorySize = 0;
+        for (const auto& arena : _arenaSizes)
+        {
+            memorySize += arena.second * GetPortTypeSize(arena.first);
+        }
+        return memorySize;
+    }
+
+    size_t BufferPlan::GetUnsharedMemorySize() const
+    {
+        return _unsharedMemorySize;
+    }
+
+    bool BufferPlan::IsRecomputed(const OutputPortBase& port) const
+    {
+        return _recomputedPorts.find(&port) != _recomputedPorts.end();
+    }
+
+    //
+    // BufferPlanner
+    //
+    BufferPlan BufferPlanner::PlanBuffers(const Model& model, const std::function<bool(const OutputPortBase&)>& excludePort)
+    {
+        std::vector<const Node*> nodeOrder;
+        model.Visit([&](const Node& node) { nodeOrder.push_back(&node); });
+        return PlanBuffers(nodeOrder, excludePort);
+    }
+
+    BufferPlan BufferPlanner::PlanBuffers(const std::vector<const Node*>& nodeOrder, const std::function<bool(const OutputPortBase&)>& excludePort)
+    {
+        return PlanBuffers(nodeOrder, excludePort, [](const Node&) { return false; }, 0);
+    }
+
+    BufferPlan BufferPlanner::PlanBuffers(const std::vector<const Node*>& nodeOrder, const std::function<bool(const OutputPortBase&)>& excludePort, const std::function<bool(const Node&)>& isRecomputable, size_t peakMemoryBudgetBytes)
+    {
+        struct PortLifetime
+        {
+            const OutputPortBase* port;
+            size_t start;
+            size_t end;
+            std::vector<size_t> consumers; // indices of the nodes that read the port, in order
+        };
+
+        // A contiguous span of node indices during which a port's buffer must hold its value.
+        // Buffered ports have one segment covering their whole lifetime; recomputed ports have one
+        // segment per emission (birth, plus each consumer the producer is re-emitted before).
+        struct Segment
+        {
+            size_t start;
+            size_t end;
+        };
+
+        // Compute port lifetimes over the order the compiler visits nodes in: a port is born when
+        // its node is visited and dies after the last node that reads it. A node's inputs stay
+        // live while its outputs are written, so a node never shares a buffer with its own inputs.
+        std::vector<PortLifetime> lifetimes;
+        std::unordered_map<const OutputPortBase*, size_t> lifetimeIndex;
+        for (size_t nodeIndex = 0; nodeIndex < nodeOrder.size(); ++nodeIndex)
+        {
+            const auto& node = *nodeOrder[nodeIndex];
+            for (auto inputPort : node.GetInputPorts())
+            {
+                for (const auto& range : inputPort->GetInputElements().GetRanges())
+                {
+                    auto search = lifetimeIndex.find(range.ReferencedPort());
+                    if (search != lifetimeIndex.end())
+                    {
+                        auto& lifetime = lifetimes[search->second];
+                        lifetime.end = nodeIndex;
+                        if (lifetime.consumers.empty() || lifetime.consumers.back() != nodeIndex)
+                        {
+                            lifetime.consumers.push_back(nodeIndex);
+                        }
+                    }
+                }
+            }
+
+            for (auto outputPort : node.GetOutputPorts())
+            {
+                if (outputPort->Size() > 1 && !excludePort(*outputPort))
+                {
+                    lifetimeIndex[outputPort] = lifetimes.size();
+                    lifetimes.push_back({ outputPort, nodeIndex, nodeIndex, {} });
+                }
+            }
+        }
+
+        // First-fit placement with reuse: walk the ports in birth order and place each one at the
+        // lowest arena offset not occupied by a port whose segments overlap any of its own.
+        struct PlacedBuffer
+        {
+            size_t offset;
+            size_t size;
+            std::vector<Segment> segments;
+        };
+
+        auto getSegments = [](const PortLifetime& lifetime, bool recomputed) {
+            std::vector<Segment> segments;
+            if (recomputed)
+            {
+                segments.push_back({ lifetime.start, lifetime.start });
+                for (auto consumer : lifetime.consumers)
+                {
+                    segments.push_back({ consumer, consumer });
+                }
+            }
+            else
+            {
+                segments.push_back({ lifetime.start, lifetime.end });
+            }
+            return segments;
+        };
+
+        auto overlaps = [](const std::vector<Segment>& a, const std::vector<Segment>& b) {
+            for (const auto& s1 : a)
+            {
+                for (const auto& s2 : b)
+                {
+                    if (s1.start <= s2.end && s2.start <= s1.end)
+                    {
+                        return true;
+                    }
+                }
+            }
+            return false;
+        };
+
+        auto placeBuffers = [&](const std::unordered_set<const OutputPortBase*>& recomputedPorts) {
+            BufferPlan plan;
+            plan._recomputedPorts = recomputedPorts;
+            std::map<Port::PortType, std::vector<PlacedBuffer>> placedBuffers;
+            for (const auto& lifetime : lifetimes)
+            {
+                auto type = lifetime.port->GetType();
+                auto& placed = placedBuffers[type];
+                auto segments = getSegments(lifetime, recomputedPorts.find(lifetime.port) != recomputedPorts.end());
+
+                std::vector<PlacedBuffer> conflicting;
+                for (const auto& buffer : placed)
+                {
+                    if (overlaps(buffer.segments, segments))
+                    {
+                        conflicting.push_back(buffer);
+                    }
+                }
+                std::sort(conflicting.begin(), conflicting.end(), [](const PlacedBuffer& a, const PlacedBuffer& b) { return a.offset < b.offset; });
+
+                size_t size = lifetime.port->Size();
+                size_t offset = 0;
+                for (const auto& buffer : conflicting)
+                {
+                    if (offset + size <= buffer.offset)
+                    {
+                        break; // found a large-enough gap
+                    }
+                    offset = std::max(offset, buffer.offset + buffer.size);
+                }
+
+                placed.push_back({ offset, size, segments });
+                plan._allocations[lifetime.port] = { offset, size };
+                plan._arenaSizes[type] = std::max(plan._arenaSizes[type], offset + size);
+                plan._unsharedMemorySize += size * GetPortTypeSize(type);
+            }
+            return plan;
+        };
+
+        auto plan = placeBuffers({});
+        if (peakMemoryBudgetBytes == 0 || plan.GetArenaMemorySize() <= peakMemoryBudgetBytes)
+        {
+            return plan;
+        }
+
+        // Over budget: find the ports that can safely be recomputed at their consumers. The
+        // producer must be cheap, its inputs must be unplanned (scalar, excluded, or constant
+        // storage, so its operands are still valid when it's re-emitted), and this must be its
+        // only planned output (re-emitting rewrites all of the node's outputs).
+        std::vector<size_t> candidates;
+        for (size_t i = 0; i < lifetimes.size(); ++i)
+        {
+            const auto& lifetime = lifetimes[i];
+            const auto& producer = *lifetime.port->GetNode();
+            if (!isRecomputable(producer) || lifetime.end <= lifetime.start + 1)
+            {
+                continue;
+            }
+
+            bool safe = true;
+            for (auto inputPort : producer.GetInputPorts())
+            {
+                for (const auto& range : inputPort->GetInputElements().GetRanges())
+                {
+                    if (lifetimeIndex.find(range.ReferencedPort()) != lifetimeIndex.end())
+                    {
+                        safe = false;
+                    }
+                }
+            }
+            for (auto outputPort : producer.GetOutputPorts())
+            {
+                if (outputPort != lifetime.port && lifetimeIndex.find(outputPort) != lifetimeIndex.end())
+                {
+                    safe = false;
+                }
+            }
+
+            if (safe)
+            {
+                candidates.push_back(i);
+            }
+        }
+
+        // Greedily recompute the candidates with the largest buffered footprint (bytes held x
+        // lifetime span) until the plan fits the budget or the candidates run out.
+        std::sort(candidates.begin(), candidates.end(), [&](size_t a, size_t b) {
+            auto footprint = [&](const PortLifetime& lifetime) {
+                return (lifetime.end - lifetime.start) * lifetime.port->Size() * GetPortTypeSize(lifetime.port->GetType());
+            };
+            return footprint(lifetimes[a]) > footprint(lifetimes[b]);
+        });
+
+        std::unordered_set<const OutputPortBase*> recomputedPorts;
+        for (auto candidate : candidates)
+        {
+            recomputedPorts.insert(lifetimes[candidate].port);
+            plan = placeBuffers(recomputedPorts);
+            if (plan.GetArenaMemorySize() <= peakMemoryBudgetBytes)
+            {
+                break;
+            }
+        }
+        return plan;
+    }
+}
+}
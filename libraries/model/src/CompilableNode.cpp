@@ -38,10 +38,23 @@ namespace model
         emitters::IRModuleEmitter& moduleEmitter = irCompiler->GetModule();
         auto& enclosingFunction = moduleEmitter.GetCurrentFunction();
 
-        if (ShouldCompileInline() || compiler.GetMapCompilerParameters().inlineNodes)
+        if (irCompiler->IsNodeInFusedRegion(*this))
+        {
+            // this node's code was already emitted as part of a fused elementwise loop
+            return;
+        }
+
+        // under a code-size budget, per-node inlining is off: every node calls a function shared by
+        // all identically-configured nodes, so N clones cost one lowered body plus N call sites
+        auto mapParameters = compiler.GetMapCompilerParameters();
+        bool inlineNodes = mapParameters.inlineNodes && mapParameters.codeSizeBudget == 0;
+        if (ShouldCompileInline() || inlineNodes || irCompiler->CanFuseElementwiseChain(*this))
         {
             irCompiler->NewNodeRegion(*this);
-            Compile(*irCompiler, enclosingFunction);
+            if (!irCompiler->TryCompileElementwiseChain(*this))
+            {
+                Compile(*irCompiler, enclosingFunction);
+            }
             irCompiler->TryMergeNodeRegion(*this);
         }
         else
@@ -83,7 +96,12 @@ namespace model
     {
         throw utilities::LogicException(utilities::LogicExceptionErrors::notImplemented);
     }
-    
+
+    llvm::Value* CompilableNode::CompileElementwise(IRMapCompiler& compiler, emitters::IRFunctionEmitter& function, llvm::Value* index, llvm::Value* chainValue)
+    {
+        throw utilities::LogicException(utilities::LogicExceptionErrors::notImplemented);
+    }
+
     bool CompilableNode::ShouldCompileInline() const
     {
         // Make sure all inputs have only pure ports
@@ -0,0 +1,112 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     CompiledMapCache.cpp (model)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "CompiledMapCache.h"
+#include "IRMapCompiler.h"
+
+// utilities
+#include "Files.h"
+#include "JsonArchiver.h"
+
+// stl
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <iomanip>
+#include <sstream>
+
+namespace ell
+{
+namespace model
+{
+    namespace
+    {
+        // 64-bit FNV-1a: fast, stable across platforms, and collision-resistant enough for keying
+        // a cache that is verified by recompilation when in doubt
+        uint64_t HashString(const std::string& text)
+        {
+            uint64_t hash = 14695981039346656037ull;
+            for (char c : text)
+            {
+                hash ^= static_cast<unsigned char>(c);
+                hash *= 1099511628211ull;
+            }
+            return hash;
+        }
+    }
+
+    CompiledMapCache::CompiledMapCache(std::string directory)
+        : _directory(std::move(directory))
+    {
+    }
+
+    std::string CompiledMapCache::GetCacheKey(const DynamicMap& map, const MapCompilerParameters& settings)
+    {
+        std::stringstream buffer;
+        utilities::JsonArchiver archiver(buffer);
+        archiver.Archive(map);
+
+        // append everything that affects the emitted code, so a settings change invalidates the entry
+        const auto& compilerSettings = settings.compilerSettings;
+        const auto& device = compilerSettings.targetDevice;
+        buffer << "\n" << settings.moduleName << "\n" << settings.mapFunctionName << "\n"
+               << settings.inlineNodes << settings.fuseLinearFunctionNodes << settings.eliminateCommonSubexpressions << settings.foldConstants << settings.profile
+               << compilerSettings.unrollLoops << compilerSettings.unrollLimit << settings.codeSizeBudget << compilerSettings.inlineOperators << compilerSettings.useBlas
+               << compilerSettings.useHalide << compilerSettings.useFastMath << compilerSettings.optimize << compilerSettings.includeDiagnosticInfo
+               << "\n" << compilerSettings.tuningDatabaseFilename
+               << "\n" << settings.pipelineQueueLength;
+        for (const auto& boundaryNode : settings.pipelineStageBoundaryNodes)
+        {
+            buffer << "\n" << boundaryNode;
+        }
+        buffer << "\n" << device.deviceName << "\n" << device.triple << "\n" << device.architecture << "\n"
+               << device.dataLayout << "\n" << device.cpu << "\n" << device.features << "\n" << device.numBits;
+
+        std::stringstream key;
+        key << std::hex << std::setfill('0') << std::setw(16) << HashString(buffer.str());
+        return key.str();
+    }
+
+    bool CompiledMapCache::HasEntry(const std::string& key) const
+    {
+        return utilities::IsFileReadable(GetEntryPath(key));
+    }
+
+    IRCompiledMap CompiledMapCache::GetOrCompile(DynamicMap map, const MapCompilerParameters& settings) const
+    {
+        auto key = GetCacheKey(map, settings);
+        auto entryPath = GetEntryPath(key);
+
+        if (utilities::IsFileReadable(entryPath))
+        {
+            // cache hit: parse the cached IR instead of lowering and optimizing the model
+            auto stream = utilities::OpenIfstream(entryPath);
+            std::stringstream text;
+            text << stream.rdbuf();
+
+            auto module = std::make_unique<emitters::IRModuleEmitter>(settings.moduleName);
+            module->SetCompilerParameters(settings.compilerSettings);
+            module->LoadIR(text.str());
+            module->SetTargetTriple(settings.compilerSettings.targetDevice.triple);
+            module->SetTargetDataLayout(settings.compilerSettings.targetDevice.dataLayout);
+            return IRCompiledMap(std::move(map), settings.mapFunctionName, std::move(module));
+        }
+
+        // cache miss: compile as usual and store the emitted IR for the next load
+        IRMapCompiler compiler(settings);
+        auto compiledMap = compiler.Compile(std::move(map));
+        compiledMap.WriteCode(entryPath, emitters::ModuleOutputFormat::ir);
+        return compiledMap;
+    }
+
+    std::string CompiledMapCache::GetEntryPath(const std::string& key) const
+    {
+        return _directory + "/" + key + ".ll";
+    }
+}
+}
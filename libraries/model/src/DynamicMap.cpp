@@ -40,10 +40,47 @@ namespace model
         // Important: we don't need to call FixTransformedIO here because we do it in the call to Prune
         // FixTransformedIO(transformer);
         Prune();
+        EnsureDependencyOrder();
+    }
+
+    DynamicMap DynamicMap::FromSharedModel(const Model& model, const std::vector<std::pair<std::string, InputNodeBase*>>& inputs, const std::vector<std::pair<std::string, PortElementsBase>>& outputs)
+    {
+        DynamicMap map;
+        map._model = model; // the model's node table holds shared pointers, so this shares the nodes
+        map._sharesModel = true;
+
+        // the bindings refer to the shared nodes directly, so no transformer remapping is needed;
+        // pruning is skipped because it would copy the model (and other maps may bind the pruned parts)
+        for (const auto& input : inputs)
+        {
+            map.AddInput(input.first, input.second);
+        }
+        for (const auto& output : outputs)
+        {
+            map.AddOutput(output.first, output.second);
+        }
+        map.EnsureDependencyOrder();
+        return map;
     }
 
     DynamicMap::DynamicMap(const DynamicMap& other)
+        : _incrementalCompute(other._incrementalCompute), _parallelCompute(other._parallelCompute)
     {
+        if (other._sharesModel)
+        {
+            // shared maps stay shared: the nodes aren't duplicated, so the binding tables carry over unchanged
+            _model = other._model;
+            _sharesModel = true;
+            _inputNodes = other._inputNodes;
+            _inputNames = other._inputNames;
+            _inputNodeMap = other._inputNodeMap;
+            _outputElements = other._outputElements;
+            _outputNames = other._outputNames;
+            _outputElementsMap = other._outputElementsMap;
+            _dependencyOrder = other._dependencyOrder;
+            return;
+        }
+
         TransformContext context;
         ModelTransformer transformer;
         _model = transformer.CopyModel(other._model, context);
@@ -93,27 +130,62 @@ namespace model
 
     std::vector<bool> DynamicMap::ComputeBoolOutput(const PortElementsBase& outputs) const
     {
-        return _model.ComputeOutput<bool>(outputs);
+        std::vector<bool> result;
+        ComputeElements(outputs, result);
+        return result;
     }
 
     std::vector<int> DynamicMap::ComputeIntOutput(const PortElementsBase& outputs) const
     {
-        return _model.ComputeOutput<int>(outputs);
+        std::vector<int> result;
+        ComputeElements(outputs, result);
+        return result;
     }
 
     std::vector<int64_t> DynamicMap::ComputeInt64Output(const PortElementsBase& outputs) const
     {
-        return _model.ComputeOutput<int64_t>(outputs);
+        std::vector<int64_t> result;
+        ComputeElements(outputs, result);
+        return result;
     }
 
     std::vector<float> DynamicMap::ComputeFloatOutput(const PortElementsBase& outputs) const
     {
-        return _model.ComputeOutput<float>(outputs);
+        std::vector<float> result;
+        ComputeElements(outputs, result);
+        return result;
     }
 
     std::vector<double> DynamicMap::ComputeDoubleOutput(const PortElementsBase& outputs) const
     {
-        return _model.ComputeOutput<double>(outputs);
+        std::vector<double> result;
+        ComputeElements(outputs, result);
+        return result;
+    }
+
+    void DynamicMap::ComputeBoolOutput(const PortElementsBase& outputs, std::vector<bool>& outputValues) const
+    {
+        ComputeElements(outputs, outputValues);
+    }
+
+    void DynamicMap::ComputeIntOutput(const PortElementsBase& outputs, std::vector<int>& outputValues) const
+    {
+        ComputeElements(outputs, outputValues);
+    }
+
+    void DynamicMap::ComputeInt64Output(const PortElementsBase& outputs, std::vector<int64_t>& outputValues) const
+    {
+        ComputeElements(outputs, outputValues);
+    }
+
+    void DynamicMap::ComputeFloatOutput(const PortElementsBase& outputs, std::vector<float>& outputValues) const
+    {
+        ComputeElements(outputs, outputValues);
+    }
+
+    void DynamicMap::ComputeDoubleOutput(const PortElementsBase& outputs, std::vector<double>& outputValues) const
+    {
+        ComputeElements(outputs, outputValues);
     }
 
     template <>
@@ -146,6 +218,36 @@ namespace model
         return ComputeDoubleOutput(elements);
     }
 
+    template <>
+    void DynamicMap::ComputeOutput<bool>(const PortElementsBase& elements, std::vector<bool>& outputValues) const
+    {
+        ComputeBoolOutput(elements, outputValues);
+    }
+
+    template <>
+    void DynamicMap::ComputeOutput<int>(const PortElementsBase& elements, std::vector<int>& outputValues) const
+    {
+        ComputeIntOutput(elements, outputValues);
+    }
+
+    template <>
+    void DynamicMap::ComputeOutput<int64_t>(const PortElementsBase& elements, std::vector<int64_t>& outputValues) const
+    {
+        ComputeInt64Output(elements, outputValues);
+    }
+
+    template <>
+    void DynamicMap::ComputeOutput<float>(const PortElementsBase& elements, std::vector<float>& outputValues) const
+    {
+        ComputeFloatOutput(elements, outputValues);
+    }
+
+    template <>
+    void DynamicMap::ComputeOutput<double>(const PortElementsBase& elements, std::vector<double>& outputValues) const
+    {
+        ComputeDoubleOutput(elements, outputValues);
+    }
+
     void DynamicMap::AddInput(const std::string& inputName, InputNodeBase* inputNode)
     {
         _inputNodes.push_back(inputNode);
@@ -177,6 +279,10 @@ namespace model
         swap(a._outputElements, b._outputElements);
         swap(a._outputNames, b._outputNames);
         swap(a._outputElementsMap, b._outputElementsMap);
+        swap(a._incrementalCompute, b._incrementalCompute);
+        swap(a._parallelCompute, b._parallelCompute);
+        swap(a._sharesModel, b._sharesModel);
+        swap(a._dependencyOrder, b._dependencyOrder);
     }
 
     std::vector<const Node*> DynamicMap::GetOutputNodes()
@@ -232,6 +338,8 @@ namespace model
         auto minimalModel = transformer.CopyModel(_model, outputNodeVec, context);
         FixTransformedIO(transformer);
         _model = std::move(minimalModel);
+        _sharesModel = false; // the copied model is private to this map
+        InvalidateDependencyOrder();
     }
 
     size_t DynamicMap::GetInputSize() const
@@ -265,12 +373,87 @@ namespace model
         Prune();
     }
 
+    void DynamicMap::EliminateCommonSubexpressions()
+    {
+        TransformContext context;
+        ModelTransformer transformer;
+        auto optimizedModel = transformer.EliminateCommonSubexpressions(_model, context);
+        FixTransformedIO(transformer);
+
+        _model = std::move(optimizedModel);
+        Prune();
+    }
+
+    void DynamicMap::FoldConstants()
+    {
+        TransformContext context;
+        ModelTransformer transformer;
+        auto optimizedModel = transformer.FoldConstants(_model, context);
+        FixTransformedIO(transformer);
+
+        _model = std::move(optimizedModel);
+        Prune();
+    }
+
     void DynamicMap::Transform(const std::function<void(const Node&, ModelTransformer&)>& transformFunction, const TransformContext& context)
     {
         ModelTransformer transformer;
         auto refinedModel = transformer.TransformModel(_model, transformFunction, context);
         FixTransformedIO(transformer);
         _model = std::move(refinedModel);
+        _sharesModel = false; // the transformed model is private to this map
+        InvalidateDependencyOrder();
+    }
+
+    DynamicMap DynamicMap::ExtractSubmap(const std::vector<std::pair<std::string, PortElementsBase>>& outputs) const
+    {
+        // gather the ancestor cone of the requested outputs
+        std::unordered_set<const Node*> ancestorCone;
+        std::vector<const Node*> stack;
+        for (const auto& output : outputs)
+        {
+            for (const auto& range : output.second.GetRanges())
+            {
+                stack.push_back(range.ReferencedPort()->GetNode());
+            }
+        }
+        while (!stack.empty())
+        {
+            const Node* node = stack.back();
+            stack.pop_back();
+            if (!ancestorCone.insert(node).second)
+            {
+                continue; // already visited
+            }
+            for (const auto& parent : node->GetParentNodes())
+            {
+                stack.push_back(parent);
+            }
+        }
+
+        // keep only the inputs that feed the cone; the map constructor copies the model and
+        // prunes the copy down to exactly the requested outputs' slice
+        std::vector<std::pair<std::string, InputNodeBase*>> inputs;
+        for (size_t index = 0; index < _inputNodes.size(); ++index)
+        {
+            if (ancestorCone.find(_inputNodes[index]) != ancestorCone.end())
+            {
+                inputs.emplace_back(_inputNames[index], _inputNodes[index]);
+            }
+        }
+
+        return DynamicMap(_model, inputs, outputs);
+    }
+
+    DynamicMap DynamicMap::ExtractSubmap(const std::vector<std::string>& outputNames) const
+    {
+        std::vector<std::pair<std::string, PortElementsBase>> outputs;
+        outputs.reserve(outputNames.size());
+        for (const auto& outputName : outputNames)
+        {
+            outputs.emplace_back(outputName, GetOutput(outputName));
+        }
+        return ExtractSubmap(outputs);
     }
 
     void DynamicMap::WriteToArchive(utilities::Archiver& archiver) const
@@ -326,9 +509,18 @@ namespace model
             _outputElementsMap[_outputNames[index]] = _outputElements[index];
         }
 
+        InvalidateDependencyOrder();
         archiver.PopContext();
     }
 
+    void DynamicMap::EnsureDependencyOrder() const
+    {
+        if (_dependencyOrder.empty())
+        {
+            _dependencyOrder = _model.GetDependencyOrder();
+        }
+    }
+
     InputNodeBase* DynamicMap::GetInput(size_t index) const
     {
         if (index >= _inputNodes.size())
@@ -62,11 +62,27 @@ namespace model
         if (!_executionEngine)
         {
             auto moduleClone = std::unique_ptr<llvm::Module>(llvm::CloneModule(_module->GetLLVMModule()));
-            _executionEngine = std::make_unique<emitters::IRExecutionEngine>(std::move(moduleClone));
+            auto useSharedEngine = _module->GetCompilerParameters().useSharedExecutionEngine;
+            _executionEngine = std::make_unique<emitters::IRExecutionEngine>(std::move(moduleClone), useSharedEngine);
             SetComputeFunction();
         }
     }
 
+    IRCompiledMap::ThreadContext& IRCompiledMap::GetThreadContext() const
+    {
+        std::lock_guard<std::mutex> lock(_threadContextMutex);
+        auto& context = _threadContexts[std::this_thread::get_id()];
+        if (context == nullptr)
+        {
+            context = std::make_unique<ThreadContext>();
+            auto moduleClone = std::unique_ptr<llvm::Module>(llvm::CloneModule(_module->GetLLVMModule()));
+            auto useSharedEngine = _module->GetCompilerParameters().useSharedExecutionEngine;
+            context->executionEngine = std::make_unique<emitters::IRExecutionEngine>(std::move(moduleClone), useSharedEngine);
+            context->functionAddress = context->executionEngine->ResolveFunctionAddress(_functionName);
+        }
+        return *context;
+    }
+
     void IRCompiledMap::SetComputeFunction() const
     {
         switch (GetInput(0)->GetOutputPort().GetType())
@@ -212,6 +228,66 @@ namespace model
         return std::get<utilities::ConformingVector<double>>(_cachedOutput);
     }
 
+    void IRCompiledMap::ComputeBoolOutput(const model::PortElementsBase& outputs, std::vector<bool>& outputValues) const
+    {
+        EnsureExecutionEngine();
+        if (GetOutput(0).GetPortType() != model::Port::PortType::boolean)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::typeMismatch);
+        }
+
+        const auto& cachedOutput = std::get<utilities::ConformingVector<bool>>(_cachedOutput);
+        outputValues.assign((bool*)(cachedOutput.data()), (bool*)(cachedOutput.data() + cachedOutput.size()));
+    }
+
+    void IRCompiledMap::ComputeIntOutput(const model::PortElementsBase& outputs, std::vector<int>& outputValues) const
+    {
+        EnsureExecutionEngine();
+        if (GetOutput(0).GetPortType() != model::Port::PortType::integer)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::typeMismatch);
+        }
+
+        const auto& cachedOutput = std::get<utilities::ConformingVector<int>>(_cachedOutput);
+        outputValues.assign(cachedOutput.begin(), cachedOutput.end());
+    }
+
+    void IRCompiledMap::ComputeInt64Output(const model::PortElementsBase& outputs, std::vector<int64_t>& outputValues) const
+    {
+        EnsureExecutionEngine();
+        if (GetOutput(0).GetPortType() != model::Port::PortType::bigInt)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::typeMismatch);
+        }
+
+        const auto& cachedOutput = std::get<utilities::ConformingVector<int64_t>>(_cachedOutput);
+        outputValues.assign(cachedOutput.begin(), cachedOutput.end());
+    }
+
+    void IRCompiledMap::ComputeFloatOutput(const model::PortElementsBase& outputs, std::vector<float>& outputValues) const
+    {
+        EnsureExecutionEngine();
+        if (GetOutput(0).GetPortType() != model::Port::PortType::smallReal)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::typeMismatch);
+        }
+
+        const auto& cachedOutput = std::get<utilities::ConformingVector<float>>(_cachedOutput);
+        outputValues.assign(cachedOutput.begin(), cachedOutput.end());
+    }
+
+    void IRCompiledMap::ComputeDoubleOutput(const model::PortElementsBase& outputs, std::vector<double>& outputValues) const
+    {
+        EnsureExecutionEngine();
+        if (GetOutput(0).GetPortType() != model::Port::PortType::real)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::typeMismatch);
+        }
+
+        const auto& cachedOutput = std::get<utilities::ConformingVector<double>>(_cachedOutput);
+        outputValues.assign(cachedOutput.begin(), cachedOutput.end());
+    }
+
     void IRCompiledMap::WriteCode(const std::string& filePath) const
     {
         _module->WriteToFile(filePath);
@@ -297,6 +373,44 @@ namespace model
         }
     }
 
+    //
+    // Weight patching support
+    //
+
+    std::string IRCompiledMap::GetWeightsVersion()
+    {
+        auto& jitter = GetJitter();
+        auto address = jitter.GetFunctionAddress(_moduleName + "_GetWeightsVersion");
+        if (address == 0)
+        {
+            throw utilities::LogicException(utilities::LogicExceptionErrors::illegalState, "map was not compiled with patchable weights");
+        }
+        return reinterpret_cast<const char* (*)()>(address)();
+    }
+
+    size_t IRCompiledMap::GetWeightsSize()
+    {
+        auto& jitter = GetJitter();
+        auto address = jitter.GetFunctionAddress(_moduleName + "_GetWeightsSize");
+        if (address == 0)
+        {
+            throw utilities::LogicException(utilities::LogicExceptionErrors::illegalState, "map was not compiled with patchable weights");
+        }
+        return static_cast<size_t>(reinterpret_cast<int (*)()>(address)());
+    }
+
+    bool IRCompiledMap::PatchWeights(const void* weights, size_t size)
+    {
+        auto& jitter = GetJitter();
+        auto address = jitter.GetFunctionAddress(_moduleName + "_PatchWeights");
+        if (address == 0)
+        {
+            throw utilities::LogicException(utilities::LogicExceptionErrors::illegalState, "map was not compiled with patchable weights");
+        }
+        auto fn = reinterpret_cast<int (*)(const uint8_t*, int)>(address);
+        return fn(static_cast<const uint8_t*>(weights), static_cast<int>(size)) != 0;
+    }
+
     //
     // Profiling support
     //
@@ -16,6 +16,14 @@
 #include "EmitterException.h"
 #include "Variable.h"
 
+// emitters
+#include "IRRuntime.h"
+
+// stl
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+
 namespace ell
 {
 namespace model
@@ -89,13 +97,17 @@ namespace model
         EnsureValidMap(map);
         model::TransformContext context{ [](const model::Node& node) { return node.IsCompilable() ? model::NodeAction::compile : model::NodeAction::refine; } };
         map.Refine(context);
+        if (GetMapCompilerParameters().eliminateCommonSubexpressions)
+        {
+            map.EliminateCommonSubexpressions();
+        }
 
         // Now the model ready for compiling
         if (GetMapCompilerParameters().profile)
         {
             GetModule().AddPreprocessorDefinition(GetNamespacePrefix() + "_PROFILING", "1");
         }
-        _profiler = { GetModule(), map.GetModel(), GetMapCompilerParameters().profile };
+        _profiler = { GetModule(), map.GetModel(), GetMapCompilerParameters().profile, GetMapCompilerParameters().profileSampleInterval };
         _profiler.EmitInitialization();
 
         // Now we have the refined map, compile it
@@ -107,6 +119,9 @@ namespace model
         // Finish any profiling stuff we need to do and emit functions
         _profiler.EmitModelProfilerFunctions();
 
+        // Whole-module optimization, now that all of the module's functions exist
+        _moduleEmitter.Optimize(GetMapCompilerParameters().moduleOptimizationLevel);
+
         auto module = std::make_unique<emitters::IRModuleEmitter>(std::move(_moduleEmitter));
         module->SetTargetTriple(GetCompilerParameters().targetDevice.triple);
         module->SetTargetDataLayout(GetCompilerParameters().targetDevice.dataLayout);
@@ -118,6 +133,11 @@ namespace model
         EmitGetInputSizeFunction(map);
         EmitGetOutputSizeFunction(map);
         EmitGetNumNodesFunction(map);
+        EmitBatchPredictFunction(map);
+        if (GetCompilerParameters().patchableWeights)
+        {
+            EmitWeightsAPIFunctions();
+        }
     }
 
     void IRMapCompiler::EmitGetInputSizeFunction(const DynamicMap& map)
@@ -154,6 +174,459 @@ namespace model
         _moduleEmitter.EndFunction();
     }
 
+    void IRMapCompiler::EmitBatchPredictFunction(const DynamicMap& map)
+    {
+        auto inputSize = map.GetInput(0)->Size();
+        if (inputSize == 1)
+        {
+            // scalar-input maps keep the per-example entry point only
+            return;
+        }
+        auto outputSize = map.GetOutput(0).Size();
+
+        auto inputType = PortTypeToVariableType(map.GetInput(0)->GetOutputPort().GetType());
+        auto outputType = PortTypeToVariableType(map.GetOutput(0).GetPortType());
+
+        // Ask LLVM to inline the per-example predict body into the batch loop, so the optimizer
+        // sees one loop over the whole model per batch: loop-invariant weight address computations
+        // hoist out, and straight-line node bodies can vectorize across the loop. The exported
+        // per-example entry point is unaffected.
+        auto pPredictFunction = _moduleEmitter.GetFunction(GetPredictFunctionName());
+        if (pPredictFunction != nullptr)
+        {
+            pPredictFunction->addFnAttr(llvm::Attribute::AlwaysInline);
+        }
+
+        // emit <predict>_batch(const InputType* inputs, OutputType* outputs, int32 count), which
+        // loops over the examples inside the emitted code so that per-call overhead is paid once per batch
+        emitters::NamedVariableTypeList batchFunctionArguments = { { "inputs", GetPointerType(inputType) },
+                                                                   { "outputs", GetPointerType(outputType) },
+                                                                   { "count", emitters::VariableType::Int32 } };
+        auto function = _moduleEmitter.BeginFunction(GetPredictFunctionName() + "_batch", emitters::VariableType::Void, batchFunctionArguments);
+        function.InsertMetadata(emitters::c_declareInHeaderTagName);
+
+        auto arguments = function.Arguments().begin();
+        auto inputs = &(*arguments++);
+        auto outputs = &(*arguments++);
+        auto count = &(*arguments++);
+
+        auto loop = function.ForLoop();
+        loop.Begin(count);
+        {
+            auto exampleIndex = loop.LoadIterationVariable();
+            auto inputOffset = function.Operator(emitters::TypedOperator::multiply, exampleIndex, function.Literal(static_cast<int>(inputSize)));
+            auto outputOffset = function.Operator(emitters::TypedOperator::multiply, exampleIndex, function.Literal(static_cast<int>(outputSize)));
+            function.Call(GetPredictFunctionName(), { function.PointerOffset(inputs, inputOffset), function.PointerOffset(outputs, outputOffset) });
+        }
+        loop.End();
+        _moduleEmitter.EndFunction();
+    }
+
+    void IRMapCompiler::EmitWeightsAPIFunctions()
+    {
+        auto& module = GetModule();
+        auto& context = module.GetLLVMContext();
+        auto int32Type = llvm::Type::getInt32Ty(context);
+        auto int8PtrType = llvm::Type::getInt8PtrTy(context);
+
+        // <prefix>_GetWeightsSize: the size in bytes of a weight blob for this model
+        {
+            auto function = _moduleEmitter.BeginFunction(GetNamespacePrefix() + "_GetWeightsSize", int32Type, {});
+            function.InsertMetadata(emitters::c_declareInHeaderTagName);
+            function.Return(function.Literal(static_cast<int>(module.GetWeightsSegmentSize())));
+            _moduleEmitter.EndFunction();
+        }
+
+        // <prefix>_GetWeightsVersion: identifies the weight segment layout; a blob is only valid for
+        // a module reporting the same version
+        {
+            auto function = _moduleEmitter.BeginFunction(GetNamespacePrefix() + "_GetWeightsVersion", int8PtrType, {});
+            function.InsertMetadata(emitters::c_declareInHeaderTagName);
+            function.Return(function.Literal(module.GetWeightsVersion()));
+            _moduleEmitter.EndFunction();
+        }
+
+        // <prefix>_PatchWeights(blob, size): copies each entry's slice of the blob over the live
+        // weight global. Returns 1 on success, 0 if the blob size doesn't match the compiled segment.
+        {
+            emitters::NamedVariableTypeList patchFunctionArguments = { { "blob", emitters::VariableType::BytePointer },
+                                                                       { "size", emitters::VariableType::Int32 } };
+            auto function = _moduleEmitter.BeginFunction(GetNamespacePrefix() + "_PatchWeights", emitters::VariableType::Int32, patchFunctionArguments);
+            function.InsertMetadata(emitters::c_declareInHeaderTagName);
+
+            auto arguments = function.Arguments().begin();
+            auto blob = &(*arguments++);
+            auto size = &(*arguments++);
+
+            llvm::Value* result = function.Variable(emitters::VariableType::Int32, "result");
+            function.Store(result, function.Literal(0));
+            auto ifEmitter = function.If(emitters::TypedComparison::equals, size, function.Literal(static_cast<int>(module.GetWeightsSegmentSize())));
+            {
+                for (const auto& entry : module.GetWeightsSegment())
+                {
+                    auto source = function.PointerOffset(blob, function.Literal(static_cast<int>(entry.byteOffset)));
+                    auto destination = function.PointerOffset(entry.global, 0);
+                    function.MemoryCopy<char>(source, destination, static_cast<int>(entry.byteSize));
+                }
+                function.Store(result, function.Literal(1));
+            }
+            ifEmitter.End();
+            function.Return(function.Load(result));
+            _moduleEmitter.EndFunction();
+        }
+    }
+
+    //
+    // Pipelined compilation
+    //
+
+    namespace
+    {
+        // size in bytes of one element of the given port type, as laid out in the pipeline queue slots
+        size_t GetPortTypeByteSize(Port::PortType type)
+        {
+            switch (type)
+            {
+                case Port::PortType::boolean:
+                    return sizeof(bool);
+                case Port::PortType::integer:
+                    return sizeof(int);
+                case Port::PortType::bigInt:
+                    return sizeof(int64_t);
+                case Port::PortType::smallReal:
+                    return sizeof(float);
+                case Port::PortType::real:
+                    return sizeof(double);
+                default:
+                    throw emitters::EmitterException(emitters::EmitterError::notSupported, "Unsupported port type in pipeline boundary");
+            }
+        }
+    }
+
+    void IRMapCompiler::EmitPipelineFunctions(DynamicMap& map, const std::string& functionName, emitters::NamedVariableTypeList& mainFunctionArguments)
+    {
+        EmitPipelineSyncFunction(functionName, mainFunctionArguments);
+        EmitPipelineAsyncFunctions(map, functionName, mainFunctionArguments);
+    }
+
+    void IRMapCompiler::EmitPipelineSyncFunction(const std::string& functionName, emitters::NamedVariableTypeList& mainFunctionArguments)
+    {
+        auto numStages = GetPipelineStages().size();
+        _moduleEmitter.BeginMapPredictFunction(functionName, mainFunctionArguments);
+        auto& function = _moduleEmitter.GetCurrentFunction();
+        function.InsertMetadata(emitters::c_declareInHeaderTagName);
+        function.InsertMetadata(emitters::c_predictFunctionTagName);
+
+        std::vector<llvm::Value*> callArguments;
+        for (auto& argument : function.Arguments())
+        {
+            callArguments.push_back(&argument);
+        }
+
+        // run the stages back to back, handing each one the boundary values it consumes; this keeps
+        // the predict entry point's single-sample semantics unchanged
+        for (size_t stage = 0; stage < numStages; ++stage)
+        {
+            for (const auto& boundaryPort : GetPipelineBoundaryPorts())
+            {
+                if (boundaryPort.consumerStage == stage)
+                {
+                    CopyPortValue(function, *boundaryPort.port, *boundaryPort.producerVariable, *boundaryPort.consumerVariable);
+                }
+            }
+            function.Call(functionName + "_stage" + std::to_string(stage), callArguments);
+        }
+        _moduleEmitter.EndMapPredictFunction();
+    }
+
+    void IRMapCompiler::EmitPipelineAsyncFunctions(DynamicMap& map, const std::string& functionName, emitters::NamedVariableTypeList& mainFunctionArguments)
+    {
+        auto& runtime = _moduleEmitter.GetRuntime();
+        auto& emitter = _moduleEmitter.GetIREmitter();
+        auto& irBuilder = emitter.GetIRBuilder();
+        auto& context = _moduleEmitter.GetLLVMContext();
+        auto int32Type = llvm::Type::getInt32Ty(context);
+        auto voidType = llvm::Type::getVoidTy(context);
+        auto byteType = llvm::Type::getInt8Ty(context);
+        auto bytePtrType = llvm::Type::getInt8PtrTy(context);
+
+        const auto& boundaryPorts = GetPipelineBoundaryPorts();
+        auto numStages = GetPipelineStages().size();
+        auto numBoundaries = numStages - 1;
+        auto numQueues = numBoundaries + 1; // one queue per boundary, plus the output queue
+        int capacity = static_cast<int>(GetMapCompilerParameters().pipelineQueueLength) + 1; // the ring keeps one slot unused
+
+        std::unordered_map<const OutputPortBase*, size_t> producerStages;
+        std::unordered_map<const OutputPortBase*, emitters::Variable*> producerVariables;
+        for (const auto& boundaryPort : boundaryPorts)
+        {
+            producerStages[boundaryPort.port] = boundaryPort.producerStage;
+            producerVariables[boundaryPort.port] = boundaryPort.producerVariable;
+        }
+
+        // byte layout of the slots for each boundary: every port produced at or before the boundary
+        // and consumed after it travels in the slot, so workers can forward values they don't use
+        std::vector<std::vector<PipelineSlotEntry>> slotLayouts(numBoundaries);
+        std::vector<size_t> slotSizes(numQueues);
+        for (size_t boundary = 0; boundary < numBoundaries; ++boundary)
+        {
+            size_t offset = 0;
+            std::unordered_set<const OutputPortBase*> seen;
+            for (const auto& boundaryPort : boundaryPorts)
+            {
+                if (boundaryPort.producerStage <= boundary && boundaryPort.consumerStage > boundary && seen.insert(boundaryPort.port).second)
+                {
+                    size_t byteSize = boundaryPort.port->Size() * GetPortTypeByteSize(boundaryPort.port->GetType());
+                    slotLayouts[boundary].push_back({ boundaryPort.port, offset, byteSize });
+                    offset += (byteSize + 7) & ~static_cast<size_t>(7); // keep entries 8-byte aligned
+                }
+            }
+            slotSizes[boundary] = std::max(offset, static_cast<size_t>(1));
+        }
+        auto outputPort = map.GetOutput(0).GetRanges()[0].ReferencedPort();
+        slotSizes[numBoundaries] = outputPort->Size() * GetPortTypeByteSize(outputPort->GetType());
+
+        auto findSlotEntry = [&slotLayouts](size_t boundary, const OutputPortBase* port) -> const PipelineSlotEntry& {
+            const auto& layout = slotLayouts[boundary];
+            auto entry = std::find_if(layout.begin(), layout.end(), [port](const PipelineSlotEntry& e) { return e.port == port; });
+            assert(entry != layout.end() && "Boundary port missing from slot layout");
+            return *entry;
+        };
+
+        // the queues and their slot storage, plus per-worker staging buffers for packing and
+        // unpacking slots, and a staging buffer the final stage writes its output to
+        auto queueType = runtime.GetPipelineQueueType();
+        std::vector<llvm::GlobalVariable*> queues(numQueues);
+        std::vector<llvm::GlobalVariable*> queueSlots(numQueues);
+        for (size_t queueIndex = 0; queueIndex < numQueues; ++queueIndex)
+        {
+            queues[queueIndex] = _moduleEmitter.Global(queueType, GetNamespacePrefix() + "_PipelineQueue" + std::to_string(queueIndex));
+            queueSlots[queueIndex] = _moduleEmitter.GlobalArray(GetNamespacePrefix() + "_PipelineQueueSlots" + std::to_string(queueIndex), byteType, slotSizes[queueIndex] * capacity);
+        }
+
+        std::vector<llvm::GlobalVariable*> popStaging(numStages);
+        std::vector<llvm::GlobalVariable*> pushStaging(numStages);
+        for (size_t stage = 1; stage < numStages; ++stage)
+        {
+            popStaging[stage] = _moduleEmitter.GlobalArray(GetNamespacePrefix() + "_PipelinePopStaging" + std::to_string(stage), byteType, slotSizes[stage - 1]);
+        }
+        for (size_t stage = 0; stage < numBoundaries; ++stage)
+        {
+            pushStaging[stage] = _moduleEmitter.GlobalArray(GetNamespacePrefix() + "_PipelinePushStaging" + std::to_string(stage), byteType, slotSizes[stage]);
+        }
+        auto outputStaging = _moduleEmitter.GlobalArray(GetNamespacePrefix() + "_PipelineOutputStaging", byteType, slotSizes[numBoundaries]);
+
+        auto initFunction = runtime.GetPipelineQueueInitFunction();
+        auto pushFunction = runtime.GetPipelineQueuePushFunction();
+        auto popFunction = runtime.GetPipelineQueuePopFunction();
+        auto stopFunction = runtime.GetPipelineQueueStopFunction();
+
+        auto threadEntryType = llvm::FunctionType::get(bytePtrType, { bytePtrType }, false);
+        llvm::FunctionType* pthreadCreateType = llvm::FunctionType::get(int32Type, { bytePtrType->getPointerTo(), bytePtrType, threadEntryType->getPointerTo(), bytePtrType }, false);
+        _moduleEmitter.DeclareFunction("pthread_create", pthreadCreateType);
+        llvm::FunctionType* pthreadJoinType = llvm::FunctionType::get(int32Type, { bytePtrType, bytePtrType->getPointerTo() }, false);
+        _moduleEmitter.DeclareFunction("pthread_join", pthreadJoinType);
+        auto pthreadCreateFunction = _moduleEmitter.GetFunction("pthread_create");
+        auto pthreadJoinFunction = _moduleEmitter.GetFunction("pthread_join");
+        auto threads = _moduleEmitter.GlobalArray(GetNamespacePrefix() + "_PipelineThreads", bytePtrType, numStages - 1);
+
+        // in queue mode the stage functions never touch the caller's pointers: the input values
+        // travel in the slots and the final stage writes to the output staging buffer
+        auto inputArgType = emitter.Type(mainFunctionArguments.front().second);
+        auto outputArgType = emitter.Type(mainFunctionArguments.back().second);
+        auto nullInput = llvm::Constant::getNullValue(inputArgType);
+        auto nullOutput = llvm::Constant::getNullValue(outputArgType);
+
+        // one worker function per stage after the first: pop a sample, run the stage over it, and
+        // hand the results (plus any forwarded values) to the next stage or the output queue
+        std::vector<llvm::Function*> workerFunctions(numStages);
+        for (size_t stage = 1; stage < numStages; ++stage)
+        {
+            bool isFinalStage = stage == numStages - 1;
+            auto function = _moduleEmitter.BeginFunction(GetNamespacePrefix() + "_PipelineWorker" + std::to_string(stage), bytePtrType, std::vector<llvm::Type*>{ bytePtrType });
+
+            auto loopBlock = function.Block("workLoop");
+            auto bodyBlock = function.Block("body");
+            auto exitBlock = function.Block("exit");
+            function.Branch(loopBlock);
+
+            // wait for the previous stage to hand over a sample; a zero result means the pipeline
+            // was stopped and its queue has been drained
+            function.SetCurrentBlock(loopBlock);
+            auto popResult = function.Call(popFunction, { queues[stage - 1], function.PointerOffset(popStaging[stage], 0) });
+            auto popStopped = irBuilder.CreateICmpEQ(popResult, function.Literal(0));
+            function.Branch(popStopped, exitBlock, bodyBlock);
+
+            function.SetCurrentBlock(bodyBlock);
+            for (const auto& boundaryPort : boundaryPorts)
+            {
+                if (boundaryPort.consumerStage == stage)
+                {
+                    const auto& entry = findSlotEntry(stage - 1, boundaryPort.port);
+                    auto pMirror = _moduleEmitter.EnsureEmitted(*boundaryPort.consumerVariable);
+                    auto pMirrorBytes = irBuilder.CreateBitCast(function.PointerOffset(pMirror, 0), bytePtrType);
+                    function.MemoryCopy<uint8_t>(function.PointerOffset(popStaging[stage], static_cast<int>(entry.offset)), pMirrorBytes, function.Literal(static_cast<int>(entry.size)));
+                }
+            }
+
+            llvm::Value* outputArgument = isFinalStage ? irBuilder.CreateBitCast(function.PointerOffset(outputStaging, 0), outputArgType) : static_cast<llvm::Value*>(nullOutput);
+            function.Call(functionName + "_stage" + std::to_string(stage), { static_cast<llvm::Value*>(nullInput), outputArgument });
+
+            llvm::Value* pushResult = nullptr;
+            if (isFinalStage)
+            {
+                pushResult = function.Call(pushFunction, { queues[numBoundaries], function.PointerOffset(outputStaging, 0) });
+            }
+            else
+            {
+                for (const auto& entry : slotLayouts[stage])
+                {
+                    if (producerStages[entry.port] == stage)
+                    {
+                        auto pSource = GetAddressableValue(function, *producerVariables[entry.port]);
+                        auto pSourceBytes = irBuilder.CreateBitCast(function.PointerOffset(pSource, 0), bytePtrType);
+                        function.MemoryCopy<uint8_t>(pSourceBytes, function.PointerOffset(pushStaging[stage], static_cast<int>(entry.offset)), function.Literal(static_cast<int>(entry.size)));
+                    }
+                    else
+                    {
+                        // a value produced by an earlier stage and consumed by a later one just
+                        // moves from the incoming slot to the outgoing one
+                        const auto& incoming = findSlotEntry(stage - 1, entry.port);
+                        function.MemoryCopy<uint8_t>(function.PointerOffset(popStaging[stage], static_cast<int>(incoming.offset)), function.PointerOffset(pushStaging[stage], static_cast<int>(entry.offset)), function.Literal(static_cast<int>(entry.size)));
+                    }
+                }
+                pushResult = function.Call(pushFunction, { queues[stage], function.PointerOffset(pushStaging[stage], 0) });
+            }
+            auto pushStopped = irBuilder.CreateICmpEQ(pushResult, function.Literal(0));
+            function.Branch(pushStopped, exitBlock, loopBlock);
+
+            function.SetCurrentBlock(exitBlock);
+            function.Return(llvm::ConstantPointerNull::get(bytePtrType));
+            _moduleEmitter.EndFunction();
+            workerFunctions[stage] = function.GetFunction();
+        }
+
+        // <name>_PipelineStart(): initialize the queues and launch one worker thread per stage
+        // after the first; stage 0 runs on the caller's thread inside <name>_PipelinePush
+        {
+            auto function = _moduleEmitter.BeginFunction(functionName + "_PipelineStart", voidType, std::vector<llvm::Type*>{});
+            function.InsertMetadata(emitters::c_declareInHeaderTagName);
+            for (size_t queueIndex = 0; queueIndex < numQueues; ++queueIndex)
+            {
+                function.Call(initFunction, { queues[queueIndex], function.PointerOffset(queueSlots[queueIndex], 0), function.Literal(static_cast<int>(slotSizes[queueIndex])), function.Literal(capacity) });
+            }
+            for (size_t stage = 1; stage < numStages; ++stage)
+            {
+                auto threadPtr = function.PointerOffset(threads, static_cast<int>(stage - 1));
+                function.Call(pthreadCreateFunction, { threadPtr, llvm::ConstantPointerNull::get(bytePtrType), workerFunctions[stage], llvm::ConstantPointerNull::get(bytePtrType) });
+            }
+            function.Return();
+            _moduleEmitter.EndFunction();
+        }
+
+        // <name>_PipelinePush(input): run the first stage on the calling thread and queue its
+        // boundary values for the workers; returns 0 if the pipeline has been stopped
+        {
+            emitters::NamedVariableTypeList pushArguments(mainFunctionArguments.begin(), mainFunctionArguments.end() - 1);
+            auto function = _moduleEmitter.BeginFunction(functionName + "_PipelinePush", emitters::VariableType::Int32, pushArguments);
+            function.InsertMetadata(emitters::c_declareInHeaderTagName);
+
+            std::vector<llvm::Value*> stageArguments;
+            for (auto& argument : function.Arguments())
+            {
+                stageArguments.push_back(&argument);
+            }
+            stageArguments.push_back(nullOutput);
+            function.Call(functionName + "_stage0", stageArguments);
+
+            for (const auto& entry : slotLayouts[0])
+            {
+                auto pSource = GetAddressableValue(function, *producerVariables[entry.port]);
+                auto pSourceBytes = irBuilder.CreateBitCast(function.PointerOffset(pSource, 0), bytePtrType);
+                function.MemoryCopy<uint8_t>(pSourceBytes, function.PointerOffset(pushStaging[0], static_cast<int>(entry.offset)), function.Literal(static_cast<int>(entry.size)));
+            }
+            function.Return(function.Call(pushFunction, { queues[0], function.PointerOffset(pushStaging[0], 0) }));
+            _moduleEmitter.EndFunction();
+        }
+
+        // <name>_PipelinePop(output): wait for the next finished sample and copy it out; returns 0
+        // if the pipeline was stopped and no samples remain
+        {
+            emitters::NamedVariableTypeList popArguments(mainFunctionArguments.end() - 1, mainFunctionArguments.end());
+            auto function = _moduleEmitter.BeginFunction(functionName + "_PipelinePop", emitters::VariableType::Int32, popArguments);
+            function.InsertMetadata(emitters::c_declareInHeaderTagName);
+            auto arguments = function.Arguments().begin();
+            llvm::Argument& output = *arguments++;
+            auto outputBytes = irBuilder.CreateBitCast(&output, bytePtrType);
+            function.Return(function.Call(popFunction, { queues[numBoundaries], outputBytes }));
+            _moduleEmitter.EndFunction();
+        }
+
+        // <name>_PipelineStop(): release the workers and wait for them to exit; finished samples
+        // can still be popped, but samples between stages are discarded
+        {
+            auto function = _moduleEmitter.BeginFunction(functionName + "_PipelineStop", voidType, std::vector<llvm::Type*>{});
+            function.InsertMetadata(emitters::c_declareInHeaderTagName);
+            for (size_t queueIndex = 0; queueIndex < numQueues; ++queueIndex)
+            {
+                function.Call(stopFunction, { queues[queueIndex] });
+            }
+            for (size_t stage = 1; stage < numStages; ++stage)
+            {
+                auto threadValue = function.Load(function.PointerOffset(threads, static_cast<int>(stage - 1)));
+                function.Call(pthreadJoinFunction, { threadValue, llvm::ConstantPointerNull::get(bytePtrType->getPointerTo()) });
+            }
+            function.Return();
+            _moduleEmitter.EndFunction();
+        }
+    }
+
+    void IRMapCompiler::CopyPortValue(emitters::IRFunctionEmitter& function, const OutputPortBase& port, emitters::Variable& sourceVariable, emitters::Variable& destinationVariable)
+    {
+        auto pSource = _moduleEmitter.EnsureEmitted(sourceVariable);
+        auto pDestination = _moduleEmitter.EnsureEmitted(destinationVariable);
+        if (!pSource->getType()->isPointerTy())
+        {
+            // a scalar passed by value (e.g. a scalar map input argument)
+            function.SetValueAt(pDestination, function.Literal(0), pSource);
+            return;
+        }
+
+        int count = static_cast<int>(port.Size());
+        switch (port.GetType())
+        {
+            case Port::PortType::boolean:
+                function.MemoryCopy<bool>(pSource, pDestination, count);
+                break;
+            case Port::PortType::integer:
+                function.MemoryCopy<int>(pSource, pDestination, count);
+                break;
+            case Port::PortType::bigInt:
+                function.MemoryCopy<int64_t>(pSource, pDestination, count);
+                break;
+            case Port::PortType::smallReal:
+                function.MemoryCopy<float>(pSource, pDestination, count);
+                break;
+            case Port::PortType::real:
+                function.MemoryCopy<double>(pSource, pDestination, count);
+                break;
+            default:
+                throw emitters::EmitterException(emitters::EmitterError::notSupported, "Unsupported port type in pipeline boundary");
+        }
+    }
+
+    llvm::Value* IRMapCompiler::GetAddressableValue(emitters::IRFunctionEmitter& function, emitters::Variable& variable)
+    {
+        auto pValue = _moduleEmitter.EnsureEmitted(variable);
+        if (pValue->getType()->isPointerTy())
+        {
+            return pValue;
+        }
+        auto pTemporary = function.Variable(pValue->getType(), "stagingTemp");
+        function.Store(pTemporary, pValue);
+        return pTemporary;
+    }
+
     //
     // Node implementor methods:
     //
@@ -211,6 +684,17 @@ namespace model
 
         _profiler.InitNode(currentFunction, node);
         _profiler.StartNode(currentFunction, node);
+
+        // in fast-math mode, tag this node's floating-point instructions so the optimizer may
+        // reassociate and contract them, unless the node's type keeps strict semantics
+        auto parameters = GetMapCompilerParameters();
+        if (parameters.compilerSettings.useFastMath)
+        {
+            auto typeName = node.GetRuntimeTypeName();
+            bool strict = parameters.strictFloatNodeTypes.count(typeName) != 0 ||
+                          parameters.strictFloatNodeTypes.count(typeName.substr(0, typeName.find('<'))) != 0;
+            GetModule().GetIREmitter().SetFastMathFlags(!strict);
+        }
     }
 
     void IRMapCompiler::OnEndCompileNode(const Node& node)
@@ -220,6 +704,12 @@ namespace model
 
         _profiler.EndNode(currentFunction, node);
 
+        // restore strict floating-point semantics for the inter-node glue code
+        if (GetMapCompilerParameters().compilerSettings.useFastMath)
+        {
+            GetModule().GetIREmitter().SetFastMathFlags(false);
+        }
+
         auto pCurBlock = currentFunction.GetCurrentBlock();
         if (pCurBlock != currentFunction.GetCurrentRegion()->End())
         {
@@ -347,6 +837,127 @@ namespace model
         return (pNode != nullptr) ? GetCurrentNodeBlocks().Get(*pNode) : nullptr;
     }
 
+    std::vector<const CompilableNode*> IRMapCompiler::GetElementwiseChain(const Node& node) const
+    {
+        std::vector<const CompilableNode*> chain;
+        if (GetCompilerParameters().unrollLoops)
+        {
+            return chain; // when unrolling, the per-element code is already fully exposed
+        }
+
+        auto pHead = dynamic_cast<const CompilableNode*>(&node);
+        if (pHead == nullptr || !pHead->IsElementwise() || IsNodeInFusedRegion(node))
+        {
+            return chain;
+        }
+
+        chain.push_back(pHead);
+        const Node* pCurrent = &node;
+        while (HasSingleDescendant(*pCurrent))
+        {
+            const Node* pNext = pCurrent->GetDependentNodes()[0];
+            auto pNextCompilable = dynamic_cast<const CompilableNode*>(pNext);
+            if (pNextCompilable == nullptr || !pNextCompilable->IsElementwise())
+            {
+                break;
+            }
+
+            // the chained value stands in for the next node's first input port, so that port must
+            // read the whole of the current node's output, in order
+            auto inputPorts = pNext->GetInputPorts();
+            if (inputPorts.empty() || inputPorts[0]->GetInputElements().NumRanges() != 1)
+            {
+                break;
+            }
+            const auto& range = inputPorts[0]->GetInputElements().GetRanges()[0];
+            if (range.ReferencedPort()->GetNode() != pCurrent || range.GetStartIndex() != 0 || range.Size() != range.ReferencedPort()->Size())
+            {
+                break;
+            }
+
+            // the outputs of fused nodes are never written to memory, so the next node's remaining
+            // input ports must not read from a node already in the chain
+            bool readsChainOutput = false;
+            for (size_t portIndex = 1; portIndex < inputPorts.size(); ++portIndex)
+            {
+                for (const auto& otherRange : inputPorts[portIndex]->GetInputElements().GetRanges())
+                {
+                    auto referencedNode = dynamic_cast<const CompilableNode*>(otherRange.ReferencedPort()->GetNode());
+                    if (std::find(chain.begin(), chain.end(), referencedNode) != chain.end())
+                    {
+                        readsChainOutput = true;
+                    }
+                }
+            }
+            if (readsChainOutput)
+            {
+                break;
+            }
+
+            chain.push_back(pNextCompilable);
+            pCurrent = pNext;
+        }
+        return chain;
+    }
+
+    bool IRMapCompiler::ShouldUnrollLoop(size_t size) const
+    {
+        auto compilerParameters = GetCompilerParameters();
+        if (!compilerParameters.unrollLoops)
+        {
+            return false;
+        }
+
+        auto limit = compilerParameters.unrollLimit;
+        if (limit == 0 && GetMapCompilerParameters().codeSizeBudget != 0)
+        {
+            // under a code-size budget, unbounded unrolling is never worth the bytes
+            const size_t budgetedUnrollLimit = 8;
+            limit = budgetedUnrollLimit;
+        }
+        return limit == 0 || size <= limit;
+    }
+
+    bool IRMapCompiler::CanFuseElementwiseChain(const Node& node) const
+    {
+        return GetElementwiseChain(node).size() > 1;
+    }
+
+    bool IRMapCompiler::TryCompileElementwiseChain(const Node& node)
+    {
+        auto chain = GetElementwiseChain(node);
+        if (chain.size() < 2)
+        {
+            return false;
+        }
+
+        // Emit a single loop that threads each element through the whole chain, keeping the
+        // intermediate values in registers. Only the last node's output is written to memory.
+        auto& currentFunction = GetModule().GetCurrentFunction();
+        auto pOutputPort = chain.back()->GetOutputPorts()[0];
+        llvm::Value* pResult = EnsurePortEmitted(*pOutputPort);
+
+        auto forLoop = currentFunction.ForLoop();
+        forLoop.Begin(pOutputPort->Size());
+        {
+            auto i = forLoop.LoadIterationVariable();
+            llvm::Value* value = nullptr;
+            for (auto pChainNode : chain)
+            {
+                value = const_cast<CompilableNode*>(pChainNode)->CompileElementwise(*this, currentFunction, i, value);
+            }
+            currentFunction.SetValueAt(pResult, i, value);
+        }
+        forLoop.End();
+
+        // the downstream chain members are fully emitted - skip them when the compiler visits them
+        for (size_t i = 1; i < chain.size(); ++i)
+        {
+            _fusedNodes.insert(chain[i]);
+        }
+        return true;
+    }
+
     llvm::LLVMContext& IRMapCompiler::GetLLVMContext()
     {
         return _moduleEmitter.GetLLVMContext();
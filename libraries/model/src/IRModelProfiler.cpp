@@ -21,6 +21,7 @@
 #include <iterator>
 #include <numeric>
 #include <string>
+#include <vector>
 
 // standard C library
 #include <time.h>
@@ -68,31 +69,34 @@ namespace model
     {
     }
 
-    void PerformanceCountersEmitter::Start(emitters::IRFunctionEmitter& function, llvm::Value* startTime)
+    void PerformanceCountersEmitter::Start(emitters::IRFunctionEmitter& function)
     {
         assert(_performanceCountersPtr != nullptr);
 
         auto& emitter = _module->GetIREmitter();
         auto& irBuilder = emitter.GetIRBuilder();
 
-        _startTime = startTime;
-
-        // Increment node entry counter
+        // Increment node entry counter (with sampling, only the instrumented invocations get here)
         auto countPtr = irBuilder.CreateInBoundsGEP(_performanceCountersType, _performanceCountersPtr, { emitter.Literal(0), emitter.Literal(0) });
         function.OperationAndUpdate(countPtr, emitters::TypedOperator::add, function.Literal<int64_t>(1));
     }
 
-    void PerformanceCountersEmitter::End(emitters::IRFunctionEmitter& function, llvm::Value* endTime)
+    void PerformanceCountersEmitter::End(emitters::IRFunctionEmitter& function, llvm::Value* elapsedTime, llvm::Value* elapsedCacheMisses, llvm::Value* elapsedBranchMisses)
     {
         assert(_performanceCountersPtr != nullptr);
 
         auto& emitter = _module->GetIREmitter();
         auto& irBuilder = emitter.GetIRBuilder();
 
-        // Compute time elapsed and increment total time counter
-        auto elapsedTime = function.Operator(emitters::TypedOperator::subtractFloat, endTime, _startTime);
+        // Increment the total time and hardware counter totals by the elapsed amounts
         auto totalTimePtr = irBuilder.CreateInBoundsGEP(_performanceCountersPtr, { emitter.Literal(0), emitter.Literal(1) }, "accumTime");
         function.OperationAndUpdate(totalTimePtr, emitters::TypedOperator::addFloat, elapsedTime);
+
+        auto totalCacheMissesPtr = irBuilder.CreateInBoundsGEP(_performanceCountersPtr, { emitter.Literal(0), emitter.Literal(2) }, "accumCacheMisses");
+        function.OperationAndUpdate(totalCacheMissesPtr, emitters::TypedOperator::add, elapsedCacheMisses);
+
+        auto totalBranchMissesPtr = irBuilder.CreateInBoundsGEP(_performanceCountersPtr, { emitter.Literal(0), emitter.Literal(3) }, "accumBranchMisses");
+        function.OperationAndUpdate(totalBranchMissesPtr, emitters::TypedOperator::add, elapsedBranchMisses);
     }
 
     void PerformanceCountersEmitter::Reset(emitters::IRFunctionEmitter& function)
@@ -105,8 +109,12 @@ namespace model
         // Compute time elapsed and increment total time counter
         auto countPtr = irBuilder.CreateInBoundsGEP(_performanceCountersType, _performanceCountersPtr, { emitter.Literal(0), emitter.Literal(0) });
         auto totalTimePtr = irBuilder.CreateInBoundsGEP(_performanceCountersPtr, { emitter.Literal(0), emitter.Literal(1) });
+        auto totalCacheMissesPtr = irBuilder.CreateInBoundsGEP(_performanceCountersPtr, { emitter.Literal(0), emitter.Literal(2) });
+        auto totalBranchMissesPtr = irBuilder.CreateInBoundsGEP(_performanceCountersPtr, { emitter.Literal(0), emitter.Literal(3) });
         function.Store(countPtr, function.Literal<int64_t>(0));
         function.Store(totalTimePtr, function.Literal<double>(0));
+        function.Store(totalCacheMissesPtr, function.Literal<int64_t>(0));
+        function.Store(totalBranchMissesPtr, function.Literal<int64_t>(0));
     }
 
     //
@@ -123,14 +131,14 @@ namespace model
         _performanceCountersEmitter.Init(function);
     }
 
-    void NodePerformanceEmitter::Start(emitters::IRFunctionEmitter& function, llvm::Value* startTime)
+    void NodePerformanceEmitter::Start(emitters::IRFunctionEmitter& function)
     {
-        _performanceCountersEmitter.Start(function, startTime);
+        _performanceCountersEmitter.Start(function);
     }
 
-    void NodePerformanceEmitter::End(emitters::IRFunctionEmitter& function, llvm::Value* endTime)
+    void NodePerformanceEmitter::End(emitters::IRFunctionEmitter& function, llvm::Value* elapsedTime, llvm::Value* elapsedCacheMisses, llvm::Value* elapsedBranchMisses)
     {
-        _performanceCountersEmitter.End(function, endTime);
+        _performanceCountersEmitter.End(function, elapsedTime, elapsedCacheMisses, elapsedBranchMisses);
     }
 
     void NodePerformanceEmitter::Reset(emitters::IRFunctionEmitter& function)
@@ -147,8 +155,8 @@ namespace model
         // Emit functions
     }
 
-    ModelProfiler::ModelProfiler(emitters::IRModuleEmitter& module, Model& model, bool enableProfiling)
-        : _module(&module), _model(&model), _profilingEnabled(enableProfiling), _nodeInfoType(nullptr), _performanceCountersType(nullptr)
+    ModelProfiler::ModelProfiler(emitters::IRModuleEmitter& module, Model& model, bool enableProfiling, size_t sampleInterval)
+        : _module(&module), _model(&model), _profilingEnabled(enableProfiling), _sampleInterval(std::max<size_t>(sampleInterval, 1)), _nodeInfoType(nullptr), _performanceCountersType(nullptr)
     {
         // Emit functions
     }
@@ -186,7 +194,9 @@ namespace model
         // NodePerformanceCounters
         fields = {
             int64Type, // count
-            doubleType // timer
+            doubleType, // timer
+            int64Type, // cache misses
+            int64Type // branch misses
         };
 
         _performanceCountersType = llvm::StructType::create(context, fields, GetNamespacePrefix() + "_PerformanceCounters");
@@ -200,16 +210,27 @@ namespace model
             return;
         }
 
-        auto startTime = CallGetCurrentTime(function);
         auto& emitter = _module->GetIREmitter();
         auto& irBuilder = emitter.GetIRBuilder();
 
         assert(_modelPerformanceCountersArray != nullptr);
         auto modelPerformanceCountersPtr = irBuilder.CreateInBoundsGEP(_modelPerformanceCountersArray, { emitter.Literal(0), emitter.Literal(0) });
         _modelPerformanceCounters = { *_module, modelPerformanceCountersPtr, _performanceCountersType };
-
         _modelPerformanceCounters.Init(function);
-        _modelPerformanceCounters.Start(function, startTime);
+
+        // Count every invocation, and with sampling decide up front whether this one runs instrumented
+        auto invocationCount = function.Load(_invocationCountVar);
+        function.Store(_invocationCountVar, function.Operator(emitters::TypedOperator::add, invocationCount, function.Literal<int64_t>(1)));
+        if (_sampleInterval > 1)
+        {
+            auto remainder = function.Operator(emitters::TypedOperator::moduloSigned, invocationCount, function.Literal<int64_t>(static_cast<int64_t>(_sampleInterval)));
+            auto isSampled = function.Comparison(emitters::TypedComparison::equals, remainder, function.Literal<int64_t>(0));
+            function.Store(_sampleActiveVar, function.Select(isSampled, function.Literal(1), function.Literal(0)));
+        }
+
+        EmitStartReadings(function, _modelStartTimeVar, _modelStartCacheMissesVar, _modelStartBranchMissesVar, [&]() {
+            _modelPerformanceCounters.Start(function);
+        });
     }
 
     void ModelProfiler::EndModel(emitters::IRFunctionEmitter& function)
@@ -219,8 +240,9 @@ namespace model
             return;
         }
 
-        auto endTime = CallGetCurrentTime(function);
-        _modelPerformanceCounters.End(function, endTime);
+        EmitEndReadings(function, _modelStartTimeVar, _modelStartCacheMissesVar, _modelStartBranchMissesVar, [&](llvm::Value* elapsedTime, llvm::Value* elapsedCacheMisses, llvm::Value* elapsedBranchMisses) {
+            _modelPerformanceCounters.End(function, elapsedTime, elapsedCacheMisses, elapsedBranchMisses);
+        });
     }
 
     void ModelProfiler::InitNode(emitters::IRFunctionEmitter& function, const Node& node)
@@ -245,9 +267,10 @@ namespace model
         auto& performanceCounters = GetPerformanceCountersForNode(node);
         auto& typePerformanceCounters = GetTypePerformanceCountersForNode(node);
 
-        auto startTime = CallGetCurrentTime(function);
-        performanceCounters.Start(function, startTime);
-        typePerformanceCounters.Start(function, startTime);
+        EmitStartReadings(function, _nodeStartTimeVar, _nodeStartCacheMissesVar, _nodeStartBranchMissesVar, [&]() {
+            performanceCounters.Start(function);
+            typePerformanceCounters.Start(function);
+        });
     }
 
     void ModelProfiler::EndNode(emitters::IRFunctionEmitter& function, const Node& node)
@@ -259,9 +282,10 @@ namespace model
         auto& performanceCounters = GetPerformanceCountersForNode(node);
         auto& typePerformanceCounters = GetTypePerformanceCountersForNode(node);
 
-        auto endTime = CallGetCurrentTime(function);
-        performanceCounters.End(function, endTime);
-        typePerformanceCounters.End(function, endTime);
+        EmitEndReadings(function, _nodeStartTimeVar, _nodeStartCacheMissesVar, _nodeStartBranchMissesVar, [&](llvm::Value* elapsedTime, llvm::Value* elapsedCacheMisses, llvm::Value* elapsedBranchMisses) {
+            performanceCounters.End(function, elapsedTime, elapsedCacheMisses, elapsedBranchMisses);
+            typePerformanceCounters.End(function, elapsedTime, elapsedCacheMisses, elapsedBranchMisses);
+        });
     }
 
     void ModelProfiler::EmitModelProfilerFunctions()
@@ -275,8 +299,10 @@ namespace model
         assert(_model != nullptr);
 
         EmitGetModelPerformanceCountersFunction();
+        EmitGetInvocationCountFunction();
         EmitPrintModelProfilingInfoFunction();
         EmitResetModelProfilingInfoFunction();
+        EmitWriteProfilingMetricsFunction();
 
         // EmitGetNumNodesFunction();
         EmitGetNodeInfoFunction();
@@ -302,6 +328,68 @@ namespace model
         // Note: We're grossly overallocating global array for types
         _nodeTypeInfoArray = _module->GlobalArray(GetNamespacePrefix() + "_NodeTypeInfoArray", _nodeInfoType, numNodes);
         _nodeTypePerformanceCountersArray = _module->GlobalArray(GetNamespacePrefix() + "_NodeTypePerformanceCountersArray", _performanceCountersType, numNodes);
+
+        // Sampling state and scratch storage for the start-of-region readings. Globals (rather than
+        // SSA values) let the start readings cross the sampling branches between a region's Start
+        // and End code.
+        _invocationCountVar = _module->Global(emitters::VariableType::Int64, GetNamespacePrefix() + "_ProfileInvocationCount");
+        if (_sampleInterval > 1)
+        {
+            _sampleActiveVar = _module->Global(emitters::VariableType::Int32, GetNamespacePrefix() + "_ProfileSampleActive");
+        }
+        _modelStartTimeVar = _module->Global(emitters::VariableType::Double, GetNamespacePrefix() + "_ProfileModelStartTime");
+        _modelStartCacheMissesVar = _module->Global(emitters::VariableType::Int64, GetNamespacePrefix() + "_ProfileModelStartCacheMisses");
+        _modelStartBranchMissesVar = _module->Global(emitters::VariableType::Int64, GetNamespacePrefix() + "_ProfileModelStartBranchMisses");
+        _nodeStartTimeVar = _module->Global(emitters::VariableType::Double, GetNamespacePrefix() + "_ProfileNodeStartTime");
+        _nodeStartCacheMissesVar = _module->Global(emitters::VariableType::Int64, GetNamespacePrefix() + "_ProfileNodeStartCacheMisses");
+        _nodeStartBranchMissesVar = _module->Global(emitters::VariableType::Int64, GetNamespacePrefix() + "_ProfileNodeStartBranchMisses");
+    }
+
+    void ModelProfiler::EmitStartReadings(emitters::IRFunctionEmitter& function, llvm::GlobalVariable* startTimeVar, llvm::GlobalVariable* startCacheMissesVar, llvm::GlobalVariable* startBranchMissesVar, const std::function<void()>& startCounters)
+    {
+        auto emitReadings = [&]() {
+            function.Store(startTimeVar, CallGetCurrentTime(function));
+            function.Store(startCacheMissesVar, CallGetCacheMissCount(function));
+            function.Store(startBranchMissesVar, CallGetBranchMissCount(function));
+            startCounters();
+        };
+
+        if (_sampleInterval > 1)
+        {
+            // unsampled invocations only pay for this flag test
+            auto ifEmitter = function.If(emitters::TypedComparison::equals, function.Load(_sampleActiveVar), function.Literal(1));
+            {
+                emitReadings();
+            }
+            ifEmitter.End();
+        }
+        else
+        {
+            emitReadings();
+        }
+    }
+
+    void ModelProfiler::EmitEndReadings(emitters::IRFunctionEmitter& function, llvm::GlobalVariable* startTimeVar, llvm::GlobalVariable* startCacheMissesVar, llvm::GlobalVariable* startBranchMissesVar, const std::function<void(llvm::Value*, llvm::Value*, llvm::Value*)>& endCounters)
+    {
+        auto emitReadings = [&]() {
+            auto elapsedTime = function.Operator(emitters::TypedOperator::subtractFloat, CallGetCurrentTime(function), function.Load(startTimeVar));
+            auto elapsedCacheMisses = function.Operator(emitters::TypedOperator::subtract, CallGetCacheMissCount(function), function.Load(startCacheMissesVar));
+            auto elapsedBranchMisses = function.Operator(emitters::TypedOperator::subtract, CallGetBranchMissCount(function), function.Load(startBranchMissesVar));
+            endCounters(elapsedTime, elapsedCacheMisses, elapsedBranchMisses);
+        };
+
+        if (_sampleInterval > 1)
+        {
+            auto ifEmitter = function.If(emitters::TypedComparison::equals, function.Load(_sampleActiveVar), function.Literal(1));
+            {
+                emitReadings();
+            }
+            ifEmitter.End();
+        }
+        else
+        {
+            emitReadings();
+        }
     }
 
     void ModelProfiler::EmitGetModelPerformanceCountersFunction()
@@ -316,6 +404,18 @@ namespace model
         _module->EndFunction();
     }
 
+    void ModelProfiler::EmitGetInvocationCountFunction()
+    {
+        auto& context = _module->GetLLVMContext();
+        auto int64Type = llvm::Type::getInt64Ty(context);
+
+        // the total invocation count, including the invocations sampling skipped; with the sampled
+        // run counts this gives the effective sampling fraction
+        auto function = _module->BeginFunction(GetNamespacePrefix() + "_GetProfileInvocationCount", int64Type, {});
+        function.Return(function.Load(_invocationCountVar));
+        _module->EndFunction();
+    }
+
     void ModelProfiler::EmitGetNumNodeTypesFunction()
     {
         auto& context = _module->GetLLVMContext();
@@ -411,7 +511,9 @@ namespace model
         // Print some statistics
         auto countPtr = irBuilder.CreateInBoundsGEP(modelPerformanceCountersPtr, { function.Literal(0), function.Literal(0) });
         auto totalTimePtr = irBuilder.CreateInBoundsGEP(modelPerformanceCountersPtr, { function.Literal(0), function.Literal(1) });
-        function.Printf("Total time: %f ms\tcount: %d\n", { function.Load(totalTimePtr), function.Load(countPtr) });
+        auto totalCacheMissesPtr = irBuilder.CreateInBoundsGEP(modelPerformanceCountersPtr, { function.Literal(0), function.Literal(2) });
+        auto totalBranchMissesPtr = irBuilder.CreateInBoundsGEP(modelPerformanceCountersPtr, { function.Literal(0), function.Literal(3) });
+        function.Printf("Total time: %f ms\tcount: %d\tcache misses: %d\tbranch misses: %d\n", { function.Load(totalTimePtr), function.Load(countPtr), function.Load(totalCacheMissesPtr), function.Load(totalBranchMissesPtr) });
 
         _module->EndFunction();
     }
@@ -429,8 +531,12 @@ namespace model
 
         auto countPtr = irBuilder.CreateInBoundsGEP(modelPerformanceCountersPtr, { function.Literal(0), function.Literal(0) });
         auto totalTimePtr = irBuilder.CreateInBoundsGEP(modelPerformanceCountersPtr, { function.Literal(0), function.Literal(1) });
+        auto totalCacheMissesPtr = irBuilder.CreateInBoundsGEP(modelPerformanceCountersPtr, { function.Literal(0), function.Literal(2) });
+        auto totalBranchMissesPtr = irBuilder.CreateInBoundsGEP(modelPerformanceCountersPtr, { function.Literal(0), function.Literal(3) });
         function.Store(countPtr, function.Literal<int64_t>(0));
         function.Store(totalTimePtr, function.Literal(0.0));
+        function.Store(totalCacheMissesPtr, function.Literal<int64_t>(0));
+        function.Store(totalBranchMissesPtr, function.Literal<int64_t>(0));
 
         _module->EndFunction();
     }
@@ -459,7 +565,9 @@ namespace model
 
             auto countPtr = irBuilder.CreateInBoundsGEP(nodePerformanceCountersPtr, { function.Literal(0), function.Literal(0) });
             auto totalTimePtr = irBuilder.CreateInBoundsGEP(nodePerformanceCountersPtr, { function.Literal(0), function.Literal(1) });
-            function.Printf("Node[%s]:\ttype: %s\ttime: %f ms\tcount: %d\n", { function.Load(namePtr), function.Load(typePtr), function.Load(totalTimePtr), function.Load(countPtr) });
+            auto totalCacheMissesPtr = irBuilder.CreateInBoundsGEP(nodePerformanceCountersPtr, { function.Literal(0), function.Literal(2) });
+            auto totalBranchMissesPtr = irBuilder.CreateInBoundsGEP(nodePerformanceCountersPtr, { function.Literal(0), function.Literal(3) });
+            function.Printf("Node[%s]:\ttype: %s\ttime: %f ms\tcount: %d\tcache misses: %d\tbranch misses: %d\n", { function.Load(namePtr), function.Load(typePtr), function.Load(totalTimePtr), function.Load(countPtr), function.Load(totalCacheMissesPtr), function.Load(totalBranchMissesPtr) });
         }
         loop.End();
 
@@ -488,13 +596,93 @@ namespace model
 
             auto countPtr = irBuilder.CreateInBoundsGEP(nodePerformanceCountersPtr, { function.Literal(0), function.Literal(0) });
             auto totalTimePtr = irBuilder.CreateInBoundsGEP(nodePerformanceCountersPtr, { function.Literal(0), function.Literal(1) });
-            function.Printf("type: %s\ttime: %f ms\tcount: %d\n", { function.Load(typePtr), function.Load(totalTimePtr), function.Load(countPtr) });
+            auto totalCacheMissesPtr = irBuilder.CreateInBoundsGEP(nodePerformanceCountersPtr, { function.Literal(0), function.Literal(2) });
+            auto totalBranchMissesPtr = irBuilder.CreateInBoundsGEP(nodePerformanceCountersPtr, { function.Literal(0), function.Literal(3) });
+            function.Printf("type: %s\ttime: %f ms\tcount: %d\tcache misses: %d\tbranch misses: %d\n", { function.Load(typePtr), function.Load(totalTimePtr), function.Load(countPtr), function.Load(totalCacheMissesPtr), function.Load(totalBranchMissesPtr) });
         }
         loop.End();
 
         _module->EndFunction();
     }
 
+    void ModelProfiler::EmitWriteProfilingMetricsFunction()
+    {
+        int numEmittedNodes = _nodePerformanceCounters.size();
+        int numEmittedNodeTypes = _nodeTypePerformanceCounters.size();
+        auto& emitter = _module->GetIREmitter();
+        auto& context = _module->GetLLVMContext();
+        auto& irBuilder = emitter.GetIRBuilder();
+        auto prefix = GetNamespacePrefix();
+
+        // One counter family per performance counter field, with the counters-struct field index
+        // and the printf conversion for that field's type
+        struct MetricFamily
+        {
+            std::string name;
+            int fieldIndex;
+            std::string format;
+        };
+        const std::vector<MetricFamily> families{
+            { "_profile_runs_total", 0, "%d" },
+            { "_profile_time_ms_total", 1, "%f" },
+            { "_profile_cache_misses_total", 2, "%d" },
+            { "_profile_branch_misses_total", 3, "%d" },
+        };
+
+        // Renders every counter in the Prometheus text exposition format, so a scrape agent can
+        // publish continuously-aggregated per-node latencies straight from a running process
+        auto voidType = llvm::Type::getVoidTy(context);
+        auto function = _module->BeginFunction(prefix + "_WriteProfilingMetrics", voidType, {});
+
+        function.Printf("# TYPE " + prefix + "_profile_invocations_total counter\n", {});
+        function.Printf(prefix + "_profile_invocations_total %d\n", { function.Load(_invocationCountVar) });
+
+        auto modelPerformanceCountersPtr = irBuilder.CreateInBoundsGEP(_modelPerformanceCountersArray, { function.Literal(0), function.Literal(0) });
+        for (const auto& family : families)
+        {
+            auto fieldPtr = irBuilder.CreateInBoundsGEP(modelPerformanceCountersPtr, { function.Literal(0), function.Literal(family.fieldIndex) });
+            function.Printf("# TYPE " + prefix + "_model" + family.name + " counter\n", {});
+            function.Printf(prefix + "_model" + family.name + " " + family.format + "\n", { function.Load(fieldPtr) });
+        }
+
+        for (const auto& family : families)
+        {
+            function.Printf("# TYPE " + prefix + "_node" + family.name + " counter\n", {});
+            auto loop = function.ForLoop();
+            loop.Begin(numEmittedNodes);
+            {
+                auto nodeIndex = loop.LoadIterationVariable();
+                auto nodeInfoPtr = irBuilder.CreateInBoundsGEP(_nodeInfoArray, { function.Literal(0), nodeIndex });
+                auto nodePerformanceCountersPtr = irBuilder.CreateInBoundsGEP(_nodePerformanceCountersArray, { function.Literal(0), nodeIndex });
+
+                auto namePtr = irBuilder.CreateGEP(nodeInfoPtr, { emitter.Literal(0), emitter.Literal(0) });
+                auto typePtr = irBuilder.CreateGEP(nodeInfoPtr, { emitter.Literal(0), emitter.Literal(1) });
+                auto fieldPtr = irBuilder.CreateInBoundsGEP(nodePerformanceCountersPtr, { function.Literal(0), function.Literal(family.fieldIndex) });
+                function.Printf(prefix + "_node" + family.name + "{node=\"%s\",type=\"%s\"} " + family.format + "\n", { function.Load(namePtr), function.Load(typePtr), function.Load(fieldPtr) });
+            }
+            loop.End();
+        }
+
+        for (const auto& family : families)
+        {
+            function.Printf("# TYPE " + prefix + "_node_type" + family.name + " counter\n", {});
+            auto loop = function.ForLoop();
+            loop.Begin(numEmittedNodeTypes);
+            {
+                auto nodeIndex = loop.LoadIterationVariable();
+                auto nodeInfoPtr = irBuilder.CreateInBoundsGEP(_nodeTypeInfoArray, { function.Literal(0), nodeIndex });
+                auto nodePerformanceCountersPtr = irBuilder.CreateInBoundsGEP(_nodeTypePerformanceCountersArray, { function.Literal(0), nodeIndex });
+
+                auto typePtr = irBuilder.CreateGEP(nodeInfoPtr, { emitter.Literal(0), emitter.Literal(1) });
+                auto fieldPtr = irBuilder.CreateInBoundsGEP(nodePerformanceCountersPtr, { function.Literal(0), function.Literal(family.fieldIndex) });
+                function.Printf(prefix + "_node_type" + family.name + "{type=\"%s\"} " + family.format + "\n", { function.Load(typePtr), function.Load(fieldPtr) });
+            }
+            loop.End();
+        }
+
+        _module->EndFunction();
+    }
+
     void ModelProfiler::EmitResetNodeProfilingInfoFunction()
     {
         int numEmittedNodes = _nodePerformanceCounters.size();
@@ -514,8 +702,12 @@ namespace model
 
             auto countPtr = irBuilder.CreateInBoundsGEP(nodePerformanceCountersPtr, { function.Literal(0), function.Literal(0) });
             auto totalTimePtr = irBuilder.CreateInBoundsGEP(nodePerformanceCountersPtr, { function.Literal(0), function.Literal(1) });
+            auto totalCacheMissesPtr = irBuilder.CreateInBoundsGEP(nodePerformanceCountersPtr, { function.Literal(0), function.Literal(2) });
+            auto totalBranchMissesPtr = irBuilder.CreateInBoundsGEP(nodePerformanceCountersPtr, { function.Literal(0), function.Literal(3) });
             function.Store(countPtr, function.Literal<int64_t>(0));
             function.Store(totalTimePtr, function.Literal(0.0));
+            function.Store(totalCacheMissesPtr, function.Literal<int64_t>(0));
+            function.Store(totalBranchMissesPtr, function.Literal<int64_t>(0));
         }
         nodeLoop.End();
 
@@ -541,8 +733,12 @@ namespace model
 
             auto countPtr = irBuilder.CreateInBoundsGEP(nodePerformanceCountersPtr, { function.Literal(0), function.Literal(0) });
             auto totalTimePtr = irBuilder.CreateInBoundsGEP(nodePerformanceCountersPtr, { function.Literal(0), function.Literal(1) });
+            auto totalCacheMissesPtr = irBuilder.CreateInBoundsGEP(nodePerformanceCountersPtr, { function.Literal(0), function.Literal(2) });
+            auto totalBranchMissesPtr = irBuilder.CreateInBoundsGEP(nodePerformanceCountersPtr, { function.Literal(0), function.Literal(3) });
             function.Store(countPtr, function.Literal<int64_t>(0));
             function.Store(totalTimePtr, function.Literal(0.0));
+            function.Store(totalCacheMissesPtr, function.Literal<int64_t>(0));
+            function.Store(totalBranchMissesPtr, function.Literal<int64_t>(0));
         }
         loop.End();
 
@@ -595,5 +791,17 @@ namespace model
         auto getTimeFunc = _module->GetRuntime().GetCurrentTimeFunction();
         return function.Call(getTimeFunc, {});
     }
+
+    llvm::Value* ModelProfiler::CallGetCacheMissCount(emitters::IRFunctionEmitter& function)
+    {
+        auto getCacheMissCountFunc = _module->GetRuntime().GetCacheMissCountFunction();
+        return function.Call(getCacheMissCountFunc, {});
+    }
+
+    llvm::Value* ModelProfiler::CallGetBranchMissCount(emitters::IRFunctionEmitter& function)
+    {
+        auto getBranchMissCountFunc = _module->GetRuntime().GetBranchMissCountFunction();
+        return function.Call(getBranchMissCountFunc, {});
+    }
 }
 }
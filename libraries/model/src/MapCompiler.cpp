@@ -10,6 +10,11 @@
 #include "CompilableNode.h"
 #include "CompilableNodeUtilities.h" // for PortTypeToVariableType
 #include "EmitterException.h"
+#include "NodeScheduler.h"
+
+// stl
+#include <algorithm>
+#include <sstream>
 
 namespace ell
 {
@@ -23,6 +28,17 @@ namespace model
 
     void MapCompiler::CompileMap(DynamicMap& map, const std::string& functionName)
     {
+        if (_parameters.foldConstants)
+        {
+            map.FoldConstants();
+        }
+
+        if (!_parameters.pipelineStageBoundaryNodes.empty())
+        {
+            CompilePipelinedMap(map, functionName);
+            return;
+        }
+
         auto pModuleEmitter = GetModuleEmitter();
 
         emitters::NamedVariableTypeList mainFunctionArguments = AllocateNodeFunctionArguments(map, *pModuleEmitter);
@@ -31,6 +47,20 @@ namespace model
         auto inputSize = map.GetInput(0)->Size();
         auto outputSize = map.GetOutput(0).Size();
         std::vector<std::string> comments = {std::string("Input size: ") + std::to_string(inputSize), std::string("Output size: ") + std::to_string(outputSize)};
+        if (_parameters.optimizeNodeOrder)
+        {
+            // schedule before planning buffers, so lifetimes (and arena reuse) follow the schedule
+            _nodeOrder = NodeScheduler::ScheduleNodes(map.GetModel());
+        }
+        if (_parameters.planBuffers)
+        {
+            PlanBuffers(map);
+            comments.push_back(std::string("Peak intermediate buffer memory: ") + std::to_string(_bufferPlan.GetArenaMemorySize()) + " bytes (" + std::to_string(_bufferPlan.GetUnsharedMemorySize()) + " bytes without reuse)");
+            if (_bufferPlan.GetNumRecomputedPorts() > 0)
+            {
+                comments.push_back(std::string("Recomputed activations: ") + std::to_string(_bufferPlan.GetNumRecomputedPorts()) + " ports (memory budget: " + std::to_string(_parameters.peakMemoryBudget) + " bytes)");
+            }
+        }
         pModuleEmitter->SetFunctionComments(functionName, comments);
 
         OnBeginCompileModel(map.GetModel());
@@ -40,22 +70,181 @@ namespace model
         pModuleEmitter->EndMapPredictFunction();
     }
 
-    void MapCompiler::CompileNodes(Model& model)
+    void MapCompiler::CompilePipelinedMap(DynamicMap& map, const std::string& functionName)
     {
-        model.Visit([this](const Node& node) {
-            if (!node.IsCompilable())
+        auto pModuleEmitter = GetModuleEmitter();
+        ComputePipelineStages(map.GetModel());
+        auto numStages = _pipelineStages.size();
+
+        // the map's outputs must be produced by the final stage, so that the synchronous wrapper
+        // and the queue-based API both find them in one place
+        for (auto outputElements : map.GetOutputs())
+        {
+            auto outputPort = outputElements.GetRanges()[0].ReferencedPort();
+            if (GetNodePipelineStage(*outputPort->GetNode()) != numStages - 1)
+            {
+                throw emitters::EmitterException(emitters::EmitterError::notSupported, "Map outputs must be produced by the final pipeline stage");
+            }
+        }
+
+        // every stage function gets the predict function's signature, so the input and output
+        // arguments resolve by name in whichever stage reads or writes them
+        emitters::NamedVariableTypeList mainFunctionArguments = AllocateNodeFunctionArguments(map, *pModuleEmitter);
+
+        // find the ports whose values cross from one stage to a later one; each consuming stage
+        // gets a private mirror variable, so a stage never reads a buffer that another stage (or
+        // another sample in flight) may be rewriting
+        for (size_t stage = 0; stage < numStages; ++stage)
+        {
+            for (auto node : _pipelineStages[stage])
+            {
+                for (auto input : node->GetInputPorts())
+                {
+                    for (const auto& range : input->GetInputElements().GetRanges())
+                    {
+                        auto port = range.ReferencedPort();
+                        auto producerStage = GetNodePipelineStage(*port->GetNode());
+                        if (producerStage != stage)
+                        {
+                            _pipelineCrossingPorts.insert(port);
+                            bool known = std::any_of(_pipelineBoundaryPorts.begin(), _pipelineBoundaryPorts.end(), [&](const PipelineBoundaryPort& boundaryPort) {
+                                return boundaryPort.port == port && boundaryPort.consumerStage == stage;
+                            });
+                            if (!known)
+                            {
+                                _pipelineBoundaryPorts.push_back({ port, producerStage, stage, nullptr, nullptr });
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        // compile one function per stage; nodes stay in the model's own visit order, so each stage
+        // is a contiguous, dependency-complete slice of the model
+        for (size_t stage = 0; stage < numStages; ++stage)
+        {
+            // rebind the ports this stage consumes from earlier stages to the stage's mirrors
+            for (auto& boundaryPort : _pipelineBoundaryPorts)
+            {
+                if (boundaryPort.consumerStage == stage)
+                {
+                    auto varType = PortTypeToVariableType(boundaryPort.port->GetType());
+                    boundaryPort.consumerVariable = pModuleEmitter->Variables().AddVectorVariable(emitters::VariableScope::global, varType, boundaryPort.port->Size());
+                    pModuleEmitter->AllocateVariable(*boundaryPort.consumerVariable);
+                    SetVariableForPort(*boundaryPort.port, boundaryPort.consumerVariable);
+                }
+            }
+
+            pModuleEmitter->BeginMapPredictFunction(functionName + "_stage" + std::to_string(stage), mainFunctionArguments);
+            for (auto node : _pipelineStages[stage])
+            {
+                CompileNode(*node);
+            }
+            pModuleEmitter->EndMapPredictFunction();
+
+            // capture where this stage left its boundary values, before any later stage rebinds them
+            for (auto& boundaryPort : _pipelineBoundaryPorts)
             {
-                std::string typeName = node.GetRuntimeTypeName();
-                throw emitters::EmitterException(emitters::EmitterError::notSupported, std::string("Uncompilable node type: " + typeName));
+                if (boundaryPort.producerStage == stage && boundaryPort.producerVariable == nullptr)
+                {
+                    boundaryPort.producerVariable = GetVariableForPort(*boundaryPort.port);
+                    assert(boundaryPort.producerVariable != nullptr);
+                }
             }
+        }
+
+        EmitPipelineFunctions(map, functionName, mainFunctionArguments);
+    }
 
-            auto compilableNode = const_cast<CompilableNode*>(dynamic_cast<const CompilableNode*>(&node));
-            assert(compilableNode != nullptr && "Got null compilable node");
+    void MapCompiler::ComputePipelineStages(Model& model)
+    {
+        _pipelineStages.clear();
+        _nodeStageMap.clear();
+        _pipelineStages.emplace_back();
 
-            OnBeginCompileNode(node);
-            compilableNode->CompileNode(*this);
-            OnEndCompileNode(node);
+        std::unordered_set<std::string> boundaries(_parameters.pipelineStageBoundaryNodes.begin(), _parameters.pipelineStageBoundaryNodes.end());
+        model.Visit([this, &boundaries](const Node& node) {
+            _nodeStageMap[&node] = _pipelineStages.size() - 1;
+            _pipelineStages.back().push_back(&node);
+            if (boundaries.erase(IdString(node)) > 0)
+            {
+                _pipelineStages.emplace_back();
+            }
         });
+
+        if (!boundaries.empty())
+        {
+            throw emitters::EmitterException(emitters::EmitterError::notSupported, "Pipeline stage boundary node not found in model: " + *boundaries.begin());
+        }
+        if (_pipelineStages.back().empty())
+        {
+            throw emitters::EmitterException(emitters::EmitterError::notSupported, "The model's last node cannot be a pipeline stage boundary");
+        }
+    }
+
+    size_t MapCompiler::GetNodePipelineStage(const Node& node) const
+    {
+        auto search = _nodeStageMap.find(&node);
+        assert(search != _nodeStageMap.end() && "Node not assigned to a pipeline stage");
+        return search->second;
+    }
+
+    void MapCompiler::EmitPipelineFunctions(DynamicMap& map, const std::string& functionName, emitters::NamedVariableTypeList& mainFunctionArguments)
+    {
+        throw emitters::EmitterException(emitters::EmitterError::notSupported, "This compiler does not support pipelined compilation");
+    }
+
+    void MapCompiler::CompileNodes(Model& model)
+    {
+        // before a node that reads recomputed ports, re-emit their producers: the producers'
+        // arena slots may have been reused since their last emission, and re-emitting refills
+        // them (the slot variable is the same, and a recomputed producer's own inputs are
+        // unplanned, so its operands are still valid -- see BufferPlanner)
+        auto compileWithRecompute = [this](const Node& node) {
+            std::unordered_set<const Node*> recomputedProducers;
+            for (auto inputPort : node.GetInputPorts())
+            {
+                for (const auto& range : inputPort->GetInputElements().GetRanges())
+                {
+                    auto port = range.ReferencedPort();
+                    auto producer = port->GetNode();
+                    if (producer != &node && _bufferPlan.IsRecomputed(*port) && recomputedProducers.insert(producer).second)
+                    {
+                        CompileNode(*producer);
+                    }
+                }
+            }
+            CompileNode(node);
+        };
+
+        if (!_nodeOrder.empty())
+        {
+            for (auto node : _nodeOrder)
+            {
+                compileWithRecompute(*node);
+            }
+        }
+        else
+        {
+            model.Visit(compileWithRecompute);
+        }
+    }
+
+    void MapCompiler::CompileNode(const Node& node)
+    {
+        if (!node.IsCompilable())
+        {
+            std::string typeName = node.GetRuntimeTypeName();
+            throw emitters::EmitterException(emitters::EmitterError::notSupported, std::string("Uncompilable node type: " + typeName));
+        }
+
+        auto compilableNode = const_cast<CompilableNode*>(dynamic_cast<const CompilableNode*>(&node));
+        assert(compilableNode != nullptr && "Got null compilable node");
+
+        OnBeginCompileNode(node);
+        compilableNode->CompileNode(*this);
+        OnEndCompileNode(node);
     }
 
     emitters::Variable* MapCompiler::AllocatePortVariable(const OutputPortBase& port)
@@ -65,11 +254,20 @@ namespace model
 
         emitters::VariableType varType = PortTypeToVariableType(port.GetType());
         emitters::Variable* pVar = nullptr;
-        bool isScalar = port.Size() == 1;
+        // a value that crosses a pipeline stage boundary must outlive the function that computes
+        // it, so it gets global storage even when scalar
+        bool crossesPipelineStage = _pipelineCrossingPorts.find(&port) != _pipelineCrossingPorts.end();
+        bool isScalar = port.Size() == 1 && !crossesPipelineStage;
         if (isScalar) // TODO: only do this if scope != output (or, only if scope == input or local?)
         {
             pVar = pModuleEmitter->Variables().AddScalarVariable(emitters::VariableScope::local, varType);
         }
+        else if (_bufferPlan.HasAllocation(port))
+        {
+            // the buffer plan assigned this port a slice of the shared arena for its type
+            auto allocation = _bufferPlan.GetAllocation(port);
+            pVar = pModuleEmitter->Variables().AddVectorRefVariable(varType, *_arenaVariables[port.GetType()], static_cast<int>(allocation.offset), static_cast<int>(allocation.size));
+        }
         else
         {
             pVar = pModuleEmitter->Variables().AddVectorVariable(emitters::VariableScope::global, varType, port.Size());
@@ -91,6 +289,40 @@ namespace model
         return pVar;
     }
 
+    void MapCompiler::PlanBuffers(DynamicMap& map)
+    {
+        auto pModuleEmitter = GetModuleEmitter();
+
+        // ports already bound to variables (the function arguments) keep their own storage
+        auto excludePort = [this](const OutputPortBase& port) {
+            return GetVariableForPort(port) != nullptr;
+        };
+
+        // nodes whose outputs may be recomputed at each consumer when over the memory budget,
+        // matched by full runtime type name or by the name without template arguments
+        auto isRecomputable = [this](const Node& node) {
+            auto typeName = node.GetRuntimeTypeName();
+            return _parameters.recomputableNodeTypes.count(typeName) != 0 ||
+                   _parameters.recomputableNodeTypes.count(typeName.substr(0, typeName.find('<'))) != 0;
+        };
+
+        auto nodeOrder = _nodeOrder;
+        if (nodeOrder.empty())
+        {
+            map.GetModel().Visit([&](const Node& node) { nodeOrder.push_back(&node); });
+        }
+        _bufferPlan = BufferPlanner::PlanBuffers(nodeOrder, excludePort, isRecomputable, _parameters.peakMemoryBudget);
+
+        // allocate one shared arena per port type; the planned ports become offset views into it
+        for (auto type : _bufferPlan.GetArenaTypes())
+        {
+            emitters::VariableType varType = PortTypeToVariableType(type);
+            auto pArenaVar = pModuleEmitter->Variables().AddVectorVariable(emitters::VariableScope::global, varType, static_cast<int>(_bufferPlan.GetArenaSize(type)));
+            pModuleEmitter->AllocateVariable(*pArenaVar);
+            _arenaVariables[type] = pArenaVar;
+        }
+    }
+
     //
     // Allocating variables for function arguments
     //
@@ -193,5 +425,21 @@ namespace model
     {
         _portToVarMaps.back()[element.ReferencedPort()] = pVar;
     }
+
+    emitters::QFormat MapCompiler::GetPortQFormat(const OutputPortBase& port) const
+    {
+        // the key scheme must match common::CalibrateQFormats
+        std::stringstream key;
+        key << port.GetNode()->GetId() << "." << port.GetName();
+        auto search = _parameters.portQFormats.find(key.str());
+        if (search != _parameters.portQFormats.end())
+        {
+            return search->second;
+        }
+
+        emitters::QFormat format;
+        format.wordBits = _parameters.compilerSettings.fixedPointWordBits;
+        return format;
+    }
 }
 }
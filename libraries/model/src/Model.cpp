@@ -11,8 +11,14 @@
 #include "Node.h"
 #include "Port.h"
 
+// utilities
+#include "ThreadPool.h"
+
 // stl
+#include <algorithm>
+#include <future>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace ell
 {
@@ -21,6 +27,14 @@ namespace model
     //
     // Model
     //
+    void Model::EnableArenaAllocation()
+    {
+        if (_arena == nullptr)
+        {
+            _arena = std::make_shared<utilities::MemoryArena>();
+        }
+    }
+
     Node* Model::GetNode(Node::NodeId id)
     {
         auto it = _idToNodeMap.find(id);
@@ -52,6 +66,150 @@ namespace model
         return NodeIterator(this, outputNodes);
     }
 
+    std::vector<const Node*> Model::GetDependencyOrder() const
+    {
+        std::vector<const Node*> order;
+        order.reserve(Size());
+        Visit([&order](const Node& node) { order.push_back(&node); });
+        return order;
+    }
+
+    void Model::InvalidateNode(const Node& node) const
+    {
+        // reverse traversal: walk the dependent lists from the edited node, marking everything
+        // downstream stale; nodes off that slice keep their cached outputs
+        std::unordered_set<const Node*> visited;
+        std::vector<const Node*> pending{ &node };
+        while (!pending.empty())
+        {
+            auto current = pending.back();
+            pending.pop_back();
+            if (!visited.insert(current).second)
+            {
+                continue;
+            }
+            current->InvalidateOutput();
+            for (auto dependent : current->GetDependentNodes())
+            {
+                pending.push_back(dependent);
+            }
+        }
+    }
+
+    void Model::ComputePlanParallel(const std::vector<const Node*>& dependencyOrder) const
+    {
+        auto& pool = utilities::GetThreadPool();
+        if (pool.NumThreads() < 2)
+        {
+            for (auto node : dependencyOrder)
+            {
+                node->Compute();
+            }
+            return;
+        }
+
+        // Count each node's remaining uncomputed parents, restricted to the nodes in the plan
+        // (parents outside the plan already hold valid cached outputs). Nodes with no such
+        // parents form the first wave of ready work.
+        std::unordered_set<const Node*> planNodes(dependencyOrder.begin(), dependencyOrder.end());
+        std::unordered_map<const Node*, size_t> remainingParents;
+        remainingParents.reserve(dependencyOrder.size());
+        std::vector<const Node*> ready;
+        for (auto node : dependencyOrder)
+        {
+            size_t numParents = 0;
+            for (auto parent : node->GetParentNodes())
+            {
+                if (planNodes.find(parent) != planNodes.end())
+                {
+                    ++numParents;
+                }
+            }
+            remainingParents[node] = numParents;
+            if (numParents == 0)
+            {
+                ready.push_back(node);
+            }
+        }
+
+        // A node's cost is estimated by the number of output values it produces. Ready nodes are
+        // packed into tasks of at least this estimated cost, so a wide wave of tiny nodes doesn't
+        // pay a dispatch round trip per node.
+        const size_t minimumTaskCost = 1024;
+        auto nodeCost = [](const Node* node) {
+            size_t cost = 0;
+            for (auto port : node->GetOutputPorts())
+            {
+                cost += port->Size();
+            }
+            return std::max<size_t>(cost, 1);
+        };
+
+        std::vector<const Node*> nextReady;
+        while (!ready.empty())
+        {
+            // greedily pack the wave into tasks; if it doesn't split into at least two tasks,
+            // there's no parallelism to exploit, so compute it inline
+            std::vector<std::vector<const Node*>> tasks(1);
+            size_t taskCost = 0;
+            for (auto node : ready)
+            {
+                if (taskCost >= minimumTaskCost)
+                {
+                    tasks.emplace_back();
+                    taskCost = 0;
+                }
+                tasks.back().push_back(node);
+                taskCost += nodeCost(node);
+            }
+
+            if (tasks.size() < 2)
+            {
+                for (auto node : ready)
+                {
+                    node->Compute();
+                }
+            }
+            else
+            {
+                // Concurrent node computations are independent: each node writes only its own
+                // output ports and reads only its parents' outputs, which earlier waves finished.
+                std::vector<std::future<void>> futures;
+                futures.reserve(tasks.size());
+                for (const auto& task : tasks)
+                {
+                    futures.push_back(pool.Submit([&task]() {
+                        for (auto node : task)
+                        {
+                            node->Compute();
+                        }
+                    }));
+                }
+                for (auto& future : futures)
+                {
+                    pool.Wait(future);
+                }
+            }
+
+            // the whole wave has completed, so the dependency bookkeeping can run unsynchronized
+            // on the calling thread
+            nextReady.clear();
+            for (auto node : ready)
+            {
+                std::unordered_set<const Node*> dependents(node->GetDependentNodes().begin(), node->GetDependentNodes().end());
+                for (auto dependent : dependents)
+                {
+                    auto it = remainingParents.find(dependent);
+                    if (it != remainingParents.end() && --(it->second) == 0)
+                    {
+                        nextReady.push_back(dependent);
+                    }
+                }
+            }
+            std::swap(ready, nextReady);
+        }
+    }
+
     void Model::WriteToArchive(utilities::Archiver& archiver) const
     {
         std::vector<const Node*> nodes;
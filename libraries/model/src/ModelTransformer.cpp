@@ -9,9 +9,16 @@
 #include "ModelTransformer.h"
 #include "InputNode.h"
 #include "Node.h"
+#include "OutputNode.h"
 
 // utilities
 #include "Exception.h"
+#include "JsonArchiver.h"
+
+// stl
+#include <sstream>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace ell
 {
@@ -125,6 +132,11 @@ namespace model
         _map[oldPort] = newElements;
     }
 
+    bool PortOutputsMap::HasMapping(const OutputPortBase* oldPort) const
+    {
+        return _map.find(oldPort) != _map.end();
+    }
+
     PortOutputsMap PortOutputsMap::ConcatenateMaps(const PortOutputsMap& prevMap, const PortOutputsMap& newMap)
     {
         PortOutputsMap result;
@@ -143,6 +155,10 @@ namespace model
     {
         _context = context;
         _model = Model();
+        if (oldModel.ArenaAllocationEnabled())
+        {
+            _model.EnableArenaAllocation();
+        }
         _elementsMap.Clear();
         oldModel.Visit([this](const Node& node) { node.InvokeCopy(*this); });
         _context = TransformContext();
@@ -154,6 +170,10 @@ namespace model
     {
         _context = context;
         _model = Model();
+        if (oldModel.ArenaAllocationEnabled())
+        {
+            _model.EnableArenaAllocation();
+        }
         _elementsMap.Clear();
         oldModel.VisitSubset(outputNode, [this](const Node& node) { node.InvokeCopy(*this); });
         _context = TransformContext();
@@ -165,6 +185,10 @@ namespace model
     {
         _context = context;
         _model = Model();
+        if (oldModel.ArenaAllocationEnabled())
+        {
+            _model.EnableArenaAllocation();
+        }
         _elementsMap.Clear();
         oldModel.VisitSubset(outputNodes, [this](const Node& node) { node.InvokeCopy(*this); });
         _context = TransformContext();
@@ -183,12 +207,23 @@ namespace model
         _model = std::move(oldModel);
         _elementsMap.Clear();
 
+        // Nodes known to be at their refinement fixed point. Refinement depends only on the node
+        // itself, so once a node declines to refine, all of its copies in later passes are stable
+        // too: they skip the action-function chain and the refine dispatch and are just copied
+        // forward. The set holds the current model's node ids and is rebuilt each pass with the ids
+        // of the stable nodes' copies.
+        std::unordered_set<Node::NodeId> stableNodes;
+
         // Refine until all nodes are compilable according to context.IsNodeCompilable(), until
         // the model is fully refined, or until the maximum number of iterations is reached.
         for (int i = 0; i < maxIterations; ++i)
         {
             Model currentModel = std::move(_model);
             _model = Model();
+            if (currentModel.ArenaAllocationEnabled())
+            {
+                _model.EnableArenaAllocation();
+            }
 
             auto previousElementMap = std::move(_elementsMap);
             _elementsMap = PortOutputsMap();
@@ -198,20 +233,39 @@ namespace model
             // Do one refinement pass
             // Note: as a side-effect, _elementsMap may be modified
             bool didRefineAny = false;
-            currentModel.Visit([this, &context, &didRefineAny](const Node& node) {
+            std::unordered_set<Node::NodeId> nextStableNodes;
+            currentModel.Visit([this, &context, &didRefineAny, &stableNodes, &nextStableNodes](const Node& node) {
                 bool didRefineNode = false;
-                auto action = context.GetNodeAction(node);
-                // If the node action is "refine" or the default, try to refine the node, otherwise leave it alone
-                if (action == NodeAction::refine || action == NodeAction::abstain)
+                if (stableNodes.find(node.GetId()) != stableNodes.end())
                 {
-                    didRefineNode = node.InvokeRefine(*this);
+                    // already at its fixed point: port it forward without revisiting
+                    node.InvokeCopy(*this);
                 }
                 else
                 {
-                    node.InvokeCopy(*this);
+                    auto action = context.GetNodeAction(node);
+                    // If the node action is "refine" or the default, try to refine the node, otherwise leave it alone
+                    if (action == NodeAction::refine || action == NodeAction::abstain)
+                    {
+                        didRefineNode = node.InvokeRefine(*this);
+                    }
+                    else
+                    {
+                        node.InvokeCopy(*this);
+                    }
+                }
+                if (!didRefineNode)
+                {
+                    // the node was copied one-to-one, so its copy is stable in the next pass
+                    auto newNode = GetCorrespondingCopiedNode(node);
+                    if (newNode != nullptr)
+                    {
+                        nextStableNodes.insert(newNode->GetId());
+                    }
                 }
                 didRefineAny |= didRefineNode;
             });
+            stableNodes = std::move(nextStableNodes);
 
             if (!previousElementMap.IsEmpty())
             {
@@ -233,6 +287,138 @@ namespace model
         return std::move(_model);
     }
 
+    namespace
+    {
+        // Only nodes that are pure functions of their inputs can be merged. Input and output nodes
+        // are excluded even though they're pure: they form the model's external interface and are
+        // referenced by identity from maps.
+        bool CanEliminateNode(const Node& node)
+        {
+            if (node.HasComputeState())
+            {
+                return false;
+            }
+            if (dynamic_cast<const InputNodeBase*>(&node) != nullptr || dynamic_cast<const OutputNodeBase*>(&node) != nullptr)
+            {
+                return false;
+            }
+            return true;
+        }
+
+        // A node's signature is its runtime type plus its archived state, which covers its
+        // parameters and its input port elements (referenced by the ids of their source nodes).
+        // The node's own id is masked out, so two otherwise-identical nodes get the same signature.
+        std::string GetNodeSignature(const Node& node)
+        {
+            std::stringstream stream;
+            utilities::JsonArchiver archiver(stream);
+            archiver.Archive(node);
+
+            auto signature = stream.str();
+            auto idPosition = signature.find("\"id\"");
+            if (idPosition != std::string::npos)
+            {
+                auto idEndPosition = signature.find_first_of(",\n}", idPosition);
+                if (idEndPosition != std::string::npos)
+                {
+                    signature.erase(idPosition, idEndPosition - idPosition);
+                }
+            }
+            return node.GetRuntimeTypeName() + signature;
+        }
+    }
+
+    Model ModelTransformer::EliminateCommonSubexpressions(Model oldModel, const TransformContext& context)
+    {
+        _context = context;
+        _model = std::move(oldModel);
+        _elementsMap.Clear();
+
+        // A node's signature references its inputs by the ids of their source nodes, so merging a
+        // pair of duplicates makes their consumers identical in the next pass. Iterate until a pass
+        // finds no duplicates; a chain of duplicated nodes of depth d converges in d passes.
+        bool didMergeAny = true;
+        while (didMergeAny)
+        {
+            didMergeAny = false;
+            Model currentModel = std::move(_model);
+            _model = Model();
+            if (currentModel.ArenaAllocationEnabled())
+            {
+                _model.EnableArenaAllocation();
+            }
+
+            auto previousElementMap = std::move(_elementsMap);
+            _elementsMap = PortOutputsMap();
+
+            // Do one elimination pass
+            // Note: as a side-effect, _elementsMap may be modified
+            std::unordered_map<std::string, const Node*> nodesBySignature;
+            currentModel.Visit([this, &didMergeAny, &nodesBySignature](const Node& node) {
+                if (!CanEliminateNode(node))
+                {
+                    node.InvokeCopy(*this);
+                    return;
+                }
+
+                auto signature = GetNodeSignature(node);
+                auto match = nodesBySignature.find(signature);
+                if (match == nodesBySignature.end())
+                {
+                    nodesBySignature[signature] = &node;
+                    node.InvokeCopy(*this);
+                    return;
+                }
+
+                // This node duplicates an earlier one: instead of copying it, map its outputs to
+                // the copy of the earlier node's outputs, so consumers are rewired to that copy.
+                const auto& representativeOutputs = match->second->GetOutputPorts();
+                const auto& nodeOutputs = node.GetOutputPorts();
+                for (size_t index = 0; index < nodeOutputs.size(); ++index)
+                {
+                    auto newElements = _elementsMap.GetCorrespondingPortElements(PortElementsBase(*representativeOutputs[index]));
+                    _elementsMap.MapNodeOutput(nodeOutputs[index], newElements);
+                }
+                didMergeAny = true;
+            });
+
+            if (!previousElementMap.IsEmpty())
+            {
+                // Now we have 2 maps, the previous one mapping A->B, and a new one mapping B->C (in _elementsMap).
+                // Concatenate them to get a map A->C, and keep it.
+                auto newElementsMap = PortOutputsMap::ConcatenateMaps(previousElementMap, _elementsMap);
+                _elementsMap = newElementsMap;
+            }
+        }
+
+        // clear out the context
+        _context = TransformContext();
+        return std::move(_model);
+    }
+
+    Model ModelTransformer::FoldConstants(const Model& model, const TransformContext& context)
+    {
+        _context = context;
+        _model = Model();
+        if (model.ArenaAllocationEnabled())
+        {
+            _model.EnableArenaAllocation();
+        }
+        _elementsMap.Clear();
+
+        // Nodes visit in dependency order, so each folded node becomes a constant in the new model
+        // before its consumers are visited, which in turn makes those consumers foldable.
+        model.Visit([this](const Node& node) {
+            if (!node.InvokeFold(*this))
+            {
+                node.InvokeCopy(*this);
+            }
+        });
+
+        _context = TransformContext();
+        return std::move(_model);
+    }
+
     Model ModelTransformer::TransformModel(const Model& model, const std::function<void(const Node&, ModelTransformer&)>& transformFunction, const TransformContext& context)
     {
         _context = context;
@@ -243,6 +429,28 @@ namespace model
         return std::move(_model);
     }
 
+    void ModelTransformer::CopyNode(const Node& node)
+    {
+        node.InvokeCopy(*this);
+    }
+
+    const Node* ModelTransformer::GetCorrespondingCopiedNode(const Node& node) const
+    {
+        const auto& outputPorts = node.GetOutputPorts();
+        if (outputPorts.empty() || !_elementsMap.HasMapping(outputPorts[0]))
+        {
+            return nullptr;
+        }
+
+        auto newElements = _elementsMap.GetCorrespondingPortElements(PortElementsBase(*outputPorts[0]));
+        const auto& ranges = newElements.GetRanges();
+        if (ranges.size() != 1)
+        {
+            return nullptr; // the output was rewired rather than copied one-to-one
+        }
+        return ranges[0].ReferencedPort()->GetNode();
+    }
+
     PortElementsBase ModelTransformer::TransformPortElements(const PortElementsBase& elements)
     {
         return _elementsMap.GetCorrespondingPortElements(elements);
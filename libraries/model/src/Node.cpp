@@ -164,6 +164,18 @@ namespace model
         return false;
     }
 
+    bool Node::InvokeFold(ModelTransformer& transformer) const
+    {
+        return Fold(transformer);
+    }
+
+    // Default implementation of Fold declines; unlike Refine, it doesn't copy the node, the
+    // folding pass does that for nodes that can't fold
+    bool Node::Fold(ModelTransformer& transformer) const
+    {
+        return false;
+    }
+
     void Node::Print(std::ostream& os) const
     {
         bool isFirstInputPort = true;
@@ -208,6 +220,44 @@ namespace model
         return false;
     }
 
+    bool Node::HasComputeState() const
+    {
+        return true;
+    }
+
+    void Node::ComputeIfInputsChanged() const
+    {
+        if (_outputComputed && !HasComputeState())
+        {
+            bool anyInputChanged = false;
+            for (const auto& input : _inputs)
+            {
+                for (const auto& parentNode : input->GetParentNodes())
+                {
+                    if (parentNode->OutputChanged())
+                    {
+                        anyInputChanged = true;
+                        break;
+                    }
+                }
+                if (anyInputChanged)
+                {
+                    break;
+                }
+            }
+
+            if (!anyInputChanged)
+            {
+                _outputChanged = false;
+                return;
+            }
+        }
+
+        Compute();
+        _outputComputed = true;
+        _outputChanged = true;
+    }
+
     void Node::WriteToArchive(utilities::Archiver& archiver) const
     {
         archiver["id"] << _id;
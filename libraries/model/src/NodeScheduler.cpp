@@ -0,0 +1,178 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     NodeScheduler.cpp (model)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "NodeScheduler.h"
+#include "InputPort.h"
+#include "OutputPort.h"
+
+// stl
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace ell
+{
+namespace model
+{
+    namespace
+    {
+        size_t GetPortByteSize(const OutputPortBase& port)
+        {
+            size_t elementSize = 0;
+            switch (port.GetType())
+            {
+                case Port::PortType::smallReal:
+                case Port::PortType::integer:
+                case Port::PortType::categorical:
+                    elementSize = 4;
+                    break;
+                case Port::PortType::real:
+                case Port::PortType::bigInt:
+                    elementSize = 8;
+                    break;
+                case Port::PortType::boolean:
+                    elementSize = 1;
+                    break;
+                default:
+                    break;
+            }
+            return port.Size() * elementSize;
+        }
+
+        // the distinct output ports a node reads from
+        std::unordered_set<const OutputPortBase*> GetReadPorts(const Node& node)
+        {
+            std::unordered_set<const OutputPortBase*> readPorts;
+            for (auto inputPort : node.GetInputPorts())
+            {
+                for (const auto& range : inputPort->GetInputElements().GetRanges())
+                {
+                    readPorts.insert(range.ReferencedPort());
+                }
+            }
+            return readPorts;
+        }
+    }
+
+    std::vector<const Node*> NodeScheduler::ScheduleNodes(const Model& model)
+    {
+        // the model's own order is the tie-breaker, so the schedule degrades gracefully to the
+        // order the compiler would have used anyway
+        std::vector<const Node*> topologicalOrder;
+        model.Visit([&](const Node& node) { topologicalOrder.push_back(&node); });
+
+        std::unordered_map<const Node*, size_t> topologicalIndex;
+        std::unordered_map<const Node*, size_t> unscheduledParents;
+        std::unordered_map<const OutputPortBase*, size_t> pendingReaders;
+        for (size_t index = 0; index < topologicalOrder.size(); ++index)
+        {
+            auto node = topologicalOrder[index];
+            topologicalIndex[node] = index;
+
+            std::unordered_set<const Node*> parents;
+            for (auto readPort : GetReadPorts(*node))
+            {
+                parents.insert(readPort->GetNode());
+                ++pendingReaders[readPort];
+            }
+            unscheduledParents[node] = parents.size();
+        }
+
+        std::vector<const Node*> ready;
+        for (auto node : topologicalOrder)
+        {
+            if (unscheduledParents[node] == 0)
+            {
+                ready.push_back(node);
+            }
+        }
+
+        std::vector<const Node*> schedule;
+        schedule.reserve(topologicalOrder.size());
+        const Node* lastScheduled = nullptr;
+        while (!ready.empty())
+        {
+            // pick the best ready node: prefer consumers of the node just emitted, then the node
+            // with the smallest increase (largest decrease) in live buffer bytes, then model order
+            size_t bestIndex = 0;
+            bool bestAdjacent = false;
+            int64_t bestFootprintDelta = 0;
+            for (size_t candidateIndex = 0; candidateIndex < ready.size(); ++candidateIndex)
+            {
+                auto candidate = ready[candidateIndex];
+                auto readPorts = GetReadPorts(*candidate);
+
+                bool adjacent = false;
+                int64_t footprintDelta = 0;
+                for (auto readPort : readPorts)
+                {
+                    if (readPort->GetNode() == lastScheduled)
+                    {
+                        adjacent = true;
+                    }
+                    if (pendingReaders[readPort] == 1 && readPort->Size() > 1)
+                    {
+                        footprintDelta -= static_cast<int64_t>(GetPortByteSize(*readPort));
+                    }
+                }
+                for (auto outputPort : candidate->GetOutputPorts())
+                {
+                    if (outputPort->Size() > 1)
+                    {
+                        footprintDelta += static_cast<int64_t>(GetPortByteSize(*outputPort));
+                    }
+                }
+
+                bool isBetter = false;
+                if (adjacent != bestAdjacent)
+                {
+                    isBetter = adjacent;
+                }
+                else if (footprintDelta != bestFootprintDelta)
+                {
+                    isBetter = footprintDelta < bestFootprintDelta;
+                }
+                else
+                {
+                    isBetter = topologicalIndex[candidate] < topologicalIndex[ready[bestIndex]];
+                }
+
+                if (candidateIndex == 0 || isBetter)
+                {
+                    bestIndex = candidateIndex;
+                    bestAdjacent = adjacent;
+                    bestFootprintDelta = footprintDelta;
+                }
+            }
+
+            auto chosen = ready[bestIndex];
+            ready.erase(ready.begin() + bestIndex);
+            schedule.push_back(chosen);
+            lastScheduled = chosen;
+
+            for (auto readPort : GetReadPorts(*chosen))
+            {
+                --pendingReaders[readPort];
+            }
+            // a node registers as a dependent once per input port that reads us, but it was
+            // counted as a single parent above, so decrement once per distinct dependent
+            std::unordered_set<const Node*> dependents(chosen->GetDependentNodes().begin(), chosen->GetDependentNodes().end());
+            for (auto dependent : dependents)
+            {
+                auto search = unscheduledParents.find(dependent);
+                if (search != unscheduledParents.end() && search->second > 0 && --(search->second) == 0)
+                {
+                    ready.push_back(dependent);
+                }
+            }
+        }
+
+        return schedule;
+    }
+}
+}
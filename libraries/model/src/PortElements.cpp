@@ -318,13 +318,13 @@ namespace model
     PortElementsBase::PortElementsBase(const PortElementBase& element)
     {
         _ranges.push_back(PortRange{ element });
-        _size = 1;
+        ComputeSize();
     }
 
     PortElementsBase::PortElementsBase(const PortRange& range)
     {
         _ranges.emplace_back(range);
-        _size = range.Size();
+        ComputeSize();
     }
 
     PortElementsBase::PortElementsBase(const std::vector<PortRange>& ranges)
@@ -355,6 +355,18 @@ namespace model
 
     void PortElementsBase::AddRange(const PortRange& range)
     {
+        // Update the cached contiguity info incrementally, so repeated appends stay O(1)
+        if (_ranges.empty())
+        {
+            _contiguousPort = range.ReferencedPort();
+            _contiguousStart = range.GetStartIndex();
+        }
+        else if (_contiguousPort != nullptr && (range.ReferencedPort() != _contiguousPort || range.GetStartIndex() != _contiguousStart + _size))
+        {
+            _contiguousPort = nullptr;
+            _contiguousStart = 0;
+        }
+
         // Check if range is contiguous with _ranges.back(), and if so, just add range.Size() to ranges.back()
         if(_ranges.size() > 0 && _ranges.back().IsAdjacent(range))
         {
@@ -369,6 +381,16 @@ namespace model
 
     PortElementBase PortElementsBase::GetElement(size_t index) const
     {
+        if (_contiguousPort != nullptr)
+        {
+            // fast path: the ranges cover a single contiguous run, so the element is just an offset
+            if (index >= _size)
+            {
+                throw utilities::InputException(utilities::InputExceptionErrors::indexOutOfRange, "index exceeds PortElements range");
+            }
+            return PortElementBase(*_contiguousPort, _contiguousStart + index);
+        }
+
         size_t sumRangeSizesSoFar = 0;
         for (const auto& range : _ranges)
         {
@@ -384,8 +406,15 @@ namespace model
     void PortElementsBase::ComputeSize()
     {
         _size = 0;
+        _contiguousPort = _ranges.empty() ? nullptr : _ranges[0].ReferencedPort();
+        _contiguousStart = _ranges.empty() ? 0 : _ranges[0].GetStartIndex();
         for (const auto& range : _ranges)
         {
+            if (range.ReferencedPort() == nullptr || range.ReferencedPort() != _contiguousPort || range.GetStartIndex() != _contiguousStart + _size)
+            {
+                _contiguousPort = nullptr;
+                _contiguousStart = 0;
+            }
             _size += range.Size();
         }
     }
@@ -28,6 +28,8 @@ namespace model
     template <typename OutputType, typename InputType, utilities::IsFundamental<OutputType>, utilities::IsFundamental<InputType>>
     std::vector<OutputType> DynamicMap::Compute(const std::vector<InputType>& inputValues) const
     {
+        static utilities::PerformanceProbe computeProbe("DynamicMap::Compute");
+        utilities::ScopedPerformanceProbe measure(computeProbe);
         SetInputValue(0, inputValues);
         return ComputeOutput<OutputType>(GetOutput(0));
     }
@@ -35,6 +37,8 @@ namespace model
     template <typename OutputVectorType, typename InputVectorType, data::IsDataVector<OutputVectorType>, data::IsDataVector<InputVectorType>>
     OutputVectorType DynamicMap::Compute(const InputVectorType& inputValues) const
     {
+        static utilities::PerformanceProbe computeProbe("DynamicMap::Compute");
+        utilities::ScopedPerformanceProbe measure(computeProbe);
         SetInputValue(GetInput(0), inputValues);
         return ComputeOutput<OutputVectorType>(GetOutput(0));
     }
@@ -168,6 +172,27 @@ namespace model
         }
     }
 
+    template <typename ValueType>
+    void DynamicMap::ComputeElements(const PortElementsBase& outputs, std::vector<ValueType>& outputValues) const
+    {
+        utilities::ScopedAllocationTag tag(utilities::AllocationTag::modelEvaluation);
+        EnsureDependencyOrder();
+        auto typedElements = PortElements<ValueType>(outputs);
+        if (_incrementalCompute)
+        {
+            _model.ComputeOutputIncremental(typedElements, outputValues, _dependencyOrder);
+        }
+        else if (_parallelCompute)
+        {
+            _model.ComputeOutputParallel(typedElements, outputValues, _dependencyOrder);
+        }
+        else
+        {
+            _model.ComputeOutput(typedElements, outputValues, _dependencyOrder);
+        }
+        utilities::RecordAllocation(outputValues.capacity() * sizeof(ValueType)); // approximate: counts the per-call output buffer, even when the caller reuses it
+    }
+
     // By index
     template <typename ValueType, utilities::IsFundamental<ValueType>>
     std::vector<ValueType> DynamicMap::ComputeOutput(int index) const
@@ -194,6 +219,83 @@ namespace model
         return ComputeOutput<DataVectorType>(GetOutput(outputName));
     }
 
+    // Into a caller-owned buffer
+    template <typename ValueType, utilities::IsFundamental<ValueType>>
+    void DynamicMap::ComputeOutput(int index, std::vector<ValueType>& outputValues) const
+    {
+        ComputeOutput(GetOutput(index), outputValues);
+    }
+
+    template <typename ValueType, utilities::IsFundamental<ValueType>>
+    void DynamicMap::ComputeOutput(const std::string& outputName, std::vector<ValueType>& outputValues) const
+    {
+        ComputeOutput(GetOutput(outputName), outputValues);
+    }
+
+    //
+    // Bound-port handles
+    //
+
+    template <typename ValueType>
+    BoundInput<ValueType> DynamicMap::BindInput(const std::string& inputName) const
+    {
+        auto node = dynamic_cast<InputNode<ValueType>*>(GetInput(inputName));
+        if (node == nullptr)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::typeMismatch);
+        }
+        return BoundInput<ValueType>(node);
+    }
+
+    template <typename ValueType>
+    BoundInput<ValueType> DynamicMap::BindInput(int index) const
+    {
+        auto node = dynamic_cast<InputNode<ValueType>*>(GetInput(index));
+        if (node == nullptr)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::typeMismatch);
+        }
+        return BoundInput<ValueType>(node);
+    }
+
+    template <typename ValueType>
+    BoundOutput<ValueType> DynamicMap::BindOutput(const std::string& outputName) const
+    {
+        auto elements = GetOutput(outputName);
+        if (elements.GetPortType() != Port::GetPortType<ValueType>())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::typeMismatch);
+        }
+        return BoundOutput<ValueType>(std::move(elements));
+    }
+
+    template <typename ValueType>
+    BoundOutput<ValueType> DynamicMap::BindOutput(int index) const
+    {
+        auto elements = GetOutput(index);
+        if (elements.GetPortType() != Port::GetPortType<ValueType>())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::typeMismatch);
+        }
+        return BoundOutput<ValueType>(std::move(elements));
+    }
+
+    template <typename ValueType>
+    void DynamicMap::SetInputValue(const BoundInput<ValueType>& input, const ValueType* inputValues, size_t numValues) const
+    {
+        if (numValues != input.Size())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::sizeMismatch);
+        }
+        input._node->SetInput(inputValues, inputValues + numValues);
+    }
+
+    template <typename ValueType>
+    void DynamicMap::ComputeOutput(const BoundOutput<ValueType>& output, std::vector<ValueType>& outputValues) const
+    {
+        ComputeOutput(output._elements, outputValues);
+    }
+
     template <typename ValueType>
     PortElements<ValueType> DynamicMap::GetOutputElements(size_t outputIndex) const
     {
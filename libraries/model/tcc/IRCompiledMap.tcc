@@ -10,6 +10,74 @@ namespace ell
 {
 namespace model
 {
+    template <typename InputType, typename OutputType>
+    void IRCompiledMap::ComputeBatch(const InputType* inputs, OutputType* outputs, int count) const
+    {
+        if (GetInput(0)->GetOutputPort().GetType() != model::Port::GetPortType<InputType>() || GetOutput(0).GetPortType() != model::Port::GetPortType<OutputType>())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::typeMismatch);
+        }
+        if (GetInput(0)->Size() == 1)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Batch compute isn't available for maps with scalar inputs");
+        }
+
+        EnsureExecutionEngine();
+        auto address = _batchFunctionAddress.load(std::memory_order_acquire);
+        if (address == 0)
+        {
+            // resolve once; gateway-style callers invoke this per request, possibly from several
+            // threads at once, so publish the address with a compare-exchange (resolution is
+            // idempotent - a racing thread just resolves the same address)
+            address = _executionEngine->ResolveFunctionAddress(_functionName + "_batch");
+            uint64_t expected = 0;
+            _batchFunctionAddress.compare_exchange_strong(expected, address, std::memory_order_release, std::memory_order_relaxed);
+        }
+        auto fn = reinterpret_cast<void (*)(const InputType*, OutputType*, int)>(address);
+        fn(inputs, outputs, count);
+    }
+
+    template <typename InputType, typename OutputType>
+    std::vector<OutputType> IRCompiledMap::ComputeBatch(const std::vector<InputType>& inputs) const
+    {
+        auto inputSize = GetInput(0)->Size();
+        int count = static_cast<int>(inputs.size() / inputSize);
+        std::vector<OutputType> outputs(count * GetOutput(0).Size());
+        ComputeBatch(inputs.data(), outputs.data(), count);
+        return outputs;
+    }
+
+    template <typename OutputType, typename InputType, utilities::IsFundamental<OutputType>, utilities::IsFundamental<InputType>>
+    std::vector<OutputType> IRCompiledMap::ComputeMultiThreaded(const std::vector<InputType>& inputValues) const
+    {
+        if (GetInput(0)->GetOutputPort().GetType() != model::Port::GetPortType<InputType>() || GetOutput(0).GetPortType() != model::Port::GetPortType<OutputType>())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::typeMismatch);
+        }
+
+        auto& context = GetThreadContext();
+
+        // Marshal through ConformingVectors so that bool inputs and outputs present contiguous storage
+        utilities::ConformingVector<InputType> input(inputValues.size());
+        std::copy(inputValues.begin(), inputValues.end(), input.begin());
+        utilities::ConformingVector<OutputType> output(GetOutput(0).Size());
+
+        if (GetInput(0)->Size() == 1)
+        {
+            // scalar input
+            auto fn = reinterpret_cast<void (*)(const InputType, OutputType*)>(context.functionAddress);
+            fn(input[0], (OutputType*)output.data());
+        }
+        else
+        {
+            // vector input
+            auto fn = reinterpret_cast<void (*)(const InputType*, OutputType*)>(context.functionAddress);
+            fn((const InputType*)input.data(), (OutputType*)output.data());
+        }
+
+        return std::vector<OutputType>(output.begin(), output.end());
+    }
+
     template <typename InputType>
     void IRCompiledMap::SetComputeFunctionForInputType() const
     {
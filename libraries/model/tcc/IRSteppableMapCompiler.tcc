@@ -79,7 +79,7 @@ namespace model
         {
             GetModule().AddPreprocessorDefinition(GetNamespacePrefix() + "_PROFILING", "1");
         }
-        _profiler = { GetModule(), map.GetModel(), GetMapCompilerParameters().profile };
+        _profiler = { GetModule(), map.GetModel(), GetMapCompilerParameters().profile, GetMapCompilerParameters().profileSampleInterval };
         _profiler.EmitInitialization();
 
         auto predictFunctionName = GetPredictFunctionName();
@@ -28,9 +28,24 @@ namespace model
     void InputNode<ValueType>::SetInput(std::vector<ValueType> inputValues)
     {
         assert(_output.Size() == inputValues.size());
+        if (inputValues != _inputValues)
+        {
+            InvalidateOutput();
+        }
         _inputValues = inputValues;
     }
 
+    template <typename ValueType>
+    void InputNode<ValueType>::SetInput(const ValueType* begin, const ValueType* end)
+    {
+        assert(_output.Size() == static_cast<size_t>(end - begin));
+        if (!std::equal(begin, end, _inputValues.begin(), _inputValues.end()))
+        {
+            InvalidateOutput();
+        }
+        _inputValues.assign(begin, end);
+    }
+
     template <typename ValueType>
     void InputNode<ValueType>::Compute() const
     {
@@ -51,6 +51,16 @@ namespace model
     {
         std::vector<ValueType> result;
         size_t size = Size();
+        if (_input.IsContiguous())
+        {
+            // fast path: the input is a contiguous slice of one port's output, so copy it wholesale
+            // instead of resolving each element through the range list
+            auto typedOutput = static_cast<const OutputPort<ValueType>*>(_input.GetContiguousPort());
+            auto start = typedOutput->GetOutput().begin() + _input.GetContiguousStartIndex();
+            result.assign(start, start + size);
+            return result;
+        }
+
         result.reserve(size);
         for (size_t index = 0; index < size; ++index)
         {
@@ -83,6 +93,17 @@ namespace model
         return typedOutput->GetOutput(element.GetIndex());
     }
 
+    template <typename ValueType>
+    const ValueType* InputPort<ValueType>::GetContiguousDataPointer() const
+    {
+        if (!_input.IsContiguous())
+        {
+            return nullptr;
+        }
+        auto typedOutput = static_cast<const OutputPort<ValueType>*>(_input.GetContiguousPort());
+        return typedOutput->GetOutput().data() + _input.GetContiguousStartIndex();
+    }
+
     template <typename ValueType>
     PortElements<ValueType> InputPort<ValueType>::GetPortElements() const
     {
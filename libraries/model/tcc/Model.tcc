@@ -42,7 +42,21 @@ namespace model
     template <typename NodeType, typename... Args>
     NodeType* Model::AddNode(Args&&... args)
     {
-        auto node = std::make_shared<NodeType>(std::forward<Args>(args)...);
+        std::shared_ptr<NodeType> node;
+        if (_arena != nullptr)
+        {
+            // bump-allocate the node (including its embedded port objects) from the arena. The
+            // deleter only runs the destructor - the storage itself is released wholesale when
+            // the last node sharing the arena goes away.
+            auto arena = _arena;
+            auto storage = arena->Allocate(sizeof(NodeType), alignof(NodeType));
+            node = std::shared_ptr<NodeType>(new (storage) NodeType(std::forward<Args>(args)...),
+                                             [arena](NodeType* n) { n->~NodeType(); });
+        }
+        else
+        {
+            node = std::make_shared<NodeType>(std::forward<Args>(args)...);
+        }
         node->RegisterDependencies();
         _idToNodeMap[node->GetId()] = node;
         return node.get();
@@ -61,6 +75,21 @@ namespace model
 
     template <typename ValueType>
     std::vector<ValueType> Model::ComputeOutput(const PortElements<ValueType>& elements) const
+    {
+        std::vector<ValueType> result;
+        ComputeOutput(elements, result);
+        return result;
+    }
+
+    template <typename ValueType>
+    std::vector<ValueType> Model::ComputeOutput(const PortElementsBase& elements) const
+    {
+        auto typedElements = PortElements<ValueType>(elements);
+        return ComputeOutput(typedElements);
+    }
+
+    template <typename ValueType>
+    void Model::ComputeOutput(const PortElements<ValueType>& elements, std::vector<ValueType>& output) const
     {
         // get set of nodes to make sure we visit
         std::unordered_set<const Node*> usedNodes;
@@ -73,24 +102,105 @@ namespace model
         auto nodes = std::vector<const Node*>(usedNodes.begin(), usedNodes.end());
         VisitSubset(nodes, compute);
 
-        // Now construct the output
-        auto numElements = elements.Size();
-        std::vector<ValueType> result(numElements);
-        for (size_t index = 0; index < numElements; ++index)
+        GatherOutput(elements, output);
+    }
+
+    template <typename ValueType>
+    void Model::ComputeOutput(const PortElementsBase& elements, std::vector<ValueType>& output) const
+    {
+        auto typedElements = PortElements<ValueType>(elements);
+        ComputeOutput(typedElements, output);
+    }
+
+    template <typename ValueType>
+    std::vector<ValueType> Model::ComputeOutputIncremental(const PortElements<ValueType>& elements) const
+    {
+        std::vector<ValueType> result;
+        ComputeOutputIncremental(elements, result);
+        return result;
+    }
+
+    template <typename ValueType>
+    std::vector<ValueType> Model::ComputeOutputIncremental(const PortElementsBase& elements) const
+    {
+        auto typedElements = PortElements<ValueType>(elements);
+        return ComputeOutputIncremental(typedElements);
+    }
+
+    template <typename ValueType>
+    void Model::ComputeOutputIncremental(const PortElements<ValueType>& elements, std::vector<ValueType>& output) const
+    {
+        // get set of nodes to make sure we visit
+        std::unordered_set<const Node*> usedNodes;
+        for (const auto& range : elements.GetRanges())
         {
-            auto element = elements.GetElement(index);
-            auto port = element.ReferencedPort();
-            auto portOutput = port->GetOutput()[element.GetIndex()];
-            result[index] = portOutput;
+            usedNodes.insert(range.ReferencedPort()->GetNode());
         }
-        return result;
+
+        auto compute = [](const Node& node) { node.ComputeIfInputsChanged(); };
+        auto nodes = std::vector<const Node*>(usedNodes.begin(), usedNodes.end());
+        VisitSubset(nodes, compute);
+
+        GatherOutput(elements, output);
     }
 
     template <typename ValueType>
-    std::vector<ValueType> Model::ComputeOutput(const PortElementsBase& elements) const
+    void Model::ComputeOutputIncremental(const PortElementsBase& elements, std::vector<ValueType>& output) const
     {
         auto typedElements = PortElements<ValueType>(elements);
-        return ComputeOutput(typedElements);
+        ComputeOutputIncremental(typedElements, output);
+    }
+
+    template <typename ValueType>
+    void Model::ComputeOutput(const PortElements<ValueType>& elements, std::vector<ValueType>& output, const std::vector<const Node*>& dependencyOrder) const
+    {
+        for (auto node : dependencyOrder)
+        {
+            node->Compute();
+        }
+        GatherOutput(elements, output);
+    }
+
+    template <typename ValueType>
+    void Model::ComputeOutputIncremental(const PortElements<ValueType>& elements, std::vector<ValueType>& output, const std::vector<const Node*>& dependencyOrder) const
+    {
+        for (auto node : dependencyOrder)
+        {
+            node->ComputeIfInputsChanged();
+        }
+        GatherOutput(elements, output);
+    }
+
+    template <typename ValueType>
+    void Model::ComputeOutputParallel(const PortElements<ValueType>& elements, std::vector<ValueType>& output, const std::vector<const Node*>& dependencyOrder) const
+    {
+        ComputePlanParallel(dependencyOrder);
+        GatherOutput(elements, output);
+    }
+
+    template <typename ValueType>
+    void Model::GatherOutput(const PortElements<ValueType>& elements, std::vector<ValueType>& output) const
+    {
+        // Construct the output, reusing the buffer's existing capacity when possible
+        auto numElements = elements.Size();
+        if (elements.IsContiguous())
+        {
+            // fast path: the elements are a contiguous slice of one port's output, so copy it
+            // wholesale instead of resolving each element through the range list
+            auto port = static_cast<const OutputPort<ValueType>*>(elements.GetContiguousPort());
+            auto start = port->GetOutput().begin() + elements.GetContiguousStartIndex();
+            output.assign(start, start + numElements);
+            return;
+        }
+
+        output.resize(numElements);
+        for (size_t index = 0; index < numElements; ++index)
+        {
+            auto element = elements.GetElement(index);
+            auto port = element.ReferencedPort();
+            auto portOutput = port->GetOutput()[element.GetIndex()];
+            output[index] = portOutput;
+        }
     }
 
     //
@@ -38,8 +38,10 @@ namespace model
         assert(GetPortVariableType(input) == GetPortVariableType(output));
 
         auto inputIsInputNode = (dynamic_cast<const InputNodeBase*>(input.GetInputElement(0).ReferencedPort()->GetNode()) != nullptr);
-        // TODO: re-enable this branch when scalar port bug is fixed 
-        if (IsPureVector(input) && input.Size() != 1 && output.Size() != 1 && !inputIsInputNode && false)
+        // a whole-port pass-through with no pre-assigned output variable (i.e., the output isn't
+        // bound to a function argument or a planned buffer) doesn't need a copy at all: alias the
+        // output to the source port's variable. Scalar ports keep the store path below.
+        if (IsPureVector(input) && input.Size() != 1 && output.Size() != 1 && !inputIsInputNode && compiler.GetVariableForPort(output) == nullptr)
         {
             auto pVar = compiler.GetVariableForElement(input.GetInputElement(0));
             compiler.SetVariableForPort(output, pVar);
@@ -59,17 +61,18 @@ namespace model
                 for (auto range : inputElements.GetRanges())
                 {
                     llvm::Value* pInput = compiler.EnsurePortEmitted(*range.ReferencedPort());
-                    auto forLoop = function.ForLoop();
-                    auto rangeSize = range.Size();
-                    forLoop.Begin(rangeSize);
+                    auto rangeSize = static_cast<int>(range.Size());
+                    if (rangeSize == 1)
                     {
-                        auto i = forLoop.LoadIterationVariable();
-                        auto inputIndex = function.Operator(emitters::TypedOperator::add, i, function.Literal<int>(range.GetStartIndex()));
-                        auto outputIndex = function.Operator(emitters::TypedOperator::add, i, function.Literal(rangeStart));
-                        llvm::Value* pValue = function.ValueAt(pInput, inputIndex);
-                        function.SetValueAt(pOutput, outputIndex, pValue);
+                        llvm::Value* pValue = function.ValueAt(pInput, function.Literal<int>(range.GetStartIndex()));
+                        function.SetValueAt(pOutput, function.Literal(rangeStart), pValue);
+                    }
+                    else
+                    {
+                        // each range is a contiguous span of its source port, so concatenation is a
+                        // memcpy per range; LLVM doesn't reliably idiom-recognize the element loop
+                        function.MemoryCopy<ValueType>(pInput, static_cast<int>(range.GetStartIndex()), pOutput, rangeStart, rangeSize);
                     }
-                    forLoop.End();
                     rangeStart += rangeSize;
                 }
             }
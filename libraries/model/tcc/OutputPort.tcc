@@ -42,7 +42,7 @@ namespace model
     template <typename ValueType>
     void OutputPort<ValueType>::SetOutput(std::vector<ValueType> values) const
     {
-        _cachedOutput = values;
+        _cachedOutput = std::move(values);
     }
 
     template <typename ValueType>
@@ -0,0 +1,135 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     SteppableMapRunner.tcc (model)
+//  Authors:  Lisa Ong
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ell
+{
+namespace model
+{
+    template <typename OutputType, typename ClockType>
+    SteppableMapRunner<OutputType, ClockType>::SteppableMapRunner(SteppableMap<ClockType>& map, size_t outputIndex)
+        : _map(map), _outputIndex(outputIndex), _interval(DurationType(map.GetIntervalTicks()))
+    {
+    }
+
+    template <typename OutputType, typename ClockType>
+    SteppableMapRunner<OutputType, ClockType>::~SteppableMapRunner()
+    {
+        Stop();
+    }
+
+    template <typename OutputType, typename ClockType>
+    void SteppableMapRunner<OutputType, ClockType>::Start()
+    {
+        if (_running)
+        {
+            return;
+        }
+        _running = true;
+        _numSteps = 0;
+        _numMissedDeadlines = 0;
+        _maxLatenessTicks = 0;
+        _thread = std::thread([this]() { Run(); });
+    }
+
+    template <typename OutputType, typename ClockType>
+    void SteppableMapRunner<OutputType, ClockType>::Stop()
+    {
+        _running = false;
+        if (_thread.joinable())
+        {
+            _thread.join();
+        }
+    }
+
+    template <typename OutputType, typename ClockType>
+    std::vector<OutputType> SteppableMapRunner<OutputType, ClockType>::GetResult() const
+    {
+        std::lock_guard<std::mutex> lock(_bufferMutex);
+        return _buffers[_frontBuffer];
+    }
+
+    template <typename OutputType, typename ClockType>
+    void SteppableMapRunner<OutputType, ClockType>::WaitUntil(const StepTimepointType& deadline)
+    {
+        if (_waitMode == RunnerWaitMode::sleep || _spinMargin.count() == 0)
+        {
+            std::this_thread::sleep_until(deadline);
+            return;
+        }
+
+        // Coarse phase: let the OS take us to just before the deadline, leaving the spin margin
+        // to absorb the scheduler's wakeup jitter
+        auto coarseDeadline = deadline - _spinMargin;
+        if (ClockType::now() < coarseDeadline)
+        {
+            std::this_thread::sleep_until(coarseDeadline);
+        }
+
+        // Fine phase: poll the clock in userspace (on mainstream platforms a steady_clock read is
+        // a vDSO/TSC read, not a syscall). While the deadline is still more than half the margin
+        // away, yield so a sibling thread can use the core; inside that window, spin.
+        auto yieldThreshold = deadline - _spinMargin / 2;
+        while (_running)
+        {
+            auto now = ClockType::now();
+            if (now >= deadline)
+            {
+                break;
+            }
+            if (now < yieldThreshold)
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    template <typename OutputType, typename ClockType>
+    void SteppableMapRunner<OutputType, ClockType>::Run()
+    {
+        auto deadline = ClockType::now();
+        while (_running)
+        {
+            deadline += _interval;
+            WaitUntil(deadline);
+            if (!_running)
+            {
+                break;
+            }
+
+            // compute into the back buffer; the map's own Step loop handles catching up if the
+            // wakeup was late enough to span several intervals
+            int backBuffer = 1 - _frontBuffer;
+            _map.template ComputeOutput<OutputType>(static_cast<int>(_outputIndex), _buffers[backBuffer]);
+
+            // the map returns an empty result if the wakeup raced ahead of the interval; don't
+            // overwrite the last published result in that case
+            if (!_buffers[backBuffer].empty())
+            {
+                std::lock_guard<std::mutex> lock(_bufferMutex);
+                _frontBuffer = backBuffer;
+                ++_numSteps;
+            }
+
+            // deadline accounting: if the compute overran the next deadline, record the lateness
+            // and re-anchor the schedule to now, so one slow step doesn't make every following
+            // step count as late too
+            auto now = ClockType::now();
+            if (now > deadline + _interval)
+            {
+                ++_numMissedDeadlines;
+                auto lateness = std::chrono::duration_cast<DurationType>(now - (deadline + _interval)).count();
+                if (lateness > _maxLatenessTicks)
+                {
+                    _maxLatenessTicks = lateness;
+                }
+                deadline = now;
+            }
+        }
+    }
+}
+}
@@ -23,6 +23,7 @@ void TestBinaryVector(bool expanded, bool runJit = false);
 void TestBinaryScalar();
 void TestDotProduct();
 void TestSimpleSum(bool expanded, bool optimize = false);
+void TestUnrollLimit();
 void TestSum(bool expanded, bool optimize = false);
 void TestAccumulator(bool expanded);
 void TestDelay();
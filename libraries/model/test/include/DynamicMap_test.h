@@ -9,7 +9,14 @@
 
 void TestDynamicMapCreate();
 void TestDynamicMapCompute();
+void TestDynamicMapComputeBuffered();
+void TestDynamicMapBoundHandles();
 void TestDynamicMapComputeDataVector();
+void TestDynamicMapIncrementalCompute();
 void TestDynamicMapRefine();
+void TestDynamicMapCachedIterationPlan();
+void TestDynamicMapExtractSubmap();
+void TestDynamicMapSharedModel();
 void TestDynamicMapSerialization();
 void TestSteppableMapCompute();
+void TestSteppableMapRunner();
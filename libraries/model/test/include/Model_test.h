@@ -18,4 +18,7 @@ void TestInputRouting2();
 void TestCopyModel();
 
 void TestRefineSplitOutputs();
+void TestEliminateCommonSubexpressions();
+void TestFoldConstants();
 void TestCustomRefine();
+void TestModelInvalidateNode();
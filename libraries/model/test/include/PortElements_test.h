@@ -9,4 +9,5 @@
 
 void TestSlice();
 void TestAppend();
+void TestContiguity();
 void TestParsePortElements();
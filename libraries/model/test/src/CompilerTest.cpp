@@ -316,6 +316,35 @@ void TestSimpleSum(bool expanded, bool optimized)
     PrintDiagnostics(compiledMap.GetModule().GetDiagnosticHandler());
 }
 
+void TestUnrollLimit()
+{
+    const int size = 16;
+    ModelMaker mb;
+    auto input1 = mb.Inputs<double>(size);
+    auto sumNode = mb.Sum<double>(input1->output);
+    model::DynamicMap map{ mb.Model, { { "input", input1 } }, { { "output", sumNode->output } } };
+
+    // unrolling is requested, but the port is wider than the limit, so the loop must survive and
+    // still compute the right answer
+    model::MapCompilerParameters settings;
+    settings.compilerSettings.unrollLoops = true;
+    settings.compilerSettings.unrollLimit = 4;
+    model::IRMapCompiler compiler(settings);
+    model::IRCompiledMap compiledMap = compiler.Compile(map);
+    PrintIR(compiledMap);
+
+    std::vector<std::vector<double>> signal{ { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 } };
+    VerifyCompiledOutput(map, compiledMap, signal, "SumNode with unrollLimit");
+
+    // a code-size budget caps unrolling on its own, with no explicit limit set
+    model::MapCompilerParameters budgetSettings;
+    budgetSettings.compilerSettings.unrollLoops = true;
+    budgetSettings.codeSizeBudget = 256 * 1024;
+    model::IRMapCompiler budgetCompiler(budgetSettings);
+    model::IRCompiledMap budgetCompiledMap = budgetCompiler.Compile(map);
+    VerifyCompiledOutput(map, budgetCompiledMap, signal, "SumNode with codeSizeBudget");
+}
+
 void TestSum(bool expanded, bool optimized)
 {
     std::vector<double> data = { 5, 10, 15, 20 };
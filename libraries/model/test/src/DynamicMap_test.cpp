@@ -19,6 +19,7 @@
 #include "OutputNode.h"
 #include "PortElements.h"
 #include "SteppableMap.h"
+#include "SteppableMapRunner.h"
 
 // nodes
 #include "ExtremalValueNode.h"
@@ -83,6 +84,75 @@ void TestDynamicMapCompute()
     testing::ProcessTest("Testing map compute 1", testing::IsEqual(resultValues[0], 8.5) && testing::IsEqual(resultValues[1], 10.5));
 }
 
+void TestDynamicMapComputeBuffered()
+{
+    auto model = GetSimpleModel();
+    auto inputNodes = model.GetNodesByType<model::InputNode<double>>();
+    auto outputNodes = model.GetNodesByType<model::OutputNode<double>>();
+    auto map = model::DynamicMap(model, { { "doubleInput", inputNodes[0] } }, { { "doubleOutput", outputNodes[0]->output } });
+
+    auto input = std::vector<std::vector<double>>{ { 1.0, 2.0, 3.0 },
+                                                   { 4.0, 5.0, 6.0 },
+                                                   { 7.0, 8.0, 9.0 },
+                                                   { 10.0, 11.0, 12.0 } };
+
+    // The caller-owned buffer is reused across calls; after the first call, computing into it
+    // shouldn't allocate
+    std::vector<double> resultValues;
+    for (const auto& inVec : input)
+    {
+        map.SetInputValue("doubleInput", inVec);
+        map.ComputeOutput("doubleOutput", resultValues);
+    }
+
+    testing::ProcessTest("Testing buffered map compute", testing::IsEqual(resultValues[0], 8.5) && testing::IsEqual(resultValues[1], 10.5));
+
+    // Buffers larger than the output shrink to fit without reallocating
+    std::vector<double> oversizedBuffer(100);
+    auto originalCapacity = oversizedBuffer.capacity();
+    map.SetInputValue("doubleInput", input.back());
+    map.ComputeOutput("doubleOutput", oversizedBuffer);
+    testing::ProcessTest("Testing buffered map compute buffer reuse", oversizedBuffer.size() == 2 && oversizedBuffer.capacity() == originalCapacity && testing::IsEqual(oversizedBuffer[0], 8.5));
+}
+
+void TestDynamicMapBoundHandles()
+{
+    auto model = GetSimpleModel();
+    auto inputNodes = model.GetNodesByType<model::InputNode<double>>();
+    auto outputNodes = model.GetNodesByType<model::OutputNode<double>>();
+    auto map = model::DynamicMap(model, { { "doubleInput", inputNodes[0] } }, { { "doubleOutput", outputNodes[0]->output } });
+
+    // resolve the names once, then drive the map through the handles
+    auto boundInput = map.BindInput<double>("doubleInput");
+    auto boundOutput = map.BindOutput<double>("doubleOutput");
+    testing::ProcessTest("Testing bound handle validity", boundInput.IsValid() && boundOutput.IsValid() && boundInput.Size() == 3 && boundOutput.Size() == 2);
+
+    auto input = std::vector<std::vector<double>>{ { 1.0, 2.0, 3.0 },
+                                                   { 4.0, 5.0, 6.0 },
+                                                   { 7.0, 8.0, 9.0 },
+                                                   { 10.0, 11.0, 12.0 } };
+    std::vector<double> resultValues;
+    for (const auto& inVec : input)
+    {
+        map.SetInputValue(boundInput, inVec.data(), inVec.size());
+        map.ComputeOutput(boundOutput, resultValues);
+    }
+
+    testing::ProcessTest("Testing bound handle compute", testing::IsEqual(resultValues[0], 8.5) && testing::IsEqual(resultValues[1], 10.5));
+
+    // binding with the wrong type is rejected at bind time
+    bool threw = false;
+    try
+    {
+        map.BindInput<int>("doubleInput");
+    }
+    catch (const utilities::InputException&)
+    {
+        threw = true;
+    }
+    testing::ProcessTest("Testing bound handle type check", threw);
+}
+
 void TestDynamicMapComputeDataVector()
 {
     auto model = GetSimpleModel();
@@ -108,6 +178,52 @@ void TestDynamicMapComputeDataVector()
     testing::ProcessTest("Testing map compute 2", testing::IsEqual(resultValues[0], 8.5) && testing::IsEqual(resultValues[1], 10.5));
 }
 
+void TestDynamicMapIncrementalCompute()
+{
+    // Incremental compute must match regular compute, including on stateful nodes (the simple
+    // model contains moving averages, which must be recomputed even when the input repeats)
+    auto model = GetSimpleModel();
+    auto inputNodes = model.GetNodesByType<model::InputNode<double>>();
+    auto outputNodes = model.GetNodesByType<model::OutputNode<double>>();
+    auto map = model::DynamicMap(model, { { "doubleInput", inputNodes[0] } }, { { "doubleOutput", outputNodes[0]->output } });
+    auto referenceMap = model::DynamicMap(model, { { "doubleInput", inputNodes[0] } }, { { "doubleOutput", outputNodes[0]->output } });
+    map.SetIncrementalCompute(true);
+
+    auto signal = std::vector<std::vector<double>>{ { 1.0, 2.0, 3.0 },
+                                                    { 4.0, 5.0, 6.0 },
+                                                    { 4.0, 5.0, 6.0 }, // repeated inputs
+                                                    { 4.0, 5.0, 6.0 },
+                                                    { 7.0, 8.0, 9.0 } };
+    bool ok = true;
+    for (const auto& inVec : signal)
+    {
+        map.SetInputValue("doubleInput", inVec);
+        referenceMap.SetInputValue("doubleInput", inVec);
+        ok = ok && testing::IsEqual(map.ComputeOutput<double>("doubleOutput"), referenceMap.ComputeOutput<double>("doubleOutput"));
+    }
+    testing::ProcessTest("Testing incremental map compute", ok);
+
+    // A stateless model should skip recomputation entirely when the input is unchanged
+    model::Model pureModel;
+    auto pureInputNode = pureModel.AddNode<model::InputNode<double>>(3);
+    auto pureOutputNode = pureModel.AddNode<model::OutputNode<double>>(pureInputNode->output);
+    auto pureMap = model::DynamicMap(pureModel, { { "in", pureInputNode } }, { { "out", pureOutputNode->output } });
+    pureMap.SetIncrementalCompute(true);
+
+    pureMap.SetInputValue("in", std::vector<double>{ 1.0, 2.0, 3.0 });
+    auto result1 = pureMap.ComputeOutput<double>("out");
+    pureMap.SetInputValue("in", std::vector<double>{ 1.0, 2.0, 3.0 });
+    auto result2 = pureMap.ComputeOutput<double>("out");
+    auto mapOutputNodes = pureMap.GetModel().GetNodesByType<model::OutputNode<double>>();
+    bool skipped = !mapOutputNodes[0]->OutputChanged();
+
+    pureMap.SetInputValue("in", std::vector<double>{ 4.0, 5.0, 6.0 });
+    auto result3 = pureMap.ComputeOutput<double>("out");
+    bool recomputed = mapOutputNodes[0]->OutputChanged();
+
+    testing::ProcessTest("Testing incremental map compute skipping", testing::IsEqual(result1, result2) && skipped && testing::IsEqual(result3, std::vector<double>{ 4.0, 5.0, 6.0 }) && recomputed);
+}
+
 void TestDynamicMapRefine()
 {
     auto model = GetSimpleModel();
@@ -140,6 +256,99 @@ void TestDynamicMapRefine()
     testing::ProcessTest("Testing refined map compute", testing::IsEqual(resultValues1, resultValues2));
 }
 
+void TestDynamicMapCachedIterationPlan()
+{
+    // The map caches its model's nodes in dependency order and replays that plan on every compute.
+    // Mutating the model mid-stream must invalidate the plan, so computes after a refinement walk
+    // the new model's nodes rather than stale pointers. A stateless model is used so results are
+    // predictable across the refinement.
+    model::Model model;
+    auto inputNode = model.AddNode<model::InputNode<double>>(3);
+    auto outputNode = model.AddNode<model::OutputNode<double>>(inputNode->output);
+    auto map = model::DynamicMap(model, { { "in", inputNode } }, { { "out", outputNode->output } });
+
+    auto signal = std::vector<std::vector<double>>{ { 1.0, 2.0, 3.0 },
+                                                    { 4.0, 5.0, 6.0 },
+                                                    { 7.0, 8.0, 9.0 },
+                                                    { 10.0, 11.0, 12.0 } };
+    bool ok = true;
+    for (size_t index = 0; index < signal.size(); ++index)
+    {
+        if (index == signal.size() / 2)
+        {
+            // replaces the wrapped model, invalidating the cached plan
+            model::TransformContext context;
+            map.Refine(context);
+        }
+        map.SetInputValue("in", signal[index]);
+        ok = ok && testing::IsEqual(map.ComputeOutput<double>("out"), signal[index]);
+    }
+    testing::ProcessTest("Testing cached iteration plan", ok);
+}
+
+void TestDynamicMapExtractSubmap()
+{
+    // two-stage model: a cheap "front half" that just forwards the input, and a more expensive
+    // tail hanging off it; extracting the front output should slice away the tail
+    model::Model model;
+    auto inputNode = model.AddNode<model::InputNode<double>>(3);
+    auto frontNode = model.AddNode<model::OutputNode<double>>(inputNode->output);
+    auto tailNode = model.AddNode<nodes::MovingAverageNode<double>>(frontNode->output, 4);
+    auto fullOutputNode = model.AddNode<model::OutputNode<double>>(tailNode->output);
+    auto map = model::DynamicMap(model, { { "in", inputNode } }, { { "front", frontNode->output }, { "full", fullOutputNode->output } });
+
+    auto submap = map.ExtractSubmap({ "front" });
+    testing::ProcessTest("Testing ExtractSubmap prunes the tail", submap.GetModel().Size() < map.GetModel().Size());
+    testing::ProcessTest("Testing ExtractSubmap inputs", submap.NumInputPorts() == 1 && submap.GetInputSize() == 3);
+    testing::ProcessTest("Testing ExtractSubmap outputs", submap.NumOutputPorts() == 1);
+
+    // the sub-map computes the front half by itself
+    std::vector<double> input{ 1.0, 2.0, 3.0 };
+    submap.SetInputValue("in", input);
+    testing::ProcessTest("Testing ExtractSubmap compute", testing::IsEqual(submap.ComputeOutput<double>("front"), input));
+
+    // the original map is untouched and still computes the full graph
+    map.SetInputValue("in", input);
+    testing::ProcessTest("Testing ExtractSubmap leaves original intact", map.ComputeOutput<double>("full").size() == 3);
+}
+
+void TestDynamicMapSharedModel()
+{
+    auto model = GetSimpleModel();
+    auto inputNodes = model.GetNodesByType<model::InputNode<double>>();
+    auto outputNodes = model.GetNodesByType<model::OutputNode<double>>();
+
+    // a regular map deep-copies the model; the reference for comparing results below
+    auto referenceMap = model::DynamicMap(model, { { "doubleInput", inputNodes[0] } }, { { "doubleOutput", outputNodes[0]->output } });
+
+    auto map1 = model::DynamicMap::FromSharedModel(model, { { "doubleInput", inputNodes[0] } }, { { "doubleOutput", outputNodes[0]->output } });
+    auto map2 = map1; // copies of a shared map share as well
+
+    testing::ProcessTest("Testing shared map flags", map1.IsModelShared() && map2.IsModelShared());
+
+    // shared maps bind the original model's nodes directly, with no node duplication
+    testing::ProcessTest("Testing shared map node identity", map1.GetInput(0) == inputNodes[0] && map2.GetInput(0) == inputNodes[0]);
+
+    // the model has stateful nodes and the shared maps share their state, so computing through
+    // map1 then map2 must match computing the same sequence through one private map
+    auto input1 = std::vector<double>{ 1.0, 2.0, 3.0 };
+    auto input2 = std::vector<double>{ 4.0, 5.0, 6.0 };
+    referenceMap.SetInputValue("doubleInput", input1);
+    auto reference1 = referenceMap.ComputeOutput<double>("doubleOutput");
+    referenceMap.SetInputValue("doubleInput", input2);
+    auto reference2 = referenceMap.ComputeOutput<double>("doubleOutput");
+
+    map1.SetInputValue("doubleInput", input1);
+    auto result1 = map1.ComputeOutput<double>("doubleOutput");
+    map2.SetInputValue("doubleInput", input2);
+    auto result2 = map2.ComputeOutput<double>("doubleOutput");
+    testing::ProcessTest("Testing shared map compute", testing::IsEqual(result1, reference1) && testing::IsEqual(result2, reference2));
+
+    // a transformation gives the map a private model, leaving the other shared map untouched
+    map2.Refine();
+    testing::ProcessTest("Testing shared map goes private on refine", !map2.IsModelShared() && map1.IsModelShared() && map1.GetInput(0) == inputNodes[0]);
+}
+
 void TestDynamicMapSerialization()
 {
     auto model = GetSimpleModel();
@@ -215,3 +424,54 @@ void TestSteppableMapCompute()
     testing::ProcessTest("Testing steppable dynamic map compute (late)", testing::IsEqual(resultValues.size(), size_t(2)));
     std::cout << "Results count: " << resultValues.size() << std::endl;
 }
+
+InputCallbackTester<double> g_runnerDataCallbackTester;
+bool TestSteppableMapRunner_DataCallback(std::vector<double>& input)
+{
+    return g_runnerDataCallbackTester.InputCallback(input);
+}
+void TestSteppableMapRunner()
+{
+    model::Model model;
+    auto in = model.AddNode<model::InputNode<model::TimeTickType>>(2); // time signal
+    auto source = model.AddNode<nodes::SourceNode<double, &TestSteppableMapRunner_DataCallback>>(in->output, 3); // data signal
+    auto mean = model.AddNode<nodes::MovingAverageNode<double>>(source->output, 2);
+    auto output = model.AddNode<model::OutputNode<double>>(mean->output);
+
+    std::chrono::milliseconds interval(50);
+    auto map = model::SteppableMap<std::chrono::steady_clock>(
+        model,
+        { { "timeSignal", in } },
+        { { "doubleOutput", output->output } },
+        interval);
+
+    auto dataSignal = std::vector<std::vector<double>>{ { 1.0, 2.0, 3.0 },
+                                                        { 4.0, 5.0, 6.0 },
+                                                        { 7.0, 8.0, 9.0 },
+                                                        { 10.0, 11.0, 12.0 } };
+    g_runnerDataCallbackTester.Initialize(dataSignal);
+
+    model::SteppableMapRunner<double> runner(map);
+    runner.Start();
+    testing::ProcessTest("Testing steppable map runner (running)", runner.IsRunning());
+
+    // give the execution thread a few intervals, then read a result without stopping it
+    std::this_thread::sleep_for(interval * 4);
+    auto resultValues = runner.GetResult();
+    testing::ProcessTest("Testing steppable map runner (result available)", testing::IsEqual(resultValues.size(), size_t(3)));
+
+    runner.Stop();
+    testing::ProcessTest("Testing steppable map runner (stopped)", !runner.IsRunning());
+    std::cout << "Runner steps: " << runner.GetNumSteps() << ", missed deadlines: " << runner.GetNumMissedDeadlines() << std::endl;
+    testing::ProcessTest("Testing steppable map runner (stepped)", runner.GetNumSteps() >= 2);
+
+    // run again with the low-latency spin wait
+    g_runnerDataCallbackTester.Initialize(dataSignal);
+    model::SteppableMapRunner<double> spinRunner(map);
+    spinRunner.SetWaitMode(model::RunnerWaitMode::spin);
+    spinRunner.SetSpinMargin(std::chrono::microseconds(500));
+    spinRunner.Start();
+    std::this_thread::sleep_for(interval * 4);
+    spinRunner.Stop();
+    testing::ProcessTest("Testing steppable map runner (spin wait stepped)", spinRunner.GetNumSteps() >= 2);
+}
@@ -18,6 +18,7 @@
 #include "OutputPort.h"
 
 // nodes
+#include "BinaryOperationNode.h"
 #include "ConstantNode.h"
 #include "DotProductNode.h"
 #include "ExtremalValueNode.h"
@@ -330,6 +331,82 @@ void TestRefineSplitOutputs()
     }
 }
 
+void TestEliminateCommonSubexpressions()
+{
+    // Create a model with two identical stateless subexpressions
+    model::Model model;
+    auto inputNode = model.AddNode<model::InputNode<double>>(2);
+    auto constantNode1 = model.AddNode<nodes::ConstantNode<double>>(std::vector<double>{ 1.0, 2.0 });
+    auto constantNode2 = model.AddNode<nodes::ConstantNode<double>>(std::vector<double>{ 1.0, 2.0 });
+    auto dotNode1 = model.AddNode<nodes::DotProductNode<double>>(inputNode->output, constantNode1->output);
+    auto dotNode2 = model.AddNode<nodes::DotProductNode<double>>(inputNode->output, constantNode2->output);
+
+    model::TransformContext context;
+    model::ModelTransformer transformer;
+    auto newModel = transformer.EliminateCommonSubexpressions(model, context);
+
+    // The duplicated constant and dot product nodes should have been merged
+    testing::ProcessTest("testing CSE model size", newModel.Size() == 3);
+
+    // Now run data through the models and make sure they agree
+    auto newInputNode = transformer.GetCorrespondingInputNode(inputNode);
+    auto newOutputs1 = transformer.GetCorrespondingOutputs(model::PortElements<double>{ dotNode1->output });
+    auto newOutputs2 = transformer.GetCorrespondingOutputs(model::PortElements<double>{ dotNode2->output });
+
+    std::vector<std::vector<double>> inputValues = { { 1.0, 2.0 }, { 1.0, 0.5 }, { 2.0, 4.0 } };
+    for (const auto& inputValue : inputValues)
+    {
+        inputNode->SetInput(inputValue);
+        auto output1 = model.ComputeOutput(dotNode1->output);
+        auto output2 = model.ComputeOutput(dotNode2->output);
+
+        newInputNode->SetInput(inputValue);
+        auto newOutput1 = newModel.ComputeOutput(newOutputs1);
+        auto newOutput2 = newModel.ComputeOutput(newOutputs2);
+
+        testing::ProcessTest("testing CSE model output", testing::IsEqual(output1[0], newOutput1[0]));
+        testing::ProcessTest("testing CSE model output", testing::IsEqual(output2[0], newOutput2[0]));
+    }
+}
+
+void TestFoldConstants()
+{
+    // Create a model with a chain of constant arithmetic feeding a non-constant operation
+    model::Model model;
+    auto inputNode = model.AddNode<model::InputNode<double>>(2);
+    auto constantNode1 = model.AddNode<nodes::ConstantNode<double>>(std::vector<double>{ 1.0, 2.0 });
+    auto constantNode2 = model.AddNode<nodes::ConstantNode<double>>(std::vector<double>{ 3.0, 4.0 });
+    auto addNode = model.AddNode<nodes::BinaryOperationNode<double>>(constantNode1->output, constantNode2->output, emitters::BinaryOperationType::add);
+    auto scaleNode = model.AddNode<nodes::BinaryOperationNode<double>>(addNode->output, constantNode1->output, emitters::BinaryOperationType::coordinatewiseMultiply);
+    auto outputNode = model.AddNode<nodes::BinaryOperationNode<double>>(inputNode->output, scaleNode->output, emitters::BinaryOperationType::add);
+
+    model::TransformContext context;
+    model::ModelTransformer transformer;
+    auto newModel = transformer.FoldConstants(model, context);
+
+    // The constant chain (both folded nodes) should now be constant in the new model
+    auto newScaleOutputs = transformer.GetCorrespondingOutputs(model::PortElements<double>{ scaleNode->output });
+    auto scaleSourceNode = newScaleOutputs.GetRanges()[0].ReferencedPort()->GetNode();
+    testing::ProcessTest("testing folded chain is constant", scaleSourceNode->IsConstant());
+
+    // The non-constant operation should survive and still compute the same result
+    auto newInputNode = transformer.GetCorrespondingInputNode(inputNode);
+    auto newOutputs = transformer.GetCorrespondingOutputs(model::PortElements<double>{ outputNode->output });
+
+    std::vector<std::vector<double>> inputValues = { { 1.0, 2.0 }, { 1.0, 0.5 }, { 2.0, 4.0 } };
+    for (const auto& inputValue : inputValues)
+    {
+        inputNode->SetInput(inputValue);
+        auto output = model.ComputeOutput(outputNode->output);
+
+        newInputNode->SetInput(inputValue);
+        auto newOutput = newModel.ComputeOutput(newOutputs);
+
+        testing::ProcessTest("testing folded model output", testing::IsEqual(output[0], newOutput[0]));
+        testing::ProcessTest("testing folded model output", testing::IsEqual(output[1], newOutput[1]));
+    }
+}
+
 void TestCustomRefine()
 {
     // Create a simple computation model
@@ -348,3 +425,26 @@ void TestCustomRefine()
     auto model2 = transformer.RefineModel(model, context2);
     testing::ProcessTest("testing custom refine function", model1.Size() == 4 && model2.Size() == 3);
 }
+
+void TestModelInvalidateNode()
+{
+    // a pure (stateless) chain: once computed incrementally, nothing recomputes until a node is
+    // invalidated, and invalidation marks exactly the downstream slice stale
+    model::Model model;
+    auto inputNode = model.AddNode<model::InputNode<double>>(2);
+    auto constantNode = model.AddNode<nodes::ConstantNode<double>>(std::vector<double>{ 1.0, 2.0 });
+    auto dotNode = model.AddNode<nodes::DotProductNode<double>>(inputNode->output, constantNode->output);
+
+    inputNode->SetInput({ 1.0, 1.0 });
+    auto result1 = model.ComputeOutputIncremental(model::PortElements<double>{ dotNode->output });
+    testing::ProcessTest("testing invalidation: initial compute", testing::IsEqual(result1[0], 3.0));
+
+    // nothing is stale, so a second incremental pass skips every node
+    auto result2 = model.ComputeOutputIncremental(model::PortElements<double>{ dotNode->output });
+    testing::ProcessTest("testing invalidation: unchanged model skips", testing::IsEqual(result2[0], 3.0) && !dotNode->OutputChanged());
+
+    // invalidating the input node marks the downstream dot product stale, but not the constant
+    model.InvalidateNode(*inputNode);
+    auto result3 = model.ComputeOutputIncremental(model::PortElements<double>{ dotNode->output });
+    testing::ProcessTest("testing invalidation: downstream recompute", testing::IsEqual(result3[0], 3.0) && dotNode->OutputChanged() && !constantNode->OutputChanged());
+}
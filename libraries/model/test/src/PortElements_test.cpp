@@ -83,6 +83,41 @@ void TestAppend()
     testing::ProcessTest("Testing Append", testing::IsEqual(elements2.Size(), (size_t)7));
 }
 
+void TestContiguity()
+{
+    model::Model g;
+    auto in1 = g.AddNode<model::InputNode<double>>(4);
+    auto in2 = g.AddNode<model::InputNode<double>>(2);
+
+    // adjacent slices of one port stay contiguous, even when added as separate ranges
+    model::PortElements<double> adjacent;
+    adjacent.Append({ in1->output, 0, 2 });
+    adjacent.Append({ in1->output, 2, 2 });
+    testing::ProcessTest("Testing contiguity detection", adjacent.IsContiguous());
+    testing::ProcessTest("Testing contiguity detection", adjacent.GetContiguousPort() == &in1->output);
+    testing::ProcessTest("Testing contiguity detection", testing::IsEqual(adjacent.GetContiguousStartIndex(), (size_t)0));
+
+    // a gap or a second port breaks contiguity
+    model::PortElements<double> gap;
+    gap.Append({ in1->output, 0, 2 });
+    gap.Append({ in1->output, 3, 1 });
+    testing::ProcessTest("Testing contiguity detection", !gap.IsContiguous());
+
+    model::PortElements<double> mixed;
+    mixed.Append({ in1->output });
+    mixed.Append({ in2->output });
+    testing::ProcessTest("Testing contiguity detection", !mixed.IsContiguous());
+
+    // GetElement resolves identically on both paths
+    auto slice = model::PortElements<double>(in1->output, 1, 3);
+    testing::ProcessTest("Testing contiguity detection", slice.IsContiguous());
+    for (size_t index = 0; index < slice.Size(); ++index)
+    {
+        auto element = slice.GetElement(index);
+        testing::ProcessTest("Testing contiguous GetElement", element.ReferencedPort() == &in1->output && element.GetIndex() == index + 1);
+    }
+}
+
 void TestParsePortElements()
 {
     auto elements = model::ParsePortElementsProxy("123.bar");
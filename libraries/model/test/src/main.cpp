@@ -39,21 +39,32 @@ int main()
 
         TestCopyModel();
         TestRefineSplitOutputs();
+        TestEliminateCommonSubexpressions();
+        TestFoldConstants();
 
         // PortElements tests
         TestSlice();
         TestAppend();
+        TestContiguity();
         TestParsePortElements();
 
         // DynamicMap tests
         TestDynamicMapCreate();
         TestDynamicMapCompute();
+        TestDynamicMapComputeBuffered();
+        TestDynamicMapBoundHandles();
         TestDynamicMapComputeDataVector();
+        TestDynamicMapIncrementalCompute();
         TestDynamicMapRefine();
+        TestDynamicMapCachedIterationPlan();
+        TestDynamicMapExtractSubmap();
+        TestDynamicMapSharedModel();
         TestDynamicMapSerialization();
         TestSteppableMapCompute();
+        TestSteppableMapRunner();
 
         TestCustomRefine();
+        TestModelInvalidateNode();
 
         //
         // ModelBuilder tests
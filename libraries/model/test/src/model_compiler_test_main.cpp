@@ -35,6 +35,7 @@ void TestIRCompiler()
     TestDotProduct();
     TestSum(false);
     TestSum(true);
+    TestUnrollLimit();
     TestAccumulator(false);
     TestAccumulator(true);
     TestDelay();
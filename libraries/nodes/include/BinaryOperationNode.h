@@ -8,6 +8,9 @@
 
 #pragma once
 
+// nodes
+#include "ConstantNode.h"
+
 // model
 #include "CompilableNodeUtilities.h"
 #include "CompilableNode.h"
@@ -86,16 +89,25 @@ namespace nodes
         /// <returns> The operation </returns>
         emitters::BinaryOperationType GetOperation() const { return _operation; }
 
+        /// <summary> Indicates if this node can be fused into an elementwise loop with its neighbors </summary>
+        virtual bool IsElementwise() const override;
+
+        /// <summary> Emits the code that computes one output element, for use inside a fused loop </summary>
+        virtual llvm::Value* CompileElementwise(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function, llvm::Value* index, llvm::Value* chainValue) override;
+
     protected:
         virtual void Compute() const override;
         virtual void Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function) override;
+        virtual bool HasComputeState() const override { return false; }
+        virtual bool Fold(model::ModelTransformer& transformer) const override;
 
     private:
         void CompileLoop(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function);
         void CompileExpanded(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function);
 
         template <typename Operation>
-        std::vector<ValueType> ComputeOutput(Operation&& function) const;
+        static std::vector<ValueType> ComputeOutput(Operation&& function, const std::vector<ValueType>& input1Values, const std::vector<ValueType>& input2Values);
+        std::vector<ValueType> ComputeOutput(const std::vector<ValueType>& input1Values, const std::vector<ValueType>& input2Values) const;
 
         // Inputs
         model::InputPort<ValueType> _input1;
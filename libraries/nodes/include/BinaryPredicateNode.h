@@ -88,6 +88,7 @@ namespace nodes
 
     protected:
         virtual void Compute() const override;
+        virtual bool HasComputeState() const override { return false; }
 
         template <typename Operation>
         std::vector<bool> ComputeOutput(Operation&& fn) const;
@@ -0,0 +1,114 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     BlockSparseMatrixVectorMultiplyNode.h (nodes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// model
+#include "CompilableNode.h"
+#include "IRMapCompiler.h"
+#include "InputPort.h"
+#include "MapCompiler.h"
+#include "ModelTransformer.h"
+#include "Node.h"
+#include "OutputPort.h"
+#include "PortElements.h"
+
+// emitters
+#include "IRFunctionEmitter.h"
+
+// utilities
+#include "Exception.h"
+#include "IArchivable.h"
+#include "TypeName.h"
+
+// stl
+#include <string>
+#include <vector>
+
+namespace ell
+{
+namespace nodes
+{
+    /// <summary> A node that multiplies a block-sparse matrix with a dense vector. The matrix is
+    /// given as a list of nonzero blockSize x blockSize blocks: parallel block row/column index
+    /// lists plus the blocks' dense values (each row-major, zero-padded where a block overhangs
+    /// the matrix edge). Only the kept blocks are visited, each with a dense micro-kernel, so the
+    /// cost scales with the number of nonzero blocks rather than m*n. </summary>
+    template <typename ValueType>
+    class BlockSparseMatrixVectorMultiplyNode : public model::CompilableNode
+    {
+    public:
+        /// @name Input and Output Ports
+        /// @{
+        static constexpr const char* inputValuesPortName = "inputValues";
+        static constexpr const char* inputVectorPortName = "inputVector";
+        static constexpr const char* outputPortName = "output";
+        const model::InputPort<ValueType>& inputValues = _inputValues;
+        const model::InputPort<ValueType>& inputVector = _inputVector;
+        const model::OutputPort<ValueType>& output = _output;
+        /// @}
+
+        /// <summary> Default Constructor </summary>
+        BlockSparseMatrixVectorMultiplyNode();
+
+        /// <summary> Constructor. </summary>
+        ///
+        /// <param name="inputValues"> The values of the kept blocks, concatenated in block order. </param>
+        /// <param name="m"> The number of matrix rows. </param>
+        /// <param name="n"> The number of matrix columns. </param>
+        /// <param name="blockSize"> The block edge length. </param>
+        /// <param name="blockRows"> The block row index of each kept block. </param>
+        /// <param name="blockColumns"> The block column index of each kept block, parallel to blockRows. </param>
+        /// <param name="inputVector"> The right-hand input of the matrix multiplication. </param>
+        BlockSparseMatrixVectorMultiplyNode(const model::PortElements<ValueType>& inputValues, size_t m, size_t n, size_t blockSize, std::vector<size_t> blockRows, std::vector<size_t> blockColumns, const model::PortElements<ValueType>& inputVector);
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        static std::string GetTypeName() { return utilities::GetCompositeTypeName<ValueType>("BlockSparseMatrixVectorMultiplyNode"); }
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        virtual std::string GetRuntimeTypeName() const override { return GetTypeName(); }
+
+        /// <summary> Adds an object's properties to an `Archiver` </summary>
+        ///
+        /// <param name="archiver"> The `Archiver` to add the values from the object to </param>
+        virtual void WriteToArchive(utilities::Archiver& archiver) const override;
+
+        /// <summary> Sets the internal state of the object according to the archiver passed in </summary>
+        ///
+        /// <param name="archiver"> The `Archiver` to get state from </param>
+        virtual void ReadFromArchive(utilities::Unarchiver& archiver) override;
+
+        /// <summary> Makes a copy of this node in the model being constructed by the transformer </summary>
+        virtual void Copy(model::ModelTransformer& transformer) const override;
+
+    protected:
+        virtual void Compute() const override;
+        virtual void Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function) override;
+
+    private:
+        // Inputs
+        model::InputPort<ValueType> _inputValues;
+        model::InputPort<ValueType> _inputVector;
+
+        // Output
+        model::OutputPort<ValueType> _output;
+
+        // Matrix dimensions; matrix is MxN, vector is of length N
+        size_t _m, _n;
+
+        // Block structure: edge length, and the grid position of each kept block
+        size_t _blockSize;
+        std::vector<size_t> _blockRows;
+        std::vector<size_t> _blockColumns;
+    };
+}
+}
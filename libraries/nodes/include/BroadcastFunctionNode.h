@@ -260,6 +260,14 @@ namespace nodes
         void EmitComputeDimensionLoop(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function, size_t dimension, llvm::Value* primaryInput, const std::vector<llvm::Value*>& secondaryInputs, llvm::Value* output, llvm::Value* prevInputDimensionOffset, llvm::Value* prevOutputDimensionOffset, std::vector<llvm::Value*>& secondaryValues) const;
 
     private:
+        // Collapses trailing unit-stride dimensions (no padding, no offset, past the broadcast
+        // dimension) into a single dimension, so the emitted inner loop covers as many contiguous
+        // elements as possible.
+        void FuseTrailingDimensions(PortMemoryLayout& inputLayout, PortMemoryLayout& outputLayout) const;
+
+        // The recursive worker behind EmitComputeDimensionLoop, operating on (possibly fused) layouts
+        void EmitComputeDimensionLoop(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function, size_t dimension, const PortMemoryLayout& inputLayout, const PortMemoryLayout& outputLayout, llvm::Value* primaryInput, const std::vector<llvm::Value*>& secondaryInputs, llvm::Value* output, llvm::Value* prevInputDimensionOffset, llvm::Value* prevOutputDimensionOffset, std::vector<llvm::Value*>& secondaryValues) const;
+
         PortMemoryLayout _inputLayout;
         PortMemoryLayout _outputLayout;
         size_t _broadcastDimension = 0;
@@ -0,0 +1,105 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     BufferNode.h (nodes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// model
+#include "CompilableNode.h"
+#include "IRMapCompiler.h"
+#include "InputPort.h"
+#include "MapCompiler.h"
+#include "ModelTransformer.h"
+#include "Node.h"
+#include "OutputPort.h"
+#include "PortElements.h"
+
+// utilities
+#include "Exception.h"
+#include "IArchivable.h"
+#include "TypeName.h"
+
+// stl
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace ell
+{
+namespace nodes
+{
+    /// <summary> A node that assembles a sliding window over its input: its output is the last
+    /// `windowSize` input samples, oldest first, with the newest sample at the end. Built on the
+    /// same shift-register concept as `DelayNode`, it lets windowed front ends (framing for
+    /// spectral features, short-term statistics) live in the model graph instead of in
+    /// hand-written code before the map boundary. </summary>
+    template <typename ValueType>
+    class BufferNode : public model::CompilableNode
+    {
+    public:
+        /// @name Input and Output Ports
+        /// @{
+        static constexpr const char* outputPortName = "output";
+        static constexpr const char* inputPortName = "input";
+        const model::InputPort<ValueType>& input = _input;
+        const model::OutputPort<ValueType>& output = _output;
+        /// @}
+
+        /// <summary> Default Constructor </summary>
+        BufferNode();
+
+        /// <summary> Constructor </summary>
+        ///
+        /// <param name="input"> The signal to buffer </param>
+        /// <param name="windowSize"> The number of input samples the window holds </param>
+        BufferNode(const model::PortElements<ValueType>& input, size_t windowSize);
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        static std::string GetTypeName() { return utilities::GetCompositeTypeName<ValueType>("BufferNode"); }
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        virtual std::string GetRuntimeTypeName() const override { return GetTypeName(); }
+
+        /// <summary> Adds an object's properties to an `Archiver` </summary>
+        ///
+        /// <param name="archiver"> The `Archiver` to add the values from the object to </param>
+        virtual void WriteToArchive(utilities::Archiver& archiver) const override;
+
+        /// <summary> Sets the internal state of the object according to the archiver passed in </summary>
+        ///
+        /// <param name="archiver"> The `Archiver` to get state from </param>
+        virtual void ReadFromArchive(utilities::Unarchiver& archiver) override;
+
+        /// <summary> Makes a copy of this node in the model being constructed by the transformer </summary>
+        virtual void Copy(model::ModelTransformer& transformer) const override;
+
+        /// <summary>Return the window size</summary>
+        size_t GetWindowSize() const { return _windowSize; }
+
+    protected:
+        virtual void Compute() const override;
+        virtual void Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function) override;
+        virtual bool HasState() const override { return true; }
+
+        // Inputs
+        model::InputPort<ValueType> _input;
+
+        // Output
+        model::OutputPort<ValueType> _output;
+
+        // Buffer: the window's samples, flattened oldest-first
+        mutable std::vector<ValueType> _buffer;
+        size_t _windowSize;
+    };
+}
+}
+
+#include "../tcc/BufferNode.tcc"
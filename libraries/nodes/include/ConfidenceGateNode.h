@@ -0,0 +1,124 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ConfidenceGateNode.h (nodes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// model
+#include "CompilableNode.h"
+#include "IRMapCompiler.h"
+#include "ModelTransformer.h"
+
+// emitters
+#include "IRMetadata.h"
+
+// stl
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace ell
+{
+namespace nodes
+{
+    /// <summary> A function that the ConfidenceGateNode calls to evaluate the second cascade stage
+    /// on the shared front features, writing the result into the output vector. </summary>
+    template <typename ValueType>
+    using SecondStageFunction = std::function<void(const std::vector<ValueType>&, std::vector<ValueType>&)>;
+
+    /// <summary> The gate of a two-stage model cascade: a cheap first stage always runs, and an
+    /// expensive second stage runs only when the first stage is not confident. The node compares a
+    /// confidence score against a threshold; at or above the threshold the first stage's result
+    /// passes through, below it the second stage is invoked on the already-computed front features
+    /// (typically shared between the stages via `DynamicMap::ExtractSubmap`), so features are
+    /// extracted once. In the compiled map the gate is a branch and the second-stage call sits on
+    /// the untaken side, so confident samples never pay for it. The second stage is a callback --
+    /// an `std::function` on the host, an emitted external function in the compiled map -- so it
+    /// can itself be another compiled map. Like a SinkNode's sink function, the callback is
+    /// runtime state and is not archived. </summary>
+    template <typename ValueType>
+    class ConfidenceGateNode : public model::CompilableNode
+    {
+    public:
+        /// @name Input and Output Ports
+        /// @{
+        static constexpr const char* scorePortName = "score";
+        static constexpr const char* featuresPortName = "features";
+        static constexpr const char* defaultInputPortName = "defaultInput";
+        static constexpr const char* outputPortName = "output";
+        const model::InputPort<ValueType>& score = _score;
+        const model::InputPort<ValueType>& features = _features;
+        const model::InputPort<ValueType>& defaultInput = _defaultInput;
+        const model::OutputPort<ValueType>& output = _output;
+        /// @}
+
+        /// <summary> Default constructor </summary>
+        ConfidenceGateNode();
+
+        /// <summary> Constructor </summary>
+        ///
+        /// <param name="score"> Port elements for the confidence score (the first element is used) </param>
+        /// <param name="features"> Port elements for the front features handed to the second stage </param>
+        /// <param name="defaultInput"> Port elements for the first stage's result, passed through when confident </param>
+        /// <param name="threshold"> The confidence threshold; scores at or above it skip the second stage </param>
+        /// <param name="secondStage"> The second-stage function invoked on low-confidence samples (may be null) </param>
+        /// <param name="secondStageFunctionName"> The optional second-stage function name to be emitted </param>
+        ConfidenceGateNode(const model::PortElements<ValueType>& score, const model::PortElements<ValueType>& features, const model::PortElements<ValueType>& defaultInput, ValueType threshold, SecondStageFunction<ValueType> secondStage = nullptr, const std::string& secondStageFunctionName = "ConfidenceGateNode_SecondStageFunction");
+
+        /// <summary> Gets the confidence threshold. </summary>
+        ///
+        /// <returns> The threshold. </returns>
+        ValueType GetThreshold() const { return _threshold; }
+
+        /// <summary> Sets the second-stage function, e.g. after unarchiving. </summary>
+        ///
+        /// <param name="secondStage"> The second-stage function. </param>
+        void SetSecondStageFunction(SecondStageFunction<ValueType> secondStage) { _secondStage = std::move(secondStage); }
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        static std::string GetTypeName() { return utilities::GetCompositeTypeName<ValueType>("ConfidenceGateNode"); }
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        virtual std::string GetRuntimeTypeName() const override { return GetTypeName(); }
+
+        /// <summary> Adds an object's properties to an `Archiver` </summary>
+        ///
+        /// <param name="archiver"> The `Archiver` to add the values from the object to </param>
+        virtual void WriteToArchive(utilities::Archiver& archiver) const override;
+
+        /// <summary> Sets the internal state of the object according to the archiver passed in </summary>
+        ///
+        /// <param name="archiver"> The `Archiver` to get state from </param>
+        virtual void ReadFromArchive(utilities::Unarchiver& archiver) override;
+
+        /// <summary> Makes a copy of this node in the model being constructed by the transformer </summary>
+        ///
+        /// <param name="transformer"> The `ModelTransformer` receiving the copy  </param>
+        virtual void Copy(model::ModelTransformer& transformer) const override;
+
+    protected:
+        virtual void Compute() const override;
+        virtual void Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function) override;
+
+    private:
+        model::InputPort<ValueType> _score;
+        model::InputPort<ValueType> _features;
+        model::InputPort<ValueType> _defaultInput;
+        model::OutputPort<ValueType> _output;
+
+        ValueType _threshold = 0;
+        std::string _secondStageFunctionName;
+        SecondStageFunction<ValueType> _secondStage;
+    };
+}
+}
+
+#include "../tcc/ConfidenceGateNode.tcc"
@@ -30,6 +30,7 @@
 
 // stl
 #include <memory>
+#include <type_traits>
 #include <vector>
 
 namespace ell
@@ -89,13 +90,22 @@ namespace nodes
         /// <summary> Makes a copy of this node in the model being constructed by the transformer </summary>
         virtual void Copy(model::ModelTransformer& transformer) const override;
 
+        /// <summary> Indicates if this node's output is a fixed constant value. </summary>
+        virtual bool IsConstant() const override { return true; }
+
     protected:
         virtual void Compute() const override;
         virtual void Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function) override;
         virtual bool HasState() const override { return true; }
+        virtual bool HasComputeState() const override { return false; }
         virtual bool ShouldCompileInline() const override { return true; }
 
     private:
+        // Emits the values as a clustered codebook plus packed indices, decoded into a RAM arena
+        // on first use. Only valid for floating-point values; the false_type overload is the
+        // never-called stub that keeps non-floating-point instantiations compiling.
+        void CompileClusteredConstant(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function, size_t bitsPerIndex, std::true_type);
+        void CompileClusteredConstant(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function, size_t bitsPerIndex, std::false_type) {}
 
         // Output
         model::OutputPort<ValueType> _output;
@@ -112,6 +122,18 @@ namespace nodes
     ///
     /// <returns> The node added to the model. </returns>
     ConstantNode<double>* AddNodeToModelTransformer(const model::PortElements<double>& input, const predictors::ConstantPredictor& predictor, model::ModelTransformer& transformer);
+
+    /// <summary> Gathers the values behind a set of port elements, if they are all produced by constant
+    /// nodes in the model being constructed by the transformer. Used by `Node::Fold` implementations to
+    /// check whether their inputs have been folded into constants. </summary>
+    ///
+    /// <param name="transformer"> The transformer whose new model is consulted. </param>
+    /// <param name="elements"> The (untransformed) port elements to resolve. </param>
+    /// <param name="values"> [out] The constant values, in element order. </param>
+    ///
+    /// <returns> true if all of the elements resolved to constant nodes. </returns>
+    template <typename ValueType>
+    bool TryGetConstantValues(model::ModelTransformer& transformer, const model::PortElements<ValueType>& elements, std::vector<ValueType>& values);
 }
 }
 
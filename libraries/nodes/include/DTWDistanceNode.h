@@ -26,7 +26,9 @@
 #include "TypeName.h"
 
 // stl
+#include <limits>
 #include <string>
+#include <vector>
 
 namespace ell
 {
@@ -54,6 +56,27 @@ namespace nodes
         /// <param name="prototype"> The prototype </param>
         DTWDistanceNode(const model::PortElements<ValueType>& input, const std::vector<std::vector<ValueType>>& prototype);
 
+        /// <summary> Constructor with pruning parameters </summary>
+        ///
+        /// <param name="input"> The signals to compare to the prototype </param>
+        /// <param name="prototype"> The prototype </param>
+        /// <param name="sakoeChibaBandWidth"> The maximum allowed difference between the matched path duration and the
+        /// prototype position; cells outside this band are pruned. 0 means unconstrained. </param>
+        /// <param name="earlyAbandonThreshold"> Accumulated distances above this threshold are abandoned: their cells are
+        /// pruned and the per-sample distance computation for them is skipped. Defaults to no threshold. </param>
+        DTWDistanceNode(const model::PortElements<ValueType>& input, const std::vector<std::vector<ValueType>>& prototype, size_t sakoeChibaBandWidth, double earlyAbandonThreshold);
+
+        /// <summary> Constructor for batched evaluation against multiple prototypes. Each input sample is read once and
+        /// matched against all prototypes; the output has one distance per prototype. </summary>
+        ///
+        /// <param name="input"> The signals to compare to the prototypes </param>
+        /// <param name="prototypes"> The prototypes </param>
+        /// <param name="sakoeChibaBandWidth"> The maximum allowed difference between the matched path duration and the
+        /// prototype position; cells outside this band are pruned. 0 means unconstrained. </param>
+        /// <param name="earlyAbandonThreshold"> Accumulated distances above this threshold are abandoned: their cells are
+        /// pruned and the per-sample distance computation for them is skipped. Defaults to no threshold. </param>
+        DTWDistanceNode(const model::PortElements<ValueType>& input, const std::vector<std::vector<std::vector<ValueType>>>& prototypes, size_t sakoeChibaBandWidth = 0, double earlyAbandonThreshold = std::numeric_limits<double>::infinity());
+
         /// <summary> Gets the name of this type (for serialization). </summary>
         ///
         /// <returns> The name of this type. </returns>
@@ -84,7 +107,10 @@ namespace nodes
         /// <param name="transformer"> The `ModelTransformer` currently refining the model </param>
         // virtual bool Refine(model::ModelTransformer& transformer) const override;
 
-        std::vector<std::vector<ValueType>> GetPrototype() const { return _prototype; }
+        std::vector<std::vector<ValueType>> GetPrototype() const { return _prototypes[0]; }
+
+        /// <summary> Returns all the prototypes this node matches against. </summary>
+        const std::vector<std::vector<std::vector<ValueType>>>& GetPrototypes() const { return _prototypes; }
 
     protected:
         void Reset() const;
@@ -93,19 +119,22 @@ namespace nodes
         virtual bool HasState() const override { return true; }
 
     private:
-        std::vector<ValueType> GetPrototypeData() const;
+        std::vector<ValueType> GetPrototypeData(size_t prototypeIndex) const;
+        ValueType UpdatePrototypeColumn(size_t prototypeIndex, const std::vector<ValueType>& input, int t) const;
 
         model::InputPort<ValueType> _input;
         model::OutputPort<ValueType> _output;
 
         size_t _sampleDimension;
-        size_t _prototypeLength;
-        std::vector<std::vector<ValueType>> _prototype;
-        // double _threshold;
-        double _prototypeVariance;
-
-        mutable std::vector<ValueType> _d;
-        mutable std::vector<int> _s;
+        std::vector<std::vector<std::vector<ValueType>>> _prototypes;
+        std::vector<double> _prototypeVariances;
+        size_t _bandWidth; // Sakoe-Chiba band half-width; 0 means unconstrained
+        double _earlyAbandonThreshold;
+
+        // per-prototype dynamic programming state: the current column of accumulated distances and
+        // the start time of the path through each cell
+        mutable std::vector<std::vector<ValueType>> _d;
+        mutable std::vector<std::vector<int>> _s;
         mutable int _currentTime;
     };
 }
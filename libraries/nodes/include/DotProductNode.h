@@ -9,6 +9,7 @@
 #pragma once
 
 #include "SumNode.h"
+#include "PortVectorReference.h"
 
 // model
 #include "BinaryOperationNode.h"
@@ -22,6 +23,9 @@
 #include "OutputPort.h"
 #include "PortElements.h"
 
+// math
+#include "Operations.h"
+
 // utilities
 #include "TypeName.h"
 
@@ -90,10 +94,12 @@ namespace nodes
     protected:
         virtual void Compute() const override;
         virtual void Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function) override;
+        virtual bool HasComputeState() const override { return false; }
 
     private:
         void CompileDotProductLoop(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function);
         void CompileDotProductExpanded(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function);
+        void CompileDotProductFixedPoint(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function);
 
         // Inputs
         model::InputPort<ValueType> _input1;
@@ -0,0 +1,34 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     EliminateTypeCasts.h (nodes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// model
+#include "ModelTransformer.h"
+#include "Node.h"
+
+namespace ell
+{
+namespace nodes
+{
+    /// <summary>
+    /// A model transform function that removes redundant TypeCastNodes. A cast whose input comes
+    /// entirely from another cast is rewired to read the inner cast's source directly, so inverse
+    /// pairs (such as the double -> float -> double casts that importers sprinkle around nodes)
+    /// disappear and longer chains collapse to a single cast from the source type to the final
+    /// type. Same-type casts are passed through. Note that collapsing a narrowing round trip
+    /// drops the intermediate rounding step, so downstream nodes see the source values at full
+    /// precision. Run after refinement with `model::DynamicMap::Transform`, then call
+    /// `model::DynamicMap::Prune` to drop the casts that are no longer read.
+    /// </summary>
+    ///
+    /// <param name="node"> The node being visited. </param>
+    /// <param name="transformer"> The transformer currently transforming the model. </param>
+    void EliminateTypeCasts(const model::Node& node, model::ModelTransformer& transformer);
+}
+}
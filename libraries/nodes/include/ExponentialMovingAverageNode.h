@@ -0,0 +1,102 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ExponentialMovingAverageNode.h (nodes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// model
+#include "CompilableNodeUtilities.h"
+#include "CompilableNode.h"
+#include "IRMapCompiler.h"
+#include "MapCompiler.h"
+#include "Model.h"
+#include "ModelTransformer.h"
+#include "Node.h"
+
+// utilities
+#include "TypeName.h"
+
+// stl
+#include <string>
+#include <vector>
+
+namespace ell
+{
+namespace nodes
+{
+    /// <summary> A node that maintains an exponentially-weighted moving average of its input:
+    /// `ewma = ewma + alpha * (x - ewma)`. Unlike `MovingAverageNode` it keeps no sample window,
+    /// so each update is O(1) in both time and state regardless of the effective averaging
+    /// horizon (roughly `2/alpha - 1` samples). </summary>
+    template <typename ValueType>
+    class ExponentialMovingAverageNode : public model::CompilableNode
+    {
+    public:
+        /// @name Input and Output Ports
+        /// @{
+        static constexpr const char* inputPortName = "input";
+        static constexpr const char* outputPortName = "output";
+        const model::InputPort<ValueType>& input = _input;
+        const model::OutputPort<ValueType>& output = _output;
+        /// @}
+
+        /// <summary> Default Constructor </summary>
+        ExponentialMovingAverageNode();
+
+        /// <summary> Constructor </summary>
+        /// <param name="input"> The signal to average </param>
+        /// <param name="smoothing"> The smoothing factor alpha, in (0, 1]; smaller values average over a longer horizon </param>
+        ExponentialMovingAverageNode(const model::PortElements<ValueType>& input, ValueType smoothing);
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        static std::string GetTypeName() { return utilities::GetCompositeTypeName<ValueType>("ExponentialMovingAverageNode"); }
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        virtual std::string GetRuntimeTypeName() const override { return GetTypeName(); }
+
+        /// <summary> Gets the smoothing factor alpha. </summary>
+        ///
+        /// <returns> The smoothing factor. </returns>
+        ValueType GetSmoothing() const { return _smoothing; }
+
+        /// <summary> Adds an object's properties to an `Archiver` </summary>
+        ///
+        /// <param name="archiver"> The `Archiver` to add the values from the object to </param>
+        virtual void WriteToArchive(utilities::Archiver& archiver) const override;
+
+        /// <summary> Sets the internal state of the object according to the archiver passed in </summary>
+        ///
+        /// <param name="archiver"> The `Archiver` to get state from </param>
+        virtual void ReadFromArchive(utilities::Unarchiver& archiver) override;
+
+        /// <summary> Makes a copy of this node in the model being constructed by the transformer </summary>
+        virtual void Copy(model::ModelTransformer& transformer) const override;
+
+    protected:
+        virtual void Compute() const override;
+        virtual void Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function) override;
+        virtual bool HasState() const override { return true; }
+
+    private:
+        // Input
+        model::InputPort<ValueType> _input;
+
+        // Output
+        model::OutputPort<ValueType> _output;
+
+        // State
+        ValueType _smoothing;
+        mutable std::vector<ValueType> _ewma;
+    };
+}
+}
+
+#include "../tcc/ExponentialMovingAverageNode.tcc"
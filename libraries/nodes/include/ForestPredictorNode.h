@@ -9,6 +9,8 @@
 #pragma once
 
 // model
+#include "CompilableNode.h"
+#include "IRMapCompiler.h"
 #include "Model.h"
 #include "ModelTransformer.h"
 #include "Node.h"
@@ -30,7 +32,7 @@ namespace nodes
     /// <typeparam name="SplitRuleType"> The split rule type. </typeparam>
     /// <typeparam name="EdgePredictorType"> The edge predictor type. </typeparam>
     template <typename SplitRuleType, typename EdgePredictorType>
-    class ForestPredictorNode : public model::Node
+    class ForestPredictorNode : public model::CompilableNode
     {
     public:
         /// @name Input and Output Ports
@@ -84,8 +86,13 @@ namespace nodes
         /// <summary> Refines this node in the model being constructed by the transformer </summary>
         virtual bool Refine(model::ModelTransformer& transformer) const override;
 
+        /// <summary> Indicates if this node is able to compile itself to code. Only the simple forest
+        /// specialization has a direct lowering; other forests compile by refinement. </summary>
+        virtual bool IsCompilable() const override;
+
     protected:
         virtual void Compute() const override;
+        virtual void Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function) override;
 
     private:
         // Input
@@ -102,6 +109,15 @@ namespace nodes
 
     /// <summary> Defines an alias representing a simple forest node, which holds a forest with a SingleElementThresholdPredictor as the split rule and ConstantPredictors on the edges. </summary>
     typedef ForestPredictorNode<predictors::SingleElementThresholdPredictor, predictors::ConstantPredictor> SimpleForestPredictorNode;
+
+    /// <summary> The simple forest has a direct compiled lowering: the forest is flattened into
+    /// structure-of-arrays form (feature indices, thresholds, edge values, child offsets) and walked
+    /// in a tight branch-free loop, instead of being refined into one node per split. </summary>
+    template <>
+    bool ForestPredictorNode<predictors::SingleElementThresholdPredictor, predictors::ConstantPredictor>::IsCompilable() const;
+
+    template <>
+    void ForestPredictorNode<predictors::SingleElementThresholdPredictor, predictors::ConstantPredictor>::Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function);
 }
 }
 
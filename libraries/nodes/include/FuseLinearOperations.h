@@ -0,0 +1,31 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     FuseLinearOperations.h (nodes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// model
+#include "ModelTransformer.h"
+#include "Node.h"
+
+namespace ell
+{
+namespace nodes
+{
+    /// <summary>
+    /// A model transform function that folds chains of batch normalization, scaling, and bias layer
+    /// nodes into the weights of the preceding convolutional or fully-connected layer node. Each
+    /// folded chain is replaced by a single bias layer node carrying the accumulated additive term,
+    /// eliminating the separate elementwise passes the chain would otherwise perform. Use with
+    /// `model::ModelTransformer::TransformModel` or `model::DynamicMap::Transform`.
+    /// </summary>
+    ///
+    /// <param name="node"> The node being visited. </param>
+    /// <param name="transformer"> The transformer currently transforming the model. </param>
+    void FuseLinearOperations(const model::Node& node, model::ModelTransformer& transformer);
+}
+}
@@ -0,0 +1,101 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     InputNormalizationNode.h (nodes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// model
+#include "CompilableNode.h"
+#include "IRMapCompiler.h"
+#include "InputPort.h"
+#include "MapCompiler.h"
+#include "ModelTransformer.h"
+#include "Node.h"
+#include "OutputPort.h"
+#include "PortElements.h"
+
+// utilities
+#include "Exception.h"
+#include "IArchivable.h"
+#include "TypeName.h"
+
+// stl
+#include <string>
+#include <vector>
+
+namespace ell
+{
+namespace nodes
+{
+    /// <summary> A node that applies a calibrated per-element affine normalization to its input:
+    /// output[i] = (input[i] - mean[i]) * inverseStdDev[i]. The calibration vectors are baked into
+    /// the node, so feature standardization compiles into the model instead of living in code in
+    /// front of the map. </summary>
+    template <typename ValueType>
+    class InputNormalizationNode : public model::CompilableNode
+    {
+    public:
+        /// @name Input and Output Ports
+        /// @{
+        static constexpr const char* outputPortName = "output";
+        static constexpr const char* inputPortName = "input";
+        const model::InputPort<ValueType>& input = _input;
+        const model::OutputPort<ValueType>& output = _output;
+        /// @}
+
+        /// <summary> Default Constructor </summary>
+        InputNormalizationNode();
+
+        /// <summary> Constructor </summary>
+        ///
+        /// <param name="input"> The signal to normalize </param>
+        /// <param name="mean"> The per-element mean to subtract (must have the input's size) </param>
+        /// <param name="inverseStdDev"> The per-element scale to multiply by (must have the input's size) </param>
+        InputNormalizationNode(const model::PortElements<ValueType>& input, std::vector<ValueType> mean, std::vector<ValueType> inverseStdDev);
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        static std::string GetTypeName() { return utilities::GetCompositeTypeName<ValueType>("InputNormalizationNode"); }
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        virtual std::string GetRuntimeTypeName() const override { return GetTypeName(); }
+
+        /// <summary> Adds an object's properties to an `Archiver` </summary>
+        ///
+        /// <param name="archiver"> The `Archiver` to add the values from the object to </param>
+        virtual void WriteToArchive(utilities::Archiver& archiver) const override;
+
+        /// <summary> Sets the internal state of the object according to the archiver passed in </summary>
+        ///
+        /// <param name="archiver"> The `Archiver` to get state from </param>
+        virtual void ReadFromArchive(utilities::Unarchiver& archiver) override;
+
+        /// <summary> Makes a copy of this node in the model being constructed by the transformer </summary>
+        virtual void Copy(model::ModelTransformer& transformer) const override;
+
+    protected:
+        virtual void Compute() const override;
+        virtual void Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function) override;
+        virtual bool HasState() const override { return true; } // stored state: the calibration vectors
+
+        // Inputs
+        model::InputPort<ValueType> _input;
+
+        // Output
+        model::OutputPort<ValueType> _output;
+
+        // Calibration
+        std::vector<ValueType> _mean;
+        std::vector<ValueType> _inverseStdDev;
+    };
+}
+}
+
+#include "../tcc/InputNormalizationNode.tcc"
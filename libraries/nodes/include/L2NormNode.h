@@ -8,7 +8,12 @@
 
 #pragma once
 
+// model
+#include "CompilableNodeUtilities.h"
+#include "CompilableNode.h"
+#include "IRMapCompiler.h"
 #include "InputPort.h"
+#include "MapCompiler.h"
 #include "ModelTransformer.h"
 #include "Node.h"
 #include "OutputPort.h"
@@ -20,6 +25,7 @@
 // stl
 #include <cmath>
 #include <string>
+#include <vector>
 
 namespace ell
 {
@@ -27,7 +33,7 @@ namespace nodes
 {
     /// <summary> A node that takes a vector input and returns its magnitude </summary>
     template <typename ValueType>
-    class L2NormNode : public model::Node
+    class L2NormNode : public model::CompilableNode
     {
     public:
         /// @name Input and Output Ports
@@ -70,8 +76,13 @@ namespace nodes
 
     protected:
         virtual void Compute() const override;
+        virtual void Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function) override;
+        virtual bool HasComputeState() const override { return false; }
 
     private:
+        void CompileLoop(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function, llvm::Value* pSumOfSquares);
+        void CompileExpanded(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function, llvm::Value* pSumOfSquares);
+
         // Inputs
         model::InputPort<ValueType> _input;
 
@@ -0,0 +1,138 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     MovingExtremumNode.h (nodes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "InputPort.h"
+#include "ModelTransformer.h"
+#include "Node.h"
+#include "OutputPort.h"
+#include "PortElements.h"
+
+// utilities
+#include "TypeName.h"
+
+// stl
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ell
+{
+namespace nodes
+{
+    /// <summary> A node that computes the extremum (min or max) of its input over a window of time,
+    /// using a monotonic deque per element: candidates dominated by a newer sample are dropped as it
+    /// arrives, so the front of the deque is always the window extremum. Each update is O(1)
+    /// amortized, where recomputing the extremum from a buffered window would cost O(windowSize)
+    /// per tick. </summary>
+    template <typename ValueType, bool max>
+    class MovingExtremumNode : public model::Node
+    {
+    public:
+        /// @name Input and Output Ports
+        /// @{
+        static constexpr const char* inputPortName = "input";
+        static constexpr const char* outputPortName = "output";
+        const model::InputPort<ValueType>& input = _input;
+        const model::OutputPort<ValueType>& output = _output;
+        /// @}
+
+        /// <summary> Default Constructor </summary>
+        MovingExtremumNode();
+
+        /// <summary> Constructor </summary>
+        /// <param name="input"> The signal to take the extremum of </param>
+        /// <param name="windowSize"> The number of samples of history to take the extremum over </param>
+        MovingExtremumNode(const model::PortElements<ValueType>& input, size_t windowSize);
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        static std::string GetTypeName();
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        virtual std::string GetRuntimeTypeName() const override { return GetTypeName(); }
+
+        /// <summary> Indicates if this is a moving-max or moving-min node </summary>
+        ///
+        /// <returns> `true` if this is a moving-max node, `false` if it is a moving-min node </returns>
+        bool IsMaxNode() const { return max; }
+
+        /// <summary> Adds an object's properties to an `Archiver` </summary>
+        ///
+        /// <param name="archiver"> The `Archiver` to add the values from the object to </param>
+        virtual void WriteToArchive(utilities::Archiver& archiver) const override;
+
+        /// <summary> Sets the internal state of the object according to the archiver passed in </summary>
+        ///
+        /// <param name="archiver"> The `Archiver` to get state from </param>
+        virtual void ReadFromArchive(utilities::Unarchiver& archiver) override;
+
+        /// <summary> Makes a copy of this node in the model being constructed by the transformer </summary>
+        virtual void Copy(model::ModelTransformer& transformer) const override;
+
+    protected:
+        virtual void Compute() const override;
+
+    private:
+        // Inputs
+        model::InputPort<ValueType> _input;
+
+        // Output
+        model::OutputPort<ValueType> _output;
+
+        // State: per element, the candidate (tick, value) pairs in dominance order; the front is
+        // the current window extremum
+        using Candidate = std::pair<uint64_t, ValueType>;
+        mutable std::vector<std::deque<Candidate>> _candidates;
+        mutable uint64_t _tick = 0;
+        size_t _windowSize;
+    };
+
+    /// <summary> Moving-max node subclass </summary>
+    template <typename ValueType>
+    class MovingMaxNode : public MovingExtremumNode<ValueType, true>
+    {
+    public:
+        /// <summary> Default Constructor </summary>
+        MovingMaxNode()
+            : MovingExtremumNode<ValueType, true>() {}
+
+        /// <summary> Constructor </summary>
+        ///
+        /// <param name="input"> The signal to take the maximum of </param>
+        /// <param name="windowSize"> The number of samples of history to take the maximum over </param>
+        MovingMaxNode(const model::PortElements<ValueType>& input, size_t windowSize)
+            : MovingExtremumNode<ValueType, true>(input, windowSize) {}
+    };
+
+    /// <summary> Moving-min node subclass </summary>
+    template <typename ValueType>
+    class MovingMinNode : public MovingExtremumNode<ValueType, false>
+    {
+    public:
+        /// <summary> Default Constructor </summary>
+        MovingMinNode()
+            : MovingExtremumNode<ValueType, false>() {}
+
+        /// <summary> Constructor </summary>
+        ///
+        /// <param name="input"> The signal to take the minimum of </param>
+        /// <param name="windowSize"> The number of samples of history to take the minimum over </param>
+        MovingMinNode(const model::PortElements<ValueType>& input, size_t windowSize)
+            : MovingExtremumNode<ValueType, false>(input, windowSize) {}
+    };
+}
+}
+
+#include "../tcc/MovingExtremumNode.tcc"
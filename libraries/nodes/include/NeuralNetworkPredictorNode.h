@@ -19,8 +19,11 @@
 #include "BiasLayerNode.h"
 #include "BinaryConvolutionalLayerNode.h"
 #include "ConvolutionalLayerNode.h"
+#include "DepthwiseConvolutionalLayerNode.h"
 #include "FullyConnectedLayerNode.h"
 #include "PoolingLayerNode.h"
+#include "QuantizedConvolutionalLayerNode.h"
+#include "QuantizedFullyConnectedLayerNode.h"
 #include "ScalingLayerNode.h"
 #include "SoftmaxLayerNode.h"
 
@@ -0,0 +1,33 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     OptimizeReorderDataNodes.h (nodes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// model
+#include "ModelTransformer.h"
+#include "Node.h"
+
+namespace ell
+{
+namespace nodes
+{
+    /// <summary>
+    /// A model transform function that removes reorder data nodes whose layout transition doesn't
+    /// pay for itself: a reorder whose output layout equals its input layout is dropped entirely,
+    /// and back-to-back reorders are collapsed into a single node converting directly from the
+    /// first input layout to the final output layout (dropping the whole chain when the round trip
+    /// cancels out). Run after refinement, once the layer nodes have inserted their layout
+    /// transitions. Use with `model::ModelTransformer::TransformModel` or
+    /// `model::DynamicMap::Transform`.
+    /// </summary>
+    ///
+    /// <param name="node"> The node being visited. </param>
+    /// <param name="transformer"> The transformer currently transforming the model. </param>
+    void OptimizeReorderDataNodes(const model::Node& node, model::ModelTransformer& transformer);
+}
+}
@@ -0,0 +1,38 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     PortVectorReference.h (nodes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// model
+#include "InputPort.h"
+
+// math
+#include "Vector.h"
+
+namespace ell
+{
+namespace nodes
+{
+    /// <summary> Returns a zero-copy math vector reference over a contiguous input port's values, so
+    /// interpreted `Compute` implementations can call math kernels directly on port storage instead
+    /// of copying the input out first. The caller must check `port.IsContiguous()` beforehand; the
+    /// reference is only valid until the referenced port's output is recomputed. </summary>
+    ///
+    /// <typeparam name="ValueType"> The port's element type. </typeparam>
+    /// <param name="port"> The input port to wrap. </param>
+    ///
+    /// <returns> A const vector reference aliasing the port's storage. </returns>
+    template <typename ValueType>
+    math::UnorientedConstVectorReference<ValueType> MakePortVectorReference(const model::InputPort<ValueType>& port)
+    {
+        // the const reference type never writes through the pointer; the cast is only to satisfy
+        // its constructor signature
+        return { const_cast<ValueType*>(port.GetContiguousDataPointer()), port.Size(), 1 };
+    }
+}
+}
@@ -0,0 +1,115 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     QuantileEstimatorNode.h (nodes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "InputPort.h"
+#include "ModelTransformer.h"
+#include "Node.h"
+#include "OutputPort.h"
+#include "PortElements.h"
+
+// utilities
+#include "TypeName.h"
+
+// stl
+#include <array>
+#include <string>
+#include <vector>
+
+namespace ell
+{
+namespace nodes
+{
+    /// <summary> A node that estimates a quantile of everything it has seen, using the P-squared
+    /// algorithm: five markers per element track the target quantile and its neighborhood, adjusted
+    /// by parabolic interpolation as samples arrive. Each update is O(1) in time and state, where
+    /// an exact streaming quantile would have to buffer and re-sort its history. Like
+    /// `MovingVarianceNode`, this node computes only in the interpreted path. </summary>
+    template <typename ValueType>
+    class QuantileEstimatorNode : public model::Node
+    {
+    public:
+        /// @name Input and Output Ports
+        /// @{
+        static constexpr const char* inputPortName = "input";
+        static constexpr const char* outputPortName = "output";
+        const model::InputPort<ValueType>& input = _input;
+        const model::OutputPort<ValueType>& output = _output;
+        /// @}
+
+        /// <summary> Default Constructor </summary>
+        QuantileEstimatorNode();
+
+        /// <summary> Constructor </summary>
+        /// <param name="input"> The signal to estimate the quantile of </param>
+        /// <param name="quantile"> The quantile to estimate, in (0, 1) --- e.g., 0.5 for the median, 0.95 for the 95th percentile </param>
+        QuantileEstimatorNode(const model::PortElements<ValueType>& input, double quantile);
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        static std::string GetTypeName() { return utilities::GetCompositeTypeName<ValueType>("QuantileEstimatorNode"); }
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        virtual std::string GetRuntimeTypeName() const override { return GetTypeName(); }
+
+        /// <summary> Gets the quantile being estimated. </summary>
+        ///
+        /// <returns> The quantile. </returns>
+        double GetQuantile() const { return _quantile; }
+
+        /// <summary> Adds an object's properties to an `Archiver` </summary>
+        ///
+        /// <param name="archiver"> The `Archiver` to add the values from the object to </param>
+        virtual void WriteToArchive(utilities::Archiver& archiver) const override;
+
+        /// <summary> Sets the internal state of the object according to the archiver passed in </summary>
+        ///
+        /// <param name="archiver"> The `Archiver` to get state from </param>
+        virtual void ReadFromArchive(utilities::Unarchiver& archiver) override;
+
+        /// <summary> Makes a copy of this node in the model being constructed by the transformer </summary>
+        virtual void Copy(model::ModelTransformer& transformer) const override;
+
+    protected:
+        virtual void Compute() const override;
+
+    private:
+        static constexpr size_t numMarkers = 5;
+
+        // The P-squared state for one element of the input
+        struct Estimator
+        {
+            std::array<double, numMarkers> heights; // marker values, sorted ascending
+            std::array<double, numMarkers> positions; // actual marker positions (1-based sample counts)
+            std::array<double, numMarkers> desired; // ideal marker positions for the target quantile
+            size_t count = 0; // number of samples absorbed, saturating at numMarkers during warmup
+
+            void Update(double value, double quantile);
+            double GetEstimate(double quantile) const;
+        };
+
+        void InitializeEstimators();
+
+        // Inputs
+        model::InputPort<ValueType> _input;
+
+        // Output
+        model::OutputPort<ValueType> _output;
+
+        // State
+        double _quantile;
+        mutable std::vector<Estimator> _estimators;
+    };
+}
+}
+
+#include "../tcc/QuantileEstimatorNode.tcc"
@@ -0,0 +1,70 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     QuantizedConvolutionalLayerNode.h (nodes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "NeuralNetworkLayerNode.h"
+
+// model
+#include "IRMapCompiler.h"
+#include "ModelTransformer.h"
+#include "PortElements.h"
+
+// predictors
+#include "QuantizedConvolutionalLayer.h"
+
+// stl
+#include <string>
+
+namespace ell
+{
+namespace nodes
+{
+    /// <summary> A node that wraps a neural net QuantizedConvolutionalLayer. It refines itself into the
+    /// full-precision convolutional lowering, with the weights dequantized at refine time. </summary>
+    template <typename ValueType>
+    class QuantizedConvolutionalLayerNode : public NeuralNetworkLayerNode<QuantizedConvolutionalLayerNode<ValueType>, predictors::neural::QuantizedConvolutionalLayer<ValueType>, ValueType>
+    {
+    public:
+        using LayerType = predictors::neural::QuantizedConvolutionalLayer<ValueType>;
+        using BaseType = NeuralNetworkLayerNode<QuantizedConvolutionalLayerNode<ValueType>, predictors::neural::QuantizedConvolutionalLayer<ValueType>, ValueType>;
+
+        /// @name Input and Output Ports
+        /// @{
+        using BaseType::inputPortName; // "input"
+        using BaseType::outputPortName; // "output"
+        using BaseType::input;
+        using BaseType::output;
+        /// @}
+
+        QuantizedConvolutionalLayerNode() = default;
+
+        /// <summary> Constructor from a layer. </summary>
+        ///
+        /// <param name="input"> </param>
+        /// <param name="layer"> The quantized convolutional layer to wrap. </param>
+        QuantizedConvolutionalLayerNode(const model::PortElements<ValueType>& input, const predictors::neural::QuantizedConvolutionalLayer<ValueType>& layer);
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        static std::string GetTypeName() { return utilities::GetCompositeTypeName<ValueType>("QuantizedConvolutionalLayerNode"); }
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        virtual std::string GetRuntimeTypeName() const override { return GetTypeName(); }
+
+        /// <summary> Indicates if this node is able to compile itself to code. </summary>
+        virtual bool IsCompilable() const override { return false; }
+
+    protected:
+        virtual bool Refine(model::ModelTransformer& transformer) const override;
+    };
+}
+}
@@ -51,6 +51,18 @@ namespace nodes
         size_t GetEntryOffset(const std::array<int, Dimension>& location) const;
         bool IsOutOfBounds(const std::array<int, Dimension>& location) const;
 
+        /// <summary> Checks at compile time whether every location reached by walking another
+        /// shape's extents is in bounds for this shape, so that a loop over the other shape
+        /// needs no per-element bounds checks at all. </summary>
+        ///
+        /// <param name="walkedShape"> The shape whose extents the walk covers. </param>
+        bool IsAlwaysInBounds(const DataShape& walkedShape) const;
+
+        /// <summary> Gets the dimensions ordered from largest to smallest stride, so the last entry
+        /// is the memory-minor dimension. Loop nests iterating this shape should put the minor
+        /// dimension innermost to get contiguous accesses. </summary>
+        std::array<size_t, Dimension> GetDimensionOrder() const;
+
         // Implemented in LLVM IR:
         llvm::Value* EmitGetEntryOffset(emitters::IRFunctionEmitter& function, const std::array<llvm::Value*, Dimension>& location) const;
         llvm::Value* EmitIsOutOfBounds(emitters::IRFunctionEmitter& function, const std::array<llvm::Value*, Dimension>& location) const;
@@ -79,6 +91,13 @@ namespace nodes
         size_t _totalSize = 0;
     };
 
+    /// <summary> Checks if two data shapes describe identical memory layouts (same extent, stride,
+    /// and offset along every dimension), meaning a reorder between them is the identity. </summary>
+    ///
+    /// <param name="shape1"> The first shape. </param>
+    /// <param name="shape2"> The other shape. </param>
+    bool DataShapesEqual(const DataShape& shape1, const DataShape& shape2);
+
     template <typename ValueType>
     class ReorderDataNode : public model::CompilableNode
     {
@@ -101,6 +120,16 @@ namespace nodes
         /// <param name="outputShape"> A description of the desired output memory shape. </param>
         ReorderDataNode(const model::PortElements<ValueType>& input, const DataShape& inputShape, const DataShape& outputShape);
 
+        /// <summary> Gets the memory shape of the input data. </summary>
+        ///
+        /// <returns> The input shape. </returns>
+        const DataShape& GetInputShape() const { return _inputShape; }
+
+        /// <summary> Gets the memory shape the output data is written in. </summary>
+        ///
+        /// <returns> The output shape. </returns>
+        const DataShape& GetOutputShape() const { return _outputShape; }
+
         /// <summary> Gets the name of this type (for serialization). </summary>
         ///
         /// <returns> The name of this type. </returns>
@@ -120,6 +149,8 @@ namespace nodes
         virtual void ReadFromArchive(utilities::Unarchiver& archiver) override;
 
     private:
+        void CompileFullyUnrolled(emitters::IRFunctionEmitter& function, llvm::Value* pInput, llvm::Value* pOutput) const;
+
         // Input
         model::InputPort<ValueType> _input;
 
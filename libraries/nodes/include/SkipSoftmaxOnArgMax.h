@@ -0,0 +1,32 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     SkipSoftmaxOnArgMax.h (nodes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// model
+#include "ModelTransformer.h"
+#include "Node.h"
+
+namespace ell
+{
+namespace nodes
+{
+    /// <summary>
+    /// A model transform function that elides a softmax layer whose output is consumed only by
+    /// argmax nodes. Softmax is order-preserving, so the argmax index is unchanged when the argmax
+    /// reads the logits directly, and the exp/normalize work is skipped entirely. The softmax is
+    /// kept whenever anything reads an argmax node's extremal value output (which would become a
+    /// raw logit instead of a probability), or when the softmax input has padding. Run after
+    /// refinement with `model::ModelTransformer::TransformModel` or `model::DynamicMap::Transform`.
+    /// </summary>
+    ///
+    /// <param name="node"> The node being visited. </param>
+    /// <param name="transformer"> The transformer currently transforming the model. </param>
+    void SkipSoftmaxOnArgMax(const model::Node& node, model::ModelTransformer& transformer);
+}
+}
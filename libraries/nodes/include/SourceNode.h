@@ -18,8 +18,14 @@
 #include "IRMetadata.h"
 #include "IRModuleEmitter.h"
 
+// utilities
+#include "SpscRingBuffer.h"
+
 // stl
+#include <atomic>
+#include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
 namespace ell
@@ -32,6 +38,21 @@ namespace nodes
     using SamplingFunction = bool (*)(std::vector<ValueType>&);
     using TimeTickType = model::TimeTickType;
 
+    /// <summary> How a SourceNode obtains samples from its sampling function when computed on the host. </summary>
+    enum class SourceSamplingMode
+    {
+        /// <summary> Invoke the sampling function synchronously inside Compute. </summary>
+        synchronous,
+
+        /// <summary> A producer thread fills a ring buffer and Compute consumes the samples in order,
+        /// dropping new samples when the buffer is full. </summary>
+        asynchronousDrop,
+
+        /// <summary> A producer thread fills a ring buffer and Compute consumes the newest available
+        /// sample, discarding stale ones. </summary>
+        asynchronousLatest
+    };
+
     /// <summary> A node that provides a source of data through a sampling function callback. </summary>
     template <typename ValueType, SamplingFunction<ValueType>>
     class SourceNode : public model::CompilableNode
@@ -61,6 +82,23 @@ namespace nodes
         /// <param name="samplingFunctionName"> Sampling function name to be emitted (defaults to "SourceNode_SamplingFunction") </param>
         SourceNode(const model::PortElements<TimeTickType>& input, size_t outputSize, const std::string& samplingFunctionName);
 
+        virtual ~SourceNode() override;
+
+        /// <summary> Sets how samples are obtained when the node is computed on the host. In the
+        /// asynchronous modes, a producer thread invokes the sampling function and fills a lock-free
+        /// single-producer/single-consumer ring buffer, overlapping sampling I/O with compute, and
+        /// Compute consumes from the buffer without blocking. Like the sampling function itself, the
+        /// mode is runtime state and is not archived. </summary>
+        ///
+        /// <param name="mode"> The sampling mode. </param>
+        /// <param name="bufferCapacity"> The ring buffer capacity, used by the asynchronous modes. </param>
+        void SetSamplingMode(SourceSamplingMode mode, size_t bufferCapacity = 16);
+
+        /// <summary> Gets the sampling mode. </summary>
+        ///
+        /// <returns> The sampling mode. </returns>
+        SourceSamplingMode GetSamplingMode() const { return _samplingMode; }
+
         /// <summary> Gets the name of this type (for serialization). </summary>
         ///
         /// <returns> The name of this type. </returns>
@@ -97,6 +135,7 @@ namespace nodes
     private:
         void SetOutputValuesLoop(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function, llvm::Value* sample);
         void SetOutputValuesExpanded(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function, llvm::Value* sample);
+        void StopProducerThread();
 
     private:
         model::InputPort<TimeTickType> _input;
@@ -105,6 +144,13 @@ namespace nodes
 
         mutable std::vector<ValueType> _bufferedSample;
         mutable TimeTickType _bufferedSampleTime;
+
+        // asynchronous sampling state (runtime-only, not archived)
+        SourceSamplingMode _samplingMode = SourceSamplingMode::synchronous;
+        size_t _bufferCapacity = 16;
+        mutable std::unique_ptr<utilities::SpscRingBuffer<std::vector<ValueType>>> _pSampleBuffer;
+        std::thread _producerThread;
+        std::atomic<bool> _stopProducer{ false };
     };
 }
 }
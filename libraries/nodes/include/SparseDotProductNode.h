@@ -0,0 +1,105 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     SparseDotProductNode.h (nodes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// model
+#include "CompilableNode.h"
+#include "CompilableNodeUtilities.h"
+#include "IRMapCompiler.h"
+#include "InputPort.h"
+#include "MapCompiler.h"
+#include "ModelTransformer.h"
+#include "Node.h"
+#include "OutputPort.h"
+#include "PortElements.h"
+
+// utilities
+#include "Exception.h"
+#include "TypeName.h"
+
+// stl
+#include <string>
+
+namespace ell
+{
+namespace nodes
+{
+    /// <summary> A node that takes a dense vector, plus a sparse vector given as parallel index and
+    /// value inputs, and returns their dot product: sum of input1[indices[i]] * input2[i]. Indices
+    /// must be within the bounds of input1; unused index/value slots can be padded with value 0. </summary>
+    template <typename ValueType>
+    class SparseDotProductNode : public model::CompilableNode
+    {
+    public:
+        /// @name Input and Output Ports
+        /// @{
+        static constexpr const char* dummy = ""; // Workaround for an apparent VC++ bug
+        static constexpr const char* input1PortName = "input1";
+        static constexpr const char* input2PortName = "input2";
+        static constexpr const char* indicesPortName = "indices";
+        static constexpr const char* outputPortName = "output";
+        const model::InputPort<ValueType>& input1 = _input1;
+        const model::InputPort<ValueType>& input2 = _input2;
+        const model::InputPort<int>& indices = _indices;
+        const model::OutputPort<ValueType>& output = _output;
+        /// @}
+
+        /// <summary> Default Constructor </summary>
+        SparseDotProductNode();
+
+        /// <summary> Constructor </summary>
+        ///
+        /// <param name="input1"> The dense vector to gather elements from </param>
+        /// <param name="input2"> The values of the sparse vector's nonzero entries </param>
+        /// <param name="indices"> The positions of the sparse vector's nonzero entries, parallel to input2 </param>
+        SparseDotProductNode(const model::PortElements<ValueType>& input1, const model::PortElements<ValueType>& input2, const model::PortElements<int>& indices);
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        static std::string GetTypeName() { return utilities::GetCompositeTypeName<ValueType>("SparseDotProductNode"); }
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        virtual std::string GetRuntimeTypeName() const override { return GetTypeName(); }
+
+        /// <summary> Adds an object's properties to an `Archiver` </summary>
+        ///
+        /// <param name="archiver"> The `Archiver` to add the values from the object to </param>
+        virtual void WriteToArchive(utilities::Archiver& archiver) const override;
+
+        /// <summary> Sets the internal state of the object according to the archiver passed in </summary>
+        ///
+        /// <param name="archiver"> The `Archiver` to get state from </param>
+        virtual void ReadFromArchive(utilities::Unarchiver& archiver) override;
+
+        /// <summary> Makes a copy of this node in the model being constructed by the transformer </summary>
+        ///
+        /// <param name="transformer"> The `ModelTransformer` currently copying the model </param>
+        virtual void Copy(model::ModelTransformer& transformer) const override;
+
+    protected:
+        virtual void Compute() const override;
+        virtual void Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function) override;
+        virtual bool HasComputeState() const override { return false; }
+
+    private:
+        // Inputs
+        model::InputPort<ValueType> _input1;
+        model::InputPort<ValueType> _input2;
+        model::InputPort<int> _indices;
+
+        // Output
+        model::OutputPort<ValueType> _output;
+    };
+}
+}
+
+#include "../tcc/SparseDotProductNode.tcc"
@@ -0,0 +1,108 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     SparseLinearPredictorNode.h (nodes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// model
+#include "Model.h"
+#include "ModelTransformer.h"
+#include "Node.h"
+
+// predictors
+#include "LinearPredictor.h"
+
+// stl
+#include <string>
+
+namespace ell
+{
+namespace nodes
+{
+    /// <summary> A node that represents a linear predictor over a sparse input. The input is given as
+    /// parallel index and value vectors describing the nonzero entries, so scoring only touches the
+    /// nonzeros instead of the full (possibly very high-dimensional) input. Indices must be within the
+    /// predictor's dimension; unused index/value slots can be padded with value 0. Unlike
+    /// `LinearPredictorNode`, there is no weightedElements output, since that output is as large as the
+    /// dense input. </summary>
+    class SparseLinearPredictorNode : public model::Node
+    {
+    public:
+        /// @name Input and Output Ports
+        /// @{
+        static constexpr const char* valuesPortName = "values";
+        static constexpr const char* indicesPortName = "indices";
+        static constexpr const char* outputPortName = "output";
+        const model::InputPort<double>& values = _values;
+        const model::InputPort<int>& indices = _indices;
+        const model::OutputPort<double>& output = _output;
+        /// @}
+
+        using LinearPredictor = predictors::LinearPredictor;
+
+        /// <summary> Default Constructor </summary>
+        SparseLinearPredictorNode();
+
+        /// <summary> Constructor </summary>
+        ///
+        /// <param name="values"> The values of the input's nonzero entries </param>
+        /// <param name="indices"> The positions of the input's nonzero entries, parallel to values </param>
+        /// <param name="predictor"> The linear predictor to use when making the prediction. </param>
+        SparseLinearPredictorNode(const model::PortElements<double>& values, const model::PortElements<int>& indices, const LinearPredictor& predictor);
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        static std::string GetTypeName() { return "SparseLinearPredictorNode"; }
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        virtual std::string GetRuntimeTypeName() const override { return GetTypeName(); }
+
+        /// <summary> Adds an object's properties to an `Archiver` </summary>
+        ///
+        /// <param name="archiver"> The `Archiver` to add the values from the object to </param>
+        virtual void WriteToArchive(utilities::Archiver& archiver) const override;
+
+        /// <summary> Sets the internal state of the object according to the archiver passed in </summary>
+        ///
+        /// <param name="archiver"> The `Archiver` to get state from </param>
+        virtual void ReadFromArchive(utilities::Unarchiver& archiver) override;
+
+        /// <summary> Makes a copy of this node in the model being constructed by the transformer </summary>
+        virtual void Copy(model::ModelTransformer& transformer) const override;
+
+        /// <summary> Refines this node in the model being constructed by the transformer </summary>
+        virtual bool Refine(model::ModelTransformer& transformer) const override;
+
+    protected:
+        virtual void Compute() const override;
+
+    private:
+        // Inputs
+        model::InputPort<double> _values;
+        model::InputPort<int> _indices;
+
+        // Output
+        model::OutputPort<double> _output;
+
+        // Linear predictor
+        LinearPredictor _predictor;
+    };
+
+    /// <summary> Adds a sparse linear predictor node to a model transformer. </summary>
+    ///
+    /// <param name="values"> The values of the input's nonzero entries. </param>
+    /// <param name="indices"> The positions of the input's nonzero entries. </param>
+    /// <param name="predictor"> The linear predictor. </param>
+    /// <param name="transformer"> [in,out] The model transformer. </param>
+    ///
+    /// <returns> The node added to the model. </returns>
+    SparseLinearPredictorNode* AddNodeToModelTransformer(const model::PortElements<double>& values, const model::PortElements<int>& indices, const predictors::LinearPredictor& predictor, model::ModelTransformer& transformer);
+}
+}
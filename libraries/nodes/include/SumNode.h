@@ -24,6 +24,7 @@
 
 // stl
 #include <string>
+#include <vector>
 
 namespace ell
 {
@@ -76,6 +77,7 @@ namespace nodes
     protected:
         virtual void Compute() const override;
         virtual void Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function) override;
+        virtual bool HasComputeState() const override { return false; }
 
     private:
         void CompileLoop(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function);
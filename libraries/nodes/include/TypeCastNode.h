@@ -8,6 +8,9 @@
 
 #pragma once
 
+// nodes
+#include "ConstantNode.h"
+
 // model
 #include "CompilableNode.h"
 #include "IRMapCompiler.h"
@@ -74,6 +77,8 @@ namespace nodes
         virtual void Compute() const override;
         virtual void Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function) override;
         virtual bool ShouldCompileInline() const override { return true; }
+        virtual bool HasComputeState() const override { return false; }
+        virtual bool Fold(model::ModelTransformer& transformer) const override;
 
         model::InputPort<InputValueType> _input;
         model::OutputPort<OutputValueType> _output;
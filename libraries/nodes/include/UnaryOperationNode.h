@@ -8,6 +8,9 @@
 
 #pragma once
 
+// nodes
+#include "ConstantNode.h"
+
 // model
 #include "CompilableNode.h"
 #include "IRMapCompiler.h"
@@ -83,9 +86,17 @@ namespace nodes
         /// <returns> The operation </returns>
         emitters::UnaryOperationType GetOperation() const { return _operation; }
 
+        /// <summary> Indicates if this node can be fused into an elementwise loop with its neighbors </summary>
+        virtual bool IsElementwise() const override;
+
+        /// <summary> Emits the code that computes one output element, for use inside a fused loop </summary>
+        virtual llvm::Value* CompileElementwise(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function, llvm::Value* index, llvm::Value* chainValue) override;
+
     protected:
         virtual void Compute() const override;
         virtual void Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function) override;
+        virtual bool HasComputeState() const override { return false; }
+        virtual bool Fold(model::ModelTransformer& transformer) const override;
 
     private:
         llvm::Function* GetOperator(emitters::IRFunctionEmitter& function) const;
@@ -93,7 +104,8 @@ namespace nodes
         void CompileExpanded(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function);
 
         template <typename Operation>
-        std::vector<ValueType> ComputeOutput(Operation&& function) const;
+        static std::vector<ValueType> ComputeOutput(Operation&& function, const std::vector<ValueType>& inputValues);
+        std::vector<ValueType> ComputeOutput(const std::vector<ValueType>& inputValues) const;
 
         // Inputs
         model::InputPort<ValueType> _input;
@@ -0,0 +1,61 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     WeightClustering.h (nodes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// stl
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace ell
+{
+namespace nodes
+{
+    /// <summary> The result of clustering a set of weights: a small codebook of representative
+    /// values and one codebook index per weight, along with the quantization error. </summary>
+    template <typename ValueType>
+    struct WeightCodebook
+    {
+        /// <summary> The representative weight values (the cluster centers). </summary>
+        std::vector<ValueType> codebook;
+
+        /// <summary> One codebook index per weight, in the original order. </summary>
+        std::vector<uint8_t> indices;
+
+        /// <summary> The largest absolute difference between a weight and its representative. </summary>
+        double maxAbsoluteError = 0;
+
+        /// <summary> The mean absolute difference between the weights and their representatives. </summary>
+        double meanAbsoluteError = 0;
+    };
+
+    /// <summary> Clusters a set of weights into a codebook of at most the given number of
+    /// representative values, using one-dimensional k-means (centers initialized at evenly spaced
+    /// quantiles, then refined with Lloyd iterations). </summary>
+    ///
+    /// <typeparam name="ValueType"> The weight element type. </typeparam>
+    /// <param name="values"> The weights to cluster. </param>
+    /// <param name="numClusters"> The maximum codebook size; at most 256, so indices fit in a byte. </param>
+    ///
+    /// <returns> The codebook, the per-weight indices, and the quantization error. </returns>
+    template <typename ValueType>
+    WeightCodebook<ValueType> ClusterWeights(const std::vector<ValueType>& values, size_t numClusters);
+
+    /// <summary> Packs codebook indices into 32-bit words, `32 / bitsPerIndex` indices per word (so
+    /// no index straddles a word boundary), least significant bits first. </summary>
+    ///
+    /// <param name="indices"> The codebook indices; each must fit in bitsPerIndex bits. </param>
+    /// <param name="bitsPerIndex"> The number of bits per index (at most 8). </param>
+    ///
+    /// <returns> The packed words. </returns>
+    std::vector<int> PackWeightIndices(const std::vector<uint8_t>& indices, size_t bitsPerIndex);
+}
+}
+
+#include "../tcc/WeightClustering.tcc"
@@ -0,0 +1,97 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     WelfordVarianceNode.h (nodes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// model
+#include "CompilableNodeUtilities.h"
+#include "CompilableNode.h"
+#include "IRMapCompiler.h"
+#include "MapCompiler.h"
+#include "Model.h"
+#include "ModelTransformer.h"
+#include "Node.h"
+
+// utilities
+#include "TypeName.h"
+
+// stl
+#include <string>
+#include <vector>
+
+namespace ell
+{
+namespace nodes
+{
+    /// <summary> A node that maintains the running (population) variance of everything it has seen,
+    /// using Welford's recurrence: `delta = x - mean; mean += delta / n; m2 += delta * (x - mean)`.
+    /// Each update is O(1) per element and numerically stable, where `MovingVarianceNode`'s
+    /// sum-of-squares formulation over a window loses precision as the mean grows. </summary>
+    template <typename ValueType>
+    class WelfordVarianceNode : public model::CompilableNode
+    {
+    public:
+        /// @name Input and Output Ports
+        /// @{
+        static constexpr const char* inputPortName = "input";
+        static constexpr const char* outputPortName = "output";
+        const model::InputPort<ValueType>& input = _input;
+        const model::OutputPort<ValueType>& output = _output;
+        /// @}
+
+        /// <summary> Default Constructor </summary>
+        WelfordVarianceNode();
+
+        /// <summary> Constructor </summary>
+        /// <param name="input"> The signal to take the variance of </param>
+        WelfordVarianceNode(const model::PortElements<ValueType>& input);
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        static std::string GetTypeName() { return utilities::GetCompositeTypeName<ValueType>("WelfordVarianceNode"); }
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        virtual std::string GetRuntimeTypeName() const override { return GetTypeName(); }
+
+        /// <summary> Adds an object's properties to an `Archiver` </summary>
+        ///
+        /// <param name="archiver"> The `Archiver` to add the values from the object to </param>
+        virtual void WriteToArchive(utilities::Archiver& archiver) const override;
+
+        /// <summary> Sets the internal state of the object according to the archiver passed in </summary>
+        ///
+        /// <param name="archiver"> The `Archiver` to get state from </param>
+        virtual void ReadFromArchive(utilities::Unarchiver& archiver) override;
+
+        /// <summary> Makes a copy of this node in the model being constructed by the transformer </summary>
+        virtual void Copy(model::ModelTransformer& transformer) const override;
+
+    protected:
+        virtual void Compute() const override;
+        virtual void Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function) override;
+        virtual bool HasState() const override { return true; }
+
+    private:
+        // Input
+        model::InputPort<ValueType> _input;
+
+        // Output
+        model::OutputPort<ValueType> _output;
+
+        // State
+        mutable ValueType _count = 0; // held as ValueType so the compiled and interpreted recurrences match exactly
+        mutable std::vector<ValueType> _mean;
+        mutable std::vector<ValueType> _m2;
+    };
+}
+}
+
+#include "../tcc/WelfordVarianceNode.tcc"
@@ -0,0 +1,112 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     WindowFunctionNode.h (nodes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// model
+#include "CompilableNode.h"
+#include "IRMapCompiler.h"
+#include "InputPort.h"
+#include "MapCompiler.h"
+#include "ModelTransformer.h"
+#include "Node.h"
+#include "OutputPort.h"
+#include "PortElements.h"
+
+// utilities
+#include "Exception.h"
+#include "IArchivable.h"
+#include "TypeName.h"
+
+// stl
+#include <string>
+#include <vector>
+
+namespace ell
+{
+namespace nodes
+{
+    /// <summary> The window shapes a `WindowFunctionNode` can apply. </summary>
+    enum class WindowShape
+    {
+        hann,
+        hamming
+    };
+
+    /// <summary> A node that multiplies its input elementwise by a fixed tapering window
+    /// (Hann or Hamming), as applied to an assembled frame before computing spectral features.
+    /// The coefficients are computed once at construction and compiled into the model as
+    /// constants. </summary>
+    template <typename ValueType>
+    class WindowFunctionNode : public model::CompilableNode
+    {
+    public:
+        /// @name Input and Output Ports
+        /// @{
+        static constexpr const char* outputPortName = "output";
+        static constexpr const char* inputPortName = "input";
+        const model::InputPort<ValueType>& input = _input;
+        const model::OutputPort<ValueType>& output = _output;
+        /// @}
+
+        /// <summary> Default Constructor </summary>
+        WindowFunctionNode();
+
+        /// <summary> Constructor </summary>
+        ///
+        /// <param name="input"> The frame to taper </param>
+        /// <param name="windowShape"> The window to apply </param>
+        WindowFunctionNode(const model::PortElements<ValueType>& input, WindowShape windowShape);
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        static std::string GetTypeName() { return utilities::GetCompositeTypeName<ValueType>("WindowFunctionNode"); }
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        virtual std::string GetRuntimeTypeName() const override { return GetTypeName(); }
+
+        /// <summary> Adds an object's properties to an `Archiver` </summary>
+        ///
+        /// <param name="archiver"> The `Archiver` to add the values from the object to </param>
+        virtual void WriteToArchive(utilities::Archiver& archiver) const override;
+
+        /// <summary> Sets the internal state of the object according to the archiver passed in </summary>
+        ///
+        /// <param name="archiver"> The `Archiver` to get state from </param>
+        virtual void ReadFromArchive(utilities::Unarchiver& archiver) override;
+
+        /// <summary> Makes a copy of this node in the model being constructed by the transformer </summary>
+        virtual void Copy(model::ModelTransformer& transformer) const override;
+
+        /// <summary>Return the window shape</summary>
+        WindowShape GetWindowShape() const { return _windowShape; }
+
+    protected:
+        virtual void Compute() const override;
+        virtual void Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function) override;
+        virtual bool HasState() const override { return true; } // stored state: the window shape
+
+    private:
+        void ComputeCoefficients();
+
+        // Inputs
+        model::InputPort<ValueType> _input;
+
+        // Output
+        model::OutputPort<ValueType> _output;
+
+        WindowShape _windowShape = WindowShape::hann;
+        std::vector<ValueType> _coefficients;
+    };
+}
+}
+
+#include "../tcc/WindowFunctionNode.tcc"
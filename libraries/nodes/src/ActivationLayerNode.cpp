@@ -92,7 +92,10 @@ namespace nodes
     template <typename ValueType>
     llvm::Value* SigmoidActivationFunction<ValueType>::Compile(emitters::IRFunctionEmitter& function, llvm::Value* x) const
     {
-        auto expFunc = function.GetModule().GetRuntime().GetExpFunction<ValueType>();
+        // the fast approximation clamps internally, so it doesn't need the sign-splitting below,
+        // but keeping a single code path keeps the two variants comparable
+        auto useFastMath = function.GetModule().GetCompilerParameters().useFastMath;
+        auto expFunc = useFastMath ? function.GetModule().GetRuntime().GetFastExpFunction<ValueType>() : function.GetModule().GetRuntime().GetExpFunction<ValueType>();
 
         llvm::Value* result = function.Variable(emitters::GetVariableType<ValueType>(), "result");
         auto ifEmitter = function.If();
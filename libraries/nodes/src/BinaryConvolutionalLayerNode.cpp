@@ -495,10 +495,28 @@ namespace nodes
         // compute and accumulate xnor counts
         const auto filterDrop = fieldVolumeSize % numBits;
         const auto filterAdjust = numBits - filterDrop;
-        auto rowLoop = function.ForLoop();
-        rowLoop.Begin(outputHeight);
-        {
-            auto outRow = rowLoop.LoadIterationVariable();
+
+        // Number of independent accumulator lanes for the block loop. Unrolling the loop over
+        // separate accumulators removes the loop-carried dependency, so LLVM's vectorizer can
+        // lower the XOR+popcount body to SIMD popcount sequences (vpshufb-based on AVX2,
+        // vcnt on NEON) instead of a scalar chain.
+        const int numAccumLanes = 4;
+        const int numUnrolledBlocks = packedRowSize / numAccumLanes;
+        const int numLeftoverBlocks = packedRowSize % numAccumLanes;
+
+        // The output rows are independent, so the row loop can be split across worker threads
+        function.ParallelFor(outputHeight, { pInput, pFilterWeights, pFilterMeans, pOutput }, [&](emitters::IRFunctionEmitter& function, llvm::Value* outRow, const std::vector<llvm::Value*>& capturedValues) {
+            auto pInput = capturedValues[0];
+            auto pFilterWeights = capturedValues[1];
+            auto pFilterMeans = capturedValues[2];
+            auto pOutput = capturedValues[3];
+
+            std::vector<llvm::Value*> sumVars(numAccumLanes);
+            for (int lane = 0; lane < numAccumLanes; ++lane)
+            {
+                sumVars[lane] = function.Variable(packedBitsType, "accum");
+            }
+
             auto outputRowOffset = function.Operator(times, outRow, function.Literal<int>(packedRowSize * outputWidth));
             auto colLoop = function.ForLoop();
             colLoop.Begin(outputWidth);
@@ -514,29 +532,52 @@ namespace nodes
                     llvm::Value* filterMean = function.ValueAt(pFilterMeans, outChannel);
                     auto filterBegin = function.Operator(times, outChannel, function.Literal<int>(numStoredBlocksPerFilter));
 
-                    llvm::Value* sumVar = function.Variable(packedBitsType, "accum");
-                    function.Store(sumVar, function.Literal<PackedBitsType>(0));
+                    for (int lane = 0; lane < numAccumLanes; ++lane)
+                    {
+                        function.Store(sumVars[lane], function.Literal<PackedBitsType>(0));
+                    }
 
-                    // TODO: vectorize this (?)
-                    auto blockLoop = function.ForLoop();
-                    blockLoop.Begin(packedRowSize);
+                    if (numUnrolledBlocks > 0)
                     {
-                        auto blockIndex = blockLoop.LoadIterationVariable();
-                        auto inputIndex = function.Operator(plus, inputBegin, blockIndex);
-                        auto inputVal = function.ValueAt(pInput, inputIndex);
+                        auto blockLoop = function.ForLoop();
+                        blockLoop.Begin(numUnrolledBlocks);
+                        {
+                            auto unrolledBlockIndex = blockLoop.LoadIterationVariable();
+                            auto blockBase = function.Operator(times, unrolledBlockIndex, function.Literal<int>(numAccumLanes));
+                            for (int lane = 0; lane < numAccumLanes; ++lane)
+                            {
+                                auto blockIndex = function.Operator(plus, blockBase, function.Literal<int>(lane));
+                                auto inputVal = function.ValueAt(pInput, function.Operator(plus, inputBegin, blockIndex));
+                                auto filterVal = function.ValueAt(pFilterWeights, function.Operator(plus, filterBegin, blockIndex));
+                                auto xorVal = function.Operator(emitters::TypedOperator::logicalXor, filterVal, inputVal);
+                                auto count = function.Call(popcountFunction, { xorVal });
+                                function.Store(sumVars[lane], function.Operator(plus, count, function.Load(sumVars[lane])));
+                            }
+                        }
+                        blockLoop.End();
+                    }
 
-                        auto filterIndex = function.Operator(plus, filterBegin, blockIndex);
-                        auto filterVal = function.ValueAt(pFilterWeights, filterIndex);
+                    // The last few blocks, if the packed row isn't a multiple of the number of lanes
+                    for (int leftover = 0; leftover < numLeftoverBlocks; ++leftover)
+                    {
+                        auto blockIndex = function.Literal<int>(numUnrolledBlocks * numAccumLanes + leftover);
+                        auto inputVal = function.ValueAt(pInput, function.Operator(plus, inputBegin, blockIndex));
+                        auto filterVal = function.ValueAt(pFilterWeights, function.Operator(plus, filterBegin, blockIndex));
                         auto xorVal = function.Operator(emitters::TypedOperator::logicalXor, filterVal, inputVal);
                         auto count = function.Call(popcountFunction, { xorVal });
-                        function.Store(sumVar, function.Operator(plus, count, function.Load(sumVar)));
+                        function.Store(sumVars[leftover], function.Operator(plus, count, function.Load(sumVars[leftover])));
                     }
-                    blockLoop.End();
-                    auto sumInt = function.CastValue<PackedBitsType, int>(function.Load(sumVar));
+
+                    // Horizontal reduction of the accumulator lanes
+                    llvm::Value* sum = function.Load(sumVars[0]);
+                    for (int lane = 1; lane < numAccumLanes; ++lane)
+                    {
+                        sum = function.Operator(plus, sum, function.Load(sumVars[lane]));
+                    }
+                    auto sumInt = function.CastValue<PackedBitsType, int>(sum);
                     auto scaledSum = function.Operator(plus, function.Operator(times, function.Literal<int>(-2), sumInt), function.Literal<int>(numBits * packedRowSize));
                     auto sumFloat = function.CastValue<int, ValueType>(scaledSum);
 
-
                     llvm::Value* adjustedSum = sumFloat;
                     if (filterDrop != 0)
                     {
@@ -550,8 +591,7 @@ namespace nodes
                 channelLoop.End();
             }
             colLoop.End();
-        }
-        rowLoop.End();
+        });
     }
 
     // Explicit specialization
@@ -0,0 +1,231 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     BlockSparseMatrixVectorMultiplyNode.cpp (nodes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "BlockSparseMatrixVectorMultiplyNode.h"
+
+// emitters
+#include "VectorVariable.h"
+
+// stl
+#include <algorithm>
+
+namespace ell
+{
+namespace nodes
+{
+    namespace
+    {
+        // Useful aliases for operators
+        const auto plus = emitters::TypedOperator::add;
+        const auto plusFloat = emitters::TypedOperator::addFloat;
+        const auto timesFloat = emitters::TypedOperator::multiplyFloat;
+    }
+
+    template <typename ValueType>
+    BlockSparseMatrixVectorMultiplyNode<ValueType>::BlockSparseMatrixVectorMultiplyNode()
+        : CompilableNode({ &_inputValues, &_inputVector }, { &_output }), _inputValues(this, {}, inputValuesPortName), _inputVector(this, {}, inputVectorPortName), _output(this, outputPortName, 0), _m(0), _n(0), _blockSize(0)
+    {
+    }
+
+    template <typename ValueType>
+    BlockSparseMatrixVectorMultiplyNode<ValueType>::BlockSparseMatrixVectorMultiplyNode(const model::PortElements<ValueType>& inputValues, size_t m, size_t n, size_t blockSize, std::vector<size_t> blockRows, std::vector<size_t> blockColumns, const model::PortElements<ValueType>& inputVector)
+        : CompilableNode({ &_inputValues, &_inputVector }, { &_output }), _inputValues(this, inputValues, inputValuesPortName), _inputVector(this, inputVector, inputVectorPortName), _output(this, outputPortName, m), _m(m), _n(n), _blockSize(blockSize), _blockRows(std::move(blockRows)), _blockColumns(std::move(blockColumns))
+    {
+        if (blockSize == 0 || _blockRows.size() != _blockColumns.size())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Block index lists must be parallel and the block size positive");
+        }
+
+        if (inputValues.Size() != _blockRows.size() * blockSize * blockSize)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Input sizes must match");
+        }
+
+        if (inputVector.Size() != n)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Input sizes must match");
+        }
+    }
+
+    template <typename ValueType>
+    void BlockSparseMatrixVectorMultiplyNode<ValueType>::Compute() const
+    {
+        auto inputValuesData = inputValues.GetValue();
+        auto inputVectorData = inputVector.GetValue();
+        std::vector<ValueType> outputValues(_m, 0);
+
+        for (size_t block = 0; block < _blockRows.size(); ++block)
+        {
+            auto firstRow = _blockRows[block] * _blockSize;
+            auto firstColumn = _blockColumns[block] * _blockSize;
+            auto blockRows = std::min(_blockSize, _m - firstRow);
+            auto blockColumns = std::min(_blockSize, _n - firstColumn);
+            const ValueType* blockValues = &inputValuesData[block * _blockSize * _blockSize];
+            for (size_t i = 0; i < blockRows; ++i)
+            {
+                ValueType sum = 0;
+                for (size_t j = 0; j < blockColumns; ++j)
+                {
+                    sum += blockValues[i * _blockSize + j] * inputVectorData[firstColumn + j];
+                }
+                outputValues[firstRow + i] += sum;
+            }
+        }
+
+        _output.SetOutput(outputValues);
+    };
+
+    template <typename ValueType>
+    void BlockSparseMatrixVectorMultiplyNode<ValueType>::Copy(model::ModelTransformer& transformer) const
+    {
+        auto valuesElements = transformer.TransformPortElements(_inputValues.GetPortElements());
+        auto vectorElements = transformer.TransformPortElements(_inputVector.GetPortElements());
+        auto newNode = transformer.AddNode<BlockSparseMatrixVectorMultiplyNode<ValueType>>(valuesElements, _m, _n, _blockSize, _blockRows, _blockColumns, vectorElements);
+        transformer.MapNodeOutput(output, newNode->output);
+    }
+
+    template <typename ValueType>
+    void BlockSparseMatrixVectorMultiplyNode<ValueType>::Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function)
+    {
+        llvm::Value* pValues = compiler.EnsurePortEmitted(inputValues);
+        llvm::Value* pVector = compiler.EnsurePortEmitted(inputVector);
+        llvm::Value* pOutput = compiler.EnsurePortEmitted(output);
+
+        int blockSize = static_cast<int>(_blockSize);
+
+        // zero the output, then accumulate each kept block into it
+        auto zeroLoop = function.ForLoop();
+        zeroLoop.Begin(static_cast<int>(_m));
+        {
+            auto i = zeroLoop.LoadIterationVariable();
+            function.SetValueAt(pOutput, i, function.Literal(static_cast<ValueType>(0.0)));
+        }
+        zeroLoop.End();
+
+        // partition the blocks: interior blocks share one runtime loop driven by embedded offset
+        // tables, and the few blocks overhanging the matrix edge are emitted separately below with
+        // clamped extents
+        std::vector<int> rowOffsets;
+        std::vector<int> columnOffsets;
+        std::vector<int> valueOffsets;
+        std::vector<size_t> edgeBlocks;
+        for (size_t block = 0; block < _blockRows.size(); ++block)
+        {
+            auto firstRow = _blockRows[block] * _blockSize;
+            auto firstColumn = _blockColumns[block] * _blockSize;
+            if (firstRow + _blockSize <= _m && firstColumn + _blockSize <= _n)
+            {
+                rowOffsets.push_back(static_cast<int>(firstRow));
+                columnOffsets.push_back(static_cast<int>(firstColumn));
+                valueOffsets.push_back(static_cast<int>(block * _blockSize * _blockSize));
+            }
+            else
+            {
+                edgeBlocks.push_back(block);
+            }
+        }
+
+        if (!rowOffsets.empty())
+        {
+            auto& variables = function.GetModule().Variables();
+            llvm::Value* pRowOffsets = function.GetModule().EnsureEmitted(*variables.AddVariable<emitters::LiteralVectorVariable<int>>(rowOffsets));
+            llvm::Value* pColumnOffsets = function.GetModule().EnsureEmitted(*variables.AddVariable<emitters::LiteralVectorVariable<int>>(columnOffsets));
+            llvm::Value* pValueOffsets = function.GetModule().EnsureEmitted(*variables.AddVariable<emitters::LiteralVectorVariable<int>>(valueOffsets));
+
+            llvm::Value* valuePos = function.Variable(emitters::VariableType::Int32, "valuePos");
+            llvm::Value* yPos = function.Variable(emitters::VariableType::Int32, "yPos");
+
+            auto blockLoop = function.ForLoop();
+            blockLoop.Begin(static_cast<int>(rowOffsets.size()));
+            {
+                auto block = blockLoop.LoadIterationVariable();
+                auto columnOffset = function.ValueAt(pColumnOffsets, block);
+                function.Store(valuePos, function.ValueAt(pValueOffsets, block));
+                function.Store(yPos, function.ValueAt(pRowOffsets, block));
+
+                auto rowLoop = function.ForLoop();
+                rowLoop.Begin(blockSize);
+                {
+                    // dense micro-kernel row: the column loop is unrolled at emit time, so the
+                    // body is a straight-line multiply-accumulate chain the backend can vectorize
+                    llvm::Value* sum = nullptr;
+                    for (int j = 0; j < blockSize; ++j)
+                    {
+                        auto weight = function.ValueAt(pValues, function.Operator(plus, function.Load(valuePos), function.Literal(j)));
+                        auto xVal = function.ValueAt(pVector, function.Operator(plus, columnOffset, function.Literal(j)));
+                        auto product = function.Operator(timesFloat, weight, xVal);
+                        sum = (sum == nullptr) ? product : function.Operator(plusFloat, sum, product);
+                    }
+                    auto yIndex = function.Load(yPos);
+                    function.SetValueAt(pOutput, yIndex, function.Operator(plusFloat, function.ValueAt(pOutput, yIndex), sum));
+
+                    function.OperationAndUpdate(valuePos, plus, function.Literal(blockSize));
+                    function.OperationAndUpdate(yPos, plus, function.Literal(1));
+                }
+                rowLoop.End();
+            }
+            blockLoop.End();
+        }
+
+        // edge blocks, with all offsets known at emit time and the extents clamped to the matrix
+        for (auto block : edgeBlocks)
+        {
+            int firstRow = static_cast<int>(_blockRows[block] * _blockSize);
+            int firstColumn = static_cast<int>(_blockColumns[block] * _blockSize);
+            int blockRows = std::min(blockSize, static_cast<int>(_m) - firstRow);
+            int blockColumns = std::min(blockSize, static_cast<int>(_n) - firstColumn);
+            int valueOffset = static_cast<int>(block * _blockSize * _blockSize);
+            for (int i = 0; i < blockRows; ++i)
+            {
+                llvm::Value* sum = nullptr;
+                for (int j = 0; j < blockColumns; ++j)
+                {
+                    auto weight = function.ValueAt(pValues, function.Literal(valueOffset + i * blockSize + j));
+                    auto xVal = function.ValueAt(pVector, function.Literal(firstColumn + j));
+                    auto product = function.Operator(timesFloat, weight, xVal);
+                    sum = (sum == nullptr) ? product : function.Operator(plusFloat, sum, product);
+                }
+                auto yIndex = function.Literal(firstRow + i);
+                function.SetValueAt(pOutput, yIndex, function.Operator(plusFloat, function.ValueAt(pOutput, yIndex), sum));
+            }
+        }
+    }
+
+    template <typename ValueType>
+    void BlockSparseMatrixVectorMultiplyNode<ValueType>::WriteToArchive(utilities::Archiver& archiver) const
+    {
+        Node::WriteToArchive(archiver);
+        archiver[inputValuesPortName] << _inputValues;
+        archiver[inputVectorPortName] << _inputVector;
+        archiver[outputPortName] << _output;
+        archiver["m"] << _m;
+        archiver["n"] << _n;
+        archiver["blockSize"] << _blockSize;
+        archiver["blockRows"] << _blockRows;
+        archiver["blockColumns"] << _blockColumns;
+    }
+
+    template <typename ValueType>
+    void BlockSparseMatrixVectorMultiplyNode<ValueType>::ReadFromArchive(utilities::Unarchiver& archiver)
+    {
+        Node::ReadFromArchive(archiver);
+        archiver[inputValuesPortName] >> _inputValues;
+        archiver[inputVectorPortName] >> _inputVector;
+        archiver[outputPortName] >> _output;
+        archiver["m"] >> _m;
+        archiver["n"] >> _n;
+        archiver["blockSize"] >> _blockSize;
+        archiver["blockRows"] >> _blockRows;
+        archiver["blockColumns"] >> _blockColumns;
+    }
+
+    // Explicitly instantiate versions
+    template class BlockSparseMatrixVectorMultiplyNode<float>;
+    template class BlockSparseMatrixVectorMultiplyNode<double>;
+}
+}
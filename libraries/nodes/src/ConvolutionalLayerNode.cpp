@@ -12,6 +12,9 @@
 #include "ReorderDataNode.h"
 #include "ReshapeImageNode.h"
 
+// emitters
+#include "TargetTuning.h"
+
 namespace ell
 {
 namespace nodes
@@ -143,7 +146,31 @@ namespace nodes
         auto newInput = transformer.TransformPortElements(this->input.GetPortElements());
 
         bool useDiagonalConvolution = convParams.method == predictors::neural::ConvolutionMethod::diagonal;
-        if (!useDiagonalConvolution || stride != 1 || filterWidth % 2 == 0) // do we also need to require padding be set correctly?
+        bool useWinogradConvolution = convParams.method == predictors::neural::ConvolutionMethod::winograd &&
+                                      stride == 1 && filterWidth == 3 && inputPadding == 1 &&
+                                      outputImageHeight % 2 == 0 && outputImageWidth % 2 == 0 && outputPadding == 0;
+        // With only a few input channels the im2col reshape inflates the input by filterWidth^2 and
+        // dominates the small gemm it feeds, so lower those layers to a direct register-tiled convolution
+        bool useDirectConvolution = !useWinogradConvolution &&
+                                    (!useDiagonalConvolution || stride != 1 || filterWidth % 2 == 0) &&
+                                    inputDepth < 4 && outputPadding == 0;
+        if (useWinogradConvolution)
+        {
+            // Winograd method: the layer has already precomputed the transformed weights
+            auto weightsValues = this->GetLayer().GetWinogradWeights();
+            auto weightsNode = transformer.AddNode<ConstantNode<ValueType>>(weightsValues);
+            auto convNode = transformer.AddNode<WinogradConvolutionNode<ValueType>>(newInput, inputLayout, weightsNode->output, outputLayout, convParams);
+            transformer.MapNodeOutput(this->output, convNode->output);
+        }
+        else if (useDirectConvolution)
+        {
+            // Direct method: no reshaped input, the node reads the raw filter weights
+            auto weightsValues = this->GetLayer().GetWeights().ReferenceAsMatrix().ToArray();
+            auto weightsNode = transformer.AddNode<ConstantNode<ValueType>>(weightsValues);
+            auto convNode = transformer.AddNode<DirectConvolutionNode<ValueType>>(newInput, inputLayout, weightsNode->output, outputLayout, convParams);
+            transformer.MapNodeOutput(this->output, convNode->output);
+        }
+        else if (!useDiagonalConvolution || stride != 1 || filterWidth % 2 == 0) // do we also need to require padding be set correctly?
         {
             // GEMM method
             const auto& weights = this->GetLayer().GetWeightsMatrix();
@@ -354,7 +381,10 @@ namespace nodes
         const size_t outputSize = outputWidth * outputHeight * numFilters;
 
         // computation parameters
-        const size_t batchSize = numFilters;
+        // batching the filters bounds the scratch buffer (and the GEMM working set) to the size the
+        // target's tuning entry says its cache can hold; 0 means process all filters in one pass
+        auto tuning = emitters::GetKernelTuningParameters(compiler.GetCompilerParameters().targetDevice);
+        const size_t batchSize = (tuning.convolutionFilterBatchSize == 0) ? numFilters : std::min(tuning.convolutionFilterBatchSize, numFilters);
         const size_t stackSize = inputWidth;
         // const size_t stackSize = 1;
 
@@ -493,6 +523,478 @@ namespace nodes
         convLoop.End();
     }
 
+    //
+    // DirectConvolutionNode
+    //
+
+    namespace
+    {
+        size_t GetDirectConvolutionOutputSize(const PortMemoryLayout& outputLayout)
+        {
+            return outputLayout.size[0] * outputLayout.size[1] * outputLayout.size[2];
+        }
+    }
+
+    template <typename ValueType>
+    DirectConvolutionNode<ValueType>::DirectConvolutionNode()
+        : CompilableNode({ &_input }, { &_output }), _input(this, {}, inputPortName), _filterWeights(this, {}, filterWeightsPortName), _output(this, outputPortName, 0)
+    {
+    }
+
+    template <typename ValueType>
+    DirectConvolutionNode<ValueType>::DirectConvolutionNode(const model::PortElements<ValueType>& input, const PortMemoryLayout& inputMemoryLayout, const model::PortElements<ValueType>& filterWeights, const PortMemoryLayout& outputMemoryLayout, const predictors::neural::ConvolutionalParameters& convolutionalParameters)
+        : CompilableNode({ &_input, &_filterWeights }, { &_output }), _input(this, input, inputPortName), _filterWeights(this, filterWeights, filterWeightsPortName), _output(this, outputPortName, GetDirectConvolutionOutputSize(outputMemoryLayout)), _inputMemoryLayout(inputMemoryLayout), _outputMemoryLayout(outputMemoryLayout), _convolutionalParameters(convolutionalParameters)
+    {
+    }
+
+    template <typename ValueType>
+    void DirectConvolutionNode<ValueType>::Copy(model::ModelTransformer& transformer) const
+    {
+        auto newInput = transformer.TransformPortElements(_input.GetPortElements());
+        auto newFilterWeights = transformer.TransformPortElements(_filterWeights.GetPortElements());
+        auto newNode = transformer.AddNode<DirectConvolutionNode<ValueType>>(newInput, _inputMemoryLayout, newFilterWeights, _outputMemoryLayout, _convolutionalParameters);
+        transformer.MapNodeOutput(this->output, newNode->output);
+    }
+
+    template <typename ValueType>
+    void DirectConvolutionNode<ValueType>::Compute() const
+    {
+        // Model parameters
+        auto&& inputLayout = this->GetInputMemoryLayout();
+        auto&& outputLayout = this->GetOutputMemoryLayout();
+        auto&& convParams = this->GetConvolutionalParameters();
+        const auto inputDepth = inputLayout.size[2];
+        const auto filterWidth = convParams.receptiveField;
+        const auto stride = convParams.stride;
+        const auto fieldVolumeSize = filterWidth * filterWidth * inputDepth;
+
+        const auto outputWidth = outputLayout.size[1];
+        const auto outputHeight = outputLayout.size[0];
+        const auto numFilters = outputLayout.size[2];
+
+        // input is a (h+2p) x (w+2p) x d array
+        const size_t paddedWidth = inputLayout.stride[1];
+        const size_t inputRowStride = paddedWidth * inputDepth;
+
+        auto inputData = _input.GetValue();
+        auto filterWeightsData = _filterWeights.GetValue();
+        assert(filterWeightsData.size() == fieldVolumeSize * numFilters);
+        std::vector<ValueType> output(outputHeight * outputWidth * numFilters);
+
+        constexpr size_t filterTileSize = 4;
+        for (size_t i = 0; i < outputHeight; i++)
+        {
+            for (size_t j = 0; j < outputWidth; j++)
+            {
+                const size_t inputOffset = i * stride * inputRowStride + j * stride * inputDepth;
+
+                // Tile over the filters so each loaded input value feeds several accumulators held in registers
+                for (size_t filterStart = 0; filterStart < numFilters; filterStart += filterTileSize)
+                {
+                    const size_t numFiltersToUse = std::min(filterTileSize, numFilters - filterStart);
+                    ValueType sums[filterTileSize] = {};
+                    for (size_t fieldRow = 0; fieldRow < filterWidth; fieldRow++)
+                    {
+                        for (size_t fieldColumn = 0; fieldColumn < filterWidth; fieldColumn++)
+                        {
+                            for (size_t channel = 0; channel < inputDepth; channel++)
+                            {
+                                const ValueType inputValue = inputData[inputOffset + fieldRow * inputRowStride + fieldColumn * inputDepth + channel];
+                                const size_t weightsOffset = fieldRow * filterWidth * inputDepth + fieldColumn * inputDepth + channel;
+                                for (size_t l = 0; l < numFiltersToUse; l++)
+                                {
+                                    sums[l] += filterWeightsData[(filterStart + l) * fieldVolumeSize + weightsOffset] * inputValue;
+                                }
+                            }
+                        }
+                    }
+                    for (size_t l = 0; l < numFiltersToUse; l++)
+                    {
+                        output[(i * outputWidth + j) * numFilters + filterStart + l] = sums[l];
+                    }
+                }
+            }
+        }
+
+        _output.SetOutput(output);
+    }
+
+    template <typename ValueType>
+    void DirectConvolutionNode<ValueType>::Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function)
+    {
+        // input is a (h+2p) x (w+2p) x d array
+        llvm::Value* pInput = compiler.EnsurePortEmitted(this->input);
+
+        // weights is an f x k x k x d array
+        llvm::Value* pWeights = compiler.EnsurePortEmitted(this->filterWeights);
+
+        // output is an h x w x f array
+        llvm::Value* pOutput = compiler.EnsurePortEmitted(this->output);
+
+        // Model parameters
+        auto&& inputLayout = this->GetInputMemoryLayout();
+        auto&& outputLayout = this->GetOutputMemoryLayout();
+        auto&& convParams = this->GetConvolutionalParameters();
+        const auto inputDepth = inputLayout.size[2];
+        const int filterWidth = static_cast<int>(convParams.receptiveField);
+        const int stride = static_cast<int>(convParams.stride);
+        const int fieldVolumeSize = static_cast<int>(filterWidth * filterWidth * inputDepth);
+
+        const auto outputWidth = outputLayout.size[1];
+        const auto outputHeight = outputLayout.size[0];
+        const auto numFilters = outputLayout.size[2];
+
+        const size_t paddedWidth = inputLayout.stride[1];
+        const int inputRowStride = static_cast<int>(paddedWidth * inputDepth);
+        const int outputRowStride = static_cast<int>(outputWidth * numFilters);
+
+        // each of the receptive field's rows is its own large-stride stream through the padded
+        // input; the hardware prefetcher can't track them all, so fetch each row's cache line a
+        // few output columns ahead of the walk
+        auto tuning = emitters::GetKernelTuningParameters(compiler.GetCompilerParameters().targetDevice);
+        const int prefetchDistance = static_cast<int>(tuning.prefetchDistance);
+        const bool emitPrefetch = prefetchDistance > 0 && inputRowStride * static_cast<int>(sizeof(ValueType)) >= 64;
+
+        auto rowLoop = function.ForLoop();
+        rowLoop.Begin(outputHeight);
+        {
+            auto i = rowLoop.LoadIterationVariable();
+            auto inputRowOffset = function.Operator(times, i, function.Literal<int>(stride * inputRowStride));
+
+            auto columnLoop = function.ForLoop();
+            columnLoop.Begin(outputWidth);
+            {
+                auto j = columnLoop.LoadIterationVariable();
+                auto inputOffset = function.Operator(plus, inputRowOffset, function.Operator(times, j, function.Literal<int>(stride * static_cast<int>(inputDepth))));
+
+                if (emitPrefetch)
+                {
+                    auto prefetchOffset = function.Operator(plus, inputOffset, function.Literal<int>(prefetchDistance * stride * static_cast<int>(inputDepth)));
+                    for (int fieldRow = 0; fieldRow < filterWidth; fieldRow++)
+                    {
+                        function.Prefetch(pInput, function.Operator(plus, prefetchOffset, function.Literal<int>(fieldRow * inputRowStride)));
+                    }
+                }
+
+                // Load the receptive field volume once per output location; the refining node only
+                // chooses this implementation for small channel counts, so it fits in registers and
+                // every filter below reuses it without touching memory again
+                std::vector<llvm::Value*> fieldValues(fieldVolumeSize);
+                for (int fieldRow = 0; fieldRow < filterWidth; fieldRow++)
+                {
+                    for (int fieldColumn = 0; fieldColumn < filterWidth; fieldColumn++)
+                    {
+                        for (int channel = 0; channel < static_cast<int>(inputDepth); channel++)
+                        {
+                            auto elementOffset = function.Literal<int>(fieldRow * inputRowStride + fieldColumn * static_cast<int>(inputDepth) + channel);
+                            auto fieldIndex = (fieldRow * filterWidth + fieldColumn) * static_cast<int>(inputDepth) + channel;
+                            fieldValues[fieldIndex] = function.ValueAt(pInput, function.Operator(plus, inputOffset, elementOffset));
+                        }
+                    }
+                }
+
+                auto filterLoop = function.ForLoop();
+                filterLoop.Begin(numFilters);
+                {
+                    auto filterIndex = filterLoop.LoadIterationVariable();
+                    auto weightsOffset = function.Operator(times, filterIndex, function.Literal<int>(fieldVolumeSize));
+
+                    llvm::Value* sum = nullptr;
+                    for (int fieldIndex = 0; fieldIndex < fieldVolumeSize; fieldIndex++)
+                    {
+                        auto weight = function.ValueAt(pWeights, function.Operator(plus, weightsOffset, function.Literal<int>(fieldIndex)));
+                        auto product = function.Operator(timesFloat, weight, fieldValues[fieldIndex]);
+                        if (sum == nullptr)
+                            sum = product;
+                        else
+                            sum = function.Operator(plusFloat, sum, product);
+                    }
+
+                    auto outputRowOffset = function.Operator(times, i, function.Literal<int>(outputRowStride));
+                    auto outputColumnOffset = function.Operator(times, j, function.Literal<int>(static_cast<int>(numFilters)));
+                    auto outputIndex = function.Operator(plus, function.Operator(plus, outputRowOffset, outputColumnOffset), filterIndex);
+                    function.SetValueAt(pOutput, outputIndex, sum);
+                }
+                filterLoop.End();
+            }
+            columnLoop.End();
+        }
+        rowLoop.End();
+    }
+
+    //
+    // WinogradConvolutionNode
+    //
+
+    namespace
+    {
+        size_t GetWinogradConvolutionOutputSize(const PortMemoryLayout& outputLayout)
+        {
+            return outputLayout.size[0] * outputLayout.size[1] * outputLayout.size[2];
+        }
+    }
+
+    template <typename ValueType>
+    WinogradConvolutionNode<ValueType>::WinogradConvolutionNode()
+        : CompilableNode({ &_input }, { &_output }), _input(this, {}, inputPortName), _filterWeights(this, {}, filterWeightsPortName), _output(this, outputPortName, 0)
+    {
+    }
+
+    template <typename ValueType>
+    WinogradConvolutionNode<ValueType>::WinogradConvolutionNode(const model::PortElements<ValueType>& input, const PortMemoryLayout& inputMemoryLayout, const model::PortElements<ValueType>& filterWeights, const PortMemoryLayout& outputMemoryLayout, const predictors::neural::ConvolutionalParameters& convolutionalParameters)
+        : CompilableNode({ &_input, &_filterWeights }, { &_output }), _input(this, input, inputPortName), _filterWeights(this, filterWeights, filterWeightsPortName), _output(this, outputPortName, GetWinogradConvolutionOutputSize(outputMemoryLayout)), _inputMemoryLayout(inputMemoryLayout), _outputMemoryLayout(outputMemoryLayout), _convolutionalParameters(convolutionalParameters)
+    {
+    }
+
+    template <typename ValueType>
+    void WinogradConvolutionNode<ValueType>::Copy(model::ModelTransformer& transformer) const
+    {
+        auto newInput = transformer.TransformPortElements(_input.GetPortElements());
+        auto newFilterWeights = transformer.TransformPortElements(_filterWeights.GetPortElements());
+        auto newNode = transformer.AddNode<WinogradConvolutionNode<ValueType>>(newInput, _inputMemoryLayout, newFilterWeights, _outputMemoryLayout, _convolutionalParameters);
+        transformer.MapNodeOutput(this->output, newNode->output);
+    }
+
+    template <typename ValueType>
+    void WinogradConvolutionNode<ValueType>::Compute() const
+    {
+        // Model parameters
+        auto&& inputLayout = this->GetInputMemoryLayout();
+        auto&& outputLayout = this->GetOutputMemoryLayout();
+        const auto inputDepth = inputLayout.size[2];
+        const auto padding = inputLayout.offset[0];
+
+        const auto outputWidth = outputLayout.size[1];
+        const auto outputHeight = outputLayout.size[0];
+        const auto numFilters = outputLayout.size[2];
+
+        const size_t paddedWidth = outputWidth + 2 * padding;
+        const size_t paddedHeight = outputHeight + 2 * padding;
+        assert(_input.Size() == paddedWidth * paddedHeight * inputDepth);
+
+        const size_t inputRowStride = paddedWidth * inputDepth;
+        const size_t outputRowStride = outputWidth * numFilters;
+
+        // The refining node only chooses this implementation for even-sized outputs
+        const size_t numTileRows = outputHeight / 2;
+        const size_t numTileColumns = outputWidth / 2;
+
+        auto inputData = _input.GetValue();
+        auto filterWeightsData = _filterWeights.GetValue();
+        assert(filterWeightsData.size() == 16 * inputDepth * numFilters);
+        std::vector<ValueType> output(outputHeight * outputWidth * numFilters);
+
+        for (size_t filterIndex = 0; filterIndex < numFilters; filterIndex++)
+        {
+            for (size_t tileRow = 0; tileRow < numTileRows; tileRow++)
+            {
+                for (size_t tileColumn = 0; tileColumn < numTileColumns; tileColumn++)
+                {
+                    // Accumulate the transformed elementwise products over the channels
+                    ValueType tile[4][4] = {};
+                    for (size_t channel = 0; channel < inputDepth; channel++)
+                    {
+                        // Gather the 4x4 input tile (the input includes the padding)
+                        ValueType d[4][4];
+                        size_t inputOffset = 2 * tileRow * inputRowStride + 2 * tileColumn * inputDepth + channel;
+                        for (size_t i = 0; i < 4; i++)
+                        {
+                            for (size_t j = 0; j < 4; j++)
+                            {
+                                d[i][j] = inputData[inputOffset + i * inputRowStride + j * inputDepth];
+                            }
+                        }
+
+                        // Transform the input tile: m = B^T d B
+                        ValueType bd[4][4];
+                        for (size_t j = 0; j < 4; j++)
+                        {
+                            bd[0][j] = d[0][j] - d[2][j];
+                            bd[1][j] = d[1][j] + d[2][j];
+                            bd[2][j] = d[2][j] - d[1][j];
+                            bd[3][j] = d[1][j] - d[3][j];
+                        }
+                        ValueType m[4][4];
+                        for (size_t i = 0; i < 4; i++)
+                        {
+                            m[i][0] = bd[i][0] - bd[i][2];
+                            m[i][1] = bd[i][1] + bd[i][2];
+                            m[i][2] = bd[i][2] - bd[i][1];
+                            m[i][3] = bd[i][1] - bd[i][3];
+                        }
+
+                        size_t weightsOffset = filterIndex * 16 * inputDepth + channel * 16;
+                        for (size_t i = 0; i < 4; i++)
+                        {
+                            for (size_t j = 0; j < 4; j++)
+                            {
+                                tile[i][j] += filterWeightsData[weightsOffset + i * 4 + j] * m[i][j];
+                            }
+                        }
+                    }
+
+                    // Inverse transform: y = A^T tile A, written to the 2x2 output tile
+                    ValueType z[2][4];
+                    for (size_t j = 0; j < 4; j++)
+                    {
+                        z[0][j] = tile[0][j] + tile[1][j] + tile[2][j];
+                        z[1][j] = tile[1][j] - tile[2][j] - tile[3][j];
+                    }
+                    for (size_t i = 0; i < 2; i++)
+                    {
+                        size_t outputOffset = (2 * tileRow + i) * outputRowStride + 2 * tileColumn * numFilters + filterIndex;
+                        output[outputOffset] = z[i][0] + z[i][1] + z[i][2];
+                        output[outputOffset + numFilters] = z[i][1] - z[i][2] - z[i][3];
+                    }
+                }
+            }
+        }
+
+        _output.SetOutput(output);
+    }
+
+    template <typename ValueType>
+    void WinogradConvolutionNode<ValueType>::Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function)
+    {
+        // input is a (h+2p) x (w+2p) x d array
+        llvm::Value* pInput = compiler.EnsurePortEmitted(this->input);
+
+        // weights is an f x d x 4 x 4 array of Winograd-transformed filters
+        llvm::Value* pWeights = compiler.EnsurePortEmitted(this->filterWeights);
+
+        // output is an h x w x f array
+        llvm::Value* pOutput = compiler.EnsurePortEmitted(this->output);
+
+        // Model parameters
+        auto&& inputLayout = this->GetInputMemoryLayout();
+        auto&& outputLayout = this->GetOutputMemoryLayout();
+        const auto inputDepth = inputLayout.size[2];
+        const auto padding = inputLayout.offset[0];
+        assert((padding == 1) && "Padding must be 1 for Winograd F(2x2,3x3)");
+
+        const size_t paddedWidth = inputLayout.stride[1];
+        const auto outputWidth = outputLayout.size[1];
+        const auto outputHeight = outputLayout.size[0];
+        const auto numFilters = outputLayout.size[2];
+
+        const int inputRowStride = static_cast<int>(paddedWidth * inputDepth);
+        const int outputRowStride = static_cast<int>(outputWidth * numFilters);
+        const size_t numTileRows = outputHeight / 2;
+        const size_t numTileColumns = outputWidth / 2;
+
+        // Each filter writes its own channel of the output, so the filter loop can be split across worker threads
+        function.ParallelFor(numFilters, { pInput, pWeights, pOutput }, [&](emitters::IRFunctionEmitter& function, llvm::Value* filterIndex, const std::vector<llvm::Value*>& capturedValues) {
+            auto pInput = capturedValues[0];
+            auto pWeights = capturedValues[1];
+            auto pOutput = capturedValues[2];
+
+            // Accumulators for the transformed elementwise products of one tile
+            llvm::Value* tile[4][4];
+            for (int i = 0; i < 4; ++i)
+            {
+                for (int j = 0; j < 4; ++j)
+                {
+                    tile[i][j] = function.Variable(emitters::GetVariableType<ValueType>(), "tile");
+                }
+            }
+
+            auto filterOffset = function.Operator(times, filterIndex, function.Literal<int>(16 * inputDepth));
+
+            auto tileRowLoop = function.ForLoop();
+            tileRowLoop.Begin(numTileRows);
+            {
+                auto tileRow = tileRowLoop.LoadIterationVariable();
+                auto topRow = function.Operator(times, tileRow, function.Literal<int>(2));
+
+                auto tileColumnLoop = function.ForLoop();
+                tileColumnLoop.Begin(numTileColumns);
+                {
+                    auto tileColumn = tileColumnLoop.LoadIterationVariable();
+                    auto leftColumn = function.Operator(times, tileColumn, function.Literal<int>(2));
+
+                    for (int i = 0; i < 4; ++i)
+                    {
+                        for (int j = 0; j < 4; ++j)
+                        {
+                            function.Store(tile[i][j], function.Literal(static_cast<ValueType>(0)));
+                        }
+                    }
+
+                    auto channelLoop = function.ForLoop();
+                    channelLoop.Begin(inputDepth);
+                    {
+                        auto channel = channelLoop.LoadIterationVariable();
+
+                        // The tile's top-left corner in the padded input
+                        auto inputOffset = function.Operator(plus, function.Operator(times, topRow, function.Literal<int>(inputRowStride)),
+                                                             function.Operator(plus, function.Operator(times, leftColumn, function.Literal<int>(inputDepth)), channel));
+
+                        llvm::Value* d[4][4];
+                        for (int i = 0; i < 4; ++i)
+                        {
+                            for (int j = 0; j < 4; ++j)
+                            {
+                                auto elementOffset = function.Literal<int>(i * inputRowStride + j * static_cast<int>(inputDepth));
+                                d[i][j] = function.ValueAt(pInput, function.Operator(plus, inputOffset, elementOffset));
+                            }
+                        }
+
+                        // Transform the input tile: m = B^T d B
+                        llvm::Value* bd[4][4];
+                        for (int j = 0; j < 4; ++j)
+                        {
+                            bd[0][j] = function.Operator(minusFloat, d[0][j], d[2][j]);
+                            bd[1][j] = function.Operator(plusFloat, d[1][j], d[2][j]);
+                            bd[2][j] = function.Operator(minusFloat, d[2][j], d[1][j]);
+                            bd[3][j] = function.Operator(minusFloat, d[1][j], d[3][j]);
+                        }
+                        llvm::Value* m[4][4];
+                        for (int i = 0; i < 4; ++i)
+                        {
+                            m[i][0] = function.Operator(minusFloat, bd[i][0], bd[i][2]);
+                            m[i][1] = function.Operator(plusFloat, bd[i][1], bd[i][2]);
+                            m[i][2] = function.Operator(minusFloat, bd[i][2], bd[i][1]);
+                            m[i][3] = function.Operator(minusFloat, bd[i][1], bd[i][3]);
+                        }
+
+                        auto weightsOffset = function.Operator(plus, filterOffset, function.Operator(times, channel, function.Literal<int>(16)));
+                        for (int i = 0; i < 4; ++i)
+                        {
+                            for (int j = 0; j < 4; ++j)
+                            {
+                                auto weight = function.ValueAt(pWeights, function.Operator(plus, weightsOffset, function.Literal<int>(i * 4 + j)));
+                                function.OperationAndUpdate(tile[i][j], plusFloat, function.Operator(timesFloat, weight, m[i][j]));
+                            }
+                        }
+                    }
+                    channelLoop.End();
+
+                    // Inverse transform: y = A^T tile A, written to the 2x2 output tile
+                    llvm::Value* z[2][4];
+                    for (int j = 0; j < 4; ++j)
+                    {
+                        z[0][j] = function.Operator(plusFloat, function.Operator(plusFloat, function.Load(tile[0][j]), function.Load(tile[1][j])), function.Load(tile[2][j]));
+                        z[1][j] = function.Operator(minusFloat, function.Operator(minusFloat, function.Load(tile[1][j]), function.Load(tile[2][j])), function.Load(tile[3][j]));
+                    }
+                    for (int i = 0; i < 2; ++i)
+                    {
+                        auto y0 = function.Operator(plusFloat, function.Operator(plusFloat, z[i][0], z[i][1]), z[i][2]);
+                        auto y1 = function.Operator(minusFloat, function.Operator(minusFloat, z[i][1], z[i][2]), z[i][3]);
+
+                        auto outputRow = function.Operator(plus, topRow, function.Literal<int>(i));
+                        auto outputRowOffset = function.Operator(times, outputRow, function.Literal<int>(outputRowStride));
+                        auto outputColumnOffset = function.Operator(times, leftColumn, function.Literal<int>(numFilters));
+                        auto outputIndex = function.Operator(plus, function.Operator(plus, outputRowOffset, outputColumnOffset), filterIndex);
+                        function.SetValueAt(pOutput, outputIndex, y0);
+                        function.SetValueAt(pOutput, function.Operator(plus, outputIndex, function.Literal<int>(numFilters)), y1);
+                    }
+                }
+                tileColumnLoop.End();
+            }
+            tileRowLoop.End();
+        });
+    }
+
     // Explicit specializations
     template class ConvolutionalLayerNode<float>;
     template class ConvolutionalLayerNode<double>;
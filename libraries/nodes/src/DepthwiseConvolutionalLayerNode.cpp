@@ -0,0 +1,225 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     DepthwiseConvolutionalLayerNode.cpp (nodes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "DepthwiseConvolutionalLayerNode.h"
+#include "ConstantNode.h"
+
+namespace ell
+{
+namespace nodes
+{
+    template <typename ValueType>
+    DepthwiseConvolutionalLayerNode<ValueType>::DepthwiseConvolutionalLayerNode(const model::PortElements<ValueType>& input, const predictors::neural::DepthwiseConvolutionalLayer<ValueType>& layer)
+        : NeuralNetworkLayerNode<DepthwiseConvolutionalLayerNode<ValueType>, predictors::neural::DepthwiseConvolutionalLayer<ValueType>, ValueType>(input, layer)
+    {
+        // For convolutional layers, the input size _includes_ padding, for some reason. We need to undo that here:
+        auto& inputLayout = this->GetInputMemoryLayout();
+        auto numDimensions = this->NumInputDimensions();
+        for (int index = 0; index < numDimensions; ++index)
+        {
+            inputLayout.size[index] -= 2 * inputLayout.offset[index];
+            inputLayout.stride[index] -= 2 * inputLayout.offset[index];
+        }
+    }
+
+    template <typename ValueType>
+    bool DepthwiseConvolutionalLayerNode<ValueType>::Refine(model::ModelTransformer& transformer) const
+    {
+        auto&& inputLayout = this->GetInputMemoryLayout();
+        auto&& outputLayout = this->GetOutputMemoryLayout();
+        auto&& convParams = this->GetLayer().GetConvolutionalParameters();
+        const auto outputPadding = outputLayout.offset[0];
+
+        // TODO: take output padding into account
+        assert(outputPadding == 0 && "Depthwise convolutional node output padding not supported yet");
+
+        auto newInput = transformer.TransformPortElements(this->input.GetPortElements());
+
+        // The weights tensor is (numChannels * receptiveField) x receptiveField x 1, so its
+        // flattened form is already in (channel, kernel row, kernel column) order
+        auto weightsValues = this->GetLayer().GetWeights().ToArray();
+        auto weightsNode = transformer.AddNode<ConstantNode<ValueType>>(weightsValues);
+        auto convNode = transformer.AddNode<DepthwiseConvolutionNode<ValueType>>(newInput, inputLayout, weightsNode->output, outputLayout, convParams);
+        transformer.MapNodeOutput(this->output, convNode->output);
+        return true;
+    }
+
+    //
+    // DepthwiseConvolutionNode
+    //
+
+    namespace
+    {
+        size_t GetDepthwiseConvolutionOutputSize(const PortMemoryLayout& outputLayout)
+        {
+            return outputLayout.size[0] * outputLayout.size[1] * outputLayout.size[2];
+        }
+    }
+
+    template <typename ValueType>
+    DepthwiseConvolutionNode<ValueType>::DepthwiseConvolutionNode()
+        : CompilableNode({ &_input }, { &_output }), _input(this, {}, inputPortName), _filterWeights(this, {}, filterWeightsPortName), _output(this, outputPortName, 0)
+    {
+    }
+
+    template <typename ValueType>
+    DepthwiseConvolutionNode<ValueType>::DepthwiseConvolutionNode(const model::PortElements<ValueType>& input, const PortMemoryLayout& inputMemoryLayout, const model::PortElements<ValueType>& filterWeights, const PortMemoryLayout& outputMemoryLayout, const predictors::neural::ConvolutionalParameters& convolutionalParameters)
+        : CompilableNode({ &_input, &_filterWeights }, { &_output }), _input(this, input, inputPortName), _filterWeights(this, filterWeights, filterWeightsPortName), _output(this, outputPortName, GetDepthwiseConvolutionOutputSize(outputMemoryLayout)), _inputMemoryLayout(inputMemoryLayout), _outputMemoryLayout(outputMemoryLayout), _convolutionalParameters(convolutionalParameters)
+    {
+    }
+
+    template <typename ValueType>
+    void DepthwiseConvolutionNode<ValueType>::Copy(model::ModelTransformer& transformer) const
+    {
+        auto newInput = transformer.TransformPortElements(_input.GetPortElements());
+        auto newFilterWeights = transformer.TransformPortElements(_filterWeights.GetPortElements());
+        auto newNode = transformer.AddNode<DepthwiseConvolutionNode<ValueType>>(newInput, _inputMemoryLayout, newFilterWeights, _outputMemoryLayout, _convolutionalParameters);
+        transformer.MapNodeOutput(this->output, newNode->output);
+    }
+
+    template <typename ValueType>
+    void DepthwiseConvolutionNode<ValueType>::Compute() const
+    {
+        // Model parameters
+        auto&& inputLayout = this->GetInputMemoryLayout();
+        auto&& outputLayout = this->GetOutputMemoryLayout();
+        auto&& convParams = this->GetConvolutionalParameters();
+        const auto inputDepth = inputLayout.size[2];
+        const auto padding = inputLayout.offset[0];
+        const auto filterWidth = convParams.receptiveField;
+        const auto stride = convParams.stride;
+
+        const auto outputHeight = outputLayout.size[0];
+        const auto outputWidth = outputLayout.size[1];
+        const auto numChannels = outputLayout.size[2];
+
+        const size_t paddedWidth = inputLayout.size[1] + 2 * padding;
+        const size_t paddedHeight = inputLayout.size[0] + 2 * padding;
+        assert(_input.Size() == paddedWidth * paddedHeight * inputDepth);
+
+        const size_t inputRowStride = paddedWidth * inputDepth;
+        const size_t outputRowStride = outputWidth * numChannels;
+
+        auto inputData = _input.GetValue();
+        auto filterWeightsData = _filterWeights.GetValue();
+        assert(filterWeightsData.size() == filterWidth * filterWidth * numChannels);
+        std::vector<ValueType> output(outputHeight * outputWidth * numChannels);
+
+        for (size_t i = 0; i < outputHeight; i++)
+        {
+            for (size_t j = 0; j < outputWidth; j++)
+            {
+                for (size_t channel = 0; channel < numChannels; channel++)
+                {
+                    ValueType sum = 0;
+                    for (size_t fieldRow = 0; fieldRow < filterWidth; fieldRow++)
+                    {
+                        for (size_t fieldColumn = 0; fieldColumn < filterWidth; fieldColumn++)
+                        {
+                            auto weight = filterWeightsData[(channel * filterWidth + fieldRow) * filterWidth + fieldColumn];
+                            auto inputValue = inputData[(i * stride + fieldRow) * inputRowStride + (j * stride + fieldColumn) * inputDepth + channel];
+                            sum += weight * inputValue;
+                        }
+                    }
+                    output[i * outputRowStride + j * numChannels + channel] = sum;
+                }
+            }
+        }
+
+        _output.SetOutput(output);
+    }
+
+    template <typename ValueType>
+    void DepthwiseConvolutionNode<ValueType>::Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function)
+    {
+        // convenience operator names
+        const auto plus = emitters::TypedOperator::add;
+        const auto times = emitters::TypedOperator::multiply;
+        const auto plusFloat = emitters::GetAddForValueType<ValueType>();
+        const auto timesFloat = emitters::GetMultiplyForValueType<ValueType>();
+
+        // input is a (h+2p) x (w+2p) x d array
+        llvm::Value* pInput = compiler.EnsurePortEmitted(this->input);
+
+        // weights is a d x k x k array of per-channel kernels
+        llvm::Value* pWeights = compiler.EnsurePortEmitted(this->filterWeights);
+
+        // output is an h x w x d array
+        llvm::Value* pOutput = compiler.EnsurePortEmitted(this->output);
+
+        // Model parameters
+        auto&& inputLayout = this->GetInputMemoryLayout();
+        auto&& outputLayout = this->GetOutputMemoryLayout();
+        auto&& convParams = this->GetConvolutionalParameters();
+        const int inputDepth = static_cast<int>(inputLayout.size[2]);
+        const int filterWidth = static_cast<int>(convParams.receptiveField);
+        const int stride = static_cast<int>(convParams.stride);
+
+        const size_t paddedWidth = inputLayout.stride[1];
+        const int outputHeight = static_cast<int>(outputLayout.size[0]);
+        const int outputWidth = static_cast<int>(outputLayout.size[1]);
+        const int numChannels = static_cast<int>(outputLayout.size[2]);
+
+        const int inputRowStride = static_cast<int>(paddedWidth * inputDepth);
+        const int outputRowStride = outputWidth * numChannels;
+
+        // The output rows are independent, so the row loop can be split across worker threads
+        function.ParallelFor(outputHeight, { pInput, pWeights, pOutput }, [&](emitters::IRFunctionEmitter& function, llvm::Value* outputRowIndex, const std::vector<llvm::Value*>& capturedValues) {
+            auto pInput = capturedValues[0];
+            auto pWeights = capturedValues[1];
+            auto pOutput = capturedValues[2];
+
+            llvm::Value* accum = function.Variable(emitters::GetVariableType<ValueType>(), "accum");
+
+            auto inputRowIndex = function.Operator(times, outputRowIndex, function.Literal<int>(stride));
+            auto outputRowOffset = function.Operator(times, outputRowIndex, function.Literal<int>(outputRowStride));
+
+            auto columnLoop = function.ForLoop();
+            columnLoop.Begin(outputWidth);
+            {
+                auto outputColumnIndex = columnLoop.LoadIterationVariable();
+                auto inputColumnIndex = function.Operator(times, outputColumnIndex, function.Literal<int>(stride));
+                auto outputColumnOffset = function.Operator(plus, outputRowOffset, function.Operator(times, outputColumnIndex, function.Literal<int>(numChannels)));
+
+                // The window's top-left corner in the padded input
+                auto windowOffset = function.Operator(plus, function.Operator(times, inputRowIndex, function.Literal<int>(inputRowStride)),
+                                                      function.Operator(times, inputColumnIndex, function.Literal<int>(inputDepth)));
+
+                auto channelLoop = function.ForLoop();
+                channelLoop.Begin(numChannels);
+                {
+                    auto channel = channelLoop.LoadIterationVariable();
+                    auto channelWindowOffset = function.Operator(plus, windowOffset, channel);
+                    auto weightsOffset = function.Operator(times, channel, function.Literal<int>(filterWidth * filterWidth));
+
+                    function.Store(accum, function.Literal(static_cast<ValueType>(0)));
+                    for (int fieldRow = 0; fieldRow < filterWidth; ++fieldRow)
+                    {
+                        for (int fieldColumn = 0; fieldColumn < filterWidth; ++fieldColumn)
+                        {
+                            auto elementOffset = function.Literal<int>(fieldRow * inputRowStride + fieldColumn * inputDepth);
+                            auto inputValue = function.ValueAt(pInput, function.Operator(plus, channelWindowOffset, elementOffset));
+                            auto weight = function.ValueAt(pWeights, function.Operator(plus, weightsOffset, function.Literal<int>(fieldRow * filterWidth + fieldColumn)));
+                            function.OperationAndUpdate(accum, plusFloat, function.Operator(timesFloat, weight, inputValue));
+                        }
+                    }
+
+                    auto outputIndex = function.Operator(plus, outputColumnOffset, channel);
+                    function.SetValueAt(pOutput, outputIndex, function.Load(accum));
+                }
+                channelLoop.End();
+            }
+            columnLoop.End();
+        });
+    }
+
+    // Explicit specializations
+    template class DepthwiseConvolutionalLayerNode<float>;
+    template class DepthwiseConvolutionalLayerNode<double>;
+} // nodes
+} // ell
@@ -0,0 +1,133 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     EliminateTypeCasts.cpp (nodes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "EliminateTypeCasts.h"
+
+// nodes
+#include "TypeCastNode.h"
+
+// stl
+#include <cstdint>
+#include <type_traits>
+
+namespace ell
+{
+namespace nodes
+{
+    namespace
+    {
+        // a collapsible cast must consume the entire output of its predecessor, unpermuted
+        bool ReferencesEntirePort(const model::PortElementsBase& elements)
+        {
+            if (elements.NumRanges() != 1)
+            {
+                return false;
+            }
+            const auto& range = elements.GetRanges()[0];
+            return range.GetStartIndex() == 0 && range.Size() == range.ReferencedPort()->Size();
+        }
+
+        // Rewires a cast's output to read newInput: when the source and destination types differ
+        // a single cast is inserted, and when they match the elements pass straight through
+        template <typename SourceType, typename DestinationType>
+        struct CastRewirer
+        {
+            static void Rewire(const model::OutputPort<DestinationType>& output, const model::PortElements<SourceType>& newInput, model::ModelTransformer& transformer)
+            {
+                auto newNode = transformer.AddNode<TypeCastNode<SourceType, DestinationType>>(newInput);
+                transformer.MapNodeOutput(output, newNode->output);
+            }
+        };
+
+        template <typename ValueType>
+        struct CastRewirer<ValueType, ValueType>
+        {
+            static void Rewire(const model::OutputPort<ValueType>& output, const model::PortElements<ValueType>& newInput, model::ModelTransformer& transformer)
+            {
+                transformer.MapNodeOutput(output, newInput);
+            }
+        };
+
+        // Collapses a cast whose input is produced by another cast (SourceType -> IntermediateType
+        // followed by IntermediateType -> DestinationType) into a single rewiring from the source.
+        // The inner cast is left in place for any other consumers; pruning removes it when this
+        // was the only one.
+        template <typename SourceType, typename IntermediateType, typename DestinationType>
+        bool TryCollapseCastPair(const TypeCastNode<IntermediateType, DestinationType>& outerNode, const model::Node& sourceNode, model::ModelTransformer& transformer)
+        {
+            auto innerNode = dynamic_cast<const TypeCastNode<SourceType, IntermediateType>*>(&sourceNode);
+            if (innerNode == nullptr)
+            {
+                return false;
+            }
+
+            auto newInput = transformer.TransformPortElements(innerNode->input.GetPortElements());
+            CastRewirer<SourceType, DestinationType>::Rewire(outerNode.output, newInput, transformer);
+            return true;
+        }
+
+        template <typename InputValueType, typename OutputValueType>
+        bool TryEliminateCast(const model::Node& node, model::ModelTransformer& transformer)
+        {
+            auto castNode = dynamic_cast<const TypeCastNode<InputValueType, OutputValueType>*>(&node);
+            if (castNode == nullptr)
+            {
+                return false;
+            }
+
+            const auto& elements = castNode->input.GetPortElements();
+            if (ReferencesEntirePort(elements))
+            {
+                auto sourceNode = elements.GetRanges()[0].ReferencedPort()->GetNode();
+                if (TryCollapseCastPair<bool>(*castNode, *sourceNode, transformer) ||
+                    TryCollapseCastPair<int>(*castNode, *sourceNode, transformer) ||
+                    TryCollapseCastPair<int64_t>(*castNode, *sourceNode, transformer) ||
+                    TryCollapseCastPair<float>(*castNode, *sourceNode, transformer) ||
+                    TryCollapseCastPair<double>(*castNode, *sourceNode, transformer))
+                {
+                    return true;
+                }
+            }
+
+            // a cast to its own type is just a copy
+            if (std::is_same<InputValueType, OutputValueType>::value)
+            {
+                auto newInput = transformer.TransformPortElements(castNode->input.GetPortElements());
+                CastRewirer<InputValueType, OutputValueType>::Rewire(castNode->output, newInput, transformer);
+                return true;
+            }
+
+            transformer.CopyNode(node);
+            return true;
+        }
+
+        template <typename InputValueType>
+        bool TryEliminateCastFrom(const model::Node& node, model::ModelTransformer& transformer)
+        {
+            return TryEliminateCast<InputValueType, bool>(node, transformer) ||
+                   TryEliminateCast<InputValueType, int>(node, transformer) ||
+                   TryEliminateCast<InputValueType, int64_t>(node, transformer) ||
+                   TryEliminateCast<InputValueType, float>(node, transformer) ||
+                   TryEliminateCast<InputValueType, double>(node, transformer);
+        }
+    }
+
+    void EliminateTypeCasts(const model::Node& node, model::ModelTransformer& transformer)
+    {
+        if (TryEliminateCastFrom<bool>(node, transformer) ||
+            TryEliminateCastFrom<int>(node, transformer) ||
+            TryEliminateCastFrom<int64_t>(node, transformer) ||
+            TryEliminateCastFrom<float>(node, transformer) ||
+            TryEliminateCastFrom<double>(node, transformer))
+        {
+            return;
+        }
+        transformer.CopyNode(node);
+    }
+}
+}
@@ -0,0 +1,173 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ForestPredictorNode.cpp (nodes)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "ForestPredictorNode.h"
+
+// emitters
+#include "EmitterTypes.h"
+#include "VectorVariable.h"
+
+// stl
+#include <limits>
+#include <vector>
+
+namespace ell
+{
+namespace nodes
+{
+    namespace
+    {
+        // The depth of the subtree rooted at the given interior node
+        size_t GetSubtreeDepth(const predictors::SimpleForestPredictor& forest, size_t interiorNodeIndex)
+        {
+            size_t childDepth = 0;
+            for (const auto& edge : forest.GetInteriorNodes()[interiorNodeIndex].GetOutgoingEdges())
+            {
+                if (edge.IsTargetInterior())
+                {
+                    childDepth = std::max(childDepth, GetSubtreeDepth(forest, edge.GetTargetNodeIndex()));
+                }
+            }
+            return childDepth + 1;
+        }
+    }
+
+    template <>
+    bool ForestPredictorNode<predictors::SingleElementThresholdPredictor, predictors::ConstantPredictor>::IsCompilable() const
+    {
+        return true;
+    }
+
+    // Direct lowering of the simple forest. Instead of refining into one node per split (which
+    // produces thousands of nodes and deeply branchy code for large forests), the forest is
+    // flattened into structure-of-arrays form - feature index, threshold, edge values, child
+    // indices - and each tree is walked in a tight loop. The walk is branch-free: every step uses
+    // selects, and a sentinel entry that points back at itself and contributes nothing lets the
+    // loop always run for the forest's maximum depth, so short paths simply park on the sentinel.
+    template <>
+    void ForestPredictorNode<predictors::SingleElementThresholdPredictor, predictors::ConstantPredictor>::Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function)
+    {
+        llvm::Value* pInput = compiler.EnsurePortEmitted(input);
+        llvm::Value* pOutput = compiler.EnsurePortEmitted(output);
+        llvm::Value* pTreeOutputs = compiler.EnsurePortEmitted(treeOutputs);
+        llvm::Value* pEdgeIndicator = compiler.EnsurePortEmitted(edgeIndicatorVector);
+
+        const auto& interiorNodes = _forest.GetInteriorNodes();
+        auto numInteriorNodes = interiorNodes.size();
+        auto numTrees = _forest.NumTrees();
+        auto numEdges = _forest.NumEdges();
+        int sentinel = static_cast<int>(numInteriorNodes); // the padding entry appended below
+
+        // Flatten the forest into structure-of-arrays form, one entry per interior node plus the
+        // sentinel. Edge values and child indices are interleaved in pairs (edge position 0, 1).
+        std::vector<int> featureIndices;
+        std::vector<double> thresholds;
+        std::vector<double> edgeValues;
+        std::vector<int> childIndices;
+        std::vector<int> firstEdgeIndices;
+        featureIndices.reserve(numInteriorNodes + 1);
+        thresholds.reserve(numInteriorNodes + 1);
+        edgeValues.reserve(2 * (numInteriorNodes + 1));
+        childIndices.reserve(2 * (numInteriorNodes + 1));
+        firstEdgeIndices.reserve(numInteriorNodes + 1);
+
+        for (const auto& interiorNode : interiorNodes)
+        {
+            const auto& splitRule = interiorNode.GetSplitRule();
+            featureIndices.push_back(static_cast<int>(splitRule.GetElementIndex()));
+            thresholds.push_back(splitRule.GetThreshold());
+            firstEdgeIndices.push_back(static_cast<int>(interiorNode.GetFirstEdgeIndex()));
+            for (const auto& edge : interiorNode.GetOutgoingEdges())
+            {
+                edgeValues.push_back(edge.GetPredictor().GetValue());
+                // a target of 0 means "leaf" in the predictor; redirect it to the sentinel
+                childIndices.push_back(edge.IsTargetInterior() ? static_cast<int>(edge.GetTargetNodeIndex()) : sentinel);
+            }
+        }
+
+        // the sentinel: never taken (threshold is +inf), contributes nothing, loops back to itself
+        featureIndices.push_back(0);
+        thresholds.push_back(std::numeric_limits<double>::infinity());
+        firstEdgeIndices.push_back(0);
+        edgeValues.push_back(0.0);
+        edgeValues.push_back(0.0);
+        childIndices.push_back(sentinel);
+        childIndices.push_back(sentinel);
+
+        std::vector<int> rootIndices;
+        rootIndices.reserve(numTrees);
+        size_t maxDepth = 0;
+        for (size_t treeIndex = 0; treeIndex < numTrees; ++treeIndex)
+        {
+            auto rootIndex = _forest.GetRootIndex(treeIndex);
+            rootIndices.push_back(static_cast<int>(rootIndex));
+            maxDepth = std::max(maxDepth, GetSubtreeDepth(_forest, rootIndex));
+        }
+
+        // emit the flattened forest as literal constants
+        auto& variables = function.GetModule().Variables();
+        llvm::Value* pFeatureIndices = function.GetModule().EnsureEmitted(*variables.AddVariable<emitters::LiteralVectorVariable<int>>(featureIndices));
+        llvm::Value* pThresholds = function.GetModule().EnsureEmitted(*variables.AddVariable<emitters::LiteralVectorVariable<double>>(thresholds));
+        llvm::Value* pEdgeValues = function.GetModule().EnsureEmitted(*variables.AddVariable<emitters::LiteralVectorVariable<double>>(edgeValues));
+        llvm::Value* pChildIndices = function.GetModule().EnsureEmitted(*variables.AddVariable<emitters::LiteralVectorVariable<int>>(childIndices));
+        llvm::Value* pFirstEdgeIndices = function.GetModule().EnsureEmitted(*variables.AddVariable<emitters::LiteralVectorVariable<int>>(firstEdgeIndices));
+        llvm::Value* pRootIndices = function.GetModule().EnsureEmitted(*variables.AddVariable<emitters::LiteralVectorVariable<int>>(rootIndices));
+
+        llvm::Value* nodeIndex = function.Variable(emitters::VariableType::Int32, "nodeIndex");
+        llvm::Value* treeSum = function.Variable(emitters::VariableType::Double, "treeSum");
+
+        // clear the edge indicator vector
+        auto clearLoop = function.ForLoop();
+        clearLoop.Begin(static_cast<int>(numEdges));
+        {
+            auto i = clearLoop.LoadIterationVariable();
+            function.SetValueAt(pEdgeIndicator, i, function.Literal(static_cast<uint8_t>(0)));
+        }
+        clearLoop.End();
+
+        function.Store(pOutput, function.Literal(_forest.GetBias()));
+
+        auto treeLoop = function.ForLoop();
+        treeLoop.Begin(static_cast<int>(numTrees));
+        {
+            auto treeIndex = treeLoop.LoadIterationVariable();
+            function.Store(nodeIndex, function.ValueAt(pRootIndices, treeIndex));
+            function.Store(treeSum, function.Literal(0.0));
+
+            auto walkLoop = function.ForLoop();
+            walkLoop.Begin(static_cast<int>(maxDepth));
+            {
+                auto node = function.Load(nodeIndex);
+
+                // evaluate the split rule: input[featureIndex] > threshold
+                auto featureValue = function.ValueAt(pInput, function.ValueAt(pFeatureIndices, node));
+                auto comparison = function.Comparison(emitters::TypedComparison::greaterThanFloat, featureValue, function.ValueAt(pThresholds, node));
+                auto edgePosition = function.CastBoolToInt(comparison);
+
+                // accumulate the taken edge's value and mark it in the indicator vector; on the
+                // sentinel entry the comparison is always false and the mark is a no-op
+                auto edgeIndex = function.Operator(emitters::TypedOperator::add, function.Operator(emitters::TypedOperator::multiply, node, function.Literal(2)), edgePosition);
+                function.OperationAndUpdate(treeSum, emitters::TypedOperator::addFloat, function.ValueAt(pEdgeValues, edgeIndex));
+
+                auto isRealNode = function.Comparison(emitters::TypedComparison::notEquals, node, function.Literal(sentinel));
+                auto indicatorIndex = function.Operator(emitters::TypedOperator::add, function.ValueAt(pFirstEdgeIndices, node), edgePosition);
+                auto indicatorValue = function.Operator(emitters::TypedOperator::logicalOr, function.ValueAt(pEdgeIndicator, indicatorIndex), function.CastBoolToByte(isRealNode));
+                function.SetValueAt(pEdgeIndicator, indicatorIndex, indicatorValue);
+
+                // follow the taken edge
+                function.Store(nodeIndex, function.ValueAt(pChildIndices, edgeIndex));
+            }
+            walkLoop.End();
+
+            function.SetValueAt(pTreeOutputs, treeIndex, function.Load(treeSum));
+            function.OperationAndUpdate(pOutput, emitters::TypedOperator::addFloat, function.Load(treeSum));
+        }
+        treeLoop.End();
+    }
+}
+}
@@ -7,6 +7,7 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "FullyConnectedLayerNode.h"
+#include "BlockSparseMatrixVectorMultiplyNode.h"
 #include "BroadcastFunctionNode.h"
 #include "ConstantNode.h"
 #include "MatrixVectorMultiplyNode.h"
@@ -62,6 +63,16 @@ namespace nodes
         const auto& weights = this->_layer.GetWeights();
         auto m = weights.NumRows();
         auto n = weights.NumColumns();
+
+        if (this->_layer.HasBlockSparseWeights())
+        {
+            // pruned layer: only the nonzero weight blocks are stored, and the multiply visits just those
+            auto valuesNode = transformer.AddNode<ConstantNode<ValueType>>(this->_layer.GetWeightsBlockValues());
+            auto sparseMultiplyNode = transformer.AddNode<BlockSparseMatrixVectorMultiplyNode<ValueType>>(valuesNode->output, m, n, this->_layer.GetWeightsBlockSize(), this->_layer.GetWeightsBlockRows(), this->_layer.GetWeightsBlockColumns(), newInput);
+            transformer.MapNodeOutput(this->output, sparseMultiplyNode->output);
+            return true;
+        }
+
         auto lda = weights.GetIncrement();
         auto weightsValues = std::vector<ValueType>{ weights.GetDataPointer(), weights.GetDataPointer() + weights.GetDataSize() };
         auto weightsNode = transformer.AddNode<ConstantNode<ValueType>>(weightsValues);
@@ -0,0 +1,322 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     FuseLinearOperations.cpp (nodes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "FuseLinearOperations.h"
+
+// nodes
+#include "BatchNormalizationLayerNode.h"
+#include "BiasLayerNode.h"
+#include "ConvolutionalLayerNode.h"
+#include "FullyConnectedLayerNode.h"
+#include "ScalingLayerNode.h"
+
+// math
+#include "Vector.h"
+
+// stl
+#include <cstddef>
+
+namespace ell
+{
+namespace nodes
+{
+    namespace
+    {
+        // The per-channel scale and bias accumulated while walking a chain of elementwise layer nodes
+        template <typename ValueType>
+        struct LinearCoefficients
+        {
+            math::ColumnVector<ValueType> scale;
+            math::ColumnVector<ValueType> bias;
+
+            LinearCoefficients(size_t numChannels)
+                : scale(numChannels), bias(numChannels)
+            {
+                scale.Fill(1);
+            }
+
+            // compose with a subsequent layer computing y = s*x + b
+            void Append(const math::ColumnVector<ValueType>& s, const math::ColumnVector<ValueType>& b)
+            {
+                for (size_t i = 0; i < scale.Size(); ++i)
+                {
+                    scale[i] *= s[i];
+                    bias[i] = bias[i] * s[i] + b[i];
+                }
+            }
+
+            // compose with a subsequent layer computing y = s*x
+            void AppendScale(const math::ColumnVector<ValueType>& s)
+            {
+                for (size_t i = 0; i < scale.Size(); ++i)
+                {
+                    scale[i] *= s[i];
+                    bias[i] *= s[i];
+                }
+            }
+
+            // compose with a subsequent layer computing y = x + b
+            void AppendBias(const math::ColumnVector<ValueType>& b)
+            {
+                for (size_t i = 0; i < bias.Size(); ++i)
+                {
+                    bias[i] += b[i];
+                }
+            }
+        };
+
+        // returns the node as a fusable elementwise layer node (batch normalization, scaling, or bias), or nullptr
+        template <typename ValueType>
+        const NeuralNetworkLayerNodeBase<ValueType>* AsFusableLayerNode(const model::Node& node)
+        {
+            if (dynamic_cast<const BatchNormalizationLayerNode<ValueType>*>(&node) != nullptr ||
+                dynamic_cast<const ScalingLayerNode<ValueType>*>(&node) != nullptr ||
+                dynamic_cast<const BiasLayerNode<ValueType>*>(&node) != nullptr)
+            {
+                return dynamic_cast<const NeuralNetworkLayerNodeBase<ValueType>*>(&node);
+            }
+            return nullptr;
+        }
+
+        // fusion targets: convolutional layers always, fully-connected layers only when their active
+        // output is a flat vector of channels, so that weight matrix rows correspond to channels
+        template <typename ValueType>
+        bool IsFusableTargetNode(const model::Node& node)
+        {
+            if (dynamic_cast<const ConvolutionalLayerNode<ValueType>*>(&node) != nullptr)
+            {
+                return true;
+            }
+            if (auto fullyConnectedNode = dynamic_cast<const FullyConnectedLayerNode<ValueType>*>(&node))
+            {
+                auto outputShape = fullyConnectedNode->GetLayer().GetOutputShapeMinusPadding();
+                return outputShape[0] == 1 && outputShape[1] == 1;
+            }
+            return false;
+        }
+
+        // a chain link must consume the entire output of its predecessor, unpermuted
+        template <typename ValueType>
+        bool ReferencesEntirePort(const model::InputPort<ValueType>& input, const model::OutputPort<ValueType>& output)
+        {
+            auto elements = input.GetPortElements();
+            if (elements.NumRanges() != 1)
+            {
+                return false;
+            }
+            const auto& range = elements.GetRanges()[0];
+            return range.ReferencedPort() == &output && range.GetStartIndex() == 0 && range.Size() == output.Size();
+        }
+
+        // returns the next node in a fusable chain: the node's sole dependent, if it's a fusable
+        // elementwise layer node consuming this node's entire output
+        template <typename ValueType>
+        const NeuralNetworkLayerNodeBase<ValueType>* GetNextFusableNode(const NeuralNetworkLayerNodeBase<ValueType>& node)
+        {
+            const auto& dependents = node.GetDependentNodes();
+            if (dependents.size() != 1)
+            {
+                return nullptr;
+            }
+            auto next = AsFusableLayerNode<ValueType>(*dependents[0]);
+            if (next == nullptr || !ReferencesEntirePort(next->input, node.output))
+            {
+                return nullptr;
+            }
+            return next;
+        }
+
+        // true when the node belongs to a chain that a preceding convolutional or fully-connected
+        // node folds into itself when it is visited
+        template <typename ValueType>
+        bool IsFusedWithPredecessor(const model::Node& node)
+        {
+            auto layerNode = AsFusableLayerNode<ValueType>(node);
+            if (layerNode == nullptr)
+            {
+                return false;
+            }
+
+            auto elements = layerNode->input.GetPortElements();
+            if (elements.NumRanges() != 1)
+            {
+                return false;
+            }
+            const auto& range = elements.GetRanges()[0];
+            auto parentPort = range.ReferencedPort();
+            if (range.GetStartIndex() != 0 || range.Size() != parentPort->Size())
+            {
+                return false;
+            }
+
+            auto parent = parentPort->GetNode();
+            if (parent->GetDependentNodes().size() != 1)
+            {
+                return false;
+            }
+            if (IsFusableTargetNode<ValueType>(*parent))
+            {
+                return true;
+            }
+            return IsFusedWithPredecessor<ValueType>(*parent);
+        }
+
+        // gets the layer parameters of a fusable elementwise layer node
+        template <typename ValueType>
+        const typename predictors::neural::Layer<ValueType>::LayerParameters& GetFusableLayerParameters(const NeuralNetworkLayerNodeBase<ValueType>& node)
+        {
+            if (auto batchNormalizationNode = dynamic_cast<const BatchNormalizationLayerNode<ValueType>*>(&node))
+            {
+                return batchNormalizationNode->GetLayer().GetLayerParameters();
+            }
+            if (auto scalingNode = dynamic_cast<const ScalingLayerNode<ValueType>*>(&node))
+            {
+                return scalingNode->GetLayer().GetLayerParameters();
+            }
+            auto biasNode = dynamic_cast<const BiasLayerNode<ValueType>*>(&node);
+            return biasNode->GetLayer().GetLayerParameters();
+        }
+
+        // folds a chain node's elementwise operation into the running coefficients
+        template <typename ValueType>
+        void AccumulateCoefficients(const NeuralNetworkLayerNodeBase<ValueType>& node, LinearCoefficients<ValueType>& coefficients)
+        {
+            if (auto batchNormalizationNode = dynamic_cast<const BatchNormalizationLayerNode<ValueType>*>(&node))
+            {
+                const auto& layer = batchNormalizationNode->GetLayer();
+                coefficients.Append(layer.GetScale(), layer.GetBias());
+            }
+            else if (auto scalingNode = dynamic_cast<const ScalingLayerNode<ValueType>*>(&node))
+            {
+                coefficients.AppendScale(scalingNode->GetLayer().GetScale());
+            }
+            else
+            {
+                auto biasNode = dynamic_cast<const BiasLayerNode<ValueType>*>(&node);
+                coefficients.AppendBias(biasNode->GetLayer().GetBias());
+            }
+        }
+
+        // adds a copy of a convolutional layer node with the per-filter scale folded into its weights
+        template <typename ValueType>
+        const NeuralNetworkLayerNodeBase<ValueType>* AddScaledNode(const ConvolutionalLayerNode<ValueType>& node, const math::ColumnVector<ValueType>& scale, const model::PortElements<ValueType>& input, model::ModelTransformer& transformer)
+        {
+            const auto& layer = node.GetLayer();
+            auto weights = layer.GetWeights();
+            auto receptiveField = layer.GetConvolutionalParameters().receptiveField;
+
+            // filter f occupies rows [f * receptiveField, (f+1) * receptiveField) of the weights tensor
+            for (size_t filterIndex = 0; filterIndex < scale.Size(); ++filterIndex)
+            {
+                for (size_t rowIndex = filterIndex * receptiveField; rowIndex < (filterIndex + 1) * receptiveField; ++rowIndex)
+                {
+                    for (size_t columnIndex = 0; columnIndex < weights.NumColumns(); ++columnIndex)
+                    {
+                        for (size_t channelIndex = 0; channelIndex < weights.NumChannels(); ++channelIndex)
+                        {
+                            weights(rowIndex, columnIndex, channelIndex) *= scale[filterIndex];
+                        }
+                    }
+                }
+            }
+
+            predictors::neural::ConvolutionalLayer<ValueType> newLayer(layer.GetLayerParameters(), layer.GetConvolutionalParameters(), std::move(weights));
+            return transformer.AddNode<ConvolutionalLayerNode<ValueType>>(input, newLayer);
+        }
+
+        // adds a copy of a fully-connected layer node with the per-output scale folded into its weights
+        template <typename ValueType>
+        const NeuralNetworkLayerNodeBase<ValueType>* AddScaledNode(const FullyConnectedLayerNode<ValueType>& node, const math::ColumnVector<ValueType>& scale, const model::PortElements<ValueType>& input, model::ModelTransformer& transformer)
+        {
+            const auto& layer = node.GetLayer();
+            auto weights = layer.GetWeights();
+            for (size_t rowIndex = 0; rowIndex < scale.Size(); ++rowIndex)
+            {
+                for (size_t columnIndex = 0; columnIndex < weights.NumColumns(); ++columnIndex)
+                {
+                    weights(rowIndex, columnIndex) *= scale[rowIndex];
+                }
+            }
+
+            typename predictors::neural::Layer<ValueType>::MatrixReferenceType weightsReference = weights;
+            predictors::neural::FullyConnectedLayer<ValueType> newLayer(layer.GetLayerParameters(), weightsReference);
+            return transformer.AddNode<FullyConnectedLayerNode<ValueType>>(input, newLayer);
+        }
+
+        // folds the chain following the target node into the target's weights, plus one bias layer
+        // node carrying the accumulated additive term
+        template <typename ValueType, typename LayerNodeType>
+        void FuseChain(const LayerNodeType& targetNode, model::ModelTransformer& transformer)
+        {
+            auto numChannels = targetNode.GetLayer().GetOutputShape()[2];
+            LinearCoefficients<ValueType> coefficients(numChannels);
+
+            const NeuralNetworkLayerNodeBase<ValueType>* last = &targetNode;
+            for (auto next = GetNextFusableNode<ValueType>(*last); next != nullptr; next = GetNextFusableNode<ValueType>(*next))
+            {
+                AccumulateCoefficients(*next, coefficients);
+                last = next;
+            }
+
+            auto newInput = transformer.TransformPortElements(targetNode.input.GetPortElements());
+            auto newTargetNode = AddScaledNode(targetNode, coefficients.scale, newInput, transformer);
+
+            // the bias layer also restores the chain's output shape and padding, so it's emitted
+            // even when the accumulated bias happens to be zero
+            const auto& firstParameters = GetFusableLayerParameters(*GetNextFusableNode<ValueType>(targetNode));
+            const auto& lastParameters = GetFusableLayerParameters(*last);
+            typename predictors::neural::Layer<ValueType>::LayerParameters biasParameters{ firstParameters.input, firstParameters.inputPaddingParameters, lastParameters.outputShape, lastParameters.outputPaddingParameters };
+            predictors::neural::BiasLayer<ValueType> biasLayer(biasParameters, coefficients.bias);
+            auto biasNode = transformer.AddNode<BiasLayerNode<ValueType>>(model::PortElements<ValueType>{ newTargetNode->output }, biasLayer);
+            transformer.MapNodeOutput(last->output, biasNode->output);
+        }
+
+        template <typename ValueType>
+        bool TryFuseLinearChain(const model::Node& node, model::ModelTransformer& transformer)
+        {
+            if (IsFusedWithPredecessor<ValueType>(node))
+            {
+                // this node's operation is folded into its predecessor, which maps the chain's
+                // output when it is visited
+                return true;
+            }
+
+            if (auto convolutionalNode = dynamic_cast<const ConvolutionalLayerNode<ValueType>*>(&node))
+            {
+                if (GetNextFusableNode<ValueType>(*convolutionalNode) != nullptr)
+                {
+                    FuseChain<ValueType>(*convolutionalNode, transformer);
+                    return true;
+                }
+            }
+            else if (auto fullyConnectedNode = dynamic_cast<const FullyConnectedLayerNode<ValueType>*>(&node))
+            {
+                if (IsFusableTargetNode<ValueType>(node) && GetNextFusableNode<ValueType>(*fullyConnectedNode) != nullptr)
+                {
+                    FuseChain<ValueType>(*fullyConnectedNode, transformer);
+                    return true;
+                }
+            }
+            return false;
+        }
+    }
+
+    void FuseLinearOperations(const model::Node& node, model::ModelTransformer& transformer)
+    {
+        if (TryFuseLinearChain<float>(node, transformer))
+        {
+            return;
+        }
+        if (TryFuseLinearChain<double>(node, transformer))
+        {
+            return;
+        }
+        transformer.CopyNode(node);
+    }
+}
+}
@@ -10,6 +10,7 @@
 #include "BinaryOperationNode.h"
 #include "ConstantNode.h"
 #include "DotProductNode.h"
+#include "PortVectorReference.h"
 
 // utilities
 #include "Exception.h"
@@ -78,6 +79,23 @@ namespace nodes
 
     void LinearPredictorNode::Compute() const
     {
+        if (_input.IsContiguous())
+        {
+            // fast path: score directly on the referenced port's storage instead of copying the
+            // input into a data vector first
+            auto input = MakePortVectorReference(_input);
+            _output.SetOutput({ _predictor.Predict(input) });
+
+            const auto& weights = _predictor.GetWeights();
+            std::vector<double> weightedElements(input.Size());
+            for (size_t index = 0; index < weightedElements.size(); ++index)
+            {
+                weightedElements[index] = weights[index] * input[index];
+            }
+            _weightedElements.SetOutput(std::move(weightedElements));
+            return;
+        }
+
         auto inputDataVector = LinearPredictor::DataVectorType(_input.GetIterator());
         _output.SetOutput({ _predictor.Predict(inputDataVector) });
         _weightedElements.SetOutput(_predictor.GetWeightedElements(inputDataVector).ToArray());
@@ -8,6 +8,9 @@
 
 #include "MatrixMatrixMultiplyNode.h"
 
+// emitters
+#include "TargetTuning.h"
+
 // math
 #include "Matrix.h"
 #include "Operations.h"
@@ -71,54 +74,309 @@ namespace nodes
             function.Call(gemm, args);
         }
 
+        // Emits the computation of one output element C[m,n]: the dot product of row m of A and column n of B
+        template <typename ValueType>
+        void EmitMatrixMatrixMultiplyColumn(emitters::IRFunctionEmitter& function, bool transposeA, bool transposeB, int k, int lda, int ldb, int ldc, const emitters::KernelTuningParameters& tuning, llvm::Value* A, llvm::Value* B, llvm::Value* C, llvm::Value* accum, llvm::Value* mIndex, llvm::Value* nIndex)
+        {
+            function.Store(accum, function.Literal(static_cast<ValueType>(0.0)));
+            auto kLoop = function.ForLoop();
+            kLoop.Begin(k);
+            {
+                auto kIndex = kLoop.LoadIterationVariable();
+
+                llvm::Value* aIndex = nullptr;
+                llvm::Value* bIndex = nullptr;
+                if (transposeA)
+                    aIndex = function.Operator(plus, function.Operator(times, kIndex, function.Literal(lda)), mIndex);
+                else
+                    aIndex = function.Operator(plus, function.Operator(times, mIndex, function.Literal(lda)), kIndex);
+
+                if (transposeB)
+                    bIndex = function.Operator(plus, function.Operator(times, nIndex, function.Literal(ldb)), kIndex);
+                else
+                    bIndex = function.Operator(plus, function.Operator(times, kIndex, function.Literal(ldb)), nIndex);
+
+                auto aValue = function.ValueAt(A, aIndex);
+                auto bValue = function.ValueAt(B, bIndex);
+                auto value = function.Operator(timesFloat, aValue, bValue);
+                function.OperationAndUpdate(accum, plusFloat, value);
+
+                // unrolling the reduction breaks up the serial dependency on the accumulator
+                if (tuning.gemmUnrollFactor != 0)
+                {
+                    kLoop.SetVectorizationHints(0, static_cast<int>(tuning.gemmUnrollFactor));
+                }
+            }
+            kLoop.End();
+
+            // store output in C[m,n]
+            auto cIndex = function.Operator(plus, function.Operator(times, mIndex, function.Literal(ldc)), nIndex);
+            function.SetValueAt(C, cIndex, function.Load(accum));
+        }
+
         // TODO: emit this as a function in the module
         template <typename ValueType>
-        void EmitMatrixMatrixMultiplySlow(emitters::IRFunctionEmitter& function, bool transposeA, bool transposeB, int m, int n, int k, llvm::Value* A, int lda, llvm::Value* B, int ldb, llvm::Value* C, int ldc)
+        void EmitMatrixMatrixMultiplySlow(emitters::IRFunctionEmitter& function, bool transposeA, bool transposeB, int m, int n, int k, llvm::Value* A, int lda, llvm::Value* B, int ldb, llvm::Value* C, int ldc, const emitters::KernelTuningParameters& tuning)
+        {
+            // The rows of the output are independent, so the outer loop can be split across worker threads
+            function.ParallelFor(m, { A, B, C }, [=](emitters::IRFunctionEmitter& function, llvm::Value* mIndex, const std::vector<llvm::Value*>& capturedValues) {
+                auto A = capturedValues[0];
+                auto B = capturedValues[1];
+                auto C = capturedValues[2];
+                llvm::Value* accum = function.Variable(emitters::GetVariableType<ValueType>(), "accum");
+
+                int columnBlockSize = static_cast<int>(tuning.gemmColumnBlockSize);
+                if (columnBlockSize == 0 || columnBlockSize >= n)
+                {
+                    auto nLoop = function.ForLoop();
+                    nLoop.Begin(n);
+                    EmitMatrixMatrixMultiplyColumn<ValueType>(function, transposeA, transposeB, k, lda, ldb, ldc, tuning, A, B, C, accum, mIndex, nLoop.LoadIterationVariable());
+                    nLoop.End();
+                }
+                else
+                {
+                    // Block the column loop so the reduction loops for adjacent columns revisit the
+                    // same cache lines of B while they're still resident, instead of streaming the
+                    // whole B row range through the cache once per column.
+                    int mainEnd = n - (n % columnBlockSize);
+                    auto blockLoop = function.ForLoop();
+                    blockLoop.Begin(0, mainEnd, columnBlockSize);
+                    {
+                        auto nStart = blockLoop.LoadIterationVariable();
+                        auto nEnd = function.Operator(plus, nStart, function.Literal(columnBlockSize));
+                        auto nLoop = function.ForLoop();
+                        nLoop.Begin(nStart, nEnd, 1);
+                        EmitMatrixMatrixMultiplyColumn<ValueType>(function, transposeA, transposeB, k, lda, ldb, ldc, tuning, A, B, C, accum, mIndex, nLoop.LoadIterationVariable());
+                        nLoop.End();
+                    }
+                    blockLoop.End();
+
+                    if (mainEnd != n)
+                    {
+                        auto nLoop = function.ForLoop();
+                        nLoop.Begin(mainEnd, n, 1);
+                        EmitMatrixMatrixMultiplyColumn<ValueType>(function, transposeA, transposeB, k, lda, ldb, ldc, tuning, A, B, C, accum, mIndex, nLoop.LoadIterationVariable());
+                        nLoop.End();
+                    }
+                }
+            });
+        }
+        // Emits a register-tiled GEMM with panel packing. Each worker thread owns a strip of
+        // columns of C: it packs its strip of B, one k-block at a time, into a contiguous
+        // stack panel (resolving any transpose at pack time, so the kernel always streams the
+        // panel in order), then walks the rows in tiles of rowTileSize, keeping a
+        // rowTileSize x columnTileSize tile of accumulators live across the whole reduction
+        // block before adding it into C. Leftover rows and columns fall back to the
+        // one-element-at-a-time kernel.
+        template <typename ValueType>
+        void EmitMatrixMatrixMultiplyTiled(emitters::IRFunctionEmitter& function, bool transposeA, bool transposeB, int m, int n, int k, llvm::Value* A, int lda, llvm::Value* B, int ldb, llvm::Value* C, int ldc, const emitters::KernelTuningParameters& tuning)
         {
-            llvm::Value* accum = function.Variable(emitters::GetVariableType<ValueType>(), "accum");
+            const int rowTileSize = static_cast<int>(tuning.gemmRowTileSize);
+            const int columnTileSize = 4; // 4 accumulator columns per tile row fits the vector register file on every target we tile for
+
+            if (m < rowTileSize || n < columnTileSize)
+            {
+                EmitMatrixMatrixMultiplySlow<ValueType>(function, transposeA, transposeB, m, n, k, A, lda, B, ldb, C, ldc, tuning);
+                return;
+            }
 
-            auto mLoop = function.ForLoop();
-            mLoop.Begin(m);
+            int kBlockSize = static_cast<int>(tuning.gemmKBlockSize);
+            if (kBlockSize == 0 || kBlockSize > k)
             {
-                auto mIndex = mLoop.LoadIterationVariable();
+                kBlockSize = k;
+            }
+            const int kMain = k - (k % kBlockSize);
+            const int mMain = m - (m % rowTileSize);
+            const int nMain = n - (n % columnTileSize);
+            const int numColumnStrips = nMain / columnTileSize;
+
+            // software prefetch for the strided walks: only worthwhile when every step lands in a
+            // new cache line, which is the pattern the hardware prefetcher can't follow
+            const int prefetchDistance = static_cast<int>(tuning.prefetchDistance);
+            const bool prefetchB = !transposeB && prefetchDistance > 0 && ldb * static_cast<int>(sizeof(ValueType)) >= 64;
+            const bool prefetchA = transposeA && prefetchDistance > 0 && lda * static_cast<int>(sizeof(ValueType)) >= 64;
+
+            function.ParallelFor(numColumnStrips, { A, B, C }, [=](emitters::IRFunctionEmitter& function, llvm::Value* stripIndex, const std::vector<llvm::Value*>& capturedValues) {
+                auto A = capturedValues[0];
+                auto B = capturedValues[1];
+                auto C = capturedValues[2];
+                auto nStart = function.Operator(times, stripIndex, function.Literal(columnTileSize));
+
+                // the packed panel and the accumulator tile live on the worker's stack
+                llvm::Value* packedB = function.Variable(emitters::GetVariableType<ValueType>(), kBlockSize * columnTileSize);
+                std::vector<llvm::Value*> accum;
+                for (int i = 0; i < rowTileSize * columnTileSize; ++i)
+                {
+                    accum.push_back(function.Variable(emitters::GetVariableType<ValueType>(), "accum"));
+                }
+                llvm::Value* rowAccum = function.Variable(emitters::GetVariableType<ValueType>(), "rowAccum");
 
-                auto nLoop = function.ForLoop();
-                nLoop.Begin(n);
+                // the reduction is accumulated into C one k-block at a time, so clear the strip first
+                auto zeroLoop = function.ForLoop();
+                zeroLoop.Begin(m);
                 {
-                    auto nIndex = nLoop.LoadIterationVariable();
+                    auto mIndex = zeroLoop.LoadIterationVariable();
+                    auto rowOffset = function.Operator(plus, function.Operator(times, mIndex, function.Literal(ldc)), nStart);
+                    for (int c = 0; c < columnTileSize; ++c)
+                    {
+                        function.SetValueAt(C, function.Operator(plus, rowOffset, function.Literal(c)), function.Literal(static_cast<ValueType>(0.0)));
+                    }
+                }
+                zeroLoop.End();
+
+                auto emitKBlock = [&](llvm::Value* kStart, int kc) {
+                    // pack the (kc x columnTileSize) panel of B
+                    auto packLoop = function.ForLoop();
+                    packLoop.Begin(kc);
+                    {
+                        auto kk = packLoop.LoadIterationVariable();
+                        auto kIndex = function.Operator(plus, kStart, kk);
+                        // each k step of the pack hops ldb elements to the next row of B; fetch the
+                        // row the loop will reach a few iterations from now
+                        if (prefetchB)
+                        {
+                            auto prefetchRow = function.Operator(plus, kIndex, function.Literal(prefetchDistance));
+                            function.Prefetch(B, function.Operator(plus, function.Operator(times, prefetchRow, function.Literal(ldb)), nStart));
+                        }
+                        auto packedOffset = function.Operator(times, kk, function.Literal(columnTileSize));
+                        for (int c = 0; c < columnTileSize; ++c)
+                        {
+                            auto nIndex = function.Operator(plus, nStart, function.Literal(c));
+                            llvm::Value* bIndex = nullptr;
+                            if (transposeB)
+                                bIndex = function.Operator(plus, function.Operator(times, nIndex, function.Literal(ldb)), kIndex);
+                            else
+                                bIndex = function.Operator(plus, function.Operator(times, kIndex, function.Literal(ldb)), nIndex);
+                            function.SetValueAt(packedB, function.Operator(plus, packedOffset, function.Literal(c)), function.ValueAt(B, bIndex));
+                        }
+                    }
+                    packLoop.End();
+
+                    // full row tiles
+                    auto mLoop = function.ForLoop();
+                    mLoop.Begin(0, mMain, rowTileSize);
+                    {
+                        auto mStart = mLoop.LoadIterationVariable();
+                        for (auto& accumValue : accum)
+                        {
+                            function.Store(accumValue, function.Literal(static_cast<ValueType>(0.0)));
+                        }
+
+                        auto kkLoop = function.ForLoop();
+                        kkLoop.Begin(kc);
+                        {
+                            auto kk = kkLoop.LoadIterationVariable();
+                            auto kIndex = function.Operator(plus, kStart, kk);
+                            // with A transposed, each k step hops lda elements to the next row of A;
+                            // the tile's rows are contiguous there, so one prefetch covers them
+                            if (prefetchA)
+                            {
+                                auto prefetchRow = function.Operator(plus, kIndex, function.Literal(prefetchDistance));
+                                function.Prefetch(A, function.Operator(plus, function.Operator(times, prefetchRow, function.Literal(lda)), mStart));
+                            }
+                            auto packedOffset = function.Operator(times, kk, function.Literal(columnTileSize));
+                            std::vector<llvm::Value*> bValues;
+                            for (int c = 0; c < columnTileSize; ++c)
+                            {
+                                bValues.push_back(function.ValueAt(packedB, function.Operator(plus, packedOffset, function.Literal(c))));
+                            }
+                            for (int r = 0; r < rowTileSize; ++r)
+                            {
+                                auto mIndex = function.Operator(plus, mStart, function.Literal(r));
+                                llvm::Value* aIndex = nullptr;
+                                if (transposeA)
+                                    aIndex = function.Operator(plus, function.Operator(times, kIndex, function.Literal(lda)), mIndex);
+                                else
+                                    aIndex = function.Operator(plus, function.Operator(times, mIndex, function.Literal(lda)), kIndex);
+                                auto aValue = function.ValueAt(A, aIndex);
+                                for (int c = 0; c < columnTileSize; ++c)
+                                {
+                                    function.OperationAndUpdate(accum[r * columnTileSize + c], plusFloat, function.Operator(timesFloat, aValue, bValues[c]));
+                                }
+                            }
+
+                            if (tuning.gemmUnrollFactor != 0)
+                            {
+                                kkLoop.SetVectorizationHints(0, static_cast<int>(tuning.gemmUnrollFactor));
+                            }
+                        }
+                        kkLoop.End();
+
+                        // add the accumulator tile into C
+                        for (int r = 0; r < rowTileSize; ++r)
+                        {
+                            auto mIndex = function.Operator(plus, mStart, function.Literal(r));
+                            auto rowOffset = function.Operator(plus, function.Operator(times, mIndex, function.Literal(ldc)), nStart);
+                            for (int c = 0; c < columnTileSize; ++c)
+                            {
+                                auto cIndex = function.Operator(plus, rowOffset, function.Literal(c));
+                                function.SetValueAt(C, cIndex, function.Operator(plusFloat, function.ValueAt(C, cIndex), function.Load(accum[r * columnTileSize + c])));
+                            }
+                        }
+                    }
+                    mLoop.End();
 
-                    function.Store(accum, function.Literal(static_cast<ValueType>(0.0)));
-                    auto kLoop = function.ForLoop();
-                    kLoop.Begin(k);
+                    // leftover rows, one at a time, still reading the packed panel
+                    if (mMain != m)
                     {
-                        auto kIndex = kLoop.LoadIterationVariable();
-
-                        llvm::Value* aIndex = nullptr;
-                        llvm::Value* bIndex = nullptr;
-                        if (transposeA)
-                            aIndex = function.Operator(plus, function.Operator(times, kIndex, function.Literal(lda)), mIndex);
-                        else
-                            aIndex = function.Operator(plus, function.Operator(times, mIndex, function.Literal(lda)), kIndex);
-
-                        if (transposeB)
-                            bIndex = function.Operator(plus, function.Operator(times, nIndex, function.Literal(ldb)), kIndex);
-                        else
-                            bIndex = function.Operator(plus, function.Operator(times, kIndex, function.Literal(ldb)), nIndex);
-
-                        auto aValue = function.ValueAt(A, aIndex);
-                        auto bValue = function.ValueAt(B, bIndex);
-                        auto value = function.Operator(timesFloat, aValue, bValue);
-                        function.OperationAndUpdate(accum, plusFloat, value);
+                        auto tailLoop = function.ForLoop();
+                        tailLoop.Begin(mMain, m, 1);
+                        {
+                            auto mIndex = tailLoop.LoadIterationVariable();
+                            for (int c = 0; c < columnTileSize; ++c)
+                            {
+                                function.Store(rowAccum, function.Literal(static_cast<ValueType>(0.0)));
+                                auto kkLoop = function.ForLoop();
+                                kkLoop.Begin(kc);
+                                {
+                                    auto kk = kkLoop.LoadIterationVariable();
+                                    auto kIndex = function.Operator(plus, kStart, kk);
+                                    llvm::Value* aIndex = nullptr;
+                                    if (transposeA)
+                                        aIndex = function.Operator(plus, function.Operator(times, kIndex, function.Literal(lda)), mIndex);
+                                    else
+                                        aIndex = function.Operator(plus, function.Operator(times, mIndex, function.Literal(lda)), kIndex);
+                                    auto bValue = function.ValueAt(packedB, function.Operator(plus, function.Operator(times, kk, function.Literal(columnTileSize)), function.Literal(c)));
+                                    function.OperationAndUpdate(rowAccum, plusFloat, function.Operator(timesFloat, function.ValueAt(A, aIndex), bValue));
+                                }
+                                kkLoop.End();
+
+                                auto cIndex = function.Operator(plus, function.Operator(times, mIndex, function.Literal(ldc)), function.Operator(plus, nStart, function.Literal(c)));
+                                function.SetValueAt(C, cIndex, function.Operator(plusFloat, function.ValueAt(C, cIndex), function.Load(rowAccum)));
+                            }
+                        }
+                        tailLoop.End();
                     }
-                    kLoop.End();
+                };
+
+                if (kMain != 0)
+                {
+                    auto kBlockLoop = function.ForLoop();
+                    kBlockLoop.Begin(0, kMain, kBlockSize);
+                    emitKBlock(kBlockLoop.LoadIterationVariable(), kBlockSize);
+                    kBlockLoop.End();
+                }
+                if (kMain != k)
+                {
+                    emitKBlock(function.Literal(kMain), k - kMain);
+                }
+            });
 
-                    // store output in C[m,n]
-                    auto cIndex = function.Operator(plus, function.Operator(times, mIndex, function.Literal(ldc)), nIndex);
-                    function.SetValueAt(C, cIndex, function.Load(accum));
+            // leftover columns: plain dot products over all rows
+            if (nMain != n)
+            {
+                llvm::Value* accum = function.Variable(emitters::GetVariableType<ValueType>(), "accum");
+                auto mLoop = function.ForLoop();
+                mLoop.Begin(m);
+                {
+                    auto mIndex = mLoop.LoadIterationVariable();
+                    auto nLoop = function.ForLoop();
+                    nLoop.Begin(nMain, n, 1);
+                    EmitMatrixMatrixMultiplyColumn<ValueType>(function, transposeA, transposeB, k, lda, ldb, ldc, tuning, A, B, C, accum, mIndex, nLoop.LoadIterationVariable());
+                    nLoop.End();
                 }
-                nLoop.End();
+                mLoop.End();
             }
-            mLoop.End();
         }
     } // end anonymous namespace
 
@@ -201,7 +459,15 @@ namespace nodes
         }
         else
         {
-            EmitMatrixMatrixMultiplySlow<ValueType>(function, _transpose1, _transpose2, (int)_m, (int)_n, (int)_k, pInput1, (int)_lda, pInput2, (int)_ldb, pOutput, (int)_ldc);
+            auto tuning = emitters::GetKernelTuningParameters(compiler.GetCompilerParameters().targetDevice);
+            if (tuning.gemmRowTileSize != 0)
+            {
+                EmitMatrixMatrixMultiplyTiled<ValueType>(function, _transpose1, _transpose2, (int)_m, (int)_n, (int)_k, pInput1, (int)_lda, pInput2, (int)_ldb, pOutput, (int)_ldc, tuning);
+            }
+            else
+            {
+                EmitMatrixMatrixMultiplySlow<ValueType>(function, _transpose1, _transpose2, (int)_m, (int)_n, (int)_k, pInput1, (int)_lda, pInput2, (int)_ldb, pOutput, (int)_ldc, tuning);
+            }
         }
     }
 
@@ -103,6 +103,92 @@ namespace nodes
             }
             mLoop.End();
         }
+
+        // Register-blocked version of the loop above, for unit-stride x and y: processes
+        // blockSize rows at a time with one accumulator per row, so each element of x is loaded
+        // once per block and the independent accumulator chains give the backend's vector/FMA
+        // units work to overlap. The matrix is row-major, so every read is already unit-stride
+        // and no transposed copy of the weights is needed.
+        constexpr int gemvBlockSize = 4;
+
+        template <typename ValueType>
+        void EmitMatrixVectorMultiplyBlocked(emitters::IRFunctionEmitter& function, int m, int n, llvm::Value* M, int lda, llvm::Value* x, llvm::Value* y)
+        {
+            llvm::Value* rowOffset = function.Variable(emitters::VariableType::Int32, "rowOffset");
+            llvm::Value* rowPos = function.Variable(emitters::VariableType::Int32, "rowPos");
+            llvm::Value* xPos = function.Variable(emitters::VariableType::Int32, "xPos");
+            llvm::Value* yPos = function.Variable(emitters::VariableType::Int32, "yPos");
+            std::vector<llvm::Value*> accumulators;
+            for (int block = 0; block < gemvBlockSize; ++block)
+            {
+                accumulators.push_back(function.Variable(emitters::GetVariableType<ValueType>(), "accum" + std::to_string(block)));
+            }
+
+            function.Store(rowOffset, function.Literal(0));
+            function.Store(yPos, function.Literal(0));
+
+            int numFullBlocks = m / gemvBlockSize;
+            if (numFullBlocks > 0)
+            {
+                auto blockLoop = function.ForLoop();
+                blockLoop.Begin(numFullBlocks);
+                {
+                    function.Store(rowPos, function.Load(rowOffset));
+                    function.Store(xPos, function.Literal(0));
+                    for (int block = 0; block < gemvBlockSize; ++block)
+                    {
+                        function.Store(accumulators[block], function.Literal(static_cast<ValueType>(0.0)));
+                    }
+
+                    auto nLoop = function.ForLoop();
+                    nLoop.Begin(n);
+                    {
+                        auto xVal = function.ValueAt(x, function.Load(xPos));
+                        for (int block = 0; block < gemvBlockSize; ++block)
+                        {
+                            auto mVal = function.ValueAt(M, function.Operator(plus, function.Load(rowPos), function.Literal(block * lda)));
+                            function.OperationAndUpdate(accumulators[block], plusFloat, function.Operator(timesFloat, mVal, xVal));
+                        }
+
+                        function.OperationAndUpdate(rowPos, plus, function.Literal(1));
+                        function.OperationAndUpdate(xPos, plus, function.Literal(1));
+                    }
+                    nLoop.End();
+
+                    for (int block = 0; block < gemvBlockSize; ++block)
+                    {
+                        function.SetValueAt(y, function.Operator(plus, function.Load(yPos), function.Literal(block)), function.Load(accumulators[block]));
+                    }
+                    function.OperationAndUpdate(yPos, plus, function.Literal(gemvBlockSize));
+                    function.OperationAndUpdate(rowOffset, plus, function.Literal(gemvBlockSize * lda));
+                }
+                blockLoop.End();
+            }
+
+            // leftover rows (fewer than gemvBlockSize), one accumulator each, unrolled at emit time
+            for (int row = numFullBlocks * gemvBlockSize; row < m; ++row)
+            {
+                function.Store(rowPos, function.Load(rowOffset));
+                function.Store(xPos, function.Literal(0));
+                function.Store(accumulators[0], function.Literal(static_cast<ValueType>(0.0)));
+
+                auto nLoop = function.ForLoop();
+                nLoop.Begin(n);
+                {
+                    auto mVal = function.ValueAt(M, function.Load(rowPos));
+                    auto xVal = function.ValueAt(x, function.Load(xPos));
+                    function.OperationAndUpdate(accumulators[0], plusFloat, function.Operator(timesFloat, mVal, xVal));
+
+                    function.OperationAndUpdate(rowPos, plus, function.Literal(1));
+                    function.OperationAndUpdate(xPos, plus, function.Literal(1));
+                }
+                nLoop.End();
+
+                function.SetValueAt(y, function.Load(yPos), function.Load(accumulators[0]));
+                function.OperationAndUpdate(yPos, plus, function.Literal(1));
+                function.OperationAndUpdate(rowOffset, plus, function.Literal(lda));
+            }
+        }
     } // end anonymous namespace
 
     template <typename ValueType>
@@ -164,6 +250,10 @@ namespace nodes
         {
             EmitMatrixVectorMultiplyBlas<ValueType>(function, (int)_m, (int)_n, pInputMatrix, (int)_lda, pInputVector, _incx, pOutput, 1);
         }
+        else if (_incx == 1)
+        {
+            EmitMatrixVectorMultiplyBlocked<ValueType>(function, (int)_m, (int)_n, pInputMatrix, (int)_lda, pInputVector, pOutput);
+        }
         else
         {
             EmitMatrixVectorMultiplySlow<ValueType>(function, (int)_m, (int)_n, pInputMatrix, (int)_lda, pInputVector, _incx, pOutput, 1);
@@ -0,0 +1,145 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     OptimizeReorderDataNodes.cpp (nodes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "OptimizeReorderDataNodes.h"
+
+// nodes
+#include "ReorderDataNode.h"
+
+namespace ell
+{
+namespace nodes
+{
+    namespace
+    {
+        // a collapsible link must consume the entire output of its predecessor, unpermuted
+        template <typename ValueType>
+        bool ReferencesEntirePort(const model::InputPort<ValueType>& input, const model::OutputPort<ValueType>& output)
+        {
+            auto elements = input.GetPortElements();
+            if (elements.NumRanges() != 1)
+            {
+                return false;
+            }
+            const auto& range = elements.GetRanges()[0];
+            return range.ReferencedPort() == &output && range.GetStartIndex() == 0 && range.Size() == output.Size();
+        }
+
+        bool ExtentsEqual(const DataShape& shape1, const DataShape& shape2)
+        {
+            for (int index = 0; index < static_cast<int>(DataShape::Dimension); ++index)
+            {
+                if (shape1.GetExtent(index) != shape2.GetExtent(index))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // returns the reorder node producing this node's entire input, or nullptr
+        template <typename ValueType>
+        const ReorderDataNode<ValueType>* GetParentReorderNode(const ReorderDataNode<ValueType>& node)
+        {
+            auto elements = node.input.GetPortElements();
+            if (elements.NumRanges() != 1)
+            {
+                return nullptr;
+            }
+            const auto& range = elements.GetRanges()[0];
+            auto parentPort = range.ReferencedPort();
+            if (range.GetStartIndex() != 0 || range.Size() != parentPort->Size())
+            {
+                return nullptr;
+            }
+            return dynamic_cast<const ReorderDataNode<ValueType>*>(parentPort->GetNode());
+        }
+
+        // returns the node's sole dependent if it's a reorder node that collapses this node into
+        // itself when visited: it must consume this node's entire output, agree on the intermediate
+        // layout, and preserve the logical extents so the composed conversion is exact
+        template <typename ValueType>
+        const ReorderDataNode<ValueType>* GetCollapsingDependent(const ReorderDataNode<ValueType>& node)
+        {
+            const auto& dependents = node.GetDependentNodes();
+            if (dependents.size() != 1)
+            {
+                return nullptr;
+            }
+            auto next = dynamic_cast<const ReorderDataNode<ValueType>*>(dependents[0]);
+            if (next == nullptr || !ReferencesEntirePort(next->input, node.output))
+            {
+                return nullptr;
+            }
+            if (!DataShapesEqual(node.GetOutputShape(), next->GetInputShape()) || !ExtentsEqual(node.GetInputShape(), next->GetOutputShape()))
+            {
+                return nullptr;
+            }
+            return next;
+        }
+
+        template <typename ValueType>
+        bool TryOptimizeReorderDataNode(const model::Node& node, model::ModelTransformer& transformer)
+        {
+            auto reorderNode = dynamic_cast<const ReorderDataNode<ValueType>*>(&node);
+            if (reorderNode == nullptr)
+            {
+                return false;
+            }
+
+            // if this node's entire output feeds exactly one downstream reorder node, that node
+            // collapses the pair when it is visited; emit nothing here
+            if (GetCollapsingDependent(*reorderNode) != nullptr)
+            {
+                return true;
+            }
+
+            // walk upstream over collapsible reorder parents to find the start of the chain
+            auto first = reorderNode;
+            for (auto parent = GetParentReorderNode(*first); parent != nullptr && GetCollapsingDependent(*parent) == first; parent = GetParentReorderNode(*first))
+            {
+                first = parent;
+            }
+
+            if (DataShapesEqual(first->GetInputShape(), reorderNode->GetOutputShape()))
+            {
+                // the conversions cancel out (or the node was an identity to begin with), so the
+                // chain's consumers can read the original data directly
+                auto newInput = transformer.TransformPortElements(first->input.GetPortElements());
+                transformer.MapNodeOutput(reorderNode->output, newInput);
+                return true;
+            }
+
+            if (first != reorderNode)
+            {
+                // collapse the chain into a single conversion from the first layout to the last
+                auto newInput = transformer.TransformPortElements(first->input.GetPortElements());
+                auto newNode = transformer.AddNode<ReorderDataNode<ValueType>>(newInput, first->GetInputShape(), reorderNode->GetOutputShape());
+                transformer.MapNodeOutput(reorderNode->output, newNode->output);
+                return true;
+            }
+
+            // a lone reorder with a real layout change: keep it
+            return false;
+        }
+    }
+
+    void OptimizeReorderDataNodes(const model::Node& node, model::ModelTransformer& transformer)
+    {
+        if (TryOptimizeReorderDataNode<float>(node, transformer))
+        {
+            return;
+        }
+        if (TryOptimizeReorderDataNode<double>(node, transformer))
+        {
+            return;
+        }
+        transformer.CopyNode(node);
+    }
+}
+}
@@ -69,6 +69,25 @@ namespace nodes
             return function.Load(_accumValueVar);
         }
 
+        // Branch-free value-based interface, used when the whole window is known to be in bounds.
+        // Keeping the accumulator in SSA values (selects instead of stores and branches) lets the
+        // vectorizer turn the channel loop into elementwise vector max.
+        llvm::Value* InitialValue(emitters::IRFunctionEmitter& function)
+        {
+            return function.Literal<ValueType>(-(std::numeric_limits<ValueType>::max()));
+        }
+
+        llvm::Value* AccumulateValue(emitters::IRFunctionEmitter& function, llvm::Value* accumulator, llvm::Value* value)
+        {
+            auto isGreater = function.Comparison(emitters::TypedComparison::greaterThanFloat, value, accumulator);
+            return function.Select(isGreater, value, accumulator);
+        }
+
+        llvm::Value* FinalValue(emitters::IRFunctionEmitter& function, llvm::Value* accumulator, int windowSize)
+        {
+            return accumulator;
+        }
+
     private:
         llvm::Value* _accumValueVar;
     };
@@ -109,6 +128,23 @@ namespace nodes
             return function.Operator(emitters::TypedOperator::divideFloat, function.Load(_accumValueVar), function.CastValue<int, ValueType>(function.Load(_countVar)));
         }
 
+        // Branch-free value-based interface, used when the whole window is known to be in bounds
+        // (so the divisor is the compile-time window size and no count has to be kept)
+        llvm::Value* InitialValue(emitters::IRFunctionEmitter& function)
+        {
+            return function.Literal<ValueType>(0);
+        }
+
+        llvm::Value* AccumulateValue(emitters::IRFunctionEmitter& function, llvm::Value* accumulator, llvm::Value* value)
+        {
+            return function.Operator(emitters::TypedOperator::addFloat, accumulator, value);
+        }
+
+        llvm::Value* FinalValue(emitters::IRFunctionEmitter& function, llvm::Value* accumulator, int windowSize)
+        {
+            return function.Operator(emitters::TypedOperator::divideFloat, accumulator, function.Literal<ValueType>(static_cast<ValueType>(windowSize)));
+        }
+
     private:
         llvm::Value* _accumValueVar;
         llvm::Value* _countVar;
@@ -201,19 +237,21 @@ namespace nodes
 
         // TODO: add prologue / epilogue for padded / out-of-bounds values
 
-        // Create the pooling function
         using FType = typename PoolingFunctionT<PoolingFunctionType, ValueType>::type;
-        FType poolingFunction{ function };
 
         // TODO: implement these nested loops via recursion
         const int rowDimension = 0;
         const int columnDimension = 1;
         const int channelDimension = 2;
 
-        auto rowLoop = function.ForLoop();
-        rowLoop.Begin(outputRows); // for each row
-        {
-            auto outputRowIndex = rowLoop.LoadIterationVariable();
+        // The output rows are independent, so the row loop can be split across worker threads
+        function.ParallelFor(outputRows, { pInput, pOutput }, [&](emitters::IRFunctionEmitter& function, llvm::Value* outputRowIndex, const std::vector<llvm::Value*>& capturedValues) { // for each row
+            auto pInput = capturedValues[0];
+            auto pOutput = capturedValues[1];
+
+            // Create the pooling function
+            FType poolingFunction{ function };
+
             auto inputRowIndex = function.Operator(times, outputRowIndex, function.Literal(stride));
 
             llvm::Value* rowInputInternalOffset = function.Operator(plus, inputRowIndex, function.Literal<int>(inputOffset[rowDimension]));
@@ -238,6 +276,9 @@ namespace nodes
 
                 auto channelLoop = function.ForLoop();
                 channelLoop.Begin(inputDepth); // for each channel
+                // channels are unit-stride in both input and output, so this is the vectorizable loop;
+                // ask for the device's full SIMD width since the window reads defeat the cost model
+                channelLoop.SetVectorizationHints(static_cast<int>(emitters::GetPreferredVectorWidth(compiler.GetCompilerParameters().targetDevice, sizeof(ValueType))));
                 {
                     auto channelIndex = channelLoop.LoadIterationVariable();
 
@@ -258,23 +299,39 @@ namespace nodes
 
                     // Now loop over the input window
                     //
-                    poolingFunction.Reset(function);
-                    for (int poolRowIndex = 0; poolRowIndex < poolingSize; ++poolRowIndex)
+                    if (canSkipBoundsCheck)
                     {
-                        for (int poolColumnIndex = 0; poolColumnIndex < poolingSize; ++poolColumnIndex)
+                        // every window read is in bounds, so the whole unrolled window reduces
+                        // through SSA values, with no accumulator stores or bounds branches in
+                        // the way of the vectorizer
+                        llvm::Value* accumulator = poolingFunction.InitialValue(function);
+                        for (int poolRowIndex = 0; poolRowIndex < poolingSize; ++poolRowIndex)
                         {
-                            int offsetX = poolColumnIndex + paddingColumnOffset; // ix - padding
-                            int offsetY = poolRowIndex + paddingRowOffset; // iy - padding
-                            auto totalOffset = (offsetX * inputIncrement[0]) + (offsetY * inputIncrement[1]);
-
-                            if (canSkipBoundsCheck)
+                            for (int poolColumnIndex = 0; poolColumnIndex < poolingSize; ++poolColumnIndex)
                             {
+                                int offsetX = poolColumnIndex + paddingColumnOffset; // ix - padding
+                                int offsetY = poolRowIndex + paddingRowOffset; // iy - padding
+                                auto totalOffset = (offsetX * inputIncrement[0]) + (offsetY * inputIncrement[1]);
+
                                 auto valueIndex = function.Operator(plus, inputLocationOffset, function.Literal<int>(totalOffset));
                                 auto value = function.ValueAt(pInput, valueIndex);
-                                poolingFunction.Accumulate(function, value);
+                                accumulator = poolingFunction.AccumulateValue(function, accumulator, value);
                             }
-                            else
+                        }
+                        auto value = poolingFunction.FinalValue(function, accumulator, poolingSize * poolingSize);
+                        function.SetValueAt(pOutput, outputLocationOffset, value);
+                    }
+                    else
+                    {
+                        poolingFunction.Reset(function);
+                        for (int poolRowIndex = 0; poolRowIndex < poolingSize; ++poolRowIndex)
+                        {
+                            for (int poolColumnIndex = 0; poolColumnIndex < poolingSize; ++poolColumnIndex)
                             {
+                                int offsetX = poolColumnIndex + paddingColumnOffset; // ix - padding
+                                int offsetY = poolRowIndex + paddingRowOffset; // iy - padding
+                                auto totalOffset = (offsetX * inputIncrement[0]) + (offsetY * inputIncrement[1]);
+
                                 //
                                 // This is a bit of a mess, but it works
                                 //
@@ -305,16 +362,15 @@ namespace nodes
                                 ifEmitter.End();
                             }
                         }
-                    }
 
-                    auto value = poolingFunction.GetValue(function);
-                    function.SetValueAt(pOutput, outputLocationOffset, value);
+                        auto value = poolingFunction.GetValue(function);
+                        function.SetValueAt(pOutput, outputLocationOffset, value);
+                    }
                 }
                 channelLoop.End();
             }
             columnLoop.End();
-        }
-        rowLoop.End();
+        });
 
     } // end function
 
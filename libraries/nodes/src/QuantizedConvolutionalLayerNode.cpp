@@ -0,0 +1,42 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     QuantizedConvolutionalLayerNode.cpp (nodes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "QuantizedConvolutionalLayerNode.h"
+#include "ConvolutionalLayerNode.h"
+
+namespace ell
+{
+namespace nodes
+{
+    template <typename ValueType>
+    QuantizedConvolutionalLayerNode<ValueType>::QuantizedConvolutionalLayerNode(const model::PortElements<ValueType>& input, const predictors::neural::QuantizedConvolutionalLayer<ValueType>& layer)
+        : NeuralNetworkLayerNode<QuantizedConvolutionalLayerNode<ValueType>, predictors::neural::QuantizedConvolutionalLayer<ValueType>, ValueType>(input, layer)
+    {
+    }
+
+    template <typename ValueType>
+    bool QuantizedConvolutionalLayerNode<ValueType>::Refine(model::ModelTransformer& transformer) const
+    {
+        auto newInput = transformer.TransformPortElements(this->input.GetPortElements());
+
+        // Build an equivalent full-precision layer from the dequantized weights, so the compiled
+        // code uses the existing convolutional lowering. The compiled output differs from this
+        // node's Compute only by the dynamic input quantization Compute performs.
+        auto weights = this->GetLayer().GetDequantizedWeights();
+        predictors::neural::ConvolutionalLayer<ValueType> equivalentLayer(this->GetLayer().GetLayerParameters(), this->GetLayer().GetConvolutionalParameters(), std::move(weights));
+        auto newNode = transformer.AddNode<ConvolutionalLayerNode<ValueType>>(newInput, equivalentLayer);
+
+        transformer.MapNodeOutput(this->output, newNode->output);
+        return true;
+    }
+
+    // Explicit specialization
+    template class QuantizedConvolutionalLayerNode<float>;
+    template class QuantizedConvolutionalLayerNode<double>;
+} // nodes
+} // ell
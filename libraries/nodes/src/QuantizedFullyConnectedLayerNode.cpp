@@ -0,0 +1,56 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     QuantizedFullyConnectedLayerNode.cpp (nodes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "QuantizedFullyConnectedLayerNode.h"
+#include "FullyConnectedLayerNode.h"
+
+// utilities
+#include "Exception.h"
+
+namespace ell
+{
+namespace nodes
+{
+    template <typename ValueType>
+    QuantizedFullyConnectedLayerNode<ValueType>::QuantizedFullyConnectedLayerNode(const model::PortElements<ValueType>& input, const predictors::neural::QuantizedFullyConnectedLayer<ValueType>& layer)
+        : NeuralNetworkLayerNode<QuantizedFullyConnectedLayerNode<ValueType>, predictors::neural::QuantizedFullyConnectedLayer<ValueType>, ValueType>(input, layer)
+    {
+        const auto& layerParameters = layer.GetLayerParameters();
+        if (HasPadding(layerParameters.inputPaddingParameters))
+        {
+            throw utilities::LogicException(utilities::LogicExceptionErrors::notImplemented, "QuantizedFullyConnectedLayerNode does not currently support inputs with padding");
+        }
+
+        if (HasPadding(layerParameters.outputPaddingParameters))
+        {
+            throw utilities::LogicException(utilities::LogicExceptionErrors::notImplemented, "QuantizedFullyConnectedLayerNode does not currently support outputs with padding");
+        }
+    }
+
+    template <typename ValueType>
+    bool QuantizedFullyConnectedLayerNode<ValueType>::Refine(model::ModelTransformer& transformer) const
+    {
+        auto newInput = transformer.TransformPortElements(this->input.GetPortElements());
+
+        // Build an equivalent full-precision layer from the dequantized weights, so the compiled
+        // code uses the existing fully-connected lowering. The compiled output differs from this
+        // node's Compute only by the dynamic input quantization Compute performs.
+        auto weights = this->GetLayer().GetDequantizedWeights();
+        typename predictors::neural::FullyConnectedLayer<ValueType>::MatrixReferenceType weightsReference = weights;
+        predictors::neural::FullyConnectedLayer<ValueType> equivalentLayer(this->GetLayer().GetLayerParameters(), weightsReference);
+        auto newNode = transformer.AddNode<FullyConnectedLayerNode<ValueType>>(newInput, equivalentLayer);
+
+        transformer.MapNodeOutput(this->output, newNode->output);
+        return true;
+    }
+
+    // Explicit specialization
+    template class QuantizedFullyConnectedLayerNode<float>;
+    template class QuantizedFullyConnectedLayerNode<double>;
+} // nodes
+} // ell
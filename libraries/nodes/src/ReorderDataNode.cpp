@@ -79,6 +79,13 @@ namespace nodes
         return result;
     }
 
+    std::array<size_t, DataShape::Dimension> DataShape::GetDimensionOrder() const
+    {
+        std::array<size_t, Dimension> order = { 0, 1, 2 };
+        std::stable_sort(order.begin(), order.end(), [this](size_t dimension1, size_t dimension2) { return _stride[dimension1] > _stride[dimension2]; });
+        return order;
+    }
+
     bool DataShape::IsOutOfBounds(const std::array<int, Dimension>& location) const
     {
         for (int index = 0; index < Dimension; ++index)
@@ -91,6 +98,20 @@ namespace nodes
         return false;
     }
 
+    bool DataShape::IsAlwaysInBounds(const DataShape& walkedShape) const
+    {
+        // mirrors IsOutOfBounds: a walk visits locations in [0, walkedExtent) along each dimension,
+        // so nothing can fall outside this shape when those extremes are inside its bounds
+        for (int index = 0; index < Dimension; ++index)
+        {
+            int minBounds = -_offset[index]; // needs to be signed -- can be negative
+            int maxBounds = _extent[index] + _offset[index];
+            if (minBounds > 0 || static_cast<int>(walkedShape.GetExtent(index)) > maxBounds)
+                return false;
+        }
+        return true;
+    }
+
     llvm::Value* DataShape::EmitGetEntryOffset(emitters::IRFunctionEmitter& function, const std::array<llvm::Value*, Dimension>& location) const
     {
         llvm::Value* result = nullptr;
@@ -150,5 +171,19 @@ namespace nodes
 
         archiver["size"] >> _totalSize;
     }
+
+    bool DataShapesEqual(const DataShape& shape1, const DataShape& shape2)
+    {
+        for (int index = 0; index < static_cast<int>(DataShape::Dimension); ++index)
+        {
+            if (shape1.GetExtent(index) != shape2.GetExtent(index) ||
+                shape1.GetStride(index) != shape2.GetStride(index) ||
+                shape1.GetOffset(index) != shape2.GetOffset(index))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
 } // nodes
 } // ell
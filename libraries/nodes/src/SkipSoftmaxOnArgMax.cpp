@@ -0,0 +1,111 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     SkipSoftmaxOnArgMax.cpp (nodes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "SkipSoftmaxOnArgMax.h"
+
+// nodes
+#include "ExtremalValueNode.h"
+#include "SoftmaxLayerNode.h"
+
+namespace ell
+{
+namespace nodes
+{
+    namespace
+    {
+        // an elidable link must consume the entire output of its predecessor, unpermuted
+        template <typename ValueType>
+        bool ReferencesEntirePort(const model::InputPort<ValueType>& input, const model::OutputPort<ValueType>& output)
+        {
+            auto elements = input.GetPortElements();
+            if (elements.NumRanges() != 1)
+            {
+                return false;
+            }
+            const auto& range = elements.GetRanges()[0];
+            return range.ReferencedPort() == &output && range.GetStartIndex() == 0 && range.Size() == output.Size();
+        }
+
+        // true when no dependent of the node reads the given output port
+        bool PortIsUnread(const model::Node& node, const model::OutputPortBase& port)
+        {
+            for (auto dependent : node.GetDependentNodes())
+            {
+                for (auto inputPort : dependent->GetInputPorts())
+                {
+                    for (const auto& range : inputPort->GetInputElements().GetRanges())
+                    {
+                        if (range.ReferencedPort() == &port)
+                        {
+                            return false;
+                        }
+                    }
+                }
+            }
+            return true;
+        }
+
+        template <typename ValueType>
+        bool TrySkipSoftmax(const model::Node& node, model::ModelTransformer& transformer)
+        {
+            auto softmaxNode = dynamic_cast<const SoftmaxLayerNode<ValueType>*>(&node);
+            if (softmaxNode == nullptr)
+            {
+                return false;
+            }
+
+            // the input must read straight through: input-side padding would put border elements
+            // in the argmax scan
+            const auto& inputLayout = softmaxNode->GetInputMemoryLayout();
+            if (inputLayout.size != inputLayout.stride || softmaxNode->input.Size() != softmaxNode->output.Size())
+            {
+                return false;
+            }
+
+            const auto& dependents = softmaxNode->GetDependentNodes();
+            if (dependents.empty())
+            {
+                return false;
+            }
+            for (auto dependent : dependents)
+            {
+                auto argMaxNode = dynamic_cast<const ArgMaxNode<ValueType>*>(dependent);
+                if (argMaxNode == nullptr || !ReferencesEntirePort(argMaxNode->input, softmaxNode->output))
+                {
+                    return false;
+                }
+
+                // softmax is monotone, so the argmax index is unchanged, but the extremal value
+                // itself would become a raw logit - only elide when nothing reads it
+                if (!PortIsUnread(*argMaxNode, argMaxNode->val))
+                {
+                    return false;
+                }
+            }
+
+            // rewire the argmax nodes to read the logits directly
+            auto newInput = transformer.TransformPortElements(softmaxNode->input.GetPortElements());
+            transformer.MapNodeOutput(softmaxNode->output, newInput);
+            return true;
+        }
+    }
+
+    void SkipSoftmaxOnArgMax(const model::Node& node, model::ModelTransformer& transformer)
+    {
+        if (TrySkipSoftmax<float>(node, transformer))
+        {
+            return;
+        }
+        if (TrySkipSoftmax<double>(node, transformer))
+        {
+            return;
+        }
+        transformer.CopyNode(node);
+    }
+}
+}
@@ -65,7 +65,8 @@ namespace nodes
             {
                 auto valueType = emitters::GetVariableType<ValueType>();
                 _accumValueVar = function.Variable(valueType, "eulerSumAccumValue");
-                _expFunc = function.GetModule().GetRuntime().GetExpFunction<ValueType>();
+                auto useFastMath = function.GetModule().GetCompilerParameters().useFastMath;
+                _expFunc = useFastMath ? function.GetModule().GetRuntime().GetFastExpFunction<ValueType>() : function.GetModule().GetRuntime().GetExpFunction<ValueType>();
                 Reset(function);
             }
 
@@ -0,0 +1,92 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     SparseLinearPredictorNode.cpp (nodes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "SparseLinearPredictorNode.h"
+#include "BinaryOperationNode.h"
+#include "ConstantNode.h"
+#include "SparseDotProductNode.h"
+
+// utilities
+#include "Exception.h"
+
+// stl
+#include <cassert>
+#include <string>
+#include <vector>
+
+namespace ell
+{
+namespace nodes
+{
+    SparseLinearPredictorNode::SparseLinearPredictorNode()
+        : Node({ &_values, &_indices }, { &_output }), _values(this, {}, valuesPortName), _indices(this, {}, indicesPortName), _output(this, outputPortName, 1)
+    {
+    }
+
+    SparseLinearPredictorNode::SparseLinearPredictorNode(const model::PortElements<double>& values, const model::PortElements<int>& indices, const predictors::LinearPredictor& predictor)
+        : Node({ &_values, &_indices }, { &_output }), _values(this, values, valuesPortName), _indices(this, indices, indicesPortName), _output(this, outputPortName, 1), _predictor(predictor)
+    {
+        assert(values.Size() == indices.Size());
+    }
+
+    void SparseLinearPredictorNode::WriteToArchive(utilities::Archiver& archiver) const
+    {
+        Node::WriteToArchive(archiver);
+        archiver[valuesPortName] << _values;
+        archiver[indicesPortName] << _indices;
+        archiver["predictor"] << _predictor;
+    }
+
+    void SparseLinearPredictorNode::ReadFromArchive(utilities::Unarchiver& archiver)
+    {
+        Node::ReadFromArchive(archiver);
+        archiver[valuesPortName] >> _values;
+        archiver[indicesPortName] >> _indices;
+        archiver["predictor"] >> _predictor;
+    }
+
+    void SparseLinearPredictorNode::Copy(model::ModelTransformer& transformer) const
+    {
+        auto newValues = transformer.TransformPortElements(_values.GetPortElements());
+        auto newIndices = transformer.TransformPortElements(_indices.GetPortElements());
+        auto newNode = transformer.AddNode<SparseLinearPredictorNode>(newValues, newIndices, _predictor);
+        transformer.MapNodeOutput(output, newNode->output);
+    }
+
+    bool SparseLinearPredictorNode::Refine(model::ModelTransformer& transformer) const
+    {
+        auto newValues = transformer.TransformPortElements(_values.GetPortElements());
+        auto newIndices = transformer.TransformPortElements(_indices.GetPortElements());
+
+        auto weightsNode = transformer.AddNode<ConstantNode<double>>(_predictor.GetWeights().ToArray());
+        auto dotProductNode = transformer.AddNode<SparseDotProductNode<double>>(weightsNode->output, newValues, newIndices);
+        auto biasNode = transformer.AddNode<ConstantNode<double>>(_predictor.GetBias());
+        auto addNode = transformer.AddNode<BinaryOperationNode<double>>(dotProductNode->output, biasNode->output, emitters::BinaryOperationType::add);
+
+        transformer.MapNodeOutput(output, addNode->output);
+        return true;
+    }
+
+    void SparseLinearPredictorNode::Compute() const
+    {
+        const auto& weights = _predictor.GetWeights();
+        double result = _predictor.GetBias();
+        for (size_t entry = 0; entry < _values.Size(); ++entry)
+        {
+            auto index = static_cast<size_t>(_indices[entry]);
+            result += weights[index] * _values[entry];
+        }
+        _output.SetOutput({ result });
+    }
+
+    SparseLinearPredictorNode* AddNodeToModelTransformer(const model::PortElements<double>& values, const model::PortElements<int>& indices, const predictors::LinearPredictor& predictor, model::ModelTransformer& transformer)
+    {
+        return transformer.AddNode<SparseLinearPredictorNode>(values, indices, predictor);
+    }
+}
+}
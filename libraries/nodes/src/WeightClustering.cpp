@@ -0,0 +1,35 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     WeightClustering.cpp (nodes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "WeightClustering.h"
+
+// utilities
+#include "Exception.h"
+
+namespace ell
+{
+namespace nodes
+{
+    std::vector<int> PackWeightIndices(const std::vector<uint8_t>& indices, size_t bitsPerIndex)
+    {
+        if (bitsPerIndex == 0 || bitsPerIndex > 8)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "bitsPerIndex must be between 1 and 8");
+        }
+
+        auto indicesPerWord = 32 / bitsPerIndex;
+        std::vector<int> words((indices.size() + indicesPerWord - 1) / indicesPerWord, 0);
+        for (size_t i = 0; i < indices.size(); ++i)
+        {
+            // shift in unsigned arithmetic: an 8-bit index in the top slot reaches the sign bit
+            words[i / indicesPerWord] |= static_cast<int>(static_cast<uint32_t>(indices[i]) << ((i % indicesPerWord) * bitsPerIndex));
+        }
+        return words;
+    }
+}
+}
@@ -50,92 +50,96 @@ namespace nodes
             throw utilities::InputException(utilities::InputExceptionErrors::indexOutOfRange, "Unknown binary operation");
         }
 
+        // The operations are stateless functor types, so the per-element call in ComputeOutput
+        // compiles down to raw arithmetic; the operation enum is only consulted once per
+        // evaluation (and at archive boundaries)
+
         template <typename ValueType>
-        ValueType Add(ValueType a, ValueType b)
+        struct Add
         {
-            return a + b;
-        }
+            ValueType operator()(ValueType a, ValueType b) const { return a + b; }
+        };
 
         template <>
-        inline bool Add(bool a, bool b)
+        struct Add<bool>
         {
-            throw utilities::InputException(utilities::InputExceptionErrors::typeMismatch);
-        }
+            bool operator()(bool, bool) const { throw utilities::InputException(utilities::InputExceptionErrors::typeMismatch); }
+        };
 
         template <typename ValueType>
-        ValueType Subtract(ValueType a, ValueType b)
+        struct Subtract
         {
-            return a - b;
-        }
+            ValueType operator()(ValueType a, ValueType b) const { return a - b; }
+        };
 
         template <>
-        inline bool Subtract(bool a, bool b)
+        struct Subtract<bool>
         {
-            throw utilities::InputException(utilities::InputExceptionErrors::typeMismatch);
-        }
+            bool operator()(bool, bool) const { throw utilities::InputException(utilities::InputExceptionErrors::typeMismatch); }
+        };
 
         template <typename ValueType>
-        ValueType Multiply(ValueType a, ValueType b)
+        struct Multiply
         {
-            return a * b;
-        }
+            ValueType operator()(ValueType a, ValueType b) const { return a * b; }
+        };
 
         template <>
-        inline bool Multiply(bool a, bool b)
+        struct Multiply<bool>
         {
-            throw utilities::InputException(utilities::InputExceptionErrors::typeMismatch);
-        }
+            bool operator()(bool, bool) const { throw utilities::InputException(utilities::InputExceptionErrors::typeMismatch); }
+        };
 
         template <typename ValueType>
-        ValueType Divide(ValueType a, ValueType b)
+        struct Divide
         {
-            return a / b;
-        }
+            ValueType operator()(ValueType a, ValueType b) const { return a / b; }
+        };
 
         template <>
-        inline bool Divide(bool a, bool b)
+        struct Divide<bool>
         {
-            throw utilities::InputException(utilities::InputExceptionErrors::typeMismatch);
-        }
+            bool operator()(bool, bool) const { throw utilities::InputException(utilities::InputExceptionErrors::typeMismatch); }
+        };
 
         //
         // Logical operations
         //
         template <typename ValueType>
-        ValueType LogicalAnd(ValueType a, ValueType b)
+        struct LogicalAnd
         {
-            throw utilities::InputException(utilities::InputExceptionErrors::typeMismatch);
-        }
+            ValueType operator()(ValueType, ValueType) const { throw utilities::InputException(utilities::InputExceptionErrors::typeMismatch); }
+        };
 
         template <>
-        inline bool LogicalAnd(bool a, bool b)
+        struct LogicalAnd<bool>
         {
-            return a && b;
-        }
+            bool operator()(bool a, bool b) const { return a && b; }
+        };
 
         template <typename ValueType>
-        ValueType LogicalOr(ValueType a, ValueType b)
+        struct LogicalOr
         {
-            throw utilities::InputException(utilities::InputExceptionErrors::typeMismatch);
-        }
+            ValueType operator()(ValueType, ValueType) const { throw utilities::InputException(utilities::InputExceptionErrors::typeMismatch); }
+        };
 
         template <>
-        inline bool LogicalOr(bool a, bool b)
+        struct LogicalOr<bool>
         {
-            return a || b;
-        }
+            bool operator()(bool a, bool b) const { return a || b; }
+        };
 
         template <typename ValueType>
-        ValueType LogicalXor(ValueType a, ValueType b)
+        struct LogicalXor
         {
-            throw utilities::InputException(utilities::InputExceptionErrors::typeMismatch);
-        }
+            ValueType operator()(ValueType, ValueType) const { throw utilities::InputException(utilities::InputExceptionErrors::typeMismatch); }
+        };
 
         template <>
-        inline bool LogicalXor(bool a, bool b)
+        struct LogicalXor<bool>
         {
-            return (!a) != (!b);
-        }
+            bool operator()(bool a, bool b) const { return (!a) != (!b); }
+        };
     }
 
     template <typename ValueType>
@@ -157,49 +161,61 @@ namespace nodes
 
     template <typename ValueType>
     template <typename Operation>
-    std::vector<ValueType> BinaryOperationNode<ValueType>::ComputeOutput(Operation&& function) const
+    std::vector<ValueType> BinaryOperationNode<ValueType>::ComputeOutput(Operation&& function, const std::vector<ValueType>& input1Values, const std::vector<ValueType>& input2Values)
     {
-        auto output = std::vector<ValueType>(_input1.Size());
-        for (size_t index = 0; index < _input1.Size(); index++)
+        auto output = std::vector<ValueType>(input1Values.size());
+        for (size_t index = 0; index < input1Values.size(); index++)
         {
-            output[index] = function(_input1[index], _input2[index]);
+            output[index] = function(input1Values[index], input2Values[index]);
         }
         return output;
     }
 
     template <typename ValueType>
-    void BinaryOperationNode<ValueType>::Compute() const
+    std::vector<ValueType> BinaryOperationNode<ValueType>::ComputeOutput(const std::vector<ValueType>& input1Values, const std::vector<ValueType>& input2Values) const
     {
-        std::vector<ValueType> output;
         switch (_operation)
         {
             case emitters::BinaryOperationType::add:
-                output = ComputeOutput(BinaryOperations::Add<ValueType>);
-                break;
+                return ComputeOutput(BinaryOperations::Add<ValueType>(), input1Values, input2Values);
             case emitters::BinaryOperationType::subtract:
-                output = ComputeOutput(BinaryOperations::Subtract<ValueType>);
-                break;
+                return ComputeOutput(BinaryOperations::Subtract<ValueType>(), input1Values, input2Values);
             case emitters::BinaryOperationType::coordinatewiseMultiply:
-                output = ComputeOutput(BinaryOperations::Multiply<ValueType>);
-                break;
+                return ComputeOutput(BinaryOperations::Multiply<ValueType>(), input1Values, input2Values);
             case emitters::BinaryOperationType::coordinatewiseDivide:
-                output = ComputeOutput(BinaryOperations::Divide<ValueType>);
-                break;
+                return ComputeOutput(BinaryOperations::Divide<ValueType>(), input1Values, input2Values);
             case emitters::BinaryOperationType::logicalAnd:
-                output = ComputeOutput(BinaryOperations::LogicalAnd<ValueType>);
-                break;
+                return ComputeOutput(BinaryOperations::LogicalAnd<ValueType>(), input1Values, input2Values);
             case emitters::BinaryOperationType::logicalOr:
-                output = ComputeOutput(BinaryOperations::LogicalOr<ValueType>);
-                break;
+                return ComputeOutput(BinaryOperations::LogicalOr<ValueType>(), input1Values, input2Values);
             case emitters::BinaryOperationType::logicalXor:
-                output = ComputeOutput(BinaryOperations::LogicalXor<ValueType>);
-                break;
+                return ComputeOutput(BinaryOperations::LogicalXor<ValueType>(), input1Values, input2Values);
             default:
                 throw utilities::LogicException(utilities::LogicExceptionErrors::notImplemented, "Unknown operation type");
         }
-        _output.SetOutput(output);
+    }
+
+    template <typename ValueType>
+    void BinaryOperationNode<ValueType>::Compute() const
+    {
+        _output.SetOutput(ComputeOutput(_input1.GetValue(), _input2.GetValue()));
     };
 
+    template <typename ValueType>
+    bool BinaryOperationNode<ValueType>::Fold(model::ModelTransformer& transformer) const
+    {
+        std::vector<ValueType> input1Values;
+        std::vector<ValueType> input2Values;
+        if (!TryGetConstantValues(transformer, _input1.GetPortElements(), input1Values) || !TryGetConstantValues(transformer, _input2.GetPortElements(), input2Values))
+        {
+            return false;
+        }
+
+        auto newNode = transformer.AddNode<ConstantNode<ValueType>>(ComputeOutput(input1Values, input2Values));
+        transformer.MapNodeOutput(output, newNode->output);
+        return true;
+    }
+
     template <typename ValueType>
     void BinaryOperationNode<ValueType>::Copy(model::ModelTransformer& transformer) const
     {
@@ -212,7 +228,7 @@ namespace nodes
     template <typename ValueType>
     void BinaryOperationNode<ValueType>::Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function)
     {
-        if (IsPureVector(input1) && IsPureVector(input2) && !compiler.GetCompilerParameters().unrollLoops)
+        if (IsPureVector(input1) && IsPureVector(input2) && !compiler.ShouldUnrollLoop(input1.Size()))
         {
             CompileLoop(compiler, function);
         }
@@ -235,6 +251,27 @@ namespace nodes
         });
     }
 
+    template <typename ValueType>
+    bool BinaryOperationNode<ValueType>::IsElementwise() const
+    {
+        return IsPureVector(input1) && IsPureVector(input2);
+    }
+
+    template <typename ValueType>
+    llvm::Value* BinaryOperationNode<ValueType>::CompileElementwise(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function, llvm::Value* index, llvm::Value* chainValue)
+    {
+        // the chained value, if any, stands in for the first input; the second input is loaded here
+        llvm::Value* inputValue1 = chainValue;
+        if (inputValue1 == nullptr)
+        {
+            llvm::Value* pInput1 = compiler.EnsurePortEmitted(input1);
+            inputValue1 = function.ValueAt(pInput1, index);
+        }
+        llvm::Value* pInput2 = compiler.EnsurePortEmitted(input2);
+        llvm::Value* inputValue2 = function.ValueAt(pInput2, index);
+        return function.Operator(emitters::GetOperator<ValueType>(GetOperation()), inputValue1, inputValue2);
+    }
+
     template <typename ValueType>
     void BinaryOperationNode<ValueType>::CompileExpanded(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function)
     {
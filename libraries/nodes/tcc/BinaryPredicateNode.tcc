@@ -156,7 +156,7 @@ namespace nodes
     template <typename ValueType>
     void BinaryPredicateNode<ValueType>::Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function)
     {
-        if (IsPureVector(input1) && IsPureVector(input2) && !compiler.GetCompilerParameters().unrollLoops)
+        if (IsPureVector(input1) && IsPureVector(input2) && !compiler.ShouldUnrollLoop(input1.Size()))
         {
             CompileLoop(compiler, function);
         }
@@ -222,7 +222,70 @@ namespace nodes
         }
     }
 
-    // Note: secondaryValues is passed by non-const reference to avoid copies. It doesn't function as an output parameter.
+    template <typename ValueType, typename FunctionType>
+    void BroadcastFunctionNode<ValueType, FunctionType>::FuseTrailingDimensions(PortMemoryLayout& inputLayout, PortMemoryLayout& outputLayout) const
+    {
+        const auto numDimensions = inputLayout.size.size();
+        const auto broadcastDimension = GetBroadcastDimension();
+
+        // find the first dimension of the trailing run that can be fused: every dimension after it
+        // must be unit-stride with no padding or offset (in both layouts), match between input and
+        // output, and lie past the broadcast dimension (the secondary values vary along that one)
+        size_t firstFusedDimension = numDimensions;
+        while (firstFusedDimension > broadcastDimension + 1 && firstFusedDimension > 1)
+        {
+            auto d = firstFusedDimension - 1;
+            bool inputDense = inputLayout.offset[d] == 0 && inputLayout.size[d] == inputLayout.stride[d];
+            bool outputDense = outputLayout.offset[d] == 0 && outputLayout.size[d] == outputLayout.stride[d];
+            if (!inputDense || !outputDense || inputLayout.size[d] != outputLayout.size[d])
+            {
+                break;
+            }
+            --firstFusedDimension;
+        }
+        // the run's outermost dimension may itself be padded; the fused loop never crosses into its padding
+        if (firstFusedDimension > 0)
+        {
+            --firstFusedDimension;
+        }
+
+        if (firstFusedDimension >= numDimensions - 1)
+        {
+            return; // nothing to fuse
+        }
+
+        size_t fusedSize = 1;
+        size_t fusedInputStride = 1;
+        size_t fusedOutputStride = 1;
+        size_t innerExtent = 1; // product of the extents below the run's outermost dimension
+        for (size_t d = firstFusedDimension; d < numDimensions; ++d)
+        {
+            fusedSize *= inputLayout.size[d];
+            fusedInputStride *= inputLayout.stride[d];
+            fusedOutputStride *= outputLayout.stride[d];
+            if (d > firstFusedDimension)
+            {
+                innerExtent *= inputLayout.stride[d];
+            }
+        }
+
+        inputLayout.size.resize(firstFusedDimension + 1);
+        inputLayout.stride.resize(firstFusedDimension + 1);
+        inputLayout.offset.resize(firstFusedDimension + 1);
+        inputLayout.size[firstFusedDimension] = fusedSize;
+        inputLayout.stride[firstFusedDimension] = fusedInputStride;
+        inputLayout.offset[firstFusedDimension] *= innerExtent;
+
+        outputLayout.size.resize(firstFusedDimension + 1);
+        outputLayout.stride.resize(firstFusedDimension + 1);
+        outputLayout.offset.resize(firstFusedDimension + 1);
+        outputLayout.size[firstFusedDimension] = fusedSize;
+        outputLayout.stride[firstFusedDimension] = fusedOutputStride;
+        outputLayout.offset[firstFusedDimension] *= innerExtent;
+    }
+
+    // The public entry point: fuses trailing contiguous dimensions so the inner loop covers as many
+    // stride-1 elements as possible, then emits the nested loops over the fused layouts.
     template <typename ValueType, typename FunctionType>
     void BroadcastFunctionNode<ValueType, FunctionType>::EmitComputeDimensionLoop(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function,
                                                                                   size_t dimension,
@@ -231,50 +294,69 @@ namespace nodes
                                                                                   llvm::Value* prevInputDimensionOffset, llvm::Value* prevOutputDimensionOffset,
                                                                                   std::vector<llvm::Value*>& secondaryValues) const
     {
-        // Note: It should be easy to unroll the last K levels by putting a real loop here when dimension < k
-        //       Or, instead of unrolling, vectorizing --- if broadcastDimension = 1, let secondaryValue be a vector and load it one loop previous
+        PortMemoryLayout inputLayout = GetInputLayout();
+        PortMemoryLayout outputLayout = GetOutputLayout();
+        FuseTrailingDimensions(inputLayout, outputLayout);
+        EmitComputeDimensionLoop(compiler, function, dimension, inputLayout, outputLayout, primaryInput, secondaryInputs, output, prevInputDimensionOffset, prevOutputDimensionOffset, secondaryValues);
+    }
 
-        const auto numDimensions = NumPrimaryInputDimensions();
-        auto&& inputLayout = GetInputLayout();
+    // Note: secondaryValues is passed by non-const reference to avoid copies. It doesn't function as an output parameter.
+    template <typename ValueType, typename FunctionType>
+    void BroadcastFunctionNode<ValueType, FunctionType>::EmitComputeDimensionLoop(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function,
+                                                                                  size_t dimension,
+                                                                                  const PortMemoryLayout& inputLayout, const PortMemoryLayout& outputLayout,
+                                                                                  llvm::Value* primaryInput, const std::vector<llvm::Value*>& secondaryInputs,
+                                                                                  llvm::Value* output,
+                                                                                  llvm::Value* prevInputDimensionOffset, llvm::Value* prevOutputDimensionOffset,
+                                                                                  std::vector<llvm::Value*>& secondaryValues) const
+    {
+        const auto numDimensions = inputLayout.size.size();
         auto&& inputStride = inputLayout.stride;
         auto&& inputOffset = inputLayout.offset;
         auto&& inputSize = inputLayout.size;
-        auto&& outputLayout = GetOutputLayout();
         auto&& outputStride = outputLayout.stride;
         auto&& outputOffset = outputLayout.offset;
         const auto broadcastDimension = GetBroadcastDimension();
         const auto numSecondaryInputs = NumSecondaryInputs();
         const auto secondaryInputSize = GetSecondaryInputSize();
+        const bool isInnermostLoop = dimension == numDimensions - 1;
+
+        // Hoist the part of the offset computation that doesn't depend on the loop index:
+        //   * in the outermost loop, just the offset into this dimension
+        //   * otherwise, the offset into this dimension plus the previous offset scaled by the previous dimension's stride
+        llvm::Value* inputDimensionBase = nullptr;
+        llvm::Value* outputDimensionBase = nullptr;
+        if (dimension == 0)
+        {
+            assert(prevInputDimensionOffset == nullptr);
+            assert(prevOutputDimensionOffset == nullptr);
+            inputDimensionBase = function.Literal<int>(inputOffset[dimension]);
+            outputDimensionBase = function.Literal<int>(outputOffset[dimension]);
+        }
+        else
+        {
+            auto scaledInputDimensionOffset = function.Operator(emitters::GetMultiplyForValueType<int>(), prevInputDimensionOffset, function.Literal<int>(inputStride[dimension]));
+            inputDimensionBase = function.Operator(emitters::GetAddForValueType<int>(), scaledInputDimensionOffset, function.Literal<int>(inputOffset[dimension]));
+
+            auto scaledOutputDimensionOffset = function.Operator(emitters::GetMultiplyForValueType<int>(), prevOutputDimensionOffset, function.Literal<int>(outputStride[dimension]));
+            outputDimensionBase = function.Operator(emitters::GetAddForValueType<int>(), scaledOutputDimensionOffset, function.Literal<int>(outputOffset[dimension]));
+        }
 
         auto loop = function.ForLoop();
+        if (isInnermostLoop && dimension != broadcastDimension && GetFunction().CanUseVectorTypes())
+        {
+            // the innermost loop walks stride-1 addresses and all secondary values are
+            // loop-invariant, so ask the vectorizer for vector types at the device's preferred
+            // width (the vectorizer emits the scalar tail loop for the leftover elements)
+            loop.SetVectorizationHints(static_cast<int>(emitters::GetPreferredVectorWidth(compiler.GetCompilerParameters().targetDevice, sizeof(ValueType))));
+        }
         loop.Begin(inputSize[dimension]);
         {
             auto loopIndex = loop.LoadIterationVariable();
 
-            // Calculate the offset within this dimension = (loopIndex + offset[dimension])
-            llvm::Value* thisInputDimensionInternalOffset = function.Operator(emitters::GetAddForValueType<int>(), loopIndex, function.Literal<int>(inputOffset[dimension]));
-            llvm::Value* thisOutputDimensionInternalOffset = function.Operator(emitters::GetAddForValueType<int>(), loopIndex, function.Literal<int>(outputOffset[dimension]));
-
-            // Calculate the total offset from beginning of memory:
-            //   * if in the outermost loop, the offset into this dimension
-            //   * otherwise, the offset into this dimension plus the previous offset scaled by the previous dimension's stride
-            llvm::Value* thisInputDimensionOffset = nullptr;
-            llvm::Value* thisOutputDimensionOffset = nullptr;
-            if (dimension == 0)
-            {
-                assert(prevInputDimensionOffset == nullptr);
-                assert(prevOutputDimensionOffset == nullptr);
-                thisInputDimensionOffset = thisInputDimensionInternalOffset;
-                thisOutputDimensionOffset = thisOutputDimensionInternalOffset;
-            }
-            else
-            {
-                auto scaledInputDimensionOffset = function.Operator(emitters::GetMultiplyForValueType<int>(), prevInputDimensionOffset, function.Literal<int>(inputStride[dimension]));
-                thisInputDimensionOffset = function.Operator(emitters::GetAddForValueType<int>(), scaledInputDimensionOffset, thisInputDimensionInternalOffset);
-
-                auto scaledOutputDimensionOffset = function.Operator(emitters::GetMultiplyForValueType<int>(), prevOutputDimensionOffset, function.Literal<int>(outputStride[dimension]));
-                thisOutputDimensionOffset = function.Operator(emitters::GetAddForValueType<int>(), scaledOutputDimensionOffset, thisOutputDimensionInternalOffset);
-            }
+            // Calculate the total offset from beginning of memory = base + loopIndex
+            llvm::Value* thisInputDimensionOffset = function.Operator(emitters::GetAddForValueType<int>(), inputDimensionBase, loopIndex);
+            llvm::Value* thisOutputDimensionOffset = function.Operator(emitters::GetAddForValueType<int>(), outputDimensionBase, loopIndex);
 
             if (dimension == broadcastDimension)
             {
@@ -292,10 +374,10 @@ namespace nodes
                 }
             }
 
-            if (dimension < numDimensions - 1)
+            if (!isInnermostLoop)
             {
                 // Recursive call to emit nested loop
-                EmitComputeDimensionLoop(compiler, function, dimension + 1, primaryInput, secondaryInputs, output, thisInputDimensionOffset, thisOutputDimensionOffset, secondaryValues);
+                EmitComputeDimensionLoop(compiler, function, dimension + 1, inputLayout, outputLayout, primaryInput, secondaryInputs, output, thisInputDimensionOffset, thisOutputDimensionOffset, secondaryValues);
             }
             else
             {
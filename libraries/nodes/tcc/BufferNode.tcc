@@ -0,0 +1,87 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     BufferNode.tcc (nodes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ell
+{
+namespace nodes
+{
+    template <typename ValueType>
+    BufferNode<ValueType>::BufferNode(const model::PortElements<ValueType>& input, size_t windowSize)
+        : CompilableNode({ &_input }, { &_output }), _input(this, input, inputPortName), _output(this, outputPortName, input.Size() * windowSize), _windowSize(windowSize)
+    {
+        _buffer.resize(input.Size() * windowSize);
+    }
+
+    template <typename ValueType>
+    BufferNode<ValueType>::BufferNode()
+        : CompilableNode({ &_input }, { &_output }), _input(this, {}, inputPortName), _output(this, outputPortName, 0), _windowSize(0)
+    {
+    }
+
+    template <typename ValueType>
+    void BufferNode<ValueType>::Compute() const
+    {
+        auto sampleSize = _input.Size();
+        auto newSample = _input.GetValue();
+
+        // Shift the window left by one sample and append the new one at the end
+        std::copy(_buffer.begin() + sampleSize, _buffer.end(), _buffer.begin());
+        std::copy(newSample.begin(), newSample.end(), _buffer.end() - sampleSize);
+        _output.SetOutput(_buffer);
+    };
+
+    template <typename ValueType>
+    void BufferNode<ValueType>::Copy(model::ModelTransformer& transformer) const
+    {
+        auto newPortElements = transformer.TransformPortElements(_input.GetPortElements());
+        auto newNode = transformer.AddNode<BufferNode<ValueType>>(newPortElements, _windowSize);
+        transformer.MapNodeOutput(output, newNode->output);
+    }
+
+    template <typename ValueType>
+    void BufferNode<ValueType>::Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function)
+    {
+        llvm::Value* result = compiler.EnsurePortEmitted(output);
+
+        size_t sampleSize = input.Size();
+        size_t bufferSize = sampleSize * _windowSize;
+
+        //
+        // The window is long lived, so it's a global, like DelayNode's shift register. Unlike
+        // DelayNode, the output is the entire window, so after shifting in the new sample we
+        // copy the whole buffer to the output.
+        //
+        emitters::Variable* windowVar = function.GetModule().Variables().AddVariable<emitters::InitializedVectorVariable<ValueType>>(emitters::VariableScope::global, bufferSize);
+        llvm::Value* window = function.GetModule().EnsureEmitted(*windowVar);
+
+        llvm::Value* inputBuffer = compiler.EnsurePortEmitted(input);
+        function.ShiftAndUpdate<ValueType>(window, bufferSize, sampleSize, inputBuffer);
+        function.MemoryCopy<ValueType>(window, 0, result, 0, bufferSize);
+    }
+
+    template <typename ValueType>
+    void BufferNode<ValueType>::WriteToArchive(utilities::Archiver& archiver) const
+    {
+        Node::WriteToArchive(archiver);
+        archiver[inputPortName] << _input;
+        archiver["windowSize"] << _windowSize;
+    }
+
+    template <typename ValueType>
+    void BufferNode<ValueType>::ReadFromArchive(utilities::Unarchiver& archiver)
+    {
+        Node::ReadFromArchive(archiver);
+        archiver[inputPortName] >> _input;
+        archiver["windowSize"] >> _windowSize;
+
+        auto bufferSize = _input.Size() * _windowSize;
+        _buffer.assign(bufferSize, 0);
+        _output.SetSize(bufferSize);
+    }
+}
+}
@@ -0,0 +1,120 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ConfidenceGateNode.tcc (nodes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// utilities
+#include "Debug.h"
+#include "Exception.h"
+
+namespace ell
+{
+namespace nodes
+{
+    template <typename ValueType>
+    ConfidenceGateNode<ValueType>::ConfidenceGateNode()
+        : CompilableNode({ &_score, &_features, &_defaultInput }, { &_output }), _score(this, {}, scorePortName), _features(this, {}, featuresPortName), _defaultInput(this, {}, defaultInputPortName), _output(this, outputPortName, 0)
+    {
+    }
+
+    template <typename ValueType>
+    ConfidenceGateNode<ValueType>::ConfidenceGateNode(const model::PortElements<ValueType>& score, const model::PortElements<ValueType>& features, const model::PortElements<ValueType>& defaultInput, ValueType threshold, SecondStageFunction<ValueType> secondStage, const std::string& secondStageFunctionName)
+        : CompilableNode({ &_score, &_features, &_defaultInput }, { &_output }), _score(this, score, scorePortName), _features(this, features, featuresPortName), _defaultInput(this, defaultInput, defaultInputPortName), _output(this, outputPortName, _defaultInput.Size()), _threshold(threshold), _secondStageFunctionName(secondStageFunctionName), _secondStage(std::move(secondStage))
+    {
+    }
+
+    template <typename ValueType>
+    void ConfidenceGateNode<ValueType>::Compute() const
+    {
+        auto scoreValue = _score.GetValue()[0];
+        if (scoreValue >= _threshold || _secondStage == nullptr)
+        {
+            // confident (or no second stage registered): the first stage's answer stands
+            _output.SetOutput(_defaultInput.GetValue());
+        }
+        else
+        {
+            std::vector<ValueType> result(_defaultInput.Size());
+            _secondStage(_features.GetValue(), result);
+            _output.SetOutput(result);
+        }
+    }
+
+    template <typename ValueType>
+    void ConfidenceGateNode<ValueType>::Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function)
+    {
+        llvm::Value* pScore = compiler.EnsurePortEmitted(score);
+        llvm::Value* pFeatures = compiler.EnsurePortEmitted(features);
+        llvm::Value* pDefaultInput = compiler.EnsurePortEmitted(defaultInput);
+        llvm::Value* pOutput = compiler.EnsurePortEmitted(output);
+
+        // Callback signature: void SecondStageFunction(ValueType* features, ValueType* result)
+        const emitters::ValueTypeList parameters = { emitters::GetPointerType(emitters::GetVariableType<ValueType>()),
+                                                     emitters::GetPointerType(emitters::GetVariableType<ValueType>()) };
+        function.GetModule().DeclareFunction(_secondStageFunctionName, emitters::VariableType::Void, parameters);
+        llvm::Function* pSecondStageFunction = function.GetModule().GetFunction(_secondStageFunctionName);
+
+        auto scoreValue = function.ValueAt(pScore, function.Literal(0));
+        auto if1 = function.If(emitters::GetComparison<ValueType>(emitters::BinaryPredicateType::greaterOrEqual), scoreValue, function.Literal(_threshold));
+        {
+            // confident: pass the first stage's result through
+            auto copyLoop = function.ForLoop();
+            copyLoop.Begin(0, static_cast<int>(output.Size()), 1);
+            {
+                auto i = copyLoop.LoadIterationVariable();
+                function.SetValueAt(pOutput, i, function.ValueAt(pDefaultInput, i));
+            }
+            copyLoop.End();
+        }
+        if1.Else();
+        {
+            // not confident: the second stage runs, and only then -- confident samples never
+            // execute this side of the branch
+            DEBUG_EMIT_PRINTF(function, _secondStageFunctionName + "\n");
+            function.Call(pSecondStageFunction, { function.PointerOffset(pFeatures, 0), function.PointerOffset(pOutput, 0) });
+        }
+        if1.End();
+
+        // Tag the second-stage function as a callback that is emitted in headers
+        function.GetModule().InsertMetadata(_secondStageFunctionName, emitters::c_declareInHeaderTagName);
+        function.GetModule().InsertMetadata(_secondStageFunctionName, emitters::c_callbackFunctionTagName, "ConfidenceGateNode");
+    }
+
+    template <typename ValueType>
+    void ConfidenceGateNode<ValueType>::Copy(model::ModelTransformer& transformer) const
+    {
+        auto newScore = transformer.TransformPortElements(_score.GetPortElements());
+        auto newFeatures = transformer.TransformPortElements(_features.GetPortElements());
+        auto newDefaultInput = transformer.TransformPortElements(_defaultInput.GetPortElements());
+        auto newNode = transformer.AddNode<ConfidenceGateNode<ValueType>>(newScore, newFeatures, newDefaultInput, _threshold, _secondStage, _secondStageFunctionName);
+        transformer.MapNodeOutput(output, newNode->output);
+    }
+
+    template <typename ValueType>
+    void ConfidenceGateNode<ValueType>::WriteToArchive(utilities::Archiver& archiver) const
+    {
+        Node::WriteToArchive(archiver);
+        archiver[scorePortName] << _score;
+        archiver[featuresPortName] << _features;
+        archiver[defaultInputPortName] << _defaultInput;
+        archiver["threshold"] << _threshold;
+        archiver["secondStageFunctionName"] << _secondStageFunctionName;
+    }
+
+    template <typename ValueType>
+    void ConfidenceGateNode<ValueType>::ReadFromArchive(utilities::Unarchiver& archiver)
+    {
+        Node::ReadFromArchive(archiver);
+        archiver[scorePortName] >> _score;
+        archiver[featuresPortName] >> _features;
+        archiver[defaultInputPortName] >> _defaultInput;
+        archiver["threshold"] >> _threshold;
+        archiver["secondStageFunctionName"] >> _secondStageFunctionName;
+        _output.SetSize(_defaultInput.Size());
+        // _secondStage needs to be set separately
+    }
+}
+}
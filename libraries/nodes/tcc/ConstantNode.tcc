@@ -6,6 +6,8 @@
 //
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include "WeightClustering.h"
+
 namespace ell
 {
 namespace nodes
@@ -46,6 +48,17 @@ namespace nodes
         auto values = this->GetValues();
         emitters::Variable* pVar = nullptr;
 
+        auto parameters = compiler.GetMapCompilerParameters();
+        auto bitsPerIndex = parameters.weightClusterBits;
+        bool canCluster = std::is_floating_point<ValueType>::value &&
+                          (bitsPerIndex == 4 || bitsPerIndex == 6 || bitsPerIndex == 8) &&
+                          values.size() >= parameters.weightClusterThreshold;
+        if (canCluster)
+        {
+            CompileClusteredConstant(compiler, function, bitsPerIndex, std::is_floating_point<ValueType>{});
+            return;
+        }
+
         if (output.Size() == 1)
         {
             pVar = function.GetModule().Variables().AddVariable<emitters::LiteralVariable<ValueType>>(values[0]);
@@ -57,6 +70,52 @@ namespace nodes
         compiler.SetVariableForPort(output, pVar); // Just set the variable corresponding to the output port to be the global variable we created
     }
 
+    template <typename ValueType>
+    void ConstantNode<ValueType>::CompileClusteredConstant(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function, size_t bitsPerIndex, std::true_type)
+    {
+        auto values = this->GetValues();
+        auto clustering = ClusterWeights(values, static_cast<size_t>(1) << bitsPerIndex);
+        auto packedIndices = PackWeightIndices(clustering.indices, bitsPerIndex);
+        auto& module = function.GetModule();
+
+        // the flash-resident data: the codebook and the packed codebook indices
+        emitters::Variable* pCodebookVar = module.Variables().AddVariable<emitters::LiteralVectorVariable<ValueType>>(clustering.codebook);
+        emitters::Variable* pPackedVar = module.Variables().AddVariable<emitters::LiteralVectorVariable<int>>(packedIndices);
+
+        // the RAM arena the weights are decoded into, and a flag marking whether that's happened
+        emitters::Variable* pArenaVar = module.Variables().AddVariable<emitters::InitializedVectorVariable<ValueType>>(emitters::VariableScope::global, values.size());
+        emitters::Variable* pDecodedVar = module.Variables().AddVariable<emitters::InitializedScalarVariable<int>>(emitters::VariableScope::global, 0);
+
+        llvm::Value* pCodebook = module.EnsureEmitted(*pCodebookVar);
+        llvm::Value* pPacked = module.EnsureEmitted(*pPackedVar);
+        llvm::Value* pArena = module.EnsureEmitted(*pArenaVar);
+        llvm::Value* pDecoded = module.EnsureEmitted(*pDecodedVar);
+
+        int indicesPerWord = static_cast<int>(32 / bitsPerIndex); // indices never straddle a word boundary
+        int indexMask = (1 << bitsPerIndex) - 1;
+
+        // decode the weights into the arena the first time the function runs
+        emitters::IRIfEmitter ifNotDecoded = function.If(emitters::TypedComparison::equals, function.Load(pDecoded), function.Literal(0));
+        {
+            auto decodeLoop = function.ForLoop();
+            decodeLoop.Begin(values.size());
+            {
+                auto i = decodeLoop.LoadIterationVariable();
+                auto wordIndex = function.Operator(emitters::TypedOperator::divideSigned, i, function.Literal(indicesPerWord));
+                auto slot = function.Operator(emitters::TypedOperator::moduloSigned, i, function.Literal(indicesPerWord));
+                auto shift = function.Operator(emitters::TypedOperator::multiply, slot, function.Literal(static_cast<int>(bitsPerIndex)));
+                auto word = function.ValueAt(pPacked, wordIndex);
+                auto index = function.Operator(emitters::TypedOperator::logicalAnd, function.Operator(emitters::TypedOperator::logicalShiftRight, word, shift), function.Literal(indexMask));
+                function.SetValueAt(pArena, i, function.ValueAt(pCodebook, index));
+            }
+            decodeLoop.End();
+            function.Store(pDecoded, function.Literal(1));
+        }
+        ifNotDecoded.End();
+
+        compiler.SetVariableForPort(output, pArenaVar);
+    }
+
     template <typename ValueType>
     void ConstantNode<ValueType>::WriteToArchive(utilities::Archiver& archiver) const
     {
@@ -71,5 +130,29 @@ namespace nodes
         archiver["values"] >> _values;
         _output.SetSize(_values.size());
     }
+
+    template <typename ValueType>
+    bool TryGetConstantValues(model::ModelTransformer& transformer, const model::PortElements<ValueType>& elements, std::vector<ValueType>& values)
+    {
+        auto transformedElements = transformer.TransformPortElements(elements);
+        values.clear();
+        values.reserve(transformedElements.Size());
+        for (const auto& range : transformedElements.GetRanges())
+        {
+            auto constantNode = dynamic_cast<const ConstantNode<ValueType>*>(range.ReferencedPort()->GetNode());
+            if (constantNode == nullptr)
+            {
+                return false;
+            }
+
+            const auto& nodeValues = constantNode->GetValues();
+            auto startIndex = range.GetStartIndex();
+            for (size_t index = 0; index < range.Size(); ++index)
+            {
+                values.push_back(nodeValues[startIndex + index]);
+            }
+        }
+        return true;
+    }
 }
 }
@@ -35,30 +35,47 @@ namespace nodes
 
     template <typename ValueType>
     DTWDistanceNode<ValueType>::DTWDistanceNode()
-        : CompilableNode({ &_input }, { &_output }), _input(this, {}, inputPortName), _output(this, outputPortName, 1), _sampleDimension(0), _prototypeLength(0), _prototypeVariance(0)
+        : CompilableNode({ &_input }, { &_output }), _input(this, {}, inputPortName), _output(this, outputPortName, 1), _sampleDimension(0), _bandWidth(0), _earlyAbandonThreshold(std::numeric_limits<double>::infinity())
     {
     }
 
     template <typename ValueType>
     DTWDistanceNode<ValueType>::DTWDistanceNode(const model::PortElements<ValueType>& input, const std::vector<std::vector<ValueType>>& prototype)
-        : CompilableNode({ &_input }, { &_output }), _input(this, input, inputPortName), _output(this, outputPortName, 1), _prototype(prototype)
+        : DTWDistanceNode(input, std::vector<std::vector<std::vector<ValueType>>>{ prototype })
     {
-        _sampleDimension = input.Size();
-        _prototypeLength = prototype.size();
-        _d.resize(_prototypeLength + 1);
-        _s.resize(_prototypeLength + 1);
+    }
+
+    template <typename ValueType>
+    DTWDistanceNode<ValueType>::DTWDistanceNode(const model::PortElements<ValueType>& input, const std::vector<std::vector<ValueType>>& prototype, size_t sakoeChibaBandWidth, double earlyAbandonThreshold)
+        : DTWDistanceNode(input, std::vector<std::vector<std::vector<ValueType>>>{ prototype }, sakoeChibaBandWidth, earlyAbandonThreshold)
+    {
+    }
 
-        _prototypeVariance = DTWDistanceNodeImpl::Variance(_prototype);
-        // _threshold = std::sqrt(-2 * std::log(confidenceThreshold)) * _prototypeVariance;
+    template <typename ValueType>
+    DTWDistanceNode<ValueType>::DTWDistanceNode(const model::PortElements<ValueType>& input, const std::vector<std::vector<std::vector<ValueType>>>& prototypes, size_t sakoeChibaBandWidth, double earlyAbandonThreshold)
+        : CompilableNode({ &_input }, { &_output }), _input(this, input, inputPortName), _output(this, outputPortName, prototypes.size()), _prototypes(prototypes), _bandWidth(sakoeChibaBandWidth), _earlyAbandonThreshold(earlyAbandonThreshold)
+    {
+        _sampleDimension = input.Size();
+        _d.resize(_prototypes.size());
+        _s.resize(_prototypes.size());
+        for (size_t p = 0; p < _prototypes.size(); ++p)
+        {
+            _d[p].resize(_prototypes[p].size() + 1);
+            _s[p].resize(_prototypes[p].size() + 1);
+            _prototypeVariances.push_back(DTWDistanceNodeImpl::Variance(_prototypes[p]));
+        }
         Reset();
     }
 
     template <typename ValueType>
     void DTWDistanceNode<ValueType>::Reset() const
     {
-        std::fill(_d.begin() + 1, _d.end(), std::numeric_limits<ValueType>::max());
-        _d[0] = 0.0;
-        std::fill(_s.begin(), _s.end(), 0);
+        for (size_t p = 0; p < _prototypes.size(); ++p)
+        {
+            std::fill(_d[p].begin() + 1, _d[p].end(), std::numeric_limits<ValueType>::max());
+            _d[p][0] = 0.0;
+            std::fill(_s[p].begin(), _s[p].end(), 0);
+        }
         _currentTime = 0;
     }
 
@@ -74,26 +91,30 @@ namespace nodes
     }
 
     template <typename ValueType>
-    void DTWDistanceNode<ValueType>::Compute() const
+    ValueType DTWDistanceNode<ValueType>::UpdatePrototypeColumn(size_t prototypeIndex, const std::vector<ValueType>& input, int t) const
     {
-        std::vector<ValueType> input = _input.GetValue();
-        auto t = ++_currentTime;
-        auto dLast = _d[0] = 0;
-        auto sLast = _s[0] = t;
-
-        ValueType bestDist = 0;
-        int bestStart = 0;
-        for (size_t index = 1; index < _prototypeLength + 1; ++index)
+        const auto sentinel = std::numeric_limits<ValueType>::max();
+        const auto& prototype = _prototypes[prototypeIndex];
+        auto prototypeLength = prototype.size();
+        auto& d = _d[prototypeIndex];
+        auto& s = _s[prototypeIndex];
+
+        // the rolling buffer: d holds the current column in place, and dLast/sLast carry the
+        // previous column's value for the cell about to be overwritten (the diagonal predecessor)
+        auto dLast = d[0] = 0;
+        auto sLast = s[0] = t;
+
+        for (size_t index = 1; index < prototypeLength + 1; ++index)
         {
-            auto d_iMinus1 = _d[index - 1];
+            auto d_iMinus1 = d[index - 1];
             auto dPrev_iMinus1 = dLast;
-            auto dPrev_i = _d[index];
-            auto s_iMinus1 = _s[index - 1];
+            auto dPrev_i = d[index];
+            auto s_iMinus1 = s[index - 1];
             auto sPrev_iMinus1 = sLast;
-            auto sPrev_i = _s[index];
+            auto sPrev_i = s[index];
 
-            bestDist = d_iMinus1;
-            bestStart = s_iMinus1;
+            auto bestDist = d_iMinus1;
+            auto bestStart = s_iMinus1;
             if (dPrev_i < bestDist)
             {
                 bestDist = dPrev_i;
@@ -104,40 +125,58 @@ namespace nodes
                 bestDist = dPrev_iMinus1;
                 bestStart = sPrev_iMinus1;
             }
-            bestDist += distance(_prototype[index - 1], input);
 
-            _d[index] = bestDist;
-            _s[index] = bestStart;
+            // rotate the buffer before overwriting this cell
+            dLast = dPrev_i;
+            sLast = sPrev_i;
+
+            // prune the cell when all its predecessors are pruned or abandoned, or when its path
+            // has drifted outside the Sakoe-Chiba band; pruned cells skip the O(d) sample distance
+            bool prune = bestDist == sentinel || bestDist > _earlyAbandonThreshold;
+            if (!prune && _bandWidth > 0)
+            {
+                auto pathDuration = t - bestStart;
+                auto offset = pathDuration - static_cast<int>(index);
+                prune = offset > static_cast<int>(_bandWidth) || -offset > static_cast<int>(_bandWidth);
+            }
+
+            d[index] = prune ? sentinel : bestDist + static_cast<ValueType>(distance(prototype[index - 1], input));
+            s[index] = bestStart;
         }
-        assert(bestDist == _d[_prototypeLength]);
-        assert(bestStart == _s[_prototypeLength]);
-        auto result = bestDist / _prototypeVariance;
 
-        // Ensure best match is between 80% and 120% of prototype length
-        auto timeDiff = _currentTime - bestStart;
-        if (timeDiff < _prototypeLength * 0.8 || timeDiff > _prototypeLength * 1.2)
+        return static_cast<ValueType>(d[prototypeLength] / _prototypeVariances[prototypeIndex]);
+    }
+
+    template <typename ValueType>
+    void DTWDistanceNode<ValueType>::Compute() const
+    {
+        std::vector<ValueType> input = _input.GetValue();
+        auto t = ++_currentTime;
+
+        // the input sample is read once and shared across all prototype columns
+        std::vector<ValueType> result(_prototypes.size());
+        for (size_t p = 0; p < _prototypes.size(); ++p)
         {
-            bestDist = std::numeric_limits<ValueType>::max();
+            result[p] = UpdatePrototypeColumn(p, input, t);
         }
-
-        _output.SetOutput({ static_cast<ValueType>(result) });
+        _output.SetOutput(result);
     };
 
     template <typename ValueType>
     void DTWDistanceNode<ValueType>::Copy(model::ModelTransformer& transformer) const
     {
         auto newinput = transformer.TransformPortElements(_input.GetPortElements());
-        auto newNode = transformer.AddNode<DTWDistanceNode<ValueType>>(newinput, _prototype);
+        auto newNode = transformer.AddNode<DTWDistanceNode<ValueType>>(newinput, _prototypes, _bandWidth, _earlyAbandonThreshold);
         transformer.MapNodeOutput(output, newNode->output);
     }
 
     template <typename ValueType>
-    std::vector<ValueType> DTWDistanceNode<ValueType>::GetPrototypeData() const
+    std::vector<ValueType> DTWDistanceNode<ValueType>::GetPrototypeData(size_t prototypeIndex) const
     {
         std::vector<ValueType> result;
-        result.reserve(_prototypeLength * _sampleDimension);
+        result.reserve(_prototypes[prototypeIndex].size() * _sampleDimension);
 
-        for (const auto& vec : _prototype)
+        for (const auto& vec : _prototypes[prototypeIndex])
         {
             result.insert(result.end(), vec.begin(), vec.end());
         }
@@ -151,75 +190,149 @@ namespace nodes
 
         auto inputType = GetPortVariableType(input);
         assert(inputType == GetPortVariableType(output));
-        VerifyIsScalar(output);
 
         llvm::Value* pInput = compiler.EnsurePortEmitted(input);
         llvm::Value* pResult = compiler.EnsurePortEmitted(output);
 
-        // The prototype (constant)
-        emitters::Variable* pVarPrototype = function.GetModule().Variables().AddVariable<emitters::LiteralVectorVariable<ValueType>>(GetPrototypeData());
-
-        // Global variables for the dynamic programming memory
-        emitters::Variable* pVarD = function.GetModule().Variables().AddVariable<emitters::InitializedVectorVariable<ValueType>>(emitters::VariableScope::global, _prototypeLength + 1);
+        const auto sentinel = std::numeric_limits<ValueType>::max();
+        auto thresholdValue = sentinel;
+        if (_earlyAbandonThreshold < static_cast<double>(sentinel))
+        {
+            thresholdValue = static_cast<ValueType>(_earlyAbandonThreshold);
+        }
 
-        // get global state vars
-        llvm::Value* pPrototypeVector = function.GetModule().EnsureEmitted(*pVarPrototype);
-        llvm::Value* pD = function.GetModule().EnsureEmitted(*pVarD);
+        // The time counter (global, shared by all prototypes)
+        emitters::Variable* pVarT = function.GetModule().Variables().AddVariable<emitters::InitializedScalarVariable<int>>(emitters::VariableScope::global, 0);
+        llvm::Value* pT = function.GetModule().EnsureEmitted(*pVarT);
+        llvm::Value* t = function.Operator(emitters::TypedOperator::add, function.Load(pT), function.Literal(1));
+        function.Store(pT, t);
 
         // incorrect usage of function.Variable --- should use IRModuleEmitter::EmitX(variable)
         llvm::Value* dist = function.Variable(inputType, "dist");
         llvm::Value* protoIndex = function.Variable(ell::emitters::VariableType::Int32, "i");
         llvm::Value* dLast = function.Variable(inputType, "dLast");
+        llvm::Value* sLast = function.Variable(ell::emitters::VariableType::Int32, "sLast");
         llvm::Value* bestDist = function.Variable(inputType, "bestDist");
+        llvm::Value* bestStart = function.Variable(ell::emitters::VariableType::Int32, "bestStart");
+        llvm::Value* pruned = function.Variable(ell::emitters::VariableType::Int32, "pruned");
 
-        // initialize variables
-        function.Store(protoIndex, function.Literal(0));
-        function.Store(dLast, function.Literal(0.0));
-
-        auto forLoop = function.ForLoop();
-        forLoop.Begin(_prototypeLength);
+        for (size_t p = 0; p < _prototypes.size(); ++p)
         {
-            auto iMinusOne = forLoop.LoadIterationVariable();
-            auto i = function.Operator(emitters::TypedOperator::add, iMinusOne, function.Literal(1));
+            auto prototypeLength = _prototypes[p].size();
 
-            auto d_iMinus1 = function.ValueAt(pD, iMinusOne);
-            auto dPrev_iMinus1 = function.Load(dLast);
-            auto dPrev_i = function.ValueAt(pD, i);
+            // The prototype (constant)
+            emitters::Variable* pVarPrototype = function.GetModule().Variables().AddVariable<emitters::LiteralVectorVariable<ValueType>>(GetPrototypeData(p));
 
-            function.Store(bestDist, d_iMinus1);
-            emitters::IRIfEmitter if1 = function.If(emitters::TypedComparison::lessThanFloat, dPrev_i, d_iMinus1);
-            {
-                function.Store(bestDist, dPrev_i);
-            }
-            if1.End();
+            // Global variables for the dynamic programming memory: the distance column and the
+            // path start times
+            emitters::Variable* pVarD = function.GetModule().Variables().AddVariable<emitters::InitializedVectorVariable<ValueType>>(emitters::VariableScope::global, prototypeLength + 1);
+            emitters::Variable* pVarS = function.GetModule().Variables().AddVariable<emitters::InitializedVectorVariable<int>>(emitters::VariableScope::global, prototypeLength + 1);
 
-            emitters::IRIfEmitter if2 = function.If(emitters::TypedComparison::lessThanFloat, dPrev_iMinus1, function.Load(bestDist));
-            {
-                function.Store(bestDist, dPrev_iMinus1);
-            }
-            if2.End();
+            llvm::Value* pPrototypeVector = function.GetModule().EnsureEmitted(*pVarPrototype);
+            llvm::Value* pD = function.GetModule().EnsureEmitted(*pVarD);
+            llvm::Value* pS = function.GetModule().EnsureEmitted(*pVarS);
+
+            // initialize variables
+            function.Store(protoIndex, function.Literal(0));
+            function.Store(dLast, function.Literal(static_cast<ValueType>(0)));
+            function.Store(sLast, t);
+            function.SetValueAt(pD, function.Literal(0), function.Literal(static_cast<ValueType>(0)));
+            function.SetValueAt(pS, function.Literal(0), t);
 
-            // Get dist
-            function.Store(dist, function.Literal(0.0));
-            auto diffLoop = function.ForLoop();
-            diffLoop.Begin(_sampleDimension);
+            auto forLoop = function.ForLoop();
+            forLoop.Begin(prototypeLength);
             {
-                auto j = diffLoop.LoadIterationVariable();
-                llvm::Value* inputValue = function.ValueAt(pInput, j);
-                llvm::Value* protoValue = function.ValueAt(pPrototypeVector, function.Load(protoIndex));
-                llvm::Value* diff = function.Operator(emitters::GetSubtractForValueType<ValueType>(), inputValue, protoValue);
-                llvm::Value* absDiff = function.Call(function.GetModule().GetRuntime().GetAbsFunction<ValueType>(), { diff });
-                function.OperationAndUpdate(dist, emitters::GetAddForValueType<ValueType>(), absDiff);
-                function.OperationAndUpdate(protoIndex, emitters::TypedOperator::add, function.Literal(1));
+                auto iMinusOne = forLoop.LoadIterationVariable();
+                auto i = function.Operator(emitters::TypedOperator::add, iMinusOne, function.Literal(1));
+
+                auto d_iMinus1 = function.ValueAt(pD, iMinusOne);
+                auto dPrev_iMinus1 = function.Load(dLast);
+                auto dPrev_i = function.ValueAt(pD, i);
+                auto s_iMinus1 = function.ValueAt(pS, iMinusOne);
+                auto sPrev_iMinus1 = function.Load(sLast);
+                auto sPrev_i = function.ValueAt(pS, i);
+
+                function.Store(bestDist, d_iMinus1);
+                function.Store(bestStart, s_iMinus1);
+                emitters::IRIfEmitter if1 = function.If(emitters::TypedComparison::lessThanFloat, dPrev_i, d_iMinus1);
+                {
+                    function.Store(bestDist, dPrev_i);
+                    function.Store(bestStart, sPrev_i);
+                }
+                if1.End();
+
+                emitters::IRIfEmitter if2 = function.If(emitters::TypedComparison::lessThanFloat, dPrev_iMinus1, function.Load(bestDist));
+                {
+                    function.Store(bestDist, dPrev_iMinus1);
+                    function.Store(bestStart, sPrev_iMinus1);
+                }
+                if2.End();
+
+                // rotate the rolling buffer before overwriting this cell
+                function.Store(dLast, dPrev_i);
+                function.Store(sLast, sPrev_i);
+
+                // prune the cell when its best predecessor is already abandoned or when its path
+                // has drifted outside the Sakoe-Chiba band
+                function.Store(pruned, function.Literal(0));
+                emitters::IRIfEmitter ifAbandon = function.If(emitters::TypedComparison::greaterThanOrEqualsFloat, function.Load(bestDist), function.Literal(thresholdValue));
+                {
+                    function.Store(pruned, function.Literal(1));
+                }
+                ifAbandon.End();
+
+                if (_bandWidth > 0)
+                {
+                    auto pathDuration = function.Operator(emitters::TypedOperator::subtract, t, function.Load(bestStart));
+                    auto offset = function.Operator(emitters::TypedOperator::subtract, pathDuration, i);
+                    emitters::IRIfEmitter ifAbove = function.If(emitters::TypedComparison::greaterThan, offset, function.Literal(static_cast<int>(_bandWidth)));
+                    {
+                        function.Store(pruned, function.Literal(1));
+                    }
+                    ifAbove.End();
+                    auto negativeOffset = function.Operator(emitters::TypedOperator::subtract, i, pathDuration);
+                    emitters::IRIfEmitter ifBelow = function.If(emitters::TypedComparison::greaterThan, negativeOffset, function.Literal(static_cast<int>(_bandWidth)));
+                    {
+                        function.Store(pruned, function.Literal(1));
+                    }
+                    ifBelow.End();
+                }
+
+                emitters::IRIfEmitter ifPruned = function.If(emitters::TypedComparison::equals, function.Load(pruned), function.Literal(1));
+                {
+                    // skip the per-sample distance; the prototype index still advances
+                    function.SetValueAt(pD, i, function.Literal(sentinel));
+                    function.OperationAndUpdate(protoIndex, emitters::TypedOperator::add, function.Literal(static_cast<int>(_sampleDimension)));
+                }
+                ifPruned.Else();
+                {
+                    // Get dist
+                    function.Store(dist, function.Literal(static_cast<ValueType>(0)));
+                    auto diffLoop = function.ForLoop();
+                    diffLoop.Begin(_sampleDimension);
+                    {
+                        auto j = diffLoop.LoadIterationVariable();
+                        llvm::Value* inputValue = function.ValueAt(pInput, j);
+                        llvm::Value* protoValue = function.ValueAt(pPrototypeVector, function.Load(protoIndex));
+                        llvm::Value* diff = function.Operator(emitters::GetSubtractForValueType<ValueType>(), inputValue, protoValue);
+                        llvm::Value* absDiff = function.Call(function.GetModule().GetRuntime().GetAbsFunction<ValueType>(), { diff });
+                        function.OperationAndUpdate(dist, emitters::GetAddForValueType<ValueType>(), absDiff);
+                        function.OperationAndUpdate(protoIndex, emitters::TypedOperator::add, function.Literal(1));
+                    }
+                    diffLoop.End();
+
+                    function.OperationAndUpdate(bestDist, emitters::GetAddForValueType<ValueType>(), function.Load(dist)); // x += dist;
+                    function.SetValueAt(pD, i, function.Load(bestDist)); // d[i] = x;
+                }
+                ifPruned.End();
+
+                function.SetValueAt(pS, i, function.Load(bestStart));
             }
-            diffLoop.End();
+            forLoop.End();
 
-            function.OperationAndUpdate(bestDist, emitters::GetAddForValueType<ValueType>(), function.Load(dist)); // x += dist;
-            function.SetValueAt(pD, i, function.Load(bestDist)); // d[i] = x;
+            auto finalDist = function.ValueAt(pD, function.Literal(static_cast<int>(prototypeLength)));
+            function.SetValueAt(pResult, function.Literal(static_cast<int>(p)), function.Operator(emitters::GetDivideForValueType<ValueType>(), finalDist, function.Literal(static_cast<ValueType>(_prototypeVariances[p]))));
         }
-        forLoop.End();
-
-        function.Store(pResult, function.Operator(emitters::GetDivideForValueType<ValueType>(), function.Load(bestDist), function.Literal(static_cast<ValueType>(_prototypeVariance))));
     }
 
     template <typename ValueType>
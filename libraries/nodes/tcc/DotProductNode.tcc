@@ -25,6 +25,15 @@ namespace nodes
     template <typename ValueType>
     void DotProductNode<ValueType>::Compute() const
     {
+        if (_input1.IsContiguous() && _input2.IsContiguous())
+        {
+            // fast path: both inputs alias contiguous port storage, so call the math kernel on it
+            // directly instead of resolving each element through the range lists
+            auto result = math::Operations::Dot(MakePortVectorReference(_input1), MakePortVectorReference(_input2));
+            _output.SetOutput({ result });
+            return;
+        }
+
         ValueType result = 0;
         for (size_t index = 0; index < _input1.Size(); ++index)
         {
@@ -59,7 +68,11 @@ namespace nodes
     void DotProductNode<ValueType>::Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function)
     {
         static_assert(!std::is_same<ValueType, bool>(), "Cannot instantiate boolean dot product nodes");
-        if ((IsPureVector(input1) && IsPureVector(input2)) && !compiler.GetCompilerParameters().unrollLoops)
+        if (compiler.GetCompilerParameters().useFixedPoint)
+        {
+            CompileDotProductFixedPoint(compiler, function);
+        }
+        else if ((IsPureVector(input1) && IsPureVector(input2)) && !compiler.ShouldUnrollLoop(input1.Size()))
         {
             CompileDotProductLoop(compiler, function);
         }
@@ -101,6 +114,41 @@ namespace nodes
         }
     }
 
+    template <typename ValueType>
+    void DotProductNode<ValueType>::CompileDotProductFixedPoint(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function)
+    {
+        // integer dot product for FPU-less targets: each element is quantized to its producer
+        // port's calibrated Q format, the products are accumulated with the saturating
+        // fixed-point primitives, and the sum is dequantized into the output port's storage.
+        // The quantize/dequantize multiplies at the boundaries disappear as the neighboring
+        // nodes get their own fixed-point lowerings.
+        auto wordBits = compiler.GetCompilerParameters().fixedPointWordBits;
+        auto format1 = compiler.GetPortQFormat(*input1.GetInputElement(0).ReferencedPort());
+        auto format2 = compiler.GetPortQFormat(*input2.GetInputElement(0).ReferencedPort());
+        auto outputFormat = compiler.GetPortQFormat(output);
+
+        // a product carries the fractional bits of both factors; shifting by the ones the output
+        // format doesn't keep leaves each term (and so the accumulator) in the output format
+        int productShift = format1.fractionalBits + format2.fractionalBits - outputFormat.fractionalBits;
+        productShift = productShift > 0 ? productShift : 0;
+
+        llvm::Value* pResult = compiler.EnsurePortEmitted(output);
+
+        llvm::Value* accumulator = function.Literal(0);
+        for (size_t i = 0; i < input1.Size(); ++i)
+        {
+            llvm::Value* pLeftValue = compiler.LoadPortElementVariable(input1.GetInputElement(i));
+            llvm::Value* pRightValue = compiler.LoadPortElementVariable(input2.GetInputElement(i));
+            auto leftQuantized = function.CastFloatToInt(function.Operator(emitters::GetMultiplyForValueType<ValueType>(), pLeftValue, function.Literal(static_cast<ValueType>(format1.Scale()))));
+            auto rightQuantized = function.CastFloatToInt(function.Operator(emitters::GetMultiplyForValueType<ValueType>(), pRightValue, function.Literal(static_cast<ValueType>(format2.Scale()))));
+            auto product = function.FixedPointMultiply(leftQuantized, rightQuantized, productShift, wordBits);
+            accumulator = function.FixedPointAdd(accumulator, product, wordBits);
+        }
+
+        auto realResult = function.CastIntToFloat(accumulator, emitters::GetVariableType<ValueType>(), true);
+        function.Store(pResult, function.Operator(emitters::GetMultiplyForValueType<ValueType>(), realResult, function.Literal(static_cast<ValueType>(1.0 / outputFormat.Scale()))));
+    }
+
     template <typename ValueType>
     void DotProductNode<ValueType>::WriteToArchive(utilities::Archiver& archiver) const
     {
@@ -0,0 +1,91 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ExponentialMovingAverageNode.tcc (nodes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ell
+{
+namespace nodes
+{
+    template <typename ValueType>
+    ExponentialMovingAverageNode<ValueType>::ExponentialMovingAverageNode()
+        : CompilableNode({ &_input }, { &_output }), _input(this, {}, inputPortName), _output(this, outputPortName, 0), _smoothing(0)
+    {
+    }
+
+    template <typename ValueType>
+    ExponentialMovingAverageNode<ValueType>::ExponentialMovingAverageNode(const model::PortElements<ValueType>& input, ValueType smoothing)
+        : CompilableNode({ &_input }, { &_output }), _input(this, input, inputPortName), _output(this, outputPortName, _input.Size()), _smoothing(smoothing)
+    {
+        _ewma = std::vector<ValueType>(_input.Size());
+    }
+
+    template <typename ValueType>
+    void ExponentialMovingAverageNode<ValueType>::Compute() const
+    {
+        for (size_t index = 0; index < _input.Size(); ++index)
+        {
+            _ewma[index] += _smoothing * (_input[index] - _ewma[index]);
+        }
+        _output.SetOutput(_ewma);
+    };
+
+    template <typename ValueType>
+    void ExponentialMovingAverageNode<ValueType>::Copy(model::ModelTransformer& transformer) const
+    {
+        auto newPortElements = transformer.TransformPortElements(_input.GetPortElements());
+        auto newNode = transformer.AddNode<ExponentialMovingAverageNode<ValueType>>(newPortElements, _smoothing);
+        transformer.MapNodeOutput(output, newNode->output);
+    }
+
+    template <typename ValueType>
+    void ExponentialMovingAverageNode<ValueType>::Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function)
+    {
+        static_assert(std::is_floating_point<ValueType>(), "ExponentialMovingAverageNode requires a floating-point value type");
+
+        llvm::Value* inputVector = compiler.EnsurePortEmitted(input);
+        llvm::Value* result = compiler.EnsurePortEmitted(output);
+
+        // The average lives in a global, like the accumulator of AccumulatorNode
+        emitters::Variable* pEwmaVar = function.GetModule().Variables().AddVariable<emitters::InitializedVectorVariable<ValueType>>(emitters::VariableScope::global, output.Size());
+        llvm::Value* ewma = function.GetModule().EnsureEmitted(*pEwmaVar);
+
+        auto forLoop = function.ForLoop();
+        forLoop.Begin(output.Size());
+        {
+            auto i = forLoop.LoadIterationVariable();
+            llvm::Value* inputValue = function.ValueAt(inputVector, i);
+            llvm::Value* ewmaValue = function.ValueAt(ewma, i);
+            llvm::Value* difference = function.Operator(emitters::GetSubtractForValueType<ValueType>(), inputValue, ewmaValue);
+            llvm::Value* step = function.Operator(emitters::GetMultiplyForValueType<ValueType>(), function.Literal(_smoothing), difference);
+            llvm::Value* newValue = function.Operator(emitters::GetAddForValueType<ValueType>(), ewmaValue, step);
+            function.SetValueAt(ewma, i, newValue);
+            function.SetValueAt(result, i, newValue);
+        }
+        forLoop.End();
+    }
+
+    template <typename ValueType>
+    void ExponentialMovingAverageNode<ValueType>::WriteToArchive(utilities::Archiver& archiver) const
+    {
+        Node::WriteToArchive(archiver);
+        archiver[inputPortName] << _input;
+        archiver["smoothing"] << _smoothing;
+    }
+
+    template <typename ValueType>
+    void ExponentialMovingAverageNode<ValueType>::ReadFromArchive(utilities::Unarchiver& archiver)
+    {
+        Node::ReadFromArchive(archiver);
+        archiver[inputPortName] >> _input;
+        archiver["smoothing"] >> _smoothing;
+
+        auto dimension = _input.Size();
+        _ewma = std::vector<ValueType>(dimension);
+        _output.SetSize(dimension);
+    }
+}
+}
@@ -72,7 +72,7 @@ namespace nodes
     {
         VerifyIsScalar(val);
         VerifyIsScalar(argVal);
-        if (IsPureVector(input) && !compiler.GetCompilerParameters().unrollLoops)
+        if (IsPureVector(input) && !compiler.ShouldUnrollLoop(input.Size()))
         {
             CompileLoop(compiler, function);
         }
@@ -103,12 +103,12 @@ namespace nodes
         {
             auto i = forLoop.LoadIterationVariable();
             auto val = function.ValueAt(inputVal, i);
-            emitters::IRIfEmitter if1 = function.If(GetComparison(), val, function.Load(bestVal));
-            {
-                function.Store(bestVal, val);
-                function.Store(bestIndex, i);
-            }
-            if1.End();
+            // branchless compare-and-select keeps the loop body a single straight-line block, so
+            // llvm's loop vectorizer can lower it to a vector compare that blends the value and
+            // index lanes, with a horizontal reduce after the loop
+            auto isBetter = function.Comparison(GetComparison(), val, function.Load(bestVal));
+            function.Store(bestVal, function.Select(isBetter, val, function.Load(bestVal)));
+            function.Store(bestIndex, function.Select(isBetter, i, function.Load(bestIndex)));
         }
         forLoop.End();
 
@@ -24,13 +24,13 @@ namespace nodes
 {
     template <typename SplitRuleType, typename EdgePredictorType>
     ForestPredictorNode<SplitRuleType, EdgePredictorType>::ForestPredictorNode(const model::PortElements<double>& input, const predictors::ForestPredictor<SplitRuleType, EdgePredictorType>& forest)
-        : Node({ &_input }, { &_output, &_treeOutputs, &_edgeIndicatorVector }), _input(this, input, inputPortName), _output(this, outputPortName, 1), _treeOutputs(this, treeOutputsPortName, forest.NumTrees()), _edgeIndicatorVector(this, edgeIndicatorVectorPortName, forest.NumEdges()), _forest(forest)
+        : CompilableNode({ &_input }, { &_output, &_treeOutputs, &_edgeIndicatorVector }), _input(this, input, inputPortName), _output(this, outputPortName, 1), _treeOutputs(this, treeOutputsPortName, forest.NumTrees()), _edgeIndicatorVector(this, edgeIndicatorVectorPortName, forest.NumEdges()), _forest(forest)
     {
     }
 
     template <typename SplitRuleType, typename EdgePredictorType>
     ForestPredictorNode<SplitRuleType, EdgePredictorType>::ForestPredictorNode()
-        : Node({ &_input }, { &_output, &_treeOutputs, &_edgeIndicatorVector }), _input(this, {}, inputPortName), _output(this, outputPortName, 1), _treeOutputs(this, treeOutputsPortName, 0), _edgeIndicatorVector(this, edgeIndicatorVectorPortName, 0)
+        : CompilableNode({ &_input }, { &_output, &_treeOutputs, &_edgeIndicatorVector }), _input(this, {}, inputPortName), _output(this, outputPortName, 1), _treeOutputs(this, treeOutputsPortName, 0), _edgeIndicatorVector(this, edgeIndicatorVectorPortName, 0)
     {
     }
 
@@ -165,6 +165,20 @@ namespace nodes
         return true;
     }
 
+    template <typename SplitRuleType, typename EdgePredictorType>
+    bool ForestPredictorNode<SplitRuleType, EdgePredictorType>::IsCompilable() const
+    {
+        // generic forests compile by refinement into per-split subgraphs; the simple forest
+        // specialization (see ForestPredictorNode.cpp) has a direct flattened lowering
+        return false;
+    }
+
+    template <typename SplitRuleType, typename EdgePredictorType>
+    void ForestPredictorNode<SplitRuleType, EdgePredictorType>::Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function)
+    {
+        CompilableNode::Compile(compiler, function);
+    }
+
     template <typename SplitRuleType, typename EdgePredictorType>
     void ForestPredictorNode<SplitRuleType, EdgePredictorType>::Compute() const
     {
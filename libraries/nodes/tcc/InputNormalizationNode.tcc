@@ -0,0 +1,92 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     InputNormalizationNode.tcc (nodes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ell
+{
+namespace nodes
+{
+    template <typename ValueType>
+    InputNormalizationNode<ValueType>::InputNormalizationNode(const model::PortElements<ValueType>& input, std::vector<ValueType> mean, std::vector<ValueType> inverseStdDev)
+        : CompilableNode({ &_input }, { &_output }), _input(this, input, inputPortName), _output(this, outputPortName, input.Size()), _mean(std::move(mean)), _inverseStdDev(std::move(inverseStdDev))
+    {
+        if (_mean.size() != _input.Size() || _inverseStdDev.size() != _input.Size())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::sizeMismatch, "Calibration vectors must have the input's size");
+        }
+    }
+
+    template <typename ValueType>
+    InputNormalizationNode<ValueType>::InputNormalizationNode()
+        : CompilableNode({ &_input }, { &_output }), _input(this, {}, inputPortName), _output(this, outputPortName, 0)
+    {
+    }
+
+    template <typename ValueType>
+    void InputNormalizationNode<ValueType>::Compute() const
+    {
+        auto inputValues = _input.GetValue();
+        std::vector<ValueType> result(inputValues.size());
+        for (size_t index = 0; index < inputValues.size(); ++index)
+        {
+            result[index] = (inputValues[index] - _mean[index]) * _inverseStdDev[index];
+        }
+        _output.SetOutput(result);
+    };
+
+    template <typename ValueType>
+    void InputNormalizationNode<ValueType>::Copy(model::ModelTransformer& transformer) const
+    {
+        auto newPortElements = transformer.TransformPortElements(_input.GetPortElements());
+        auto newNode = transformer.AddNode<InputNormalizationNode<ValueType>>(newPortElements, _mean, _inverseStdDev);
+        transformer.MapNodeOutput(output, newNode->output);
+    }
+
+    template <typename ValueType>
+    void InputNormalizationNode<ValueType>::Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function)
+    {
+        llvm::Value* pInput = compiler.EnsurePortEmitted(input);
+        llvm::Value* pResult = compiler.EnsurePortEmitted(output);
+
+        // The calibration vectors are constants, emitted like ConstantNode's values
+        auto& variables = function.GetModule().Variables();
+        llvm::Value* pMean = function.GetModule().EnsureEmitted(*variables.AddVariable<emitters::LiteralVectorVariable<ValueType>>(_mean));
+        llvm::Value* pInverseStdDev = function.GetModule().EnsureEmitted(*variables.AddVariable<emitters::LiteralVectorVariable<ValueType>>(_inverseStdDev));
+
+        auto count = input.Size();
+        auto forLoop = function.ForLoop();
+        forLoop.Begin(0, (int)count, 1);
+        {
+            auto i = forLoop.LoadIterationVariable();
+            llvm::Value* inputValue = function.ValueAt(pInput, i);
+            llvm::Value* centered = function.Operator(emitters::GetSubtractForValueType<ValueType>(), inputValue, function.ValueAt(pMean, i));
+            llvm::Value* scaled = function.Operator(emitters::GetMultiplyForValueType<ValueType>(), centered, function.ValueAt(pInverseStdDev, i));
+            function.SetValueAt(pResult, i, scaled);
+        }
+        forLoop.End();
+    }
+
+    template <typename ValueType>
+    void InputNormalizationNode<ValueType>::WriteToArchive(utilities::Archiver& archiver) const
+    {
+        Node::WriteToArchive(archiver);
+        archiver[inputPortName] << _input;
+        archiver["mean"] << _mean;
+        archiver["inverseStdDev"] << _inverseStdDev;
+    }
+
+    template <typename ValueType>
+    void InputNormalizationNode<ValueType>::ReadFromArchive(utilities::Unarchiver& archiver)
+    {
+        Node::ReadFromArchive(archiver);
+        archiver[inputPortName] >> _input;
+        archiver["mean"] >> _mean;
+        archiver["inverseStdDev"] >> _inverseStdDev;
+        _output.SetSize(_input.Size());
+    }
+}
+}
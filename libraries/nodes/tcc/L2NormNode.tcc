@@ -12,13 +12,13 @@ namespace nodes
 {
     template <typename ValueType>
     L2NormNode<ValueType>::L2NormNode()
-        : Node({ &_input }, { &_output }), _input(this, {}, inputPortName), _output(this, outputPortName, 1)
+        : CompilableNode({ &_input }, { &_output }), _input(this, {}, inputPortName), _output(this, outputPortName, 1)
     {
     }
 
     template <typename ValueType>
     L2NormNode<ValueType>::L2NormNode(const model::PortElements<ValueType>& input)
-        : Node({ &_input }, { &_output }), _input(this, input, inputPortName), _output(this, outputPortName, 1)
+        : CompilableNode({ &_input }, { &_output }), _input(this, input, inputPortName), _output(this, outputPortName, 1)
     {
     }
 
@@ -42,6 +42,87 @@ namespace nodes
         transformer.MapNodeOutput(output, newNode->output);
     }
 
+    template <typename ValueType>
+    void L2NormNode<ValueType>::Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function)
+    {
+        llvm::Value* pResult = compiler.EnsurePortEmitted(output);
+
+        llvm::Value* pSumOfSquares = function.Variable(emitters::GetVariableType<ValueType>(), "sumOfSquares");
+        function.Store(pSumOfSquares, function.Literal<ValueType>(0));
+
+        if (IsPureVector(input) && !compiler.ShouldUnrollLoop(input.Size()))
+        {
+            CompileLoop(compiler, function, pSumOfSquares);
+        }
+        else
+        {
+            CompileExpanded(compiler, function, pSumOfSquares);
+        }
+
+        auto pSqrtFunction = function.GetModule().GetRuntime().GetSqrtFunction<ValueType>();
+        function.Store(pResult, function.Call(pSqrtFunction, { function.Load(pSumOfSquares) }));
+    }
+
+    template <typename ValueType>
+    void L2NormNode<ValueType>::CompileLoop(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function, llvm::Value* pSumOfSquares)
+    {
+        llvm::Value* pSrcVector = compiler.EnsurePortEmitted(input);
+        auto addOp = emitters::GetAddForValueType<ValueType>();
+        auto multiplyOp = emitters::GetMultiplyForValueType<ValueType>();
+
+        // As in SumNode, break the loop-carried accumulation into independent partial sums
+        // when fast math lets us reassociate, so the reduction isn't serialized on FPU latency.
+        const int size = (int)input.Size();
+        const int numAccumulators = (compiler.GetCompilerParameters().useFastMath && size >= 8) ? 4 : 1;
+        const int blockedEnd = size - (size % numAccumulators);
+
+        std::vector<llvm::Value*> partialSums;
+        partialSums.push_back(pSumOfSquares);
+        for (int k = 1; k < numAccumulators; ++k)
+        {
+            llvm::Value* partialSum = function.Variable(emitters::GetVariableType<ValueType>(), "partialSumOfSquares");
+            function.Store(partialSum, function.Literal<ValueType>(0));
+            partialSums.push_back(partialSum);
+        }
+
+        auto forLoop = function.ForLoop();
+        forLoop.Begin(0, blockedEnd, numAccumulators);
+        {
+            auto i = forLoop.LoadIterationVariable();
+            for (int k = 0; k < numAccumulators; ++k)
+            {
+                llvm::Value* index = (k == 0) ? i : function.Operator(emitters::TypedOperator::add, i, function.Literal<int>(k));
+                llvm::Value* pValue = function.ValueAt(pSrcVector, index);
+                function.OperationAndUpdate(partialSums[k], addOp, function.Operator(multiplyOp, pValue, pValue));
+            }
+        }
+        forLoop.End();
+
+        // Fold any remainder elements into the first partial sum
+        for (int index = blockedEnd; index < size; ++index)
+        {
+            llvm::Value* pValue = function.ValueAt(pSrcVector, function.Literal<int>(index));
+            function.OperationAndUpdate(partialSums[0], addOp, function.Operator(multiplyOp, pValue, pValue));
+        }
+
+        for (int k = 1; k < numAccumulators; ++k)
+        {
+            function.OperationAndUpdate(pSumOfSquares, addOp, function.Load(partialSums[k]));
+        }
+    }
+
+    template <typename ValueType>
+    void L2NormNode<ValueType>::CompileExpanded(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function, llvm::Value* pSumOfSquares)
+    {
+        auto addOp = emitters::GetAddForValueType<ValueType>();
+        auto multiplyOp = emitters::GetMultiplyForValueType<ValueType>();
+        for (size_t index = 0; index < input.Size(); ++index)
+        {
+            llvm::Value* pValue = compiler.LoadPortElementVariable(input.GetInputElement(index));
+            function.OperationAndUpdate(pSumOfSquares, addOp, function.Operator(multiplyOp, pValue, pValue));
+        }
+    }
+
     template <typename ValueType>
     void L2NormNode<ValueType>::WriteToArchive(utilities::Archiver& archiver) const
     {
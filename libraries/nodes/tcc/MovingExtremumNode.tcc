@@ -0,0 +1,98 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     MovingExtremumNode.tcc (nodes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ell
+{
+namespace nodes
+{
+    template <typename ValueType, bool max>
+    MovingExtremumNode<ValueType, max>::MovingExtremumNode()
+        : Node({ &_input }, { &_output }), _input(this, {}, inputPortName), _output(this, outputPortName, 0), _windowSize(0)
+    {
+    }
+
+    template <typename ValueType, bool max>
+    MovingExtremumNode<ValueType, max>::MovingExtremumNode(const model::PortElements<ValueType>& input, size_t windowSize)
+        : Node({ &_input }, { &_output }), _input(this, input, inputPortName), _output(this, outputPortName, _input.Size()), _windowSize(windowSize)
+    {
+        _candidates.resize(_input.Size());
+    }
+
+    template <typename ValueType, bool max>
+    std::string MovingExtremumNode<ValueType, max>::GetTypeName()
+    {
+        if (max)
+        {
+            return utilities::GetCompositeTypeName<ValueType, std::true_type>("MovingExtremumNode");
+        }
+        else
+        {
+            return utilities::GetCompositeTypeName<ValueType, std::false_type>("MovingExtremumNode");
+        }
+    }
+
+    template <typename ValueType, bool max>
+    void MovingExtremumNode<ValueType, max>::Compute() const
+    {
+        ++_tick;
+        std::vector<ValueType> result(_input.Size());
+        for (size_t index = 0; index < _input.Size(); ++index)
+        {
+            auto value = _input[index];
+            auto& candidates = _candidates[index];
+
+            // drop candidates that have fallen out of the window, then the ones the new sample
+            // dominates: they're older and no more extreme, so they can never be the answer
+            while (!candidates.empty() && candidates.front().first + _windowSize <= _tick)
+            {
+                candidates.pop_front();
+            }
+            auto dominates = [value](const Candidate& candidate) {
+                return max ? (candidate.second <= value) : (candidate.second >= value);
+            };
+            while (!candidates.empty() && dominates(candidates.back()))
+            {
+                candidates.pop_back();
+            }
+            candidates.emplace_back(_tick, value);
+
+            result[index] = candidates.front().second;
+        }
+        _output.SetOutput(result);
+    };
+
+    template <typename ValueType, bool max>
+    void MovingExtremumNode<ValueType, max>::Copy(model::ModelTransformer& transformer) const
+    {
+        auto newPortElements = transformer.TransformPortElements(_input.GetPortElements());
+        auto newNode = transformer.AddNode<MovingExtremumNode<ValueType, max>>(newPortElements, _windowSize);
+        transformer.MapNodeOutput(output, newNode->output);
+    }
+
+    template <typename ValueType, bool max>
+    void MovingExtremumNode<ValueType, max>::WriteToArchive(utilities::Archiver& archiver) const
+    {
+        Node::WriteToArchive(archiver);
+        archiver[inputPortName] << _input;
+        archiver["windowSize"] << _windowSize;
+    }
+
+    template <typename ValueType, bool max>
+    void MovingExtremumNode<ValueType, max>::ReadFromArchive(utilities::Unarchiver& archiver)
+    {
+        Node::ReadFromArchive(archiver);
+        archiver[inputPortName] >> _input;
+        archiver["windowSize"] >> _windowSize;
+
+        _candidates.clear();
+        _candidates.resize(_input.Size());
+        _tick = 0;
+        _output.SetSize(_input.Size());
+    }
+}
+}
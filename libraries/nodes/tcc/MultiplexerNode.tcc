@@ -67,6 +67,17 @@ namespace nodes
 
         llvm::Value* pSelectorVal = compiler.EnsurePortEmitted(selector);
         llvm::Value* pResult = compiler.EnsurePortEmitted(output);
+
+        if (compiler.GetCompilerParameters().useBranchlessSelects)
+        {
+            // speculative form: leave both arms emitted unconditionally upstream (no region
+            // merging) and pick between them with a predicated select instead of a branch
+            auto pIsZero = function.Comparison(emitters::TypedComparison::equals, pSelectorVal, function.Literal<SelectorType>(0));
+            auto pValue = function.Select(pIsZero, compiler.LoadPortElementVariable(elements.GetInputElement(0)), compiler.LoadPortElementVariable(elements.GetInputElement(1)));
+            function.Store(pResult, pValue);
+            return;
+        }
+
         auto lVal = elements.GetInputElement(0); // lval is selected if the result of the "if" comparison is NON-zero
         auto rVal = elements.GetInputElement(1);
         auto pLMergeableSrc = compiler.GetMergeableNodeRegion(lVal);
@@ -107,6 +118,21 @@ namespace nodes
 
         llvm::Value* pSelectorVal = compiler.LoadPortVariable(selector); // TODO: change this to EnsurePortEmitted
         llvm::Value* result = compiler.EnsurePortEmitted(output);
+
+        if (compiler.GetCompilerParameters().useBranchlessSelects)
+        {
+            // reduce the elements with a chain of predicated selects: straight-line code with
+            // no data-dependent branches, at the cost of loading every element
+            llvm::Value* value = compiler.LoadPortElementVariable(elements.GetInputElement(0));
+            for (size_t index = 1; index < numElements; ++index)
+            {
+                auto pIsMatch = function.Comparison(emitters::TypedComparison::equals, pSelectorVal, function.Literal((int)index));
+                value = function.Select(pIsMatch, compiler.LoadPortElementVariable(elements.GetInputElement(index)), value);
+            }
+            function.Store(result, value);
+            return;
+        }
+
         for (size_t index = 0; index < numElements; ++index)
         {
             emitters::IRIfEmitter if1 = function.If(emitters::TypedComparison::equals, function.Literal((int)index), pSelectorVal);
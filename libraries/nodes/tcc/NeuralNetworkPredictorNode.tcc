@@ -53,6 +53,9 @@ namespace nodes
         node = TryAddLayerNode<predictors::neural::ConvolutionalLayer<ValueType>, ConvolutionalLayerNode<ValueType>>(transformer, layer, layerInputs);
         if (node != nullptr) return node;
 
+        node = TryAddLayerNode<predictors::neural::DepthwiseConvolutionalLayer<ValueType>, DepthwiseConvolutionalLayerNode<ValueType>>(transformer, layer, layerInputs);
+        if (node != nullptr) return node;
+
         node = TryAddLayerNode<predictors::neural::FullyConnectedLayer<ValueType>, FullyConnectedLayerNode<ValueType>>(transformer, layer, layerInputs);
         if (node != nullptr) return node;
 
@@ -62,6 +65,12 @@ namespace nodes
         node = TryAddLayerNode<predictors::neural::PoolingLayer<ValueType, predictors::neural::MeanPoolingFunction>, PoolingLayerNode<ValueType, predictors::neural::MeanPoolingFunction>>(transformer, layer, layerInputs);
         if (node != nullptr) return node;
 
+        node = TryAddLayerNode<predictors::neural::QuantizedConvolutionalLayer<ValueType>, QuantizedConvolutionalLayerNode<ValueType>>(transformer, layer, layerInputs);
+        if (node != nullptr) return node;
+
+        node = TryAddLayerNode<predictors::neural::QuantizedFullyConnectedLayer<ValueType>, QuantizedFullyConnectedLayerNode<ValueType>>(transformer, layer, layerInputs);
+        if (node != nullptr) return node;
+
         node = TryAddLayerNode<predictors::neural::ScalingLayer<ValueType>, ScalingLayerNode<ValueType>>(transformer, layer, layerInputs);
         if (node != nullptr) return node;
 
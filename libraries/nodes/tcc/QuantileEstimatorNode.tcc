@@ -0,0 +1,170 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     QuantileEstimatorNode.tcc (nodes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// stl
+#include <algorithm>
+#include <cmath>
+
+namespace ell
+{
+namespace nodes
+{
+    template <typename ValueType>
+    QuantileEstimatorNode<ValueType>::QuantileEstimatorNode()
+        : Node({ &_input }, { &_output }), _input(this, {}, inputPortName), _output(this, outputPortName, 0), _quantile(0)
+    {
+    }
+
+    template <typename ValueType>
+    QuantileEstimatorNode<ValueType>::QuantileEstimatorNode(const model::PortElements<ValueType>& input, double quantile)
+        : Node({ &_input }, { &_output }), _input(this, input, inputPortName), _output(this, outputPortName, _input.Size()), _quantile(quantile)
+    {
+        InitializeEstimators();
+    }
+
+    template <typename ValueType>
+    void QuantileEstimatorNode<ValueType>::InitializeEstimators()
+    {
+        _estimators.clear();
+        _estimators.resize(_input.Size());
+    }
+
+    template <typename ValueType>
+    void QuantileEstimatorNode<ValueType>::Estimator::Update(double value, double quantile)
+    {
+        if (count < numMarkers)
+        {
+            // warmup: absorb the sample and keep the collected values sorted
+            heights[count] = value;
+            ++count;
+            std::sort(heights.begin(), heights.begin() + count);
+            if (count == numMarkers)
+            {
+                for (size_t i = 0; i < numMarkers; ++i)
+                {
+                    positions[i] = static_cast<double>(i + 1);
+                }
+                desired = { 1, 1 + 2 * quantile, 1 + 4 * quantile, 3 + 2 * quantile, 5 };
+            }
+            return;
+        }
+
+        // find the cell the sample falls in, extending the extreme markers if necessary
+        size_t cell;
+        if (value < heights[0])
+        {
+            heights[0] = value;
+            cell = 0;
+        }
+        else if (value >= heights[numMarkers - 1])
+        {
+            heights[numMarkers - 1] = value;
+            cell = numMarkers - 2;
+        }
+        else
+        {
+            cell = 0;
+            while (value >= heights[cell + 1])
+            {
+                ++cell;
+            }
+        }
+
+        // shift the positions above the cell, and advance every marker's desired position
+        for (size_t i = cell + 1; i < numMarkers; ++i)
+        {
+            positions[i] += 1;
+        }
+        const double increments[numMarkers] = { 0, quantile / 2, quantile, (1 + quantile) / 2, 1 };
+        for (size_t i = 0; i < numMarkers; ++i)
+        {
+            desired[i] += increments[i];
+        }
+
+        // move each interior marker toward its desired position, by parabolic (P-squared)
+        // interpolation when the result stays between its neighbors, linearly otherwise
+        for (size_t i = 1; i < numMarkers - 1; ++i)
+        {
+            double offset = desired[i] - positions[i];
+            if ((offset >= 1 && positions[i + 1] - positions[i] > 1) || (offset <= -1 && positions[i - 1] - positions[i] < -1))
+            {
+                double direction = (offset >= 0) ? 1 : -1;
+                double gapAbove = positions[i + 1] - positions[i];
+                double gapBelow = positions[i] - positions[i - 1];
+                double parabolic = heights[i] + (direction / (positions[i + 1] - positions[i - 1])) * ((gapBelow + direction) * (heights[i + 1] - heights[i]) / gapAbove + (gapAbove - direction) * (heights[i] - heights[i - 1]) / gapBelow);
+                if (heights[i - 1] < parabolic && parabolic < heights[i + 1])
+                {
+                    heights[i] = parabolic;
+                }
+                else
+                {
+                    size_t neighbor = (direction > 0) ? i + 1 : i - 1;
+                    heights[i] += direction * (heights[neighbor] - heights[i]) / (positions[neighbor] - positions[i]);
+                }
+                positions[i] += direction;
+            }
+        }
+    }
+
+    template <typename ValueType>
+    double QuantileEstimatorNode<ValueType>::Estimator::GetEstimate(double quantile) const
+    {
+        if (count == 0)
+        {
+            return 0;
+        }
+        if (count < numMarkers)
+        {
+            // warmup: the empirical quantile of the (sorted) samples collected so far
+            auto index = static_cast<size_t>(std::lround(quantile * (count - 1)));
+            return heights[index];
+        }
+        return heights[numMarkers / 2]; // the middle marker tracks the target quantile
+    }
+
+    template <typename ValueType>
+    void QuantileEstimatorNode<ValueType>::Compute() const
+    {
+        std::vector<ValueType> result(_input.Size());
+        for (size_t index = 0; index < _input.Size(); ++index)
+        {
+            auto& estimator = _estimators[index];
+            estimator.Update(static_cast<double>(_input[index]), _quantile);
+            result[index] = static_cast<ValueType>(estimator.GetEstimate(_quantile));
+        }
+        _output.SetOutput(result);
+    };
+
+    template <typename ValueType>
+    void QuantileEstimatorNode<ValueType>::Copy(model::ModelTransformer& transformer) const
+    {
+        auto newPortElements = transformer.TransformPortElements(_input.GetPortElements());
+        auto newNode = transformer.AddNode<QuantileEstimatorNode<ValueType>>(newPortElements, _quantile);
+        transformer.MapNodeOutput(output, newNode->output);
+    }
+
+    template <typename ValueType>
+    void QuantileEstimatorNode<ValueType>::WriteToArchive(utilities::Archiver& archiver) const
+    {
+        Node::WriteToArchive(archiver);
+        archiver[inputPortName] << _input;
+        archiver["quantile"] << _quantile;
+    }
+
+    template <typename ValueType>
+    void QuantileEstimatorNode<ValueType>::ReadFromArchive(utilities::Unarchiver& archiver)
+    {
+        Node::ReadFromArchive(archiver);
+        archiver[inputPortName] >> _input;
+        archiver["quantile"] >> _quantile;
+
+        InitializeEstimators();
+        _output.SetSize(_input.Size());
+    }
+}
+}
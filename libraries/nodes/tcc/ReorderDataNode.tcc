@@ -6,12 +6,17 @@
 //
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+// emitters
+#include "TargetTuning.h"
+
 // model
 #include "CompilableNodeUtilities.h"
 #include "IRMapCompiler.h"
 #include "OutputNode.h"
 
 // stl
+#include <algorithm>
+#include <array>
 #include <vector>
 
 namespace ell
@@ -47,22 +52,43 @@ namespace nodes
         int outputSize = _outputShape.GetMemorySize();
         std::vector<ValueType> output(outputSize);
 
-        // loop over output
-        for (int z = 0; z < _outputShape.GetExtent(2); ++z)
+        // The loop order is driven by the output layout: the output's memory-minor dimension runs
+        // innermost, so the writes stream contiguously no matter how the data is being permuted.
+        // The outer two dimensions are tiled; when the input order differs, a tile's worth of its
+        // strided cache lines stays resident while the contiguous side walks across it, so the
+        // conversion is limited by bandwidth rather than per-element misses.
+        auto order = _outputShape.GetDimensionOrder();
+        const int blockSize = 16;
+        int outerExtent = static_cast<int>(_outputShape.GetExtent(order[0]));
+        int middleExtent = static_cast<int>(_outputShape.GetExtent(order[1]));
+        int minorExtent = static_cast<int>(_outputShape.GetExtent(order[2]));
+        for (int outerBlock = 0; outerBlock < outerExtent; outerBlock += blockSize)
         {
-            for (int y = 0; y < _outputShape.GetExtent(1); ++y)
+            int outerEnd = std::min(outerBlock + blockSize, outerExtent);
+            for (int middleBlock = 0; middleBlock < middleExtent; middleBlock += blockSize)
             {
-                for (int x = 0; x < _outputShape.GetExtent(0); ++x)
+                int middleEnd = std::min(middleBlock + blockSize, middleExtent);
+                for (int outer = outerBlock; outer < outerEnd; ++outer)
                 {
-                    auto outputIndex = _outputShape.GetEntryOffset({ x, y, z });
-                    if (_inputShape.IsOutOfBounds({ x, y, z }))
-                    {
-                        output[outputIndex] = static_cast<ValueType>(0);
-                    }
-                    else
+                    for (int middle = middleBlock; middle < middleEnd; ++middle)
                     {
-                        auto inputIndex = _inputShape.GetEntryOffset({ x, y, z });
-                        output[outputIndex] = _input[inputIndex];
+                        for (int minor = 0; minor < minorExtent; ++minor)
+                        {
+                            std::array<int, DataShape::Dimension> location;
+                            location[order[0]] = outer;
+                            location[order[1]] = middle;
+                            location[order[2]] = minor;
+                            auto outputIndex = _outputShape.GetEntryOffset(location);
+                            if (_inputShape.IsOutOfBounds(location))
+                            {
+                                output[outputIndex] = static_cast<ValueType>(0);
+                            }
+                            else
+                            {
+                                auto inputIndex = _inputShape.GetEntryOffset(location);
+                                output[outputIndex] = _input[inputIndex];
+                            }
+                        }
                     }
                 }
             }
@@ -77,36 +103,142 @@ namespace nodes
         llvm::Value* pInput = compiler.EnsurePortEmitted(this->input);
         llvm::Value* pOutput = compiler.EnsurePortEmitted(this->output);
 
-        int outputSize = _outputShape.GetMemorySize();
-        auto zLoop = function.ForLoop();
-        zLoop.Begin(_outputShape.GetExtent(2));
+        // once the map is finalized every shape parameter is a compile-time constant, so for
+        // small outputs emit the whole reorder as straight-line code: every index folds to a
+        // literal and every bounds check is decided here instead of at runtime
+        if (compiler.ShouldUnrollLoop(_outputShape.GetMemorySize()))
+        {
+            CompileFullyUnrolled(function, pInput, pOutput);
+            return;
+        }
+
+        // the same layout-driven loop nest as Compute: the output's memory-minor dimension runs
+        // innermost so the stores stream contiguously, and the outer two dimensions are tiled to
+        // keep a tile of the strided side resident in cache while the contiguous side streams
+        // through it
+        auto order = _outputShape.GetDimensionOrder();
+        const int blockSize = 16;
+        int outerExtent = static_cast<int>(_outputShape.GetExtent(order[0]));
+        int middleExtent = static_cast<int>(_outputShape.GetExtent(order[1]));
+        int minorExtent = static_cast<int>(_outputShape.GetExtent(order[2]));
+
+        // when the input's stride along the output-minor dimension spans whole cache lines, the
+        // reads hop between lines the hardware prefetcher can't follow, so software-prefetch the
+        // line a fixed number of iterations ahead (running past the end of the walk is harmless)
+        auto tuning = emitters::GetKernelTuningParameters(compiler.GetCompilerParameters().targetDevice);
+        const int prefetchDistance = static_cast<int>(tuning.prefetchDistance);
+        const int minorInputStride = static_cast<int>(_inputShape.GetStride(static_cast<int>(order[2])));
+        const bool emitPrefetch = prefetchDistance > 0 && minorInputStride * static_cast<int>(sizeof(ValueType)) >= 64;
+
+        // when the input shape covers every location the walk visits, no element can be out of
+        // bounds, so skip emitting the per-element check and branch entirely
+        const bool canSkipBoundsCheck = _inputShape.IsAlwaysInBounds(_outputShape);
+
+        auto outerBlockLoop = function.ForLoop();
+        outerBlockLoop.Begin(0, outerExtent, blockSize);
+        {
+            llvm::Value* outerBlock = outerBlockLoop.LoadIterationVariable();
+            auto outerBlockLimit = function.Operator(emitters::TypedOperator::add, outerBlock, function.Literal(blockSize));
+            auto outerTooBig = function.Comparison(emitters::TypedComparison::greaterThan, outerBlockLimit, function.Literal(outerExtent));
+            auto outerEnd = function.Select(outerTooBig, function.Literal(outerExtent), outerBlockLimit);
+            auto middleBlockLoop = function.ForLoop();
+            middleBlockLoop.Begin(0, middleExtent, blockSize);
+            {
+                llvm::Value* middleBlock = middleBlockLoop.LoadIterationVariable();
+                auto middleBlockLimit = function.Operator(emitters::TypedOperator::add, middleBlock, function.Literal(blockSize));
+                auto middleTooBig = function.Comparison(emitters::TypedComparison::greaterThan, middleBlockLimit, function.Literal(middleExtent));
+                auto middleEnd = function.Select(middleTooBig, function.Literal(middleExtent), middleBlockLimit);
+                auto outerLoop = function.ForLoop();
+                outerLoop.Begin(outerBlock, outerEnd, 1);
+                {
+                    llvm::Value* outer = outerLoop.LoadIterationVariable();
+                    auto middleLoop = function.ForLoop();
+                    middleLoop.Begin(middleBlock, middleEnd, 1);
+                    {
+                        llvm::Value* middle = middleLoop.LoadIterationVariable();
+                        auto minorLoop = function.ForLoop();
+                        minorLoop.Begin(0, minorExtent, 1);
+                        // the strided gather defeats the vectorizer's own profitability check, so request a width explicitly
+                        minorLoop.SetVectorizationHints(static_cast<int>(emitters::GetPreferredVectorWidth(compiler.GetCompilerParameters().targetDevice, sizeof(ValueType))));
+                        {
+                            llvm::Value* minor = minorLoop.LoadIterationVariable();
+                            std::array<llvm::Value*, DataShape::Dimension> location;
+                            location[order[0]] = outer;
+                            location[order[1]] = middle;
+                            location[order[2]] = minor;
+                            if (emitPrefetch)
+                            {
+                                auto prefetchLocation = location;
+                                prefetchLocation[order[2]] = function.Operator(emitters::TypedOperator::add, minor, function.Literal(prefetchDistance));
+                                function.Prefetch(pInput, _inputShape.EmitGetEntryOffset(function, prefetchLocation));
+                            }
+                            auto outputIndex = _outputShape.EmitGetEntryOffset(function, location);
+                            if (canSkipBoundsCheck)
+                            {
+                                auto inputIndex = _inputShape.EmitGetEntryOffset(function, location);
+                                llvm::Value* value = function.ValueAt(pInput, inputIndex);
+                                function.SetValueAt(pOutput, outputIndex, value);
+                            }
+                            else
+                            {
+                                auto oob = _inputShape.EmitIsOutOfBounds(function, location);
+                                auto ifOob = function.If();
+                                ifOob.If(oob);
+                                {
+                                    function.SetValueAt(pOutput, outputIndex, function.Literal<ValueType>(0));
+                                }
+                                ifOob.Else();
+                                {
+                                    auto inputIndex = _inputShape.EmitGetEntryOffset(function, location);
+                                    llvm::Value* value = function.ValueAt(pInput, inputIndex);
+                                    function.SetValueAt(pOutput, outputIndex, value);
+                                }
+                                ifOob.End();
+                            }
+                        }
+                        minorLoop.End();
+                    }
+                    middleLoop.End();
+                }
+                outerLoop.End();
+            }
+            middleBlockLoop.End();
+        }
+        outerBlockLoop.End();
+    }
+
+    template <typename ValueType>
+    void ReorderDataNode<ValueType>::CompileFullyUnrolled(emitters::IRFunctionEmitter& function, llvm::Value* pInput, llvm::Value* pOutput) const
+    {
+        // the same walk as Compute, performed here at compile time: each element becomes one
+        // load/store with literal indices, and out-of-bounds elements become literal zero stores
+        auto order = _outputShape.GetDimensionOrder();
+        int outerExtent = static_cast<int>(_outputShape.GetExtent(order[0]));
+        int middleExtent = static_cast<int>(_outputShape.GetExtent(order[1]));
+        int minorExtent = static_cast<int>(_outputShape.GetExtent(order[2]));
+        for (int outer = 0; outer < outerExtent; ++outer)
         {
-            llvm::Value* z = zLoop.LoadIterationVariable();
-            auto yLoop = function.ForLoop();
-            yLoop.Begin(_outputShape.GetExtent(1));
+            for (int middle = 0; middle < middleExtent; ++middle)
             {
-                llvm::Value* y = yLoop.LoadIterationVariable();
-                for (int x = 0; x < _outputShape.GetExtent(0); ++x)
+                for (int minor = 0; minor < minorExtent; ++minor)
                 {
-                    auto outputIndex = _outputShape.EmitGetEntryOffset(function, { function.Literal<int>(x), y, z });
-                    auto oob = _inputShape.EmitIsOutOfBounds(function, { function.Literal<int>(x), y, z });
-                    auto ifOob = function.If();
-                    ifOob.If(oob);
+                    std::array<int, DataShape::Dimension> location;
+                    location[order[0]] = outer;
+                    location[order[1]] = middle;
+                    location[order[2]] = minor;
+                    auto outputIndex = function.Literal(static_cast<int>(_outputShape.GetEntryOffset(location)));
+                    if (_inputShape.IsOutOfBounds(location))
                     {
                         function.SetValueAt(pOutput, outputIndex, function.Literal<ValueType>(0));
                     }
-                    ifOob.Else();
+                    else
                     {
-                        auto inputIndex = _inputShape.EmitGetEntryOffset(function, { function.Literal<int>(x), y, z });
-                        llvm::Value* value = function.ValueAt(pInput, inputIndex);
-                        function.SetValueAt(pOutput, outputIndex, value);
+                        auto inputIndex = function.Literal(static_cast<int>(_inputShape.GetEntryOffset(location)));
+                        function.SetValueAt(pOutput, outputIndex, function.ValueAt(pInput, inputIndex));
                     }
-                    ifOob.End();
                 }
             }
-            yLoop.End();
         }
-        zLoop.End();
     }
 
     template <typename ValueType>
@@ -74,7 +74,7 @@ namespace nodes
         function.GetModule().InsertMetadata(_sinkFunctionName, emitters::c_callbackFunctionTagName, "SinkNode");
 
         // Set output values as well, useful when user code is in a non-event-driven mode
-        if (!IsScalar(input) && !compiler.GetCompilerParameters().unrollLoops)
+        if (!IsScalar(input) && !compiler.ShouldUnrollLoop(input.Size()))
         {
             SetOutputValuesLoop(compiler, function);
         }
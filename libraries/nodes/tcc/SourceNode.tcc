@@ -32,12 +32,78 @@ namespace nodes
         _bufferedSample.resize(outputSize);
     }
 
+    template <typename ValueType, SamplingFunction<ValueType> getSample>
+    SourceNode<ValueType, getSample>::~SourceNode()
+    {
+        StopProducerThread();
+    }
+
+    template <typename ValueType, SamplingFunction<ValueType> getSample>
+    void SourceNode<ValueType, getSample>::SetSamplingMode(SourceSamplingMode mode, size_t bufferCapacity)
+    {
+        StopProducerThread();
+        _samplingMode = mode;
+        _bufferCapacity = bufferCapacity;
+
+        if (mode != SourceSamplingMode::synchronous)
+        {
+            _pSampleBuffer = std::make_unique<utilities::SpscRingBuffer<std::vector<ValueType>>>(bufferCapacity);
+            _stopProducer = false;
+            _producerThread = std::thread([this]() {
+                std::vector<ValueType> sample(_output.Size());
+                while (!_stopProducer)
+                {
+                    if (getSample(sample))
+                    {
+                        // when the buffer is full the sample is dropped - the producer never blocks
+                        _pSampleBuffer->TryPush(sample);
+                    }
+                    else
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+    }
+
+    template <typename ValueType, SamplingFunction<ValueType> getSample>
+    void SourceNode<ValueType, getSample>::StopProducerThread()
+    {
+        if (_producerThread.joinable())
+        {
+            _stopProducer = true;
+            _producerThread.join();
+        }
+        _pSampleBuffer.reset();
+    }
+
     template <typename ValueType, SamplingFunction<ValueType> getSample>
     void SourceNode<ValueType, getSample>::Compute() const
     {
         auto sampleTime = _input.GetValue(0);
 
-        if ((sampleTime != _bufferedSampleTime) && getSample(_bufferedSample))
+        bool hasNewSample = false;
+        if (sampleTime != _bufferedSampleTime)
+        {
+            if (_samplingMode == SourceSamplingMode::synchronous)
+            {
+                hasNewSample = getSample(_bufferedSample);
+            }
+            else
+            {
+                // consume from the ring buffer without blocking - the producer thread overlaps the
+                // sampling I/O with compute
+                std::vector<ValueType> sample;
+                hasNewSample = (_samplingMode == SourceSamplingMode::asynchronousLatest) ? _pSampleBuffer->TryPopLatest(sample) : _pSampleBuffer->TryPop(sample);
+                if (hasNewSample)
+                {
+                    _bufferedSample = std::move(sample);
+                }
+            }
+        }
+
+        if (hasNewSample)
         {
             // Determine if the sample time differs from the current time
             auto currentTime = _input.GetValue(1);
@@ -96,7 +162,7 @@ namespace nodes
         if1.End();
 
         // Set sample values to the output
-        if (!IsScalar(output) && !compiler.GetCompilerParameters().unrollLoops)
+        if (!IsScalar(output) && !compiler.ShouldUnrollLoop(output.Size()))
         {
             SetOutputValuesLoop(compiler, function, pBufferedSample);
         }
@@ -114,6 +180,10 @@ namespace nodes
     {
         auto newPortElements = transformer.TransformPortElements(_input.GetPortElements());
         auto newNode = transformer.AddNode<SourceNode<ValueType, getSample>>(newPortElements, output.Size(), _samplingFunctionName);
+        if (_samplingMode != SourceSamplingMode::synchronous)
+        {
+            newNode->SetSamplingMode(_samplingMode, _bufferCapacity);
+        }
 
         transformer.MapNodeOutput(output, newNode->output);
     }
@@ -0,0 +1,97 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     SparseDotProductNode.tcc (nodes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ell
+{
+namespace nodes
+{
+    template <typename ValueType>
+    SparseDotProductNode<ValueType>::SparseDotProductNode()
+        : CompilableNode({ &_input1, &_input2, &_indices }, { &_output }), _input1(this, {}, input1PortName), _input2(this, {}, input2PortName), _indices(this, {}, indicesPortName), _output(this, outputPortName, 1)
+    {
+    }
+
+    template <typename ValueType>
+    SparseDotProductNode<ValueType>::SparseDotProductNode(const model::PortElements<ValueType>& input1, const model::PortElements<ValueType>& input2, const model::PortElements<int>& indices)
+        : CompilableNode({ &_input1, &_input2, &_indices }, { &_output }), _input1(this, input1, input1PortName), _input2(this, input2, input2PortName), _indices(this, indices, indicesPortName), _output(this, outputPortName, 1)
+    {
+        if (input2.Size() != indices.Size())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::sizeMismatch, "SparseDotProductNode value and index inputs must be the same size");
+        }
+    }
+
+    template <typename ValueType>
+    void SparseDotProductNode<ValueType>::Compute() const
+    {
+        ValueType result = 0;
+        for (size_t entry = 0; entry < _input2.Size(); ++entry)
+        {
+            auto index = static_cast<size_t>(_indices[entry]);
+            result += _input1[index] * _input2[entry];
+        }
+        _output.SetOutput({ result });
+    };
+
+    template <typename ValueType>
+    void SparseDotProductNode<ValueType>::Copy(model::ModelTransformer& transformer) const
+    {
+        auto newInput1 = transformer.TransformPortElements(_input1.GetPortElements());
+        auto newInput2 = transformer.TransformPortElements(_input2.GetPortElements());
+        auto newIndices = transformer.TransformPortElements(_indices.GetPortElements());
+        auto newNode = transformer.AddNode<SparseDotProductNode<ValueType>>(newInput1, newInput2, newIndices);
+        transformer.MapNodeOutput(output, newNode->output);
+    }
+
+    template <typename ValueType>
+    void SparseDotProductNode<ValueType>::Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function)
+    {
+        static_assert(!std::is_same<ValueType, bool>(), "Cannot instantiate boolean sparse dot product nodes");
+        if (!IsPureVector(input1) || !IsPureVector(input2) || !IsPureVector(indices))
+        {
+            throw emitters::EmitterException(emitters::EmitterError::notSupported, "SparseDotProductNode requires contiguous vector inputs");
+        }
+
+        llvm::Value* pVector = compiler.EnsurePortEmitted(input1);
+        llvm::Value* pValues = compiler.EnsurePortEmitted(input2);
+        llvm::Value* pIndices = compiler.EnsurePortEmitted(indices);
+        llvm::Value* pResult = compiler.EnsurePortEmitted(output);
+
+        function.Store(pResult, function.Literal(static_cast<ValueType>(0)));
+        auto forLoop = function.ForLoop();
+        forLoop.Begin(input2.Size());
+        {
+            auto entry = forLoop.LoadIterationVariable();
+            llvm::Value* pIndex = function.ValueAt(pIndices, entry);
+            llvm::Value* pValue = function.ValueAt(pValues, entry);
+            llvm::Value* pElement = function.ValueAt(pVector, pIndex);
+            llvm::Value* pProduct = function.Operator(emitters::GetMultiplyForValueType<ValueType>(), pElement, pValue);
+            function.OperationAndUpdate(pResult, emitters::GetAddForValueType<ValueType>(), pProduct);
+        }
+        forLoop.End();
+    }
+
+    template <typename ValueType>
+    void SparseDotProductNode<ValueType>::WriteToArchive(utilities::Archiver& archiver) const
+    {
+        Node::WriteToArchive(archiver);
+        archiver[input1PortName] << _input1;
+        archiver[input2PortName] << _input2;
+        archiver[indicesPortName] << _indices;
+    }
+
+    template <typename ValueType>
+    void SparseDotProductNode<ValueType>::ReadFromArchive(utilities::Unarchiver& archiver)
+    {
+        Node::ReadFromArchive(archiver);
+        archiver[input1PortName] >> _input1;
+        archiver[input2PortName] >> _input2;
+        archiver[indicesPortName] >> _indices;
+    }
+}
+}
@@ -45,7 +45,7 @@ namespace nodes
     template <typename ValueType>
     void SumNode<ValueType>::Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function)
     {
-        if (IsPureVector(input) && !compiler.GetCompilerParameters().unrollLoops)
+        if (IsPureVector(input) && !compiler.ShouldUnrollLoop(input.Size()))
         {
             CompileLoop(compiler, function);
         }
@@ -60,16 +60,47 @@ namespace nodes
     {
         llvm::Value* pSrcVector = compiler.EnsurePortEmitted(input);
         llvm::Value* pResult = compiler.EnsurePortEmitted(output);
+        auto addOp = emitters::GetAddForValueType<ValueType>();
+
+        // A single accumulator makes the loop-carried add the bottleneck (FPU latency, not
+        // load bandwidth). When fast math allows reassociation, accumulate into several
+        // independent partial sums and combine them after the loop.
+        const int size = (int)input.Size();
+        const int numAccumulators = (compiler.GetCompilerParameters().useFastMath && size >= 8) ? 4 : 1;
+        const int blockedEnd = size - (size % numAccumulators);
+
+        std::vector<llvm::Value*> partialSums;
+        for (int k = 0; k < numAccumulators; ++k)
+        {
+            llvm::Value* partialSum = function.Variable(emitters::GetVariableType<ValueType>(), "partialSum");
+            function.Store(partialSum, function.Literal<ValueType>(0));
+            partialSums.push_back(partialSum);
+        }
 
-        function.Store(pResult, function.Literal(0.0));
         auto forLoop = function.ForLoop();
-        forLoop.Begin(input.Size());
+        forLoop.Begin(0, blockedEnd, numAccumulators);
         {
             auto i = forLoop.LoadIterationVariable();
-            llvm::Value* pValue = function.ValueAt(pSrcVector, i);
-            function.OperationAndUpdate(pResult, emitters::GetAddForValueType<ValueType>(), pValue);
+            for (int k = 0; k < numAccumulators; ++k)
+            {
+                llvm::Value* index = (k == 0) ? i : function.Operator(emitters::TypedOperator::add, i, function.Literal<int>(k));
+                function.OperationAndUpdate(partialSums[k], addOp, function.ValueAt(pSrcVector, index));
+            }
         }
         forLoop.End();
+
+        // Fold any remainder elements into the first partial sum
+        for (int index = blockedEnd; index < size; ++index)
+        {
+            function.OperationAndUpdate(partialSums[0], addOp, function.ValueAt(pSrcVector, function.Literal<int>(index)));
+        }
+
+        llvm::Value* sum = function.Load(partialSums[0]);
+        for (int k = 1; k < numAccumulators; ++k)
+        {
+            sum = function.Operator(addOp, sum, function.Load(partialSums[k]));
+        }
+        function.Store(pResult, sum);
     }
 
     template <typename ValueType>
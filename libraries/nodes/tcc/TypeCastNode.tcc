@@ -30,6 +30,25 @@ namespace nodes
         _output.SetOutput(outputValues);
     }
 
+    template <typename InputValueType, typename OutputValueType>
+    bool TypeCastNode<InputValueType, OutputValueType>::Fold(model::ModelTransformer& transformer) const
+    {
+        std::vector<InputValueType> inputValues;
+        if (!TryGetConstantValues(transformer, _input.GetPortElements(), inputValues))
+        {
+            return false;
+        }
+
+        std::vector<OutputValueType> outputValues(inputValues.size());
+        for (size_t index = 0; index < inputValues.size(); ++index)
+        {
+            outputValues[index] = static_cast<OutputValueType>(inputValues[index]);
+        }
+        auto newNode = transformer.AddNode<ConstantNode<OutputValueType>>(outputValues);
+        transformer.MapNodeOutput(output, newNode->output);
+        return true;
+    }
+
     template <typename InputValueType, typename OutputValueType>
     void TypeCastNode<InputValueType, OutputValueType>::Copy(model::ModelTransformer& transformer) const
     {
@@ -45,22 +64,37 @@ namespace nodes
         auto inputType = emitters::GetVariableType<InputValueType>();
         auto outputType = emitters::GetVariableType<OutputValueType>();
 
-        // TypeCast nodes are currently only scalar. TODO: Fix them to work for vectors as well.
-        VerifyIsScalar(input);
-        VerifyIsScalar(output);
-
-        if (inputType == outputType)
+        if (input.Size() == 1)
         {
-            emitters::Variable* elementVar = compiler.GetVariableForElement(input.GetInputElement(0));
-            compiler.SetVariableForPort(output, elementVar); // The types are the same, so this is a no-op. Just set the output variable to be the same as the input variable
+            if (inputType == outputType)
+            {
+                emitters::Variable* elementVar = compiler.GetVariableForElement(input.GetInputElement(0));
+                compiler.SetVariableForPort(output, elementVar); // The types are the same, so this is a no-op. Just set the output variable to be the same as the input variable
+            }
+            else
+            {
+                llvm::Value* inputValue = compiler.LoadPortElementVariable(input.GetInputElement(0));
+                llvm::Value* outputValue = compiler.EnsurePortEmitted(output);
+
+                llvm::Value* castElement = function.CastValue<InputValueType, OutputValueType>(inputValue);
+                function.Store(outputValue, castElement);
+            }
         }
         else
         {
-            llvm::Value* inputValue = compiler.LoadPortElementVariable(input.GetInputElement(0));
-            llvm::Value* outputValue = compiler.EnsurePortEmitted(output);
+            // Vector casts convert each element as it is loaded and store it straight into the
+            // output port, rather than materializing a converted copy in a separate buffer
+            llvm::Value* pInput = compiler.EnsurePortEmitted(input);
+            llvm::Value* pResult = compiler.EnsurePortEmitted(output);
 
-            llvm::Value* castElement = function.CastValue<InputValueType, OutputValueType>(inputValue);
-            function.Store(outputValue, castElement);
+            auto loop = function.ForLoop();
+            loop.Begin(static_cast<int>(input.Size()));
+            {
+                auto i = loop.LoadIterationVariable();
+                auto inputValue = function.ValueAt(pInput, i);
+                function.SetValueAt(pResult, i, function.CastValue<InputValueType, OutputValueType>(inputValue));
+            }
+            loop.End();
         }
     }
 
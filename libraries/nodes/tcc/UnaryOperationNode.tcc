@@ -45,53 +45,57 @@ namespace nodes
             throw utilities::InputException(utilities::InputExceptionErrors::indexOutOfRange, "Unknown unary operation");
         }
 
+        // The operations are stateless functor types, so the per-element call in ComputeOutput
+        // compiles down to raw arithmetic; the operation enum is only consulted once per
+        // evaluation (and at archive boundaries)
+
         template <typename ValueType>
-        ValueType Sqrt(ValueType a)
+        struct Sqrt
         {
-            return std::sqrt(a);
-        }
+            ValueType operator()(ValueType a) const { return std::sqrt(a); }
+        };
 
         template <>
-        inline bool Sqrt(bool x)
+        struct Sqrt<bool>
         {
-            throw utilities::InputException(utilities::InputExceptionErrors::typeMismatch, "Error: taking sqrt of a boolean value");
-        }
+            bool operator()(bool) const { throw utilities::InputException(utilities::InputExceptionErrors::typeMismatch, "Error: taking sqrt of a boolean value"); }
+        };
 
         template <typename ValueType>
-        ValueType LogicalNot(ValueType a)
+        struct LogicalNot
         {
-            throw utilities::InputException(utilities::InputExceptionErrors::typeMismatch, "Error: taking not of a non-boolean value");
-        }
+            ValueType operator()(ValueType) const { throw utilities::InputException(utilities::InputExceptionErrors::typeMismatch, "Error: taking not of a non-boolean value"); }
+        };
 
         template <>
-        inline bool LogicalNot(bool x)
+        struct LogicalNot<bool>
         {
-            return !x;
-        }
+            bool operator()(bool x) const { return !x; }
+        };
 
         template <typename ValueType>
-        ValueType Tanh(ValueType a)
+        struct Tanh
         {
-            return std::tanh(a);
-        }
+            ValueType operator()(ValueType a) const { return std::tanh(a); }
+        };
 
         template <>
-        inline bool Tanh(bool x)
+        struct Tanh<bool>
         {
-            throw utilities::InputException(utilities::InputExceptionErrors::typeMismatch, "Error: taking tanh of a boolean value");
-        }
+            bool operator()(bool) const { throw utilities::InputException(utilities::InputExceptionErrors::typeMismatch, "Error: taking tanh of a boolean value"); }
+        };
 
         template <typename ValueType>
-        ValueType Exp(ValueType a)
+        struct Exp
         {
-            return std::exp(a);
-        }
+            ValueType operator()(ValueType a) const { return std::exp(a); }
+        };
 
         template <>
-        inline bool Exp(bool x)
+        struct Exp<bool>
         {
-            throw utilities::InputException(utilities::InputExceptionErrors::typeMismatch, "Error: taking exp of a boolean value");
-        }
+            bool operator()(bool) const { throw utilities::InputException(utilities::InputExceptionErrors::typeMismatch, "Error: taking exp of a boolean value"); }
+        };
     }
 
     template <typename ValueType>
@@ -108,49 +112,54 @@ namespace nodes
 
     template <typename ValueType>
     template <typename Operation>
-    std::vector<ValueType> UnaryOperationNode<ValueType>::ComputeOutput(Operation&& function) const
+    std::vector<ValueType> UnaryOperationNode<ValueType>::ComputeOutput(Operation&& function, const std::vector<ValueType>& inputValues)
     {
-        auto output = std::vector<ValueType>(_input.Size());
-        for (size_t index = 0; index < _input.Size(); index++)
+        auto output = std::vector<ValueType>(inputValues.size());
+        for (size_t index = 0; index < inputValues.size(); index++)
         {
-            output[index] = function(_input[index]);
+            output[index] = function(inputValues[index]);
         }
         return output;
     }
 
     template <typename ValueType>
-    void UnaryOperationNode<ValueType>::Compute() const
+    std::vector<ValueType> UnaryOperationNode<ValueType>::ComputeOutput(const std::vector<ValueType>& inputValues) const
     {
-        std::vector<ValueType> output;
         switch (_operation)
         {
             case emitters::UnaryOperationType::sqrt:
-            {
-                output = ComputeOutput(UnaryOperations::Sqrt<ValueType>);
-            }
-            break;
+                return ComputeOutput(UnaryOperations::Sqrt<ValueType>(), inputValues);
             case emitters::UnaryOperationType::logicalNot:
-            {
-                output = ComputeOutput(UnaryOperations::LogicalNot<ValueType>);
-            }
-            break;
+                return ComputeOutput(UnaryOperations::LogicalNot<ValueType>(), inputValues);
             case emitters::UnaryOperationType::exp:
-            {
-                output = ComputeOutput(UnaryOperations::Exp<ValueType>);
-            }
-            break;
+                return ComputeOutput(UnaryOperations::Exp<ValueType>(), inputValues);
             case emitters::UnaryOperationType::tanh:
-            {
-                output = ComputeOutput(UnaryOperations::Tanh<ValueType>);
-            }
-            break;
-
+                return ComputeOutput(UnaryOperations::Tanh<ValueType>(), inputValues);
             default:
                 throw utilities::LogicException(utilities::LogicExceptionErrors::notImplemented, "Unknown operation type");
         }
-        _output.SetOutput(output);
+    }
+
+    template <typename ValueType>
+    void UnaryOperationNode<ValueType>::Compute() const
+    {
+        _output.SetOutput(ComputeOutput(_input.GetValue()));
     };
 
+    template <typename ValueType>
+    bool UnaryOperationNode<ValueType>::Fold(model::ModelTransformer& transformer) const
+    {
+        std::vector<ValueType> inputValues;
+        if (!TryGetConstantValues(transformer, _input.GetPortElements(), inputValues))
+        {
+            return false;
+        }
+
+        auto newNode = transformer.AddNode<ConstantNode<ValueType>>(ComputeOutput(inputValues));
+        transformer.MapNodeOutput(output, newNode->output);
+        return true;
+    }
+
     template <typename ValueType>
     void UnaryOperationNode<ValueType>::Copy(model::ModelTransformer& transformer) const
     {
@@ -177,7 +186,7 @@ namespace nodes
     template <typename ValueType>
     void UnaryOperationNode<ValueType>::Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function)
     {
-        if (IsPureVector(input) && !compiler.GetCompilerParameters().unrollLoops)
+        if (IsPureVector(input) && !compiler.ShouldUnrollLoop(input.Size()))
         {
             CompileLoop(compiler, function);
         }
@@ -206,6 +215,24 @@ namespace nodes
         forLoop.End();
     }
 
+    template <typename ValueType>
+    bool UnaryOperationNode<ValueType>::IsElementwise() const
+    {
+        return IsPureVector(input);
+    }
+
+    template <typename ValueType>
+    llvm::Value* UnaryOperationNode<ValueType>::CompileElementwise(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function, llvm::Value* index, llvm::Value* chainValue)
+    {
+        llvm::Value* inputValue = chainValue;
+        if (inputValue == nullptr)
+        {
+            llvm::Value* pInput = compiler.EnsurePortEmitted(input);
+            inputValue = function.ValueAt(pInput, index);
+        }
+        return function.Call(GetOperator(function), { inputValue });
+    }
+
     template <typename ValueType>
     void UnaryOperationNode<ValueType>::CompileExpanded(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function)
     {
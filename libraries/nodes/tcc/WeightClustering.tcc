@@ -0,0 +1,117 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     WeightClustering.tcc (nodes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// utilities
+#include "Exception.h"
+
+// stl
+#include <algorithm>
+#include <cmath>
+
+namespace ell
+{
+namespace nodes
+{
+    template <typename ValueType>
+    WeightCodebook<ValueType> ClusterWeights(const std::vector<ValueType>& values, size_t numClusters)
+    {
+        const size_t maxIterations = 32;
+
+        if (numClusters == 0 || numClusters > 256)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "numClusters must be between 1 and 256");
+        }
+        if (values.empty())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "can't cluster an empty set of weights");
+        }
+
+        std::vector<ValueType> sorted(values);
+        std::sort(sorted.begin(), sorted.end());
+
+        // initialize the centers at evenly spaced quantiles of the sorted weights
+        std::vector<double> centers(numClusters);
+        for (size_t c = 0; c < numClusters; ++c)
+        {
+            centers[c] = sorted[((2 * c + 1) * sorted.size()) / (2 * numClusters)];
+        }
+
+        // Lloyd iterations; in one dimension the cluster boundaries are simply the midpoints
+        // between consecutive centers, so each pass is a single walk over the sorted weights
+        std::vector<double> sums(numClusters);
+        std::vector<size_t> counts(numClusters);
+        for (size_t iteration = 0; iteration < maxIterations; ++iteration)
+        {
+            std::fill(sums.begin(), sums.end(), 0.0);
+            std::fill(counts.begin(), counts.end(), 0);
+
+            size_t cluster = 0;
+            for (auto value : sorted)
+            {
+                while (cluster + 1 < numClusters && value > (centers[cluster] + centers[cluster + 1]) / 2)
+                {
+                    ++cluster;
+                }
+                sums[cluster] += value;
+                ++counts[cluster];
+            }
+
+            bool changed = false;
+            for (size_t c = 0; c < numClusters; ++c)
+            {
+                if (counts[c] == 0)
+                {
+                    continue; // empty cluster: keep its center
+                }
+                double newCenter = sums[c] / counts[c];
+                if (newCenter != centers[c])
+                {
+                    centers[c] = newCenter;
+                    changed = true;
+                }
+            }
+            if (!changed)
+            {
+                break;
+            }
+        }
+
+        WeightCodebook<ValueType> result;
+        result.codebook.reserve(numClusters);
+        for (auto center : centers)
+        {
+            result.codebook.push_back(static_cast<ValueType>(center));
+        }
+
+        // assign each weight (in its original order) to the nearest codebook value and measure the
+        // error against the codebook (not the double-precision centers), since that is what the
+        // compiled model will actually use
+        result.indices.reserve(values.size());
+        double totalError = 0;
+        for (auto value : values)
+        {
+            size_t best = 0;
+            double bestDistance = std::abs(static_cast<double>(value) - static_cast<double>(result.codebook[0]));
+            for (size_t c = 1; c < numClusters; ++c)
+            {
+                double distance = std::abs(static_cast<double>(value) - static_cast<double>(result.codebook[c]));
+                if (distance < bestDistance)
+                {
+                    bestDistance = distance;
+                    best = c;
+                }
+            }
+            result.indices.push_back(static_cast<uint8_t>(best));
+            totalError += bestDistance;
+            result.maxAbsoluteError = std::max(result.maxAbsoluteError, bestDistance);
+        }
+        result.meanAbsoluteError = totalError / values.size();
+        return result;
+    }
+}
+}
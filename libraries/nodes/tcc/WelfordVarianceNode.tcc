@@ -0,0 +1,108 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     WelfordVarianceNode.tcc (nodes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ell
+{
+namespace nodes
+{
+    template <typename ValueType>
+    WelfordVarianceNode<ValueType>::WelfordVarianceNode()
+        : CompilableNode({ &_input }, { &_output }), _input(this, {}, inputPortName), _output(this, outputPortName, 0)
+    {
+    }
+
+    template <typename ValueType>
+    WelfordVarianceNode<ValueType>::WelfordVarianceNode(const model::PortElements<ValueType>& input)
+        : CompilableNode({ &_input }, { &_output }), _input(this, input, inputPortName), _output(this, outputPortName, _input.Size())
+    {
+        auto dimension = _input.Size();
+        _mean = std::vector<ValueType>(dimension);
+        _m2 = std::vector<ValueType>(dimension);
+    }
+
+    template <typename ValueType>
+    void WelfordVarianceNode<ValueType>::Compute() const
+    {
+        _count += 1;
+        std::vector<ValueType> result(_input.Size());
+        for (size_t index = 0; index < _input.Size(); ++index)
+        {
+            auto value = _input[index];
+            auto delta = value - _mean[index];
+            _mean[index] += delta / _count;
+            _m2[index] += delta * (value - _mean[index]);
+            result[index] = _m2[index] / _count;
+        }
+        _output.SetOutput(result);
+    };
+
+    template <typename ValueType>
+    void WelfordVarianceNode<ValueType>::Copy(model::ModelTransformer& transformer) const
+    {
+        auto newPortElements = transformer.TransformPortElements(_input.GetPortElements());
+        auto newNode = transformer.AddNode<WelfordVarianceNode<ValueType>>(newPortElements);
+        transformer.MapNodeOutput(output, newNode->output);
+    }
+
+    template <typename ValueType>
+    void WelfordVarianceNode<ValueType>::Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function)
+    {
+        static_assert(std::is_floating_point<ValueType>(), "WelfordVarianceNode requires a floating-point value type");
+
+        llvm::Value* inputVector = compiler.EnsurePortEmitted(input);
+        llvm::Value* result = compiler.EnsurePortEmitted(output);
+
+        // The sample count and per-element moments live in globals; the count is kept as a
+        // ValueType so the recurrence needs no int-to-float conversions
+        emitters::Variable* pCountVar = function.GetModule().Variables().AddVariable<emitters::InitializedScalarVariable<ValueType>>(emitters::VariableScope::global, static_cast<ValueType>(0));
+        emitters::Variable* pMeanVar = function.GetModule().Variables().AddVariable<emitters::InitializedVectorVariable<ValueType>>(emitters::VariableScope::global, output.Size());
+        emitters::Variable* pM2Var = function.GetModule().Variables().AddVariable<emitters::InitializedVectorVariable<ValueType>>(emitters::VariableScope::global, output.Size());
+        llvm::Value* count = function.GetModule().EnsureEmitted(*pCountVar);
+        llvm::Value* mean = function.GetModule().EnsureEmitted(*pMeanVar);
+        llvm::Value* m2 = function.GetModule().EnsureEmitted(*pM2Var);
+
+        llvm::Value* newCount = function.Operator(emitters::GetAddForValueType<ValueType>(), function.Load(count), function.Literal(static_cast<ValueType>(1)));
+        function.Store(count, newCount);
+
+        auto forLoop = function.ForLoop();
+        forLoop.Begin(output.Size());
+        {
+            auto i = forLoop.LoadIterationVariable();
+            llvm::Value* value = function.ValueAt(inputVector, i);
+            llvm::Value* delta = function.Operator(emitters::GetSubtractForValueType<ValueType>(), value, function.ValueAt(mean, i));
+            llvm::Value* newMean = function.Operator(emitters::GetAddForValueType<ValueType>(), function.ValueAt(mean, i), function.Operator(emitters::GetDivideForValueType<ValueType>(), delta, newCount));
+            function.SetValueAt(mean, i, newMean);
+            llvm::Value* delta2 = function.Operator(emitters::GetSubtractForValueType<ValueType>(), value, newMean);
+            llvm::Value* newM2 = function.Operator(emitters::GetAddForValueType<ValueType>(), function.ValueAt(m2, i), function.Operator(emitters::GetMultiplyForValueType<ValueType>(), delta, delta2));
+            function.SetValueAt(m2, i, newM2);
+            function.SetValueAt(result, i, function.Operator(emitters::GetDivideForValueType<ValueType>(), newM2, newCount));
+        }
+        forLoop.End();
+    }
+
+    template <typename ValueType>
+    void WelfordVarianceNode<ValueType>::WriteToArchive(utilities::Archiver& archiver) const
+    {
+        Node::WriteToArchive(archiver);
+        archiver[inputPortName] << _input;
+    }
+
+    template <typename ValueType>
+    void WelfordVarianceNode<ValueType>::ReadFromArchive(utilities::Unarchiver& archiver)
+    {
+        Node::ReadFromArchive(archiver);
+        archiver[inputPortName] >> _input;
+
+        auto dimension = _input.Size();
+        _count = 0;
+        _mean = std::vector<ValueType>(dimension);
+        _m2 = std::vector<ValueType>(dimension);
+        _output.SetSize(dimension);
+    }
+}
+}
@@ -0,0 +1,118 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     WindowFunctionNode.tcc (nodes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// stl
+#include <cmath>
+
+namespace ell
+{
+namespace nodes
+{
+    template <typename ValueType>
+    WindowFunctionNode<ValueType>::WindowFunctionNode(const model::PortElements<ValueType>& input, WindowShape windowShape)
+        : CompilableNode({ &_input }, { &_output }), _input(this, input, inputPortName), _output(this, outputPortName, input.Size()), _windowShape(windowShape)
+    {
+        ComputeCoefficients();
+    }
+
+    template <typename ValueType>
+    WindowFunctionNode<ValueType>::WindowFunctionNode()
+        : CompilableNode({ &_input }, { &_output }), _input(this, {}, inputPortName), _output(this, outputPortName, 0)
+    {
+    }
+
+    template <typename ValueType>
+    void WindowFunctionNode<ValueType>::ComputeCoefficients()
+    {
+        const double pi = 3.141592653589793238;
+        auto size = _input.Size();
+        _coefficients.resize(size);
+        if (size == 1)
+        {
+            _coefficients[0] = static_cast<ValueType>(1);
+            return;
+        }
+
+        for (size_t index = 0; index < size; ++index)
+        {
+            double phase = std::cos(2.0 * pi * index / (size - 1));
+            switch (_windowShape)
+            {
+                case WindowShape::hann:
+                    _coefficients[index] = static_cast<ValueType>(0.5 - 0.5 * phase);
+                    break;
+                case WindowShape::hamming:
+                    _coefficients[index] = static_cast<ValueType>(0.54 - 0.46 * phase);
+                    break;
+            }
+        }
+    }
+
+    template <typename ValueType>
+    void WindowFunctionNode<ValueType>::Compute() const
+    {
+        auto inputValues = _input.GetValue();
+        std::vector<ValueType> result(inputValues.size());
+        for (size_t index = 0; index < inputValues.size(); ++index)
+        {
+            result[index] = inputValues[index] * _coefficients[index];
+        }
+        _output.SetOutput(result);
+    };
+
+    template <typename ValueType>
+    void WindowFunctionNode<ValueType>::Copy(model::ModelTransformer& transformer) const
+    {
+        auto newPortElements = transformer.TransformPortElements(_input.GetPortElements());
+        auto newNode = transformer.AddNode<WindowFunctionNode<ValueType>>(newPortElements, _windowShape);
+        transformer.MapNodeOutput(output, newNode->output);
+    }
+
+    template <typename ValueType>
+    void WindowFunctionNode<ValueType>::Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function)
+    {
+        llvm::Value* pInput = compiler.EnsurePortEmitted(input);
+        llvm::Value* pResult = compiler.EnsurePortEmitted(output);
+
+        // The coefficients are constants, emitted like ConstantNode's values
+        emitters::Variable* coefficientsVar = function.GetModule().Variables().AddVariable<emitters::LiteralVectorVariable<ValueType>>(_coefficients);
+        llvm::Value* pCoefficients = function.GetModule().EnsureEmitted(*coefficientsVar);
+
+        auto count = input.Size();
+        auto forLoop = function.ForLoop();
+        forLoop.Begin(0, (int)count, 1);
+        {
+            auto i = forLoop.LoadIterationVariable();
+            llvm::Value* inputValue = function.ValueAt(pInput, i);
+            llvm::Value* tapered = function.Operator(emitters::GetMultiplyForValueType<ValueType>(), inputValue, function.ValueAt(pCoefficients, i));
+            function.SetValueAt(pResult, i, tapered);
+        }
+        forLoop.End();
+    }
+
+    template <typename ValueType>
+    void WindowFunctionNode<ValueType>::WriteToArchive(utilities::Archiver& archiver) const
+    {
+        Node::WriteToArchive(archiver);
+        archiver[inputPortName] << _input;
+        archiver["windowShape"] << static_cast<int>(_windowShape);
+    }
+
+    template <typename ValueType>
+    void WindowFunctionNode<ValueType>::ReadFromArchive(utilities::Unarchiver& archiver)
+    {
+        Node::ReadFromArchive(archiver);
+        archiver[inputPortName] >> _input;
+        int windowShape = 0;
+        archiver["windowShape"] >> windowShape;
+        _windowShape = static_cast<WindowShape>(windowShape);
+        _output.SetSize(_input.Size());
+        ComputeCoefficients();
+    }
+}
+}
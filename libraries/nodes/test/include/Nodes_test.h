@@ -11,16 +11,26 @@
 void TestL2NormNodeCompute();
 void TestAccumulatorNodeCompute();
 void TestDelayNodeCompute();
+void TestBufferNodeCompute();
+void TestInputNormalizationNodeCompute();
+void TestWindowFunctionNodeCompute();
 void TestMovingAverageNodeCompute();
 void TestMovingVarianceNodeCompute();
+void TestExponentialMovingAverageNodeCompute();
+void TestWelfordVarianceNodeCompute();
+void TestQuantileEstimatorNodeCompute();
+void TestMovingExtremumNodeCompute();
 void TestUnaryOperationNodeCompute();
 void TestUnaryOperationNodeCompute1();
 void TestBinaryOperationNodeCompute();
 void TestLinearPredictorNodeCompute();
 void TestDemultiplexerNodeCompute();
 void TestDTWDistanceNodeCompute();
+void TestWeightClustering();
 void TestSourceNodeCompute();
 void TestSinkNodeCompute();
+void TestConfidenceGateNodeCompute();
+void TestReorderDataNodeCompute();
 
 // Refinement
 void TestMovingAverageNodeRefine();
@@ -14,21 +14,31 @@
 #include "BatchNormalizationLayerNode.h"
 #include "BiasLayerNode.h"
 #include "BinaryOperationNode.h"
+#include "BufferNode.h"
 #include "DTWDistanceNode.h"
 #include "DelayNode.h"
 #include "DemultiplexerNode.h"
 #include "ForestPredictorNode.h"
+#include "InputNormalizationNode.h"
 #include "L2NormNode.h"
 #include "LinearPredictorNode.h"
+#include "ConfidenceGateNode.h"
+#include "ExponentialMovingAverageNode.h"
 #include "MatrixVectorProductNode.h"
 #include "MovingAverageNode.h"
+#include "MovingExtremumNode.h"
 #include "MovingVarianceNode.h"
+#include "QuantileEstimatorNode.h"
+#include "ReorderDataNode.h"
+#include "WelfordVarianceNode.h"
 #include "NeuralNetworkLayerNode.h"
 #include "NeuralNetworkPredictorNode.h"
 #include "ProtoNNPredictorNode.h"
 #include "SinkNode.h"
 #include "SourceNode.h"
+#include "WeightClustering.h"
 #include "UnaryOperationNode.h"
+#include "WindowFunctionNode.h"
 
 // model
 #include "InputNode.h"
@@ -52,6 +62,7 @@
 #include <chrono>
 #include <cmath>
 #include <iostream>
+#include <numeric>
 #include <sstream>
 #include <string>
 #include <thread>
@@ -174,6 +185,66 @@ void TestDelayNodeCompute()
     }
 }
 
+void TestBufferNodeCompute()
+{
+    const int windowSize = 3;
+
+    model::Model model;
+    auto inputNode = model.AddNode<model::InputNode<double>>(2);
+    auto outputNode = model.AddNode<nodes::BufferNode<double>>(inputNode->output, windowSize);
+
+    std::vector<std::vector<double>> data = { { 1, 2 }, { 3, 4 }, { 5, 6 }, { 7, 8 } };
+
+    std::vector<double> outputVec;
+
+    for (size_t index = 0; index < data.size(); ++index)
+    {
+        inputNode->SetInput(data[index]);
+        outputVec = model.ComputeOutput(outputNode->output);
+    }
+
+    // After 4 samples, the 3-sample window holds samples 1..3, oldest first
+    std::vector<double> expected = { 3, 4, 5, 6, 7, 8 };
+    testing::ProcessTest("Testing BufferNode compute", testing::IsEqual(outputVec, expected));
+}
+
+void TestInputNormalizationNodeCompute()
+{
+    model::Model model;
+    auto inputNode = model.AddNode<model::InputNode<double>>(3);
+    std::vector<double> mean = { 1.0, 2.0, 3.0 };
+    std::vector<double> inverseStdDev = { 2.0, 0.5, 1.0 };
+    auto outputNode = model.AddNode<nodes::InputNormalizationNode<double>>(inputNode->output, mean, inverseStdDev);
+
+    std::vector<double> input = { 2.0, 6.0, 1.0 };
+    inputNode->SetInput(input);
+    auto outputVec = model.ComputeOutput(outputNode->output);
+
+    std::vector<double> expected = { 2.0, 2.0, -2.0 }; // (x - mean) * inverseStdDev
+    testing::ProcessTest("Testing InputNormalizationNode compute", testing::IsEqual(outputVec, expected));
+}
+
+void TestWindowFunctionNodeCompute()
+{
+    const size_t size = 5;
+
+    model::Model model;
+    auto inputNode = model.AddNode<model::InputNode<double>>(size);
+    auto outputNode = model.AddNode<nodes::WindowFunctionNode<double>>(inputNode->output, nodes::WindowShape::hann);
+
+    std::vector<double> input(size, 1.0);
+    inputNode->SetInput(input);
+    auto outputVec = model.ComputeOutput(outputNode->output);
+
+    const double pi = 3.141592653589793238;
+    std::vector<double> expected(size);
+    for (size_t index = 0; index < size; ++index)
+    {
+        expected[index] = 0.5 - 0.5 * std::cos(2.0 * pi * index / (size - 1));
+    }
+    testing::ProcessTest("Testing WindowFunctionNode compute", testing::IsEqual(outputVec, expected));
+}
+
 void TestMovingAverageNodeCompute()
 {
     const int windowSize = 4;
@@ -217,6 +288,89 @@ void TestMovingVarianceNodeCompute()
     testing::ProcessTest("Testing MovingVarianceNode compute", testing::IsEqual(outputVec[0], expectedOutput));
 }
 
+void TestExponentialMovingAverageNodeCompute()
+{
+    const double smoothing = 0.5;
+
+    model::Model model;
+    auto inputNode = model.AddNode<model::InputNode<double>>(1);
+    auto outputNode = model.AddNode<nodes::ExponentialMovingAverageNode<double>>(inputNode->output, smoothing);
+
+    std::vector<std::vector<double>> data = { { 2 }, { 4 }, { 6 } };
+    // ewma after each sample: 1, 2.5, 4.75
+    double expectedOutput = 4.75;
+
+    std::vector<double> outputVec;
+
+    for (const auto& inputValue : data)
+    {
+        inputNode->SetInput(inputValue);
+        outputVec = model.ComputeOutput(outputNode->output);
+    }
+    testing::ProcessTest("Testing ExponentialMovingAverageNode compute", testing::IsEqual(outputVec[0], expectedOutput));
+}
+
+void TestWelfordVarianceNodeCompute()
+{
+    model::Model model;
+    auto inputNode = model.AddNode<model::InputNode<double>>(1);
+    auto outputNode = model.AddNode<nodes::WelfordVarianceNode<double>>(inputNode->output);
+
+    std::vector<std::vector<double>> data = { { 1 }, { 2 }, { 3 }, { 4 }, { 5 }, { 6 }, { 7 }, { 8 }, { 9 }, { 10 } };
+    double mean = VectorMean({ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0 });
+    double expectedOutput = VectorVariance({ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0 }, mean);
+
+    std::vector<double> outputVec;
+
+    for (const auto& inputValue : data)
+    {
+        inputNode->SetInput(inputValue);
+        outputVec = model.ComputeOutput(outputNode->output);
+    }
+    testing::ProcessTest("Testing WelfordVarianceNode compute", testing::IsEqual(outputVec[0], expectedOutput));
+}
+
+void TestQuantileEstimatorNodeCompute()
+{
+    const double quantile = 0.5;
+
+    model::Model model;
+    auto inputNode = model.AddNode<model::InputNode<double>>(1);
+    auto outputNode = model.AddNode<nodes::QuantileEstimatorNode<double>>(inputNode->output, quantile);
+
+    // feed a deterministic sawtooth over [0, 100); the median estimate should settle near 50
+    std::vector<double> outputVec;
+    for (int index = 0; index < 1000; ++index)
+    {
+        inputNode->SetInput(std::vector<double>{ static_cast<double>((index * 37) % 100) });
+        outputVec = model.ComputeOutput(outputNode->output);
+    }
+    testing::ProcessTest("Testing QuantileEstimatorNode compute", std::abs(outputVec[0] - 50.0) < 5.0);
+}
+
+void TestMovingExtremumNodeCompute()
+{
+    const int windowSize = 3;
+
+    model::Model model;
+    auto inputNode = model.AddNode<model::InputNode<double>>(1);
+    auto maxNode = model.AddNode<nodes::MovingMaxNode<double>>(inputNode->output, windowSize);
+    auto minNode = model.AddNode<nodes::MovingMinNode<double>>(inputNode->output, windowSize);
+
+    std::vector<std::vector<double>> data = { { 5 }, { 2 }, { 4 }, { 3 }, { 1 }, { 6 } };
+    std::vector<double> expectedMax = { 5, 5, 5, 4, 4, 6 };
+    std::vector<double> expectedMin = { 5, 2, 2, 2, 1, 1 };
+
+    for (size_t index = 0; index < data.size(); ++index)
+    {
+        inputNode->SetInput(data[index]);
+        auto maxVec = model.ComputeOutput(maxNode->output);
+        auto minVec = model.ComputeOutput(minNode->output);
+        testing::ProcessTest("Testing MovingMaxNode compute", testing::IsEqual(maxVec[0], expectedMax[index]));
+        testing::ProcessTest("Testing MovingMinNode compute", testing::IsEqual(minVec[0], expectedMin[index]));
+    }
+}
+
 void TestUnaryOperationNodeCompute()
 {
     std::vector<std::vector<double>> data = { { 1 }, { 2 }, { 3 }, { 4 }, { 5 }, { 6 }, { 7 }, { 8 }, { 9 }, { 10 } };
@@ -388,6 +542,56 @@ void TestSinkNodeCompute()
     testing::ProcessTest("Testing SinkNode output", testing::IsEqual(data, results));
 }
 
+void TestConfidenceGateNodeCompute()
+{
+    model::Model model;
+    auto scoreNode = model.AddNode<model::InputNode<double>>(1);
+    auto featuresNode = model.AddNode<model::InputNode<double>>(3);
+    auto defaultNode = model.AddNode<model::InputNode<double>>(2);
+    auto gateNode = model.AddNode<nodes::ConfidenceGateNode<double>>(scoreNode->output, featuresNode->output, defaultNode->output, 0.9,
+        [](const std::vector<double>& features, std::vector<double>& result) {
+            result[0] = features[0] + features[1] + features[2];
+            result[1] = features[0];
+        });
+
+    featuresNode->SetInput(std::vector<double>{ 1, 2, 3 });
+    defaultNode->SetInput(std::vector<double>{ 0.25, 0.75 });
+
+    // confident: the first stage's result passes through untouched
+    scoreNode->SetInput(std::vector<double>{ 0.95 });
+    auto confident = model.ComputeOutput(gateNode->output);
+    testing::ProcessTest("Testing ConfidenceGateNode confident output", testing::IsEqual(confident, std::vector<double>{ 0.25, 0.75 }));
+
+    // not confident: the second stage runs on the shared features
+    scoreNode->SetInput(std::vector<double>{ 0.5 });
+    auto deferred = model.ComputeOutput(gateNode->output);
+    testing::ProcessTest("Testing ConfidenceGateNode gated output", testing::IsEqual(deferred, std::vector<double>{ 6, 1 }));
+}
+
+void TestReorderDataNodeCompute()
+{
+    // a 2x2 image stored with 1 element of zero-padding around the row and column dimensions,
+    // reordered to a dense (unpadded) 2x2 output
+    nodes::DataShape inputShape({ 2, 2, 1 }, { 1, 1, 0 });
+    nodes::DataShape outputShape({ 2, 2, 1 });
+
+    model::Model model;
+    auto inputNode = model.AddNode<model::InputNode<double>>(inputShape.GetMemorySize());
+    auto reorderNode = model.AddNode<nodes::ReorderDataNode<double>>(inputNode->output, inputShape, outputShape);
+
+    std::vector<double> inputValues(inputShape.GetMemorySize());
+    std::iota(inputValues.begin(), inputValues.end(), 0.0);
+    inputNode->SetInput(inputValues);
+    auto result = model.ComputeOutput(reorderNode->output);
+    testing::ProcessTest("Testing ReorderDataNode compute", testing::IsEqual(result, std::vector<double>{ 5, 6, 9, 10 }));
+
+    // padding covers the walk, so no location can be out of bounds; an unpadded input that is
+    // smaller than the walked extents can be
+    testing::ProcessTest("Testing DataShape::IsAlwaysInBounds", inputShape.IsAlwaysInBounds(outputShape));
+    nodes::DataShape smallShape({ 1, 1, 1 });
+    testing::ProcessTest("Testing DataShape::IsAlwaysInBounds small input", !smallShape.IsAlwaysInBounds(outputShape));
+}
+
 //
 // Node refinements
 //
@@ -661,3 +865,36 @@ void TestProtoNNPredictorNode()
     testing::ProcessTest("Testing protonnPredictor node refine", testing::IsEqual(refinedLabelOutput, computeLabelOutput));
     testing::ProcessTest("Testing protonnPredictor node refine", testing::IsEqual(refinedScoreOutput, computeScoreOutput));
 }
+
+void TestWeightClustering()
+{
+    // weights drawn from two well-separated values plus small noise: a 16-entry codebook should
+    // represent them almost exactly
+    std::vector<double> weights;
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        double base = (i % 2 == 0) ? -1.0 : 1.0;
+        weights.push_back(base + 1.0e-4 * (i % 7));
+    }
+
+    auto clustering = nodes::ClusterWeights(weights, 16);
+    auto packed = nodes::PackWeightIndices(clustering.indices, 4);
+
+    bool indicesValid = clustering.indices.size() == weights.size();
+    for (auto index : clustering.indices)
+    {
+        if (index >= clustering.codebook.size()) indicesValid = false;
+    }
+
+    // unpack and verify the packed representation round-trips
+    bool packValid = packed.size() == (weights.size() + 7) / 8;
+    for (size_t i = 0; i < weights.size(); ++i)
+    {
+        int index = (packed[i / 8] >> ((i % 8) * 4)) & 0xF;
+        if (index != clustering.indices[i]) packValid = false;
+    }
+
+    testing::ProcessTest("Testing weight clustering indices", indicesValid);
+    testing::ProcessTest("Testing weight clustering packing", packValid);
+    testing::ProcessTest("Testing weight clustering error", clustering.maxAbsoluteError < 1.0e-3);
+}
@@ -32,16 +32,26 @@ int main()
         TestL2NormNodeCompute();
         TestAccumulatorNodeCompute();
         TestDelayNodeCompute();
+        TestBufferNodeCompute();
+        TestInputNormalizationNodeCompute();
+        TestWindowFunctionNodeCompute();
         TestMovingAverageNodeCompute();
         TestMovingVarianceNodeCompute();
+        TestExponentialMovingAverageNodeCompute();
+        TestWelfordVarianceNodeCompute();
+        TestQuantileEstimatorNodeCompute();
+        TestMovingExtremumNodeCompute();
         TestUnaryOperationNodeCompute();
         TestUnaryOperationNodeCompute1();
         TestBinaryOperationNodeCompute();
         TestLinearPredictorNodeCompute();
         TestDemultiplexerNodeCompute();
         TestDTWDistanceNodeCompute();
+        TestWeightClustering();
         TestSourceNodeCompute();
         TestSinkNodeCompute();
+        TestConfidenceGateNodeCompute();
+        TestReorderDataNodeCompute();
 
         TestBiasLayerNode();
         TestBatchNormalizationLayerNode();
@@ -22,6 +22,7 @@
 #include <algorithm>
 #include <functional>
 #include <iterator>
+#include <utility>
 #include <vector>
 
 namespace ell
@@ -264,6 +265,27 @@ namespace predictors
         /// <returns> The prediction. </returns>
         double Predict(const DataVectorType& input, size_t interiorNodeIndex) const;
 
+        /// <summary> Returns a value with the same sign as Predict(input), evaluating the trees in
+        /// order and stopping as soon as the trees not yet evaluated cannot flip the sign of the
+        /// running sum. Uses lazily computed per-suffix output bounds, so for binary decisions most
+        /// inputs are decided after a fraction of the trees. The returned value equals the full
+        /// prediction only when no early exit occurs. Requires edge predictors whose output is
+        /// independent of the input (e.g. ConstantPredictor). </summary>
+        ///
+        /// <param name="input"> The input vector. </param>
+        ///
+        /// <returns> A value whose sign matches the sign of Predict(input). </returns>
+        double PredictSign(const DataVectorType& input) const;
+
+        /// <summary> Returns the output of the forest for a whole batch of inputs. The traversal
+        /// is tree-major: each tree is walked across the full batch before moving to the next, so
+        /// a tree's nodes stay cache-hot instead of the whole forest being paged through per
+        /// example. </summary>
+        ///
+        /// <param name="inputs"> The input vectors. </param>
+        /// <param name="outputs"> The vector that receives one prediction per input; resized to match. </param>
+        void PredictBatch(const std::vector<DataVectorType>& inputs, std::vector<double>& outputs) const;
+
         /// <summary> Generates the edge path indicator vector of the entire forest. </summary>
         ///
         /// <param name="input"> The input vector. </param>
@@ -363,6 +385,12 @@ namespace predictors
 
         void VisitEdgePathToLeaf(const DataVectorType& input, size_t interiorNodeIndex, std::function<void(const InteriorNode&, size_t edgePosition)> operation) const;
 
+        // computes the (min, max) output over all root-to-leaf paths in a subtree
+        std::pair<double, double> GetSubtreeOutputRange(size_t interiorNodeIndex) const;
+
+        // computes the per-suffix output bounds used by PredictSign, if they are out of date
+        void EnsureSuffixOutputBounds() const;
+
         //
         //  member variables
         //
@@ -370,6 +398,10 @@ namespace predictors
         std::vector<size_t> _rootIndices;
         double _bias = 0.0;
         size_t _numEdges = 0;
+
+        // lazily computed bounds on the total contribution of trees i..end, cleared when the forest changes
+        mutable std::vector<double> _suffixLowerBounds;
+        mutable std::vector<double> _suffixUpperBounds;
     };
 
     /// <summary> A simple binary tree with single-input threshold rules and constant predictors in its edges. </summary>
@@ -11,6 +11,7 @@
 #include "IPredictor.h"
 
 // math
+#include "Matrix.h"
 #include "Vector.h"
 
 // datasets
@@ -85,6 +86,23 @@ namespace predictors
         /// <returns> The prediction. </returns>
         double Predict(const DataVectorType& dataVector) const;
 
+        /// <summary> Returns the output of the predictor for feature values given as a math vector
+        /// reference. This is the zero-copy alternative to the data-vector overload, used by the
+        /// interpreted compute path to score directly on existing storage. </summary>
+        ///
+        /// <param name="input"> The feature values; must have the predictor's size. </param>
+        ///
+        /// <returns> The prediction. </returns>
+        double Predict(math::UnorientedConstVectorReference<double> input) const;
+
+        /// <summary> Returns the output of the predictor for a whole batch of inputs, computed as
+        /// a single matrix-vector product instead of a dot product (and virtual call) per example. </summary>
+        ///
+        /// <param name="inputs"> A matrix whose rows are the input examples; the number of columns
+        /// must equal the predictor's dimension. </param>
+        /// <param name="outputs"> The vector that receives one prediction per input row. </param>
+        void PredictBatch(math::ConstMatrixReference<double, math::MatrixLayout::rowMajor> inputs, math::ColumnVectorReference<double> outputs) const;
+
         /// <summary> Returns a vector of dataVector elements weighted by the predictor weights. </summary>
         ///
         /// <param name="example"> The data vector. </param>
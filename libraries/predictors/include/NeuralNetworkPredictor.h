@@ -24,12 +24,15 @@
 #include "BiasLayer.h"
 #include "BinaryConvolutionalLayer.h"
 #include "ConvolutionalLayer.h"
+#include "DepthwiseConvolutionalLayer.h"
 #include "FullyConnectedLayer.h"
 #include "InputLayer.h"
 #include "LeakyReLUActivation.h"
 #include "MaxPoolingFunction.h"
 #include "MeanPoolingFunction.h"
 #include "PoolingLayer.h"
+#include "QuantizedConvolutionalLayer.h"
+#include "QuantizedFullyConnectedLayer.h"
 #include "ReLUActivation.h"
 #include "ScalingLayer.h"
 #include "SigmoidActivation.h"
@@ -41,12 +44,30 @@
 // stl
 #include <cstddef>
 #include <memory>
+#include <ostream>
+#include <string>
 
 
 namespace ell
 {
 namespace predictors
 {
+    /// <summary> Accumulated evaluation statistics for one layer of a neural network. </summary>
+    struct LayerStatistics
+    {
+        /// <summary> The friendly name of the layer's type. </summary>
+        std::string layerName;
+
+        /// <summary> The number of times the layer was computed. </summary>
+        size_t invocationCount = 0;
+
+        /// <summary> The total time spent computing the layer, in milliseconds. </summary>
+        double totalTimeMilliseconds = 0;
+
+        /// <summary> The total bytes of layer input read plus layer output written. </summary>
+        size_t bytesTouched = 0;
+    };
+
     /// <summary> A neural network predictor. </summary>
     template <typename ElementType>
     class NeuralNetworkPredictor : public IPredictor<std::vector<ElementType>>, public utilities::IArchivable
@@ -87,7 +108,7 @@ namespace predictors
         /// <summary> Sets the underlying layers. </summary>
         ///
         /// <returns> The underlying vector of layers. </returns>
-        void SetLayers(Layers&& layers) { _layers = std::move(layers); }
+        void SetLayers(Layers&& layers) { _layers = std::move(layers); PlanOutputBuffers(); }
 
         /// <summary> Gets the dimension of the input layer. </summary>
         ///
@@ -99,6 +120,14 @@ namespace predictors
         /// <returns> The dimension. </returns>
         Shape GetOutputShape() const;
 
+        /// <summary> Picks the cheapest valid convolution method for each convolutional layer
+        /// independently, using the layer's analytical cost model. One method rarely suits every
+        /// layer of a heterogeneous net, so this replaces the single method chosen at import with
+        /// a per-layer choice. The result is unchanged; only the evaluation strategy moves. </summary>
+        ///
+        /// <returns> The number of layers whose method changed. </returns>
+        size_t SelectConvolutionMethods();
+
         /// <summary> Returns the output of the network for a given input. </summary>
         ///
         /// <param name="input"> The data vector. </param>
@@ -106,6 +135,40 @@ namespace predictors
         /// <returns> The prediction. </returns>
         const std::vector<ElementType>& Predict(const DataVectorType& dataVector) const;
 
+        /// <summary> Returns the output of the network for a whole batch of inputs. The layers
+        /// compute one example at a time into their persistent internal buffers, so the batch form
+        /// reuses those buffers across examples and avoids the per-call interface overhead of
+        /// scoring through the single-example entry point in a loop. </summary>
+        ///
+        /// <param name="inputs"> The input vectors. </param>
+        /// <param name="outputs"> The vector that receives one prediction per input; resized to match. </param>
+        void PredictBatch(const std::vector<DataVectorType>& inputs, std::vector<std::vector<ElementType>>& outputs) const;
+
+        /// <summary> Turns per-layer instrumentation of `Predict` on or off. While enabled, each
+        /// call accumulates time, bytes touched and an invocation count for every layer, at the
+        /// cost of two clock reads per layer - cheap enough to leave on during evaluation runs.
+        /// Enabling (or re-enabling) resets any previously gathered statistics. </summary>
+        ///
+        /// <param name="enable"> true to gather per-layer statistics, false to stop. </param>
+        void SetProfilingEnabled(bool enable);
+
+        /// <summary> Indicates whether per-layer instrumentation is on. </summary>
+        ///
+        /// <returns> true if `Predict` is gathering per-layer statistics. </returns>
+        bool IsProfilingEnabled() const { return _profilingEnabled; }
+
+        /// <summary> Gets the statistics gathered since profiling was enabled, one entry per
+        /// layer, in network order. </summary>
+        ///
+        /// <returns> The per-layer statistics. </returns>
+        const std::vector<LayerStatistics>& GetLayerStatistics() const { return _layerStatistics; }
+
+        /// <summary> Prints the gathered per-layer statistics as a table keyed by layer type,
+        /// with per-invocation averages. </summary>
+        ///
+        /// <param name="os"> The output stream. </param>
+        void PrintLayerStatistics(std::ostream& os) const;
+
         /// <summary> Gets the name of this type (for serialization). </summary>
         ///
         /// <returns> The name of this type. </returns>
@@ -132,9 +195,23 @@ namespace predictors
         static void RegisterNeuralNetworkPredictorTypes(utilities::SerializationContext& context);
 
     private:
+        // Computes the maximum concurrent activation footprint and redirects the layer outputs into
+        // two ping-pong buffers, so that the number of live activation tensors doesn't grow with the
+        // depth of the network. Only layers wired with the standard convention (each layer's input
+        // references the previous layer's entire output) participate; other layers keep their own storage.
+        void PlanOutputBuffers();
+
         InputLayerReference _inputLayer;
         Layers _layers;
         mutable std::vector<ElementType> _output;
+
+        // per-layer instrumentation, populated by Predict when profiling is enabled
+        bool _profilingEnabled = false;
+        mutable std::vector<LayerStatistics> _layerStatistics;
+
+        // shared activation storage for the even/odd numbered layers
+        std::vector<ElementType> _evenOutputBuffer;
+        std::vector<ElementType> _oddOutputBuffer;
     };
 }
 }
@@ -13,6 +13,11 @@
 // math
 #include "Matrix.h"
 
+// stl
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
 namespace ell
 {
 namespace predictors
@@ -71,6 +76,16 @@ namespace neural
         /// <summary> Feeds the input forward through the layer and returns a reference to the output. </summary>
         void Compute() override;
 
+        /// <summary> Feeds a batch of inputs forward through the layer, producing one output tensor per input.
+        /// When the layer uses the bitwise method, the inputs are evaluated in groups of up to 64 by packing the
+        /// same bit position of every example in a group into one machine word, so each XOR/popcount-style step
+        /// operates on all examples in the group simultaneously. </summary>
+        ///
+        /// <param name="inputs"> The input tensors, each with the same shape as the layer's input. </param>
+        /// <param name="outputs"> Filled in with one output tensor per input, each sized to the active
+        /// (minus padding) output region of the layer. </param>
+        void ComputeBatch(const std::vector<ConstTensorReferenceType>& inputs, std::vector<TensorType>& outputs);
+
         /// <summary> Indicates the kind of layer. </summary>
         ///
         /// <returns> An enum indicating the layer type. </returns>
@@ -126,6 +141,11 @@ namespace neural
         // The number of columns is equal to the number of locations that a filter is slide over the input tensor.
         void ReceptiveFieldToColumns(ConstTensorReferenceType input, MatrixType& shapedInput);
 
+        // Sets bit position `bit` of the bit-sliced shaped input for one example. The outer index of slicedInput is
+        // the location that the receptive field is slid to, the inner index is the position within the receptive field
+        // volume, and each word holds that position's binarized value for up to 64 examples (one per bit).
+        void ReceptiveFieldToBitSlices(ConstTensorReferenceType input, size_t bit, std::vector<std::vector<uint64_t>>& slicedInput);
+
         void ComputeWeightsMatrix();
         void InitializeIOMatrices();
 
@@ -12,6 +12,9 @@
 // math
 #include "Matrix.h"
 
+// stl
+#include <memory>
+
 namespace ell
 {
 namespace predictors
@@ -21,10 +24,15 @@ namespace neural
     /// <summary> The method for performing convolutions. </summary>
     enum class ConvolutionMethod : int
     {
-        /// <summary> Normal method of doing convolution via reshaping input into columns and performing a gemm operation. </summary>
+        /// <summary> Normal method of doing convolution via reshaping input into columns and performing a gemm operation.
+        /// For layers with only a few input channels (e.g. the first layer of a vision model), the reshape inflates the
+        /// input by receptiveField^2 and dominates the gemm it feeds, so those layers are computed with direct
+        /// register-tiled spatial loops instead of materializing the columns. </summary>
         columnwise = 0,
         /// <summary> A different method of doing convolution which avoids reshaping the input, and uses gemm on smaller matrices with diagonal sums to create output. </summary>
-        diagonal = 1
+        diagonal = 1,
+        /// <summary> Winograd F(2x2,3x3) convolution, which transforms precomputed weights and 4x4 input tiles to cut the number of multiplies. Requires a 3x3 receptive field and a stride of 1. </summary>
+        winograd = 2
     };
 
     /// <summary> Specifies the hyper parameters of the convolutional layer. </summary>
@@ -66,7 +74,7 @@ namespace neural
         ConvolutionalLayer(const LayerParameters& layerParameters, const ConvolutionalParameters& convolutionalParameters, TensorType weights);
 
         /// <summary> Instantiates a blank instance. Used for unarchiving purposes only. </summary>
-        ConvolutionalLayer() : _weights(math::Triplet{0, 0, 0}), _shapedInput(0, 0), _weightsMatrix(0, 0), _outputMatrix(0 ,0){}
+        ConvolutionalLayer() : _weights(std::make_shared<TensorType>(math::Triplet{0, 0, 0})), _shapedInput(0, 0), _weightsMatrix(std::make_shared<MatrixType>(0, 0)), _outputMatrix(0 ,0){}
 
         /// <summary> Feeds the input forward through the layer and returns a reference to the output. </summary>
         void Compute() override;
@@ -81,15 +89,48 @@ namespace neural
         /// <returns> A ConvolutionalParameters struct. </returns>
         const ConvolutionalParameters& GetConvolutionalParameters() const { return _convolutionalParameters; }
 
+        /// <summary> Picks the cheapest valid convolution method for this layer's shape using an
+        /// analytical cost model (multiply count plus the extra data movement each method does).
+        /// Methods whose preconditions this layer doesn't meet are never returned. </summary>
+        ///
+        /// <returns> The method the cost model predicts is fastest for this layer. </returns>
+        ConvolutionMethod SelectBestConvolutionMethod() const;
+
+        /// <summary> Switches this layer to the given convolution method, recomputing the derived
+        /// weights. Falls back to columnwise if the layer doesn't meet the method's preconditions,
+        /// as the constructor does. </summary>
+        ///
+        /// <param name="method"> The method to use. </param>
+        void SetConvolutionMethod(ConvolutionMethod method);
+
         /// <summary> Get the weights for the convolution filters. </summary>
         ///
         /// <returns> The weights, packed into a Tensor. </returns>
-        const TensorType& GetWeights() const { return _weights; }
+        const TensorType& GetWeights() const { return *_weights; }
 
         /// <summary> Get the weights for the convolution filters. </summary>
         ///
         /// <returns> The weights, packed into a Matrix. </returns>
-        const MatrixType& GetWeightsMatrix() const { return _weightsMatrix; }
+        const MatrixType& GetWeightsMatrix() const { return *_weightsMatrix; }
+
+        /// <summary> Get the Winograd-transformed weights for the convolution filters. Valid only when the method is winograd. </summary>
+        ///
+        /// <returns> The transformed weights, packed as a 4x4 tile per filter and input channel, filter-major. </returns>
+        const std::vector<ElementType>& GetWinogradWeights() const { return *_winogradWeights; }
+
+        /// <summary> Enables incremental computation for streams of similar inputs (e.g. consecutive
+        /// video frames): after the first full computation, each call to `Compute` diffs the input
+        /// against a cached copy of the previous input in square pixel tiles, and only output elements
+        /// whose receptive field overlaps a changed tile are recomputed. Activations for unchanged
+        /// regions are reused from the layer's persistent output. Not archived; re-enable after
+        /// deserialization. </summary>
+        ///
+        /// <param name="tileSize"> Width and height of the diff tiles, in pixels. </param>
+        /// <param name="threshold"> Minimum absolute elementwise difference for a tile to count as changed. </param>
+        void EnableIncrementalCompute(size_t tileSize, ElementType threshold = 0);
+
+        /// <summary> Disables incremental computation and releases the cached previous input. </summary>
+        void DisableIncrementalCompute();
 
         /// <summary> Gets the name of this type (for serialization). </summary>
         ///
@@ -115,18 +156,34 @@ namespace neural
         // Fills a matrix (backed by the array outputMatrix) where the columns the set of input values corresponding to a filter, stretched into a vector.
         // The number of columns is equal to the number of locations that a filter is slide over the input tensor.
         void ReceptiveFieldToColumns(ConstTensorReferenceType input, MatrixType& shapedInput);
+        // True when the columnwise method should skip the im2col reshape and convolve directly
+        bool UseDirectConvolution() const;
+        void ComputeDirect();
         void ComputeWeightsMatrix();
+        void ComputeWinogradWeights();
         void InitializeIOMatrices();
+        ElementType ComputeDirectConvolution(size_t row, size_t column, size_t filterIndex) const;
+        void ComputeIncremental();
+        void SnapshotInput();
 
         using Layer<ElementType>::_layerParameters;
         using Layer<ElementType>::_output;
 
         ConvolutionalParameters _convolutionalParameters;
-        TensorType _weights;
+        // the weights (and the matrices derived from them) are immutable once constructed and
+        // shared between copies of the layer, so copying a layer (or the predictor holding it)
+        // doesn't duplicate the weight storage; only the scratch matrices are per-copy
+        std::shared_ptr<const TensorType> _weights;
 
         MatrixType _shapedInput;
-        MatrixType _weightsMatrix;
+        std::shared_ptr<const MatrixType> _weightsMatrix;
         MatrixType _outputMatrix;
+        std::shared_ptr<const std::vector<ElementType>> _winogradWeights = std::make_shared<std::vector<ElementType>>();
+
+        // incremental computation state (not archived)
+        size_t _incrementalTileSize = 0; // zero means incremental computation is off
+        ElementType _changeThreshold = 0;
+        TensorType _previousInput{ math::Triplet{ 0, 0, 0 } };
     };
 
 }
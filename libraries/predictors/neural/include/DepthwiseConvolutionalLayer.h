@@ -0,0 +1,99 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     DepthwiseConvolutionalLayer.h (neural)
+//  Authors:  Byron Changuion
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "ConvolutionalLayer.h"
+#include "Layer.h"
+
+// stl
+#include <memory>
+
+namespace ell
+{
+namespace predictors
+{
+namespace neural
+{
+    /// <summary> A layer in a neural network that implements a depthwise convolution, where each input
+    /// channel is convolved with its own single-channel kernel instead of the full receptive field volume.
+    /// Together with a 1x1 (pointwise) ConvolutionalLayer this forms a depthwise-separable block, at a
+    /// fraction of the cost of a full convolution. The number of output channels equals the number of
+    /// input channels. </summary>
+    template <typename ElementType>
+    class DepthwiseConvolutionalLayer : public Layer<ElementType>
+    {
+    public:
+        using LayerParameters = typename Layer<ElementType>::LayerParameters;
+        using TensorType = typename Layer<ElementType>::TensorType;
+        using Layer<ElementType>::GetOutputMinusPadding;
+        using Layer<ElementType>::NumOutputChannels;
+
+        /// <summary> Instantiates an instance of a depthwise convolutional layer. </summary>
+        ///
+        /// <param name="layerParameters"> The parameters common to every layer. </param>
+        /// <param name="convolutionalParameters"> The hyperparameters for this layer. Only the receptive
+        /// field and stride are used; depthwise convolution is always computed directly. </param>
+        /// <param name="weights"> The per-channel kernels, stacked into a Tensor of dimensions
+        /// (numChannels * receptiveField) x receptiveField x 1. </param>
+        DepthwiseConvolutionalLayer(const LayerParameters& layerParameters, const ConvolutionalParameters& convolutionalParameters, TensorType weights);
+
+        /// <summary> Instantiates a blank instance. Used for unarchiving purposes only. </summary>
+        DepthwiseConvolutionalLayer() : _weights(std::make_shared<TensorType>(math::Triplet{ 0, 0, 0 })) {}
+
+        /// <summary> Feeds the input forward through the layer and returns a reference to the output. </summary>
+        void Compute() override;
+
+        /// <summary> Indicates the kind of layer. </summary>
+        ///
+        /// <returns> An enum indicating the layer type. </returns>
+        LayerType GetLayerType() const override { return LayerType::depthwiseConvolution; }
+
+        /// <summary> Get the parameters used to control convolution. </summary>
+        ///
+        /// <returns> A ConvolutionalParameters struct. </returns>
+        const ConvolutionalParameters& GetConvolutionalParameters() const { return _convolutionalParameters; }
+
+        /// <summary> Get the per-channel kernels. </summary>
+        ///
+        /// <returns> The weights, packed into a Tensor. </returns>
+        const TensorType& GetWeights() const { return *_weights; }
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        static std::string GetTypeName() { return utilities::GetCompositeTypeName<ElementType>("DepthwiseConvolutionalLayer"); }
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        virtual std::string GetRuntimeTypeName() const override { return GetTypeName(); }
+
+        /// <summary> Adds an object's properties to an `Archiver` </summary>
+        ///
+        /// <param name="archiver"> The `Archiver` to add the values from the object to </param>
+        virtual void WriteToArchive(utilities::Archiver& archiver) const override;
+
+        /// <summary> Sets the internal state of the object according to the archiver passed in </summary>
+        ///
+        /// <param name="archiver"> The `Archiver` to get state from </param>
+        virtual void ReadFromArchive(utilities::Unarchiver& archiver) override;
+
+    private:
+        using Layer<ElementType>::_layerParameters;
+        using Layer<ElementType>::_output;
+
+        ConvolutionalParameters _convolutionalParameters;
+        // immutable kernels, shared between copies of the layer
+        std::shared_ptr<const TensorType> _weights;
+    };
+
+}
+}
+}
+
+#include "../tcc/DepthwiseConvolutionalLayer.tcc"
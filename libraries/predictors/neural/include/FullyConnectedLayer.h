@@ -12,6 +12,11 @@
 // math
 #include "Matrix.h"
 
+// stl
+#include <algorithm>
+#include <memory>
+#include <vector>
+
 namespace ell
 {
 namespace predictors
@@ -49,7 +54,7 @@ namespace neural
         FullyConnectedLayer(const LayerParameters& layerParameters, ConstTensorReferenceType& weights);
 
         /// <summary> Instantiates a blank instance. Used for unarchiving purposes only. </summary>
-        FullyConnectedLayer() : _weights(0,0) {}
+        FullyConnectedLayer() : _weights(std::make_shared<MatrixType>(0, 0)) {}
 
         /// <summary> Feeds the input forward through the layer and returns a reference to the output. </summary>
         void Compute() override;
@@ -64,6 +69,33 @@ namespace neural
         /// <returns> A matrix with the weights for this layer </returns>
         const MatrixType& GetWeights() const;
 
+        /// <summary> Converts the weights to a block-sparse representation: the matrix is tiled
+        /// into blockSize x blockSize blocks and only blocks containing a nonzero are kept, as a
+        /// block index list plus dense block values. `Compute` then iterates only the kept blocks,
+        /// and archives store just the kept blocks. The dense matrix remains available through
+        /// `GetWeights`. </summary>
+        ///
+        /// <param name="blockSize"> The block edge length (pruned models are typically sparse in 8x8 blocks). </param>
+        void UseBlockSparseWeights(size_t blockSize);
+
+        /// <summary> Indicates whether the weights are stored block-sparse. </summary>
+        ///
+        /// <returns> `true` if `UseBlockSparseWeights` has been called. </returns>
+        bool HasBlockSparseWeights() const { return _blockSize != 0; }
+
+        /// <summary> Gets the block edge length of the block-sparse weights (0 when dense). </summary>
+        size_t GetWeightsBlockSize() const { return _blockSize; }
+
+        /// <summary> Gets the block row index of each kept block. </summary>
+        const std::vector<size_t>& GetWeightsBlockRows() const { return _blockRows; }
+
+        /// <summary> Gets the block column index of each kept block. </summary>
+        const std::vector<size_t>& GetWeightsBlockColumns() const { return _blockColumns; }
+
+        /// <summary> Gets the values of the kept blocks, each dense and row-major, zero-padded
+        /// where a block overhangs the matrix edge. </summary>
+        const std::vector<ElementType>& GetWeightsBlockValues() const { return _blockValues; }
+
         /// <summary> Gets the name of this type (for serialization). </summary>
         ///
         /// <returns> The name of this type. </returns>
@@ -88,9 +120,17 @@ namespace neural
         using Layer<ElementType>::_layerParameters;
         using Layer<ElementType>::_output;
 
-        MatrixType _weights;
+        // the weights are immutable once constructed and shared between copies of the layer, so
+        // copying a layer (or the predictor holding it) doesn't duplicate the weight storage
+        std::shared_ptr<const MatrixType> _weights;
         VectorType _shapedInput;
         VectorType _outputVector;
+
+        // block-sparse form of the weights (empty when _blockSize is 0)
+        size_t _blockSize = 0;
+        std::vector<size_t> _blockRows;
+        std::vector<size_t> _blockColumns;
+        std::vector<ElementType> _blockValues;
     };
 
 }
@@ -10,6 +10,7 @@
 #include "IPredictor.h"
 
 // math
+#include "Float16.h"
 #include "Tensor.h"
 #include "TensorOperations.h"
 
@@ -39,13 +40,16 @@ namespace neural
         bias,
         binaryConvolution,
         convolution,
+        depthwiseConvolution,
         fullyConnected,
         input,
         pooling,
+        quantizedConvolution,
+        quantizedFullyConnected,
         scaling,
         softmax,
     };
-    static const std::string LayerNames[] = { "Base", "Activation", "BatchNormalization", "Bias", "BinaryConvolution", "Convolution", "FullyConnected", "Input", "Pooling", "Scaling", "Softmax" };
+    static const std::string LayerNames[] = { "Base", "Activation", "BatchNormalization", "Bias", "BinaryConvolution", "Convolution", "DepthwiseConvolution", "FullyConnected", "Input", "Pooling", "QuantizedConvolution", "QuantizedFullyConnected", "Scaling", "Softmax" };
 
     /// <summary> Enum that represents the type of padding values in a neural network layer. </summary>
     enum class PaddingScheme : int
@@ -124,10 +128,50 @@ namespace neural
         Layer()
             : _layerParameters{ math::Triplet{ 0, 0, 0 }, NoPadding(), { 0, 0, 0 }, NoPadding() }, _output(math::Triplet{ 0, 0, 0 }) {}
 
+        /// <summary> Copies a layer. The copy always owns its output storage, even if the original
+        /// wrote its output into shared memory. </summary>
+        Layer(const Layer& other);
+
+        /// <summary> Assigns a layer. The target always owns its output storage, even if the source
+        /// wrote its output into shared memory. </summary>
+        Layer& operator=(const Layer& other);
+
         /// <summary> Returns a reference to the output tensor. </summary>
         ///
         /// <returns> Reference to the output tensor. </returns>
-        ConstTensorReferenceType GetOutput() const { return _output; }
+        ConstTensorReferenceType GetOutput() const;
+
+        /// <summary> Redirects the layer's output into caller-owned memory holding at least as many elements
+        /// as the output shape, releasing the layer's own output storage. The caller is responsible for
+        /// keeping the memory alive for the lifetime of the layer. </summary>
+        ///
+        /// <param name="pOutputMemory"> A pointer to the memory that receives the layer's output. </param>
+        void SetOutputMemory(ElementType* pOutputMemory);
+
+        /// <summary> Indicates whether the layer writes its output into caller-owned shared memory. </summary>
+        ///
+        /// <returns> `true` if `SetOutputMemory` redirected the output. </returns>
+        bool UsesSharedOutputMemory() const { return _pOutputMemory != nullptr; }
+
+        /// <summary> Re-applies the output padding scheme to the output tensor. Needed before computing a
+        /// layer whose output lives in shared memory, since another layer may have overwritten the padding. </summary>
+        void ReinitializeOutputValues();
+
+        /// <summary> Opts this layer into half-precision output storage: after the layer computes,
+        /// its output values are rounded to what IEEE half-precision storage would reproduce, so
+        /// downstream layers see exactly the values a reduced-precision activation buffer would
+        /// hold. This is a runtime setting and is not archived. </summary>
+        ///
+        /// <param name="storeOutputAsFloat16"> `true` to round this layer's output through half precision. </param>
+        void SetStoreOutputAsFloat16(bool storeOutputAsFloat16) { _storeOutputAsFloat16 = storeOutputAsFloat16; }
+
+        /// <summary> Indicates whether this layer's output is rounded through half-precision storage. </summary>
+        ///
+        /// <returns> `true` if the layer's output is rounded through half precision. </returns>
+        bool GetStoreOutputAsFloat16() const { return _storeOutputAsFloat16; }
+
+        /// <summary> Rounds every element of the output tensor through half precision, in place. </summary>
+        void RoundOutputToFloat16();
 
         /// <summary> Returns shape of the active part of the input tensor. </summary>
         ///
@@ -212,15 +256,20 @@ namespace neural
         /// <returns> Read/write reference to the output tensor. </returns>
         TensorReferenceType GetOutputMinusPadding();
 
+        /// <summary> Returns a read/write reference to the output tensor, wherever its memory lives. </summary>
+        ///
+        /// <returns> Read/write reference to the output tensor. </returns>
+        TensorReferenceType GetOutputReference();
+
         /// <summary> Returns number of output rows minus padding. </summary>
-        size_t NumOutputRowsMinusPadding() const { return _output.NumRows() - 2 * _layerParameters.outputPaddingParameters.paddingSize; }
+        size_t NumOutputRowsMinusPadding() const { return _layerParameters.outputShape[0] - 2 * _layerParameters.outputPaddingParameters.paddingSize; }
         /// <summary> Returns number of output columns minus padding. </summary>
-        size_t NumOutputColumnsMinusPadding() const { return _output.NumColumns() - 2 * _layerParameters.outputPaddingParameters.paddingSize; }
+        size_t NumOutputColumnsMinusPadding() const { return _layerParameters.outputShape[1] - 2 * _layerParameters.outputPaddingParameters.paddingSize; }
         /// <summary> Returns number of output channels. </summary>
-        size_t NumOutputChannels() const { return _output.NumChannels(); };
+        size_t NumOutputChannels() const { return _layerParameters.outputShape[2]; };
 
         /// <summary> Sets the initial output values according to the padding scheme. </summary>
-        void InitializeOutputValues(TensorType& output, PaddingParameters outputPaddingParameters);
+        void InitializeOutputValues(TensorReferenceType& output, PaddingParameters outputPaddingParameters);
 
         // Temporary: This method will be removed once the Tensor operations have been modified to to take destination parameters,
         // rather than doing them in place
@@ -228,6 +277,12 @@ namespace neural
 
         LayerParameters _layerParameters;
         TensorType _output;
+
+        // when true, the output is rounded through half-precision storage after each Compute
+        bool _storeOutputAsFloat16 = false;
+
+        // when non-null, the output lives in this caller-owned memory instead of in _output
+        ElementType* _pOutputMemory = nullptr;
     };
 
     /// <summary> A serialization context used during layer deserialization. Wraps an existing `SerializationContext`
@@ -35,6 +35,11 @@ namespace neural
         /// <return> The average value from all accumulated values. </return>
         ElementType GetValue() const;
         
+        /// <summary> Merges the accumulated state of another instance into this one. </summary>
+        ///
+        /// <param name="other"> The other accumulator. </param>
+        void Merge(const MaxPoolingFunction<ElementType>& other);
+
         /// <summary> Value to accumulate when on padding. </summary>
         ///
         /// <return> The value when accumulate is called on padding. </return>
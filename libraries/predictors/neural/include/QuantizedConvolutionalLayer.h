@@ -0,0 +1,118 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     QuantizedConvolutionalLayer.h (neural)
+//  Authors:  Byron Changuion
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "ConvolutionalLayer.h"
+#include "Layer.h"
+
+// math
+#include "Quantization.h"
+
+// stl
+#include <cstdint>
+#include <vector>
+
+namespace ell
+{
+namespace predictors
+{
+namespace neural
+{
+    /// <summary> A layer in a neural network that implements a convolutional layer with 8-bit quantized weights.
+    /// The filter weights are quantized at construction to int8 with one scale per filter, so they occupy a quarter
+    /// of the memory of their float32 equivalent. During Compute, the input is quantized on the fly with a single
+    /// scale, the convolution runs on the 8-bit values with 32-bit accumulation, and the accumulated results are
+    /// scaled back to ElementType. Only the receptiveField and stride fields of the convolutional parameters are
+    /// used; the convolution is always computed directly. </summary>
+    template <typename ElementType>
+    class QuantizedConvolutionalLayer : public Layer<ElementType>
+    {
+    public:
+        using LayerParameters = typename Layer<ElementType>::LayerParameters;
+        using TensorType = typename Layer<ElementType>::TensorType;
+        using ConstTensorReferenceType = typename Layer<ElementType>::ConstTensorReferenceType;
+        using Layer<ElementType>::GetOutputMinusPadding;
+        using Layer<ElementType>::NumOutputChannels;
+
+        /// <summary> Instantiates an instance of a quantized convolutional layer. </summary>
+        ///
+        /// <param name="layerParameters"> The parameters common to every layer. </param>
+        /// <param name="convolutionalParameters"> The hyperparameters for this convolutional layer. </param>
+        /// <param name="weights"> The weights to quantize and apply, stacked as an f x k x k x d tensor where f is
+        /// the number of filters, k is the receptive field and d is the number of input channels. </param>
+        QuantizedConvolutionalLayer(const LayerParameters& layerParameters, const ConvolutionalParameters& convolutionalParameters, ConstTensorReferenceType& weights);
+
+        /// <summary> Instantiates a blank instance. Used for unarchiving purposes only. </summary>
+        QuantizedConvolutionalLayer() {}
+
+        /// <summary> Feeds the input forward through the layer and returns a reference to the output. </summary>
+        void Compute() override;
+
+        /// <summary> Indicates the kind of layer. </summary>
+        ///
+        /// <returns> An enum indicating the layer type. </returns>
+        LayerType GetLayerType() const override { return LayerType::quantizedConvolution; }
+
+        /// <summary> Get the parameters used to control convolution. </summary>
+        ///
+        /// <returns> A ConvolutionalParameters struct. </returns>
+        const ConvolutionalParameters& GetConvolutionalParameters() const { return _convolutionalParameters; }
+
+        /// <summary> Gets the quantized filter weights, in filter-major order (filter, row, column, channel). </summary>
+        ///
+        /// <returns> The int8 weight values. </returns>
+        const std::vector<int8_t>& GetQuantizedWeights() const { return _quantizedWeights; }
+
+        /// <summary> Gets the dequantization scale of each filter's weights. </summary>
+        ///
+        /// <returns> The per-filter weight scales. </returns>
+        const std::vector<ElementType>& GetWeightScales() const { return _weightScales; }
+
+        /// <summary> Gets the weights dequantized back to ElementType, for lowering to full-precision operations. </summary>
+        ///
+        /// <returns> A stacked f x k x k x d tensor with the dequantized weights. </returns>
+        TensorType GetDequantizedWeights() const;
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        static std::string GetTypeName() { return utilities::GetCompositeTypeName<ElementType>("QuantizedConvolutionalLayer"); }
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        virtual std::string GetRuntimeTypeName() const override { return GetTypeName(); }
+
+        /// <summary> Adds an object's properties to an `Archiver` </summary>
+        ///
+        /// <param name="archiver"> The `Archiver` to add the values from the object to </param>
+        virtual void WriteToArchive(utilities::Archiver& archiver) const override;
+
+        /// <summary> Sets the internal state of the object according to the archiver passed in </summary>
+        ///
+        /// <param name="archiver"> The `Archiver` to get state from </param>
+        virtual void ReadFromArchive(utilities::Unarchiver& archiver) override;
+
+    private:
+        static int8_t QuantizeValue(ElementType value, ElementType scale);
+
+        using Layer<ElementType>::_layerParameters;
+        using Layer<ElementType>::_output;
+
+        ConvolutionalParameters _convolutionalParameters;
+        std::vector<int8_t> _quantizedWeights; // numFilters x receptiveField x receptiveField x numChannels
+        std::vector<ElementType> _weightScales; // one scale per filter
+        std::vector<int8_t> _quantizedInput;
+        std::vector<ElementType> _inputBuffer; // contiguous staging copy of the input, in canonical order
+    };
+
+}
+}
+}
+
+#include "../tcc/QuantizedConvolutionalLayer.tcc"
@@ -0,0 +1,119 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     QuantizedFullyConnectedLayer.h (neural)
+//  Authors:  Byron Changuion
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "Layer.h"
+
+// math
+#include "Matrix.h"
+#include "Quantization.h"
+
+// stl
+#include <cstdint>
+#include <vector>
+
+namespace ell
+{
+namespace predictors
+{
+namespace neural
+{
+    /// <summary> A layer in a neural network that implements a fully connected layer with 8-bit quantized weights.
+    /// The weights are quantized at construction to int8 with one scale per output neuron, so they occupy a quarter
+    /// of the memory of their float32 equivalent. During Compute, the input is quantized on the fly with a single
+    /// scale, the multiply-accumulates run on the 8-bit values with 32-bit accumulation, and the accumulated results
+    /// are scaled back to ElementType. </summary>
+    template <typename ElementType>
+    class QuantizedFullyConnectedLayer : public Layer<ElementType>
+    {
+    public:
+        using LayerParameters = typename Layer<ElementType>::LayerParameters;
+        using MatrixType = typename Layer<ElementType>::MatrixType;
+        using MatrixReferenceType = typename Layer<ElementType>::MatrixReferenceType;
+        using ConstTensorReferenceType = typename Layer<ElementType>::ConstTensorReferenceType;
+        using Layer<ElementType>::GetOutputMinusPadding;
+
+        /// <summary> Instantiates an instance of a quantized fully connected layer. </summary>
+        ///
+        /// <param name="layerParameters"> The parameters common to every layer. </param>
+        /// <param name="weights"> The weights to quantize and apply, as a matrix in rowMajor order, where number of
+        /// rows equals output neurons and columns represent input (in canonical Tensor order). </param>
+        QuantizedFullyConnectedLayer(const LayerParameters& layerParameters, MatrixReferenceType& weights);
+
+        /// <summary> Instantiates an instance of a quantized fully connected layer. </summary>
+        ///
+        /// <param name="layerParameters"> The parameters common to every layer. </param>
+        /// <param name="weights"> The weights to quantize and apply, as stacked Tensors. Each sub-tensor is the same
+        /// size as the input, and the number of tensors stacked (in row dimension) equals the number of outputs
+        /// in canonical Tensor order. </param>
+        QuantizedFullyConnectedLayer(const LayerParameters& layerParameters, ConstTensorReferenceType& weights);
+
+        /// <summary> Instantiates a blank instance. Used for unarchiving purposes only. </summary>
+        QuantizedFullyConnectedLayer() {}
+
+        /// <summary> Feeds the input forward through the layer and returns a reference to the output. </summary>
+        void Compute() override;
+
+        /// <summary> Indicates the kind of layer. </summary>
+        ///
+        /// <returns> An enum indicating the layer type. </returns>
+        LayerType GetLayerType() const override { return LayerType::quantizedFullyConnected; }
+
+        /// <summary> Gets the quantized weights, in rowMajor order with one row per output neuron. </summary>
+        ///
+        /// <returns> The int8 weight values. </returns>
+        const std::vector<int8_t>& GetQuantizedWeights() const { return _quantizedWeights; }
+
+        /// <summary> Gets the dequantization scale of each output neuron's weights. </summary>
+        ///
+        /// <returns> The per-neuron weight scales. </returns>
+        const std::vector<ElementType>& GetWeightScales() const { return _weightScales; }
+
+        /// <summary> Gets the weights dequantized back to ElementType, for lowering to full-precision operations. </summary>
+        ///
+        /// <returns> A matrix with the dequantized weights. </returns>
+        MatrixType GetDequantizedWeights() const;
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        static std::string GetTypeName() { return utilities::GetCompositeTypeName<ElementType>("QuantizedFullyConnectedLayer"); }
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        virtual std::string GetRuntimeTypeName() const override { return GetTypeName(); }
+
+        /// <summary> Adds an object's properties to an `Archiver` </summary>
+        ///
+        /// <param name="archiver"> The `Archiver` to add the values from the object to </param>
+        virtual void WriteToArchive(utilities::Archiver& archiver) const override;
+
+        /// <summary> Sets the internal state of the object according to the archiver passed in </summary>
+        ///
+        /// <param name="archiver"> The `Archiver` to get state from </param>
+        virtual void ReadFromArchive(utilities::Unarchiver& archiver) override;
+
+    private:
+        static int8_t QuantizeValue(ElementType value, ElementType scale);
+        void QuantizeWeights(const MatrixType& weights);
+
+        using Layer<ElementType>::_layerParameters;
+        using Layer<ElementType>::_output;
+
+        std::vector<int8_t> _quantizedWeights; // numOutputs x numInputs, rowMajor
+        std::vector<ElementType> _weightScales; // one scale per output neuron
+        std::vector<ElementType> _shapedInput;
+        std::vector<int8_t> _quantizedInput;
+    };
+
+}
+}
+}
+
+#include "../tcc/QuantizedFullyConnectedLayer.tcc"
@@ -53,8 +53,16 @@ namespace neural
         auto output = GetOutputMinusPadding();
         auto input = _layerParameters.input;
 
-        AssignValues(input, output);
-        math::TensorOperations::MultiplyAdd<math::Dimension::channel>(_multiplicationValues, _additionValues, output);
+        if (input.NumRows() != output.NumRows() || input.NumColumns() != output.NumColumns() || input.NumChannels() != output.NumChannels())
+        {
+            // undersized input: copy it into the corner of the output, then operate in place
+            AssignValues(input, output);
+            math::TensorOperations::ScaleAdd<math::Dimension::channel>(_multiplicationValues, _additionValues, output);
+            return;
+        }
+
+        // single stride-aware pass over the input and output views, with no intermediate copy
+        math::TensorOperations::ScaleAdd<math::Dimension::channel>(_multiplicationValues, _additionValues, input, output);
     }
 
     template <typename ElementType>
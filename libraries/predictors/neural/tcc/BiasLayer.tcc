@@ -34,8 +34,17 @@ namespace neural
         auto output = GetOutputMinusPadding();
         auto input = _layerParameters.input;
 
-        AssignValues(input, output);
-        math::TensorOperations::Add<math::Dimension::channel>(_bias, output);
+        if (input.NumRows() != output.NumRows() || input.NumColumns() != output.NumColumns() || input.NumChannels() != output.NumChannels())
+        {
+            // undersized input: copy it into the corner of the output, then operate in place
+            AssignValues(input, output);
+            math::TensorOperations::Add<math::Dimension::channel>(_bias, output);
+            return;
+        }
+
+        // single stride-aware pass: read the input view, add the bias, write the (possibly
+        // padded) output view, with no intermediate copy
+        math::TensorOperations::Add<math::Dimension::channel>(_bias, input, output);
     }
 
     template <typename ElementType>
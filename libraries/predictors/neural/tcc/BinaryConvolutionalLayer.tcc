@@ -193,6 +193,116 @@ namespace neural
         }
     }
 
+    template <typename ElementType>
+    void BinaryConvolutionalLayer<ElementType>::ComputeBatch(const std::vector<ConstTensorReferenceType>& inputs, std::vector<TensorType>& outputs)
+    {
+        const size_t outputHeight = NumOutputRowsMinusPadding();
+        const size_t outputWidth = NumOutputColumnsMinusPadding();
+        const size_t numFilters = NumOutputChannels();
+
+        outputs.clear();
+        outputs.reserve(inputs.size());
+        for (size_t i = 0; i < inputs.size(); ++i)
+        {
+            outputs.emplace_back(outputHeight, outputWidth, numFilters);
+        }
+
+        if (_convolutionalParameters.method == BinaryConvolutionMethod::gemm)
+        {
+            // The gemm method evaluates one example at a time, reusing the layer's scratch matrices
+            for (size_t example = 0; example < inputs.size(); ++example)
+            {
+                ReceptiveFieldToColumns(inputs[example], _realValuedShapedInput);
+                math::Operations::Multiply(static_cast<ElementType>(1.0), _realValuedWeightsMatrix, _realValuedShapedInput, static_cast<ElementType>(0.0), _realValuedOutputMatrix);
+                for (size_t i = 0; i < outputHeight; ++i)
+                {
+                    for (size_t j = 0; j < outputWidth; ++j)
+                    {
+                        for (size_t k = 0; k < numFilters; ++k)
+                        {
+                            outputs[example](i, j, k) = _realValuedOutputMatrix(k, (i * outputWidth) + j);
+                        }
+                    }
+                }
+            }
+            return;
+        }
+
+        // Use the bitwise method, with the batch laid out bit-sliced: one word per receptive field position,
+        // holding that position's binarized value for up to 64 examples. Each XOR and vertical-counter step then
+        // operates on every example in the group at once.
+        const size_t fieldVolumeSize = _convolutionalParameters.receptiveField * _convolutionalParameters.receptiveField * _layerParameters.input.NumChannels();
+        const size_t numLocations = outputHeight * outputWidth;
+        size_t numCounterBits = 0;
+        while ((static_cast<size_t>(1) << numCounterBits) <= fieldVolumeSize)
+        {
+            ++numCounterBits;
+        }
+
+        std::vector<std::vector<uint64_t>> slicedInput(numLocations, std::vector<uint64_t>(fieldVolumeSize, 0));
+        std::vector<uint64_t> weightFlips(fieldVolumeSize);
+        std::vector<uint64_t> counters(numCounterBits);
+        const size_t wordSize = _binaryElementSize;
+        for (size_t groupStart = 0; groupStart < inputs.size(); groupStart += wordSize)
+        {
+            const size_t groupSize = std::min(wordSize, inputs.size() - groupStart);
+
+            // Transpose the group into bit-sliced form: bit `example` of slicedInput[location][f] is
+            // example `groupStart + example`'s binarized value at receptive field position f
+            for (auto& slices : slicedInput)
+            {
+                std::fill(slices.begin(), slices.end(), static_cast<uint64_t>(0));
+            }
+            for (size_t example = 0; example < groupSize; ++example)
+            {
+                ReceptiveFieldToBitSlices(inputs[groupStart + example], example, slicedInput);
+            }
+
+            for (size_t k = 0; k < numFilters; ++k)
+            {
+                // A word of all ones at the positions where the filter bit is set turns the per-position
+                // XOR into a mismatch mask over the whole group
+                auto& binarizedWeights = _binarizedWeights[k];
+                for (size_t f = 0; f < fieldVolumeSize; ++f)
+                {
+                    bool weightBit = (binarizedWeights[f / _binaryElementSize] >> (f % _binaryElementSize)) & 0x01;
+                    weightFlips[f] = weightBit ? ~static_cast<uint64_t>(0) : static_cast<uint64_t>(0);
+                }
+
+                for (size_t location = 0; location < numLocations; ++location)
+                {
+                    // Accumulate the per-example mismatch counts in vertical (bit-sliced) counters:
+                    // bit `example` of counters[0..numCounterBits) holds example's count, one bit per word
+                    std::fill(counters.begin(), counters.end(), static_cast<uint64_t>(0));
+                    auto& slices = slicedInput[location];
+                    for (size_t f = 0; f < fieldVolumeSize; ++f)
+                    {
+                        uint64_t carry = slices[f] ^ weightFlips[f];
+                        for (size_t bit = 0; carry != 0; ++bit)
+                        {
+                            uint64_t nextCarry = counters[bit] & carry;
+                            counters[bit] ^= carry;
+                            carry = nextCarry;
+                        }
+                    }
+
+                    const size_t i = location / outputWidth;
+                    const size_t j = location % outputWidth;
+                    for (size_t example = 0; example < groupSize; ++example)
+                    {
+                        size_t mismatchCount = 0;
+                        for (size_t bit = 0; bit < numCounterBits; ++bit)
+                        {
+                            mismatchCount += static_cast<size_t>((counters[bit] >> example) & 0x01) << bit;
+                        }
+                        ElementType sum = static_cast<ElementType>(2.0 * mismatchCount) - static_cast<ElementType>(fieldVolumeSize);
+                        outputs[groupStart + example](i, j, k) = (-_filterMeans[k] * sum);
+                    }
+                }
+            }
+        }
+    }
+
     // Fills a vector of vectors where each row is the values of the receptive field from the input stretched into a vector,
     // and the number of vectors is equal to the number of locations that a receptive field is slid over the input volume.
     template <typename ElementType>
@@ -243,6 +353,39 @@ namespace neural
         }
     }
 
+    // Sets one example's bit position in the bit-sliced shaped input. The layout is the transpose of
+    // ReceptiveFieldToBinaryRows: each word holds a single receptive field position for up to 64 examples,
+    // rather than 64 positions for a single example.
+    template <typename ElementType>
+    void BinaryConvolutionalLayer<ElementType>::ReceptiveFieldToBitSlices(ConstTensorReferenceType input, size_t bit, std::vector<std::vector<uint64_t>>& slicedInput)
+    {
+        const size_t fieldVolumeSize = _convolutionalParameters.receptiveField * _convolutionalParameters.receptiveField * _layerParameters.input.NumChannels();
+        const size_t outputWidth = NumOutputColumnsMinusPadding();
+        const size_t rowMax = outputWidth * NumOutputRowsMinusPadding();
+
+        for (size_t outRow = 0; outRow < rowMax; ++outRow)
+        {
+            const size_t convolutionalRow = outRow / outputWidth;
+            const size_t convolutionalCol = outRow % outputWidth;
+            const size_t horizontalStart = (convolutionalCol * _convolutionalParameters.stride);
+            const size_t verticalStart = (convolutionalRow * _convolutionalParameters.stride);
+
+            for (size_t f = 0; f < fieldVolumeSize; ++f)
+            {
+                // Calculate the col, row, depth values in the convolutional field volume
+                const size_t volDepth = f % input.NumChannels();
+                const size_t volCol = (f / input.NumChannels()) % _convolutionalParameters.receptiveField;
+                const size_t volRow = (f / input.NumChannels()) / _convolutionalParameters.receptiveField;
+
+                ElementType value = input(verticalStart + volRow, horizontalStart + volCol, volDepth);
+                if (value > 0)
+                {
+                    slicedInput[outRow][f] |= ((uint64_t)1 << bit);
+                }
+            }
+        }
+    }
+
     template <typename ElementType>
     void BinaryConvolutionalLayer<ElementType>::ReceptiveFieldToColumns(ConstTensorReferenceType input, MatrixType& shapedInput)
     {
@@ -6,6 +6,8 @@
 //
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 
 namespace ell
@@ -19,17 +21,16 @@ namespace neural
     ConvolutionalLayer<ElementType>::ConvolutionalLayer(const LayerParameters& layerParameters, const ConvolutionalParameters& convolutionalParameters, TensorType weights) :
         Layer<ElementType>(layerParameters),
         _convolutionalParameters(convolutionalParameters),
-        _weights(std::move(weights)),
-        _shapedInput { _convolutionalParameters.receptiveField * _convolutionalParameters.receptiveField * _layerParameters.input.NumChannels(), NumOutputRowsMinusPadding() * NumOutputColumnsMinusPadding() },
-        _weightsMatrix(_layerParameters.outputShape[2], _convolutionalParameters.receptiveField * _convolutionalParameters.receptiveField * _layerParameters.input.NumChannels()),
-        _outputMatrix{ NumOutputChannels(), NumOutputRowsMinusPadding() * NumOutputColumnsMinusPadding() }
+        _weights(std::make_shared<const TensorType>(std::move(weights))),
+        _shapedInput(0, 0),
+        _outputMatrix(0, 0)
     {
-        if(_weights.GetDataPointer() == nullptr)
+        if(_weights->GetDataPointer() == nullptr)
         {
             throw utilities::InputException(utilities::InputExceptionErrors::nullReference, "weights tensor has null data field");
         }
 
-        if (_weights.Size() != (_output.NumChannels() * _layerParameters.input.NumChannels() * convolutionalParameters.receptiveField * convolutionalParameters.receptiveField))
+        if (_weights->Size() != (_output.NumChannels() * _layerParameters.input.NumChannels() * convolutionalParameters.receptiveField * convolutionalParameters.receptiveField))
         {
             throw utilities::InputException(utilities::InputExceptionErrors::sizeMismatch, "weights dimensions for a convolutional layer should be the size of the receptive field volume * number of filters");
         }
@@ -43,7 +44,17 @@ namespace neural
                 _convolutionalParameters.method = ConvolutionMethod::columnwise;
             }
         }
+        else if (_convolutionalParameters.method == ConvolutionMethod::winograd)
+        {
+            // Winograd F(2x2,3x3) only applies to 3x3 filters with unit stride. If not,
+            // choose the normal method.
+            if (_convolutionalParameters.receptiveField != 3 || _convolutionalParameters.stride != 1)
+            {
+                _convolutionalParameters.method = ConvolutionMethod::columnwise;
+            }
+        }
 
+        InitializeIOMatrices();
         ComputeWeightsMatrix();
     }
 
@@ -53,13 +64,29 @@ namespace neural
         auto output = GetOutputMinusPadding();
         auto& input = _layerParameters.input;
 
+        if (_incrementalTileSize > 0 && _previousInput.NumRows() == input.NumRows())
+        {
+            ComputeIncremental();
+            return;
+        }
+
         if (_convolutionalParameters.method == ConvolutionMethod::columnwise)
         {
+            if (UseDirectConvolution())
+            {
+                ComputeDirect();
+                if (_incrementalTileSize > 0)
+                {
+                    SnapshotInput();
+                }
+                return;
+            }
+
             // Re-shape input.
             ReceptiveFieldToColumns(input, _shapedInput);
 
             // Multiply reshaped input and weights.
-            math::Operations::Multiply(static_cast<ElementType>(1.0), _weightsMatrix, _shapedInput, static_cast<ElementType>(0.0), _outputMatrix);
+            math::Operations::Multiply(static_cast<ElementType>(1.0), *_weightsMatrix, _shapedInput, static_cast<ElementType>(0.0), _outputMatrix);
 
             // Re-shape the output into the output tensor
             for (size_t i = 0; i < output.NumRows(); i++)
@@ -75,6 +102,95 @@ namespace neural
                 }
             }
         }
+        else if (_convolutionalParameters.method == ConvolutionMethod::winograd)
+        {
+            // Use the Winograd F(2x2,3x3) method: each 2x2 output tile costs 16 multiplies per
+            // channel instead of 36. Leftover rows and columns of odd-sized outputs are computed directly.
+            const size_t numFilters = NumOutputChannels();
+            const size_t numChannels = input.NumChannels();
+            const size_t numTileRows = output.NumRows() / 2;
+            const size_t numTileColumns = output.NumColumns() / 2;
+            const auto& winogradWeights = *_winogradWeights;
+
+            for (size_t filterIndex = 0; filterIndex < numFilters; filterIndex++)
+            {
+                for (size_t tileRow = 0; tileRow < numTileRows; tileRow++)
+                {
+                    for (size_t tileColumn = 0; tileColumn < numTileColumns; tileColumn++)
+                    {
+                        // Accumulate the transformed elementwise products over the channels
+                        ElementType tile[4][4] = {};
+                        for (size_t channel = 0; channel < numChannels; channel++)
+                        {
+                            // Gather the 4x4 input tile (the input tensor includes the padding)
+                            ElementType d[4][4];
+                            for (size_t i = 0; i < 4; i++)
+                            {
+                                for (size_t j = 0; j < 4; j++)
+                                {
+                                    d[i][j] = input(2 * tileRow + i, 2 * tileColumn + j, channel);
+                                }
+                            }
+
+                            // Transform the input tile: m = B^T d B
+                            ElementType bd[4][4];
+                            for (size_t j = 0; j < 4; j++)
+                            {
+                                bd[0][j] = d[0][j] - d[2][j];
+                                bd[1][j] = d[1][j] + d[2][j];
+                                bd[2][j] = d[2][j] - d[1][j];
+                                bd[3][j] = d[1][j] - d[3][j];
+                            }
+                            ElementType m[4][4];
+                            for (size_t i = 0; i < 4; i++)
+                            {
+                                m[i][0] = bd[i][0] - bd[i][2];
+                                m[i][1] = bd[i][1] + bd[i][2];
+                                m[i][2] = bd[i][2] - bd[i][1];
+                                m[i][3] = bd[i][1] - bd[i][3];
+                            }
+
+                            for (size_t i = 0; i < 4; i++)
+                            {
+                                for (size_t j = 0; j < 4; j++)
+                                {
+                                    tile[i][j] += winogradWeights[(filterIndex * numChannels + channel) * 16 + i * 4 + j] * m[i][j];
+                                }
+                            }
+                        }
+
+                        // Inverse transform: y = A^T tile A
+                        ElementType z[2][4];
+                        for (size_t j = 0; j < 4; j++)
+                        {
+                            z[0][j] = tile[0][j] + tile[1][j] + tile[2][j];
+                            z[1][j] = tile[1][j] - tile[2][j] - tile[3][j];
+                        }
+                        for (size_t i = 0; i < 2; i++)
+                        {
+                            output(2 * tileRow + i, 2 * tileColumn + 0, filterIndex) = z[i][0] + z[i][1] + z[i][2];
+                            output(2 * tileRow + i, 2 * tileColumn + 1, filterIndex) = z[i][1] - z[i][2] - z[i][3];
+                        }
+                    }
+                }
+
+                // Compute any leftover rows and columns directly
+                for (size_t i = 2 * numTileRows; i < output.NumRows(); i++)
+                {
+                    for (size_t j = 0; j < output.NumColumns(); j++)
+                    {
+                        output(i, j, filterIndex) = ComputeDirectConvolution(i, j, filterIndex);
+                    }
+                }
+                for (size_t i = 0; i < 2 * numTileRows; i++)
+                {
+                    for (size_t j = 2 * numTileColumns; j < output.NumColumns(); j++)
+                    {
+                        output(i, j, filterIndex) = ComputeDirectConvolution(i, j, filterIndex);
+                    }
+                }
+            }
+        }
         else
         {
             // Use the Diagonal method
@@ -89,7 +205,7 @@ namespace neural
             const size_t numConvolutions = (inputMatrix.NumColumns() - kt) / depth + 1;
             const size_t numFiltersAtAtime = _convolutionalParameters.numFiltersAtATime;
             const size_t numFilters = _layerParameters.outputShape[2];
-            auto weightsMatrix = _weights.ReferenceAsMatrix().Transpose();
+            auto weightsMatrix = _weights->ReferenceAsMatrix().Transpose();
 
             for (size_t j = 0; j < numConvolutions; j++)
             {
@@ -121,6 +237,196 @@ namespace neural
                 }
             }
         }
+
+        if (_incrementalTileSize > 0)
+        {
+            SnapshotInput();
+        }
+    }
+
+    template <typename ElementType>
+    ConvolutionMethod ConvolutionalLayer<ElementType>::SelectBestConvolutionMethod() const
+    {
+        const size_t receptiveField = _convolutionalParameters.receptiveField;
+        const size_t stride = _convolutionalParameters.stride;
+        const size_t numChannels = _layerParameters.input.NumChannels();
+        const size_t numFilters = NumOutputChannels();
+        const size_t outputRows = NumOutputRowsMinusPadding();
+        const size_t outputColumns = NumOutputColumnsMinusPadding();
+        const size_t outputLocations = outputRows * outputColumns;
+        const size_t fieldVolume = receptiveField * receptiveField * numChannels;
+
+        // Model each method's cost in element operations: the multiplies it performs plus the
+        // extra data movement it does around them. All methods compute the same result, so only
+        // relative cost matters.
+        const double macs = static_cast<double>(numFilters) * fieldVolume * outputLocations;
+
+        // columnwise pays for materializing the im2col matrix: one copy of the receptive field
+        // volume per output location
+        double bestCost = macs + static_cast<double>(fieldVolume) * outputLocations;
+        ConvolutionMethod bestMethod = ConvolutionMethod::columnwise;
+
+        // diagonal skips the reshape but sums along diagonals afterwards
+        if (receptiveField % 2 == 1 && stride == 1)
+        {
+            double diagonalCost = macs + static_cast<double>(numFilters) * receptiveField * outputLocations;
+            if (diagonalCost < bestCost)
+            {
+                bestCost = diagonalCost;
+                bestMethod = ConvolutionMethod::diagonal;
+            }
+        }
+
+        // winograd F(2x2,3x3) cuts multiplies to 16 per 2x2 output tile and channel (vs 36), at
+        // the price of transforming each input tile (32 adds) and each output tile (24 adds);
+        // leftover rows and columns of odd-sized outputs are computed directly
+        if (receptiveField == 3 && stride == 1 && outputRows >= 2 && outputColumns >= 2)
+        {
+            double numTiles = static_cast<double>(outputRows / 2) * (outputColumns / 2);
+            double winogradCost = numTiles * numChannels * (16.0 * numFilters + 32.0) + numTiles * numFilters * 24.0;
+            double leftoverLocations = static_cast<double>(outputLocations) - numTiles * 4;
+            winogradCost += leftoverLocations * numFilters * fieldVolume;
+            if (winogradCost < bestCost)
+            {
+                bestCost = winogradCost;
+                bestMethod = ConvolutionMethod::winograd;
+            }
+        }
+
+        return bestMethod;
+    }
+
+    template <typename ElementType>
+    void ConvolutionalLayer<ElementType>::SetConvolutionMethod(ConvolutionMethod method)
+    {
+        // apply the same precondition fallbacks as the constructor
+        if (method == ConvolutionMethod::diagonal && ((_convolutionalParameters.receptiveField % 2 == 0) || _convolutionalParameters.stride != 1))
+        {
+            method = ConvolutionMethod::columnwise;
+        }
+        else if (method == ConvolutionMethod::winograd && (_convolutionalParameters.receptiveField != 3 || _convolutionalParameters.stride != 1))
+        {
+            method = ConvolutionMethod::columnwise;
+        }
+
+        if (method == _convolutionalParameters.method)
+        {
+            return;
+        }
+        _convolutionalParameters.method = method;
+        ComputeWeightsMatrix();
+    }
+
+    template <typename ElementType>
+    void ConvolutionalLayer<ElementType>::EnableIncrementalCompute(size_t tileSize, ElementType threshold)
+    {
+        if (tileSize == 0)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "tileSize must be positive");
+        }
+        _incrementalTileSize = tileSize;
+        _changeThreshold = threshold;
+        _previousInput = TensorType(math::Triplet{ 0, 0, 0 }); // the next Compute runs in full and takes the first snapshot
+    }
+
+    template <typename ElementType>
+    void ConvolutionalLayer<ElementType>::DisableIncrementalCompute()
+    {
+        _incrementalTileSize = 0;
+        _previousInput = TensorType(math::Triplet{ 0, 0, 0 });
+    }
+
+    template <typename ElementType>
+    void ConvolutionalLayer<ElementType>::SnapshotInput()
+    {
+        auto& input = _layerParameters.input;
+        if (_previousInput.NumRows() != input.NumRows())
+        {
+            _previousInput = TensorType(input.NumRows(), input.NumColumns(), input.NumChannels());
+        }
+        for (size_t i = 0; i < input.NumRows(); i++)
+        {
+            for (size_t j = 0; j < input.NumColumns(); j++)
+            {
+                for (size_t k = 0; k < input.NumChannels(); k++)
+                {
+                    _previousInput(i, j, k) = input(i, j, k);
+                }
+            }
+        }
+    }
+
+    template <typename ElementType>
+    void ConvolutionalLayer<ElementType>::ComputeIncremental()
+    {
+        auto output = GetOutputMinusPadding();
+        auto& input = _layerParameters.input;
+        const size_t tileSize = _incrementalTileSize;
+        const size_t receptiveField = _convolutionalParameters.receptiveField;
+        const size_t stride = _convolutionalParameters.stride;
+        const size_t numFilters = output.NumChannels();
+
+        for (size_t tileStartRow = 0; tileStartRow < input.NumRows(); tileStartRow += tileSize)
+        {
+            const size_t tileEndRow = std::min(tileStartRow + tileSize, input.NumRows()); // exclusive
+            for (size_t tileStartColumn = 0; tileStartColumn < input.NumColumns(); tileStartColumn += tileSize)
+            {
+                const size_t tileEndColumn = std::min(tileStartColumn + tileSize, input.NumColumns()); // exclusive
+
+                // diff this tile against the cached previous input, across all channels
+                bool changed = false;
+                for (size_t i = tileStartRow; i < tileEndRow && !changed; i++)
+                {
+                    for (size_t j = tileStartColumn; j < tileEndColumn && !changed; j++)
+                    {
+                        for (size_t k = 0; k < input.NumChannels(); k++)
+                        {
+                            if (std::abs(input(i, j, k) - _previousInput(i, j, k)) > _changeThreshold)
+                            {
+                                changed = true;
+                                break;
+                            }
+                        }
+                    }
+                }
+                if (!changed)
+                {
+                    continue;
+                }
+
+                // update the cached copy of the changed tile
+                for (size_t i = tileStartRow; i < tileEndRow; i++)
+                {
+                    for (size_t j = tileStartColumn; j < tileEndColumn; j++)
+                    {
+                        for (size_t k = 0; k < input.NumChannels(); k++)
+                        {
+                            _previousInput(i, j, k) = input(i, j, k);
+                        }
+                    }
+                }
+
+                // recompute the output elements whose receptive field overlaps the tile: output
+                // (i, j) reads input rows [i * stride, i * stride + receptiveField), so the affected
+                // output rows run from ceil((tileStartRow - receptiveField + 1) / stride) through
+                // (tileEndRow - 1) / stride, clamped to the output extent (and likewise for columns)
+                const size_t firstOutputRow = (tileStartRow >= receptiveField) ? (tileStartRow - receptiveField + stride) / stride : 0;
+                const size_t lastOutputRow = std::min((tileEndRow - 1) / stride, output.NumRows() - 1); // inclusive
+                const size_t firstOutputColumn = (tileStartColumn >= receptiveField) ? (tileStartColumn - receptiveField + stride) / stride : 0;
+                const size_t lastOutputColumn = std::min((tileEndColumn - 1) / stride, output.NumColumns() - 1); // inclusive
+
+                for (size_t i = firstOutputRow; i <= lastOutputRow; i++)
+                {
+                    for (size_t j = firstOutputColumn; j <= lastOutputColumn; j++)
+                    {
+                        for (size_t filterIndex = 0; filterIndex < numFilters; filterIndex++)
+                        {
+                            output(i, j, filterIndex) = ComputeDirectConvolution(i, j, filterIndex);
+                        }
+                    }
+                }
+            }
+        }
     }
 
     template <typename ElementType>
@@ -164,7 +470,7 @@ namespace neural
         archiver["method"] << static_cast<int>(_convolutionalParameters.method);
         archiver["numFiltersAtATime"] << static_cast<int>(_convolutionalParameters.numFiltersAtATime);
         
-        math::TensorArchiver::Write(_weights, "weights", archiver);
+        math::TensorArchiver::Write(*_weights, "weights", archiver);
     }
 
     template <typename ElementType>
@@ -181,7 +487,9 @@ namespace neural
         archiver["numFiltersAtATime"] >> numFilters;
         _convolutionalParameters.numFiltersAtATime = static_cast<size_t>(numFilters);
 
-        math::TensorArchiver::Read(_weights, "weights", archiver);
+        TensorType weights(math::Triplet{ 0, 0, 0 });
+        math::TensorArchiver::Read(weights, "weights", archiver);
+        _weights = std::make_shared<const TensorType>(std::move(weights));
         ComputeWeightsMatrix();
         InitializeIOMatrices();
     }
@@ -189,12 +497,14 @@ namespace neural
     template <typename ElementType>
     void ConvolutionalLayer<ElementType>::ComputeWeightsMatrix()
     {
-        _weightsMatrix = {_layerParameters.outputShape[2], _convolutionalParameters.receptiveField * _convolutionalParameters.receptiveField * _layerParameters.input.NumChannels()};
-        if (_convolutionalParameters.method == ConvolutionMethod::columnwise)
+        MatrixType weightsMatrix(_layerParameters.outputShape[2], _convolutionalParameters.receptiveField * _convolutionalParameters.receptiveField * _layerParameters.input.NumChannels());
+        if (_convolutionalParameters.method != ConvolutionMethod::diagonal)
         {
+            // The reshaped weights are also computed for the winograd method, since the compiled
+            // path falls back to the columnwise method when the output shape doesn't suit Winograd tiling.
             // Use the columnwise method
             // Reshape the weights
-            auto flattened = _weights.ReferenceAsMatrix();
+            auto flattened = _weights->ReferenceAsMatrix();
             for (size_t startRow = 0; startRow < flattened.NumRows() / _convolutionalParameters.receptiveField; startRow++)
             {
                 for (size_t row = 0; row < _convolutionalParameters.receptiveField; row++)
@@ -203,16 +513,147 @@ namespace neural
                     for (size_t i = 0; i < weightsVector.Size(); i++)
                     {
                         const size_t columnOffset = row * weightsVector.Size();
-                        _weightsMatrix(startRow, columnOffset + i) = weightsVector[i];
+                        weightsMatrix(startRow, columnOffset + i) = weightsVector[i];
                     }
                 }
             }
         }
+        _weightsMatrix = std::make_shared<const MatrixType>(std::move(weightsMatrix));
+        if (_convolutionalParameters.method == ConvolutionMethod::winograd)
+        {
+            ComputeWinogradWeights();
+        }
+    }
+
+    template <typename ElementType>
+    void ConvolutionalLayer<ElementType>::ComputeWinogradWeights()
+    {
+        const size_t numFilters = _layerParameters.outputShape[2];
+        const size_t numChannels = _layerParameters.input.NumChannels();
+        const ElementType half = static_cast<ElementType>(0.5);
+        const auto& weights = *_weights;
+        std::vector<ElementType> winogradWeights(numFilters * numChannels * 16, 0);
+
+        // Transform each filter's 3x3 kernel per channel: U = G g G^T, where
+        // G = [1 0 0; 1/2 1/2 1/2; 1/2 -1/2 1/2; 0 0 1]
+        for (size_t filterIndex = 0; filterIndex < numFilters; filterIndex++)
+        {
+            for (size_t channel = 0; channel < numChannels; channel++)
+            {
+                ElementType g[3][3];
+                for (size_t row = 0; row < 3; row++)
+                {
+                    for (size_t column = 0; column < 3; column++)
+                    {
+                        g[row][column] = weights(filterIndex * 3 + row, column, channel);
+                    }
+                }
+
+                ElementType Gg[4][3];
+                for (size_t column = 0; column < 3; column++)
+                {
+                    Gg[0][column] = g[0][column];
+                    Gg[1][column] = (g[0][column] + g[1][column] + g[2][column]) * half;
+                    Gg[2][column] = (g[0][column] - g[1][column] + g[2][column]) * half;
+                    Gg[3][column] = g[2][column];
+                }
+
+                const size_t tileOffset = (filterIndex * numChannels + channel) * 16;
+                for (size_t row = 0; row < 4; row++)
+                {
+                    winogradWeights[tileOffset + row * 4 + 0] = Gg[row][0];
+                    winogradWeights[tileOffset + row * 4 + 1] = (Gg[row][0] + Gg[row][1] + Gg[row][2]) * half;
+                    winogradWeights[tileOffset + row * 4 + 2] = (Gg[row][0] - Gg[row][1] + Gg[row][2]) * half;
+                    winogradWeights[tileOffset + row * 4 + 3] = Gg[row][2];
+                }
+            }
+        }
+        _winogradWeights = std::make_shared<const std::vector<ElementType>>(std::move(winogradWeights));
+    }
+
+    template <typename ElementType>
+    bool ConvolutionalLayer<ElementType>::UseDirectConvolution() const
+    {
+        // With only a few input channels the gemm's inner dimension is tiny, so the ~receptiveField^2-fold
+        // im2col inflation costs more bandwidth than the multiplies it enables. Convolve those layers directly.
+        return _layerParameters.input.NumChannels() < 4;
+    }
+
+    template <typename ElementType>
+    void ConvolutionalLayer<ElementType>::ComputeDirect()
+    {
+        auto output = GetOutputMinusPadding();
+        auto& input = _layerParameters.input;
+        const auto& weights = *_weights;
+        const size_t receptiveField = _convolutionalParameters.receptiveField;
+        const size_t stride = _convolutionalParameters.stride;
+        const size_t numChannels = input.NumChannels();
+        const size_t numFilters = output.NumChannels();
+        constexpr size_t filterTileSize = 4;
+
+        for (size_t i = 0; i < output.NumRows(); i++)
+        {
+            for (size_t j = 0; j < output.NumColumns(); j++)
+            {
+                // Tile over the filters so each loaded input value feeds several accumulators held in registers
+                for (size_t filterStart = 0; filterStart < numFilters; filterStart += filterTileSize)
+                {
+                    const size_t numFiltersToUse = std::min(filterTileSize, numFilters - filterStart);
+                    ElementType sums[filterTileSize] = {};
+                    for (size_t fieldRow = 0; fieldRow < receptiveField; fieldRow++)
+                    {
+                        for (size_t fieldColumn = 0; fieldColumn < receptiveField; fieldColumn++)
+                        {
+                            for (size_t channel = 0; channel < numChannels; channel++)
+                            {
+                                const ElementType inputValue = input(i * stride + fieldRow, j * stride + fieldColumn, channel);
+                                for (size_t l = 0; l < numFiltersToUse; l++)
+                                {
+                                    sums[l] += weights((filterStart + l) * receptiveField + fieldRow, fieldColumn, channel) * inputValue;
+                                }
+                            }
+                        }
+                    }
+                    for (size_t l = 0; l < numFiltersToUse; l++)
+                    {
+                        output(i, j, filterStart + l) = sums[l];
+                    }
+                }
+            }
+        }
+    }
+
+    template <typename ElementType>
+    ElementType ConvolutionalLayer<ElementType>::ComputeDirectConvolution(size_t row, size_t column, size_t filterIndex) const
+    {
+        auto& input = _layerParameters.input;
+        const auto& weights = *_weights;
+        const size_t receptiveField = _convolutionalParameters.receptiveField;
+        const size_t stride = _convolutionalParameters.stride;
+        ElementType sum = 0;
+        for (size_t fieldRow = 0; fieldRow < receptiveField; fieldRow++)
+        {
+            for (size_t fieldColumn = 0; fieldColumn < receptiveField; fieldColumn++)
+            {
+                for (size_t channel = 0; channel < input.NumChannels(); channel++)
+                {
+                    sum += weights(filterIndex * receptiveField + fieldRow, fieldColumn, channel) * input(row * stride + fieldRow, column * stride + fieldColumn, channel);
+                }
+            }
+        }
+        return sum;
     }
 
     template <typename ElementType>
     void ConvolutionalLayer<ElementType>::InitializeIOMatrices()
     {
+        if (UseDirectConvolution())
+        {
+            // The direct path never materializes the shaped input, so don't allocate the scratch space for it
+            _shapedInput = { 0, 0 };
+            _outputMatrix = { 0, 0 };
+            return;
+        }
         _shapedInput = { _convolutionalParameters.receptiveField * _convolutionalParameters.receptiveField * _layerParameters.input.NumChannels(), NumOutputRowsMinusPadding() * NumOutputColumnsMinusPadding() };
         _outputMatrix =  { NumOutputChannels(), NumOutputRowsMinusPadding() * NumOutputColumnsMinusPadding() };
     }
@@ -0,0 +1,99 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     DepthwiseConvolutionalLayer.tcc (neural)
+//  Authors:  Byron Changuion
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ell
+{
+namespace predictors
+{
+namespace neural
+{
+    template <typename ElementType>
+    DepthwiseConvolutionalLayer<ElementType>::DepthwiseConvolutionalLayer(const LayerParameters& layerParameters, const ConvolutionalParameters& convolutionalParameters, TensorType weights) :
+        Layer<ElementType>(layerParameters),
+        _convolutionalParameters(convolutionalParameters),
+        _weights(std::make_shared<const TensorType>(std::move(weights)))
+    {
+        if (_weights->GetDataPointer() == nullptr)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::nullReference, "weights tensor has null data field");
+        }
+
+        if (NumOutputChannels() != _layerParameters.input.NumChannels())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::sizeMismatch, "output of a depthwise convolutional layer must have the same number of channels as the input");
+        }
+
+        if (_weights->Size() != (_layerParameters.input.NumChannels() * _convolutionalParameters.receptiveField * _convolutionalParameters.receptiveField))
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::sizeMismatch, "weights dimensions for a depthwise convolutional layer should be one receptive field per input channel");
+        }
+    }
+
+    template <typename ElementType>
+    void DepthwiseConvolutionalLayer<ElementType>::Compute()
+    {
+        auto output = GetOutputMinusPadding();
+        auto& input = _layerParameters.input;
+        const auto& weights = *_weights;
+        const size_t receptiveField = _convolutionalParameters.receptiveField;
+        const size_t stride = _convolutionalParameters.stride;
+
+        for (size_t i = 0; i < output.NumRows(); i++)
+        {
+            for (size_t j = 0; j < output.NumColumns(); j++)
+            {
+                for (size_t channel = 0; channel < output.NumChannels(); channel++)
+                {
+                    ElementType sum = 0;
+                    for (size_t fieldRow = 0; fieldRow < receptiveField; fieldRow++)
+                    {
+                        for (size_t fieldColumn = 0; fieldColumn < receptiveField; fieldColumn++)
+                        {
+                            sum += weights(channel * receptiveField + fieldRow, fieldColumn, 0) * input(i * stride + fieldRow, j * stride + fieldColumn, channel);
+                        }
+                    }
+                    output(i, j, channel) = sum;
+                }
+            }
+        }
+    }
+
+    template <typename ElementType>
+    void DepthwiseConvolutionalLayer<ElementType>::WriteToArchive(utilities::Archiver& archiver) const
+    {
+        Layer<ElementType>::WriteToArchive(archiver);
+
+        archiver["receptiveField"] << _convolutionalParameters.receptiveField;
+        archiver["stride"] << _convolutionalParameters.stride;
+        archiver["method"] << static_cast<int>(_convolutionalParameters.method);
+        archiver["numFiltersAtATime"] << static_cast<int>(_convolutionalParameters.numFiltersAtATime);
+
+        math::TensorArchiver::Write(*_weights, "weights", archiver);
+    }
+
+    template <typename ElementType>
+    void DepthwiseConvolutionalLayer<ElementType>::ReadFromArchive(utilities::Unarchiver& archiver)
+    {
+        Layer<ElementType>::ReadFromArchive(archiver);
+
+        archiver["receptiveField"] >> _convolutionalParameters.receptiveField;
+        archiver["stride"] >> _convolutionalParameters.stride;
+        int method;
+        archiver["method"] >> method;
+        _convolutionalParameters.method = static_cast<ConvolutionMethod>(method);
+        int numFilters;
+        archiver["numFiltersAtATime"] >> numFilters;
+        _convolutionalParameters.numFiltersAtATime = static_cast<size_t>(numFilters);
+
+        TensorType weights(math::Triplet{ 0, 0, 0 });
+        math::TensorArchiver::Read(weights, "weights", archiver);
+        _weights = std::make_shared<const TensorType>(std::move(weights));
+    }
+}
+}
+}
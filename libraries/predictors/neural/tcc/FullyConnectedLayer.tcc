@@ -16,29 +16,30 @@ namespace neural
     template <typename ElementType>
     FullyConnectedLayer<ElementType>::FullyConnectedLayer(const LayerParameters& layerParameters, MatrixReferenceType& weights) :
         Layer<ElementType>(layerParameters),
-        _weights(weights.NumRows(), weights.NumColumns()),
         _shapedInput(layerParameters.input.Size()),
         _outputVector(GetOutputMinusPadding().Size())
     {
-        _weights = weights;
-        if (_weights.NumRows() != (GetOutputMinusPadding().Size()))
+        MatrixType weightsMatrix(weights.NumRows(), weights.NumColumns());
+        weightsMatrix = weights;
+        if (weightsMatrix.NumRows() != (GetOutputMinusPadding().Size()))
         {
             throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "weights dimension for a fully connected layer should be the same as number of output nodes times inputs per node");
         }
+        _weights = std::make_shared<const MatrixType>(std::move(weightsMatrix));
     }
 
     template <typename ElementType>
     FullyConnectedLayer<ElementType>::FullyConnectedLayer(const LayerParameters& layerParameters, ConstTensorReferenceType& weights) :
         Layer<ElementType>(layerParameters),
-        _weights(GetOutputMinusPadding().Size(), layerParameters.input.Size()),
         _shapedInput(layerParameters.input.Size()),
         _outputVector(GetOutputMinusPadding().Size())
     {
-        // Reshape the weights into the _weights matrix
+        // Reshape the weights into the weights matrix
         // Each row is represents an output neuron, each column corresponds to the weight for that input
+        MatrixType weightsMatrix(GetOutputMinusPadding().Size(), layerParameters.input.Size());
         const size_t rowIncrement = layerParameters.input.NumColumns() * layerParameters.input.NumChannels();
         const size_t columnIncrement = layerParameters.input.NumChannels();
-        for (size_t outRow = 0; outRow < _weights.NumRows(); outRow++)
+        for (size_t outRow = 0; outRow < weightsMatrix.NumRows(); outRow++)
         {
             for (size_t i = 0; i < layerParameters.input.NumRows(); i++)
             {
@@ -47,12 +48,13 @@ namespace neural
                     for (size_t k = 0; k < layerParameters.input.NumChannels(); k++)
                     {
                         size_t column = (i * rowIncrement) + (j * columnIncrement) + k;
-                        _weights(outRow, column) = weights(outRow * layerParameters.input.NumRows() + i, j, k);
+                        weightsMatrix(outRow, column) = weights(outRow * layerParameters.input.NumRows() + i, j, k);
                     }
                 }
             }
         }
-    }    
+        _weights = std::make_shared<const MatrixType>(std::move(weightsMatrix));
+    }
 
     template <typename ElementType>
     void FullyConnectedLayer<ElementType>::Compute()
@@ -73,7 +75,34 @@ namespace neural
             }
         }
 
-        math::Operations::Multiply((ElementType)1.0f, _weights, _shapedInput, (ElementType)0.0f, _outputVector);
+        if (_blockSize != 0)
+        {
+            // iterate only the kept blocks; each is a dense blockSize x blockSize tile
+            _outputVector.Reset();
+            auto numRows = _weights->NumRows();
+            auto numColumns = _weights->NumColumns();
+            for (size_t block = 0; block < _blockRows.size(); ++block)
+            {
+                auto firstRow = _blockRows[block] * _blockSize;
+                auto firstColumn = _blockColumns[block] * _blockSize;
+                auto blockRows = std::min(_blockSize, numRows - firstRow);
+                auto blockColumns = std::min(_blockSize, numColumns - firstColumn);
+                const ElementType* blockValues = &_blockValues[block * _blockSize * _blockSize];
+                for (size_t i = 0; i < blockRows; ++i)
+                {
+                    ElementType sum = 0;
+                    for (size_t j = 0; j < blockColumns; ++j)
+                    {
+                        sum += blockValues[i * _blockSize + j] * _shapedInput[firstColumn + j];
+                    }
+                    _outputVector[firstRow + i] += sum;
+                }
+            }
+        }
+        else
+        {
+            math::Operations::Multiply((ElementType)1.0f, *_weights, _shapedInput, (ElementType)0.0f, _outputVector);
+        }
 
         // Reshape the output
         columnIndex = 0;
@@ -92,7 +121,65 @@ namespace neural
     template <typename ElementType>
     const typename FullyConnectedLayer<ElementType>::MatrixType& FullyConnectedLayer<ElementType>::GetWeights() const
     {
-        return _weights;
+        return *_weights;
+    }
+
+    template <typename ElementType>
+    void FullyConnectedLayer<ElementType>::UseBlockSparseWeights(size_t blockSize)
+    {
+        if (blockSize == 0)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "block size for block-sparse weights must be positive");
+        }
+
+        const auto& weights = *_weights;
+        _blockSize = blockSize;
+        _blockRows.clear();
+        _blockColumns.clear();
+        _blockValues.clear();
+
+        auto numGridRows = (weights.NumRows() + blockSize - 1) / blockSize;
+        auto numGridColumns = (weights.NumColumns() + blockSize - 1) / blockSize;
+        for (size_t blockRow = 0; blockRow < numGridRows; ++blockRow)
+        {
+            for (size_t blockColumn = 0; blockColumn < numGridColumns; ++blockColumn)
+            {
+                auto firstRow = blockRow * blockSize;
+                auto firstColumn = blockColumn * blockSize;
+                auto blockRows = std::min(blockSize, weights.NumRows() - firstRow);
+                auto blockColumns = std::min(blockSize, weights.NumColumns() - firstColumn);
+
+                bool hasNonZero = false;
+                for (size_t i = 0; i < blockRows && !hasNonZero; ++i)
+                {
+                    for (size_t j = 0; j < blockColumns; ++j)
+                    {
+                        if (weights(firstRow + i, firstColumn + j) != 0)
+                        {
+                            hasNonZero = true;
+                            break;
+                        }
+                    }
+                }
+                if (!hasNonZero)
+                {
+                    continue;
+                }
+
+                _blockRows.push_back(blockRow);
+                _blockColumns.push_back(blockColumn);
+
+                // store the block dense and row-major, zero-padded where it overhangs the matrix edge
+                for (size_t i = 0; i < blockSize; ++i)
+                {
+                    for (size_t j = 0; j < blockSize; ++j)
+                    {
+                        bool inRange = i < blockRows && j < blockColumns;
+                        _blockValues.push_back(inRange ? weights(firstRow + i, firstColumn + j) : 0);
+                    }
+                }
+            }
+        }
     }
 
     template <typename ElementType>
@@ -100,7 +187,20 @@ namespace neural
     {
         Layer<ElementType>::WriteToArchive(archiver);
 
-        math::MatrixArchiver::Write(_weights, "weights", archiver);
+        archiver["blockSize"] << _blockSize;
+        if (_blockSize == 0)
+        {
+            math::MatrixArchiver::Write(*_weights, "weights", archiver);
+        }
+        else
+        {
+            // only the kept blocks are stored; the dense matrix is rebuilt on read
+            archiver["numRows"] << _weights->NumRows();
+            archiver["numColumns"] << _weights->NumColumns();
+            archiver["blockRows"] << _blockRows;
+            archiver["blockColumns"] << _blockColumns;
+            archiver["blockValues"] << _blockValues;
+        }
         math::VectorArchiver::Write(_shapedInput, "shapedInput", archiver);
         math::VectorArchiver::Write(_outputVector, "outputVector", archiver);
     }
@@ -110,7 +210,42 @@ namespace neural
     {
         Layer<ElementType>::ReadFromArchive(archiver);
 
-        math::MatrixArchiver::Read(_weights, "weights", archiver);
+        archiver["blockSize"] >> _blockSize;
+        if (_blockSize == 0)
+        {
+            MatrixType weights(0, 0);
+            math::MatrixArchiver::Read(weights, "weights", archiver);
+            _weights = std::make_shared<const MatrixType>(std::move(weights));
+        }
+        else
+        {
+            size_t numRows;
+            size_t numColumns;
+            archiver["numRows"] >> numRows;
+            archiver["numColumns"] >> numColumns;
+            archiver["blockRows"] >> _blockRows;
+            archiver["blockColumns"] >> _blockColumns;
+            archiver["blockValues"] >> _blockValues;
+
+            // rebuild the dense matrix from the kept blocks
+            MatrixType weights(numRows, numColumns);
+            for (size_t block = 0; block < _blockRows.size(); ++block)
+            {
+                auto firstRow = _blockRows[block] * _blockSize;
+                auto firstColumn = _blockColumns[block] * _blockSize;
+                auto blockRows = std::min(_blockSize, numRows - firstRow);
+                auto blockColumns = std::min(_blockSize, numColumns - firstColumn);
+                const ElementType* blockValues = &_blockValues[block * _blockSize * _blockSize];
+                for (size_t i = 0; i < blockRows; ++i)
+                {
+                    for (size_t j = 0; j < blockColumns; ++j)
+                    {
+                        weights(firstRow + i, firstColumn + j) = blockValues[i * _blockSize + j];
+                    }
+                }
+            }
+            _weights = std::make_shared<const MatrixType>(std::move(weights));
+        }
         math::VectorArchiver::Read(_shapedInput, "shapedInput", archiver);
         math::VectorArchiver::Read(_outputVector, "outputVector", archiver);
     }
@@ -25,7 +25,69 @@ namespace neural
         _layerParameters(layerParameters),
         _output(layerParameters.outputShape)
     {
-        InitializeOutputValues(_output, layerParameters.outputPaddingParameters);
+        TensorReferenceType output(_output);
+        InitializeOutputValues(output, layerParameters.outputPaddingParameters);
+    }
+
+    template <typename ElementType>
+    Layer<ElementType>::Layer(const Layer& other) :
+        _layerParameters(other._layerParameters),
+        _output(other.GetOutput())
+    {
+    }
+
+    template <typename ElementType>
+    Layer<ElementType>& Layer<ElementType>::operator=(const Layer& other)
+    {
+        if (this != &other)
+        {
+            _layerParameters = other._layerParameters;
+            _output = TensorType(other.GetOutput());
+            _pOutputMemory = nullptr;
+        }
+        return *this;
+    }
+
+    template <typename ElementType>
+    typename Layer<ElementType>::ConstTensorReferenceType Layer<ElementType>::GetOutput() const
+    {
+        if (_pOutputMemory != nullptr)
+        {
+            return ConstTensorReferenceType(_layerParameters.outputShape, _pOutputMemory);
+        }
+        return _output;
+    }
+
+    template <typename ElementType>
+    typename Layer<ElementType>::TensorReferenceType Layer<ElementType>::GetOutputReference()
+    {
+        if (_pOutputMemory != nullptr)
+        {
+            return TensorReferenceType(_layerParameters.outputShape[0], _layerParameters.outputShape[1], _layerParameters.outputShape[2], _pOutputMemory);
+        }
+        return TensorReferenceType(_output);
+    }
+
+    template <typename ElementType>
+    void Layer<ElementType>::SetOutputMemory(ElementType* pOutputMemory)
+    {
+        _pOutputMemory = pOutputMemory;
+        _output = TensorType(math::Triplet{ 0, 0, 0 }); // release the owned storage
+        ReinitializeOutputValues();
+    }
+
+    template <typename ElementType>
+    void Layer<ElementType>::ReinitializeOutputValues()
+    {
+        auto output = GetOutputReference();
+        InitializeOutputValues(output, _layerParameters.outputPaddingParameters);
+    }
+
+    template <typename ElementType>
+    void Layer<ElementType>::RoundOutputToFloat16()
+    {
+        auto output = GetOutputReference();
+        output.Transform([](ElementType value) { return math::RoundToFloat16(value); });
     }
 
     template <typename ElementType>
@@ -45,7 +107,7 @@ namespace neural
     }
 
     template <typename ElementType>
-    void Layer<ElementType>::InitializeOutputValues(TensorType& output, PaddingParameters outputPaddingParameters)
+    void Layer<ElementType>::InitializeOutputValues(TensorReferenceType& output, PaddingParameters outputPaddingParameters)
     {
         switch (outputPaddingParameters.paddingScheme)
         {
@@ -103,7 +165,7 @@ namespace neural
 
         os << buffer;
 
-        const ConstTensorReferenceType output(_output);
+        const ConstTensorReferenceType output = GetOutput();
         for (size_t i = 0; (i < numValuesToPrint) && (i < output.Size()); i++)
         {
             size_t channel = i % output.NumChannels();
@@ -135,12 +197,24 @@ namespace neural
         archiver["outputPaddingScheme"] << static_cast<int>(_layerParameters.outputPaddingParameters.paddingScheme);
         archiver["outputPaddingSize"] << _layerParameters.outputPaddingParameters.paddingSize;
 
-        math::TensorArchiver::Write(_output, "output", archiver);
+        if (_pOutputMemory != nullptr)
+        {
+            // archive an owning copy of the shared-memory output, so the archive format doesn't
+            // depend on how the output memory was planned
+            TensorType output(GetOutput());
+            math::TensorArchiver::Write(output, "output", archiver);
+        }
+        else
+        {
+            math::TensorArchiver::Write(_output, "output", archiver);
+        }
     }
 
     template <typename ElementType>
     void Layer<ElementType>::ReadFromArchive(utilities::Unarchiver& archiver)
     {
+        _pOutputMemory = nullptr; // unarchived layers own their output storage
+
         int inputPaddingScheme;
         archiver["inputPaddingScheme"] >> inputPaddingScheme;
         _layerParameters.inputPaddingParameters.paddingScheme = static_cast<PaddingScheme>(inputPaddingScheme);
@@ -171,8 +245,9 @@ namespace neural
 
     template <typename ElementType>
     typename Layer<ElementType>::TensorReferenceType Layer<ElementType>::GetOutputMinusPadding()
-    { 
-        return _output.GetSubTensor({ _layerParameters.outputPaddingParameters.paddingSize, _layerParameters.outputPaddingParameters.paddingSize, 0 }, { _output.NumRows() - 2 * _layerParameters.outputPaddingParameters.paddingSize, _output.NumColumns() - 2 * _layerParameters.outputPaddingParameters.paddingSize, _output.NumChannels() });
+    {
+        auto output = GetOutputReference();
+        return output.GetSubTensor({ _layerParameters.outputPaddingParameters.paddingSize, _layerParameters.outputPaddingParameters.paddingSize, 0 }, { output.NumRows() - 2 * _layerParameters.outputPaddingParameters.paddingSize, output.NumColumns() - 2 * _layerParameters.outputPaddingParameters.paddingSize, output.NumChannels() });
     }
 
     template <typename ElementType>
@@ -180,6 +255,13 @@ namespace neural
     {
         DEBUG_THROW(input.NumRows() > output.NumRows() || input.NumColumns() > output.NumColumns() || input.NumChannels() > output.NumChannels(), utilities::InputException(utilities::InputExceptionErrors::sizeMismatch, "Input tensor must not exceed output tensor dimensions."));
 
+        if (input.NumRows() == output.NumRows() && input.NumColumns() == output.NumColumns() && input.NumChannels() == output.NumChannels())
+        {
+            // both views may be strided sub-tensors; the copy kernel moves contiguous runs in bulk
+            math::TensorOperations::Copy(input, output);
+            return;
+        }
+
         for (size_t i = 0; i < input.NumRows(); i++)
         {
             for (size_t j = 0; j < input.NumColumns(); j++)
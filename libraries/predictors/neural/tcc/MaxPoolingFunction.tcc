@@ -27,6 +27,12 @@ namespace neural
         _max = std::max(_max, input);
     }
 
+    template <typename ElementType>
+    void MaxPoolingFunction<ElementType>::Merge(const MaxPoolingFunction<ElementType>& other)
+    {
+        _max = std::max(_max, other._max);
+    }
+
     template <typename ElementType>
     ElementType MaxPoolingFunction<ElementType>::GetValue() const
     {
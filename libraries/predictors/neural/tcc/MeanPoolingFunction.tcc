@@ -27,6 +27,13 @@ namespace neural
         _numValues++;
     }
 
+    template <typename ElementType>
+    void MeanPoolingFunction<ElementType>::Merge(const MeanPoolingFunction<ElementType>& other)
+    {
+        _sum += other._sum;
+        _numValues += other._numValues;
+    }
+
     template <typename ElementType>
     ElementType MeanPoolingFunction<ElementType>::GetValue() const
     {
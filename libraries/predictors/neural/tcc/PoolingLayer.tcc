@@ -29,40 +29,72 @@ namespace neural
         auto output = GetOutputMinusPadding();
         auto& input = _layerParameters.input;
 
-        for (size_t row = 0; row < output.NumRows(); row++)
+        const size_t outputRows = output.NumRows();
+        const size_t outputColumns = output.NumColumns();
+        const size_t numChannels = output.NumChannels();
+        const size_t poolingSize = _poolingParameters.poolingSize;
+        const size_t stride = _poolingParameters.stride;
+        if (outputRows == 0 || outputColumns == 0)
         {
-            const size_t startRow = row * _poolingParameters.stride;
-            for (size_t column = 0; column < output.NumColumns(); column++)
-            {
-                const size_t startColumn = column * _poolingParameters.stride;
-                std::vector<PoolingFunctionType<ElementType>> poolingValues(output.NumChannels());
+            return;
+        }
+
+        // Pooling is separable, so each output row is computed in two passes: the window rows are
+        // first reduced vertically into a cached row of per-(column, channel) accumulators, and each
+        // output element then merges poolingSize columns of that cache. With overlapping windows
+        // (poolingSize > stride) this reads each input value once per output row instead of once per
+        // window it belongs to, and the channel-minor inner loops run over contiguous memory.
+        const size_t cachedColumns = (outputColumns - 1) * stride + poolingSize;
+        std::vector<PoolingFunctionType<ElementType>> columnPools(cachedColumns * numChannels);
+        std::vector<PoolingFunctionType<ElementType>> outputPools(numChannels);
+
+        for (size_t row = 0; row < outputRows; row++)
+        {
+            const size_t startRow = row * stride;
+            columnPools.assign(columnPools.size(), PoolingFunctionType<ElementType>{});
 
-                for (size_t pool_y = 0; pool_y < _poolingParameters.poolingSize; pool_y++)
+            for (size_t pool_y = 0; pool_y < poolingSize; pool_y++)
+            {
+                const size_t inputRow = startRow + pool_y;
+                for (size_t inputColumn = 0; inputColumn < cachedColumns; inputColumn++)
                 {
-                    for (size_t pool_x = 0; pool_x < _poolingParameters.poolingSize; pool_x++)
+                    auto pools = columnPools.data() + inputColumn * numChannels;
+
+                    // Special case here for certain networks that rely on pooling fields that are even outside of
+                    // the specified padding.
+                    if ((inputRow < input.NumRows()) && (inputColumn < input.NumColumns()))
                     {
-                        for (size_t channel = 0; channel < output.NumChannels(); channel++)
+                        for (size_t channel = 0; channel < numChannels; channel++)
                         {
-
-                            // Special case here for certain networks that rely on pooling fields that are even outside of
-                            // the specified padding.
-                            size_t inputRow = startRow + pool_y;
-                            size_t inputColumn = startColumn + pool_x;
-                            if ((inputRow < input.NumRows()) && (inputColumn < input.NumColumns()))
-                            {
-                                poolingValues[channel].Accumulate(input(inputRow, inputColumn, channel));
-                            }
-                            else
-                            {
-                                poolingValues[channel].Accumulate(poolingValues[channel].GetValueAtPadding());
-                            }
+                            pools[channel].Accumulate(input(inputRow, inputColumn, channel));
                         }
                     }
+                    else
+                    {
+                        for (size_t channel = 0; channel < numChannels; channel++)
+                        {
+                            pools[channel].Accumulate(pools[channel].GetValueAtPadding());
+                        }
+                    }
+                }
+            }
+
+            for (size_t column = 0; column < outputColumns; column++)
+            {
+                const size_t startColumn = column * stride;
+                outputPools.assign(outputPools.size(), PoolingFunctionType<ElementType>{});
+                for (size_t pool_x = 0; pool_x < poolingSize; pool_x++)
+                {
+                    auto pools = columnPools.data() + (startColumn + pool_x) * numChannels;
+                    for (size_t channel = 0; channel < numChannels; channel++)
+                    {
+                        outputPools[channel].Merge(pools[channel]);
+                    }
                 }
 
-                for (size_t channel = 0; channel < output.NumChannels(); channel++)
+                for (size_t channel = 0; channel < numChannels; channel++)
                 {
-                    output(row, column, channel) = poolingValues[channel].GetValue();
+                    output(row, column, channel) = outputPools[channel].GetValue();
                 }
             }
         }
@@ -0,0 +1,196 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     QuantizedConvolutionalLayer.tcc (neural)
+//  Authors:  Byron Changuion
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// stl
+#include <algorithm>
+#include <cmath>
+
+namespace ell
+{
+namespace predictors
+{
+namespace neural
+{
+    template <typename ElementType>
+    int8_t QuantizedConvolutionalLayer<ElementType>::QuantizeValue(ElementType value, ElementType scale)
+    {
+        auto quantized = std::round(value / scale);
+        if (quantized > 127) quantized = 127;
+        if (quantized < -127) quantized = -127;
+        return static_cast<int8_t>(quantized);
+    }
+
+    template <typename ElementType>
+    QuantizedConvolutionalLayer<ElementType>::QuantizedConvolutionalLayer(const LayerParameters& layerParameters, const ConvolutionalParameters& convolutionalParameters, ConstTensorReferenceType& weights) :
+        Layer<ElementType>(layerParameters),
+        _convolutionalParameters(convolutionalParameters)
+    {
+        const size_t numFilters = NumOutputChannels();
+        const size_t receptiveField = _convolutionalParameters.receptiveField;
+        const size_t numChannels = _layerParameters.input.NumChannels();
+        if (weights.Size() != numFilters * numChannels * receptiveField * receptiveField)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::sizeMismatch, "weights dimensions for a quantized convolutional layer should be the size of the receptive field volume * number of filters");
+        }
+
+        // Quantize each filter with its own scale
+        _quantizedWeights.resize(weights.Size());
+        _weightScales.resize(numFilters);
+        size_t weightIndex = 0;
+        for (size_t filterIndex = 0; filterIndex < numFilters; filterIndex++)
+        {
+            ElementType maxAbsValue = 0;
+            for (size_t m = 0; m < receptiveField; m++)
+            {
+                for (size_t n = 0; n < receptiveField; n++)
+                {
+                    for (size_t channel = 0; channel < numChannels; channel++)
+                    {
+                        maxAbsValue = std::max(maxAbsValue, std::abs(weights(filterIndex * receptiveField + m, n, channel)));
+                    }
+                }
+            }
+
+            ElementType scale = (maxAbsValue == 0) ? static_cast<ElementType>(1) : maxAbsValue / static_cast<ElementType>(127);
+            _weightScales[filterIndex] = scale;
+            for (size_t m = 0; m < receptiveField; m++)
+            {
+                for (size_t n = 0; n < receptiveField; n++)
+                {
+                    for (size_t channel = 0; channel < numChannels; channel++)
+                    {
+                        _quantizedWeights[weightIndex++] = QuantizeValue(weights(filterIndex * receptiveField + m, n, channel), scale);
+                    }
+                }
+            }
+        }
+    }
+
+    template <typename ElementType>
+    void QuantizedConvolutionalLayer<ElementType>::Compute()
+    {
+        auto output = GetOutputMinusPadding();
+        auto& input = _layerParameters.input;
+        const size_t receptiveField = _convolutionalParameters.receptiveField;
+        const size_t stride = _convolutionalParameters.stride;
+        const size_t numChannels = input.NumChannels();
+        const size_t inputColumns = input.NumColumns();
+
+        // Quantize the input (including its padding) with a single dynamically-chosen scale.
+        // Gather into a contiguous staging buffer in canonical order first, so the scale scan and
+        // the quantization run over flat arrays that the vectorized kernels can chew through.
+        _inputBuffer.resize(input.Size());
+        _quantizedInput.resize(input.Size());
+        size_t inputIndex = 0;
+        for (size_t i = 0; i < input.NumRows(); i++)
+        {
+            for (size_t j = 0; j < input.NumColumns(); j++)
+            {
+                for (size_t k = 0; k < numChannels; k++)
+                {
+                    _inputBuffer[inputIndex++] = input(i, j, k);
+                }
+            }
+        }
+        ElementType maxAbsValue = math::MaxAbsValue(_inputBuffer.data(), _inputBuffer.size());
+        ElementType inputScale = (maxAbsValue == 0) ? static_cast<ElementType>(1) : maxAbsValue / static_cast<ElementType>(127);
+        math::QuantizeValues(_inputBuffer.data(), _quantizedInput.data(), _inputBuffer.size(), inputScale);
+
+        // Integer direct convolution, then scale the accumulated results back to ElementType
+        const size_t filterVolume = receptiveField * receptiveField * numChannels;
+        for (size_t i = 0; i < output.NumRows(); i++)
+        {
+            for (size_t j = 0; j < output.NumColumns(); j++)
+            {
+                for (size_t filterIndex = 0; filterIndex < output.NumChannels(); filterIndex++)
+                {
+                    const int8_t* filterWeights = &_quantizedWeights[filterIndex * filterVolume];
+                    int32_t accumulator = 0;
+                    size_t weightIndex = 0;
+                    for (size_t m = 0; m < receptiveField; m++)
+                    {
+                        const int8_t* inputRow = &_quantizedInput[((i * stride + m) * inputColumns + j * stride) * numChannels];
+                        for (size_t index = 0; index < receptiveField * numChannels; index++)
+                        {
+                            accumulator += static_cast<int32_t>(filterWeights[weightIndex++]) * static_cast<int32_t>(inputRow[index]);
+                        }
+                    }
+                    output(i, j, filterIndex) = static_cast<ElementType>(accumulator) * _weightScales[filterIndex] * inputScale;
+                }
+            }
+        }
+    }
+
+    template <typename ElementType>
+    typename QuantizedConvolutionalLayer<ElementType>::TensorType QuantizedConvolutionalLayer<ElementType>::GetDequantizedWeights() const
+    {
+        const size_t numFilters = _weightScales.size();
+        const size_t receptiveField = _convolutionalParameters.receptiveField;
+        const size_t numChannels = _quantizedWeights.size() / (numFilters * receptiveField * receptiveField);
+        TensorType weights(numFilters * receptiveField, receptiveField, numChannels);
+        size_t weightIndex = 0;
+        for (size_t filterIndex = 0; filterIndex < numFilters; filterIndex++)
+        {
+            for (size_t m = 0; m < receptiveField; m++)
+            {
+                for (size_t n = 0; n < receptiveField; n++)
+                {
+                    for (size_t channel = 0; channel < numChannels; channel++)
+                    {
+                        weights(filterIndex * receptiveField + m, n, channel) = static_cast<ElementType>(_quantizedWeights[weightIndex++]) * _weightScales[filterIndex];
+                    }
+                }
+            }
+        }
+        return weights;
+    }
+
+    template <typename ElementType>
+    void QuantizedConvolutionalLayer<ElementType>::WriteToArchive(utilities::Archiver& archiver) const
+    {
+        Layer<ElementType>::WriteToArchive(archiver);
+
+        archiver["receptiveField"] << _convolutionalParameters.receptiveField;
+        archiver["stride"] << _convolutionalParameters.stride;
+        archiver["method"] << static_cast<int>(_convolutionalParameters.method);
+        archiver["numFiltersAtATime"] << _convolutionalParameters.numFiltersAtATime;
+
+        archiver["weightScales"] << _weightScales;
+        std::vector<char> temp(_quantizedWeights.size());
+        for (size_t index = 0; index < _quantizedWeights.size(); ++index)
+        {
+            temp[index] = static_cast<char>(_quantizedWeights[index]);
+        }
+        archiver["quantizedWeights"] << temp;
+    }
+
+    template <typename ElementType>
+    void QuantizedConvolutionalLayer<ElementType>::ReadFromArchive(utilities::Unarchiver& archiver)
+    {
+        Layer<ElementType>::ReadFromArchive(archiver);
+
+        archiver["receptiveField"] >> _convolutionalParameters.receptiveField;
+        archiver["stride"] >> _convolutionalParameters.stride;
+        int method;
+        archiver["method"] >> method;
+        _convolutionalParameters.method = static_cast<ConvolutionMethod>(method);
+        archiver["numFiltersAtATime"] >> _convolutionalParameters.numFiltersAtATime;
+
+        archiver["weightScales"] >> _weightScales;
+        std::vector<char> temp;
+        archiver["quantizedWeights"] >> temp;
+        _quantizedWeights.resize(temp.size());
+        for (size_t index = 0; index < temp.size(); ++index)
+        {
+            _quantizedWeights[index] = static_cast<int8_t>(temp[index]);
+        }
+    }
+
+}
+}
+}
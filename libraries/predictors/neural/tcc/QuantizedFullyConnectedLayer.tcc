@@ -0,0 +1,193 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     QuantizedFullyConnectedLayer.tcc (neural)
+//  Authors:  Byron Changuion
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// stl
+#include <algorithm>
+#include <cmath>
+
+namespace ell
+{
+namespace predictors
+{
+namespace neural
+{
+    template <typename ElementType>
+    int8_t QuantizedFullyConnectedLayer<ElementType>::QuantizeValue(ElementType value, ElementType scale)
+    {
+        auto quantized = std::round(value / scale);
+        if (quantized > 127) quantized = 127;
+        if (quantized < -127) quantized = -127;
+        return static_cast<int8_t>(quantized);
+    }
+
+    template <typename ElementType>
+    QuantizedFullyConnectedLayer<ElementType>::QuantizedFullyConnectedLayer(const LayerParameters& layerParameters, MatrixReferenceType& weights) :
+        Layer<ElementType>(layerParameters),
+        _shapedInput(layerParameters.input.Size()),
+        _quantizedInput(layerParameters.input.Size())
+    {
+        if (weights.NumRows() != GetOutputMinusPadding().Size())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "weights dimension for a quantized fully connected layer should be the same as number of output nodes times inputs per node");
+        }
+
+        MatrixType weightsMatrix(weights.NumRows(), weights.NumColumns());
+        weightsMatrix = weights;
+        QuantizeWeights(weightsMatrix);
+    }
+
+    template <typename ElementType>
+    QuantizedFullyConnectedLayer<ElementType>::QuantizedFullyConnectedLayer(const LayerParameters& layerParameters, ConstTensorReferenceType& weights) :
+        Layer<ElementType>(layerParameters),
+        _shapedInput(layerParameters.input.Size()),
+        _quantizedInput(layerParameters.input.Size())
+    {
+        // Reshape the weights into a matrix where each row represents an output neuron and each
+        // column corresponds to the weight for that input
+        MatrixType weightsMatrix(GetOutputMinusPadding().Size(), layerParameters.input.Size());
+        const size_t rowIncrement = layerParameters.input.NumColumns() * layerParameters.input.NumChannels();
+        const size_t columnIncrement = layerParameters.input.NumChannels();
+        for (size_t outRow = 0; outRow < weightsMatrix.NumRows(); outRow++)
+        {
+            for (size_t i = 0; i < layerParameters.input.NumRows(); i++)
+            {
+                for (size_t j = 0; j < layerParameters.input.NumColumns(); j++)
+                {
+                    for (size_t k = 0; k < layerParameters.input.NumChannels(); k++)
+                    {
+                        size_t column = (i * rowIncrement) + (j * columnIncrement) + k;
+                        weightsMatrix(outRow, column) = weights(outRow * layerParameters.input.NumRows() + i, j, k);
+                    }
+                }
+            }
+        }
+        QuantizeWeights(weightsMatrix);
+    }
+
+    template <typename ElementType>
+    void QuantizedFullyConnectedLayer<ElementType>::QuantizeWeights(const MatrixType& weights)
+    {
+        const size_t numOutputs = weights.NumRows();
+        const size_t numInputs = weights.NumColumns();
+        _quantizedWeights.resize(numOutputs * numInputs);
+        _weightScales.resize(numOutputs);
+
+        for (size_t row = 0; row < numOutputs; row++)
+        {
+            ElementType maxAbsValue = 0;
+            for (size_t column = 0; column < numInputs; column++)
+            {
+                maxAbsValue = std::max(maxAbsValue, std::abs(weights(row, column)));
+            }
+
+            ElementType scale = (maxAbsValue == 0) ? static_cast<ElementType>(1) : maxAbsValue / static_cast<ElementType>(127);
+            _weightScales[row] = scale;
+            for (size_t column = 0; column < numInputs; column++)
+            {
+                _quantizedWeights[row * numInputs + column] = QuantizeValue(weights(row, column), scale);
+            }
+        }
+    }
+
+    template <typename ElementType>
+    void QuantizedFullyConnectedLayer<ElementType>::Compute()
+    {
+        auto output = GetOutputMinusPadding();
+        auto& input = _layerParameters.input;
+        const size_t numOutputs = _weightScales.size();
+        const size_t numInputs = _quantizedWeights.size() / numOutputs;
+        _shapedInput.resize(numInputs);
+        _quantizedInput.resize(numInputs);
+
+        // Reshape the input into a vector
+        size_t columnIndex = 0;
+        for (size_t i = 0; i < input.NumRows(); i++)
+        {
+            for (size_t j = 0; j < input.NumColumns(); j++)
+            {
+                for (size_t k = 0; k < input.NumChannels(); k++)
+                {
+                    _shapedInput[columnIndex++] = input(i, j, k);
+                }
+            }
+        }
+
+        // Quantize the input with a single dynamically-chosen scale
+        ElementType maxAbsValue = math::MaxAbsValue(_shapedInput.data(), numInputs);
+        ElementType inputScale = (maxAbsValue == 0) ? static_cast<ElementType>(1) : maxAbsValue / static_cast<ElementType>(127);
+        math::QuantizeValues(_shapedInput.data(), _quantizedInput.data(), numInputs, inputScale);
+
+        // Integer multiply-accumulate, then scale the accumulated result back to ElementType
+        columnIndex = 0;
+        for (size_t i = 0; i < output.NumRows(); i++)
+        {
+            for (size_t j = 0; j < output.NumColumns(); j++)
+            {
+                for (size_t k = 0; k < output.NumChannels(); k++)
+                {
+                    size_t row = columnIndex++;
+                    const int8_t* weightsRow = &_quantizedWeights[row * numInputs];
+                    int32_t accumulator = 0;
+                    for (size_t index = 0; index < numInputs; index++)
+                    {
+                        accumulator += static_cast<int32_t>(weightsRow[index]) * static_cast<int32_t>(_quantizedInput[index]);
+                    }
+                    output(i, j, k) = static_cast<ElementType>(accumulator) * _weightScales[row] * inputScale;
+                }
+            }
+        }
+    }
+
+    template <typename ElementType>
+    typename QuantizedFullyConnectedLayer<ElementType>::MatrixType QuantizedFullyConnectedLayer<ElementType>::GetDequantizedWeights() const
+    {
+        const size_t numOutputs = _weightScales.size();
+        const size_t numInputs = _quantizedWeights.size() / numOutputs;
+        MatrixType weights(numOutputs, numInputs);
+        for (size_t row = 0; row < numOutputs; row++)
+        {
+            for (size_t column = 0; column < numInputs; column++)
+            {
+                weights(row, column) = static_cast<ElementType>(_quantizedWeights[row * numInputs + column]) * _weightScales[row];
+            }
+        }
+        return weights;
+    }
+
+    template <typename ElementType>
+    void QuantizedFullyConnectedLayer<ElementType>::WriteToArchive(utilities::Archiver& archiver) const
+    {
+        Layer<ElementType>::WriteToArchive(archiver);
+
+        archiver["weightScales"] << _weightScales;
+        std::vector<char> temp(_quantizedWeights.size());
+        for (size_t index = 0; index < _quantizedWeights.size(); ++index)
+        {
+            temp[index] = static_cast<char>(_quantizedWeights[index]);
+        }
+        archiver["quantizedWeights"] << temp;
+    }
+
+    template <typename ElementType>
+    void QuantizedFullyConnectedLayer<ElementType>::ReadFromArchive(utilities::Unarchiver& archiver)
+    {
+        Layer<ElementType>::ReadFromArchive(archiver);
+
+        archiver["weightScales"] >> _weightScales;
+        std::vector<char> temp;
+        archiver["quantizedWeights"] >> temp;
+        _quantizedWeights.resize(temp.size());
+        for (size_t index = 0; index < temp.size(); ++index)
+        {
+            _quantizedWeights[index] = static_cast<int8_t>(temp[index]);
+        }
+    }
+
+}
+}
+}
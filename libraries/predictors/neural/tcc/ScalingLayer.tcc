@@ -25,8 +25,16 @@ namespace neural
         auto output = GetOutputMinusPadding();
         auto& input = _layerParameters.input;
 
-        AssignValues(input, output);
-        math::TensorOperations::Multiply<math::Dimension::channel>(_scales, output);
+        if (input.NumRows() != output.NumRows() || input.NumColumns() != output.NumColumns() || input.NumChannels() != output.NumChannels())
+        {
+            // undersized input: copy it into the corner of the output, then operate in place
+            AssignValues(input, output);
+            math::TensorOperations::Multiply<math::Dimension::channel>(_scales, output);
+            return;
+        }
+
+        // single stride-aware pass over the input and output views, with no intermediate copy
+        math::TensorOperations::Multiply<math::Dimension::channel>(_scales, input, output);
     }
 
     template <typename ElementType>
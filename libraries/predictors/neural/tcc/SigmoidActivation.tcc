@@ -7,7 +7,7 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 // math
-#include <cmath>
+#include "FastMath.h"
 
 namespace ell
 {
@@ -18,18 +18,8 @@ namespace neural
     template <typename ElementType>
     ElementType SigmoidActivation<ElementType>::Apply(const ElementType input) const
     {
-        ElementType output;
-        if (input >= 0.0)
-        {
-            double exp_value = std::exp(-input);
-            output = static_cast<ElementType>(1.0 / (1.0 + exp_value));
-        }
-        else
-        {
-            double exp_value = std::exp(input);
-            output = static_cast<ElementType>(exp_value / (1.0 + exp_value));
-        }
-        return output;
+        // the approximation clamps internally, so it is stable at both tails
+        return math::FastMath::Sigmoid(input);
     }
 }
 }
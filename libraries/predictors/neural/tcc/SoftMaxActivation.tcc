@@ -6,6 +6,9 @@
 //
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+// math
+#include "FastMath.h"
+
 // STL
 #include <limits>
 
@@ -31,7 +34,7 @@ namespace neural
         }
         for (size_t i = 0; i < input.Size(); i++)
         {
-            double eulerVal = std::exp(input[i] - maxVal);
+            double eulerVal = math::FastMath::Exp(input[i] - maxVal);
             output[i] = eulerVal;
             sum += eulerVal;
         }
@@ -73,7 +76,7 @@ namespace neural
                 for (size_t k = 0; k < input.NumChannels(); k++)
                 {
                     ElementType value = input(i, j, k);
-                    ElementType eulerVal = std::exp(value - maxVal);
+                    ElementType eulerVal = math::FastMath::Exp(value - maxVal);
                     output(i, j, k) = eulerVal;
                     sum += eulerVal;
                 }
@@ -6,6 +6,9 @@
 //
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+// math
+#include "FastMath.h"
+
 // STL
 #include <limits>
 
@@ -58,7 +61,7 @@ namespace neural
                 for (size_t k = 0; k < input.NumChannels(); k++)
                 {
                     ElementType value = input(i, j, k);
-                    ElementType eulerVal = std::exp(value - maxValue);
+                    ElementType eulerVal = math::FastMath::Exp(value - maxValue);
                     output(i, j, k) = eulerVal;
                     sum += eulerVal;
                 }
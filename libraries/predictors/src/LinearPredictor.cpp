@@ -9,6 +9,12 @@
 #include "LinearPredictor.h"
 #include "DataVectorOperations.h"
 
+// math
+#include "Operations.h"
+
+// utilities
+#include "Exception.h"
+
 // stl
 #include <memory>
 
@@ -47,6 +53,22 @@ namespace predictors
         return _w * dataVector + _b;
     }
 
+    double LinearPredictor::Predict(math::UnorientedConstVectorReference<double> input) const
+    {
+        return math::Operations::Dot(_w, input) + _b;
+    }
+
+    void LinearPredictor::PredictBatch(math::ConstMatrixReference<double, math::MatrixLayout::rowMajor> inputs, math::ColumnVectorReference<double> outputs) const
+    {
+        if (inputs.NumColumns() != _w.Size() || inputs.NumRows() != outputs.Size())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::sizeMismatch, "Error: batch dimensions don't match the predictor.");
+        }
+
+        math::Operations::Multiply(1.0, inputs, _w, 0.0, outputs);
+        math::Operations::Add(_b, outputs);
+    }
+
     auto LinearPredictor::GetWeightedElements(const DataVectorType& dataVector) const -> DataVectorType
     {
         auto transformation = [&](data::IndexValue indexValue) -> double { return indexValue.value * _w[indexValue.index]; };
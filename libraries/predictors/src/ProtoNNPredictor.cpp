@@ -8,6 +8,9 @@
 
 #include "ProtoNNPredictor.h"
 
+// math
+#include "FastMath.h"
+
 // stl
 #include <memory>
 
@@ -41,21 +44,30 @@ namespace predictors
         math::ColumnVector<double> projectedInput(GetProjectedDimension());
         math::Operations::Multiply(1.0, _W, data, 0.0, projectedInput);
 
-        // Similarity to each prototype
+        // Squared distance to each prototype. The prototype matrix is column-major, so each
+        // prototype is a contiguous column and the inner loop runs over contiguous memory,
+        // without the per-prototype temporaries the obvious vector formulation would allocate.
         auto numPrototypes = GetNumPrototypes();
+        auto projectedDimension = GetProjectedDimension();
         math::ColumnVector<double> similarityToPrototypes(numPrototypes);
-        auto prototypes = GetPrototypes();
-        auto gammaVal = GetGamma();
+        const auto* projected = projectedInput.GetDataPointer();
+        auto minusGammaSquared = -GetGamma() * GetGamma();
 
         for (size_t i = 0; i < numPrototypes; i++)
         {
-            math::ColumnVector<double> prototype(prototypes.GetColumn(i).ToArray());
-            prototype -= projectedInput;
-            auto prototypeDistance = prototype.Norm2();
-            auto similarity = std::exp(-1 * gammaVal * gammaVal * prototypeDistance * prototypeDistance);
-            similarityToPrototypes[i] = similarity;
+            const auto* prototype = _B.GetColumn(i).GetDataPointer();
+            double squaredDistance = 0;
+            for (size_t j = 0; j < projectedDimension; j++)
+            {
+                auto difference = projected[j] - prototype[j];
+                squaredDistance += difference * difference;
+            }
+            similarityToPrototypes[i] = minusGammaSquared * squaredDistance;
         }
 
+        // Turn the scaled distances into RBF similarities with one vectorized pass
+        math::FastMath::Exp(similarityToPrototypes.GetDataPointer(), numPrototypes);
+
         // Get the prediction label
         math::ColumnVector<double> labels(GetNumLabels());
         math::Operations::Multiply(1.0, GetLabelEmbeddings(), similarityToPrototypes, 0.0, labels);
@@ -122,6 +122,96 @@ namespace predictors
         return output;
     }
 
+    template <typename SplitRuleType, typename EdgePredictorType>
+    void ForestPredictor<SplitRuleType, EdgePredictorType>::PredictBatch(const std::vector<DataVectorType>& inputs, std::vector<double>& outputs) const
+    {
+        outputs.assign(inputs.size(), _bias);
+
+        // tree-major: walk one tree over the whole batch before touching the next tree
+        for (auto treeRootIndex : _rootIndices)
+        {
+            for (size_t i = 0; i < inputs.size(); ++i)
+            {
+                outputs[i] += Predict(inputs[i], treeRootIndex);
+            }
+        }
+    }
+
+    template <typename SplitRuleType, typename EdgePredictorType>
+    double ForestPredictor<SplitRuleType, EdgePredictorType>::PredictSign(const DataVectorType& input) const
+    {
+        EnsureSuffixOutputBounds();
+
+        double output = _bias;
+        for (size_t i = 0; i < _rootIndices.size(); ++i)
+        {
+            // exit as soon as the trees not yet evaluated cannot flip the sign of the running sum
+            if (output + _suffixLowerBounds[i] > 0 || output + _suffixUpperBounds[i] < 0)
+            {
+                break;
+            }
+            output += Predict(input, _rootIndices[i]);
+        }
+        return output;
+    }
+
+    template <typename SplitRuleType, typename EdgePredictorType>
+    std::pair<double, double> ForestPredictor<SplitRuleType, EdgePredictorType>::GetSubtreeOutputRange(size_t interiorNodeIndex) const
+    {
+        if (interiorNodeIndex >= _interiorNodes.size())
+        {
+            return { 0.0, 0.0 };
+        }
+
+        const auto& interiorNode = _interiorNodes[interiorNodeIndex];
+        bool first = true;
+        double minOutput = 0.0;
+        double maxOutput = 0.0;
+        for (const auto& edge : interiorNode._outgoingEdges)
+        {
+            // only valid for edge predictors whose output doesn't depend on the input
+            double edgeMin = edge.GetPredictor().GetValue();
+            double edgeMax = edgeMin;
+            if (edge.IsTargetInterior())
+            {
+                auto subtreeRange = GetSubtreeOutputRange(edge.GetTargetNodeIndex());
+                edgeMin += subtreeRange.first;
+                edgeMax += subtreeRange.second;
+            }
+
+            minOutput = first ? edgeMin : std::min(minOutput, edgeMin);
+            maxOutput = first ? edgeMax : std::max(maxOutput, edgeMax);
+            first = false;
+        }
+
+        // the split rule can eject early (negative edge position), which contributes zero
+        minOutput = std::min(minOutput, 0.0);
+        maxOutput = std::max(maxOutput, 0.0);
+        return { minOutput, maxOutput };
+    }
+
+    template <typename SplitRuleType, typename EdgePredictorType>
+    void ForestPredictor<SplitRuleType, EdgePredictorType>::EnsureSuffixOutputBounds() const
+    {
+        if (_suffixLowerBounds.size() == _rootIndices.size() && _suffixUpperBounds.size() == _rootIndices.size())
+        {
+            return;
+        }
+
+        _suffixLowerBounds.assign(_rootIndices.size(), 0.0);
+        _suffixUpperBounds.assign(_rootIndices.size(), 0.0);
+        double lowerBound = 0.0;
+        double upperBound = 0.0;
+        for (size_t i = _rootIndices.size(); i > 0; --i)
+        {
+            auto treeRange = GetSubtreeOutputRange(_rootIndices[i - 1]);
+            lowerBound += treeRange.first;
+            upperBound += treeRange.second;
+            _suffixLowerBounds[i - 1] = lowerBound;
+            _suffixUpperBounds[i - 1] = upperBound;
+        }
+    }
+
     template <typename SplitRuleType, typename EdgePredictorType>
     std::vector<bool> ForestPredictor<SplitRuleType, EdgePredictorType>::GetEdgeIndicatorVector(const DataVectorType& input) const
     {
@@ -225,6 +315,8 @@ namespace predictors
         archiver["rootIndices"] >> _rootIndices;
         archiver["bias"] >> _bias;
         archiver["numEdges"] >> _numEdges;
+        _suffixLowerBounds.clear();
+        _suffixUpperBounds.clear();
     }
 
     template <typename SplitRuleType, typename EdgePredictorType>
@@ -258,6 +350,10 @@ namespace predictors
         // increment global edge count
         _numEdges += numEdges;
 
+        // the cached suffix bounds no longer cover the forest
+        _suffixLowerBounds.clear();
+        _suffixUpperBounds.clear();
+
         return interiorNodeIndex;
     }
 
@@ -9,6 +9,9 @@
 #include "NeuralNetworkPredictor.h"
 
 //stl
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
 #include <iostream>
 
 namespace ell
@@ -21,6 +24,61 @@ namespace predictors
         _layers(std::move(layers)),
         _output(_layers.back()->GetOutput().Size())
     {
+        PlanOutputBuffers();
+    }
+
+    template <typename ElementType>
+    void NeuralNetworkPredictor<ElementType>::PlanOutputBuffers()
+    {
+        if (_layers.size() < 3)
+        {
+            return; // sharing output storage saves nothing on shallow networks
+        }
+
+        // A layer can write into shared storage only if the next layer's input references this
+        // layer's entire output, so that the input reference can be redirected along with the output.
+        auto isShareable = [this](size_t i) {
+            if (i + 1 == _layers.size())
+            {
+                return true;
+            }
+            const auto& nextInput = _layers[i + 1]->GetLayerParameters().input;
+            auto output = _layers[i]->GetOutput();
+            return nextInput.GetDataPointer() == output.GetDataPointer() && nextInput.GetShape() == output.GetShape();
+        };
+
+        // compute the maximum footprint of the even and odd numbered shareable layers
+        size_t evenSize = 0;
+        size_t oddSize = 0;
+        std::vector<bool> shareable(_layers.size());
+        for (size_t i = 0; i < _layers.size(); ++i)
+        {
+            shareable[i] = isShareable(i);
+            if (shareable[i])
+            {
+                auto shape = _layers[i]->GetOutputShape();
+                auto size = shape[0] * shape[1] * shape[2];
+                auto& maxSize = (i % 2 == 0) ? evenSize : oddSize;
+                maxSize = std::max(maxSize, size);
+            }
+        }
+
+        _evenOutputBuffer.resize(evenSize);
+        _oddOutputBuffer.resize(oddSize);
+
+        // redirect each shareable layer's output into its buffer and rewire the next layer's input
+        for (size_t i = 0; i < _layers.size(); ++i)
+        {
+            if (shareable[i])
+            {
+                auto& buffer = (i % 2 == 0) ? _evenOutputBuffer : _oddOutputBuffer;
+                _layers[i]->SetOutputMemory(buffer.data());
+                if (i + 1 < _layers.size())
+                {
+                    _layers[i + 1]->GetLayerParameters().input = _layers[i]->GetOutput();
+                }
+            }
+        }
     }
 
     template <typename ElementType>
@@ -43,6 +101,26 @@ namespace predictors
         return {};
     }
 
+    template <typename ElementType>
+    size_t NeuralNetworkPredictor<ElementType>::SelectConvolutionMethods()
+    {
+        size_t numChanged = 0;
+        for (auto& layer : _layers)
+        {
+            auto convolutionalLayer = dynamic_cast<neural::ConvolutionalLayer<ElementType>*>(layer.get());
+            if (convolutionalLayer != nullptr)
+            {
+                auto bestMethod = convolutionalLayer->SelectBestConvolutionMethod();
+                if (bestMethod != convolutionalLayer->GetConvolutionalParameters().method)
+                {
+                    convolutionalLayer->SetConvolutionMethod(bestMethod);
+                    ++numChanged;
+                }
+            }
+        }
+        return numChanged;
+    }
+
     template <typename ElementType>
     const std::vector<ElementType>& NeuralNetworkPredictor<ElementType>::Predict(const DataVectorType& dataVector) const
     {
@@ -50,12 +128,42 @@ namespace predictors
         {
             _inputLayer->SetInput(dataVector);
             _inputLayer->Compute();
+            if (_inputLayer->GetStoreOutputAsFloat16())
+            {
+                _inputLayer->RoundOutputToFloat16();
+            }
         }
 
         // Forward feed inputs through the layers
         for (size_t i = 0; i < _layers.size(); i++)
         {
-            _layers[i]->Compute();
+            auto& layer = *_layers[i];
+            if (layer.UsesSharedOutputMemory() && neural::HasPadding(layer.GetLayerParameters().outputPaddingParameters))
+            {
+                // a later layer may have overwritten this layer's output padding since the last time
+                // this layer computed, so restore the padding values before computing
+                layer.ReinitializeOutputValues();
+            }
+
+            std::chrono::steady_clock::time_point start;
+            if (_profilingEnabled)
+            {
+                start = std::chrono::steady_clock::now();
+            }
+            layer.Compute();
+            if (_profilingEnabled)
+            {
+                auto duration = std::chrono::steady_clock::now() - start;
+                auto& statistics = _layerStatistics[i];
+                ++statistics.invocationCount;
+                statistics.totalTimeMilliseconds += std::chrono::duration<double, std::milli>(duration).count();
+                statistics.bytesTouched += (layer.GetLayerParameters().input.Size() + layer.GetOutput().Size()) * sizeof(ElementType);
+            }
+            if (layer.GetStoreOutputAsFloat16())
+            {
+                // downstream layers see exactly the values a half-precision activation buffer would hold
+                layer.RoundOutputToFloat16();
+            }
             // Uncomment the following line to print layer info
             //_layers[i]->Print(std::cout);
         }
@@ -85,6 +193,53 @@ namespace predictors
         return _output;
     }
 
+    template <typename ElementType>
+    void NeuralNetworkPredictor<ElementType>::PredictBatch(const std::vector<DataVectorType>& inputs, std::vector<std::vector<ElementType>>& outputs) const
+    {
+        outputs.resize(inputs.size());
+        for (size_t i = 0; i < inputs.size(); ++i)
+        {
+            // the layer passes write into the network's persistent buffers, which stay warm
+            // across the batch; copy each result out before the next example overwrites them
+            const auto& prediction = Predict(inputs[i]);
+            outputs[i].assign(prediction.begin(), prediction.end());
+        }
+    }
+
+    template <typename ElementType>
+    void NeuralNetworkPredictor<ElementType>::SetProfilingEnabled(bool enable)
+    {
+        _profilingEnabled = enable;
+        _layerStatistics.clear();
+        if (enable)
+        {
+            _layerStatistics.resize(_layers.size());
+            for (size_t i = 0; i < _layers.size(); ++i)
+            {
+                _layerStatistics[i].layerName = neural::LayerNames[static_cast<int>(_layers[i]->GetLayerType())];
+            }
+        }
+    }
+
+    template <typename ElementType>
+    void NeuralNetworkPredictor<ElementType>::PrintLayerStatistics(std::ostream& os) const
+    {
+        os << std::left << std::setw(8) << "layer" << std::setw(26) << "type" << std::right << std::setw(8) << "calls" << std::setw(12) << "time (ms)" << std::setw(14) << "ms / call" << std::setw(14) << "MB touched" << "\n";
+        double totalTime = 0;
+        size_t totalBytes = 0;
+        for (size_t i = 0; i < _layerStatistics.size(); ++i)
+        {
+            const auto& statistics = _layerStatistics[i];
+            double timePerCall = statistics.invocationCount > 0 ? statistics.totalTimeMilliseconds / statistics.invocationCount : 0;
+            os << std::left << std::setw(8) << i << std::setw(26) << statistics.layerName << std::right << std::setw(8) << statistics.invocationCount;
+            os << std::fixed << std::setprecision(3) << std::setw(12) << statistics.totalTimeMilliseconds << std::setw(14) << timePerCall << std::setw(14) << statistics.bytesTouched / 1.0e6 << "\n";
+            totalTime += statistics.totalTimeMilliseconds;
+            totalBytes += statistics.bytesTouched;
+        }
+        os << std::left << std::setw(8) << "" << std::setw(26) << "total" << std::right << std::setw(8) << "";
+        os << std::fixed << std::setprecision(3) << std::setw(12) << totalTime << std::setw(14) << "" << std::setw(14) << totalBytes / 1.0e6 << "\n";
+    }
+
     template <typename ElementType>
     void NeuralNetworkPredictor<ElementType>::WriteToArchive(utilities::Archiver& archiver) const
     {
@@ -119,6 +274,8 @@ namespace predictors
         archiver["output"] >> _output;
 
         archiver.PopContext();
+
+        PlanOutputBuffers();
     }
 
     template <typename ElementType>
@@ -133,9 +290,12 @@ namespace predictors
         context.GetTypeFactory().AddType<neural::Layer<ElementType>, neural::BiasLayer<ElementType>>();
         context.GetTypeFactory().AddType<neural::Layer<ElementType>, neural::BinaryConvolutionalLayer<ElementType>>();
         context.GetTypeFactory().AddType<neural::Layer<ElementType>, neural::ConvolutionalLayer<ElementType>>();
+        context.GetTypeFactory().AddType<neural::Layer<ElementType>, neural::DepthwiseConvolutionalLayer<ElementType>>();
         context.GetTypeFactory().AddType<neural::Layer<ElementType>, neural::FullyConnectedLayer<ElementType>>();
         context.GetTypeFactory().AddType<neural::Layer<ElementType>, neural::PoolingLayer<ElementType, MaxPoolingFunction>>();
         context.GetTypeFactory().AddType<neural::Layer<ElementType>, neural::PoolingLayer<ElementType, MeanPoolingFunction>>();
+        context.GetTypeFactory().AddType<neural::Layer<ElementType>, neural::QuantizedConvolutionalLayer<ElementType>>();
+        context.GetTypeFactory().AddType<neural::Layer<ElementType>, neural::QuantizedFullyConnectedLayer<ElementType>>();
         context.GetTypeFactory().AddType<neural::Layer<ElementType>, neural::ScalingLayer<ElementType>>();
         context.GetTypeFactory().AddType<neural::Layer<ElementType>, neural::SoftmaxLayer<ElementType>>();
         context.GetTypeFactory().AddType<NeuralNetworkPredictor<ElementType>, NeuralNetworkPredictor<ElementType>>();
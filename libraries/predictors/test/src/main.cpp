@@ -7,15 +7,20 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "ForestPredictor.h"
+#include "LinearPredictor.h"
 #include "NeuralNetworkPredictor.h"
 #include "ReLUActivation.h"
 #include "LeakyReLUActivation.h"
 #include "MaxPoolingFunction.h"
+#include "MeanPoolingFunction.h"
 #include "ProtoNNPredictor.h"
 
 // testing
 #include "testing.h"
 
+// stl
+#include <sstream>
+
 using namespace ell;
 
 bool Equals(double a, double b)
@@ -74,11 +79,80 @@ void ForestPredictorTest()
     output = forest.Predict(ExampleType{ 0.25, 0.7, 0.0 });
     testing::ProcessTest("Testing ForestPredictor, Compute()", testing::IsEqual(output, 4.0, 1.0e-8));
 
+    // test PredictSign - the sign always matches the full prediction
+    output = forest.PredictSign(ExampleType{ 0.18, 0.5, 0.0 });
+    testing::ProcessTest("Testing ForestPredictor, PredictSign() negative", output < 0);
+
+    output = forest.PredictSign(ExampleType{ 0.25, 0.7, 0.0 });
+    testing::ProcessTest("Testing ForestPredictor, PredictSign() positive", output > 0);
+
+    // with a large bias, the sign is determined before any tree is evaluated
+    forest.AddToBias(100.0);
+    output = forest.PredictSign(ExampleType{ 0.18, 0.5, 0.0 });
+    testing::ProcessTest("Testing ForestPredictor, PredictSign() early exit", output > 0);
+    forest.AddToBias(-100.0);
+
     // test path generation
     auto edgeIndicator = forest.GetEdgeIndicatorVector(ExampleType{ 0.25, 0.7, 0.0 });
     testing::ProcessTest("Testing ForestPredictor, SetEdgeIndicatorVector()", testing::IsEqual(edgeIndicator, std::vector<bool>{ 1, 0, 0, 1, 0, 0, 0, 1 }));
 }
 
+void PredictBatchTest()
+{
+    // define some abbreviations
+    using SplitAction = predictors::SimpleForestPredictor::SplitAction;
+    using SplitRule = predictors::SingleElementThresholdPredictor;
+    using EdgePredictorVector = std::vector<predictors::ConstantPredictor>;
+    using ExampleType = predictors::SimpleForestPredictor::DataVectorType;
+
+    // build the same small two-tree forest used by ForestPredictorTest
+    predictors::SimpleForestPredictor forest;
+    forest.Split(SplitAction{ forest.GetNewRootId(), SplitRule{ 0, 0.3 }, EdgePredictorVector{ -1.0, 1.0 } });
+    forest.Split(SplitAction{ forest.GetChildId(0, 0), SplitRule{ 1, 0.6 }, EdgePredictorVector{ -2.0, 2.0 } });
+    forest.Split(SplitAction{ forest.GetChildId(0, 1), SplitRule{ 2, 0.9 }, EdgePredictorVector{ -4.0, 4.0 } });
+    forest.Split(SplitAction{ forest.GetNewRootId(), SplitRule{ 0, 0.2 }, EdgePredictorVector{ -3.0, 3.0 } });
+
+    // the tree-major batch traversal must match the per-example predictions
+    std::vector<ExampleType> forestInputs;
+    forestInputs.emplace_back(ExampleType{ 0.18, 0.5, 0.0 });
+    forestInputs.emplace_back(ExampleType{ 0.25, 0.7, 0.0 });
+    forestInputs.emplace_back(ExampleType{ 0.5, 0.7, 1.0 });
+    forestInputs.emplace_back(ExampleType{ 0.2, 0.5, 0.0 });
+
+    std::vector<double> forestOutputs;
+    forest.PredictBatch(forestInputs, forestOutputs);
+
+    bool forestPassed = forestOutputs.size() == forestInputs.size();
+    for (size_t i = 0; i < forestInputs.size(); ++i)
+    {
+        forestPassed = forestPassed && testing::IsEqual(forestOutputs[i], forest.Predict(forestInputs[i]), 1.0e-8);
+    }
+    testing::ProcessTest("Testing ForestPredictor, PredictBatch()", forestPassed);
+
+    // the single gemv over a batch matrix must match the per-row dot products
+    math::ColumnVector<double> weights({ 1.0, -2.0, 3.0 });
+    predictors::LinearPredictor linear(weights, 0.5);
+
+    math::RowMatrix<double> linearInputs(4, 3);
+    for (size_t i = 0; i < linearInputs.NumRows(); ++i)
+    {
+        for (size_t j = 0; j < linearInputs.NumColumns(); ++j)
+        {
+            linearInputs(i, j) = 0.25 * static_cast<double>(i) - 0.5 * static_cast<double>(j);
+        }
+    }
+
+    math::ColumnVector<double> linearOutputs(4);
+    linear.PredictBatch(linearInputs, linearOutputs);
+
+    bool linearPassed = true;
+    for (size_t i = 0; i < linearInputs.NumRows(); ++i)
+    {
+        linearPassed = linearPassed && testing::IsEqual(linearOutputs[i], linear.Predict(linearInputs.GetRow(i)), 1.0e-8);
+    }
+    testing::ProcessTest("Testing LinearPredictor, PredictBatch()", linearPassed);
+}
+
 template <typename ElementType>
 void ActivationTest()
 {
@@ -305,6 +379,38 @@ void FullyConnectedLayerTest()
     auto output = connectedLayer.GetOutput();
     testing::ProcessTest("Testing FullyConnectedLayer, values", Equals(output(1, 1, 0), 5.0) && Equals(output(1, 2, 0), 6.0) && Equals(output(1, 3, 0), 7.0));
     testing::ProcessTest("Testing FullyConnectedLayer, padding", output(0, 0, 0) == 0 && output(0, 1, 0) == 0 && output(1, 4, 0) == 0 && output(2, 4, 0) == 0);
+
+    // Verify the block-sparse path against the dense gemv (2x2 blocks, with a zero block and
+    // partial blocks at the matrix edge)
+    MatrixType prunedWeights(3, 4);
+    prunedWeights(0, 0) = 1;
+    prunedWeights(0, 1) = 2;
+    prunedWeights(1, 0) = 3;
+    prunedWeights(1, 1) = 4;
+    prunedWeights(2, 2) = 5;
+    prunedWeights(2, 3) = 6;
+
+    FullyConnectedLayer<ElementType> denseLayer(parameters, prunedWeights);
+    denseLayer.Compute();
+    auto denseOutput = denseLayer.GetOutput();
+
+    FullyConnectedLayer<ElementType> sparseLayer(parameters, prunedWeights);
+    sparseLayer.UseBlockSparseWeights(2);
+    sparseLayer.Compute();
+    auto sparseOutput = sparseLayer.GetOutput();
+
+    bool blockSparseMatches = sparseLayer.HasBlockSparseWeights() && sparseLayer.GetWeightsBlockRows().size() == 2;
+    for (size_t i = 0; i < denseOutput.NumRows(); ++i)
+    {
+        for (size_t j = 0; j < denseOutput.NumColumns(); ++j)
+        {
+            for (size_t k = 0; k < denseOutput.NumChannels(); ++k)
+            {
+                blockSparseMatches &= Equals(sparseOutput(i, j, k), denseOutput(i, j, k));
+            }
+        }
+    }
+    testing::ProcessTest("Testing FullyConnectedLayer, block-sparse weights", blockSparseMatches);
 }
 
 template <typename ElementType>
@@ -336,6 +442,29 @@ void PoolingLayerTest()
 
     testing::ProcessTest("Testing PoolingLayer, values", Equals(output(1, 1, 0), 10) && Equals(output(1, 2, 0), 20) && Equals(output(2, 1, 0), 30) && Equals(output(2, 2, 0), 40) && Equals(output(1, 1, 1), 11) && Equals(output(1, 2, 1), 21) && Equals(output(2, 1, 1), 31) && Equals(output(2, 2, 1), 41));
     testing::ProcessTest("Testing PoolingLayer, padding", output(0, 0, 0) == 0 && output(0, 1, 0) == 0 && output(2, 3, 1) == 0 && output(3, 3, 1) == 0);
+
+    // Verify overlapping windows (3x3, stride 2), where the row cache is shared between neighboring outputs
+    TensorType overlapInput(5, 5, 1);
+    for (size_t overlapRow = 0; overlapRow < 5; overlapRow++)
+    {
+        for (size_t overlapColumn = 0; overlapColumn < 5; overlapColumn++)
+        {
+            overlapInput(overlapRow, overlapColumn, 0) = static_cast<ElementType>(overlapRow * 5 + overlapColumn + 1);
+        }
+    }
+    Shape overlapOutputShape = { 2, 2, 1 };
+    LayerParameters overlapParameters{ overlapInput, NoPadding(), overlapOutputShape, NoPadding() };
+    PoolingParameters overlapPoolingParams{ 3, 2 };
+
+    PoolingLayer<ElementType, MaxPoolingFunction> overlapMaxLayer(overlapParameters, overlapPoolingParams);
+    overlapMaxLayer.Compute();
+    auto overlapMaxOutput = overlapMaxLayer.GetOutput();
+    testing::ProcessTest("Testing PoolingLayer, overlapping max", Equals(overlapMaxOutput(0, 0, 0), 13) && Equals(overlapMaxOutput(0, 1, 0), 15) && Equals(overlapMaxOutput(1, 0, 0), 23) && Equals(overlapMaxOutput(1, 1, 0), 25));
+
+    PoolingLayer<ElementType, MeanPoolingFunction> overlapMeanLayer(overlapParameters, overlapPoolingParams);
+    overlapMeanLayer.Compute();
+    auto overlapMeanOutput = overlapMeanLayer.GetOutput();
+    testing::ProcessTest("Testing PoolingLayer, overlapping mean", Equals(overlapMeanOutput(0, 0, 0), 7) && Equals(overlapMeanOutput(0, 1, 0), 9) && Equals(overlapMeanOutput(1, 0, 0), 17) && Equals(overlapMeanOutput(1, 1, 0), 19));
 }
 
 template <typename ElementType>
@@ -385,13 +514,364 @@ void ConvolutionalLayerTest()
 
     testing::ProcessTest("Testing ConvolutionalLayer (diagonal), values", Equals(output(0, 0, 0), 10) && Equals(output(0, 0, 1), 15) && Equals(output(0, 1, 0), 18) && Equals(output(0, 1, 1), 18));
 
-    // Verify ConvolutionalLayer with regular method
+    // Verify ConvolutionalLayer with regular method (with only 2 input channels this takes the direct small-channel path)
     convolutionalParams.method = ConvolutionMethod::columnwise;
     ConvolutionalLayer<ElementType> convolutionalLayer2(parameters, convolutionalParams, weights);
     convolutionalLayer2.Compute();
     auto output2 = convolutionalLayer2.GetOutput();
 
     testing::ProcessTest("Testing ConvolutionalLayer (regular), values", Equals(output2(0, 0, 0), 10) && Equals(output2(0, 0, 1), 15) && Equals(output2(0, 1, 0), 18) && Equals(output2(0, 1, 1), 18));
+
+    // Verify ConvolutionalLayer with winograd method (odd-sized output exercises the direct leftover path)
+    convolutionalParams.method = ConvolutionMethod::winograd;
+    ConvolutionalLayer<ElementType> convolutionalLayer3(parameters, convolutionalParams, weights);
+    convolutionalLayer3.Compute();
+    auto output3 = convolutionalLayer3.GetOutput();
+
+    testing::ProcessTest("Testing ConvolutionalLayer (winograd), values", Equals(output3(0, 0, 0), 10) && Equals(output3(0, 0, 1), 15) && Equals(output3(0, 1, 0), 18) && Equals(output3(0, 1, 1), 18));
+
+    // Verify the winograd tile path on an even-sized output, against the columnwise method
+    TensorType input2(4, 4, 2); // Input includes padding
+    input2.Fill(0);
+    for (size_t i = 1; i < 3; i++)
+    {
+        for (size_t j = 1; j < 3; j++)
+        {
+            for (size_t k = 0; k < 2; k++)
+            {
+                input2(i, j, k) = static_cast<ElementType>(2 * i + j + k);
+            }
+        }
+    }
+    Shape outputShape2 = { 2, 2, 2 }; // Output has no padding
+    LayerParameters parameters2{ input2, ZeroPadding(1), outputShape2, NoPadding() };
+
+    convolutionalParams.method = ConvolutionMethod::winograd;
+    ConvolutionalLayer<ElementType> winogradLayer(parameters2, convolutionalParams, weights);
+    winogradLayer.Compute();
+    auto winogradOutput = winogradLayer.GetOutput();
+
+    convolutionalParams.method = ConvolutionMethod::columnwise;
+    ConvolutionalLayer<ElementType> columnwiseLayer(parameters2, convolutionalParams, weights);
+    columnwiseLayer.Compute();
+    auto columnwiseOutput = columnwiseLayer.GetOutput();
+
+    bool winogradMatches = true;
+    for (size_t i = 0; i < 2; i++)
+    {
+        for (size_t j = 0; j < 2; j++)
+        {
+            for (size_t k = 0; k < 2; k++)
+            {
+                winogradMatches &= Equals(winogradOutput(i, j, k), columnwiseOutput(i, j, k));
+            }
+        }
+    }
+    testing::ProcessTest("Testing ConvolutionalLayer (winograd), matches columnwise", winogradMatches);
+
+    // Verify cost-model method selection: whatever method it picks must produce the same output
+    ConvolutionalLayer<ElementType> autoLayer(parameters2, convolutionalParams, weights);
+    autoLayer.SetConvolutionMethod(autoLayer.SelectBestConvolutionMethod());
+    autoLayer.Compute();
+    auto autoOutput = autoLayer.GetOutput();
+    bool autoMatches = true;
+    for (size_t i = 0; i < 2; i++)
+    {
+        for (size_t j = 0; j < 2; j++)
+        {
+            for (size_t k = 0; k < 2; k++)
+            {
+                autoMatches &= Equals(autoOutput(i, j, k), columnwiseOutput(i, j, k));
+            }
+        }
+    }
+    testing::ProcessTest("Testing ConvolutionalLayer (auto-selected method), matches columnwise", autoMatches);
+
+    // Verify incremental computation: after a full compute, change a few input pixels and make
+    // sure the tile-based recompute matches a from-scratch computation of the new input
+    ConvolutionalLayer<ElementType> incrementalLayer(parameters2, convolutionalParams, weights);
+    incrementalLayer.EnableIncrementalCompute(2);
+    incrementalLayer.Compute(); // full compute, takes the first snapshot
+
+    input2(1, 2, 0) += 1;
+    input2(2, 1, 1) += 2;
+    incrementalLayer.Compute(); // only tiles containing the changed pixels are recomputed
+
+    ConvolutionalLayer<ElementType> referenceLayer(parameters2, convolutionalParams, weights);
+    referenceLayer.Compute();
+
+    auto incrementalOutput = incrementalLayer.GetOutput();
+    auto referenceOutput = referenceLayer.GetOutput();
+    bool incrementalMatches = true;
+    for (size_t i = 0; i < 2; i++)
+    {
+        for (size_t j = 0; j < 2; j++)
+        {
+            for (size_t k = 0; k < 2; k++)
+            {
+                incrementalMatches &= Equals(incrementalOutput(i, j, k), referenceOutput(i, j, k));
+            }
+        }
+    }
+    testing::ProcessTest("Testing ConvolutionalLayer (incremental), matches full compute", incrementalMatches);
+
+    // An unchanged input must leave the output untouched
+    incrementalLayer.Compute();
+    auto unchangedOutput = incrementalLayer.GetOutput();
+    bool unchangedMatches = true;
+    for (size_t i = 0; i < 2; i++)
+    {
+        for (size_t j = 0; j < 2; j++)
+        {
+            for (size_t k = 0; k < 2; k++)
+            {
+                unchangedMatches &= Equals(unchangedOutput(i, j, k), referenceOutput(i, j, k));
+            }
+        }
+    }
+    testing::ProcessTest("Testing ConvolutionalLayer (incremental), stable on unchanged input", unchangedMatches);
+
+    // Verify the columnwise gemm path on a layer with enough channels to not take the direct
+    // small-channel path, against the diagonal method
+    const size_t numDeepChannels = 5;
+    TensorType deepInput(4, 4, numDeepChannels); // Input includes padding
+    deepInput.Fill(0);
+    for (size_t i = 1; i < 3; i++)
+    {
+        for (size_t j = 1; j < 3; j++)
+        {
+            for (size_t k = 0; k < numDeepChannels; k++)
+            {
+                deepInput(i, j, k) = static_cast<ElementType>((i * j + k) % 4) - 1;
+            }
+        }
+    }
+    Shape deepOutputShape = { 2, 2, 2 };
+    LayerParameters deepParameters{ deepInput, ZeroPadding(1), deepOutputShape, NoPadding() };
+    ConvolutionalParameters deepConvolutionalParams{ 3, 1, ConvolutionMethod::columnwise, 2 };
+    TensorType deepWeights(deepConvolutionalParams.receptiveField * deepOutputShape[2], deepConvolutionalParams.receptiveField, numDeepChannels);
+    for (size_t f = 0; f < deepOutputShape[2]; f++)
+    {
+        for (size_t i = 0; i < deepConvolutionalParams.receptiveField; i++)
+        {
+            for (size_t j = 0; j < deepConvolutionalParams.receptiveField; j++)
+            {
+                for (size_t k = 0; k < numDeepChannels; k++)
+                {
+                    deepWeights(f * deepConvolutionalParams.receptiveField + i, j, k) = static_cast<ElementType>((f + 2 * i + 3 * j + k) % 5) - 2;
+                }
+            }
+        }
+    }
+
+    ConvolutionalLayer<ElementType> deepColumnwiseLayer(deepParameters, deepConvolutionalParams, deepWeights);
+    deepColumnwiseLayer.Compute();
+    auto deepColumnwiseOutput = deepColumnwiseLayer.GetOutput();
+
+    deepConvolutionalParams.method = ConvolutionMethod::diagonal;
+    ConvolutionalLayer<ElementType> deepDiagonalLayer(deepParameters, deepConvolutionalParams, deepWeights);
+    deepDiagonalLayer.Compute();
+    auto deepDiagonalOutput = deepDiagonalLayer.GetOutput();
+
+    bool deepMatches = true;
+    for (size_t i = 0; i < 2; i++)
+    {
+        for (size_t j = 0; j < 2; j++)
+        {
+            for (size_t k = 0; k < 2; k++)
+            {
+                deepMatches &= Equals(deepColumnwiseOutput(i, j, k), deepDiagonalOutput(i, j, k));
+            }
+        }
+    }
+    testing::ProcessTest("Testing ConvolutionalLayer (columnwise gemm), matches diagonal", deepMatches);
+}
+
+template <typename ElementType>
+void DepthwiseConvolutionalLayerTest()
+{
+    using namespace ell::predictors;
+    using namespace ell::predictors::neural;
+    using LayerParameters = typename Layer<ElementType>::LayerParameters;
+    using TensorType = typename Layer<ElementType>::TensorType;
+    using Shape = typename Layer<ElementType>::Shape;
+
+    // Verify DepthwiseConvolutionalLayer on a small input
+    TensorType input(3, 4, 2); // Input includes padding
+    input.Fill(0);
+    input(1, 1, 0) = 2;
+    input(1, 2, 0) = 1;
+    input(1, 1, 1) = 3;
+    input(1, 2, 1) = 2;
+    Shape outputShape = { 1, 2, 2 }; // Output has no padding, same number of channels as the input
+    LayerParameters parameters{ input, ZeroPadding(1), outputShape, NoPadding() };
+    ConvolutionalParameters convolutionalParams{ 3, 1, ConvolutionMethod::columnwise, 2 };
+
+    // One receptive field per input channel, stacked in the row dimension
+    TensorType weights(input.NumChannels() * convolutionalParams.receptiveField, convolutionalParams.receptiveField, 1);
+    std::vector<ElementType> weightsVector{ // RowMajor, one kernel per channel
+        1, 3, 2, 3, 1, 1, 2, 3, 1,
+        2, 4, 1, 3, 1, 2, 1, 4, 2 };
+    size_t vectorIndex = 0;
+    for (size_t k = 0; k < input.NumChannels(); k++)
+    {
+        for (size_t i = 0; i < convolutionalParams.receptiveField; i++)
+        {
+            for (size_t j = 0; j < convolutionalParams.receptiveField; j++)
+            {
+                weights(k * convolutionalParams.receptiveField + i, j, 0) = weightsVector[vectorIndex++];
+            }
+        }
+    }
+
+    DepthwiseConvolutionalLayer<ElementType> depthwiseLayer(parameters, convolutionalParams, weights);
+    depthwiseLayer.Compute();
+    auto output = depthwiseLayer.GetOutput();
+
+    // Each output channel only sees its own input channel:
+    // channel 0: 2*w(1,1) + 1*w(1,2) = 2*1 + 1*1 = 3
+    // channel 1: 3*w(1,1) + 2*w(1,2) = 3*1 + 2*2 = 7
+    testing::ProcessTest("Testing DepthwiseConvolutionalLayer, values", Equals(output(0, 0, 0), 3) && Equals(output(0, 0, 1), 7) && Equals(output(0, 1, 0), 7) && Equals(output(0, 1, 1), 11));
+
+    // Verify against a full ConvolutionalLayer whose filters are zero outside their own channel
+    TensorType fullWeights(outputShape[2] * convolutionalParams.receptiveField, convolutionalParams.receptiveField, input.NumChannels());
+    fullWeights.Fill(0);
+    for (size_t f = 0; f < outputShape[2]; f++)
+    {
+        for (size_t i = 0; i < convolutionalParams.receptiveField; i++)
+        {
+            for (size_t j = 0; j < convolutionalParams.receptiveField; j++)
+            {
+                fullWeights(f * convolutionalParams.receptiveField + i, j, f) = weights(f * convolutionalParams.receptiveField + i, j, 0);
+            }
+        }
+    }
+
+    ConvolutionalLayer<ElementType> referenceLayer(parameters, convolutionalParams, fullWeights);
+    referenceLayer.Compute();
+    auto referenceOutput = referenceLayer.GetOutput();
+
+    bool matchesReference = true;
+    for (size_t i = 0; i < outputShape[0]; i++)
+    {
+        for (size_t j = 0; j < outputShape[1]; j++)
+        {
+            for (size_t k = 0; k < outputShape[2]; k++)
+            {
+                matchesReference &= Equals(output(i, j, k), referenceOutput(i, j, k));
+            }
+        }
+    }
+    testing::ProcessTest("Testing DepthwiseConvolutionalLayer, matches full convolution", matchesReference);
+}
+
+template <typename ElementType>
+void QuantizedFullyConnectedLayerTest()
+{
+    using namespace ell::predictors;
+    using namespace ell::predictors::neural;
+    using LayerParameters = typename Layer<ElementType>::LayerParameters;
+    using TensorType = typename Layer<ElementType>::TensorType;
+    using Shape = typename Layer<ElementType>::Shape;
+    using MatrixType = typename Layer<ElementType>::MatrixType;
+
+    // Verify QuantizedFullyConnectedLayer against the full-precision layer
+    TensorType input(2, 2, 1);
+    input.Fill(1);
+    Shape outputShape = { 3, 5, 1 };
+    LayerParameters parameters{ input, NoPadding(), outputShape, ZeroPadding(1) };
+    MatrixType weights(3, 4);
+    weights(0, 0) = 1;
+    weights(0, 1) = 1;
+    weights(0, 2) = 1;
+    weights(0, 3) = 2;
+    weights(1, 0) = 1;
+    weights(1, 1) = 1;
+    weights(1, 2) = 1;
+    weights(1, 3) = 3;
+    weights(2, 0) = 1;
+    weights(2, 1) = 1;
+    weights(2, 2) = 1;
+    weights(2, 3) = 4;
+
+    FullyConnectedLayer<ElementType> referenceLayer(parameters, weights);
+    referenceLayer.Compute();
+    auto referenceOutput = referenceLayer.GetOutput();
+
+    QuantizedFullyConnectedLayer<ElementType> quantizedLayer(parameters, weights);
+    quantizedLayer.Compute();
+    auto output = quantizedLayer.GetOutput();
+
+    // Quantization introduces a small error, so compare with a tolerance
+    bool matches = true;
+    for (size_t j = 1; j < 4; j++)
+    {
+        matches &= (std::abs(output(1, j, 0) - referenceOutput(1, j, 0)) < static_cast<ElementType>(0.5));
+    }
+    testing::ProcessTest("Testing QuantizedFullyConnectedLayer, values", matches);
+    testing::ProcessTest("Testing QuantizedFullyConnectedLayer, padding", output(0, 0, 0) == 0 && output(0, 1, 0) == 0 && output(1, 4, 0) == 0 && output(2, 4, 0) == 0);
+    testing::ProcessTest("Testing QuantizedFullyConnectedLayer, weight storage", quantizedLayer.GetQuantizedWeights().size() == 12 && quantizedLayer.GetWeightScales().size() == 3);
+}
+
+template <typename ElementType>
+void QuantizedConvolutionalLayerTest()
+{
+    using namespace ell::predictors;
+    using namespace ell::predictors::neural;
+    using LayerParameters = typename Layer<ElementType>::LayerParameters;
+    using TensorType = typename Layer<ElementType>::TensorType;
+    using Shape = typename Layer<ElementType>::Shape;
+
+    // Verify QuantizedConvolutionalLayer against the full-precision columnwise method
+    TensorType input(3, 4, 2); // Input includes padding
+    input.Fill(0);
+    input(1, 1, 0) = 2;
+    input(1, 2, 0) = 1;
+    input(1, 1, 1) = 3;
+    input(1, 2, 1) = 2;
+    Shape outputShape = { 1, 2, 2 }; // Output has no padding
+    LayerParameters parameters{ input, ZeroPadding(1), outputShape, NoPadding() };
+    ConvolutionalParameters convolutionalParams{ 3, 1, ConvolutionMethod::columnwise, 2 };
+    TensorType weights(convolutionalParams.receptiveField * outputShape[2], convolutionalParams.receptiveField, input.NumChannels());
+    std::vector<ElementType> weightsVector{ // RowMajor then depth order
+        1, 3, 2, 3, 1, 1, 2, 3, 1,
+        2, 4, 1, 3, 1, 2, 1, 4, 2,
+        1, 2, 1, 2, 3, 2, 1, 2, 1,
+        0, 3, 2, 3, 1, 2, 1, 0, 2 };
+    size_t vectorIndex = 0;
+    for (size_t f = 0; f < outputShape[2]; f++)
+    {
+        for (size_t k = 0; k < input.NumChannels(); k++)
+        {
+            for (size_t i = 0; i < convolutionalParams.receptiveField; i++)
+            {
+                for (size_t j = 0; j < convolutionalParams.receptiveField; j++)
+                {
+                    weights(f * convolutionalParams.receptiveField + i, j, k) = weightsVector[vectorIndex++];
+                }
+            }
+        }
+    }
+
+    ConvolutionalLayer<ElementType> referenceLayer(parameters, convolutionalParams, weights);
+    referenceLayer.Compute();
+    auto referenceOutput = referenceLayer.GetOutput();
+
+    QuantizedConvolutionalLayer<ElementType> quantizedLayer(parameters, convolutionalParams, weights);
+    quantizedLayer.Compute();
+    auto output = quantizedLayer.GetOutput();
+
+    // Quantization introduces a small error, so compare with a tolerance
+    bool matches = true;
+    for (size_t j = 0; j < 2; j++)
+    {
+        for (size_t k = 0; k < 2; k++)
+        {
+            matches &= (std::abs(output(0, j, k) - referenceOutput(0, j, k)) < static_cast<ElementType>(0.5));
+        }
+    }
+    testing::ProcessTest("Testing QuantizedConvolutionalLayer, values", matches);
+    testing::ProcessTest("Testing QuantizedConvolutionalLayer, weight storage", quantizedLayer.GetQuantizedWeights().size() == 36 && quantizedLayer.GetWeightScales().size() == 2);
 }
 
 template <typename ElementType>
@@ -455,6 +935,56 @@ void BinaryConvolutionalLayerTest()
     auto output2 = convolutionalLayer2.GetOutput();
 
     testing::ProcessTest("Testing BinaryConvolutionalLayer (bitwise), values", Equals(output2(0, 0, 0), -20.5555553) && Equals(output2(0, 0, 1), -9.66666603) && Equals(output2(0, 1, 0), -20.5555553) && Equals(output2(0, 1, 1), -9.66666603));
+
+    // Verify the bit-sliced batch path against per-example Compute, using enough examples to span two word groups
+    using ConstTensorReferenceType = typename Layer<ElementType>::ConstTensorReferenceType;
+    const size_t batchSize = 70;
+    std::vector<TensorType> batchInputs;
+    batchInputs.reserve(batchSize);
+    for (size_t example = 0; example < batchSize; ++example)
+    {
+        TensorType exampleInput(3, 4, 2);
+        exampleInput.Fill(0);
+        for (size_t j = 1; j < 3; ++j)
+        {
+            for (size_t k = 0; k < 2; ++k)
+            {
+                exampleInput(1, j, k) = static_cast<ElementType>(((example + 2 * j + k) % 3) - 1);
+            }
+        }
+        batchInputs.push_back(exampleInput);
+    }
+    std::vector<ConstTensorReferenceType> batchInputReferences(batchInputs.begin(), batchInputs.end());
+    std::vector<TensorType> batchOutputs;
+    convolutionalLayer2.ComputeBatch(batchInputReferences, batchOutputs);
+
+    bool batchMatches = (batchOutputs.size() == batchSize);
+    for (size_t example = 0; example < batchSize && batchMatches; ++example)
+    {
+        for (size_t i = 0; i < input.NumRows(); ++i)
+        {
+            for (size_t j = 0; j < input.NumColumns(); ++j)
+            {
+                for (size_t k = 0; k < input.NumChannels(); ++k)
+                {
+                    input(i, j, k) = batchInputs[example](i, j, k);
+                }
+            }
+        }
+        convolutionalLayer2.Compute();
+        auto expected = convolutionalLayer2.GetOutput();
+        for (size_t i = 0; i < outputShape[0]; ++i)
+        {
+            for (size_t j = 0; j < outputShape[1]; ++j)
+            {
+                for (size_t k = 0; k < outputShape[2]; ++k)
+                {
+                    batchMatches &= Equals(batchOutputs[example](i, j, k), expected(i, j, k));
+                }
+            }
+        }
+    }
+    testing::ProcessTest("Testing BinaryConvolutionalLayer (bitwise), batch", batchMatches);
 }
 
 template <typename ElementType>
@@ -504,9 +1034,12 @@ void NeuralNetworkPredictorTest()
     BiasLayerTest<ElementType>();
     BinaryConvolutionalLayerTest<ElementType>();
     ConvolutionalLayerTest<ElementType>();
+    DepthwiseConvolutionalLayerTest<ElementType>();
     FullyConnectedLayerTest<ElementType>();
     InputLayerTest<ElementType>();
     PoolingLayerTest<ElementType>();
+    QuantizedConvolutionalLayerTest<ElementType>();
+    QuantizedFullyConnectedLayerTest<ElementType>();
     ScalingLayerTest<ElementType>();
     SoftmaxLayerTest<ElementType>();
 
@@ -548,6 +1081,14 @@ void NeuralNetworkPredictorTest()
     NeuralNetworkPredictor<ElementType> neuralNetwork(std::move(inputLayer), std::move(layers));
     std::vector<ElementType> output;
 
+    // The predictor should have redirected the layer outputs into its shared ping-pong buffers
+    bool allShared = true;
+    for (const auto& layer : neuralNetwork.GetLayers())
+    {
+        allShared &= layer->UsesSharedOutputMemory();
+    }
+    testing::ProcessTest("Testing NeuralNetworkPredictor, layers use shared output memory", allShared);
+
     // Check  the result for the 4 permutations of input. This validates that:
     // - the weights loaded correctly.
     // - the operations in each layer are working correctly
@@ -565,6 +1106,53 @@ void NeuralNetworkPredictorTest()
     output = neuralNetwork.Predict(DataVectorType({ 1, 1 }));
     testing::ProcessTest("Testing NeuralNetworkPredictor, Predict of XOR net for 1 1 ", Equals(output[0], 0.0));
 
+    // the batch form must reproduce the per-example predictions, in order
+    std::vector<DataVectorType> batchInputs;
+    batchInputs.emplace_back(DataVectorType({ 0, 0 }));
+    batchInputs.emplace_back(DataVectorType({ 0, 1 }));
+    batchInputs.emplace_back(DataVectorType({ 1, 0 }));
+    batchInputs.emplace_back(DataVectorType({ 1, 1 }));
+    std::vector<std::vector<ElementType>> batchOutputs;
+    neuralNetwork.PredictBatch(batchInputs, batchOutputs);
+    testing::ProcessTest("Testing NeuralNetworkPredictor, PredictBatch of XOR net", batchOutputs.size() == 4 && Equals(batchOutputs[0][0], 0.0) && Equals(batchOutputs[1][0], 1.0) && Equals(batchOutputs[2][0], 1.0) && Equals(batchOutputs[3][0], 0.0));
+
+    // with profiling enabled, every layer accumulates one entry per Predict call
+    neuralNetwork.SetProfilingEnabled(true);
+    neuralNetwork.Predict(DataVectorType({ 0, 1 }));
+    neuralNetwork.Predict(DataVectorType({ 1, 1 }));
+    const auto& layerStatistics = neuralNetwork.GetLayerStatistics();
+    bool profilingPassed = layerStatistics.size() == neuralNetwork.GetLayers().size();
+    for (const auto& statistics : layerStatistics)
+    {
+        profilingPassed &= statistics.invocationCount == 2;
+        profilingPassed &= statistics.bytesTouched > 0;
+        profilingPassed &= !statistics.layerName.empty();
+    }
+    testing::ProcessTest("Testing NeuralNetworkPredictor, per-layer statistics", profilingPassed);
+
+    std::stringstream statisticsStream;
+    neuralNetwork.PrintLayerStatistics(statisticsStream);
+    testing::ProcessTest("Testing NeuralNetworkPredictor, PrintLayerStatistics", !statisticsStream.str().empty());
+
+    neuralNetwork.SetProfilingEnabled(false);
+    testing::ProcessTest("Testing NeuralNetworkPredictor, profiling disabled", neuralNetwork.GetLayerStatistics().empty());
+
+    // opting the layers into half-precision activation storage rounds the values flowing between
+    // layers, so allow a half-precision-sized tolerance; the classifications must not change
+    for (const auto& layer : neuralNetwork.GetLayers())
+    {
+        layer->SetStoreOutputAsFloat16(true);
+    }
+    output = neuralNetwork.Predict(DataVectorType({ 0, 1 }));
+    bool float16Passed = std::abs(output[0] - 1.0) < 0.01;
+    output = neuralNetwork.Predict(DataVectorType({ 1, 1 }));
+    float16Passed &= std::abs(output[0] - 0.0) < 0.01;
+    testing::ProcessTest("Testing NeuralNetworkPredictor, Predict with float16 activations", float16Passed);
+    for (const auto& layer : neuralNetwork.GetLayers())
+    {
+        layer->SetStoreOutputAsFloat16(false);
+    }
+
     // Verify that we can archive and unarchive the predictor
     utilities::SerializationContext context;
     NeuralNetworkPredictor<ElementType>::RegisterNeuralNetworkPredictorTypes(context);
@@ -632,6 +1220,7 @@ void ProtoNNPredictorTest()
 int main()
 {
     ForestPredictorTest();
+    PredictBatchTest();
     NeuralNetworkPredictorTest<float>();
     NeuralNetworkPredictorTest<double>();
     ProtoNNPredictorTest();
@@ -0,0 +1,114 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     CheckpointingTrainer.h (trainers)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "ITrainer.h"
+
+// stl
+#include <future>
+#include <memory>
+#include <string>
+
+namespace ell
+{
+namespace trainers
+{
+    /// <summary> Parameters for the checkpointing trainer. </summary>
+    struct CheckpointingTrainerParameters
+    {
+        /// <summary> The file the checkpoint is written to. Each checkpoint atomically replaces the
+        /// previous one, so the file always holds the most recent complete checkpoint. </summary>
+        std::string filename;
+
+        /// <summary> The number of updates between checkpoints. </summary>
+        size_t updatesPerCheckpoint = 1;
+    };
+
+    /// <summary>
+    /// Implements a checkpointing trainer. This trainer contains another trainer and periodically
+    /// saves its state to a file, so that a training run that gets preempted can continue from the
+    /// last checkpoint instead of restarting from scratch. The state is serialized to memory
+    /// synchronously (it must be captured before training mutates it further), but the file write
+    /// happens on a background task, so checkpointing doesn't stall training on disk I/O.
+    /// </summary>
+    ///
+    /// <typeparam name="PredictorType"> The predictor type. </typeparam>
+    template <typename PredictorType>
+    class CheckpointingTrainer : public ITrainer<PredictorType>
+    {
+    public:
+        typedef ITrainer<PredictorType> InternalTrainerType;
+
+        /// <summary> Constructs an instance of CheckpointingTrainer. </summary>
+        ///
+        /// <param name="internalTrainer"> A trainer that supports `SaveState` and `LoadState`. </param>
+        /// <param name="parameters"> The checkpointing parameters. </param>
+        CheckpointingTrainer(std::unique_ptr<InternalTrainerType>&& internalTrainer, CheckpointingTrainerParameters parameters);
+
+        /// <summary> Destructor; waits for any in-flight checkpoint write to complete. </summary>
+        virtual ~CheckpointingTrainer();
+
+        /// <summary> Restores the internal trainer's state from the checkpoint file, if one exists.
+        /// Call this after constructing the trainer (and setting its dataset) to continue a
+        /// preempted run. </summary>
+        ///
+        /// <returns> true if a checkpoint was found and loaded, false if starting fresh. </returns>
+        bool TryResume();
+
+        /// <summary> Sets the trainer's dataset. </summary>
+        ///
+        /// <param name="anyDataset"> A dataset. </param>
+        virtual void SetDataset(const data::AnyDataset& anyDataset) override;
+
+        /// <summary> Performs a learning epoch and checkpoints on schedule. </summary>
+        virtual void Update() override;
+
+        /// <summary> Gets a const reference to the current predictor. </summary>
+        ///
+        /// <returns> A const reference to the current predictor. </returns>
+        virtual const PredictorType& GetPredictor() const override { return _internalTrainer->GetPredictor(); }
+
+        /// <summary> Saves the internal trainer's state to an archiver. </summary>
+        ///
+        /// <param name="archiver"> The `Archiver` to save state to. </param>
+        virtual void SaveState(utilities::Archiver& archiver) const override { _internalTrainer->SaveState(archiver); }
+
+        /// <summary> Restores the internal trainer's state from an archiver. </summary>
+        ///
+        /// <param name="archiver"> The `Unarchiver` to load state from. </param>
+        virtual void LoadState(utilities::Unarchiver& archiver) override { _internalTrainer->LoadState(archiver); }
+
+        /// <summary> Writes a checkpoint immediately, regardless of the schedule. Call this at the
+        /// end of training so the final state is always on disk. </summary>
+        void CheckpointNow();
+
+    private:
+        void FinishPendingWrite();
+
+        std::unique_ptr<InternalTrainerType> _internalTrainer;
+        CheckpointingTrainerParameters _parameters;
+        size_t _updatesSinceCheckpoint = 0;
+        std::future<void> _pendingWrite;
+    };
+
+    /// <summary> Makes a checkpointing trainer. </summary>
+    ///
+    /// <typeparam name="PredictorType"> Type of the predictor returned by this trainer. </typeparam>
+    /// <param name="internalTrainer"> A trainer that supports `SaveState` and `LoadState`. </param>
+    /// <param name="parameters"> The checkpointing parameters. </param>
+    ///
+    /// <returns> A unique_ptr to a checkpointing trainer. </returns>
+    template <typename PredictorType>
+    std::unique_ptr<CheckpointingTrainer<PredictorType>> MakeCheckpointingTrainer(
+        std::unique_ptr<ITrainer<PredictorType>>&& internalTrainer,
+        CheckpointingTrainerParameters parameters);
+}
+}
+
+#include "../tcc/CheckpointingTrainer.tcc"
@@ -0,0 +1,128 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     DatasetStatistics.h (trainers)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// data
+#include "Dataset.h"
+
+// math
+#include "Vector.h"
+
+// stl
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace ell
+{
+namespace trainers
+{
+    /// <summary> A fixed-capacity uniform sample of a stream of values, used to estimate
+    /// quantiles without holding the stream. Once the stream exceeds the capacity, each incoming
+    /// value replaces a random retained sample with probability capacity / count, so every value
+    /// seen has an equal chance of being retained. </summary>
+    class QuantileSketch
+    {
+    public:
+        /// <summary> Constructs a sketch. </summary>
+        ///
+        /// <param name="capacity"> The number of samples to retain; the quantile estimation error
+        /// shrinks as the capacity grows. </param>
+        /// <param name="seed"> The seed for the sampling decisions, so runs are reproducible. </param>
+        QuantileSketch(size_t capacity = 256, unsigned int seed = 123);
+
+        /// <summary> Feeds one value to the sketch. </summary>
+        ///
+        /// <param name="value"> The value. </param>
+        void Update(double value);
+
+        /// <summary> Merges another sketch into this one, as if this sketch had seen both streams.
+        /// The merge subsamples the two retained sample sets in proportion to their stream counts,
+        /// so the result is approximately a uniform sample of the combined stream. </summary>
+        ///
+        /// <param name="other"> The sketch to merge in. </param>
+        void Merge(const QuantileSketch& other);
+
+        /// <summary> Estimates a quantile of the values seen. </summary>
+        ///
+        /// <param name="quantile"> The quantile to estimate, in [0, 1]; 0.5 is the median. </param>
+        ///
+        /// <returns> The estimate, or 0 if no values have been seen. </returns>
+        double GetQuantile(double quantile) const;
+
+        /// <summary> Returns the number of values seen. </summary>
+        ///
+        /// <returns> The number of values fed to the sketch. </returns>
+        size_t Count() const { return _count; }
+
+    private:
+        size_t _capacity;
+        size_t _count = 0;
+        std::vector<double> _samples;
+        std::default_random_engine _random;
+    };
+
+    /// <summary> Per-column statistics of a dataset, all computed together in one pass. Columns a
+    /// data vector doesn't reach are treated as zeros, consistent with the sparse vector
+    /// convention. The variance is the population variance. </summary>
+    struct DatasetStatistics
+    {
+        /// <summary> The number of examples. </summary>
+        size_t numExamples = 0;
+
+        /// <summary> The per-column mean. </summary>
+        math::RowVector<double> mean;
+
+        /// <summary> The per-column population variance. </summary>
+        math::RowVector<double> variance;
+
+        /// <summary> The per-column minimum. </summary>
+        math::RowVector<double> min;
+
+        /// <summary> The per-column maximum. </summary>
+        math::RowVector<double> max;
+
+        /// <summary> One quantile sketch per column; empty if sketches were not requested. </summary>
+        std::vector<QuantileSketch> quantileSketches;
+    };
+
+    /// <summary> Computes the mean, variance, minimum, maximum and (optionally) quantile sketches
+    /// of every column in a single pass over the dataset, instead of one pass per statistic. </summary>
+    ///
+    /// <param name="anyDataset"> The dataset. </param>
+    /// <param name="sketchCapacity"> The capacity of the per-column quantile sketches, or 0 to
+    /// skip sketching. </param>
+    ///
+    /// <returns> The calculated statistics. </returns>
+    DatasetStatistics CalculateStatistics(const data::AnyDataset& anyDataset, size_t sketchCapacity = 0);
+
+    /// <summary> Merges the statistics of two disjoint dataset shards into the statistics of their
+    /// union, exactly for the moments and extremes and approximately for the sketches. </summary>
+    ///
+    /// <param name="statistics"> [in,out] The statistics to merge into. </param>
+    /// <param name="other"> The statistics of the other shard. </param>
+    void MergeStatistics(DatasetStatistics& statistics, const DatasetStatistics& other);
+
+    /// <summary> Computes dataset statistics in a single pass, parallelized over contiguous shards
+    /// of the dataset: each worker scans one shard and the per-shard statistics are merged. </summary>
+    ///
+    /// <typeparam name="ExampleType"> The dataset example type. </typeparam>
+    /// <param name="dataset"> The dataset. </param>
+    /// <param name="sketchCapacity"> The capacity of the per-column quantile sketches, or 0 to
+    /// skip sketching. </param>
+    /// <param name="numThreads"> The number of shards to scan concurrently, or 0 to use the
+    /// process thread pool's size. </param>
+    ///
+    /// <returns> The calculated statistics. </returns>
+    template <typename ExampleType>
+    DatasetStatistics CalculateStatistics(const data::Dataset<ExampleType>& dataset, size_t sketchCapacity, size_t numThreads);
+}
+}
+
+#include "../tcc/DatasetStatistics.tcc"
@@ -18,9 +18,27 @@ namespace ell
 {
 namespace trainers
 {
+    /// <summary> Parameters for the evaluating trainer's evaluation schedule. </summary>
+    struct EvaluatingTrainerParameters
+    {
+        /// <summary> If true, evaluations are scheduled adaptively: the interval between
+        /// evaluations doubles while the evaluation goodness is stable, and drops back to every
+        /// update when an evaluation shows the predictor is still changing. If false, every update
+        /// is followed by an evaluation. </summary>
+        bool adaptiveEvaluation = false;
+
+        /// <summary> The absolute change in goodness between consecutive evaluations below which
+        /// the predictor is considered stable and the evaluation interval is allowed to grow. </summary>
+        double goodnessToleranceForBackoff = 1.0e-3;
+
+        /// <summary> The maximum number of updates between evaluations. </summary>
+        size_t maxEvaluationInterval = 16;
+    };
+
     /// <summary>
     /// Implements an evaluating incremental trainer. This trainer contains another incremental
-    /// trainer and an evaluator, and performs an evaluation after each update.
+    /// trainer and an evaluator, and performs an evaluation after each update (or on an adaptive
+    /// schedule, see `EvaluatingTrainerParameters`).
     /// </summary>
     ///
     /// <typeparam name="PredictorType"> The predictor type. </typeparam>
@@ -37,6 +55,13 @@ namespace trainers
         /// <param name="evaluator"> An evaluator. </param>
         EvaluatingTrainer(std::unique_ptr<InternalTrainerType>&& internalTrainer, std::shared_ptr<EvaluatorType> evaluator);
 
+        /// <summary> Constructs an instance of EvaluatingTrainer with an evaluation schedule. </summary>
+        ///
+        /// <param name="internalTrainer"> An incremental trainer. </param>
+        /// <param name="evaluator"> An evaluator. </param>
+        /// <param name="parameters"> The evaluation schedule parameters. </param>
+        EvaluatingTrainer(std::unique_ptr<InternalTrainerType>&& internalTrainer, std::shared_ptr<EvaluatorType> evaluator, EvaluatingTrainerParameters parameters);
+
         /// <summary> Sets the trainer's dataset. </summary>
         ///
         /// <param name="anyDataset"> A dataset. </param>
@@ -55,9 +80,21 @@ namespace trainers
         /// <returns> A shared pointer to the evaluator. </returns>
         virtual const std::shared_ptr<const EvaluatorType> GetEvaluator() const { return _evaluator; }
 
+        /// <summary> Evaluates the current predictor immediately, regardless of the schedule, and
+        /// resets the schedule. Call this at the end of training when adaptive evaluation is on, so
+        /// the final predictor is always scored. </summary>
+        void EvaluateNow();
+
     private:
         std::unique_ptr<InternalTrainerType> _internalTrainer;
         std::shared_ptr<EvaluatorType> _evaluator;
+
+        // evaluation schedule state
+        EvaluatingTrainerParameters _parameters;
+        size_t _evaluationInterval = 1;
+        size_t _updatesSinceEvaluation = 0;
+        double _lastGoodness = 0.0;
+        bool _hasEvaluated = false;
     };
 
     /// <summary> Makes an evaluating trainer. </summary>
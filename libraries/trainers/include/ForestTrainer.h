@@ -19,11 +19,16 @@
 
 // utilities
 #include "OutputStreamImpostor.h"
+#include "ThreadPool.h"
 
 // stl
+#include <algorithm>
+#include <future>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <queue>
+#include <vector>
 
 namespace ell
 {
@@ -36,6 +41,9 @@ namespace trainers
         double minSplitGain = 0.0;
         size_t maxSplitsPerRound = 0;
         size_t numRounds = 0;
+
+        // number of threads used to evaluate split candidates and grow independent subtrees (1 means single-threaded)
+        size_t numThreads = 1;
     };
 
     /// <summary> Nontemplated base class for forest trainers, provides some reusable internal classes. </summary>
@@ -49,6 +57,7 @@ namespace trainers
             double sumWeightedLabels = 0;
 
             void Increment(const data::WeightLabel& weightLabel);
+            Sums operator+(const Sums& other) const;
             Sums operator-(const Sums& other) const;
             double GetMeanLabel() const;
             void Print(std::ostream& os) const;
@@ -137,6 +146,28 @@ namespace trainers
         /// <returns> A const reference to the current predictor. </returns>
         virtual const PredictorType& GetPredictor() const override { return _forest; };
 
+        /// <summary> Saves the trainer's state to an archiver. Checkpoints are taken at round
+        /// granularity: the forest fully determines the per-example outputs, and the split candidate
+        /// queue is intra-round state that each round rebuilds from its root split, so only the
+        /// forest and the completed-round count need to be saved. </summary>
+        ///
+        /// <param name="archiver"> The `Archiver` to save state to. </param>
+        virtual void SaveState(utilities::Archiver& archiver) const override;
+
+        /// <summary> Restores trainer state previously saved with `SaveState`, re-deriving the
+        /// per-example outputs and weak labels from the restored forest. </summary>
+        ///
+        /// <param name="archiver"> The `Unarchiver` to load state from. </param>
+        virtual void LoadState(utilities::Unarchiver& archiver) override;
+
+        /// <summary> Warm-starts training from an existing forest (e.g. yesterday's model loaded
+        /// from disk): subsequent boosting rounds are appended to the given predictor instead of
+        /// growing a forest from scratch. The per-example outputs and weak labels are re-derived
+        /// from the forest, so this can be called before or after `SetDataset`. </summary>
+        ///
+        /// <param name="forest"> The forest to continue growing. </param>
+        void SetWarmStartPredictor(PredictorType forest);
+
     protected:
         //
         // Private internal structs
@@ -201,9 +232,15 @@ namespace trainers
         // the forest being grown
         PredictorType _forest;
 
+        // number of completed boosting rounds, saved in checkpoints
+        size_t _rounds = 0;
+
         // the priority queue that holds the split candidates
         SplitCandidatePriorityQueue _queue;
 
+        // guards the priority queue when split candidates for independent subtrees are completed concurrently
+        std::mutex _queueMutex;
+
         // the data set
         data::Dataset<TrainerExampleType> _dataset;
     };
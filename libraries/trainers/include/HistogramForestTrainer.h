@@ -16,8 +16,13 @@
 #include "SingleElementThresholdPredictor.h"
 
 // stl
+#include <algorithm>
+#include <future>
+#include <map>
+#include <mutex>
 #include <random>
 #include <tuple>
+#include <utility>
 
 namespace ell
 {
@@ -58,24 +63,21 @@ namespace trainers
 
     protected:
         using ForestTrainer<SplitRuleType, EdgePredictorType, BoosterType>::_dataset;
+        using ForestTrainer<SplitRuleType, EdgePredictorType, BoosterType>::_parameters;
         virtual SplitCandidate GetBestSplitRuleAtNode(SplittableNodeId nodeId, Range range, Sums sums) override;
         virtual std::vector<EdgePredictorType> GetEdgePredictors(const NodeStats& nodeStats) override;
 
     private:
-        struct EvaluateSplitRuleResult
-        {
-            Sums sums0;
-            size_t size0;
-        };
-
         double CalculateGain(const Sums& sums, const Sums& sums0, const Sums& sums1) const;
         std::vector<SplitRuleType> CallThresholdFinder(Range range);
-        std::tuple<Sums, size_t> EvaluateSplitRule(const SplitRuleType& splitRule, const Range& range) const;
+        std::vector<std::tuple<Sums, size_t>> EvaluateSplitRules(const std::vector<SplitRuleType>& splitRules, const Range& range) const;
+        void EvaluateSplitRulesForElement(size_t elementIndex, const std::vector<std::pair<double, size_t>>& sortedThresholds, const Range& range, std::vector<std::tuple<Sums, size_t>>& results) const;
 
         // member variables
         LossFunctionType _lossFunction;
         ThresholdFinderType _thresholdFinder;
         std::default_random_engine _random;
+        std::mutex _randomMutex; // guards the random engine when nodes are completed concurrently
         size_t _thresholdFinderSampleSize;
         size_t _candidatesPerInput;
     };
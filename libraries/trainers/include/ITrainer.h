@@ -11,6 +11,14 @@
 // data
 #include "Dataset.h"
 
+// math
+#include "Matrix.h"
+#include "Vector.h"
+
+// utilities
+#include "Archiver.h"
+#include "Exception.h"
+
 // stl
 #include <memory>
 
@@ -38,10 +46,41 @@ namespace trainers
         /// <summary> Updates the state of the trainer by performing a learning epoch. </summary>
         virtual void Update() = 0;
 
+        /// <summary> Updates the state of the trainer from a dense mini-batch, where each matrix row
+        /// is one example. Trainers that implement this overload can process the whole batch with
+        /// matrix-vector operations instead of example-at-a-time updates. Trainers that don't support
+        /// mini-batch updates throw notImplemented. </summary>
+        ///
+        /// <param name="examples"> A matrix with one example per row. </param>
+        /// <param name="labels"> The labels, one per example. </param>
+        virtual void Update(math::ConstMatrixReference<double, math::MatrixLayout::rowMajor> /*examples*/, math::ConstVectorReference<double, math::VectorOrientation::column> /*labels*/)
+        {
+            throw utilities::LogicException(utilities::LogicExceptionErrors::notImplemented, "this trainer does not support mini-batch updates");
+        }
+
         /// <summary> Gets a const reference to the current predictor. </summary>
         ///
         /// <returns> A const reference to the current predictor. </returns>
         virtual const PredictorType& GetPredictor() const = 0;
+
+        /// <summary> Saves the trainer's state to an archiver, so that an identically configured
+        /// trainer can later continue training from this point via `LoadState`. Trainers that don't
+        /// support checkpointing throw notImplemented. </summary>
+        ///
+        /// <param name="archiver"> The `Archiver` to save state to. </param>
+        virtual void SaveState(utilities::Archiver& /*archiver*/) const
+        {
+            throw utilities::LogicException(utilities::LogicExceptionErrors::notImplemented, "this trainer does not support checkpointing");
+        }
+
+        /// <summary> Restores trainer state previously saved with `SaveState`. The trainer must be
+        /// constructed with the same parameters (and dataset) that produced the checkpoint. </summary>
+        ///
+        /// <param name="archiver"> The `Unarchiver` to load state from. </param>
+        virtual void LoadState(utilities::Unarchiver& /*archiver*/)
+        {
+            throw utilities::LogicException(utilities::LogicExceptionErrors::notImplemented, "this trainer does not support checkpointing");
+        }
     };
 }
 }
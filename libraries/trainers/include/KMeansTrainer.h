@@ -12,6 +12,7 @@
 #include <cstddef>
 #include <memory>
 #include <map>
+#include <vector>
 
 // Matrix
 #include <Matrix.h>
@@ -20,6 +21,18 @@ namespace ell
 {
 namespace trainers
 {
+    /// <summary> Parameters for the KMeansTrainer trainer. </summary>
+    struct KMeansTrainerParameters
+    {
+        /// <summary> Number of points sampled per iteration; 0 means every iteration uses the full
+        /// dataset (exact Lloyd iterations). </summary>
+        size_t minibatchSize = 0;
+
+        /// <summary> Number of threads used for the assignment step; 1 means serial, 0 means one
+        /// per hardware thread. </summary>
+        size_t numThreads = 1;
+    };
+
     /// <summary> Impements KMeansTrainer++ algorithm </summary>
     ///
     class KMeansTrainer
@@ -37,6 +50,15 @@ namespace trainers
         ///
         KMeansTrainer(size_t dimension, size_t numClusters, size_t iterations);
 
+        /// <summary> Constructs an instance of KMeansTrainer trainer </summary>
+        ///
+        /// <param name="dimension"> The input dimension. </param>
+        /// <param name="numClusters"> The number of clusters. </param>
+        /// <param name="iterations"> The number of iterations. </param>
+        /// <param name="parameters"> The trainer parameters. </param>
+        ///
+        KMeansTrainer(size_t dimension, size_t numClusters, size_t iterations, KMeansTrainerParameters parameters);
+
         /// <summary> Constructs an instance of KMeansTrainer trainer </summary>
         ///
         /// <param name="numClusters"> The number of clusters. </param>
@@ -65,15 +87,30 @@ namespace trainers
         // Initializes the cluster means using the KMeansTrainer++ strategy.
         void initializeMeans(math::ConstMatrixReference<double, math::MatrixLayout::columnMajor> X);
 
+        // Full Lloyd iterations with Hamerly triangle-inequality pruning: per-point upper and lower
+        // distance bounds are maintained across iterations so most points skip all distance
+        // computations once the centers settle. The result is identical to exact Lloyd iterations.
+        void runLloydKMeans(math::ConstMatrixReference<double, math::MatrixLayout::columnMajor> X);
+
+        // Minibatch iterations: each iteration assigns a random sample of points and moves each
+        // center towards its sampled points with a per-center decaying step size.
+        void runMinibatchKMeans(math::ConstMatrixReference<double, math::MatrixLayout::columnMajor> X);
+
+        // Assign each point in [begin, end) to its closest center, tightening the Hamerly bounds
+        // and accumulating per-center sums and counts. Returns true if any assignment changed.
+        bool assignChunk(math::ConstMatrixReference<double, math::MatrixLayout::columnMajor> X,
+                         size_t begin,
+                         size_t end,
+                         const std::vector<double>& centerSeparation,
+                         std::vector<size_t>& assignment,
+                         std::vector<double>& upperBound,
+                         std::vector<double>& lowerBound,
+                         std::vector<double>& clusterSums,
+                         std::vector<double>& clusterCounts) const;
+
         // Distance of points to all the cluster means.
         math::RowMatrix<double> pairwiseDistance(math::ConstMatrixReference<double, math::MatrixLayout::columnMajor> X, math::ConstMatrixReference<double, math::MatrixLayout::columnMajor> mu);
 
-        // Assign each point to the closest mean.
-        double assignClosestCenter(math::ConstMatrixReference<double, math::MatrixLayout::columnMajor> X, math::VectorReference<size_t, math::VectorOrientation::column> clusterAssignment);
-
-        // Recompute the cluster means.
-        void recomputeMeans(math::ConstMatrixReference<double, math::MatrixLayout::columnMajor> X, const math::ColumnVector<size_t> clusterAssignment);
-
         // Weighted sampling.
         size_t weightedSample(math::ColumnVector<double> weights);
 
@@ -91,6 +128,9 @@ namespace trainers
 
         // Number of clusters.
         size_t _numClusters;
+
+        // Trainer parameters.
+        KMeansTrainerParameters _parameters;
     };
 }
 }
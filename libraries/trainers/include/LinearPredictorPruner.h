@@ -0,0 +1,66 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     LinearPredictorPruner.h (trainers)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// predictors
+#include "LinearPredictor.h"
+
+// evaluators
+#include "Evaluator.h"
+
+// stl
+#include <cstddef>
+#include <vector>
+
+namespace ell
+{
+namespace trainers
+{
+    /// <summary> The result of pruning a linear predictor: a compacted predictor over the surviving
+    /// dimensions, plus the schema needed to feed it. </summary>
+    struct LinearPredictorPruningResult
+    {
+        /// <summary> The compacted predictor. Entry i of its weight vector is the original weight of
+        /// input dimension keptIndices[i]; the bias is unchanged. </summary>
+        predictors::LinearPredictor predictor;
+
+        /// <summary> Maps each compacted dimension to its original input dimension, so callers can
+        /// remap the input schema (e.g. build the map that selects these input elements). </summary>
+        std::vector<size_t> keptIndices;
+
+        /// <summary> The weight magnitude threshold that was applied: weights with absolute value at
+        /// or below it were dropped. </summary>
+        double threshold = 0;
+    };
+
+    /// <summary> Prunes a linear predictor by weight magnitude: dimensions whose absolute weight is
+    /// at or below the threshold are dropped, and the survivors are compacted into a smaller
+    /// predictor. Sparse high-dimensional models typically carry many near-zero weights that cost
+    /// memory and dot-product time without affecting predictions. </summary>
+    ///
+    /// <param name="predictor"> The predictor to prune. </param>
+    /// <param name="threshold"> The magnitude threshold; a threshold of zero drops exact-zero weights only. </param>
+    ///
+    /// <returns> The compacted predictor and its input remapping. </returns>
+    LinearPredictorPruningResult PruneLinearPredictor(const predictors::LinearPredictor& predictor, double threshold);
+
+    /// <summary> Prunes a linear predictor as aggressively as an evaluator allows: finds, by binary
+    /// search over the number of smallest-magnitude weights dropped, the largest pruning whose
+    /// goodness (as reported by the evaluator on the unpruned dimensions' zeroed-out predictor)
+    /// stays within the given loss of the unpruned predictor's goodness. Each probe costs one
+    /// evaluation pass, and the probes are recorded in the evaluator's history. </summary>
+    ///
+    /// <param name="predictor"> The predictor to prune. </param>
+    /// <param name="evaluator"> The evaluator that validates candidate prunings. </param>
+    /// <param name="maxGoodnessLoss"> The largest acceptable drop in goodness. </param>
+    ///
+    /// <returns> The compacted predictor and its input remapping. </returns>
+    LinearPredictorPruningResult PruneLinearPredictor(const predictors::LinearPredictor& predictor, evaluators::IEvaluator<predictors::LinearPredictor>& evaluator, double maxGoodnessLoss);
+}
+}
@@ -20,7 +20,13 @@
 // math
 #include "Vector.h"
 
+// utilities
+#include "PairwiseReduction.h"
+#include "ThreadPool.h"
+
 // stl
+#include <atomic>
+#include <future>
 #include <random>
 
 namespace ell
@@ -35,6 +41,8 @@ namespace trainers
         size_t maxEpochs;
         bool permute;
         std::string randomSeedString;
+        size_t numThreads = 1; // number of threads used to perform coordinate steps in each epoch
+        bool deterministic = false; // parallel epochs become bit-reproducible: shards work from the epoch-start iterate only, and their updates are merged in a fixed pairwise order keyed to shard indices
     };
 
     /// <summary> Information about the result of an SDCA training session. </summary>
@@ -76,7 +84,21 @@ namespace trainers
         /// <summary> Gets information on the trained predictor. </summary>
         ///
         /// <returns> Information on the trained predictor. </returns>
-        double GetPredictorInfo() const { return _predictorInfo; }
+        SDCAPredictorInfo GetPredictorInfo() const { return _predictorInfo; }
+
+        /// <summary> Saves the trainer's state to an archiver: the dual iterate (v, d), the
+        /// per-example dual variables, and the random engine. A warm-started retrain restores this
+        /// state and converges in a fraction of the epochs a cold start needs. </summary>
+        ///
+        /// <param name="archiver"> The `Archiver` to save state to. </param>
+        virtual void SaveState(utilities::Archiver& archiver) const override;
+
+        /// <summary> Restores trainer state previously saved with `SaveState`. Call after
+        /// `SetDataset`, with the examples in the same order as when the state was saved; the
+        /// primal predictor and the objectives are re-derived from the restored duals. </summary>
+        ///
+        /// <param name="archiver"> The `Unarchiver` to load state from. </param>
+        virtual void LoadState(utilities::Unarchiver& archiver) override;
 
     private:
         struct TrainerMetadata
@@ -97,6 +119,10 @@ namespace trainers
         using TrainerExampleType = data::Example<DataVectorType, TrainerMetadata>;
 
         void Step(TrainerExampleType& x);
+        void ParallelUpdate();
+        void DeterministicParallelUpdate();
+        void UpdateShard(size_t firstIndex, size_t lastIndex, std::vector<std::atomic<double>>& sharedV, std::atomic<double>& sharedD);
+        void UpdateShardDeterministic(size_t firstIndex, size_t lastIndex, std::vector<double>& deltaV, double& deltaD);
         void ComputeObjectives();
         void ResizeTo(const data::AutoDataVector& x);
 
@@ -16,9 +16,11 @@
 // data
 #include "Dataset.h"
 #include "Example.h"
+#include "ExampleIterator.h"
 
 // stl
 #include <cstddef>
+#include <functional>
 #include <memory>
 #include <random>
 #include <string>
@@ -44,14 +46,45 @@ namespace trainers
     public:
         using PredictorType = predictors::LinearPredictor;
 
+        /// <summary> A callable that returns a fresh example iterator, positioned at the first example. </summary>
+        using ExampleIteratorFactory = std::function<data::AutoSupervisedExampleIterator()>;
+
         /// <summary> Sets the trainer's dataset. </summary>
         ///
         /// <param name="anyDataset"> A dataset. </param>
         virtual void SetDataset(const data::AnyDataset& anyDataset) override;
 
+        /// <summary>
+        /// Puts the trainer in streaming mode: each epoch consumes examples directly from a fresh
+        /// iterator obtained from the factory (typically file-backed), instead of a dataset held in
+        /// memory. Examples are read ahead into a double buffer on a worker thread, so parsing
+        /// overlaps the gradient steps. Note that examples are visited in stream order --- shuffle
+        /// the file beforehand if a random order is required.
+        /// </summary>
+        ///
+        /// <param name="getExampleIterator"> A factory that returns a rewound example iterator. </param>
+        /// <param name="readAheadBufferSize"> The number of examples held in each buffer. </param>
+        void SetStreamingDataset(ExampleIteratorFactory getExampleIterator, size_t readAheadBufferSize = 1024);
+
         /// <summary> Updates the state of the trainer by performing a learning epoch. </summary>
         virtual void Update() override;
 
+        /// <summary> Updates the state of the trainer from a dense mini-batch, where each matrix row
+        /// is one example with unit weight. The examples are visited in the given order - shuffle the
+        /// batch beforehand if a random order is required. </summary>
+        ///
+        /// <param name="examples"> A matrix with one example per row. </param>
+        /// <param name="labels"> The labels, one per example. </param>
+        virtual void Update(math::ConstMatrixReference<double, math::MatrixLayout::rowMajor> examples, math::ConstVectorReference<double, math::VectorOrientation::column> labels) override;
+
+        /// <summary> Replaces the trainer's current predictor, so that subsequent epochs continue
+        /// from the given weights. Parallel SGD uses this to mix weights between workers. Not every
+        /// derived trainer keeps its state in predictor form; those that don't throw
+        /// notImplemented. </summary>
+        ///
+        /// <param name="predictor"> The predictor to continue training from. </param>
+        virtual void SetPredictor(const PredictorType& predictor);
+
         /// <summary> Returns The averaged predictor. </summary>
         ///
         /// <returns> A const reference to the averaged predictor. </returns>
@@ -64,16 +97,31 @@ namespace trainers
         virtual void DoNextStep(const data::AutoDataVector& x, double y, double weight) = 0;
         virtual const PredictorType& GetAveragedPredictor() const = 0;
 
+        // processes a dense mini-batch; the default implementation takes one step per row, derived
+        // classes can override it with a batched update
+        virtual void DoBatchStep(math::ConstMatrixReference<double, math::MatrixLayout::rowMajor> examples, math::ConstVectorReference<double, math::VectorOrientation::column> labels);
+
         data::AutoSupervisedDataset _dataset;
         std::default_random_engine _random;
         bool _firstIteration = true;
+        size_t _epochs = 0; // number of completed epochs, saved in checkpoints
+
+    private:
+        void UpdateFromDataset();
+        void UpdateFromStream();
+        void TakeStep(const data::AutoDataVector& x, double y, double weight);
+
+        ExampleIteratorFactory _getExampleIterator; // when set, Update streams instead of using _dataset
+        size_t _readAheadBufferSize = 1024;
     };
 
     //
     // SGDTrainer - Stochastic Gradient Descent
     //
 
-    /// <summary> Implements the steps of a simple sgd linear trainer. </summary>
+    /// <summary> Implements the steps of a simple sgd linear trainer. The weights are represented
+    /// implicitly by sparse-friendly accumulators, so each step costs O(nnz) of the example rather
+    /// than O(dimension), and the predictors are materialized lazily on demand. </summary>
     ///
     /// <typeparam name="LossFunctionType"> Loss function type. </typeparam>
     template <typename LossFunctionType>
@@ -91,24 +139,57 @@ namespace trainers
         /// <summary> Returns a const reference to the last predictor. </summary>
         ///
         /// <returns> A const reference to the last predictor. </returns>
-        const PredictorType& GetLastPredictor() const { return _lastPredictor; }
+        const PredictorType& GetLastPredictor() const;
 
         /// <summary> Returns a const reference to the averaged predictor. </summary>
         ///
         /// <returns> A const reference to the averaged predictor. </returns>
-        virtual const PredictorType& GetAveragedPredictor() const override { return _averagedPredictor; }
+        virtual const PredictorType& GetAveragedPredictor() const override;
+
+        /// <summary> Replaces both the last and the averaged predictor, so that subsequent epochs
+        /// continue from the given weights. </summary>
+        ///
+        /// <param name="predictor"> The predictor to continue training from. </param>
+        virtual void SetPredictor(const PredictorType& predictor) override;
+
+        /// <summary> Saves the trainer's state (accumulators, step counters, base predictor, random
+        /// engine, and epoch count) to an archiver. Restoring this state into a trainer constructed
+        /// with the same parameters continues training exactly where the checkpoint was taken. </summary>
+        ///
+        /// <param name="archiver"> The `Archiver` to save state to. </param>
+        virtual void SaveState(utilities::Archiver& archiver) const override;
+
+        /// <summary> Restores trainer state previously saved with `SaveState`. </summary>
+        ///
+        /// <param name="archiver"> The `Unarchiver` to load state from. </param>
+        virtual void LoadState(utilities::Unarchiver& archiver) override;
 
     protected:
         virtual void DoFirstStep(const data::AutoDataVector& x, double y, double weight) override;
         virtual void DoNextStep(const data::AutoDataVector& x, double y, double weight) override;
 
+        // takes a single step along the mean gradient of the batch, computed with matrix-vector
+        // operations; requires the loss function to provide the batch GetDerivative overload
+        virtual void DoBatchStep(math::ConstMatrixReference<double, math::MatrixLayout::rowMajor> examples, math::ConstVectorReference<double, math::VectorOrientation::column> labels) override;
+
     private:
         LossFunctionType _lossFunction;
         SGDTrainerParameters _parameters;
 
-        double _t = 0; // step counter;
-        PredictorType _lastPredictor;
-        PredictorType _averagedPredictor;
+        // these variables follow the notation in https://arxiv.org/abs/1612.09147, generalized to
+        // continue from a nonzero base predictor (see SetPredictor)
+        math::ColumnVector<double> _v;  // gradient sum - weights
+        math::ColumnVector<double> _u;  // harmonic-weighted gradient sum - weights
+        double _t = 0;                  // step counter
+        double _a = 0;                  // gradient sum - bias
+        double _h = 0;                  // harmonic number since the base predictor was set
+        double _c = 0;                  // 1/t-weighted sum of _a
+        double _t0 = 0;                 // step count when the base predictor was set
+        PredictorType _basePredictor;   // the predictor training continued from (empty on a cold start)
+
+        // these variables are mutable because we calculate them in a lazy manner (only when `GetPredictor() const` is called)
+        mutable PredictorType _lastPredictor;
+        mutable PredictorType _averagedPredictor;
 
         void ResizeTo(const data::AutoDataVector& x);
     };
@@ -54,11 +54,13 @@ namespace trainers
 
     protected:
         using ForestTrainer<SplitRuleType, EdgePredictorType, BoosterType>::_dataset;
+        using ForestTrainer<SplitRuleType, EdgePredictorType, BoosterType>::_parameters;
         virtual SplitCandidate GetBestSplitRuleAtNode(SplittableNodeId nodeId, Range range, Sums sums) override;
         virtual std::vector<EdgePredictorType> GetEdgePredictors(const NodeStats& nodeStats) override;
 
     private:
         void SortNodeDataset(Range range, size_t featureIndex);
+        void EvaluateFeature(size_t featureIndex, SplittableNodeId nodeId, Range range, const Sums& sums, const data::ColumnMajorDataset<TrainerMetadata>& columnMajorDataset, SplitCandidate& bestSplitCandidate) const;
         double CalculateGain(const Sums& sums, const Sums& sums0, const Sums& sums1) const;
 
         // member variables
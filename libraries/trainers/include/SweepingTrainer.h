@@ -17,6 +17,9 @@
 // evaluators
 #include "Evaluator.h"
 
+// utilities
+#include "ThreadPool.h"
+
 //stl
 #include <memory>
 #include <random>
@@ -28,6 +31,24 @@ namespace ell
 {
 namespace trainers
 {
+    /// <summary> Parameters for the sweeping trainer's sweep schedule. </summary>
+    struct SweepingTrainerParameters
+    {
+        /// <summary> If true, each update runs the active candidate trainers concurrently on the
+        /// shared thread pool. The candidates are independent, and the examples they train on are
+        /// shared read-only, so this is safe. </summary>
+        bool parallel = false;
+
+        /// <summary> If true, each update ends with an evaluation of every active candidate, and
+        /// the worse-scoring half of the candidates is retired (successive halving). Retired
+        /// candidates keep their last evaluation but receive no further updates, so the sweep
+        /// spends its epochs on the promising candidates. </summary>
+        bool successiveHalving = false;
+
+        /// <summary> Successive halving never shrinks the active set below this size. </summary>
+        size_t minActiveTrainers = 1;
+    };
+
     /// <summary> A class that runs multiple internal trainers and chooses the best performing predictor. </summary>
     ///
     /// <typeparam name="PredictorType"> The type of predictor returned by this trainer. </typeparam>
@@ -43,7 +64,15 @@ namespace trainers
         /// <param name="evaluatingTrainers"> A vector of evaluating trainers. </param>
         SweepingTrainer(std::vector<EvaluatingTrainerType>&& evaluatingTrainers);
 
-        /// <summary> Sets the trainer's dataset. </summary>
+        /// <summary> Constructs an instance of SweepingTrainer with a sweep schedule. </summary>
+        ///
+        /// <param name="evaluatingTrainers"> A vector of evaluating trainers. </param>
+        /// <param name="parameters"> The sweep schedule parameters. </param>
+        SweepingTrainer(std::vector<EvaluatingTrainerType>&& evaluatingTrainers, SweepingTrainerParameters parameters);
+
+        /// <summary> Sets the trainer's dataset. The dataset is forwarded to each candidate
+        /// trainer; examples hold shared pointers to their data vectors, so the candidates share
+        /// the example data read-only rather than duplicating it. </summary>
         ///
         /// <param name="anyDataset"> A dataset. </param>
         virtual void SetDataset(const data::AnyDataset& anyDataset) override;
@@ -56,9 +85,16 @@ namespace trainers
         /// <returns> A const reference to the current predictor. </returns>
         virtual const PredictorType& GetPredictor() const override;
 
+        /// <summary> Gets the number of candidate trainers that are still being updated. </summary>
+        ///
+        /// <returns> The number of active candidate trainers. </returns>
+        size_t NumActiveTrainers() const;
+
     private:
         data::Dataset<ExampleType> _dataset;
         std::vector<EvaluatingTrainerType> _evaluatingTrainers;
+        SweepingTrainerParameters _parameters;
+        std::vector<bool> _isActive;
     };
 
     /// <summary> Makes an incremental trainer that runs multiple internal trainers and chooses the best performing predictor. </summary>
@@ -69,6 +105,16 @@ namespace trainers
     /// <returns> A unique_ptr to a sweeping trainer. </returns>
     template <typename PredictorType>
     std::unique_ptr<ITrainer<PredictorType>> MakeSweepingTrainer(std::vector<EvaluatingTrainer<PredictorType>>&& evaluatingTrainers);
+
+    /// <summary> Makes an incremental trainer that runs multiple internal trainers with a sweep schedule and chooses the best performing predictor. </summary>
+    ///
+    /// <typeparam name="PredictorType"> Type of the predictor returned by this trainer. </typeparam>
+    /// <param name="evaluatingTrainers"> A vector of evaluating trainers. </param>
+    /// <param name="parameters"> The sweep schedule parameters. </param>
+    ///
+    /// <returns> A unique_ptr to a sweeping trainer. </returns>
+    template <typename PredictorType>
+    std::unique_ptr<ITrainer<PredictorType>> MakeSweepingTrainer(std::vector<EvaluatingTrainer<PredictorType>>&& evaluatingTrainers, SweepingTrainerParameters parameters);
 }
 }
 
@@ -0,0 +1,124 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     TelemetryTrainer.h (trainers)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Evaluator.h"
+#include "ITrainer.h"
+
+// stl
+#include <iostream>
+#include <memory>
+
+namespace ell
+{
+namespace trainers
+{
+    /// <summary> Parameters for the telemetry trainer. </summary>
+    struct TelemetryTrainerParameters
+    {
+        /// <summary> The number of updates between reports. Zero disables telemetry entirely:
+        /// `Update` then just forwards to the wrapped trainer, without even reading the clock. </summary>
+        size_t updatesPerReport = 1;
+
+        /// <summary> If true, each report is one JSON object per line, for machine consumption;
+        /// otherwise reports are human-readable text. </summary>
+        bool jsonFormat = false;
+
+        /// <summary> The planned total number of updates, used for progress display (0 = unknown). </summary>
+        size_t totalUpdates = 0;
+    };
+
+    /// <summary>
+    /// Implements a telemetry trainer. This trainer contains another trainer and periodically
+    /// publishes progress - update count, examples per second, the current objective from an
+    /// optional evaluator, the process memory high-water mark and elapsed time - so long runs are
+    /// observable and schedulers can detect stalls. Reports go to any `std::ostream` (stderr by
+    /// default; a file or a socket-backed stream works the same way) and each report is flushed,
+    /// so readers see it promptly.
+    /// </summary>
+    ///
+    /// <typeparam name="PredictorType"> The predictor type. </typeparam>
+    template <typename PredictorType>
+    class TelemetryTrainer : public ITrainer<PredictorType>
+    {
+    public:
+        typedef ITrainer<PredictorType> InternalTrainerType;
+        typedef evaluators::IEvaluator<PredictorType> EvaluatorType;
+
+        /// <summary> Constructs an instance of TelemetryTrainer. </summary>
+        ///
+        /// <param name="internalTrainer"> A trainer. </param>
+        /// <param name="parameters"> The telemetry parameters. </param>
+        /// <param name="output"> The stream reports are published to. </param>
+        /// <param name="evaluator"> An optional evaluator; when given, each report includes the
+        /// current goodness (evaluating costs a pass over the evaluation set, so it only happens
+        /// at report time). </param>
+        TelemetryTrainer(std::unique_ptr<InternalTrainerType>&& internalTrainer, TelemetryTrainerParameters parameters, std::ostream& output = std::cerr, std::shared_ptr<EvaluatorType> evaluator = nullptr);
+
+        /// <summary> Sets the trainer's dataset. </summary>
+        ///
+        /// <param name="anyDataset"> A dataset. </param>
+        virtual void SetDataset(const data::AnyDataset& anyDataset) override;
+
+        /// <summary> Performs a learning epoch and reports on schedule. </summary>
+        virtual void Update() override;
+
+        /// <summary> Gets a const reference to the current predictor. </summary>
+        ///
+        /// <returns> A const reference to the current predictor. </returns>
+        virtual const PredictorType& GetPredictor() const override { return _internalTrainer->GetPredictor(); }
+
+        /// <summary> Saves the internal trainer's state to an archiver. </summary>
+        ///
+        /// <param name="archiver"> The `Archiver` to save state to. </param>
+        virtual void SaveState(utilities::Archiver& archiver) const override { _internalTrainer->SaveState(archiver); }
+
+        /// <summary> Restores the internal trainer's state from an archiver. </summary>
+        ///
+        /// <param name="archiver"> The `Unarchiver` to load state from. </param>
+        virtual void LoadState(utilities::Unarchiver& archiver) override { _internalTrainer->LoadState(archiver); }
+
+        /// <summary> Publishes a report immediately, regardless of the schedule. Call this at the
+        /// end of training so the final state is always reported. </summary>
+        void ReportNow();
+
+    private:
+        void Report();
+
+        std::unique_ptr<InternalTrainerType> _internalTrainer;
+        TelemetryTrainerParameters _parameters;
+        std::ostream& _output;
+        std::shared_ptr<EvaluatorType> _evaluator;
+
+        size_t _numExamples = 0;
+        size_t _updateCount = 0;
+        size_t _updatesSinceReport = 0;
+        double _secondsSinceReport = 0;
+        double _totalSeconds = 0;
+    };
+
+    /// <summary> Makes a telemetry trainer. </summary>
+    ///
+    /// <typeparam name="PredictorType"> Type of the predictor returned by this trainer. </typeparam>
+    /// <param name="internalTrainer"> A trainer. </param>
+    /// <param name="parameters"> The telemetry parameters. </param>
+    /// <param name="output"> The stream reports are published to. </param>
+    /// <param name="evaluator"> An optional evaluator. </param>
+    ///
+    /// <returns> A unique_ptr to a telemetry trainer. </returns>
+    template <typename PredictorType>
+    std::unique_ptr<TelemetryTrainer<PredictorType>> MakeTelemetryTrainer(
+        std::unique_ptr<ITrainer<PredictorType>>&& internalTrainer,
+        TelemetryTrainerParameters parameters,
+        std::ostream& output = std::cerr,
+        std::shared_ptr<evaluators::IEvaluator<PredictorType>> evaluator = nullptr);
+}
+}
+
+#include "../tcc/TelemetryTrainer.tcc"
@@ -46,8 +46,18 @@ namespace trainers
         template <typename ExampleIteratorType>
         UniqueValuesResult UniqueValues(ExampleIteratorType exampleIterator) const;
 
-    private:
+        // Gets a vector of sorted unique values from each feature, with counts, from a feature-major
+        // copy of the examples, scanning each feature with unit stride
+        template <typename MetadataType>
+        UniqueValuesResult UniqueValues(const data::ColumnMajorDataset<MetadataType>& dataset) const;
+
+        // Sorts a range of value/weight pairs by value, then merges entries with equal values by
+        // summing their weights; returns the reduced size
         size_t SortReduceCopy(std::vector<ValueWeight>::iterator begin, const std::vector<ValueWeight>::iterator end) const;
+
+        // Sorts a range of value/weight pairs by value. Long ranges use an LSD radix sort on the
+        // bit patterns of the doubles; short ranges fall back to a comparison sort.
+        static void RadixSortByValue(std::vector<ValueWeight>::iterator begin, std::vector<ValueWeight>::iterator end);
     };
 
     /// <summary> A threshold finder that finds all possible thresholds. </summary>
@@ -62,6 +72,59 @@ namespace trainers
         /// <returns> The thresholds. </returns>
         template <typename ExampleIteratorType>
         std::vector<predictors::SingleElementThresholdPredictor> GetThresholds(ExampleIteratorType exampleIterator) const;
+
+        /// <summary> Returns a vector of SingleElementThresholdPredictor, computed from a feature-major
+        /// copy of the examples, which is scanned with unit stride. </summary>
+        ///
+        /// <typeparam name="MetadataType"> The example metadata type. </typeparam>
+        /// <param name="dataset"> The feature-major dataset. </param>
+        ///
+        /// <returns> The thresholds. </returns>
+        template <typename MetadataType>
+        std::vector<predictors::SingleElementThresholdPredictor> GetThresholds(const data::ColumnMajorDataset<MetadataType>& dataset) const;
+
+    private:
+        std::vector<predictors::SingleElementThresholdPredictor> GetThresholds(const UniqueValuesResult& uniqueValuesResult) const;
+    };
+
+    /// <summary> A threshold finder that returns a fixed number of candidate thresholds per feature,
+    /// placed at weighted quantiles estimated by a one-pass streaming sketch. Unlike the exhaustive
+    /// finder, its memory use and output size are independent of the number of examples. </summary>
+    class QuantileThresholdFinder : public ThresholdFinder
+    {
+    public:
+        /// <summary> Constructs an instance of QuantileThresholdFinder. </summary>
+        ///
+        /// <param name="numCandidatesPerFeature"> The maximum number of thresholds to return per feature. </param>
+        QuantileThresholdFinder(size_t numCandidatesPerFeature = 32);
+
+        /// <summary> Returns a vector of SingleElementThresholdPredictor at estimated weighted quantiles. </summary>
+        ///
+        /// <typeparam name="ExampleIteratorType"> Type of example iterator. </typeparam>
+        /// <param name="exampleIterator"> The example iterator. </param>
+        ///
+        /// <returns> The thresholds. </returns>
+        template <typename ExampleIteratorType>
+        std::vector<predictors::SingleElementThresholdPredictor> GetThresholds(ExampleIteratorType exampleIterator) const;
+
+        /// <summary> Returns a vector of SingleElementThresholdPredictor at estimated weighted quantiles,
+        /// computed from a feature-major copy of the examples, which is scanned with unit stride. </summary>
+        ///
+        /// <typeparam name="MetadataType"> The example metadata type. </typeparam>
+        /// <param name="dataset"> The feature-major dataset. </param>
+        ///
+        /// <returns> The thresholds. </returns>
+        template <typename MetadataType>
+        std::vector<predictors::SingleElementThresholdPredictor> GetThresholds(const data::ColumnMajorDataset<MetadataType>& dataset) const;
+
+    private:
+        // sorts the sketch and merges duplicate values; if it still exceeds targetSize, merges runs
+        // of adjacent entries into at most targetSize buckets of roughly equal total weight
+        void CompressSketch(std::vector<ValueWeight>& sketch, size_t targetSize) const;
+
+        std::vector<predictors::SingleElementThresholdPredictor> ThresholdsFromSketches(std::vector<std::vector<ValueWeight>>& sketches) const;
+
+        size_t _numCandidatesPerFeature;
     };
 }
 }
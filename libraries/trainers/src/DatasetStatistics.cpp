@@ -0,0 +1,253 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     DatasetStatistics.cpp (trainers)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "DatasetStatistics.h"
+
+// stl
+#include <algorithm>
+#include <cmath>
+
+namespace ell
+{
+namespace trainers
+{
+    QuantileSketch::QuantileSketch(size_t capacity, unsigned int seed)
+        : _capacity(capacity), _random(seed)
+    {
+        _samples.reserve(capacity);
+    }
+
+    void QuantileSketch::Update(double value)
+    {
+        ++_count;
+        if (_samples.size() < _capacity)
+        {
+            _samples.push_back(value);
+        }
+        else if (_capacity > 0)
+        {
+            // replace a random retained sample with probability capacity / count, which keeps the
+            // retained set a uniform sample of everything seen
+            std::uniform_int_distribution<size_t> slot(0, _count - 1);
+            size_t index = slot(_random);
+            if (index < _capacity)
+            {
+                _samples[index] = value;
+            }
+        }
+    }
+
+    void QuantileSketch::Merge(const QuantileSketch& other)
+    {
+        if (other._count == 0)
+        {
+            return;
+        }
+        if (_count == 0)
+        {
+            _samples = other._samples;
+            _count = other._count;
+            return;
+        }
+
+        // draw the merged sample set from the two retained sets without replacement, choosing each
+        // next sample from a side with probability proportional to that side's stream count
+        auto mine = _samples;
+        auto theirs = other._samples;
+        std::shuffle(mine.begin(), mine.end(), _random);
+        std::shuffle(theirs.begin(), theirs.end(), _random);
+        std::uniform_real_distribution<double> uniform(0, 1);
+
+        std::vector<double> merged;
+        merged.reserve(_capacity);
+        size_t myIndex = 0;
+        size_t theirIndex = 0;
+        double myWeight = static_cast<double>(_count);
+        double theirWeight = static_cast<double>(other._count);
+        while (merged.size() < _capacity && (myIndex < mine.size() || theirIndex < theirs.size()))
+        {
+            bool takeMine;
+            if (myIndex >= mine.size())
+            {
+                takeMine = false;
+            }
+            else if (theirIndex >= theirs.size())
+            {
+                takeMine = true;
+            }
+            else
+            {
+                takeMine = uniform(_random) * (myWeight + theirWeight) < myWeight;
+            }
+            merged.push_back(takeMine ? mine[myIndex++] : theirs[theirIndex++]);
+        }
+
+        _samples = std::move(merged);
+        _count += other._count;
+    }
+
+    double QuantileSketch::GetQuantile(double quantile) const
+    {
+        if (_samples.empty())
+        {
+            return 0;
+        }
+        auto sorted = _samples;
+        std::sort(sorted.begin(), sorted.end());
+        double position = quantile * (sorted.size() - 1);
+        size_t index = static_cast<size_t>(std::min(std::max(position + 0.5, 0.0), static_cast<double>(sorted.size() - 1)));
+        return sorted[index];
+    }
+
+    namespace
+    {
+        // grows the per-column accumulators to numColumns, retroactively accounting for the
+        // examples already seen: a column an example doesn't reach holds a zero there
+        void GrowColumns(size_t numColumns, size_t numExamplesSeen, size_t sketchCapacity, std::vector<double>& mean, std::vector<double>& sumSquaredDeviations, std::vector<double>& minValues, std::vector<double>& maxValues, std::vector<QuantileSketch>& sketches)
+        {
+            size_t oldNumColumns = mean.size();
+            mean.resize(numColumns, 0);
+            sumSquaredDeviations.resize(numColumns, 0);
+            minValues.resize(numColumns, 0);
+            maxValues.resize(numColumns, 0);
+            if (sketchCapacity > 0)
+            {
+                for (size_t column = oldNumColumns; column < numColumns; ++column)
+                {
+                    sketches.emplace_back(sketchCapacity, static_cast<unsigned int>(123 + column));
+                    for (size_t i = 0; i < numExamplesSeen; ++i)
+                    {
+                        sketches.back().Update(0);
+                    }
+                }
+            }
+        }
+    }
+
+    DatasetStatistics CalculateStatistics(const data::AnyDataset& anyDataset, size_t sketchCapacity)
+    {
+        std::vector<double> mean;
+        std::vector<double> sumSquaredDeviations;
+        std::vector<double> minValues;
+        std::vector<double> maxValues;
+        std::vector<QuantileSketch> sketches;
+        size_t count = 0;
+
+        auto exampleIterator = anyDataset.GetExampleIterator<data::AutoSupervisedExample>();
+        while (exampleIterator.IsValid())
+        {
+            auto values = exampleIterator.Get().GetDataVector().ToArray();
+            if (values.size() > mean.size())
+            {
+                GrowColumns(values.size(), count, sketchCapacity, mean, sumSquaredDeviations, minValues, maxValues, sketches);
+            }
+            ++count;
+
+            // one fused update per column: Welford's moment recurrence, the extremes and the
+            // sketch all consume the value while it is hot
+            for (size_t column = 0; column < mean.size(); ++column)
+            {
+                double value = column < values.size() ? values[column] : 0;
+                double delta = value - mean[column];
+                mean[column] += delta / count;
+                sumSquaredDeviations[column] += delta * (value - mean[column]);
+                if (count == 1)
+                {
+                    minValues[column] = value;
+                    maxValues[column] = value;
+                }
+                else
+                {
+                    minValues[column] = std::min(minValues[column], value);
+                    maxValues[column] = std::max(maxValues[column], value);
+                }
+                if (sketchCapacity > 0)
+                {
+                    sketches[column].Update(value);
+                }
+            }
+            exampleIterator.Next();
+        }
+
+        DatasetStatistics statistics;
+        statistics.numExamples = count;
+        statistics.mean = math::RowVector<double>(std::move(mean));
+        statistics.min = math::RowVector<double>(std::move(minValues));
+        statistics.max = math::RowVector<double>(std::move(maxValues));
+        if (count > 0)
+        {
+            for (auto& sum : sumSquaredDeviations)
+            {
+                sum /= count;
+            }
+        }
+        statistics.variance = math::RowVector<double>(std::move(sumSquaredDeviations));
+        statistics.quantileSketches = std::move(sketches);
+        return statistics;
+    }
+
+    void MergeStatistics(DatasetStatistics& statistics, const DatasetStatistics& other)
+    {
+        if (other.numExamples == 0)
+        {
+            return;
+        }
+        if (statistics.numExamples == 0)
+        {
+            statistics = other;
+            return;
+        }
+
+        // align the column counts; a shard that never reached a column holds zeros there
+        size_t numColumns = std::max(statistics.mean.Size(), other.mean.Size());
+        auto padded = [numColumns](const math::RowVector<double>& vector) {
+            auto values = vector.ToArray();
+            values.resize(numColumns, 0);
+            return values;
+        };
+        auto mean = padded(statistics.mean);
+        auto otherMean = padded(other.mean);
+        auto variance = padded(statistics.variance);
+        auto otherVariance = padded(other.variance);
+        auto minValues = padded(statistics.min);
+        auto otherMin = padded(other.min);
+        auto maxValues = padded(statistics.max);
+        auto otherMax = padded(other.max);
+
+        double myCount = static_cast<double>(statistics.numExamples);
+        double theirCount = static_cast<double>(other.numExamples);
+        double totalCount = myCount + theirCount;
+        for (size_t column = 0; column < numColumns; ++column)
+        {
+            // Chan's parallel merge of the first two moments: exact, up to rounding
+            double delta = otherMean[column] - mean[column];
+            double mergedMean = mean[column] + delta * theirCount / totalCount;
+            double sumSquaredDeviations = variance[column] * myCount + otherVariance[column] * theirCount + delta * delta * myCount * theirCount / totalCount;
+            mean[column] = mergedMean;
+            variance[column] = sumSquaredDeviations / totalCount;
+            minValues[column] = std::min(minValues[column], otherMin[column]);
+            maxValues[column] = std::max(maxValues[column], otherMax[column]);
+        }
+
+        statistics.mean = math::RowVector<double>(std::move(mean));
+        statistics.variance = math::RowVector<double>(std::move(variance));
+        statistics.min = math::RowVector<double>(std::move(minValues));
+        statistics.max = math::RowVector<double>(std::move(maxValues));
+
+        if (!other.quantileSketches.empty())
+        {
+            statistics.quantileSketches.resize(numColumns);
+            for (size_t column = 0; column < other.quantileSketches.size(); ++column)
+            {
+                statistics.quantileSketches[column].Merge(other.quantileSketches[column]);
+            }
+        }
+        statistics.numExamples += other.numExamples;
+    }
+}
+}
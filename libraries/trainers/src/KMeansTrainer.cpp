@@ -10,17 +10,66 @@
 // math
 #include "Operations.h"
 
+// utilities
+#include "PairwiseReduction.h"
+#include "ThreadPool.h"
+
 // stl
+#include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <future>
+#include <limits>
 
 namespace ell
 {
 namespace trainers
 {
+    namespace
+    {
+        double Distance(math::ConstVectorReference<double, math::VectorOrientation::column> x, math::ConstVectorReference<double, math::VectorOrientation::column> mu)
+        {
+            double sum = 0.0;
+            for (size_t j = 0; j < x.Size(); ++j)
+            {
+                double diff = x[j] - mu[j];
+                sum += diff * diff;
+            }
+            return std::sqrt(sum);
+        }
+
+        // Runs worker(chunkIndex, begin, end) over numChunks contiguous chunks of [0, count) on the
+        // shared thread pool, or inline when a single chunk is requested.
+        template <typename WorkerType>
+        void ParallelForChunks(size_t count, size_t numChunks, WorkerType worker)
+        {
+            if (numChunks <= 1)
+            {
+                worker(static_cast<size_t>(0), static_cast<size_t>(0), count);
+                return;
+            }
+
+            auto& pool = utilities::GetThreadPool();
+            std::vector<std::future<void>> inFlight;
+            for (size_t chunk = 0; chunk < numChunks; ++chunk)
+            {
+                size_t begin = chunk * count / numChunks;
+                size_t end = (chunk + 1) * count / numChunks;
+                inFlight.push_back(pool.Submit(worker, chunk, begin, end));
+            }
+            for (auto& future : inFlight)
+            {
+                pool.Wait(future);
+            }
+        }
+    }
+
     KMeansTrainer::KMeansTrainer(size_t dim, size_t numClusters, size_t iterations)
         : _means(dim, numClusters), _numClusters(numClusters), _iterations(iterations), _isInitialized(false) {}
 
+    KMeansTrainer::KMeansTrainer(size_t dim, size_t numClusters, size_t iterations, KMeansTrainerParameters parameters)
+        : _means(dim, numClusters), _numClusters(numClusters), _iterations(iterations), _isInitialized(false), _parameters(parameters) {}
+
     KMeansTrainer::KMeansTrainer(size_t numClusters, size_t iters, math::ColumnMatrix<double> means)
         : _numClusters(numClusters), _iterations(iters), _means(means), _isInitialized(true) {}
 
@@ -29,15 +78,222 @@ namespace trainers
         if (false == _isInitialized)
             initializeMeans(X);
 
-        math::ColumnVector<size_t> clusterAssignment(X.NumColumns());
-        double prevDistance = 0.0;
-        for (int i = 0; i < _iterations; ++i)
+        if (_parameters.minibatchSize > 0 && _parameters.minibatchSize < X.NumColumns())
+            runMinibatchKMeans(X);
+        else
+            runLloydKMeans(X);
+    }
+
+    void KMeansTrainer::runLloydKMeans(math::ConstMatrixReference<double, math::MatrixLayout::columnMajor> X)
+    {
+        size_t n = X.NumColumns();
+        size_t d = X.NumRows();
+        size_t k = _numClusters;
+
+        size_t numThreads = _parameters.numThreads == 0 ? utilities::GetThreadPool().NumThreads() : _parameters.numThreads;
+        numThreads = std::max<size_t>(1, std::min(numThreads, n));
+
+        // Hamerly bounds: an upper bound on each point's distance to its assigned center, and a
+        // lower bound on its distance to every other center. The initial values force the first
+        // iteration to compute all distances exactly.
+        std::vector<size_t> assignment(n, 0);
+        std::vector<double> upperBound(n, std::numeric_limits<double>::max());
+        std::vector<double> lowerBound(n, 0.0);
+
+        for (size_t iteration = 0; iteration < _iterations; ++iteration)
         {
-            auto totalDistance = assignClosestCenter(X, clusterAssignment);
-            if (totalDistance == prevDistance)
+            // half the distance from each center to its nearest other center; points within this
+            // radius of their assigned center can't be closer to any other center
+            std::vector<double> centerSeparation(k, std::numeric_limits<double>::max());
+            for (size_t c1 = 0; c1 < k; ++c1)
+            {
+                for (size_t c2 = c1 + 1; c2 < k; ++c2)
+                {
+                    double dist = Distance(_means.GetColumn(c1), _means.GetColumn(c2));
+                    centerSeparation[c1] = std::min(centerSeparation[c1], dist);
+                    centerSeparation[c2] = std::min(centerSeparation[c2], dist);
+                }
+            }
+            for (size_t c = 0; c < k; ++c)
+            {
+                centerSeparation[c] *= 0.5;
+            }
+
+            // parallel assignment with per-thread center accumulators
+            std::vector<std::vector<double>> chunkSums(numThreads, std::vector<double>(k * d, 0.0));
+            std::vector<std::vector<double>> chunkCounts(numThreads, std::vector<double>(k, 0.0));
+            std::vector<char> chunkChanged(numThreads, 0);
+            ParallelForChunks(n, numThreads, [&, this](size_t chunk, size_t begin, size_t end) {
+                chunkChanged[chunk] = assignChunk(X, begin, end, centerSeparation, assignment, upperBound, lowerBound, chunkSums[chunk], chunkCounts[chunk]) ? 1 : 0;
+            });
+
+            // merge the per-chunk accumulators with a fixed pairwise tree keyed to the chunk
+            // indices, so the merged sums are bit-identical from run to run regardless of which
+            // thread finished first
+            auto combineElementwise = [](std::vector<double> a, const std::vector<double>& b) {
+                for (size_t j = 0; j < a.size(); ++j)
+                {
+                    a[j] += b[j];
+                }
+                return a;
+            };
+            auto clusterSums = utilities::ReducePairwise(std::move(chunkSums), combineElementwise);
+            auto clusterCounts = utilities::ReducePairwise(std::move(chunkCounts), combineElementwise);
+            bool anyChanged = false;
+            for (size_t chunk = 0; chunk < numThreads; ++chunk)
+            {
+                anyChanged |= chunkChanged[chunk] != 0;
+            }
+
+            if (!anyChanged)
+                break;
+
+            // recompute the means and how far each one moved; empty clusters keep their mean
+            std::vector<double> centerMovement(k, 0.0);
+            double maxMovement = 0.0;
+            math::ColumnVector<double> newMean(d);
+            for (size_t c = 0; c < k; ++c)
+            {
+                if (clusterCounts[c] == 0.0)
+                    continue;
+
+                for (size_t j = 0; j < d; ++j)
+                {
+                    newMean[j] = clusterSums[c * d + j] / clusterCounts[c];
+                }
+                centerMovement[c] = Distance(newMean, _means.GetColumn(c));
+                maxMovement = std::max(maxMovement, centerMovement[c]);
+                _means.GetColumn(c).CopyFrom(newMean);
+            }
+
+            if (maxMovement == 0.0)
                 break;
-            recomputeMeans(X, clusterAssignment);
-            prevDistance = totalDistance;
+
+            // loosen the bounds to account for the center movement
+            for (size_t i = 0; i < n; ++i)
+            {
+                upperBound[i] += centerMovement[assignment[i]];
+                lowerBound[i] -= maxMovement;
+            }
+        }
+    }
+
+    bool KMeansTrainer::assignChunk(math::ConstMatrixReference<double, math::MatrixLayout::columnMajor> X,
+                                    size_t begin,
+                                    size_t end,
+                                    const std::vector<double>& centerSeparation,
+                                    std::vector<size_t>& assignment,
+                                    std::vector<double>& upperBound,
+                                    std::vector<double>& lowerBound,
+                                    std::vector<double>& clusterSums,
+                                    std::vector<double>& clusterCounts) const
+    {
+        size_t d = X.NumRows();
+        size_t k = _numClusters;
+        bool anyChanged = false;
+
+        for (size_t i = begin; i < end; ++i)
+        {
+            auto point = X.GetColumn(i);
+            size_t a = assignment[i];
+            double pruneThreshold = std::max(centerSeparation[a], lowerBound[i]);
+
+            if (upperBound[i] > pruneThreshold)
+            {
+                // tighten the upper bound and re-test before paying for the full scan
+                upperBound[i] = Distance(point, _means.GetColumn(a));
+                if (upperBound[i] > pruneThreshold)
+                {
+                    double closest = std::numeric_limits<double>::max();
+                    double secondClosest = std::numeric_limits<double>::max();
+                    size_t closestCenter = a;
+                    for (size_t c = 0; c < k; ++c)
+                    {
+                        double dist = Distance(point, _means.GetColumn(c));
+                        if (dist < closest)
+                        {
+                            secondClosest = closest;
+                            closest = dist;
+                            closestCenter = c;
+                        }
+                        else if (dist < secondClosest)
+                        {
+                            secondClosest = dist;
+                        }
+                    }
+
+                    anyChanged |= closestCenter != a;
+                    assignment[i] = closestCenter;
+                    upperBound[i] = closest;
+                    lowerBound[i] = secondClosest;
+                }
+            }
+
+            size_t c = assignment[i];
+            for (size_t j = 0; j < d; ++j)
+            {
+                clusterSums[c * d + j] += point[j];
+            }
+            clusterCounts[c] += 1.0;
+        }
+
+        return anyChanged;
+    }
+
+    void KMeansTrainer::runMinibatchKMeans(math::ConstMatrixReference<double, math::MatrixLayout::columnMajor> X)
+    {
+        size_t n = X.NumColumns();
+        size_t d = X.NumRows();
+        size_t k = _numClusters;
+        size_t batchSize = _parameters.minibatchSize;
+
+        size_t numThreads = _parameters.numThreads == 0 ? utilities::GetThreadPool().NumThreads() : _parameters.numThreads;
+        numThreads = std::max<size_t>(1, std::min(numThreads, batchSize));
+
+        std::vector<size_t> sampleIndices(batchSize);
+        std::vector<size_t> sampleAssignment(batchSize);
+        std::vector<double> perCenterCount(k, 0.0);
+
+        for (size_t iteration = 0; iteration < _iterations; ++iteration)
+        {
+            for (size_t b = 0; b < batchSize; ++b)
+            {
+                sampleIndices[b] = rand() % n;
+            }
+
+            // parallel exact assignment of the minibatch
+            ParallelForChunks(batchSize, numThreads, [&, this](size_t, size_t begin, size_t end) {
+                for (size_t b = begin; b < end; ++b)
+                {
+                    auto point = X.GetColumn(sampleIndices[b]);
+                    double closest = std::numeric_limits<double>::max();
+                    size_t closestCenter = 0;
+                    for (size_t c = 0; c < k; ++c)
+                    {
+                        double dist = Distance(point, _means.GetColumn(c));
+                        if (dist < closest)
+                        {
+                            closest = dist;
+                            closestCenter = c;
+                        }
+                    }
+                    sampleAssignment[b] = closestCenter;
+                }
+            });
+
+            // move each center towards its sampled points with a per-center decaying step size
+            for (size_t b = 0; b < batchSize; ++b)
+            {
+                auto point = X.GetColumn(sampleIndices[b]);
+                size_t c = sampleAssignment[b];
+                perCenterCount[c] += 1.0;
+                double stepSize = 1.0 / perCenterCount[c];
+                auto mean = _means.GetColumn(c);
+                for (size_t j = 0; j < d; ++j)
+                {
+                    mean[j] = (1.0 - stepSize) * mean[j] + stepSize * point[j];
+                }
+            }
         }
     }
 
@@ -113,41 +369,6 @@ namespace trainers
         return distance;
     }
 
-    double KMeansTrainer::assignClosestCenter(math::ConstMatrixReference<double, math::MatrixLayout::columnMajor> X, math::VectorReference<size_t, math::VectorOrientation::column> clusterAssignment)
-    {
-        auto D = pairwiseDistance(X, _means);
-
-        double totalDist = 0;
-        for (int i = 0; i < D.NumRows(); ++i)
-        {
-            auto dist = D.GetRow(i);
-            auto minElement = std::min_element(dist.GetDataPointer(), dist.GetDataPointer() + dist.Size());
-            clusterAssignment[i] = minElement - dist.GetDataPointer();
-            totalDist += *minElement;
-        }
-
-        return totalDist;
-    }
-
-    void KMeansTrainer::recomputeMeans(math::ConstMatrixReference<double, math::MatrixLayout::columnMajor> X, const math::ColumnVector<size_t> clusterAssignment)
-    {
-        math::ColumnMatrix<double> clusterSum(X.NumRows(), _numClusters);
-        math::ColumnVector<double> numPointsPerCluster(_numClusters);
-        for (int i = 0; i < X.NumColumns(); ++i)
-        {
-            auto idx = clusterAssignment[i];
-            clusterSum.GetColumn(idx) += X.GetColumn(i);
-            numPointsPerCluster[idx] += 1;
-        }
-
-        for (int i = 0; i < _numClusters; i++)
-        {
-            clusterSum.GetColumn(i) /= numPointsPerCluster[i];
-        }
-
-        _means.CopyFrom(clusterSum);
-    }
-
     size_t KMeansTrainer::weightedSample(math::ColumnVector<double> weights)
     {
         size_t n = weights.Size();
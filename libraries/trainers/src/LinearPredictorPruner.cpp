@@ -0,0 +1,108 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     LinearPredictorPruner.cpp (trainers)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "LinearPredictorPruner.h"
+
+// stl
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace ell
+{
+namespace trainers
+{
+    namespace
+    {
+        // builds the compacted result from a keep decision per dimension
+        LinearPredictorPruningResult CompactPredictor(const predictors::LinearPredictor& predictor, const std::vector<bool>& keep, double threshold)
+        {
+            LinearPredictorPruningResult result;
+            result.threshold = threshold;
+
+            const auto& weights = predictor.GetWeights();
+            std::vector<double> keptWeights;
+            for (size_t index = 0; index < predictor.Size(); ++index)
+            {
+                if (keep[index])
+                {
+                    result.keptIndices.push_back(index);
+                    keptWeights.push_back(weights[index]);
+                }
+            }
+
+            result.predictor = predictors::LinearPredictor(math::ColumnVector<double>(std::move(keptWeights)), predictor.GetBias());
+            return result;
+        }
+    }
+
+    LinearPredictorPruningResult PruneLinearPredictor(const predictors::LinearPredictor& predictor, double threshold)
+    {
+        const auto& weights = predictor.GetWeights();
+        std::vector<bool> keep(predictor.Size());
+        for (size_t index = 0; index < predictor.Size(); ++index)
+        {
+            keep[index] = std::abs(weights[index]) > threshold;
+        }
+        return CompactPredictor(predictor, keep, threshold);
+    }
+
+    LinearPredictorPruningResult PruneLinearPredictor(const predictors::LinearPredictor& predictor, evaluators::IEvaluator<predictors::LinearPredictor>& evaluator, double maxGoodnessLoss)
+    {
+        auto size = predictor.Size();
+        const auto& weights = predictor.GetWeights();
+
+        // baseline goodness of the unpruned predictor
+        evaluator.Evaluate(predictor);
+        double baseline = evaluator.GetGoodness();
+
+        // order the dimensions by weight magnitude, smallest first: pruning k weights always means
+        // pruning the k smallest
+        std::vector<size_t> order(size);
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [&](size_t index1, size_t index2) { return std::abs(weights[index1]) < std::abs(weights[index2]); });
+
+        // a candidate pruning is validated by zeroing the pruned weights in a full-size copy, which
+        // predicts identically to the compacted predictor but can be scored on the original dataset
+        auto isAcceptable = [&](size_t numPruned) {
+            predictors::LinearPredictor candidate(math::ColumnVector<double>(weights.ToArray()), predictor.GetBias());
+            for (size_t index = 0; index < numPruned; ++index)
+            {
+                candidate.GetWeights()[order[index]] = 0;
+            }
+            evaluator.Evaluate(candidate);
+            return baseline - evaluator.GetGoodness() <= maxGoodnessLoss;
+        };
+
+        // binary search for the largest acceptable number of pruned weights; goodness loss is
+        // treated as monotone in the number of pruned weights
+        size_t low = 0;
+        size_t high = size;
+        while (low < high)
+        {
+            size_t middle = (low + high + 1) / 2;
+            if (isAcceptable(middle))
+            {
+                low = middle;
+            }
+            else
+            {
+                high = middle - 1;
+            }
+        }
+
+        std::vector<bool> keep(size, true);
+        for (size_t index = 0; index < low; ++index)
+        {
+            keep[order[index]] = false;
+        }
+        double threshold = low > 0 ? std::abs(weights[order[low - 1]]) : 0;
+        return CompactPredictor(predictor, keep, threshold);
+    }
+}
+}
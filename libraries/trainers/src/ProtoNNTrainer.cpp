@@ -91,9 +91,8 @@ namespace trainers
         if (-1.0 == _parameters.gamma)
         {
             auto gammaInit = 0.01;
-            math::ColumnMatrix<double> WXupdate(W.NumRows(), n);
-            math::Operations::Multiply<double>(1, W, _X, 0, WXupdate);
-            _parameters.gamma = protonnInit.InitializeGamma(SimilarityKernel(modelMap, _X, WXupdate, gammaInit), gammaInit);
+            // WX already holds the projection of the full dataset
+            _parameters.gamma = protonnInit.InitializeGamma(SimilarityKernel(modelMap, _X, WX, gammaInit), gammaInit);
         }
 
         SGDWithAlternatingMinimization(_X, _Y, modelMap, _parameters.gamma, nIters);
@@ -192,18 +191,12 @@ namespace trainers
         switch (_parameters.lossType)
         {
         case ProtoNNLossType::L2:
-            for (size_t j = 0; j < residual.NumColumns(); j++)
-            {
-                // diff .* 2
-                residual.GetColumn(j).Transform([](double x) { return x * x; });
-            }
+            // diff .* 2, in a single pass over the matrix
+            residual.Transform([](double x) { return x * x; });
             break;
         case ProtoNNLossType::L4:
-            for (size_t j = 0; j < residual.NumColumns(); j++)
-            {
-                // diff .* 4
-                residual.GetColumn(j).Transform([](double x) { return x * x * x * x; });
-            }
+            // diff .* 4, in a single pass over the matrix
+            residual.Transform([](double x) { return x * x * x * x; });
             break;
         }
 
@@ -426,11 +419,17 @@ namespace trainers
                     math::ColumnMatrix<double> perturbedParameter(parameterMatrix.NumRows(), parameterMatrix.NumColumns());
                     math::Operations::Add(1.0, parameterMatrix, -1.0 * coeff, thresholdedGradient, perturbedParameter);
 
-                    auto WX_old = WX;
                     modelMap[parameterIndex]->GetData() = perturbedParameter;
 
-                    // Compute gradient_paramS with updated parameter
-                    math::Operations::Multiply<double>(1, modelMap[m_projectionIndex]->GetData(), X, 0, WX);
+                    // Compute gradient_paramS with updated parameter. Only the projection parameter
+                    // changes WX, and SimilarityKernel refreshes the batch columns itself when
+                    // recomputeWX is set - so save and restore just those columns instead of
+                    // recomputing and copying the full d x n product on every probe.
+                    math::ColumnMatrix<double> wxBatch(WX.NumRows(), idx2 - idx1);
+                    if (recomputeWX[parameterIndex])
+                    {
+                        wxBatch.CopyFrom(WX.GetSubMatrix(0, idx1, WX.NumRows(), idx2 - idx1));
+                    }
 
                     math::ColumnMatrix<double> gradientEstimate(parameterMatrix.NumRows(), parameterMatrix.NumColumns());
                     auto grad = modelMap[parameterIndex]->gradient(modelMap, X, Y, WX, SimilarityKernel(modelMap, X, WX, gamma, idx1, idx2, recomputeWX[parameterIndex]), gamma, idx1, idx2, _parameters.lossType);
@@ -440,7 +439,10 @@ namespace trainers
 
                     // revert the old parameter value and projected input
                     modelMap[parameterIndex]->GetData() = parameterMatrix;
-                    WX = WX_old;
+                    if (recomputeWX[parameterIndex])
+                    {
+                        WX.GetSubMatrix(0, idx1, WX.NumRows(), idx2 - idx1).CopyFrom(wxBatch);
+                    }
 
                     if (ProtoNNTrainerUtils::MatrixNorm(currentGradient) <= 1e-20L) {
                         std::cerr << "Different between consecutive gradients has become really low..\n";
@@ -470,9 +472,14 @@ namespace trainers
                     std::bind(ProtoNNTrainerUtils::HardThresholding, std::placeholders::_1, sparsity[parameterIndex]),
                     parameterMatrix, epochs, n, sgdBatchSize, paramStepSize, eta_update);
 
-                math::Operations::Multiply<double>(1, modelMap[m_projectionIndex]->GetData(), X, 0, WX);
+                // refresh the projected dataset only when the projection itself was updated; the
+                // full product is then current, so the objective doesn't need per-batch recomputes
+                if (recomputeWX[parameterIndex])
+                {
+                    math::Operations::Multiply<double>(1, modelMap[m_projectionIndex]->GetData(), X, 0, WX);
+                }
                 fOld = fCur;
-                fCur = ComputeObjective(modelMap, X, Y, WX, gamma, recomputeWX[parameterIndex]);
+                fCur = ComputeObjective(modelMap, X, Y, WX, gamma, false);
 
                 // Armijo step
                 // If function value has increased, decrease the step size else increase
@@ -519,22 +526,20 @@ namespace trainers
         switch (lossType)
         {
         case ProtoNNLossType::L2:
-            for (size_t j = 0; j < residual.NumColumns(); j++)
-            {
-                // 4 * gamma * gamma * diff
-                double multiplication_scalar = 4.0 * gamma * gamma;
-                residual.GetColumn(j).Transform([multiplication_scalar](double x) { return multiplication_scalar * x; });
-            }
+        {
+            // 4 * gamma * gamma * diff
+            double multiplication_scalar = 4.0 * gamma * gamma;
+            residual.Transform([multiplication_scalar](double x) { return multiplication_scalar * x; });
             break;
+        }
         case ProtoNNLossType::L4:
-            for (size_t j = 0; j < residual.NumColumns(); j++)
-            {
-                // 8 * gamma * gamma * diff
-                double multiplication_scalar = 8.0 * gamma * gamma;
-                residual.GetColumn(j).Transform([multiplication_scalar](double x) { return multiplication_scalar * x * x * x; });
-            }
+        {
+            // 8 * gamma * gamma * diff
+            double multiplication_scalar = 8.0 * gamma * gamma;
+            residual.Transform([multiplication_scalar](double x) { return multiplication_scalar * x * x * x; });
             break;
         }
+        }
 
         // T = diff * Z
         math::RowMatrix<double> T(D.NumRows(), D.NumColumns());
@@ -599,10 +604,7 @@ namespace trainers
             break;
 
         case ProtoNNLossType::L4:
-            for (size_t j = 0; j < residual.NumColumns(); j++)
-            {
-                residual.GetColumn(j).Transform([](double x) { return x * x * x; });
-            }
+            residual.Transform([](double x) { return x * x * x; });
             // gradient_paramS = -4 * (yMinusZD .^ 3) * D
             math::Operations::Multiply<double>(-4, residual, Similarity, 0, gradient);
             break;
@@ -639,23 +641,20 @@ namespace trainers
         switch (lossType)
         {
         case ProtoNNLossType::L2:
-            for (size_t j = 0; j < residual.NumColumns(); j++)
-            {
-                // 4 * gamma * gamma * diff
-                double multScalar = 4.0 * gamma * gamma;
-                residual.GetColumn(j).Transform([multScalar](double x) { return multScalar * x; });
-            }
+        {
+            // 4 * gamma * gamma * diff
+            double multScalar = 4.0 * gamma * gamma;
+            residual.Transform([multScalar](double x) { return multScalar * x; });
             break;
+        }
         case ProtoNNLossType::L4:
-            for (size_t j = 0; j < residual.NumColumns(); j++)
-            {
-                // 8 * gamma * gamma * diff
-                double multScalar = 8.0 * gamma * gamma;
-                residual.GetColumn(j).Transform([multScalar](double x) { return multScalar * x * x * x; });
-            }
-
+        {
+            // 8 * gamma * gamma * diff
+            double multScalar = 8.0 * gamma * gamma;
+            residual.Transform([multScalar](double x) { return multScalar * x * x * x; });
             break;
         }
+        }
 
         // T = residual * Z
         math::RowMatrix<double> T(Similarity.NumRows(), Similarity.NumColumns());
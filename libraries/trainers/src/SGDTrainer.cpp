@@ -8,6 +8,15 @@
 
 #include "SGDTrainer.h"
 
+// utilities
+#include "Exception.h"
+#include "PerformanceProbes.h"
+#include "ThreadPool.h"
+
+// stl
+#include <utility>
+#include <vector>
+
 namespace ell
 {
 namespace trainers
@@ -16,43 +25,141 @@ namespace trainers
     void SGDTrainerBase::SetDataset(const data::AnyDataset& anyDataset)
     {
         _dataset = data::Dataset<data::AutoSupervisedExample>(anyDataset);
+        _getExampleIterator = nullptr;
+    }
+
+    void SGDTrainerBase::SetPredictor(const PredictorType&)
+    {
+        throw utilities::LogicException(utilities::LogicExceptionErrors::notImplemented, "this trainer does not support continuing from a given predictor");
+    }
+
+    void SGDTrainerBase::SetStreamingDataset(ExampleIteratorFactory getExampleIterator, size_t readAheadBufferSize)
+    {
+        if (getExampleIterator == nullptr || readAheadBufferSize == 0)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "streaming dataset requires an iterator factory and a positive buffer size");
+        }
+
+        _getExampleIterator = std::move(getExampleIterator);
+        _readAheadBufferSize = readAheadBufferSize;
+        _dataset = data::AutoSupervisedDataset{};
     }
 
     void SGDTrainerBase::Update()
     {
-        // permute the data
-        _dataset.RandomPermute(_random);
+        if (_getExampleIterator != nullptr)
+        {
+            UpdateFromStream();
+        }
+        else
+        {
+            UpdateFromDataset();
+        }
+        ++_epochs;
+    }
 
-        // get example iterator
-        auto exampleIterator = _dataset.GetExampleReferenceIterator();
+    void SGDTrainerBase::Update(math::ConstMatrixReference<double, math::MatrixLayout::rowMajor> examples, math::ConstVectorReference<double, math::VectorOrientation::column> labels)
+    {
+        if (examples.NumRows() != labels.Size())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::sizeMismatch, "number of examples and labels must match");
+        }
 
-        // first iteration handled separately
-        if (_firstIteration && exampleIterator.IsValid())
+        if (examples.NumRows() == 0)
         {
-            const auto& example = exampleIterator.Get();
+            return;
+        }
 
-            const auto& x = example.GetDataVector();
-            double y = example.GetMetadata().label;
-            double weight = example.GetMetadata().weight;
+        DoBatchStep(examples, labels);
+    }
 
-            DoFirstStep(x, y, weight);
+    void SGDTrainerBase::DoBatchStep(math::ConstMatrixReference<double, math::MatrixLayout::rowMajor> examples, math::ConstVectorReference<double, math::VectorOrientation::column> labels)
+    {
+        auto numExamples = examples.NumRows();
+        auto numColumns = examples.NumColumns();
+        for (size_t i = 0; i < numExamples; ++i)
+        {
+            auto row = examples.GetRow(i);
+            std::vector<double> values(numColumns);
+            for (size_t j = 0; j < numColumns; ++j)
+            {
+                values[j] = row[j];
+            }
 
-            exampleIterator.Next();
-            _firstIteration = false;
+            data::AutoDataVector x(std::move(values));
+            TakeStep(x, labels[i], 1.0);
         }
+    }
+
+    void SGDTrainerBase::UpdateFromDataset()
+    {
+        // permute the iteration order; the examples themselves stay put
+        _dataset.RandomPermuteView(_random);
 
-        while (exampleIterator.IsValid())
+        auto numExamples = _dataset.NumExamples();
+        for (size_t i = 0; i < numExamples; ++i)
         {
-            // get the Next example
-            const auto& example = exampleIterator.Get();
+            const auto& example = _dataset.GetViewExample(i);
 
             const auto& x = example.GetDataVector();
             double y = example.GetMetadata().label;
             double weight = example.GetMetadata().weight;
 
-            DoNextStep(x, y, weight);
+            TakeStep(x, y, weight);
+        }
+    }
+
+    void SGDTrainerBase::UpdateFromStream()
+    {
+        auto exampleIterator = _getExampleIterator();
+
+        std::vector<data::AutoSupervisedExample> frontBuffer;
+        std::vector<data::AutoSupervisedExample> backBuffer;
+        frontBuffer.reserve(_readAheadBufferSize);
+        backBuffer.reserve(_readAheadBufferSize);
+
+        // reads the next chunk of examples from the iterator into a buffer; while a chunk is being
+        // trained on, the read of the next chunk runs on a worker thread, so gradient steps overlap
+        // file I/O and parsing
+        auto fillBuffer = [this, &exampleIterator](std::vector<data::AutoSupervisedExample>* buffer) {
+            buffer->clear();
+            while (buffer->size() < _readAheadBufferSize && exampleIterator.IsValid())
+            {
+                buffer->push_back(exampleIterator.Get());
+                exampleIterator.Next();
+            }
+        };
+
+        fillBuffer(&frontBuffer);
+        while (!frontBuffer.empty())
+        {
+            auto readAhead = utilities::GetThreadPool().Submit(fillBuffer, &backBuffer);
 
-            exampleIterator.Next();
+            for (const auto& example : frontBuffer)
+            {
+                TakeStep(example.GetDataVector(), example.GetMetadata().label, example.GetMetadata().weight);
+            }
+
+            utilities::GetThreadPool().Wait(readAhead);
+            readAhead.get();
+            std::swap(frontBuffer, backBuffer);
+        }
+    }
+
+    void SGDTrainerBase::TakeStep(const data::AutoDataVector& x, double y, double weight)
+    {
+        static utilities::PerformanceProbe takeStepProbe("SGDTrainerBase::TakeStep");
+        utilities::ScopedPerformanceProbe measure(takeStepProbe);
+
+        // first step handled separately
+        if (_firstIteration)
+        {
+            DoFirstStep(x, y, weight);
+            _firstIteration = false;
+        }
+        else
+        {
+            DoNextStep(x, y, weight);
         }
     }
 
@@ -62,4 +169,4 @@ namespace trainers
         _random = std::default_random_engine(seed);
     }
 }
-}
\ No newline at end of file
+}
@@ -9,17 +9,96 @@
 #include "ThresholdFinder.h"
 
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <functional>
+#include <utility>
 #include <vector>
 
 namespace ell
 {
 namespace trainers
 {
+    namespace
+    {
+        // maps a double to an unsigned key with the same ordering: flip all the bits of negatives
+        // and just the sign bit of positives, so unsigned comparison matches operator< on the doubles
+        uint64_t MakeRadixKey(double value)
+        {
+            uint64_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            return (bits & 0x8000000000000000ull) != 0 ? ~bits : bits | 0x8000000000000000ull;
+        }
+
+        // below this size, the comparison sort wins
+        const size_t radixSortMinSize = 128;
+    }
+
+    void ThresholdFinder::RadixSortByValue(std::vector<ValueWeight>::iterator begin, std::vector<ValueWeight>::iterator end)
+    {
+        size_t size = end - begin;
+        if (size < radixSortMinSize)
+        {
+            std::sort(begin, end, std::less<double>());
+            return;
+        }
+
+        using KeyedValue = std::pair<uint64_t, ValueWeight>;
+        std::vector<KeyedValue> keyed;
+        keyed.reserve(size);
+        for (auto iter = begin; iter != end; ++iter)
+        {
+            keyed.push_back({ MakeRadixKey(iter->value), *iter });
+        }
+        std::vector<KeyedValue> buffer(size);
+
+        // least-significant-digit counting sort, one byte per pass; a pass where all keys share the
+        // same byte value is a no-op and is skipped
+        for (size_t pass = 0; pass < sizeof(uint64_t); ++pass)
+        {
+            size_t shift = 8 * pass;
+            size_t counts[257] = { 0 };
+            for (const auto& keyedValue : keyed)
+            {
+                ++counts[((keyedValue.first >> shift) & 0xff) + 1];
+            }
+
+            bool singleBucket = false;
+            for (size_t b = 1; b <= 256; ++b)
+            {
+                if (counts[b] == size)
+                {
+                    singleBucket = true;
+                    break;
+                }
+            }
+            if (singleBucket)
+            {
+                continue;
+            }
+
+            for (size_t b = 1; b <= 256; ++b)
+            {
+                counts[b] += counts[b - 1];
+            }
+            for (const auto& keyedValue : keyed)
+            {
+                buffer[counts[(keyedValue.first >> shift) & 0xff]++] = keyedValue;
+            }
+            keyed.swap(buffer);
+        }
+
+        auto iter = begin;
+        for (const auto& keyedValue : keyed)
+        {
+            *iter++ = keyedValue.second;
+        }
+    }
+
     size_t ThresholdFinder::SortReduceCopy(std::vector<ValueWeight>::iterator begin, const std::vector<ValueWeight>::iterator end) const
     {
         // sort the values
-        std::sort(begin, end, std::less<double>());
+        RadixSortByValue(begin, end);
 
         auto iter = begin;
         auto current = begin;
@@ -40,5 +119,87 @@ namespace trainers
         }
         return current - begin + 1;
     }
+
+    std::vector<predictors::SingleElementThresholdPredictor> ExhaustiveThresholdFinder::GetThresholds(const UniqueValuesResult& uniqueValuesResult) const
+    {
+        std::vector<predictors::SingleElementThresholdPredictor> thresholdPredictors;
+
+        for (size_t j = 0; j < uniqueValuesResult.weightedValues.size(); ++j)
+        {
+            const auto& featureValues = uniqueValuesResult.weightedValues[j];
+            for (size_t i = 0; i + 1 < featureValues.size(); ++i)
+            {
+                thresholdPredictors.push_back({ j, 0.5 * (featureValues[i].value + featureValues[i + 1].value) });
+            }
+        }
+
+        return thresholdPredictors;
+    }
+
+    QuantileThresholdFinder::QuantileThresholdFinder(size_t numCandidatesPerFeature) :
+        _numCandidatesPerFeature(numCandidatesPerFeature)
+    {
+    }
+
+    void QuantileThresholdFinder::CompressSketch(std::vector<ValueWeight>& sketch, size_t targetSize) const
+    {
+        if (sketch.empty())
+        {
+            return;
+        }
+
+        auto newSize = SortReduceCopy(sketch.begin(), sketch.end());
+        sketch.resize(newSize);
+        if (sketch.size() <= targetSize)
+        {
+            return;
+        }
+
+        double totalWeight = 0.0;
+        for (const auto& valueWeight : sketch)
+        {
+            totalWeight += valueWeight.weight;
+        }
+
+        // merge runs of adjacent entries into buckets of roughly equal total weight; each bucket is
+        // represented by its largest value, so the compressed sketch stays sorted and unique
+        std::vector<ValueWeight> compressed;
+        compressed.reserve(targetSize);
+        double bucketWeight = totalWeight / targetSize;
+        double accumulatedWeight = 0.0;
+        ValueWeight current{ sketch[0].value, 0.0 };
+        for (const auto& valueWeight : sketch)
+        {
+            current.value = valueWeight.value;
+            current.weight += valueWeight.weight;
+            accumulatedWeight += valueWeight.weight;
+            if (accumulatedWeight >= bucketWeight * (compressed.size() + 1) && compressed.size() + 1 < targetSize)
+            {
+                compressed.push_back(current);
+                current = { valueWeight.value, 0.0 };
+            }
+        }
+        if (current.weight > 0.0)
+        {
+            compressed.push_back(current);
+        }
+        sketch = std::move(compressed);
+    }
+
+    std::vector<predictors::SingleElementThresholdPredictor> QuantileThresholdFinder::ThresholdsFromSketches(std::vector<std::vector<ValueWeight>>& sketches) const
+    {
+        std::vector<predictors::SingleElementThresholdPredictor> thresholdPredictors;
+
+        for (size_t j = 0; j < sketches.size(); ++j)
+        {
+            CompressSketch(sketches[j], _numCandidatesPerFeature + 1);
+            for (size_t i = 0; i + 1 < sketches[j].size(); ++i)
+            {
+                thresholdPredictors.push_back({ j, 0.5 * (sketches[j][i].value + sketches[j][i + 1].value) });
+            }
+        }
+
+        return thresholdPredictors;
+    }
 }
 }
@@ -0,0 +1,132 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     CheckpointingTrainer.tcc (trainers)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// utilities
+#include "JsonArchiver.h"
+#include "ThreadPool.h"
+
+// stl
+#include <cassert>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <utility>
+
+namespace ell
+{
+namespace trainers
+{
+    template <typename PredictorType>
+    CheckpointingTrainer<PredictorType>::CheckpointingTrainer(std::unique_ptr<InternalTrainerType>&& internalTrainer, CheckpointingTrainerParameters parameters)
+        : _internalTrainer(std::move(internalTrainer)), _parameters(std::move(parameters))
+    {
+        assert(_internalTrainer != nullptr);
+        if (_parameters.filename.empty() || _parameters.updatesPerCheckpoint == 0)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "checkpointing requires a filename and a positive checkpoint interval");
+        }
+    }
+
+    template <typename PredictorType>
+    CheckpointingTrainer<PredictorType>::~CheckpointingTrainer()
+    {
+        try
+        {
+            FinishPendingWrite();
+        }
+        catch (...)
+        {
+            // a failed checkpoint write must not terminate the program from a destructor
+        }
+    }
+
+    template <typename PredictorType>
+    bool CheckpointingTrainer<PredictorType>::TryResume()
+    {
+        FinishPendingWrite();
+
+        std::ifstream stream(_parameters.filename);
+        if (!stream.is_open())
+        {
+            return false;
+        }
+
+        utilities::SerializationContext context;
+        utilities::JsonUnarchiver unarchiver(stream, context);
+        _internalTrainer->LoadState(unarchiver);
+        _updatesSinceCheckpoint = 0;
+        return true;
+    }
+
+    template <typename PredictorType>
+    void CheckpointingTrainer<PredictorType>::SetDataset(const data::AnyDataset& anyDataset)
+    {
+        _internalTrainer->SetDataset(anyDataset);
+    }
+
+    template <typename PredictorType>
+    void CheckpointingTrainer<PredictorType>::Update()
+    {
+        _internalTrainer->Update();
+
+        ++_updatesSinceCheckpoint;
+        if (_updatesSinceCheckpoint >= _parameters.updatesPerCheckpoint)
+        {
+            CheckpointNow();
+        }
+    }
+
+    template <typename PredictorType>
+    void CheckpointingTrainer<PredictorType>::CheckpointNow()
+    {
+        // serialize to memory synchronously - the snapshot must be captured before training mutates
+        // the state further - and hand only the file write to the background task
+        std::stringstream buffer;
+        {
+            utilities::JsonArchiver archiver(buffer);
+            _internalTrainer->SaveState(archiver);
+        }
+
+        // at most one write is in flight; the serialization above typically outlasts the previous
+        // write, so this wait is usually a no-op
+        FinishPendingWrite();
+
+        auto filename = _parameters.filename;
+        _pendingWrite = utilities::GetThreadPool().Submit([filename](std::string contents) {
+            // write to a temporary file and atomically swap it in, so a preemption mid-write never
+            // corrupts the previous checkpoint
+            auto tempFilename = filename + ".tmp";
+            {
+                std::ofstream stream(tempFilename);
+                stream << contents;
+            }
+            std::rename(tempFilename.c_str(), filename.c_str());
+        }, buffer.str());
+
+        _updatesSinceCheckpoint = 0;
+    }
+
+    template <typename PredictorType>
+    void CheckpointingTrainer<PredictorType>::FinishPendingWrite()
+    {
+        if (_pendingWrite.valid())
+        {
+            utilities::GetThreadPool().Wait(_pendingWrite);
+            _pendingWrite.get();
+        }
+    }
+
+    template <typename PredictorType>
+    std::unique_ptr<CheckpointingTrainer<PredictorType>> MakeCheckpointingTrainer(
+        std::unique_ptr<ITrainer<PredictorType>>&& internalTrainer,
+        CheckpointingTrainerParameters parameters)
+    {
+        return std::make_unique<CheckpointingTrainer<PredictorType>>(std::move(internalTrainer), std::move(parameters));
+    }
+}
+}
@@ -0,0 +1,59 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     DatasetStatistics.tcc (trainers)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// utilities
+#include "ThreadPool.h"
+
+// stl
+#include <algorithm>
+#include <future>
+
+namespace ell
+{
+namespace trainers
+{
+    template <typename ExampleType>
+    DatasetStatistics CalculateStatistics(const data::Dataset<ExampleType>& dataset, size_t sketchCapacity, size_t numThreads)
+    {
+        size_t numExamples = dataset.NumExamples();
+        if (numThreads == 0)
+        {
+            numThreads = utilities::GetThreadPool().NumThreads();
+        }
+        numThreads = std::max<size_t>(1, std::min(numThreads, numExamples));
+        if (numThreads <= 1)
+        {
+            return CalculateStatistics(dataset.GetAnyDataset(), sketchCapacity);
+        }
+
+        // scan contiguous shards concurrently, then merge the per-shard statistics
+        std::vector<DatasetStatistics> shardStatistics(numThreads);
+        auto& pool = utilities::GetThreadPool();
+        std::vector<std::future<void>> inFlight;
+        for (size_t shard = 0; shard < numThreads; ++shard)
+        {
+            size_t begin = shard * numExamples / numThreads;
+            size_t end = (shard + 1) * numExamples / numThreads;
+            inFlight.push_back(pool.Submit([&dataset, &shardStatistics, shard, begin, end, sketchCapacity]() {
+                shardStatistics[shard] = CalculateStatistics(dataset.GetAnyDataset(begin, end - begin), sketchCapacity);
+            }));
+        }
+        for (auto& future : inFlight)
+        {
+            pool.Wait(future);
+        }
+
+        auto statistics = std::move(shardStatistics[0]);
+        for (size_t shard = 1; shard < numThreads; ++shard)
+        {
+            MergeStatistics(statistics, shardStatistics[shard]);
+        }
+        return statistics;
+    }
+}
+}
@@ -7,6 +7,8 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 // stl
+#include <algorithm>
+#include <cmath>
 #include <utility>
 
 namespace ell
@@ -23,6 +25,17 @@ namespace trainers
         assert(_evaluator != nullptr);
     }
 
+    template <typename PredictorType>
+    EvaluatingTrainer<PredictorType>::EvaluatingTrainer(
+        std::unique_ptr<InternalTrainerType>&& internalTrainer,
+        std::shared_ptr<EvaluatorType> evaluator,
+        EvaluatingTrainerParameters parameters)
+        : _internalTrainer(std::move(internalTrainer)), _evaluator(evaluator), _parameters(parameters)
+    {
+        assert(_internalTrainer != nullptr);
+        assert(_evaluator != nullptr);
+    }
+
     template <typename PredictorType>
     void EvaluatingTrainer<PredictorType>::SetDataset(const data::AnyDataset& anyDataset)
     {
@@ -33,7 +46,46 @@ namespace trainers
     void EvaluatingTrainer<PredictorType>::Update()
     {
         _internalTrainer->Update();
+
+        if (!_parameters.adaptiveEvaluation)
+        {
+            _evaluator->Evaluate(_internalTrainer->GetPredictor());
+            return;
+        }
+
+        ++_updatesSinceEvaluation;
+        if (_updatesSinceEvaluation < _evaluationInterval)
+        {
+            return;
+        }
+
+        _updatesSinceEvaluation = 0;
+        _evaluator->Evaluate(_internalTrainer->GetPredictor());
+        double goodness = _evaluator->GetGoodness();
+
+        // back off exponentially while the evaluation is stable; a large delta means the predictor
+        // is still moving, so fall back to evaluating after every update
+        double delta = std::abs(goodness - _lastGoodness);
+        if (_hasEvaluated && delta <= _parameters.goodnessToleranceForBackoff)
+        {
+            _evaluationInterval = std::min(2 * _evaluationInterval, _parameters.maxEvaluationInterval);
+        }
+        else
+        {
+            _evaluationInterval = 1;
+        }
+        _lastGoodness = goodness;
+        _hasEvaluated = true;
+    }
+
+    template <typename PredictorType>
+    void EvaluatingTrainer<PredictorType>::EvaluateNow()
+    {
+        _updatesSinceEvaluation = 0;
+        _evaluationInterval = 1;
         _evaluator->Evaluate(_internalTrainer->GetPredictor());
+        _lastGoodness = _evaluator->GetGoodness();
+        _hasEvaluated = true;
     }
 
     template <typename PredictorType>
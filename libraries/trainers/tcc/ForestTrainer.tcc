@@ -72,6 +72,49 @@ namespace trainers
 
             // start performing splits until the maximum is reached or the queue is empty
             PerformSplits(_parameters.maxSplitsPerRound);
+            ++_rounds;
+        }
+    }
+
+    template <typename SplitRuleType, typename EdgePredictorType, typename BoosterType>
+    void ForestTrainer<SplitRuleType, EdgePredictorType, BoosterType>::SaveState(utilities::Archiver& archiver) const
+    {
+        archiver["rounds"] << _rounds;
+        archiver["forest"] << _forest;
+    }
+
+    template <typename SplitRuleType, typename EdgePredictorType, typename BoosterType>
+    void ForestTrainer<SplitRuleType, EdgePredictorType, BoosterType>::LoadState(utilities::Unarchiver& archiver)
+    {
+        archiver["rounds"] >> _rounds;
+        archiver["forest"] >> _forest;
+
+        // re-derive the per-example state from the restored forest, the same way SetDataset does;
+        // if the dataset is set after this call, SetDataset performs the same initialization
+        for (size_t rowIndex = 0; rowIndex < _dataset.NumExamples(); ++rowIndex)
+        {
+            auto& example = _dataset[rowIndex];
+            auto prediction = _forest.Predict(example.GetDataVector());
+            auto& metadata = example.GetMetadata();
+            metadata.currentOutput = prediction;
+            metadata.weak = _booster.GetWeakWeightLabel(metadata.strong, prediction);
+        }
+    }
+
+    template <typename SplitRuleType, typename EdgePredictorType, typename BoosterType>
+    void ForestTrainer<SplitRuleType, EdgePredictorType, BoosterType>::SetWarmStartPredictor(PredictorType forest)
+    {
+        _forest = std::move(forest);
+
+        // re-derive the per-example state from the given forest, the same way SetDataset does;
+        // if the dataset is set after this call, SetDataset performs the same initialization
+        for (size_t rowIndex = 0; rowIndex < _dataset.NumExamples(); ++rowIndex)
+        {
+            auto& example = _dataset[rowIndex];
+            auto prediction = _forest.Predict(example.GetDataVector());
+            auto& metadata = example.GetMetadata();
+            metadata.currentOutput = prediction;
+            metadata.weak = _booster.GetWeakWeightLabel(metadata.strong, prediction);
         }
     }
 
@@ -127,50 +170,104 @@ namespace trainers
         // count splits
         size_t splitCount = 0;
 
+        // number of splittable nodes processed per iteration - when parallel training is enabled,
+        // the nodes in a batch own disjoint ranges of examples, so their subtrees grow independently
+        size_t batchSize = _parameters.numThreads > 1 ? _parameters.numThreads : 1;
+
         // splitting loop (inner loop)
         while (!_queue.empty())
         {
             VERBOSE_MODE(std::cout << "\nSplit iteration\n");
             VERBOSE_MODE(_queue.PrintLine(std::cout, 1));
 
-            auto splitCandidate = _queue.top();
-            _queue.pop();
+            // pop a batch of the best split candidates
+            std::vector<SplitCandidate> batch;
+            size_t numToPop = std::min(batchSize, maxSplits - splitCount);
+            while (batch.size() < numToPop && !_queue.empty())
+            {
+                batch.push_back(_queue.top());
+                _queue.pop();
+            }
 
-            const auto& stats = splitCandidate.stats;
-            const auto& ranges = splitCandidate.ranges;
+            // perform the splits and update the forest sequentially
+            std::vector<size_t> interiorNodeIndices;
+            for (const auto& splitCandidate : batch)
+            {
+                const auto& stats = splitCandidate.stats;
+                const auto& ranges = splitCandidate.ranges;
 
-            // sort the data according to the performed split and update the metadata to reflect this change
-            SortNodeDataset(ranges.GetTotalRange(), splitCandidate.splitRule);
+                // sort the data according to the performed split and update the metadata to reflect this change
+                SortNodeDataset(ranges.GetTotalRange(), splitCandidate.splitRule);
 
-            // update current output field in metadata
-            auto edgePredictors = GetEdgePredictors(stats);
-            for (size_t i = 0; i < splitCandidate.splitRule.NumOutputs(); ++i)
-            {
-                UpdateCurrentOutputs(ranges.GetChildRange(i), edgePredictors[i]);
-            }
+                // update current output field in metadata
+                auto edgePredictors = GetEdgePredictors(stats);
+                for (size_t i = 0; i < splitCandidate.splitRule.NumOutputs(); ++i)
+                {
+                    UpdateCurrentOutputs(ranges.GetChildRange(i), edgePredictors[i]);
+                }
 
-            // have the forest perform the split
-            using SplitAction = predictors::SimpleForestPredictor::SplitAction;
-            SplitAction splitAction(splitCandidate.nodeId, splitCandidate.splitRule, edgePredictors);
-            auto interiorNodeIndex = _forest.Split(splitAction);
+                // have the forest perform the split
+                using SplitAction = predictors::SimpleForestPredictor::SplitAction;
+                SplitAction splitAction(splitCandidate.nodeId, splitCandidate.splitRule, edgePredictors);
+                interiorNodeIndices.push_back(_forest.Split(splitAction));
+                ++splitCount;
 
-            VERBOSE_MODE(_dataset.Print(std::cout, 1));
-            VERBOSE_MODE(std::cout << "\n");
-            VERBOSE_MODE(_forest.PrintLine(std::cout, 1));
+                VERBOSE_MODE(_dataset.Print(std::cout, 1));
+                VERBOSE_MODE(std::cout << "\n");
+                VERBOSE_MODE(_forest.PrintLine(std::cout, 1));
+            }
 
             // if max number of splits reached, exit the loop
-            if (++splitCount >= maxSplits)
+            if (splitCount >= maxSplits)
             {
                 break;
             }
 
-            // queue new split candidates
-            for (size_t i = 0; i < splitCandidate.splitRule.NumOutputs(); ++i)
+            // queue split candidates for the new children
+            if (_parameters.numThreads > 1)
+            {
+                // the children own disjoint ranges of examples, so their split candidates are
+                // evaluated concurrently; completed candidates enter the queue under the mutex
+                std::vector<std::future<void>> futures;
+                for (size_t batchIndex = 0; batchIndex < batch.size(); ++batchIndex)
+                {
+                    const auto& splitCandidate = batch[batchIndex];
+                    auto interiorNodeIndex = interiorNodeIndices[batchIndex];
+                    for (size_t i = 0; i < splitCandidate.splitRule.NumOutputs(); ++i)
+                    {
+                        auto childId = _forest.GetChildId(interiorNodeIndex, i);
+                        auto childRange = splitCandidate.ranges.GetChildRange(i);
+                        auto childSums = splitCandidate.stats.GetChildSums(i);
+                        futures.push_back(utilities::GetThreadPool().Submit([this, childId, childRange, childSums]() {
+                            auto childCandidate = GetBestSplitRuleAtNode(childId, childRange, childSums);
+                            if (childCandidate.gain > _parameters.minSplitGain)
+                            {
+                                std::lock_guard<std::mutex> lock(_queueMutex);
+                                _queue.push(std::move(childCandidate));
+                            }
+                        }));
+                    }
+                }
+                for (auto& future : futures)
+                {
+                    utilities::GetThreadPool().Wait(future);
+                    future.get();
+                }
+            }
+            else
             {
-                auto splitCandidate = GetBestSplitRuleAtNode(_forest.GetChildId(interiorNodeIndex, i), ranges.GetChildRange(i), stats.GetChildSums(i));
-                if (splitCandidate.gain > _parameters.minSplitGain)
+                for (size_t batchIndex = 0; batchIndex < batch.size(); ++batchIndex)
                 {
-                    _queue.push(std::move(splitCandidate));
+                    const auto& ranges = batch[batchIndex].ranges;
+                    const auto& stats = batch[batchIndex].stats;
+                    for (size_t i = 0; i < batch[batchIndex].splitRule.NumOutputs(); ++i)
+                    {
+                        auto splitCandidate = GetBestSplitRuleAtNode(_forest.GetChildId(interiorNodeIndices[batchIndex], i), ranges.GetChildRange(i), stats.GetChildSums(i));
+                        if (splitCandidate.gain > _parameters.minSplitGain)
+                        {
+                            _queue.push(std::move(splitCandidate));
+                        }
+                    }
                 }
             }
         }
@@ -7,6 +7,7 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 // utilities
+#include "Exception.h"
 #include "RandomEngines.h"
 
 namespace ell
@@ -26,23 +27,31 @@ namespace trainers
 
         auto splitRuleCandidates = CallThresholdFinder(range);
 
-        for (const auto& splitRuleCandidate : splitRuleCandidates)
+        // evaluate the candidate thresholds - candidates that test the same input element
+        // share a single histogram-building pass over the node's examples
+        auto evaluations = EvaluateSplitRules(splitRuleCandidates, range);
+
+        for (size_t j = 0; j < splitRuleCandidates.size(); ++j)
         {
+            const auto& splitRuleCandidate = splitRuleCandidates[j];
             Sums sums0;
             size_t size0;
 
-            std::tie(sums0, size0) = EvaluateSplitRule(splitRuleCandidate, range);
+            std::tie(sums0, size0) = evaluations[j];
 
             Sums sums1 = sums - sums0;
             double gain = CalculateGain(sums, sums0, sums1);
 
-            // find gain maximizer
+            // find gain maximizer - build a fresh candidate, since SplitChildRange can only be
+            // called once per child position
             if (gain > bestSplitCandidate.gain)
             {
-                bestSplitCandidate.gain = gain;
-                bestSplitCandidate.splitRule = splitRuleCandidate;
-                bestSplitCandidate.ranges.SplitChildRange(0, size0);
-                bestSplitCandidate.stats.SetChildSums({ sums0, sums1 });
+                SplitCandidate splitCandidate(nodeId, range, sums);
+                splitCandidate.gain = gain;
+                splitCandidate.splitRule = splitRuleCandidate;
+                splitCandidate.ranges.SplitChildRange(0, size0);
+                splitCandidate.stats.SetChildSums({ sums0, sums1 });
+                bestSplitCandidate = std::move(splitCandidate);
             }
         }
 
@@ -74,33 +83,97 @@ namespace trainers
     template <typename LossFunctionType, typename BoosterType, typename ThresholdFinderType>
     auto HistogramForestTrainer<LossFunctionType, BoosterType, ThresholdFinderType>::CallThresholdFinder(Range range) -> std::vector<SplitRuleType>
     {
+        // the random engine is shared between nodes, so serialize the sampling when nodes are
+        // completed concurrently (the permutation itself only touches this node's range)
+        std::lock_guard<std::mutex> lock(_randomMutex);
+
         // uniformly choose _candidatesPerInput from the range, without replacement
         _dataset.RandomPermute(_random, range.firstIndex, range.size, _thresholdFinderSampleSize);
 
-        auto thresholds = _thresholdFinder.GetThresholds(_dataset.GetExampleReferenceIterator(range.firstIndex, _thresholdFinderSampleSize));
+        // hand the finder a feature-major copy of the sample, so it scans each feature with unit stride
+        auto columnMajorSample = _dataset.ToColumnMajor(range.firstIndex, _thresholdFinderSampleSize);
+        auto thresholds = _thresholdFinder.GetThresholds(columnMajorSample);
         return thresholds;
     }
 
     template <typename LossFunctionType, typename BoosterType, typename ThresholdFinderType>
-    auto HistogramForestTrainer<LossFunctionType, BoosterType, ThresholdFinderType>::EvaluateSplitRule(const SplitRuleType& splitRule, const Range& range) const -> std::tuple<Sums, size_t>
+    auto HistogramForestTrainer<LossFunctionType, BoosterType, ThresholdFinderType>::EvaluateSplitRules(const std::vector<SplitRuleType>& splitRules, const Range& range) const -> std::vector<std::tuple<Sums, size_t>>
     {
-        Sums sums0;
-        size_t size0 = 0;
+        std::vector<std::tuple<Sums, size_t>> results(splitRules.size());
+
+        // group the candidate rules by the input element they test, sorting each group's
+        // thresholds so the group can share one histogram
+        std::map<size_t, std::vector<std::pair<double, size_t>>> candidatesByElement;
+        for (size_t j = 0; j < splitRules.size(); ++j)
+        {
+            candidatesByElement[splitRules[j].GetElementIndex()].emplace_back(splitRules[j].GetThreshold(), j);
+        }
+        for (auto& group : candidatesByElement)
+        {
+            std::sort(group.second.begin(), group.second.end());
+        }
+
+        // when parallel training is enabled, the groups are evaluated concurrently - each group
+        // only reads the node's range of examples and writes its own candidates' results
+        if (_parameters.numThreads > 1 && candidatesByElement.size() > 1)
+        {
+            std::vector<std::future<void>> futures;
+            futures.reserve(candidatesByElement.size());
+            for (const auto& group : candidatesByElement)
+            {
+                futures.push_back(utilities::GetThreadPool().Submit([this, &group, range, &results]() { EvaluateSplitRulesForElement(group.first, group.second, range, results); }));
+            }
+            for (auto& future : futures)
+            {
+                utilities::GetThreadPool().Wait(future);
+                future.get();
+            }
+        }
+        else
+        {
+            for (const auto& group : candidatesByElement)
+            {
+                EvaluateSplitRulesForElement(group.first, group.second, range, results);
+            }
+        }
+
+        return results;
+    }
+
+    template <typename LossFunctionType, typename BoosterType, typename ThresholdFinderType>
+    void HistogramForestTrainer<LossFunctionType, BoosterType, ThresholdFinderType>::EvaluateSplitRulesForElement(size_t elementIndex, const std::vector<std::pair<double, size_t>>& sortedThresholds, const Range& range, std::vector<std::tuple<Sums, size_t>>& results) const
+    {
+        // bin b collects the examples whose value falls between threshold b-1 (exclusive) and
+        // threshold b (inclusive); the extra last bin catches examples above every threshold
+        std::vector<Sums> binSums(sortedThresholds.size() + 1);
+        std::vector<size_t> binSizes(sortedThresholds.size() + 1, 0);
 
         auto exampleIterator = _dataset.GetExampleIterator(range.firstIndex, range.size);
         while (exampleIterator.IsValid())
         {
             const auto& example = exampleIterator.Get();
-            auto prediction = splitRule.Predict(example.GetDataVector());
-            if (prediction == 0)
+            const auto& dataVector = example.GetDataVector();
+            if (dataVector.PrefixLength() <= elementIndex)
             {
-                sums0.Increment(example.GetMetadata().weak);
-                ++size0;
+                throw utilities::InputException(utilities::InputExceptionErrors::indexOutOfRange);
             }
+            double value = dataVector[elementIndex];
+            size_t bin = std::lower_bound(sortedThresholds.begin(), sortedThresholds.end(), value, [](const std::pair<double, size_t>& threshold, double value) { return threshold.first < value; }) - sortedThresholds.begin();
+            binSums[bin].Increment(example.GetMetadata().weak);
+            ++binSizes[bin];
             exampleIterator.Next();
         }
 
-        return std::make_tuple(sums0, size0);
+        // a candidate sends an example to child 0 exactly when the value doesn't exceed its
+        // threshold, so each candidate's result is a prefix sum over the histogram
+        Sums sums0;
+        size_t size0 = 0;
+        for (size_t bin = 0; bin < sortedThresholds.size(); ++bin)
+        {
+            sums0 = sums0 + binSums[bin];
+            size0 += binSizes[bin];
+            results[sortedThresholds[bin].second] = std::make_tuple(sums0, size0);
+        }
     };
 
     template <typename LossFunctionType, typename BoosterType, typename ThresholdFinderType>
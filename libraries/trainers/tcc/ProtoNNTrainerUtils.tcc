@@ -54,17 +54,9 @@ namespace trainers
     template <typename math::MatrixLayout Layout>
     math::Matrix<double, Layout> ProtoNNTrainerUtils::MatrixExp(math::ConstMatrixReference<double, Layout> A)
     {
-        auto m = A.NumRows();
-        auto n = A.NumColumns();
-        math::Matrix<double, Layout> R(m, n);
-        for (size_t i = 0; i < m; i++)
-        {
-            for (size_t j = 0; j < n; j++)
-            {
-                R(i, j) = std::exp(A(i, j));
-            }
-        }
-
+        math::Matrix<double, Layout> R(A.NumRows(), A.NumColumns());
+        R.CopyFrom(A);
+        R.Transform([](double x) { return std::exp(x); });
         return R;
     }
 
@@ -121,10 +113,7 @@ namespace trainers
         if (thresh <= eps)
             thresh = eps;
 
-        for (size_t i = 0; i < M.NumColumns(); i++)
-        {
-            M.GetColumn(i).Transform([thresh](double x) { return  (std::abs(x) < thresh ? 0.0 : x); });
-        }
+        M.Transform([thresh](double x) { return (std::abs(x) < thresh ? 0.0 : x); });
     }
 }
 }
\ No newline at end of file
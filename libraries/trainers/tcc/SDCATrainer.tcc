@@ -9,12 +9,28 @@
 #include "DataVectorOperations.h"
 
 // utilities
+#include "Exception.h"
 #include "RandomEngines.h"
 
+// stl
+#include <sstream>
+
 namespace ell
 {
 namespace trainers
 {
+    namespace detail
+    {
+        // lock-free add on a shared double, in the absence of std::atomic<double>::fetch_add
+        inline void AtomicAdd(std::atomic<double>& target, double value)
+        {
+            double current = target.load(std::memory_order_relaxed);
+            while (!target.compare_exchange_weak(current, current + value))
+            {
+            }
+        }
+    }
+
     template<typename LossFunctionType, typename RegularizerType>
     SDCATrainer<LossFunctionType, RegularizerType>::SDCATrainer(const LossFunctionType& lossFunction, const RegularizerType& regularizer, const SDCATrainerParameters& parameters)
     : _lossFunction(lossFunction), _regularizer(regularizer), _parameters(parameters)
@@ -46,23 +62,284 @@ namespace trainers
     }
 
     template<typename LossFunctionType, typename RegularizerType>
-    void SDCATrainer<LossFunctionType, RegularizerType>::Update() 
+    void SDCATrainer<LossFunctionType, RegularizerType>::Update()
     {
+        if (_parameters.numThreads > 1 && _dataset.NumExamples() > 1)
+        {
+            ParallelUpdate();
+            return;
+        }
+
         if (_parameters.permute)
         {
-            _dataset.RandomPermute(_random);
+            // only the iteration order is shuffled; the examples (and their dual variables) stay put.
+            // The view is reset first, so each epoch's order is a pure function of the engine state
+            // and a warm-started trainer (see LoadState) replays the same order
+            _dataset.ResetView();
+            _dataset.RandomPermuteView(_random);
         }
 
         // Iterate
         for (size_t i = 0; i < _dataset.NumExamples(); ++i)
         {
-            Step(_dataset[i]);
+            Step(_dataset.GetViewExample(i));
         }
 
         // Finish
         ComputeObjectives();
     }
 
+    template<typename LossFunctionType, typename RegularizerType>
+    void SDCATrainer<LossFunctionType, RegularizerType>::ParallelUpdate()
+    {
+        if (_parameters.deterministic)
+        {
+            DeterministicParallelUpdate();
+            return;
+        }
+
+        if (_parameters.permute)
+        {
+            // shuffle blocks of examples so each shard still walks mostly-contiguous memory
+            _dataset.RandomPermuteView(_random, 64);
+        }
+
+        auto numExamples = _dataset.NumExamples();
+
+        // settle the size of the shared state before the workers start
+        for (size_t i = 0; i < numExamples; ++i)
+        {
+            ResizeTo(_dataset[i].GetDataVector());
+        }
+
+        // the shared iterate lives in atomics so shards can publish their updates lock-free
+        auto size = _v.Size();
+        std::vector<std::atomic<double>> sharedV(size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            sharedV[i].store(_v[i]);
+        }
+        std::atomic<double> sharedD(_d);
+
+        // shard the examples across threads - each dual variable belongs to exactly one shard,
+        // so only the primal iterate is contended
+        size_t numTasks = std::min<size_t>(_parameters.numThreads, numExamples);
+        std::vector<std::future<void>> futures;
+        futures.reserve(numTasks);
+        for (size_t taskIndex = 0; taskIndex < numTasks; ++taskIndex)
+        {
+            size_t firstIndex = taskIndex * numExamples / numTasks;
+            size_t lastIndex = (taskIndex + 1) * numExamples / numTasks;
+            futures.push_back(utilities::GetThreadPool().Submit([this, firstIndex, lastIndex, &sharedV, &sharedD]() {
+                UpdateShard(firstIndex, lastIndex, sharedV, sharedD);
+            }));
+        }
+        for (auto& future : futures)
+        {
+            utilities::GetThreadPool().Wait(future);
+            future.get();
+        }
+
+        // adopt the shared iterate and finish like the serial path
+        for (size_t i = 0; i < size; ++i)
+        {
+            _v[i] = sharedV[i].load();
+        }
+        _d = sharedD.load();
+        _regularizer.ConjugateGradient(_v, _d, _predictor.GetWeights(), _predictor.GetBias());
+
+        ComputeObjectives();
+    }
+
+    template<typename LossFunctionType, typename RegularizerType>
+    void SDCATrainer<LossFunctionType, RegularizerType>::DeterministicParallelUpdate()
+    {
+        if (_parameters.permute)
+        {
+            // the engine is seeded from the parameters, so the permutation replays identically
+            _dataset.RandomPermuteView(_random, 64);
+        }
+
+        auto numExamples = _dataset.NumExamples();
+        for (size_t i = 0; i < numExamples; ++i)
+        {
+            ResizeTo(_dataset[i].GetDataVector());
+        }
+
+        auto size = _v.Size();
+        size_t numTasks = std::min<size_t>(_parameters.numThreads, numExamples);
+
+        // each shard works from the epoch-start iterate and accumulates its updates privately -
+        // shards never observe each other mid-epoch, so a shard's delta depends only on its
+        // logical index, never on thread scheduling
+        std::vector<std::vector<double>> shardDeltaVs(numTasks, std::vector<double>(size, 0.0));
+        std::vector<double> shardDeltaDs(numTasks, 0.0);
+        std::vector<std::future<void>> futures;
+        futures.reserve(numTasks);
+        for (size_t taskIndex = 0; taskIndex < numTasks; ++taskIndex)
+        {
+            size_t firstIndex = taskIndex * numExamples / numTasks;
+            size_t lastIndex = (taskIndex + 1) * numExamples / numTasks;
+            futures.push_back(utilities::GetThreadPool().Submit([this, firstIndex, lastIndex, taskIndex, &shardDeltaVs, &shardDeltaDs]() {
+                UpdateShardDeterministic(firstIndex, lastIndex, shardDeltaVs[taskIndex], shardDeltaDs[taskIndex]);
+            }));
+        }
+        for (auto& future : futures)
+        {
+            utilities::GetThreadPool().Wait(future);
+            future.get();
+        }
+
+        // merge the shard deltas with a fixed pairwise tree keyed to shard indices, so the
+        // combined update is bit-identical from run to run
+        auto deltaV = utilities::ReducePairwise(std::move(shardDeltaVs), [](std::vector<double> a, const std::vector<double>& b) {
+            for (size_t i = 0; i < a.size(); ++i)
+            {
+                a[i] += b[i];
+            }
+            return a;
+        });
+        auto deltaD = utilities::ReducePairwise(std::move(shardDeltaDs), [](double a, double b) { return a + b; });
+
+        for (size_t i = 0; i < size; ++i)
+        {
+            _v[i] += deltaV[i];
+        }
+        _d += deltaD;
+        _regularizer.ConjugateGradient(_v, _d, _predictor.GetWeights(), _predictor.GetBias());
+
+        ComputeObjectives();
+    }
+
+    template<typename LossFunctionType, typename RegularizerType>
+    void SDCATrainer<LossFunctionType, RegularizerType>::UpdateShardDeterministic(size_t firstIndex, size_t lastIndex, std::vector<double>& deltaV, double& deltaD)
+    {
+        // same mini-batch step-size correction as the asynchronous path
+        double correction = static_cast<double>(_parameters.numThreads);
+
+        auto size = _v.Size();
+        predictors::LinearPredictor localPredictor(size);
+        math::ColumnVector<double> localV(size);
+        math::ColumnVector<double> stepV(size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            localV[i] = _v[i];
+        }
+        double localD = _d;
+        _regularizer.ConjugateGradient(localV, localD, localPredictor.GetWeights(), localPredictor.GetBias());
+
+        for (size_t index = firstIndex; index < lastIndex; ++index)
+        {
+            auto& example = _dataset.GetViewExample(index);
+            const auto& dataVector = example.GetDataVector();
+
+            auto weightLabel = example.GetMetadata().weightLabel;
+            auto norm2Squared = example.GetMetadata().norm2Squared + 1; // add one because of bias term
+            auto lipschitz = norm2Squared * _inverseScaledRegularization * correction;
+            auto dual = example.GetMetadata().dualVariable;
+
+            if (lipschitz > 0)
+            {
+                auto prediction = localPredictor.Predict(dataVector);
+
+                auto newDual = _lossFunction.ConjugateProx(1.0 / lipschitz, dual + prediction / lipschitz, weightLabel.label);
+                auto dualDiff = newDual - dual;
+
+                if (dualDiff != 0)
+                {
+                    double scale = -dualDiff * _inverseScaledRegularization;
+
+                    stepV.Reset();
+                    stepV.Transpose() += scale * dataVector;
+                    for (size_t i = 0; i < size; ++i)
+                    {
+                        if (stepV[i] != 0)
+                        {
+                            localV[i] += stepV[i];
+                            deltaV[i] += stepV[i];
+                        }
+                    }
+                    localD += scale;
+                    deltaD += scale;
+
+                    _regularizer.ConjugateGradient(localV, localD, localPredictor.GetWeights(), localPredictor.GetBias());
+                    example.GetMetadata().dualVariable = newDual;
+                }
+            }
+        }
+    }
+
+    template<typename LossFunctionType, typename RegularizerType>
+    void SDCATrainer<LossFunctionType, RegularizerType>::UpdateShard(size_t firstIndex, size_t lastIndex, std::vector<std::atomic<double>>& sharedV, std::atomic<double>& sharedD)
+    {
+        const size_t syncInterval = 64;
+
+        // mini-batch style step-size correction: with numThreads coordinate updates in flight
+        // concurrently, shrinking the prox step by that factor preserves convergence
+        double correction = static_cast<double>(_parameters.numThreads);
+
+        auto size = _v.Size();
+        predictors::LinearPredictor localPredictor(size); // filled in by the first sync below
+        math::ColumnVector<double> localV(size);
+        math::ColumnVector<double> stepV(size);
+        double localD = 0;
+
+        size_t stepsSinceSync = syncInterval; // force a sync before the first step
+        for (size_t index = firstIndex; index < lastIndex; ++index)
+        {
+            // batched sync: periodically pull the other shards' accumulated updates
+            if (stepsSinceSync >= syncInterval)
+            {
+                for (size_t i = 0; i < size; ++i)
+                {
+                    localV[i] = sharedV[i].load(std::memory_order_relaxed);
+                }
+                localD = sharedD.load(std::memory_order_relaxed);
+                _regularizer.ConjugateGradient(localV, localD, localPredictor.GetWeights(), localPredictor.GetBias());
+                stepsSinceSync = 0;
+            }
+            ++stepsSinceSync;
+
+            auto& example = _dataset.GetViewExample(index);
+            const auto& dataVector = example.GetDataVector();
+
+            auto weightLabel = example.GetMetadata().weightLabel;
+            auto norm2Squared = example.GetMetadata().norm2Squared + 1; // add one because of bias term
+            auto lipschitz = norm2Squared * _inverseScaledRegularization * correction;
+            auto dual = example.GetMetadata().dualVariable;
+
+            if (lipschitz > 0)
+            {
+                auto prediction = localPredictor.Predict(dataVector);
+
+                auto newDual = _lossFunction.ConjugateProx(1.0 / lipschitz, dual + prediction / lipschitz, weightLabel.label);
+                auto dualDiff = newDual - dual;
+
+                if (dualDiff != 0)
+                {
+                    double scale = -dualDiff * _inverseScaledRegularization;
+
+                    // densify this example's update so it can be applied locally and published atomically
+                    stepV.Reset();
+                    stepV.Transpose() += scale * dataVector;
+                    for (size_t i = 0; i < size; ++i)
+                    {
+                        if (stepV[i] != 0)
+                        {
+                            localV[i] += stepV[i];
+                            detail::AtomicAdd(sharedV[i], stepV[i]);
+                        }
+                    }
+                    localD += scale;
+                    detail::AtomicAdd(sharedD, scale);
+
+                    _regularizer.ConjugateGradient(localV, localD, localPredictor.GetWeights(), localPredictor.GetBias());
+                    example.GetMetadata().dualVariable = newDual;
+                }
+            }
+        }
+    }
+
     template<typename LossFunctionType, typename RegularizerType>
     SDCATrainer<LossFunctionType, RegularizerType>::TrainerMetadata::TrainerMetadata(const data::WeightLabel& original) : weightLabel(original)
     {}
@@ -95,6 +372,65 @@ namespace trainers
         }
     }
 
+    template<typename LossFunctionType, typename RegularizerType>
+    void SDCATrainer<LossFunctionType, RegularizerType>::SaveState(utilities::Archiver& archiver) const
+    {
+        archiver["v"] << _v.ToArray();
+        archiver["d"] << _d;
+        archiver["numEpochsPerformed"] << _predictorInfo.numEpochsPerformed;
+
+        // one dual variable per example, in the dataset's physical order; the physical order never
+        // changes (only the view order is permuted), so the saved duals line up with a dataset
+        // reloaded in the same order
+        std::vector<double> dualVariables;
+        dualVariables.reserve(_dataset.NumExamples());
+        for (size_t i = 0; i < _dataset.NumExamples(); ++i)
+        {
+            dualVariables.push_back(_dataset[i].GetMetadata().dualVariable);
+        }
+        archiver["dualVariables"] << dualVariables;
+
+        // the engine's state determines the permutation order of future epochs; stream it out so a
+        // resumed run visits the examples in the same order the original run would have
+        std::stringstream randomState;
+        randomState << _random;
+        archiver["random"] << randomState.str();
+    }
+
+    template<typename LossFunctionType, typename RegularizerType>
+    void SDCATrainer<LossFunctionType, RegularizerType>::LoadState(utilities::Unarchiver& archiver)
+    {
+        std::vector<double> v;
+        archiver["v"] >> v;
+        _v = math::ColumnVector<double>(std::move(v));
+        archiver["d"] >> _d;
+        archiver["numEpochsPerformed"] >> _predictorInfo.numEpochsPerformed;
+
+        std::vector<double> dualVariables;
+        archiver["dualVariables"] >> dualVariables;
+        if (dualVariables.size() != _dataset.NumExamples())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::badData, "saved dual variables don't match the dataset");
+        }
+        for (size_t i = 0; i < _dataset.NumExamples(); ++i)
+        {
+            _dataset[i].GetMetadata().dualVariable = dualVariables[i];
+        }
+
+        std::string randomState;
+        archiver["random"] >> randomState;
+        std::stringstream randomStateStream(randomState);
+        randomStateStream >> _random;
+
+        // re-derive the primal predictor and the objectives from the restored dual iterate
+        if (_predictor.Size() < _v.Size())
+        {
+            _predictor.Resize(_v.Size());
+        }
+        _regularizer.ConjugateGradient(_v, _d, _predictor.GetWeights(), _predictor.GetBias());
+        ComputeObjectives();
+    }
+
     template<typename LossFunctionType, typename RegularizerType>
     void SDCATrainer<LossFunctionType, RegularizerType>::ComputeObjectives()
     {
@@ -9,12 +9,16 @@
 // stl
 #include <cassert>
 #include <cmath>
+#include <sstream>
 
 // data
 #include "DataVector.h"
 #include "Dataset.h"
 #include "DataVectorOperations.h"
 
+// math
+#include "Operations.h"
+
 namespace ell
 {
 namespace trainers
@@ -41,48 +45,215 @@ namespace trainers
     void SGDTrainer<LossFunctionType>::DoNextStep(const data::AutoDataVector& x, double y, double weight)
     {
         ResizeTo(x);
-        ++_t;
 
-        // Predict
-        double p = _lastPredictor.Predict(x);
+        // apply the predictor; the weights are represented implicitly by the accumulators and the
+        // base predictor, so this costs O(nnz) of the example rather than O(dimension)
+        const double lambda = _parameters.regularization;
+        double p;
+        if (_t == 0)
+        {
+            p = _basePredictor.Predict(x);
+        }
+        else
+        {
+            double d = x * _v;
+            p = -(d + _a) / (lambda * _t);
+            if (_t0 > 0)
+            {
+                p += (_t0 / _t) * _basePredictor.Predict(x);
+            }
+        }
+
+        ++_t;
 
-        // calculate the loss derivative
+        // get the derivative
         double g = weight * _lossFunction.GetDerivative(p, y);
 
-        // get abbreviated names
-        auto& lastW = _lastPredictor.GetWeights();
-        double& lastB = _lastPredictor.GetBias();
+        // update the accumulators
+        _v.Transpose() += g * x;
+        _a += g;
+        _u.Transpose() += _h * g * x;
+        _c += _a / _t;
+        _h += 1.0 / _t;
+    }
+
+    template<typename LossFunctionType>
+    void SGDTrainer<LossFunctionType>::DoBatchStep(math::ConstMatrixReference<double, math::MatrixLayout::rowMajor> examples, math::ConstVectorReference<double, math::VectorOrientation::column> labels)
+    {
+        // a warm start mixes the base predictor into each prediction; keep the per-example path in
+        // that case rather than duplicating its bookkeeping here
+        if (_t0 > 0 || _basePredictor.Size() > 0)
+        {
+            SGDTrainerBase::DoBatchStep(examples, labels);
+            return;
+        }
+
+        auto batchSize = examples.NumRows();
+        auto numColumns = examples.NumColumns();
+        if (numColumns > _v.Size())
+        {
+            _v.Resize(numColumns);
+            _u.Resize(numColumns);
+        }
+
+        // apply the implicit predictor to the whole batch: p = -(X * v + a) / (lambda * t)
+        const double lambda = _parameters.regularization;
+        math::ColumnVector<double> predictions(batchSize);
+        if (_t > 0)
+        {
+            math::Operations::Multiply(-1.0 / (lambda * _t), examples, _v, 0.0, predictions);
+            math::Operations::MultiplyAdd(1.0, -_a / (lambda * _t), predictions);
+        }
+
+        // the whole batch counts as a single step along the mean gradient
+        ++_t;
+
+        // get the derivatives at all of the predictions at once
+        math::ColumnVector<double> derivatives(batchSize);
+        _lossFunction.GetDerivative(predictions, labels, derivatives);
+
+        // mean gradient of the batch, meanGradient = (1/batchSize) * X' * derivatives
+        math::RowVector<double> meanGradient(numColumns);
+        math::Operations::Multiply(1.0 / batchSize, derivatives.Transpose(), examples, 0.0, meanGradient);
+
+        double meanDerivative = 0;
+        for (size_t i = 0; i < batchSize; ++i)
+        {
+            meanDerivative += derivatives[i];
+        }
+        meanDerivative /= batchSize;
+
+        // update the accumulators, as in DoNextStep with the mean gradient in place of g * x
+        _v.Transpose() += meanGradient;
+        _a += meanDerivative;
+        _u.Transpose() += _h * meanGradient;
+        _c += _a / _t;
+        _h += 1.0 / _t;
+        _firstIteration = false;
+    }
+
+    template<typename LossFunctionType>
+    auto SGDTrainer<LossFunctionType>::GetLastPredictor() const -> const PredictorType&
+    {
+        _lastPredictor.Resize(_v.Size());
+        if (_t == 0)
+        {
+            // no steps taken yet - the last predictor is the base predictor
+            _lastPredictor.GetWeights().CopyFrom(_basePredictor.GetWeights());
+            _lastPredictor.GetBias() = _basePredictor.GetBias();
+            return _lastPredictor;
+        }
 
-        // update the (last) predictor
-        double scaleCoefficient = 1.0 - 1.0 / _t;
-        lastW *= scaleCoefficient;
-        lastB *= scaleCoefficient;
+        const double lambda = _parameters.regularization;
+        _lastPredictor.GetWeights().CopyFrom((-1 / (lambda * _t)) * _v);
+        _lastPredictor.GetBias() = -_a / (lambda * _t);
+        if (_t0 > 0)
+        {
+            double baseCoefficient = _t0 / _t;
+            _lastPredictor.GetWeights() += baseCoefficient * _basePredictor.GetWeights();
+            _lastPredictor.GetBias() += baseCoefficient * _basePredictor.GetBias();
+        }
+        return _lastPredictor;
+    }
+
+    template<typename LossFunctionType>
+    auto SGDTrainer<LossFunctionType>::GetAveragedPredictor() const -> const PredictorType&
+    {
+        _averagedPredictor.Resize(_v.Size());
+        if (_t == 0)
+        {
+            // no steps taken yet - the averaged predictor is the base predictor
+            _averagedPredictor.GetWeights().CopyFrom(_basePredictor.GetWeights());
+            _averagedPredictor.GetBias() = _basePredictor.GetBias();
+            return _averagedPredictor;
+        }
 
         const double lambda = _parameters.regularization;
-        double updateCoefficient = -g / (lambda * _t);
-        lastW.Transpose() += updateCoefficient * x;
-        lastB += updateCoefficient;
+        _averagedPredictor.GetWeights().CopyFrom(-_h / (lambda * _t) * _v);
+        _averagedPredictor.GetWeights() += 1 / (lambda * _t) * _u;
+        _averagedPredictor.GetBias() = -_c / (lambda * _t);
+        if (_t0 > 0)
+        {
+            // each step scales the base predictor's contribution by (t-1)/t, and the average picks
+            // up the surviving fraction once per step; summing the series gives this coefficient
+            double baseCoefficient = _t0 * (1.0 + _h) / _t;
+            _averagedPredictor.GetWeights() += baseCoefficient * _basePredictor.GetWeights();
+            _averagedPredictor.GetBias() += baseCoefficient * _basePredictor.GetBias();
+        }
+        return _averagedPredictor;
+    }
 
-        // get abbreviated names
-        auto& averagedW = _averagedPredictor.GetWeights();
-        double& averagedB = _averagedPredictor.GetBias();
+    template <typename LossFunctionType>
+    void SGDTrainer<LossFunctionType>::SetPredictor(const PredictorType& predictor)
+    {
+        _basePredictor = predictor;
+        _t0 = _t;
+
+        auto size = _basePredictor.Size();
+        _v.Resize(size);
+        _v.Reset();
+        _u.Resize(size);
+        _u.Reset();
+        _a = 0;
+        _c = 0;
+        _h = 0;
+    }
 
-        // update the average predictor
-        averagedW *= scaleCoefficient;
-        averagedB *= scaleCoefficient;
+    template <typename LossFunctionType>
+    void SGDTrainer<LossFunctionType>::SaveState(utilities::Archiver& archiver) const
+    {
+        archiver["epochs"] << _epochs;
+        archiver["firstIteration"] << _firstIteration;
+        archiver["t"] << _t;
+        archiver["a"] << _a;
+        archiver["h"] << _h;
+        archiver["c"] << _c;
+        archiver["t0"] << _t0;
+        archiver["v"] << _v.ToArray();
+        archiver["u"] << _u.ToArray();
+        archiver["basePredictor"] << _basePredictor;
+
+        // the engine's state determines the permutation order of future epochs; stream it out so a
+        // resumed run visits the examples in the same order the original run would have
+        std::stringstream randomState;
+        randomState << _random;
+        archiver["random"] << randomState.str();
+    }
 
-        averagedW += 1.0 / _t * lastW;
-        averagedB += lastB / _t;
+    template <typename LossFunctionType>
+    void SGDTrainer<LossFunctionType>::LoadState(utilities::Unarchiver& archiver)
+    {
+        archiver["epochs"] >> _epochs;
+        archiver["firstIteration"] >> _firstIteration;
+        archiver["t"] >> _t;
+        archiver["a"] >> _a;
+        archiver["h"] >> _h;
+        archiver["c"] >> _c;
+        archiver["t0"] >> _t0;
+
+        std::vector<double> v;
+        std::vector<double> u;
+        archiver["v"] >> v;
+        archiver["u"] >> u;
+        _v = math::ColumnVector<double>(std::move(v));
+        _u = math::ColumnVector<double>(std::move(u));
+        archiver["basePredictor"] >> _basePredictor;
+
+        std::string randomState;
+        archiver["random"] >> randomState;
+        std::stringstream randomStateStream(randomState);
+        randomStateStream >> _random;
     }
 
     template <typename LossFunctionType>
     void SGDTrainer<LossFunctionType>::ResizeTo(const data::AutoDataVector& x)
     {
         auto xSize = x.PrefixLength();
-        if (xSize > _lastPredictor.Size())
+        if (xSize > _v.Size())
         {
-            _lastPredictor.Resize(xSize);
-            _averagedPredictor.Resize(xSize);
+            _v.Resize(xSize);
+            _u.Resize(xSize);
+            _basePredictor.Resize(xSize);
         }
     }
 
@@ -23,47 +23,138 @@ namespace trainers
 
         SplitCandidate bestSplitCandidate(nodeId, range, sums);
 
-        for (size_t inputIndex = 0; inputIndex < numFeatures; ++inputIndex)
+        if (_parameters.numThreads > 1 && numFeatures > 1)
         {
-            // sort the relevant rows of data set in ascending order by inputIndex
-            SortNodeDataset(range, inputIndex);
+            // build a feature-major copy of the node's examples once, so that each task scans its
+            // features with unit stride instead of touching every example object
+            auto columnMajorDataset = _dataset.ToColumnMajor(range.firstIndex, range.size);
 
-            Sums sums0;
-
-            // consider all thresholds
-            double nextFeatureValue = _dataset[range.firstIndex].GetDataVector()[inputIndex];
-            for (size_t rowIndex = range.firstIndex; rowIndex < range.firstIndex + range.size - 1; ++rowIndex)
+            // evaluate the features concurrently - each task sorts a local copy of its features'
+            // values rather than sorting the shared dataset in place, so it only reads the node's examples
+            size_t numTasks = std::min<size_t>(_parameters.numThreads, numFeatures);
+            std::vector<std::future<SplitCandidate>> futures;
+            futures.reserve(numTasks);
+            for (size_t taskIndex = 0; taskIndex < numTasks; ++taskIndex)
             {
-                // get friendly names
-                double currentFeatureValue = nextFeatureValue;
-                nextFeatureValue = _dataset[rowIndex + 1].GetDataVector()[inputIndex];
-
-                // increment sums
-                sums0.Increment(_dataset[rowIndex].GetMetadata().weak);
-
-                // only split between rows with different feature values
-                if (currentFeatureValue == nextFeatureValue)
+                futures.push_back(utilities::GetThreadPool().Submit([this, taskIndex, numTasks, numFeatures, nodeId, range, sums, &columnMajorDataset]() {
+                    SplitCandidate taskBestSplitCandidate(nodeId, range, sums);
+                    for (size_t inputIndex = taskIndex; inputIndex < numFeatures; inputIndex += numTasks)
+                    {
+                        EvaluateFeature(inputIndex, nodeId, range, sums, columnMajorDataset, taskBestSplitCandidate);
+                    }
+                    return taskBestSplitCandidate;
+                }));
+            }
+            for (auto& future : futures)
+            {
+                utilities::GetThreadPool().Wait(future);
+                auto taskBestSplitCandidate = future.get();
+                if (taskBestSplitCandidate.gain > bestSplitCandidate.gain)
                 {
-                    continue;
+                    bestSplitCandidate = std::move(taskBestSplitCandidate);
                 }
+            }
+        }
+        else
+        {
+            for (size_t inputIndex = 0; inputIndex < numFeatures; ++inputIndex)
+            {
+                // sort the relevant rows of data set in ascending order by inputIndex
+                SortNodeDataset(range, inputIndex);
 
-                // compute sums1 and gain
-                auto sums1 = sums - sums0;
-                double gain = CalculateGain(sums, sums0, sums1);
+                Sums sums0;
 
-                // find gain maximizer
-                if (gain > bestSplitCandidate.gain)
+                // consider all thresholds
+                double nextFeatureValue = _dataset[range.firstIndex].GetDataVector()[inputIndex];
+                for (size_t rowIndex = range.firstIndex; rowIndex < range.firstIndex + range.size - 1; ++rowIndex)
                 {
-                    bestSplitCandidate.gain = gain;
-                    bestSplitCandidate.splitRule = SplitRuleType{ inputIndex, 0.5 * (currentFeatureValue + nextFeatureValue) };
-                    bestSplitCandidate.ranges.SplitChildRange(0, rowIndex - range.firstIndex + 1);
-                    bestSplitCandidate.stats.SetChildSums({ sums0, sums1 });
+                    // get friendly names
+                    double currentFeatureValue = nextFeatureValue;
+                    nextFeatureValue = _dataset[rowIndex + 1].GetDataVector()[inputIndex];
+
+                    // increment sums
+                    sums0.Increment(_dataset[rowIndex].GetMetadata().weak);
+
+                    // only split between rows with different feature values
+                    if (currentFeatureValue == nextFeatureValue)
+                    {
+                        continue;
+                    }
+
+                    // compute sums1 and gain
+                    auto sums1 = sums - sums0;
+                    double gain = CalculateGain(sums, sums0, sums1);
+
+                    // find gain maximizer - build a fresh candidate, since SplitChildRange can only
+                    // be called once per child position
+                    if (gain > bestSplitCandidate.gain)
+                    {
+                        SplitCandidate splitCandidate(nodeId, range, sums);
+                        splitCandidate.gain = gain;
+                        splitCandidate.splitRule = SplitRuleType{ inputIndex, 0.5 * (currentFeatureValue + nextFeatureValue) };
+                        splitCandidate.ranges.SplitChildRange(0, rowIndex - range.firstIndex + 1);
+                        splitCandidate.stats.SetChildSums({ sums0, sums1 });
+                        bestSplitCandidate = std::move(splitCandidate);
+                    }
                 }
             }
         }
         return bestSplitCandidate;
     }
 
+    template <typename LossFunctionType, typename BoosterType>
+    void SortingForestTrainer<LossFunctionType, BoosterType>::EvaluateFeature(size_t featureIndex, SplittableNodeId nodeId, Range range, const Sums& sums, const data::ColumnMajorDataset<TrainerMetadata>& columnMajorDataset, SplitCandidate& bestSplitCandidate) const
+    {
+        // copy this feature's values together with the weak weights and labels, and sort the copy
+        // by value - only the size of the lower child range matters downstream, and the count of
+        // examples below each threshold is the same as in the in-place sorting code path; the
+        // feature's values are contiguous in the feature-major copy, so the gather is a sequential read
+        const auto& column = columnMajorDataset.GetColumn(featureIndex);
+        std::vector<std::pair<double, data::WeightLabel>> values;
+        values.reserve(range.size);
+        for (size_t i = 0; i < range.size; ++i)
+        {
+            values.emplace_back(column[i], columnMajorDataset.GetMetadata(i).weak);
+        }
+        std::sort(values.begin(), values.end(), [](const std::pair<double, data::WeightLabel>& a, const std::pair<double, data::WeightLabel>& b) { return a.first < b.first; });
+
+        Sums sums0;
+
+        // consider all thresholds
+        double nextFeatureValue = values[0].first;
+        for (size_t valueIndex = 0; valueIndex < range.size - 1; ++valueIndex)
+        {
+            // get friendly names
+            double currentFeatureValue = nextFeatureValue;
+            nextFeatureValue = values[valueIndex + 1].first;
+
+            // increment sums
+            sums0.Increment(values[valueIndex].second);
+
+            // only split between rows with different feature values
+            if (currentFeatureValue == nextFeatureValue)
+            {
+                continue;
+            }
+
+            // compute sums1 and gain
+            auto sums1 = sums - sums0;
+            double gain = CalculateGain(sums, sums0, sums1);
+
+            // find gain maximizer - build a fresh candidate, since SplitChildRange can only be
+            // called once per child position
+            if (gain > bestSplitCandidate.gain)
+            {
+                SplitCandidate splitCandidate(nodeId, range, sums);
+                splitCandidate.gain = gain;
+                splitCandidate.splitRule = SplitRuleType{ featureIndex, 0.5 * (currentFeatureValue + nextFeatureValue) };
+                splitCandidate.ranges.SplitChildRange(0, valueIndex + 1);
+                splitCandidate.stats.SetChildSums({ sums0, sums1 });
+                bestSplitCandidate = std::move(splitCandidate);
+            }
+        }
+    }
+
     template <typename LossFunctionType, typename BoosterType>
     auto SortingForestTrainer<LossFunctionType, BoosterType>::GetEdgePredictors(const NodeStats& nodeStats) -> std::vector<EdgePredictorType>
     {
@@ -6,13 +6,23 @@
 //
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+// stl
+#include <algorithm>
+#include <future>
+
 namespace ell
 {
 namespace trainers
 {
     template <typename PredictorType>
     SweepingTrainer<PredictorType>::SweepingTrainer(std::vector<EvaluatingTrainerType>&& evaluatingTrainers)
-        : _evaluatingTrainers(std::move(evaluatingTrainers))
+        : SweepingTrainer(std::move(evaluatingTrainers), SweepingTrainerParameters{})
+    {
+    }
+
+    template <typename PredictorType>
+    SweepingTrainer<PredictorType>::SweepingTrainer(std::vector<EvaluatingTrainerType>&& evaluatingTrainers, SweepingTrainerParameters parameters)
+        : _evaluatingTrainers(std::move(evaluatingTrainers)), _parameters(parameters), _isActive(_evaluatingTrainers.size(), true)
     {
         assert(_evaluatingTrainers.size() > 0);
     }
@@ -21,14 +31,71 @@ namespace trainers
     void SweepingTrainer<PredictorType>::SetDataset(const data::AnyDataset& anyDataset)
     {
         _dataset = data::Dataset<ExampleType>(anyDataset);
+        for (size_t i = 0; i < _evaluatingTrainers.size(); ++i)
+        {
+            _evaluatingTrainers[i].SetDataset(anyDataset);
+        }
     }
 
     template <typename PredictorType>
     void SweepingTrainer<PredictorType>::Update()
     {
-        for (int i = 0; i < _evaluatingTrainers.size(); ++i)
+        // run an epoch of each active candidate; the candidates are independent and share the
+        // example data read-only, so they can run concurrently
+        if (_parameters.parallel && utilities::GetThreadPool().NumThreads() > 1)
+        {
+            std::vector<std::future<void>> futures;
+            for (size_t i = 0; i < _evaluatingTrainers.size(); ++i)
+            {
+                if (_isActive[i])
+                {
+                    auto& evaluatingTrainer = _evaluatingTrainers[i];
+                    futures.push_back(utilities::GetThreadPool().Submit([&evaluatingTrainer]() { evaluatingTrainer.Update(); }));
+                }
+            }
+            for (auto& future : futures)
+            {
+                future.get();
+            }
+        }
+        else
+        {
+            for (size_t i = 0; i < _evaluatingTrainers.size(); ++i)
+            {
+                if (_isActive[i])
+                {
+                    _evaluatingTrainers[i].Update();
+                }
+            }
+        }
+
+        if (!_parameters.successiveHalving)
+        {
+            return;
+        }
+
+        // score the active candidates and retire the dominated half
+        size_t numActive = NumActiveTrainers();
+        if (numActive <= std::max(_parameters.minActiveTrainers, size_t{ 1 }))
         {
-            _evaluatingTrainers[i].Update();
+            return;
+        }
+
+        std::vector<std::pair<double, size_t>> goodness;
+        for (size_t i = 0; i < _evaluatingTrainers.size(); ++i)
+        {
+            if (_isActive[i])
+            {
+                _evaluatingTrainers[i].EvaluateNow();
+                goodness.emplace_back(_evaluatingTrainers[i].GetEvaluator()->GetGoodness(), i);
+            }
+        }
+
+        size_t numToKeep = std::max((numActive + 1) / 2, std::max(_parameters.minActiveTrainers, size_t{ 1 }));
+        std::sort(goodness.begin(), goodness.end(), [](const std::pair<double, size_t>& a, const std::pair<double, size_t>& b) { return a.first > b.first; });
+        for (size_t rank = numToKeep; rank < goodness.size(); ++rank)
+        {
+            _isActive[goodness[rank].second] = false;
         }
     }
 
@@ -50,10 +117,30 @@ namespace trainers
         return _evaluatingTrainers[bestIndex].GetPredictor();
     }
 
+    template <typename PredictorType>
+    size_t SweepingTrainer<PredictorType>::NumActiveTrainers() const
+    {
+        size_t count = 0;
+        for (size_t i = 0; i < _isActive.size(); ++i)
+        {
+            if (_isActive[i])
+            {
+                ++count;
+            }
+        }
+        return count;
+    }
+
     template <typename PredictorType>
     std::unique_ptr<ITrainer<PredictorType>> MakeSweepingTrainer(std::vector<EvaluatingTrainer<PredictorType>>&& evaluatingTrainers)
     {
         return std::make_unique<SweepingTrainer<PredictorType>>(std::move(evaluatingTrainers));
     }
+
+    template <typename PredictorType>
+    std::unique_ptr<ITrainer<PredictorType>> MakeSweepingTrainer(std::vector<EvaluatingTrainer<PredictorType>>&& evaluatingTrainers, SweepingTrainerParameters parameters)
+    {
+        return std::make_unique<SweepingTrainer<PredictorType>>(std::move(evaluatingTrainers), parameters);
+    }
 }
 }
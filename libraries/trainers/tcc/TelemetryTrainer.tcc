@@ -0,0 +1,141 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     TelemetryTrainer.tcc (trainers)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// stl
+#include <cassert>
+#include <chrono>
+#include <utility>
+
+#if !defined(_WIN32)
+#include <sys/resource.h>
+#endif
+
+namespace ell
+{
+namespace trainers
+{
+    /// <summary> Returns the process memory high-water mark in kilobytes, or 0 when unavailable. </summary>
+    inline size_t GetPeakMemoryKilobytes()
+    {
+#if defined(_WIN32)
+        return 0; // not implemented on Windows
+#else
+        rusage usage;
+        if (getrusage(RUSAGE_SELF, &usage) != 0)
+        {
+            return 0;
+        }
+#if defined(__APPLE__)
+        return static_cast<size_t>(usage.ru_maxrss) / 1024; // reported in bytes on macOS
+#else
+        return static_cast<size_t>(usage.ru_maxrss);
+#endif
+#endif
+    }
+
+    template <typename PredictorType>
+    TelemetryTrainer<PredictorType>::TelemetryTrainer(std::unique_ptr<InternalTrainerType>&& internalTrainer, TelemetryTrainerParameters parameters, std::ostream& output, std::shared_ptr<EvaluatorType> evaluator)
+        : _internalTrainer(std::move(internalTrainer)), _parameters(std::move(parameters)), _output(output), _evaluator(std::move(evaluator))
+    {
+        assert(_internalTrainer != nullptr);
+    }
+
+    template <typename PredictorType>
+    void TelemetryTrainer<PredictorType>::SetDataset(const data::AnyDataset& anyDataset)
+    {
+        _numExamples = anyDataset.NumExamples();
+        _internalTrainer->SetDataset(anyDataset);
+    }
+
+    template <typename PredictorType>
+    void TelemetryTrainer<PredictorType>::Update()
+    {
+        if (_parameters.updatesPerReport == 0)
+        {
+            // silent mode: forward without touching the clock
+            _internalTrainer->Update();
+            return;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        _internalTrainer->Update();
+        auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        ++_updateCount;
+        ++_updatesSinceReport;
+        _secondsSinceReport += seconds;
+        _totalSeconds += seconds;
+
+        if (_updatesSinceReport >= _parameters.updatesPerReport)
+        {
+            Report();
+        }
+    }
+
+    template <typename PredictorType>
+    void TelemetryTrainer<PredictorType>::ReportNow()
+    {
+        Report();
+    }
+
+    template <typename PredictorType>
+    void TelemetryTrainer<PredictorType>::Report()
+    {
+        bool hasGoodness = false;
+        double goodness = 0;
+        if (_evaluator != nullptr)
+        {
+            _evaluator->Evaluate(_internalTrainer->GetPredictor());
+            goodness = _evaluator->GetGoodness();
+            hasGoodness = true;
+        }
+
+        double examplesPerSecond = _secondsSinceReport > 0 ? _numExamples * _updatesSinceReport / _secondsSinceReport : 0;
+        auto peakMemoryKilobytes = GetPeakMemoryKilobytes();
+
+        if (_parameters.jsonFormat)
+        {
+            _output << "{\"update\":" << _updateCount;
+            if (_parameters.totalUpdates > 0)
+            {
+                _output << ",\"totalUpdates\":" << _parameters.totalUpdates;
+            }
+            _output << ",\"examplesPerSecond\":" << examplesPerSecond;
+            if (hasGoodness)
+            {
+                _output << ",\"goodness\":" << goodness;
+            }
+            _output << ",\"peakMemoryKB\":" << peakMemoryKilobytes << ",\"totalSeconds\":" << _totalSeconds << "}\n";
+        }
+        else
+        {
+            _output << "update " << _updateCount;
+            if (_parameters.totalUpdates > 0)
+            {
+                _output << "/" << _parameters.totalUpdates;
+            }
+            _output << ": " << examplesPerSecond << " examples/sec";
+            if (hasGoodness)
+            {
+                _output << ", goodness " << goodness;
+            }
+            _output << ", peak memory " << peakMemoryKilobytes << " KB, elapsed " << _totalSeconds << " s\n";
+        }
+        _output.flush(); // each report is one complete line, visible to readers immediately
+
+        _updatesSinceReport = 0;
+        _secondsSinceReport = 0;
+    }
+
+    template <typename PredictorType>
+    std::unique_ptr<TelemetryTrainer<PredictorType>> MakeTelemetryTrainer(std::unique_ptr<ITrainer<PredictorType>>&& internalTrainer, TelemetryTrainerParameters parameters, std::ostream& output, std::shared_ptr<evaluators::IEvaluator<PredictorType>> evaluator)
+    {
+        return std::make_unique<TelemetryTrainer<PredictorType>>(std::move(internalTrainer), std::move(parameters), output, std::move(evaluator));
+    }
+}
+}
@@ -10,6 +10,7 @@
 
 // stl
 #include <algorithm>
+#include <utility>
 
 namespace ell
 {
@@ -53,22 +54,103 @@ namespace trainers
         return { result, totalWeight };
     }
 
+    template <typename MetadataType>
+    ThresholdFinder::UniqueValuesResult ThresholdFinder::UniqueValues(const data::ColumnMajorDataset<MetadataType>& dataset) const
+    {
+        std::vector<std::vector<ValueWeight>> result(dataset.NumFeatures());
+        double totalWeight = 0.0;
+
+        std::vector<double> weights(dataset.NumExamples());
+        for (size_t i = 0; i < dataset.NumExamples(); ++i)
+        {
+            weights[i] = dataset.GetMetadata(i).weak.weight;
+            totalWeight += weights[i];
+        }
+
+        // each feature's values are already contiguous, so gathering them is a sequential read
+        for (size_t j = 0; j < dataset.NumFeatures(); ++j)
+        {
+            const auto& column = dataset.GetColumn(j);
+            result[j].reserve(column.size());
+            for (size_t i = 0; i < column.size(); ++i)
+            {
+                result[j].push_back({ column[i], weights[i] });
+            }
+
+            auto newSize = SortReduceCopy(result[j].begin(), result[j].end());
+            result[j].resize(newSize);
+        }
+
+        return { result, totalWeight };
+    }
+
     template <typename ExampleIteratorType>
     std::vector<predictors::SingleElementThresholdPredictor> trainers::ExhaustiveThresholdFinder::GetThresholds(ExampleIteratorType exampleIterator) const
     {
-        auto uniqueValuesResult = UniqueValues(exampleIterator);
-        std::vector<predictors::SingleElementThresholdPredictor> thresholdPredictors;
+        // example iterators are move-only
+        return GetThresholds(UniqueValues(std::move(exampleIterator)));
+    }
+
+    template <typename MetadataType>
+    std::vector<predictors::SingleElementThresholdPredictor> trainers::ExhaustiveThresholdFinder::GetThresholds(const data::ColumnMajorDataset<MetadataType>& dataset) const
+    {
+        return GetThresholds(UniqueValues(dataset));
+    }
+
+    template <typename ExampleIteratorType>
+    std::vector<predictors::SingleElementThresholdPredictor> QuantileThresholdFinder::GetThresholds(ExampleIteratorType exampleIterator) const
+    {
+        std::vector<std::vector<ValueWeight>> sketches;
+        const size_t bufferSize = 4 * (_numCandidatesPerFeature + 1);
+
+        // one pass over the examples; each feature's sketch is compressed whenever its buffer fills,
+        // so memory stays bounded regardless of the number of examples
+        while (exampleIterator.IsValid())
+        {
+            const auto& example = exampleIterator.Get();
+            const auto& denseDataVector = example.GetDataVector();
+            double weight = example.GetMetadata().weak.weight;
+
+            if (sketches.size() < denseDataVector.PrefixLength())
+            {
+                sketches.resize(denseDataVector.PrefixLength());
+            }
+
+            for (size_t j = 0; j < denseDataVector.PrefixLength(); ++j)
+            {
+                sketches[j].push_back({ denseDataVector[j], weight });
+                if (sketches[j].size() >= bufferSize)
+                {
+                    CompressSketch(sketches[j], 2 * (_numCandidatesPerFeature + 1));
+                }
+            }
+
+            exampleIterator.Next();
+        }
+
+        return ThresholdsFromSketches(sketches);
+    }
+
+    template <typename MetadataType>
+    std::vector<predictors::SingleElementThresholdPredictor> QuantileThresholdFinder::GetThresholds(const data::ColumnMajorDataset<MetadataType>& dataset) const
+    {
+        std::vector<std::vector<ValueWeight>> sketches(dataset.NumFeatures());
+        const size_t bufferSize = 4 * (_numCandidatesPerFeature + 1);
 
-        for (size_t j = 0; j < uniqueValuesResult.weightedValues.size(); ++j)
+        for (size_t j = 0; j < dataset.NumFeatures(); ++j)
         {
-            const auto& featureValues = uniqueValuesResult.weightedValues[j];
-            for (size_t i = 0; i < featureValues.size() - 1; ++i)
+            const auto& column = dataset.GetColumn(j);
+            for (size_t i = 0; i < column.size(); ++i)
             {
-                thresholdPredictors.push_back({ j, 0.5 * (featureValues[i].value + featureValues[i + 1].value) });
+                sketches[j].push_back({ column[i], dataset.GetMetadata(i).weak.weight });
+                if (sketches[j].size() >= bufferSize)
+                {
+                    CompressSketch(sketches[j], 2 * (_numCandidatesPerFeature + 1));
+                }
             }
         }
 
-        return thresholdPredictors;
+        return ThresholdsFromSketches(sketches);
     }
 }
 }
@@ -7,18 +7,37 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 // common
+#include "MakeEvaluator.h"
 #include "MakeTrainer.h"
 
 // data
 #include "Dataset.h"
 
 // trainers
+#include "CheckpointingTrainer.h"
+#include "DatasetStatistics.h"
+#include "TelemetryTrainer.h"
+#include "EvaluatingTrainer.h"
+#include "KMeansTrainer.h"
+#include "LinearPredictorPruner.h"
 #include "SDCATrainer.h"
 #include "MeanCalculator.h"
+#include "SweepingTrainer.h"
+#include "ThresholdFinder.h"
+
+// predictors
+#include "LinearPredictor.h"
 
 // utilities
+#include "JsonArchiver.h"
 #include "testing.h"
 
+// stl
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <sstream>
+
 using namespace ell;
 
 /// Runs all tests
@@ -60,8 +79,366 @@ void TestMeanCalculator()
     testing::ProcessTest("TestMeanCalculator", mean == r);
 }
 
+void TestKMeansTrainer()
+{
+    // two well-separated blobs of points in 2 dimensions
+    math::ColumnMatrix<double> X(2, 8);
+    std::vector<std::vector<double>> points = { { 0.0, 0.1 }, { 0.1, 0.0 }, { -0.1, 0.1 }, { 0.1, -0.1 }, { 10.0, 10.1 }, { 10.1, 10.0 }, { 9.9, 10.1 }, { 10.1, 9.9 } };
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+        X(0, i) = points[i][0];
+        X(1, i) = points[i][1];
+    }
+
+    auto checkMeans = [](const math::ColumnMatrix<double>& means) {
+        bool foundLow = false;
+        bool foundHigh = false;
+        for (size_t c = 0; c < means.NumColumns(); ++c)
+        {
+            if (std::abs(means(0, c)) < 1.0 && std::abs(means(1, c)) < 1.0) foundLow = true;
+            if (std::abs(means(0, c) - 10.0) < 1.0 && std::abs(means(1, c) - 10.0) < 1.0) foundHigh = true;
+        }
+        return foundLow && foundHigh;
+    };
+
+    trainers::KMeansTrainer lloyd(2, 2, 20);
+    lloyd.RunKMeans(X);
+    testing::ProcessTest("TestKMeansTrainer (Lloyd)", checkMeans(lloyd.GetClusterMeans()));
+
+    trainers::KMeansTrainer parallel(2, 2, 20, { 0, 2 });
+    parallel.RunKMeans(X);
+    testing::ProcessTest("TestKMeansTrainer (parallel)", checkMeans(parallel.GetClusterMeans()));
+
+    trainers::KMeansTrainer minibatch(2, 2, 100, { 4, 2 });
+    minibatch.RunKMeans(X);
+    testing::ProcessTest("TestKMeansTrainer (minibatch)", checkMeans(minibatch.GetClusterMeans()));
+}
+
+void TestSGDTrainer()
+{
+    data::AutoSupervisedDataset dataset;
+    dataset.AddExample({ { 1.0, 0.0, 2.0, 0.0, 3.0 },{ 1.0, 1.0 } });
+    dataset.AddExample({ { 0.0, 4.0, 5.0, 6.0, 7.0 },{ 1.0, -1.0 } });
+    dataset.AddExample({ { 8.0, 0.0, 9.0 },{ 1.0, 1.0 } });
+    dataset.AddExample({ { 0.0, 10.0 },{ 1.0, -1.0 } });
+
+    // with the same seed (hence the same permutations), the lazily-updated SGD trainer and the
+    // sparse data SGD trainer compute the same closed form, so their predictors must agree
+    common::LossFunctionArguments loss{ common::LossFunctionArguments::LossFunction::log };
+    trainers::SGDTrainerParameters parameters{ 0.01, "XYZ" };
+    auto trainer = common::MakeSGDTrainer(loss, parameters);
+    auto sparseTrainer = common::MakeSparseDataSGDTrainer(loss, parameters);
+    trainer->SetDataset(dataset.GetAnyDataset());
+    sparseTrainer->SetDataset(dataset.GetAnyDataset());
+
+    for (int epoch = 0; epoch < 3; ++epoch)
+    {
+        trainer->Update();
+        sparseTrainer->Update();
+    }
+
+    const auto& weights = trainer->GetPredictor().GetWeights();
+    const auto& sparseWeights = sparseTrainer->GetPredictor().GetWeights();
+    bool ok = testing::IsEqual(trainer->GetPredictor().GetBias(), sparseTrainer->GetPredictor().GetBias(), 1.0e-8);
+    for (size_t i = 0; i < weights.Size(); ++i)
+    {
+        ok = ok && testing::IsEqual(weights[i], sparseWeights[i], 1.0e-8);
+    }
+    testing::ProcessTest("TestSGDTrainer", ok);
+}
+
+void TestTrainerCheckpointing()
+{
+    data::AutoSupervisedDataset dataset;
+    dataset.AddExample({ { 1.0, 0.0, 2.0, 0.0, 3.0 },{ 1.0, 1.0 } });
+    dataset.AddExample({ { 0.0, 4.0, 5.0, 6.0, 7.0 },{ 1.0, -1.0 } });
+    dataset.AddExample({ { 8.0, 0.0, 9.0 },{ 1.0, 1.0 } });
+    dataset.AddExample({ { 0.0, 10.0 },{ 1.0, -1.0 } });
+
+    common::LossFunctionArguments loss{ common::LossFunctionArguments::LossFunction::log };
+    trainers::SGDTrainerParameters parameters{ 0.01, "XYZ" };
+
+    auto comparePredictors = [](const predictors::LinearPredictor& a, const predictors::LinearPredictor& b) {
+        bool same = testing::IsEqual(a.GetBias(), b.GetBias(), 1.0e-8);
+        for (size_t i = 0; i < a.GetWeights().Size(); ++i)
+        {
+            same = same && testing::IsEqual(a.GetWeights()[i], b.GetWeights()[i], 1.0e-8);
+        }
+        return same;
+    };
+
+    // round-trip the SGD trainer's state through an archiver mid-run; the resumed trainer restores
+    // the random engine too, so the remaining epochs replay exactly
+    auto trainer = common::MakeSGDTrainer(loss, parameters);
+    auto resumedTrainer = common::MakeSGDTrainer(loss, parameters);
+    trainer->SetDataset(dataset.GetAnyDataset());
+    resumedTrainer->SetDataset(dataset.GetAnyDataset());
+
+    trainer->Update();
+    trainer->Update();
+
+    std::stringstream checkpoint;
+    {
+        utilities::JsonArchiver archiver(checkpoint);
+        trainer->SaveState(archiver);
+    }
+    {
+        utilities::SerializationContext context;
+        utilities::JsonUnarchiver unarchiver(checkpoint, context);
+        resumedTrainer->LoadState(unarchiver);
+    }
+
+    trainer->Update();
+    resumedTrainer->Update();
+    testing::ProcessTest("TestTrainerCheckpointing (state round trip)", comparePredictors(trainer->GetPredictor(), resumedTrainer->GetPredictor()));
+
+    // drive the checkpointing decorator through a file and resume a fresh trainer from it
+    const char* checkpointFilename = "checkpointTest.json";
+    std::remove(checkpointFilename);
+
+    auto referenceTrainer = common::MakeSGDTrainer(loss, parameters);
+    referenceTrainer->SetDataset(dataset.GetAnyDataset());
+    {
+        trainers::CheckpointingTrainer<predictors::LinearPredictor> checkpointingTrainer(common::MakeSGDTrainer(loss, parameters), { checkpointFilename, 2 });
+        checkpointingTrainer.SetDataset(dataset.GetAnyDataset());
+        testing::ProcessTest("TestTrainerCheckpointing (fresh start)", !checkpointingTrainer.TryResume());
+        for (int epoch = 0; epoch < 4; ++epoch)
+        {
+            checkpointingTrainer.Update();
+            referenceTrainer->Update();
+        }
+    } // waits for the last checkpoint write
+
+    trainers::CheckpointingTrainer<predictors::LinearPredictor> restoredTrainer(common::MakeSGDTrainer(loss, parameters), { checkpointFilename, 2 });
+    restoredTrainer.SetDataset(dataset.GetAnyDataset());
+    testing::ProcessTest("TestTrainerCheckpointing (resume)", restoredTrainer.TryResume());
+    testing::ProcessTest("TestTrainerCheckpointing (restored state)", comparePredictors(restoredTrainer.GetPredictor(), referenceTrainer->GetPredictor()));
+
+    std::remove(checkpointFilename);
+}
+
+void TestSDCAWarmStart()
+{
+    data::AutoSupervisedDataset dataset;
+    dataset.AddExample({ { 1.0, 0.0, 2.0, 0.0, 3.0 },{ 1.0, 1.0 } });
+    dataset.AddExample({ { 0.0, 4.0, 5.0, 6.0, 7.0 },{ 1.0, -1.0 } });
+    dataset.AddExample({ { 8.0, 0.0, 9.0 },{ 1.0, 1.0 } });
+    dataset.AddExample({ { 0.0, 10.0 },{ 1.0, -1.0 } });
+
+    common::LossFunctionArguments loss{ common::LossFunctionArguments::LossFunction::log };
+    trainers::SDCATrainerParameters parameters{ 1.0e-4, 1.0e-8, 20, true, "XYZ" };
+
+    auto comparePredictors = [](const predictors::LinearPredictor& a, const predictors::LinearPredictor& b) {
+        bool same = testing::IsEqual(a.GetBias(), b.GetBias(), 1.0e-8);
+        for (size_t i = 0; i < a.GetWeights().Size(); ++i)
+        {
+            same = same && testing::IsEqual(a.GetWeights()[i], b.GetWeights()[i], 1.0e-8);
+        }
+        return same;
+    };
+
+    // round-trip the SDCA trainer's duals through an archiver mid-run; the warm-started trainer
+    // continues from the restored iterate, so the remaining epochs replay exactly
+    auto trainer = common::MakeSDCATrainer(loss, parameters);
+    trainer->SetDataset(dataset.GetAnyDataset());
+    trainer->Update();
+    trainer->Update();
+
+    std::stringstream checkpoint;
+    {
+        utilities::JsonArchiver archiver(checkpoint);
+        trainer->SaveState(archiver);
+    }
+
+    auto warmTrainer = common::MakeSDCATrainer(loss, parameters);
+    warmTrainer->SetDataset(dataset.GetAnyDataset());
+    {
+        utilities::SerializationContext context;
+        utilities::JsonUnarchiver unarchiver(checkpoint, context);
+        warmTrainer->LoadState(unarchiver);
+    }
+    testing::ProcessTest("TestSDCAWarmStart (restored predictor)", comparePredictors(trainer->GetPredictor(), warmTrainer->GetPredictor()));
+
+    trainer->Update();
+    warmTrainer->Update();
+    testing::ProcessTest("TestSDCAWarmStart (replayed epoch)", comparePredictors(trainer->GetPredictor(), warmTrainer->GetPredictor()));
+}
+
+void TestSweepingTrainer()
+{
+    data::AutoSupervisedDataset dataset;
+    dataset.AddExample({ { 1.0, 0.0, 2.0, 0.0, 3.0 },{ 1.0, 1.0 } });
+    dataset.AddExample({ { 0.0, 4.0, 5.0, 6.0, 7.0 },{ 1.0, -1.0 } });
+    dataset.AddExample({ { 8.0, 0.0, 9.0 },{ 1.0, 1.0 } });
+    dataset.AddExample({ { 0.0, 10.0 },{ 1.0, -1.0 } });
+
+    common::LossFunctionArguments loss{ common::LossFunctionArguments::LossFunction::log };
+    evaluators::EvaluatorParameters evaluatorParameters{ 1, false };
+
+    std::vector<double> regularization{ 1.0e-1, 1.0e-2, 1.0e-3, 1.0e-4 };
+    std::vector<trainers::EvaluatingTrainer<predictors::LinearPredictor>> evaluatingTrainers;
+    for (size_t i = 0; i < regularization.size(); ++i)
+    {
+        auto sgdTrainer = common::MakeSGDTrainer(loss, { regularization[i], "XYZ" });
+        auto evaluator = common::MakeEvaluator<predictors::LinearPredictor>(dataset.GetAnyDataset(), evaluatorParameters, loss);
+        evaluatingTrainers.push_back(trainers::MakeEvaluatingTrainer(std::move(sgdTrainer), evaluator));
+    }
+
+    // run the candidates concurrently and halve the active set after each epoch: 4 -> 2 -> 1
+    trainers::SweepingTrainerParameters sweepParameters;
+    sweepParameters.parallel = true;
+    sweepParameters.successiveHalving = true;
+    trainers::SweepingTrainer<predictors::LinearPredictor> trainer(std::move(evaluatingTrainers), sweepParameters);
+    trainer.SetDataset(dataset.GetAnyDataset());
+
+    testing::ProcessTest("TestSweepingTrainer (initial active set)", trainer.NumActiveTrainers() == 4);
+    trainer.Update();
+    testing::ProcessTest("TestSweepingTrainer (first halving)", trainer.NumActiveTrainers() == 2);
+    trainer.Update();
+    testing::ProcessTest("TestSweepingTrainer (second halving)", trainer.NumActiveTrainers() == 1);
+    trainer.Update();
+    testing::ProcessTest("TestSweepingTrainer (active set floor)", trainer.NumActiveTrainers() == 1);
+
+    const auto& predictor = trainer.GetPredictor();
+    testing::ProcessTest("TestSweepingTrainer (best predictor)", predictor.GetWeights().Size() > 0);
+}
+
+struct ThresholdFinderTestMetadata
+{
+    data::WeightLabel weak;
+};
+
+void TestThresholdFinders()
+{
+    // a single feature with sign-mixed, deterministic pseudo-random values, enough of them to push
+    // the exact finder onto its radix-sort path
+    data::Dataset<data::Example<data::DoubleDataVector, ThresholdFinderTestMetadata>> dataset;
+    std::vector<double> values;
+    double x = 0.5;
+    for (int i = 0; i < 400; ++i)
+    {
+        x = std::fmod(x * 997.0 + 0.123, 1.0) - 0.5;
+        values.push_back(x);
+        dataset.AddExample({ data::DoubleDataVector{ x }, ThresholdFinderTestMetadata{ { 1.0, 0.0 } } });
+    }
+    std::sort(values.begin(), values.end());
+    values.erase(std::unique(values.begin(), values.end()), values.end());
+
+    auto isOrdered = [](const std::vector<predictors::SingleElementThresholdPredictor>& thresholds) {
+        for (size_t i = 0; i + 1 < thresholds.size(); ++i)
+        {
+            if (thresholds[i].GetThreshold() >= thresholds[i + 1].GetThreshold()) return false;
+        }
+        return true;
+    };
+
+    // the exact path returns a midpoint between each pair of adjacent unique values
+    trainers::ExhaustiveThresholdFinder exhaustiveFinder;
+    auto exhaustiveThresholds = exhaustiveFinder.GetThresholds(dataset.GetExampleIterator());
+    testing::ProcessTest("TestThresholdFinders (exhaustive)", isOrdered(exhaustiveThresholds) && exhaustiveThresholds.size() == values.size() - 1);
+
+    // the sketch path returns at most the requested number of candidates
+    trainers::QuantileThresholdFinder quantileFinder(16);
+    auto quantileThresholds = quantileFinder.GetThresholds(dataset.GetExampleIterator());
+    testing::ProcessTest("TestThresholdFinders (quantile)", isOrdered(quantileThresholds) && quantileThresholds.size() <= 16 && quantileThresholds.size() >= 8);
+}
+
+void TestTelemetryTrainer()
+{
+    data::AutoSupervisedDataset dataset;
+    dataset.AddExample({ { 1.0, 0.0, 2.0, 0.0, 3.0 },{ 1.0, 1.0 } });
+    dataset.AddExample({ { 0.0, 4.0, 5.0, 6.0, 7.0 },{ 1.0, -1.0 } });
+    dataset.AddExample({ { 8.0, 0.0, 9.0 },{ 1.0, 1.0 } });
+    dataset.AddExample({ { 0.0, 10.0 },{ 1.0, -1.0 } });
+
+    common::LossFunctionArguments loss{ common::LossFunctionArguments::LossFunction::log };
+    trainers::SGDTrainerParameters parameters{ 0.01, "XYZ" };
+
+    // report every second update as a JSON line
+    std::stringstream reports;
+    trainers::TelemetryTrainer<predictors::LinearPredictor> telemetryTrainer(common::MakeSGDTrainer(loss, parameters), { 2, true, 4 }, reports);
+    telemetryTrainer.SetDataset(dataset.GetAnyDataset());
+    for (int epoch = 0; epoch < 4; ++epoch)
+    {
+        telemetryTrainer.Update();
+    }
+
+    std::string line;
+    size_t numReports = 0;
+    bool wellFormed = true;
+    while (std::getline(reports, line))
+    {
+        ++numReports;
+        wellFormed = wellFormed && line.find("{\"update\":") == 0 && line.find("\"examplesPerSecond\":") != std::string::npos && line.back() == '}';
+    }
+    testing::ProcessTest("TestTelemetryTrainer (report count)", numReports == 2);
+    testing::ProcessTest("TestTelemetryTrainer (report format)", wellFormed);
+
+    // silent mode publishes nothing
+    std::stringstream silentReports;
+    trainers::TelemetryTrainer<predictors::LinearPredictor> silentTrainer(common::MakeSGDTrainer(loss, parameters), { 0 }, silentReports);
+    silentTrainer.SetDataset(dataset.GetAnyDataset());
+    silentTrainer.Update();
+    testing::ProcessTest("TestTelemetryTrainer (silent)", silentReports.str().empty());
+}
+
+void TestLinearPredictorPruning()
+{
+    predictors::LinearPredictor predictor(math::ColumnVector<double>{ 1.0, 0.001, -2.0, -0.0005, 3.0 }, 0.5);
+
+    auto pruned = trainers::PruneLinearPredictor(predictor, 0.01);
+    testing::ProcessTest("TestLinearPredictorPruning (kept indices)", pruned.keptIndices == std::vector<size_t>{ 0, 2, 4 });
+    testing::ProcessTest("TestLinearPredictorPruning (weights)", pruned.predictor.GetWeights().ToArray() == std::vector<double>{ 1.0, -2.0, 3.0 });
+    testing::ProcessTest("TestLinearPredictorPruning (bias)", pruned.predictor.GetBias() == 0.5);
+
+    // a zero threshold drops exact-zero weights only
+    predictors::LinearPredictor sparse(math::ColumnVector<double>{ 0.0, 7.0, 0.0 }, 0.0);
+    auto compacted = trainers::PruneLinearPredictor(sparse, 0.0);
+    testing::ProcessTest("TestLinearPredictorPruning (zero threshold)", compacted.keptIndices == std::vector<size_t>{ 1 });
+}
+
+void TestDatasetStatistics()
+{
+    data::AutoSupervisedDataset dataset;
+    dataset.AddExample({ { 1.0, -2.0 }, { 1.0, 1.0 } });
+    dataset.AddExample({ { 3.0, 2.0 }, { 1.0, -1.0 } });
+    dataset.AddExample({ { 5.0, 0.0 }, { 1.0, 1.0 } });
+    dataset.AddExample({ { 7.0, 4.0 }, { 1.0, -1.0 } });
+
+    auto statistics = trainers::CalculateStatistics(dataset.GetAnyDataset(), 16);
+    testing::ProcessTest("TestDatasetStatistics (count)", statistics.numExamples == 4);
+    testing::ProcessTest("TestDatasetStatistics (mean)", statistics.mean.ToArray() == std::vector<double>{ 4.0, 1.0 });
+    testing::ProcessTest("TestDatasetStatistics (variance)", statistics.variance.ToArray() == std::vector<double>{ 5.0, 5.0 });
+    testing::ProcessTest("TestDatasetStatistics (min)", statistics.min.ToArray() == std::vector<double>{ 1.0, -2.0 });
+    testing::ProcessTest("TestDatasetStatistics (max)", statistics.max.ToArray() == std::vector<double>{ 7.0, 4.0 });
+
+    // the sketch capacity exceeds the dataset size, so the extreme quantiles are exact
+    testing::ProcessTest("TestDatasetStatistics (quantiles)", statistics.quantileSketches.size() == 2 && statistics.quantileSketches[0].GetQuantile(0.0) == 1.0 && statistics.quantileSketches[0].GetQuantile(1.0) == 7.0);
+
+    // the sharded computation merges to the same moments and extremes, up to rounding
+    auto sharded = trainers::CalculateStatistics(dataset, 16, 2);
+    bool shardedPassed = sharded.numExamples == 4;
+    for (size_t i = 0; i < 2; ++i)
+    {
+        shardedPassed &= std::abs(sharded.mean[i] - statistics.mean[i]) < 1.0e-10;
+        shardedPassed &= std::abs(sharded.variance[i] - statistics.variance[i]) < 1.0e-10;
+        shardedPassed &= sharded.min[i] == statistics.min[i];
+        shardedPassed &= sharded.max[i] == statistics.max[i];
+    }
+    testing::ProcessTest("TestDatasetStatistics (sharded merge)", shardedPassed);
+}
+
 int main()
 {
     TestSDCATrainer();
     TestMeanCalculator();
+    TestKMeansTrainer();
+    TestSGDTrainer();
+    TestTrainerCheckpointing();
+    TestTelemetryTrainer();
+    TestLinearPredictorPruning();
+    TestDatasetStatistics();
+    TestSDCAWarmStart();
+    TestSweepingTrainer();
+    TestThresholdFinders();
 }
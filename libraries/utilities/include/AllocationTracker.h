@@ -0,0 +1,154 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     AllocationTracker.h (utilities)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// stl
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+namespace ell
+{
+namespace utilities
+{
+    /// <summary> The subsystem an instrumented allocation is attributed to. The current tag is
+    /// thread-local and is set with `ScopedAllocationTag`; allocations recorded outside any tagged
+    /// scope count as `other`. </summary>
+    enum class AllocationTag
+    {
+        other,
+        archiving,
+        modelEvaluation,
+        dataLoading
+    };
+
+    constexpr size_t numAllocationTags = 4;
+
+    /// <summary> Gets the display name of an allocation tag. </summary>
+    ///
+    /// <param name="tag"> The tag. </param>
+    ///
+    /// <returns> The tag's name. </returns>
+    std::string GetAllocationTagName(AllocationTag tag);
+
+    /// <summary> Counters accumulated for one allocation tag on one thread. </summary>
+    struct AllocationCounters
+    {
+        uint64_t allocationCount = 0; // number of recorded allocations
+        uint64_t allocatedBytes = 0; // total bytes of recorded allocations
+        int64_t liveBytes = 0; // recorded allocations minus recorded deallocations
+        int64_t highWaterBytes = 0; // the maximum value liveBytes has reached
+    };
+
+    /// <summary> A copy of the calling thread's allocation counters, taken at one point in time.
+    /// Snapshots can be diffed to attribute allocations to a region of a run. </summary>
+    struct AllocationSnapshot
+    {
+        std::array<AllocationCounters, numAllocationTags> counters;
+
+        /// <summary> Gets the counters for one tag. </summary>
+        ///
+        /// <param name="tag"> The tag. </param>
+        ///
+        /// <returns> The counters accumulated under the tag. </returns>
+        const AllocationCounters& GetCounters(AllocationTag tag) const { return counters[static_cast<size_t>(tag)]; }
+    };
+
+    namespace detail
+    {
+        extern std::atomic<bool> allocationTrackingEnabled;
+
+        void RecordAllocationImpl(size_t size);
+        void RecordDeallocationImpl(size_t size);
+    }
+
+    /// <summary> Indicates if allocation tracking is currently recording. The check is a single
+    /// relaxed atomic load, so instrumented allocation sites pay near-zero cost while tracking is
+    /// disabled. </summary>
+    ///
+    /// <returns> true if allocation tracking is recording. </returns>
+    inline bool IsAllocationTrackingEnabled() { return detail::allocationTrackingEnabled.load(std::memory_order_relaxed); }
+
+    /// <summary> Turns allocation tracking on or off (off by default). </summary>
+    ///
+    /// <param name="enable"> true to record allocations, false to make the recording functions no-ops. </param>
+    void EnableAllocationTracking(bool enable);
+
+    /// <summary> Records one allocation against the calling thread's current tag. Called by
+    /// instrumented allocation sites (the archivers' Variant boxing, dataset example appends, model
+    /// evaluation buffers). </summary>
+    ///
+    /// <param name="size"> The number of bytes allocated. </param>
+    inline void RecordAllocation(size_t size)
+    {
+        if (IsAllocationTrackingEnabled())
+        {
+            detail::RecordAllocationImpl(size);
+        }
+    }
+
+    /// <summary> Records one deallocation against the calling thread's current tag. </summary>
+    ///
+    /// <param name="size"> The number of bytes deallocated. </param>
+    inline void RecordDeallocation(size_t size)
+    {
+        if (IsAllocationTrackingEnabled())
+        {
+            detail::RecordDeallocationImpl(size);
+        }
+    }
+
+    /// <summary> Attributes the instrumented allocations in the enclosing scope to a subsystem tag.
+    /// The previous tag is restored when the scope exits, so tagged scopes nest. </summary>
+    class ScopedAllocationTag
+    {
+    public:
+        /// <summary> Sets the calling thread's allocation tag for the enclosing scope. </summary>
+        ///
+        /// <param name="tag"> The tag to attribute allocations to. </param>
+        ScopedAllocationTag(AllocationTag tag);
+
+        ~ScopedAllocationTag();
+
+        ScopedAllocationTag(const ScopedAllocationTag&) = delete;
+        ScopedAllocationTag& operator=(const ScopedAllocationTag&) = delete;
+
+    private:
+        AllocationTag _previousTag;
+    };
+
+    /// <summary> Takes a snapshot of the calling thread's allocation counters. </summary>
+    ///
+    /// <returns> The snapshot. </returns>
+    AllocationSnapshot GetAllocationSnapshot();
+
+    /// <summary> Subtracts one snapshot from another, giving the allocations recorded between the
+    /// two. The high-water marks are taken from the later snapshot (they don't subtract
+    /// meaningfully). </summary>
+    ///
+    /// <param name="before"> The earlier snapshot. </param>
+    /// <param name="after"> The later snapshot. </param>
+    ///
+    /// <returns> The difference. </returns>
+    AllocationSnapshot GetAllocationDifference(const AllocationSnapshot& before, const AllocationSnapshot& after);
+
+    /// <summary> Resets the calling thread's allocation counters to zero. </summary>
+    void ResetAllocationCounters();
+
+    /// <summary> Writes one line per tag with the snapshot's counts, bytes, and high-water marks to
+    /// a stream. Tags with no recorded allocations are omitted. </summary>
+    ///
+    /// <param name="stream"> The stream to write the report to. </param>
+    /// <param name="snapshot"> The snapshot to report. </param>
+    void ReportAllocations(std::ostream& stream, const AllocationSnapshot& snapshot);
+}
+}
@@ -0,0 +1,173 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     BinaryArchiver.h (utilities)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Archiver.h"
+#include "Exception.h"
+#include "TypeFactory.h"
+#include "TypeName.h"
+
+// stl
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace ell
+{
+namespace utilities
+{
+    /// <summary>
+    /// An archiver that encodes data in a compact binary format. Scalars are written as raw
+    /// little-endian values, strings and arrays as a 64-bit count followed by the raw data, and
+    /// objects as their type name followed by their fields in archiving order (field names are
+    /// not stored). The stream starts with a 4-byte signature and a format version, which
+    /// `HasBinarySignature` can use to tell binary archives apart from text ones.
+    /// </summary>
+    class BinaryArchiver : public Archiver
+    {
+    public:
+        /// <summary> Default Constructor --- writes to standard output. </summary>
+        BinaryArchiver();
+
+        /// <summary> Constructor </summary>
+        ///
+        /// <param name="outputStream"> The stream to write data to. </param>
+        BinaryArchiver(std::ostream& outputStream);
+
+    protected:
+        DECLARE_ARCHIVE_VALUE_OVERRIDE(bool);
+        DECLARE_ARCHIVE_VALUE_OVERRIDE(char);
+        DECLARE_ARCHIVE_VALUE_OVERRIDE(short);
+        DECLARE_ARCHIVE_VALUE_OVERRIDE(int);
+        DECLARE_ARCHIVE_VALUE_OVERRIDE(size_t);
+        DECLARE_ARCHIVE_VALUE_OVERRIDE(int64_t);
+#ifdef __APPLE__
+        DECLARE_ARCHIVE_VALUE_OVERRIDE(uint64_t);
+#endif
+        DECLARE_ARCHIVE_VALUE_OVERRIDE(float);
+        DECLARE_ARCHIVE_VALUE_OVERRIDE(double);
+        virtual void ArchiveValue(const char* name, const std::string& value) override;
+
+        DECLARE_ARCHIVE_ARRAY_OVERRIDE(bool);
+        DECLARE_ARCHIVE_ARRAY_OVERRIDE(char);
+        DECLARE_ARCHIVE_ARRAY_OVERRIDE(short);
+        DECLARE_ARCHIVE_ARRAY_OVERRIDE(int);
+        DECLARE_ARCHIVE_ARRAY_OVERRIDE(size_t);
+        DECLARE_ARCHIVE_ARRAY_OVERRIDE(int64_t);
+#ifdef __APPLE__
+        DECLARE_ARCHIVE_ARRAY_OVERRIDE(uint64_t);
+#endif
+        DECLARE_ARCHIVE_ARRAY_OVERRIDE(float);
+        DECLARE_ARCHIVE_ARRAY_OVERRIDE(double);
+        virtual void ArchiveArray(const char* name, const std::vector<std::string>& array) override;
+        virtual void ArchiveArray(const char* name, const std::string& baseTypeName, const std::vector<const IArchivable*>& array) override;
+
+        virtual void BeginArchiveObject(const char* name, const IArchivable& value) override;
+        virtual void EndArchiveObject(const char* name, const IArchivable& value) override;
+
+        virtual void EndArchiving() override;
+
+    private:
+        // Serialization
+        template <typename ValueType, IsFundamental<ValueType> concept = 0>
+        void WriteScalar(const char* name, const ValueType& value);
+
+        void WriteScalar(const char* name, const std::string& value);
+
+        template <typename ValueType>
+        void WriteArray(const char* name, const std::vector<ValueType>& array);
+
+        void WriteBytes(const void* ptr, size_t numBytes);
+        void WriteCount(uint64_t count);
+
+        std::ostream& _out;
+    };
+
+    /// <summary> An unarchiver that reads data encoded in the BinaryArchiver format. </summary>
+    class BinaryUnarchiver : public Unarchiver
+    {
+    public:
+        /// <summary> Default Constructor --- reads from standard input. </summary>
+        BinaryUnarchiver(SerializationContext context);
+
+        /// <summary> Constructor </summary>
+        ///
+        /// <param name="inputStream"> The stream to read data from. </summary>
+        BinaryUnarchiver(std::istream& inputStream, SerializationContext context);
+
+        /// <summary> Checks whether a stream starts with the binary archive signature, without consuming any input. </summary>
+        ///
+        /// <param name="stream"> The stream to check. </param>
+        ///
+        /// <returns> true if the stream holds a binary archive. </returns>
+        static bool HasBinarySignature(std::istream& stream);
+
+    protected:
+        DECLARE_UNARCHIVE_VALUE_OVERRIDE(bool);
+        DECLARE_UNARCHIVE_VALUE_OVERRIDE(char);
+        DECLARE_UNARCHIVE_VALUE_OVERRIDE(short);
+        DECLARE_UNARCHIVE_VALUE_OVERRIDE(int);
+        DECLARE_UNARCHIVE_VALUE_OVERRIDE(size_t);
+        DECLARE_UNARCHIVE_VALUE_OVERRIDE(int64_t);
+#ifdef __APPLE__
+        DECLARE_UNARCHIVE_VALUE_OVERRIDE(uint64_t);
+#endif
+        DECLARE_UNARCHIVE_VALUE_OVERRIDE(float);
+        DECLARE_UNARCHIVE_VALUE_OVERRIDE(double);
+        virtual void UnarchiveValue(const char* name, std::string& value) override;
+
+        DECLARE_UNARCHIVE_ARRAY_OVERRIDE(bool);
+        DECLARE_UNARCHIVE_ARRAY_OVERRIDE(char);
+        DECLARE_UNARCHIVE_ARRAY_OVERRIDE(short);
+        DECLARE_UNARCHIVE_ARRAY_OVERRIDE(int);
+        DECLARE_UNARCHIVE_ARRAY_OVERRIDE(size_t);
+        DECLARE_UNARCHIVE_ARRAY_OVERRIDE(int64_t);
+#ifdef __APPLE__
+        DECLARE_UNARCHIVE_ARRAY_OVERRIDE(uint64_t);
+#endif
+        DECLARE_UNARCHIVE_ARRAY_OVERRIDE(float);
+        DECLARE_UNARCHIVE_ARRAY_OVERRIDE(double);
+        virtual void UnarchiveArray(const char* name, std::vector<std::string>& array) override;
+
+        virtual void BeginUnarchiveArray(const char* name, const std::string& typeName) override;
+        virtual bool BeginUnarchiveArrayItem(const std::string& typeName) override;
+        virtual void EndUnarchiveArrayItem(const std::string& typeName) override;
+        virtual void EndUnarchiveArray(const char* name, const std::string& typeName) override;
+
+        virtual std::string BeginUnarchiveObject(const char* name, const std::string& typeName) override;
+        virtual void EndUnarchiveObject(const char* name, const std::string& typeName) override;
+        virtual void UnarchiveObjectAsPrimitive(const char* name, IArchivable& value) override;
+
+    private:
+        template <typename ValueType, IsFundamental<ValueType> concept = 0>
+        void ReadScalar(const char* name, ValueType& value);
+
+        void ReadScalar(const char* name, std::string& value);
+
+        template <typename ValueType, IsFundamental<ValueType> concept = 0>
+        void ReadArray(const char* name, std::vector<ValueType>& array);
+
+        void ReadArray(const char* name, std::vector<std::string>& array);
+
+        void ReadBytes(void* ptr, size_t numBytes);
+        uint64_t ReadCount();
+
+        std::istream& _in;
+        std::vector<uint64_t> _arrayItemsLeft; // one entry per nested object array being read
+    };
+}
+}
+
+#include "../tcc/BinaryArchiver.tcc"
@@ -10,6 +10,7 @@
 
 // stl
 #include <cstddef>
+#include <cstdint>
 #include <iterator>
 #include <vector>
 
@@ -18,9 +19,15 @@ namespace ell
 namespace utilities
 {
     /// <summary> A non-decreasing list of nonegative integers, with a forward Iterator, stored in a
-    /// compressed delta enconding. </summary>
+    /// compressed delta enconding. Deltas are packed in blocks of 128 with a fixed bit width per
+    /// block, so the Iterator can decode a whole block at a time with a tight branch-free loop
+    /// instead of decoding each integer individually. </summary>
     class CompressedIntegerList
     {
+        // number of deltas per encoded block; a full block occupies 1 header byte (the bit width)
+        // plus exactly blockSize * width / 8 payload bytes
+        static constexpr size_t blockSize = 128;
+
     public:
         /// <summary> A read-only forward std::iterator for the CompressedIntegerList. </summary>
         class Iterator
@@ -32,12 +39,10 @@ namespace utilities
 
             Iterator(Iterator&&) = default;
 
-            // Returns true if the std::iterator is currently pointing to a valid iterate
-
             /// <summary> Query if this object input stream valid. </summary>
             ///
             /// <returns> true if it succeeds, false if it fails. </returns>
-            bool IsValid() const { return _iter < _end; }
+            bool IsValid() const { return _index < _totalSize; }
 
             /// <summary> Proceeds to the Next iterate. </summary>
             void Next();
@@ -45,18 +50,51 @@ namespace utilities
             /// <summary> Returns the value of the current iterate. </summary>
             ///
             /// <returns> An size_t. </returns>
-            size_t Get() const { return _value; }
+            size_t Get() const { return _buffer[_bufferPos]; }
+
+            /// <summary> Returns a pointer to the decoded values remaining in the current block,
+            /// along with their count. Callers that consume whole blocks (see NextBlock) can
+            /// process the decoded values as a flat array instead of stepping the iterator one
+            /// value at a time. </summary>
+            ///
+            /// <param name="count"> [out] The number of decoded values remaining in the block. </param>
+            ///
+            /// <returns> A pointer to the first remaining decoded value. </returns>
+            const size_t* GetBlock(size_t& count) const
+            {
+                count = _bufferCount - _bufferPos;
+                return _buffer + _bufferPos;
+            }
+
+            /// <summary> Advances past all of the values in the current block. </summary>
+            void NextBlock()
+            {
+                _index += _bufferCount - _bufferPos;
+                _bufferPos = _bufferCount;
+                if (_index < _totalSize)
+                {
+                    DecodeNextBlock();
+                }
+            }
 
         private:
             // private ctor, can only be called from CompressedIntegerList class
-            Iterator(const uint8_t* iter, const uint8_t* end);
+            Iterator(const uint8_t* iter, const uint8_t* end, const std::vector<size_t>* pendingDeltas, size_t totalSize);
             friend class CompressedIntegerList;
 
+            // decodes the next block (or the pending tail) into _buffer
+            void DecodeNextBlock();
+
             // members
-            const uint8_t* _iter;
-            const uint8_t* _end;
-            size_t _value;
-            size_t _iter_increment;
+            const uint8_t* _iter = nullptr;
+            const uint8_t* _end = nullptr;
+            const std::vector<size_t>* _pendingDeltas = nullptr;
+            size_t _totalSize = 0;
+            size_t _index = 0;
+            size_t _value = 0;
+            size_t _bufferPos = 0;
+            size_t _bufferCount = 0;
+            size_t _buffer[blockSize]; // decoded values for the current block
         };
 
         /// <summary> Default Constructor. Constructs an empty list. </summary>
@@ -96,10 +134,14 @@ namespace utilities
         /// <summary> Returns an `Iterator` that points to the beginning of the list. </summary>
         ///
         /// <returns> The iterator. </returns>
-        Iterator GetIterator() const { return Iterator(_data.data(), _data.data() + _data.size()); }
+        Iterator GetIterator() const { return Iterator(_data.data(), _data.data() + _data.size(), &_pendingDeltas, _size); }
 
     private:
-        std::vector<uint8_t> _data;
+        // packs the pending deltas into a full block at the end of _data
+        void FlushPendingBlock();
+
+        std::vector<uint8_t> _data; // full encoded blocks
+        std::vector<size_t> _pendingDeltas; // deltas not yet packed into a block
         size_t _last;
         size_t _size;
     };
@@ -9,8 +9,19 @@
 
 #ifndef NDEBUG
 #define DEBUG_THROW( condition, exception ) if(condition) throw exception
-#else 
-#define DEBUG_THROW( condition, exception ) 
+#else
+#define DEBUG_THROW( condition, exception )
+#endif
+
+/// <summary> Validates an argument on a hot code path. Compiles to a compare and an out-of-line
+/// throw with a canned message (see `ThrowInputException` in Exception.h, which the use site must
+/// include), and compiles away entirely when ELL_UNCHECKED_MATH is defined. </summary>
+/// <param name="condition"> The error condition. </param>
+/// <param name="errorCode"> The `InputExceptionErrors` code to throw when the condition holds. </param>
+#ifndef ELL_UNCHECKED_MATH
+#define THROW_IF_INVALID( condition, errorCode ) if(condition) ell::utilities::ThrowInputException(errorCode)
+#else
+#define THROW_IF_INVALID( condition, errorCode )
 #endif
 
 /// <summary> Emits a printf statement for debugging </summary>
@@ -102,6 +102,20 @@ namespace utilities
     typedef ErrorCodeException<NumericExceptionErrors> NumericException;
     typedef ErrorCodeException<InputExceptionErrors> InputException;
     typedef ErrorCodeException<DataFormatErrors> DataFormatException;
+
+    /// <summary> Gets the canned, statically allocated message for an input error code. </summary>
+    ///
+    /// <param name="errorCode"> The error code. </param>
+    ///
+    /// <returns> A string literal describing the error. </returns>
+    const char* GetErrorMessage(InputExceptionErrors errorCode);
+
+    /// <summary> Throws an `InputException` with the canned message for the given error code.
+    /// Kept out of line so that validations on hot code paths compile to a compare and a call,
+    /// with no message construction before the decision to throw. </summary>
+    ///
+    /// <param name="errorCode"> The error code. </param>
+    [[noreturn]] void ThrowInputException(InputExceptionErrors errorCode);
 }
 }
 
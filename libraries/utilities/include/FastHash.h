@@ -0,0 +1,78 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     FastHash.h (utilities)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "IArchivable.h"
+
+// stl
+#include <cstddef>
+#include <cstdint>
+
+namespace ell
+{
+namespace utilities
+{
+    /// <summary>
+    /// A high-throughput non-cryptographic 64-bit content hash (the xxHash64 algorithm), for
+    /// fingerprinting datasets, model weights and archived objects. Processes input at close to
+    /// memory bandwidth, and supports incremental hashing: feed content in arbitrary-size pieces
+    /// with `Update` and read the digest at any point. Not for security purposes - an adversary
+    /// can construct collisions.
+    /// </summary>
+    class FastHash
+    {
+    public:
+        /// <summary> Constructs a hasher. </summary>
+        ///
+        /// <param name="seed"> The seed; different seeds give independent hash functions. </param>
+        FastHash(uint64_t seed = 0);
+
+        /// <summary> Feeds a piece of content to the hasher. </summary>
+        ///
+        /// <param name="data"> Pointer to the content. </param>
+        /// <param name="size"> The content size, in bytes. </param>
+        void Update(const void* data, size_t size);
+
+        /// <summary> Gets the hash of everything fed so far. Doesn't modify the hasher state, so
+        /// updating and digesting can be interleaved. </summary>
+        ///
+        /// <returns> The 64-bit hash. </returns>
+        uint64_t Digest() const;
+
+        /// <summary> Hashes a single piece of content. </summary>
+        ///
+        /// <param name="data"> Pointer to the content. </param>
+        /// <param name="size"> The content size, in bytes. </param>
+        /// <param name="seed"> The seed. </param>
+        ///
+        /// <returns> The 64-bit hash. </returns>
+        static uint64_t Hash(const void* data, size_t size, uint64_t seed = 0);
+
+    private:
+        void ProcessStripe(const unsigned char* stripe);
+
+        uint64_t _seed;
+        uint64_t _accumulators[4];
+        unsigned char _buffer[32];
+        size_t _bufferedBytes = 0;
+        uint64_t _totalBytes = 0;
+    };
+
+    /// <summary> Hashes an archivable object's properties, by streaming its archived
+    /// representation through a `FastHash` without materializing it. Two objects that archive
+    /// identically hash identically, so this is the canonical fingerprint for nodes, models and
+    /// anything else `IArchivable`. </summary>
+    ///
+    /// <param name="object"> The object to fingerprint. </param>
+    /// <param name="seed"> The seed. </param>
+    ///
+    /// <returns> The 64-bit hash of the object's archived representation. </returns>
+    uint64_t HashArchivedObject(const IArchivable& object, uint64_t seed = 0);
+}
+}
@@ -0,0 +1,44 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     FloatToString.h (utilities)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// stl
+#include <cstddef>
+#include <string>
+
+namespace ell
+{
+namespace utilities
+{
+    /// <summary> The buffer size that always fits a formatted double, including sign, decimal
+    /// point, and exponent. </summary>
+    constexpr size_t maxDoubleStringLength = 32;
+
+    /// <summary> Formats a double into a character buffer using integer digit generation, roughly
+    /// an order of magnitude faster than streaming through iostreams. The output follows the
+    /// printf "%g" conventions: fixed notation for moderate exponents, scientific notation
+    /// otherwise, with trailing zeros stripped. Values with extreme exponents fall back to
+    /// snprintf. </summary>
+    ///
+    /// <param name="buffer"> The buffer to write into, with room for at least
+    /// maxDoubleStringLength characters. </param>
+    /// <param name="value"> The value to format. </param>
+    /// <param name="precision"> The number of significant digits to produce (1 - 17). </param>
+    ///
+    /// <returns> The number of characters written. No terminating null is written. </returns>
+    size_t FormatDouble(char* buffer, double value, int precision = 6);
+
+    /// <summary> Formats a double and appends it to a string. </summary>
+    ///
+    /// <param name="out"> [in,out] The string to append to. </param>
+    /// <param name="value"> The value to format. </param>
+    /// <param name="precision"> The number of significant digits to produce (1 - 17). </param>
+    void AppendDouble(std::string& out, double value, int precision = 6);
+}
+}
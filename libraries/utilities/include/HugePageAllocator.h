@@ -0,0 +1,106 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     HugePageAllocator.h (utilities)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// stl
+#include <cstddef>
+#include <vector>
+
+namespace ell
+{
+namespace utilities
+{
+    /// <summary> The size of a huge page (2 MB on the platforms we target). Allocations at least
+    /// this large are worth backing with huge pages. </summary>
+    constexpr size_t hugePageSize = 2 * 1024 * 1024;
+
+    /// <summary> Allocates a block of memory that is aligned to (and rounded up to a multiple of)
+    /// the huge page size, and asks the operating system to back it with huge pages. The request is
+    /// a hint: on platforms without huge page support, or when no huge pages are available, the
+    /// memory is still returned and is simply backed by ordinary pages. Throws std::bad_alloc on
+    /// failure. </summary>
+    ///
+    /// <param name="size"> The number of bytes to allocate. </param>
+    ///
+    /// <returns> A pointer to the allocated memory. </returns>
+    void* HugePageAllocate(size_t size);
+
+    /// <summary> Frees a block of memory previously returned by HugePageAllocate. </summary>
+    ///
+    /// <param name="ptr"> The pointer returned by HugePageAllocate. </param>
+    /// <param name="size"> The size that was passed to HugePageAllocate. </param>
+    void HugePageDeallocate(void* ptr, size_t size);
+
+    /// <summary> A standard-library-compatible allocator that backs large allocations with huge
+    /// pages, to cut TLB misses when iterating over big weight matrices and datasets. Allocations
+    /// below the huge page size use the ordinary heap, so small containers pay nothing. All
+    /// instances are interchangeable (the allocator is stateless). </summary>
+    template <typename ElementType>
+    class HugePageAllocator
+    {
+    public:
+        using value_type = ElementType;
+
+        HugePageAllocator() = default;
+
+        template <typename OtherElementType>
+        HugePageAllocator(const HugePageAllocator<OtherElementType>&) noexcept
+        {
+        }
+
+        /// <summary> Allocates storage for the given number of elements. </summary>
+        ///
+        /// <param name="numElements"> The number of elements to allocate storage for. </param>
+        ///
+        /// <returns> A pointer to the uninitialized storage. </returns>
+        ElementType* allocate(size_t numElements)
+        {
+            size_t size = numElements * sizeof(ElementType);
+            if (size >= hugePageSize)
+            {
+                return static_cast<ElementType*>(HugePageAllocate(size));
+            }
+            return static_cast<ElementType*>(::operator new(size));
+        }
+
+        /// <summary> Frees storage previously returned by allocate. </summary>
+        ///
+        /// <param name="ptr"> The pointer returned by allocate. </param>
+        /// <param name="numElements"> The number of elements that was passed to allocate. </param>
+        void deallocate(ElementType* ptr, size_t numElements) noexcept
+        {
+            size_t size = numElements * sizeof(ElementType);
+            if (size >= hugePageSize)
+            {
+                HugePageDeallocate(ptr, size);
+            }
+            else
+            {
+                ::operator delete(ptr);
+            }
+        }
+    };
+
+    template <typename ElementType, typename OtherElementType>
+    bool operator==(const HugePageAllocator<ElementType>&, const HugePageAllocator<OtherElementType>&) noexcept
+    {
+        return true;
+    }
+
+    template <typename ElementType, typename OtherElementType>
+    bool operator!=(const HugePageAllocator<ElementType>&, const HugePageAllocator<OtherElementType>&) noexcept
+    {
+        return false;
+    }
+
+    /// <summary> A std::vector whose large allocations are backed by huge pages. </summary>
+    template <typename ElementType>
+    using HugePageVector = std::vector<ElementType, HugePageAllocator<ElementType>>;
+}
+}
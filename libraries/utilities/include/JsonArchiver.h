@@ -17,6 +17,8 @@
 // stl
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <limits>
 #include <memory>
 #include <ostream>
 #include <sstream>
@@ -40,6 +42,16 @@ namespace utilities
         /// <param name="outputStream"> The stream to write data to. </param>
         JsonArchiver(std::ostream& outputStream);
 
+        /// <summary> Enables writing large numeric arrays as base64-encoded raw blocks (a JSON
+        /// string of the form "b64[count]:payload") instead of per-element formatted values. The
+        /// output stays text-transportable, loads without per-element parsing, and is read back
+        /// transparently by `JsonUnarchiver`, which accepts both forms. The payload is the array's
+        /// native little-endian bytes, so compact archives are not portable to big-endian
+        /// readers. </summary>
+        ///
+        /// <param name="enable"> true to write large numeric arrays as base64 blocks. </param>
+        void SetCompactNumericArrays(bool enable) { _compactNumericArrays = enable; }
+
     protected:
         DECLARE_ARCHIVE_VALUE_OVERRIDE(bool);
         DECLARE_ARCHIVE_VALUE_OVERRIDE(char);
@@ -87,7 +99,19 @@ namespace utilities
         template <typename ValueType, IsIArchivable<ValueType> concept = 0>
         void WriteArray(const char* name, const std::vector<ValueType>& array);
 
+        // compact numeric array support; the tag dispatch keeps std::vector<bool> (which has no
+        // contiguous storage) and non-numeric element types on the per-element path
+        template <typename ValueType>
+        bool TryWriteCompactArray(const char* name, const std::vector<ValueType>& array);
+
+        template <typename ValueType>
+        bool WriteCompactArray(const char* name, const std::vector<ValueType>& array, std::true_type isRawCopyable);
+
+        template <typename ValueType>
+        bool WriteCompactArray(const char* name, const std::vector<ValueType>& array, std::false_type isRawCopyable);
+
         std::ostream& _out;
+        bool _compactNumericArrays = false;
         int _indent = 0;
         std::string _endOfPreviousLine;
         void IncrementIndent() { ++_indent; }
@@ -157,6 +181,12 @@ namespace utilities
 
         void ReadArray(const char* name, std::vector<std::string>& array);
 
+        template <typename ValueType>
+        void ReadCompactArray(std::vector<ValueType>& array, std::true_type isRawCopyable);
+
+        template <typename ValueType>
+        void ReadCompactArray(std::vector<ValueType>& array, std::false_type isRawCopyable);
+
         void MatchFieldName(const char* name);
 
         std::string _endOfPreviousLine;
@@ -171,6 +201,12 @@ namespace utilities
         static std::string DecodeString(const std::string& str);
         static std::string EncodeTypeName(const std::string& str);
         static std::string DecodeTypeName(const std::string& str);
+
+        /// <summary> Encodes raw bytes as base64 text (standard alphabet, '=' padding). </summary>
+        static std::string EncodeBase64(const uint8_t* data, size_t size);
+
+        /// <summary> Decodes base64 text produced by `EncodeBase64` back into raw bytes. </summary>
+        static std::vector<uint8_t> DecodeBase64(const std::string& text);
     };
 }
 }
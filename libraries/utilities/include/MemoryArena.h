@@ -0,0 +1,74 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     MemoryArena.h (utilities)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// stl
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace ell
+{
+namespace utilities
+{
+    /// <summary> A simple arena (bump-pointer) allocator. Allocations are carved out of large
+    /// blocks and are never freed individually - all of the memory is released wholesale when the
+    /// arena is destroyed (or cleared). This makes allocation very cheap for workloads that build
+    /// up many small, long-lived objects with a common lifetime, such as the nodes of a model
+    /// graph. </summary>
+    class MemoryArena
+    {
+    public:
+        /// <summary> Constructs an arena. </summary>
+        ///
+        /// <param name="blockSize"> The size (in bytes) of the blocks the arena requests from the heap.
+        /// Allocations larger than this get a dedicated block. </param>
+        MemoryArena(size_t blockSize = 64 * 1024);
+
+        MemoryArena(const MemoryArena&) = delete;
+        MemoryArena& operator=(const MemoryArena&) = delete;
+
+        /// <summary> Allocates uninitialized storage from the arena. </summary>
+        ///
+        /// <param name="size"> The number of bytes to allocate. </param>
+        /// <param name="alignment"> The required alignment, which must be a power of two. </param>
+        ///
+        /// <returns> A pointer to the storage, valid until the arena is destroyed or cleared. </returns>
+        void* Allocate(size_t size, size_t alignment);
+
+        /// <summary> Releases all of the arena's blocks at once. Pointers previously returned by
+        /// Allocate become invalid. </summary>
+        void Clear();
+
+        /// <summary> Gets the total number of bytes handed out by Allocate. </summary>
+        ///
+        /// <returns> The number of allocated bytes. </returns>
+        size_t GetAllocatedSize() const { return _allocatedSize; }
+
+        /// <summary> Gets the total number of bytes the arena has requested from the heap. </summary>
+        ///
+        /// <returns> The capacity in bytes. </returns>
+        size_t GetCapacity() const;
+
+    private:
+        struct Block
+        {
+            std::unique_ptr<unsigned char[]> data;
+            size_t size = 0;
+            size_t used = 0;
+        };
+
+        Block& AddBlock(size_t minimumSize);
+
+        std::vector<Block> _blocks;
+        size_t _blockSize;
+        size_t _allocatedSize = 0;
+    };
+}
+}
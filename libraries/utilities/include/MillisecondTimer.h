@@ -48,5 +48,42 @@ namespace utilities
         std::chrono::system_clock::time_point _end;
         bool _running;
     };
+
+    /// <summary> A nanosecond-resolution timer based on the steady clock, for timing work that is
+    /// too short for `MillisecondTimer` (e.g. a single node computation). The steady clock is
+    /// monotonic, so the measurement is immune to system clock adjustments. </summary>
+    class NanosecondTimer
+    {
+    public:
+        NanosecondTimer()
+            : _start(std::chrono::steady_clock::now()), _running(true) {}
+
+        void Start()
+        {
+            _start = std::chrono::steady_clock::now();
+            _running = true;
+        }
+
+        void Stop()
+        {
+            _end = std::chrono::steady_clock::now();
+            _running = false;
+        }
+
+        std::chrono::nanoseconds::rep Elapsed()
+        {
+            if (_running)
+            {
+                _end = std::chrono::steady_clock::now();
+            }
+
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(_end - _start).count();
+        }
+
+    private:
+        std::chrono::steady_clock::time_point _start;
+        std::chrono::steady_clock::time_point _end;
+        bool _running;
+    };
 }
 }
@@ -73,8 +73,13 @@ namespace utilities
 
         /// <summary> Tells if the object description has a value associated with it. </summary>
         ///
-        /// <returns> `true` if the object description has a value, `false` otherwise. </returns>
-        bool HasValue() const { return !_value.IsEmpty(); }
+        /// <returns> `true` if the object description has a value (possibly not yet materialized), `false` otherwise. </returns>
+        bool HasValue() const { return !_value.IsEmpty() || _valueFactory != nullptr; }
+
+        /// <summary> Tells if the object description's value has been materialized yet. </summary>
+        ///
+        /// <returns> `true` if the value is held in memory, `false` if it is still deferred to its factory. </returns>
+        bool HasMaterializedValue() const { return !_value.IsEmpty(); }
 
         /// <summary> Gets the value of this object. </summary>
         ///
@@ -83,6 +88,7 @@ namespace utilities
         template <typename ValueType>
         ValueType GetValue() const
         {
+            MaterializeValue();
             return _value.GetValue<ValueType>();
         }
 
@@ -119,9 +125,23 @@ namespace utilities
         template <typename ValueType>
         void operator<<(ValueType&& value);
 
+        /// <summary>
+        /// Sets a factory that produces the value on first access, instead of an eager value.
+        /// Large values (weight tensors, say) can stay on disk until someone actually reads them,
+        /// so inspecting an object's metadata doesn't materialize everything.
+        /// </summary>
+        ///
+        /// <param name="typeName"> The type name of the value the factory produces </param>
+        /// <param name="factory"> The function invoked to produce the value on first access </param>
+        void SetValueFactory(const std::string& typeName, std::function<Variant()> factory);
+
     private:
+        void MaterializeValue() const;
+
         std::string _typeName;
+        // the value is materialized lazily from _valueFactory on first access (see MaterializeValue)
         Variant _value;
+        std::function<Variant()> _valueFactory;
         mutable PropertyCollection _properties;
 
         // friends
@@ -0,0 +1,58 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     PairwiseReduction.h (utilities)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// stl
+#include <cstddef>
+#include <vector>
+
+namespace ell
+{
+namespace utilities
+{
+    /// <summary> Combines a vector of partial results into one, using a pairwise tree whose shape
+    /// depends only on the number of partials and whose combination order is keyed to the partials'
+    /// indices. Worker threads can finish in any order: as long as partial i always holds the result
+    /// for logical chunk i, the reduction is bit-identical from run to run. Use this to merge
+    /// per-thread accumulators wherever reproducible floating-point results matter. </summary>
+    ///
+    /// <typeparam name="ValueType"> The partial result type. </typeparam>
+    /// <typeparam name="CombineFunctionType"> A callable combining two partials into one. </typeparam>
+    /// <param name="partials"> The per-chunk partial results, indexed by logical chunk. </param>
+    /// <param name="combine"> The function that combines two partials. </param>
+    ///
+    /// <returns> The combined result. </returns>
+    template <typename ValueType, typename CombineFunctionType>
+    ValueType ReducePairwise(std::vector<ValueType> partials, CombineFunctionType combine);
+
+    /// <summary> Sums an array with pairwise (cascade) summation: halves are summed recursively and
+    /// then added, with short runs summed directly. The summation tree depends only on the element
+    /// count, so the result is deterministic, and the O(log n) tree depth also gives much better
+    /// rounding behavior than a running sum. </summary>
+    ///
+    /// <typeparam name="ValueType"> The element type. </typeparam>
+    /// <param name="values"> The values to sum. </param>
+    /// <param name="count"> The number of values. </param>
+    ///
+    /// <returns> The sum. </returns>
+    template <typename ValueType>
+    ValueType PairwiseSum(const ValueType* values, size_t count);
+
+    /// <summary> Sums a vector with pairwise (cascade) summation. </summary>
+    ///
+    /// <typeparam name="ValueType"> The element type. </typeparam>
+    /// <param name="values"> The values to sum. </param>
+    ///
+    /// <returns> The sum. </returns>
+    template <typename ValueType>
+    ValueType PairwiseSum(const std::vector<ValueType>& values);
+}
+}
+
+#include "../tcc/PairwiseReduction.tcc"
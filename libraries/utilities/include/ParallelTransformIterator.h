@@ -9,6 +9,7 @@
 #pragma once
 
 // stl
+#include <cstddef>
 #include <future>
 #include <vector>
 
@@ -16,7 +17,15 @@ namespace ell
 {
 namespace utilities
 {
-    /// <summary> A read-only forward iterator that transforms the items from an input collection. processes items in parallel when possible </summary>
+    /// <summary> The default bound on the memory held by in-flight transform outputs, in bytes. </summary>
+    constexpr size_t defaultTransformPendingBytes = 1 << 20;
+
+    /// <summary> A read-only forward iterator that transforms the items from an input collection,
+    /// processing items in parallel when possible. Transforms run on the shared thread pool and
+    /// complete out of order into a bounded ring of slots, while Get()/Next() emit the results in
+    /// input order; a caller blocked on a slow element executes other pending transforms while it
+    /// waits, so a skewed element doesn't idle the pool. The ring is sized so the in-flight
+    /// outputs stay within a byte budget. </summary>
     template <typename InputIteratorType, typename OutType, typename FuncType, int MaxTasks = 0>
     class ParallelTransformIterator
     {
@@ -25,7 +34,9 @@ namespace utilities
         ///
         /// <param name="inIter"> An iterator for the input collection </param>
         /// <param name="transformFunction"> The function to apply to transform the input items</param>
-        ParallelTransformIterator(InputIteratorType& inIter, FuncType transformFunction);
+        /// <param name="maxPendingBytes"> The maximum memory to hold in in-flight outputs; bounds
+        /// the size of the completion ring. </param>
+        ParallelTransformIterator(InputIteratorType& inIter, FuncType transformFunction, size_t maxPendingBytes = defaultTransformPendingBytes);
 
         /// <summary> Returns true if the iterator is currently pointing to a valid iterate. </summary>
         ///
@@ -55,10 +66,11 @@ namespace utilities
     ///
     /// <param name="inIter"> An iterator for the input collection </param>
     /// <param name="transformFunction"> The function to apply to transform the input items</param>
+    /// <param name="maxPendingBytes"> The maximum memory to hold in in-flight outputs. </param>
     ///
     /// <returns> A ParallelTransformIterator over the input sequence using the specified transform function</returns>
     template <typename InputIteratorType, typename FuncType>
-    auto MakeParallelTransformIterator(InputIteratorType& inIterator, FuncType transformFunction) -> ParallelTransformIterator<InputIteratorType, decltype(transformFunction(inIterator.Get())), FuncType>;
+    auto MakeParallelTransformIterator(InputIteratorType& inIterator, FuncType transformFunction, size_t maxPendingBytes = defaultTransformPendingBytes) -> ParallelTransformIterator<InputIteratorType, decltype(transformFunction(inIterator.Get())), FuncType>;
 }
 }
 
@@ -0,0 +1,140 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     PerformanceProbes.h (utilities)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// stl
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace ell
+{
+namespace utilities
+{
+    /// <summary> Aggregated timing statistics for one performance probe. </summary>
+    struct PerformanceProbeStatistics
+    {
+        std::string name;
+        uint64_t count = 0; // number of recorded measurements
+        double meanMicroseconds = 0; // mean duration over all measurements
+        double p99Microseconds = 0; // 99th percentile over a window of recent measurements
+    };
+
+    namespace detail
+    {
+        extern std::atomic<bool> performanceProbesEnabled;
+    }
+
+    /// <summary> Indicates if performance probes are currently recording. The check is a single
+    /// relaxed atomic load, so instrumented hot paths pay near-zero cost while probes are
+    /// disabled. </summary>
+    ///
+    /// <returns> true if probes are recording. </returns>
+    inline bool ArePerformanceProbesEnabled() { return detail::performanceProbesEnabled.load(std::memory_order_relaxed); }
+
+    /// <summary> Turns performance probe recording on or off (off by default). </summary>
+    ///
+    /// <param name="enable"> true to record measurements, false to make probes no-ops. </param>
+    void EnablePerformanceProbes(bool enable);
+
+    /// <summary> A named timing probe. Declare one as a function-local static at the measurement
+    /// site, so it registers itself once and lives for the duration of the program, then time
+    /// individual invocations with `ScopedPerformanceProbe`. </summary>
+    class PerformanceProbe
+    {
+    public:
+        /// <summary> Creates a probe and registers it with the global probe registry. Probes are
+        /// expected to have static storage duration and are never unregistered. </summary>
+        ///
+        /// <param name="name"> The name the probe reports its statistics under. </param>
+        PerformanceProbe(const std::string& name);
+
+        /// <summary> Records one measurement. </summary>
+        ///
+        /// <param name="elapsedNanoseconds"> The measured duration, in nanoseconds. </param>
+        void Record(int64_t elapsedNanoseconds);
+
+        /// <summary> Gets the statistics accumulated by this probe. The p99 value is estimated
+        /// from a fixed-size window of the most recent measurements. </summary>
+        ///
+        /// <returns> The probe's statistics. </returns>
+        PerformanceProbeStatistics GetStatistics() const;
+
+        /// <summary> Gets the name of this probe. </summary>
+        ///
+        /// <returns> The probe's name. </returns>
+        const std::string& GetName() const { return _name; }
+
+        /// <summary> Discards all recorded measurements. </summary>
+        void Reset();
+
+    private:
+        static constexpr size_t sampleWindowSize = 1024;
+
+        std::string _name;
+        mutable std::mutex _mutex;
+        uint64_t _count = 0;
+        int64_t _totalNanoseconds = 0;
+        std::vector<int64_t> _recentSamples; // ring of recent measurements, for percentile estimation
+        size_t _nextSample = 0;
+    };
+
+    /// <summary> Times the enclosing scope and records the duration in a probe when it exits.
+    /// When probes are disabled, construction and destruction cost one atomic load each. </summary>
+    class ScopedPerformanceProbe
+    {
+    public:
+        /// <summary> Starts timing the enclosing scope. </summary>
+        ///
+        /// <param name="probe"> The probe the measurement is recorded in. </param>
+        ScopedPerformanceProbe(PerformanceProbe& probe)
+            : _probe(probe), _enabled(ArePerformanceProbesEnabled())
+        {
+            if (_enabled)
+            {
+                _start = std::chrono::steady_clock::now();
+            }
+        }
+
+        ~ScopedPerformanceProbe();
+
+        ScopedPerformanceProbe(const ScopedPerformanceProbe&) = delete;
+        ScopedPerformanceProbe& operator=(const ScopedPerformanceProbe&) = delete;
+
+    private:
+        PerformanceProbe& _probe;
+        bool _enabled;
+        std::chrono::steady_clock::time_point _start;
+    };
+
+    /// <summary> Gets the statistics of all registered probes. </summary>
+    ///
+    /// <returns> A vector of per-probe statistics, in registration order. </returns>
+    std::vector<PerformanceProbeStatistics> GetPerformanceProbeStatistics();
+
+    /// <summary> Writes the count, mean and p99 of every registered probe to a stream. </summary>
+    ///
+    /// <param name="stream"> The stream to write the report to. </param>
+    void ReportPerformanceProbes(std::ostream& stream);
+
+    /// <summary> Discards the measurements of all registered probes. </summary>
+    void ResetPerformanceProbes();
+
+    /// <summary> Makes probes periodically write a report to stderr: whenever a measurement is
+    /// recorded and at least `interval` has passed since the previous report. An interval of zero
+    /// (the default) disables periodic reporting. </summary>
+    ///
+    /// <param name="interval"> The minimum time between reports. </param>
+    void SetPerformanceProbeReportInterval(std::chrono::milliseconds interval);
+}
+}
@@ -0,0 +1,86 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     SpscRingBuffer.h (utilities)
+//  Authors:  Lisa Ong
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// stl
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace ell
+{
+namespace utilities
+{
+    /// <summary> A lock-free single-producer/single-consumer ring buffer. One thread may push and a
+    /// second thread may pop concurrently without blocking; neither operation waits for the other.
+    /// When the buffer is full, pushes fail (the producer drops the sample), so the producer is
+    /// never delayed by a slow consumer. </summary>
+    ///
+    /// <typeparam name="ValueType"> Type of the buffered values. </typeparam>
+    template <typename ValueType>
+    class SpscRingBuffer
+    {
+    public:
+        /// <summary> Constructs a ring buffer with a given capacity. </summary>
+        ///
+        /// <param name="capacity"> The maximum number of values the buffer can hold, must be positive. </param>
+        SpscRingBuffer(size_t capacity);
+
+        SpscRingBuffer(const SpscRingBuffer&) = delete;
+
+        SpscRingBuffer& operator=(const SpscRingBuffer&) = delete;
+
+        /// <summary> Attempts to push a value, failing if the buffer is full. May only be called from
+        /// the producer thread. </summary>
+        ///
+        /// <param name="value"> The value to push. </param>
+        ///
+        /// <returns> true if the value was pushed, false if the buffer was full and the value was dropped. </returns>
+        bool TryPush(ValueType value);
+
+        /// <summary> Attempts to pop the oldest value. May only be called from the consumer thread. </summary>
+        ///
+        /// <param name="value"> [out] Receives the popped value. </param>
+        ///
+        /// <returns> true if a value was popped, false if the buffer was empty. </returns>
+        bool TryPop(ValueType& value);
+
+        /// <summary> Attempts to pop the newest available value, discarding any older ones. May only be
+        /// called from the consumer thread. </summary>
+        ///
+        /// <param name="value"> [out] Receives the newest value. </param>
+        ///
+        /// <returns> true if a value was popped, false if the buffer was empty. </returns>
+        bool TryPopLatest(ValueType& value);
+
+        /// <summary> Returns true if the buffer is empty. </summary>
+        ///
+        /// <returns> true if the buffer is empty. </returns>
+        bool IsEmpty() const;
+
+        /// <summary> Returns the maximum number of values the buffer can hold. </summary>
+        ///
+        /// <returns> The capacity. </returns>
+        size_t Capacity() const { return _buffer.size() - 1; }
+
+    private:
+        size_t NextIndex(size_t index) const { return (index + 1) % _buffer.size(); }
+
+        // one slot is kept unoccupied to distinguish a full buffer from an empty one
+        std::vector<ValueType> _buffer;
+
+        // _head indexes the next value to pop and is advanced only by the consumer; _tail indexes the
+        // next slot to fill and is advanced only by the producer
+        std::atomic<size_t> _head;
+        std::atomic<size_t> _tail;
+    };
+}
+}
+
+#include "../tcc/SpscRingBuffer.tcc"
@@ -0,0 +1,103 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ThreadPool.h (utilities)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// stl
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ell
+{
+namespace utilities
+{
+    /// <summary> A work-stealing thread pool. Each worker thread owns a task queue: tasks
+    /// submitted from a worker go to that worker's queue and are popped in LIFO order, while idle
+    /// workers steal from the other end of their neighbors' queues. All parallel code in the
+    /// process is meant to share the instance returned by GetThreadPool(), so nested parallel
+    /// regions reuse the same threads instead of oversubscribing the machine, and submitting a
+    /// task is a queue operation rather than a thread launch. </summary>
+    class ThreadPool
+    {
+    public:
+        /// <summary> Constructs a pool with the given number of worker threads. </summary>
+        ///
+        /// <param name="numThreads"> The number of worker threads, or 0 to use the number of
+        /// hardware threads. </param>
+        ThreadPool(size_t numThreads = 0);
+
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        /// <summary> Submits a task for execution on the pool. </summary>
+        ///
+        /// <param name="function"> The function to run. </param>
+        /// <param name="args"> The arguments to pass to the function. </param>
+        ///
+        /// <returns> A future holding the function's result. </returns>
+        template <typename FunctionType, typename... ArgTypes>
+        auto Submit(FunctionType&& function, ArgTypes&&... args) -> std::future<typename std::result_of<FunctionType(ArgTypes...)>::type>;
+
+        /// <summary> Runs one pending task on the calling thread, if any task is queued. </summary>
+        ///
+        /// <returns> true if a task was executed, false if all queues were empty. </returns>
+        bool TryExecutePendingTask();
+
+        /// <summary> Blocks until the given future is ready, executing pending tasks on the
+        /// calling thread while it waits. Waiting this way is deadlock-free even when called from
+        /// inside a pool task, which makes nested parallel regions safe. </summary>
+        ///
+        /// <param name="future"> The future to wait on. </param>
+        template <typename ResultType>
+        void Wait(std::future<ResultType>& future);
+
+        /// <summary> Gets the number of worker threads in the pool. </summary>
+        ///
+        /// <returns> The number of worker threads. </returns>
+        size_t NumThreads() const { return _workers.size(); }
+
+    private:
+        using Task = std::function<void()>;
+
+        struct TaskQueue
+        {
+            std::deque<Task> tasks;
+            std::mutex mutex;
+        };
+
+        void Enqueue(Task task);
+        void WorkerLoop(size_t workerIndex);
+        bool TryPopOwnTask(size_t workerIndex, Task& task);
+        bool TryStealTask(size_t workerIndex, Task& task);
+
+        std::vector<std::unique_ptr<TaskQueue>> _queues;
+        std::vector<std::thread> _workers;
+        std::mutex _wakeupMutex;
+        std::condition_variable _wakeupCondition;
+        std::atomic<size_t> _submitIndex{ 0 };
+        std::atomic<size_t> _numPendingTasks{ 0 };
+        bool _shuttingDown = false;
+    };
+
+    /// <summary> Gets the process-wide thread pool. </summary>
+    ///
+    /// <returns> A reference to the shared pool, created on first use. </returns>
+    ThreadPool& GetThreadPool();
+}
+}
+
+#include "../tcc/ThreadPool.tcc"
@@ -9,6 +9,7 @@
 #pragma once
 
 // stl
+#include <array>
 #include <initializer_list>
 #include <istream>
 #include <string>
@@ -18,7 +19,9 @@ namespace ell
 {
 namespace utilities
 {
-    /// <summary> A very simple tokenizer suitable for XML and JSON deserialization </summary>
+    /// <summary> A very simple tokenizer suitable for XML and JSON deserialization. The input is
+    /// read into an internal buffer in large blocks and tokens are carved out of the buffer, so the
+    /// stream's read position is generally ahead of the last token returned. </summary>
     class Tokenizer
     {
     public:
@@ -26,8 +29,7 @@ namespace utilities
         ///
         /// <param name=inputStream> Stream to read from </param>
         /// <param name=tokenStartChars> Set of characters that indicate the beginning of a new token. </param>
-        Tokenizer(std::istream& inputStream, const std::string tokenStartChars)
-            : _in(inputStream), _tokenStartChars(tokenStartChars) {}
+        Tokenizer(std::istream& inputStream, const std::string tokenStartChars);
 
         /// <summary> Constructor </summary>
         ///
@@ -49,7 +51,7 @@ namespace utilities
         ///
         /// <param name="token"> The token to match. </param>
         void MatchToken(std::string token);
-        
+
         /// <summary> Matches the next token from the input stream. Throws an exception if token doesn't match. </summary>
         ///
         /// <param name="token"> The token to match. </param>
@@ -64,10 +66,20 @@ namespace utilities
         void PrintTokens();
 
     private:
+        bool FillBuffer();
+        int GetNextCharacter();
+
         std::istream& _in;
         std::string _tokenStartChars;
         std::string _stringDelimiters = "'\"";
 
+        // buffered input: characters are read from the stream in large blocks and tokens are
+        // scanned out of the buffer, instead of pulling one character at a time from the stream
+        std::vector<char> _buffer;
+        size_t _bufferPosition = 0;
+        size_t _bufferLength = 0;
+        std::array<bool, 256> _isStopChar; // true for whitespace and token-start characters
+
         std::vector<std::string> _peekedTokens;
 
         char _currentStringDelimiter = '\0'; // '\0' if we're not currently parsing a string
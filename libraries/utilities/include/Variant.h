@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "AllocationTracker.h"
 #include "Archiver.h"
 #include "Exception.h"
 #include "FunctionUtils.h"
@@ -16,6 +17,7 @@
 
 // stl
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <sstream>
@@ -33,6 +35,60 @@ namespace utilities
     namespace VariantDetail
     {
         class VariantBase;
+        class VariantStorage;
+
+        /// <summary> The size of the inline buffer in VariantStorage. Chosen so that boxed
+        /// scalars, enums, pointers, and strings all fit without touching the heap. </summary>
+        constexpr size_t variantInlineBufferSize = 48;
+
+        /// <summary> Gets a block from the variant slab allocator, for boxed values too large
+        /// for the inline buffer. </summary>
+        void* AllocateVariantBlock(size_t size);
+
+        /// <summary> Returns a block to the variant slab allocator. </summary>
+        void FreeVariantBlock(void* block, size_t size);
+
+        /// <summary> Storage for a Variant's boxed value. Values whose box fits in the inline
+        /// buffer are constructed in place, so the common scalar and string cases never
+        /// allocate; larger boxes come from a slab allocator that recycles fixed-size
+        /// blocks. </summary>
+        class VariantStorage
+        {
+        public:
+            VariantStorage() = default;
+            VariantStorage(const VariantStorage& other);
+            VariantStorage(VariantStorage&& other) noexcept;
+            VariantStorage& operator=(const VariantStorage& other);
+            VariantStorage& operator=(VariantStorage&& other) noexcept;
+            VariantStorage& operator=(std::nullptr_t);
+            ~VariantStorage();
+
+            /// <summary> Destroys the current value (if any) and constructs a new boxed value
+            /// in place. </summary>
+            template <typename DerivedType, typename... Args>
+            DerivedType* Emplace(Args&&... args);
+
+            /// <summary> Destroys the current value, leaving the storage empty. </summary>
+            void Reset();
+
+            VariantBase* operator->() const { return _ptr; }
+            explicit operator bool() const { return _ptr != nullptr; }
+            bool operator==(std::nullptr_t) const { return _ptr == nullptr; }
+            bool operator!=(std::nullptr_t) const { return _ptr != nullptr; }
+
+        private:
+            template <typename DerivedType, typename... Args>
+            DerivedType* EmplaceImpl(std::true_type fitsInline, Args&&... args);
+
+            template <typename DerivedType, typename... Args>
+            DerivedType* EmplaceImpl(std::false_type fitsInline, Args&&... args);
+
+            void MoveFrom(VariantStorage&& other) noexcept;
+            bool IsInline() const { return static_cast<const void*>(_ptr) == static_cast<const void*>(&_buffer); }
+
+            VariantBase* _ptr = nullptr; // points into _buffer when the value is stored inline
+            std::aligned_storage_t<variantInlineBufferSize> _buffer;
+        };
     }
 
     /// <summary> A class that can hold any kind of value and provide a type-safe way to access it </summary>
@@ -63,7 +119,7 @@ namespace utilities
         Variant& operator=(Variant&& other) = default;
 
         /// <summary> Assignment operator from basic (non-variant) types. </summary>
-        template <typename ValueType>
+        template <typename ValueType, typename = std::enable_if_t<!std::is_same<std::decay_t<ValueType>, Variant>::value>>
         Variant& operator=(ValueType&& value);
 
         /// <summary> Gets a string representation of the value. </summary>
@@ -204,13 +260,11 @@ namespace utilities
         template <typename ValueType, typename... Args>
         friend Variant MakeVariant(Args&&... args);
 
-        Variant(std::type_index type, std::unique_ptr<VariantDetail::VariantBase> variantValue);
-
         void ArchiveProperty(const char* name, Archiver& archiver) const;
         void UnarchiveProperty(const char* name, Unarchiver& archiver, SerializationContext& context);
 
         std::type_index _type;
-        std::unique_ptr<VariantDetail::VariantBase> _value;
+        VariantDetail::VariantStorage _value;
     };
 
     /// <summary> Convenience function to create a Variant </summary>
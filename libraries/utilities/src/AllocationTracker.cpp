@@ -0,0 +1,125 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     AllocationTracker.cpp (utilities)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "AllocationTracker.h"
+
+// stl
+#include <algorithm>
+
+namespace ell
+{
+namespace utilities
+{
+    namespace
+    {
+        thread_local AllocationSnapshot threadCounters;
+        thread_local AllocationTag threadTag = AllocationTag::other;
+
+        AllocationCounters& GetCurrentCounters()
+        {
+            return threadCounters.counters[static_cast<size_t>(threadTag)];
+        }
+    }
+
+    namespace detail
+    {
+        std::atomic<bool> allocationTrackingEnabled(false);
+
+        void RecordAllocationImpl(size_t size)
+        {
+            auto& counters = GetCurrentCounters();
+            ++counters.allocationCount;
+            counters.allocatedBytes += size;
+            counters.liveBytes += static_cast<int64_t>(size);
+            counters.highWaterBytes = std::max(counters.highWaterBytes, counters.liveBytes);
+        }
+
+        void RecordDeallocationImpl(size_t size)
+        {
+            GetCurrentCounters().liveBytes -= static_cast<int64_t>(size);
+        }
+    }
+
+    std::string GetAllocationTagName(AllocationTag tag)
+    {
+        switch (tag)
+        {
+            case AllocationTag::archiving:
+                return "archiving";
+            case AllocationTag::modelEvaluation:
+                return "modelEvaluation";
+            case AllocationTag::dataLoading:
+                return "dataLoading";
+            default:
+                return "other";
+        }
+    }
+
+    void EnableAllocationTracking(bool enable)
+    {
+        detail::allocationTrackingEnabled.store(enable, std::memory_order_relaxed);
+    }
+
+    ScopedAllocationTag::ScopedAllocationTag(AllocationTag tag)
+        : _previousTag(threadTag)
+    {
+        threadTag = tag;
+    }
+
+    ScopedAllocationTag::~ScopedAllocationTag()
+    {
+        threadTag = _previousTag;
+    }
+
+    AllocationSnapshot GetAllocationSnapshot()
+    {
+        return threadCounters;
+    }
+
+    AllocationSnapshot GetAllocationDifference(const AllocationSnapshot& before, const AllocationSnapshot& after)
+    {
+        AllocationSnapshot difference;
+        for (size_t i = 0; i < numAllocationTags; ++i)
+        {
+            difference.counters[i].allocationCount = after.counters[i].allocationCount - before.counters[i].allocationCount;
+            difference.counters[i].allocatedBytes = after.counters[i].allocatedBytes - before.counters[i].allocatedBytes;
+            difference.counters[i].liveBytes = after.counters[i].liveBytes - before.counters[i].liveBytes;
+            difference.counters[i].highWaterBytes = after.counters[i].highWaterBytes;
+        }
+        return difference;
+    }
+
+    void ResetAllocationCounters()
+    {
+        threadCounters = AllocationSnapshot();
+    }
+
+    void ReportAllocations(std::ostream& stream, const AllocationSnapshot& snapshot)
+    {
+        stream << "Allocation profile:\n";
+        bool any = false;
+        for (size_t i = 0; i < numAllocationTags; ++i)
+        {
+            const auto& counters = snapshot.counters[i];
+            if (counters.allocationCount == 0)
+            {
+                continue;
+            }
+            any = true;
+            stream << "  " << GetAllocationTagName(static_cast<AllocationTag>(i)) << ": "
+                   << counters.allocationCount << " allocations, "
+                   << counters.allocatedBytes << " bytes, "
+                   << "high water " << counters.highWaterBytes << " bytes\n";
+        }
+        if (!any)
+        {
+            stream << "  no allocations recorded (is tracking enabled?)\n";
+        }
+    }
+}
+}
@@ -0,0 +1,296 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     BinaryArchiver.cpp (utilities)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "BinaryArchiver.h"
+#include "Archiver.h"
+#include "IArchivable.h"
+
+// stl
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace ell
+{
+namespace utilities
+{
+    namespace
+    {
+        // 4-byte signature at the start of every binary archive, followed by the format version
+        const char binarySignature[] = { 'E', 'L', 'L', 'B' };
+        const uint32_t binaryFormatVersion = 1;
+    }
+
+    //
+    // Serialization
+    //
+    BinaryArchiver::BinaryArchiver()
+        : _out(std::cout)
+    {
+        WriteBytes(binarySignature, sizeof(binarySignature));
+        WriteBytes(&binaryFormatVersion, sizeof(binaryFormatVersion));
+    }
+
+    BinaryArchiver::BinaryArchiver(std::ostream& outputStream)
+        : _out(outputStream)
+    {
+        WriteBytes(binarySignature, sizeof(binarySignature));
+        WriteBytes(&binaryFormatVersion, sizeof(binaryFormatVersion));
+    }
+
+    IMPLEMENT_ARCHIVE_VALUE(BinaryArchiver, bool);
+    IMPLEMENT_ARCHIVE_VALUE(BinaryArchiver, char);
+    IMPLEMENT_ARCHIVE_VALUE(BinaryArchiver, short);
+    IMPLEMENT_ARCHIVE_VALUE(BinaryArchiver, int);
+    IMPLEMENT_ARCHIVE_VALUE(BinaryArchiver, size_t);
+    IMPLEMENT_ARCHIVE_VALUE(BinaryArchiver, int64_t);
+#ifdef __APPLE__
+    IMPLEMENT_ARCHIVE_VALUE(BinaryArchiver, uint64_t);
+#endif
+    IMPLEMENT_ARCHIVE_VALUE(BinaryArchiver, float);
+    IMPLEMENT_ARCHIVE_VALUE(BinaryArchiver, double);
+
+    // strings
+    void BinaryArchiver::ArchiveValue(const char* name, const std::string& value)
+    {
+        WriteScalar(name, value);
+    }
+
+    // IArchivable
+    void BinaryArchiver::BeginArchiveObject(const char* name, const IArchivable& value)
+    {
+        if (value.ArchiveAsPrimitive())
+        {
+            return;
+        }
+
+        // fields are stored in archiving order without their names, so the type name is the
+        // only per-object overhead
+        WriteScalar("", GetArchivedTypeName(value));
+    }
+
+    void BinaryArchiver::EndArchiveObject(const char* name, const IArchivable& value)
+    {
+    }
+
+    void BinaryArchiver::EndArchiving()
+    {
+        _out.flush();
+    }
+
+    //
+    // Arrays
+    //
+    IMPLEMENT_ARCHIVE_ARRAY(BinaryArchiver, bool);
+    IMPLEMENT_ARCHIVE_ARRAY(BinaryArchiver, char);
+    IMPLEMENT_ARCHIVE_ARRAY(BinaryArchiver, short);
+    IMPLEMENT_ARCHIVE_ARRAY(BinaryArchiver, int);
+    IMPLEMENT_ARCHIVE_ARRAY(BinaryArchiver, size_t);
+    IMPLEMENT_ARCHIVE_ARRAY(BinaryArchiver, int64_t);
+#ifdef __APPLE__
+    IMPLEMENT_ARCHIVE_ARRAY(BinaryArchiver, uint64_t);
+#endif
+    IMPLEMENT_ARCHIVE_ARRAY(BinaryArchiver, float);
+    IMPLEMENT_ARCHIVE_ARRAY(BinaryArchiver, double);
+
+    void BinaryArchiver::ArchiveArray(const char* name, const std::vector<std::string>& array)
+    {
+        WriteCount(array.size());
+        for (const auto& item : array)
+        {
+            WriteScalar("", item);
+        }
+    }
+
+    void BinaryArchiver::ArchiveArray(const char* name, const std::string& baseTypeName, const std::vector<const IArchivable*>& array)
+    {
+        WriteCount(array.size());
+        for (const auto& item : array)
+        {
+            Archive(*item);
+        }
+    }
+
+    void BinaryArchiver::WriteScalar(const char* name, const std::string& value)
+    {
+        WriteCount(value.size());
+        WriteBytes(value.data(), value.size());
+    }
+
+    void BinaryArchiver::WriteBytes(const void* ptr, size_t numBytes)
+    {
+        _out.write(static_cast<const char*>(ptr), numBytes);
+    }
+
+    void BinaryArchiver::WriteCount(uint64_t count)
+    {
+        WriteBytes(&count, sizeof(count));
+    }
+
+    //
+    // Deserialization
+    //
+    BinaryUnarchiver::BinaryUnarchiver(SerializationContext context)
+        : Unarchiver(std::move(context)), _in(std::cin)
+    {
+        char signature[sizeof(binarySignature)];
+        ReadBytes(signature, sizeof(signature));
+        if (std::memcmp(signature, binarySignature, sizeof(binarySignature)) != 0)
+        {
+            throw InputException(InputExceptionErrors::badStringFormat, "Stream doesn't hold a binary archive");
+        }
+
+        uint32_t version = 0;
+        ReadBytes(&version, sizeof(version));
+        if (version != binaryFormatVersion)
+        {
+            throw InputException(InputExceptionErrors::badStringFormat, "Unsupported binary archive version: " + std::to_string(version));
+        }
+    }
+
+    BinaryUnarchiver::BinaryUnarchiver(std::istream& inputStream, SerializationContext context)
+        : Unarchiver(std::move(context)), _in(inputStream)
+    {
+        char signature[sizeof(binarySignature)];
+        ReadBytes(signature, sizeof(signature));
+        if (std::memcmp(signature, binarySignature, sizeof(binarySignature)) != 0)
+        {
+            throw InputException(InputExceptionErrors::badStringFormat, "Stream doesn't hold a binary archive");
+        }
+
+        uint32_t version = 0;
+        ReadBytes(&version, sizeof(version));
+        if (version != binaryFormatVersion)
+        {
+            throw InputException(InputExceptionErrors::badStringFormat, "Unsupported binary archive version: " + std::to_string(version));
+        }
+    }
+
+    bool BinaryUnarchiver::HasBinarySignature(std::istream& stream)
+    {
+        char signature[sizeof(binarySignature)];
+        auto startPos = stream.tellg();
+        stream.read(signature, sizeof(signature));
+        bool match = stream.gcount() == sizeof(signature) && std::memcmp(signature, binarySignature, sizeof(binarySignature)) == 0;
+        stream.clear();
+        stream.seekg(startPos);
+        return match;
+    }
+
+    IMPLEMENT_UNARCHIVE_VALUE(BinaryUnarchiver, bool);
+    IMPLEMENT_UNARCHIVE_VALUE(BinaryUnarchiver, char);
+    IMPLEMENT_UNARCHIVE_VALUE(BinaryUnarchiver, short);
+    IMPLEMENT_UNARCHIVE_VALUE(BinaryUnarchiver, int);
+    IMPLEMENT_UNARCHIVE_VALUE(BinaryUnarchiver, size_t);
+    IMPLEMENT_UNARCHIVE_VALUE(BinaryUnarchiver, int64_t);
+#ifdef __APPLE__
+    IMPLEMENT_UNARCHIVE_VALUE(BinaryUnarchiver, uint64_t);
+#endif
+    IMPLEMENT_UNARCHIVE_VALUE(BinaryUnarchiver, float);
+    IMPLEMENT_UNARCHIVE_VALUE(BinaryUnarchiver, double);
+
+    // strings
+    void BinaryUnarchiver::UnarchiveValue(const char* name, std::string& value)
+    {
+        ReadScalar(name, value);
+    }
+
+    // IArchivable
+    std::string BinaryUnarchiver::BeginUnarchiveObject(const char* name, const std::string& typeName)
+    {
+        std::string encodedTypeName;
+        ReadScalar("", encodedTypeName);
+        return encodedTypeName;
+    }
+
+    void BinaryUnarchiver::UnarchiveObjectAsPrimitive(const char* name, IArchivable& value)
+    {
+        UnarchiveObject(name, value);
+    }
+
+    void BinaryUnarchiver::EndUnarchiveObject(const char* name, const std::string& typeName)
+    {
+    }
+
+    //
+    // Arrays
+    //
+    IMPLEMENT_UNARCHIVE_ARRAY(BinaryUnarchiver, bool);
+    IMPLEMENT_UNARCHIVE_ARRAY(BinaryUnarchiver, char);
+    IMPLEMENT_UNARCHIVE_ARRAY(BinaryUnarchiver, short);
+    IMPLEMENT_UNARCHIVE_ARRAY(BinaryUnarchiver, int);
+    IMPLEMENT_UNARCHIVE_ARRAY(BinaryUnarchiver, size_t);
+    IMPLEMENT_UNARCHIVE_ARRAY(BinaryUnarchiver, int64_t);
+#ifdef __APPLE__
+    IMPLEMENT_UNARCHIVE_ARRAY(BinaryUnarchiver, uint64_t);
+#endif
+    IMPLEMENT_UNARCHIVE_ARRAY(BinaryUnarchiver, float);
+    IMPLEMENT_UNARCHIVE_ARRAY(BinaryUnarchiver, double);
+
+    void BinaryUnarchiver::UnarchiveArray(const char* name, std::vector<std::string>& array)
+    {
+        ReadArray(name, array);
+    }
+
+    void BinaryUnarchiver::BeginUnarchiveArray(const char* name, const std::string& typeName)
+    {
+        _arrayItemsLeft.push_back(ReadCount());
+    }
+
+    bool BinaryUnarchiver::BeginUnarchiveArrayItem(const std::string& typeName)
+    {
+        return _arrayItemsLeft.back() > 0;
+    }
+
+    void BinaryUnarchiver::EndUnarchiveArrayItem(const std::string& typeName)
+    {
+        --_arrayItemsLeft.back();
+    }
+
+    void BinaryUnarchiver::EndUnarchiveArray(const char* name, const std::string& typeName)
+    {
+        _arrayItemsLeft.pop_back();
+    }
+
+    void BinaryUnarchiver::ReadScalar(const char* name, std::string& value)
+    {
+        auto count = ReadCount();
+        value.resize(count);
+        if (count > 0)
+        {
+            ReadBytes(&value[0], count);
+        }
+    }
+
+    void BinaryUnarchiver::ReadArray(const char* name, std::vector<std::string>& array)
+    {
+        auto count = ReadCount();
+        array.resize(count);
+        for (uint64_t index = 0; index < count; ++index)
+        {
+            ReadScalar("", array[index]);
+        }
+    }
+
+    void BinaryUnarchiver::ReadBytes(void* ptr, size_t numBytes)
+    {
+        _in.read(static_cast<char*>(ptr), numBytes);
+        if (_in.gcount() != static_cast<std::streamsize>(numBytes))
+        {
+            throw InputException(InputExceptionErrors::badStringFormat, "Unexpected end of binary archive");
+        }
+    }
+
+    uint64_t BinaryUnarchiver::ReadCount()
+    {
+        uint64_t count = 0;
+        ReadBytes(&count, sizeof(count));
+        return count;
+    }
+}
+}
@@ -21,39 +21,86 @@ namespace ell
 {
 namespace utilities
 {
+    constexpr size_t CompressedIntegerList::blockSize;
+
     void CompressedIntegerList::Iterator::Next()
     {
-        size_t delta;
-        _iter += _iter_increment;
-        uint8_t first_val = *_iter;
-
-        // chop off top 2 bits --- they encode the # of bytes needed for this delta
-        // 00 = 1 byte, 01 = 2 bytes, 10 = 4 bytes, 11 = 8 bytes
-        int total_bytes = 1 << ((first_val >> 6) & 0x03);
-        assert(total_bytes <= 8);
-        if (total_bytes == 1)
+        ++_index;
+        if (++_bufferPos == _bufferCount && _index < _totalSize)
+        {
+            DecodeNextBlock();
+        }
+    }
+
+    void CompressedIntegerList::Iterator::DecodeNextBlock()
+    {
+        _bufferPos = 0;
+        if (_iter < _end)
         {
-            // first_val &= 0x3f; // this is commented out because we don't need to strip off the top 2 bits of first_val in this case, because they're always zero
-            delta = first_val;
+            // full block: 1 header byte holding the bit width, then blockSize deltas packed
+            // little-endian at that width (blockSize * width bits is always a whole number of bytes)
+            int width = *_iter++;
+            if (width == 64)
+            {
+                // widths above 56 bits round up to whole 8-byte deltas
+                for (size_t i = 0; i < blockSize; ++i)
+                {
+                    size_t delta;
+                    std::memcpy(&delta, _iter + 8 * i, 8);
+                    _value += delta;
+                    _buffer[i] = _value;
+                }
+            }
+            else if (width == 0)
+            {
+                for (size_t i = 0; i < blockSize; ++i)
+                {
+                    _buffer[i] = _value;
+                }
+            }
+            else
+            {
+                // unpack through a 64-bit reservoir; the loop has no per-byte branches on the hot
+                // path, so the compiler can keep it in registers and vectorize the common widths
+                const uint64_t mask = (uint64_t{ 1 } << width) - 1;
+                uint64_t reservoir = 0;
+                int bitsInReservoir = 0;
+                const uint8_t* p = _iter;
+                for (size_t i = 0; i < blockSize; ++i)
+                {
+                    while (bitsInReservoir < width)
+                    {
+                        reservoir |= static_cast<uint64_t>(*p++) << bitsInReservoir;
+                        bitsInReservoir += 8;
+                    }
+                    _value += reservoir & mask;
+                    _buffer[i] = _value;
+                    reservoir >>= width;
+                    bitsInReservoir -= width;
+                }
+            }
+            _iter += blockSize * width / 8;
+            _bufferCount = blockSize;
         }
         else
         {
-            // read in the Next bytes, shift them over to fit the 6 bits of first_val we're using, and Add first_val
-            delta = 0;
-            std::memcpy(&delta, _iter + 1, total_bytes - 1);
-            delta = (delta << 6) | (first_val & 0x3f);
+            // tail: deltas that haven't filled a block yet are kept unpacked
+            const auto& pending = *_pendingDeltas;
+            _bufferCount = pending.size();
+            for (size_t i = 0; i < _bufferCount; ++i)
+            {
+                _value += pending[i];
+                _buffer[i] = _value;
+            }
         }
-
-        _iter_increment = total_bytes;
-        _value += delta;
     }
 
-    CompressedIntegerList::Iterator::Iterator(const uint8_t* iter, const uint8_t* end)
-        : _iter(iter), _end(end), _value(0), _iter_increment(0)
+    CompressedIntegerList::Iterator::Iterator(const uint8_t* iter, const uint8_t* end, const std::vector<size_t>* pendingDeltas, size_t totalSize)
+        : _iter(iter), _end(end), _pendingDeltas(pendingDeltas), _totalSize(totalSize)
     {
-        if (IsValid())
+        if (_totalSize > 0)
         {
-            Next();
+            DecodeNextBlock();
         }
     }
 
@@ -70,6 +117,7 @@ namespace utilities
     void CompressedIntegerList::Reserve(size_t size)
     {
         _data.reserve(size * 2); // guess that, on average, every entry will occupy 2 bytes
+        _pendingDeltas.reserve(blockSize);
     }
 
     size_t CompressedIntegerList::Max() const
@@ -87,9 +135,6 @@ namespace utilities
     {
         assert(value != UINT64_MAX); // special value reserved for initialization
 
-        // calculate the delta from the previous number pushed
-        size_t delta = 0;
-
         // allow the first Append to have a value of zero, but subsequently require an increasing value
         if (_last < UINT64_MAX)
         {
@@ -100,44 +145,79 @@ namespace utilities
             _last = 0;
         }
 
-        // compute the delta
-        delta = value - _last;
+        // buffer the delta from the previous number pushed; packing happens a block at a time
+        _pendingDeltas.push_back(value - _last);
         _last = value;
+        ++_size;
 
-        // figure out how many bits we need to represent this value
-        int log2bytes = 0;
-        if ((delta & 0xffffffffffffffc0) == 0)
+        if (_pendingDeltas.size() == blockSize)
         {
-            log2bytes = 0; // just need 1 byte
+            FlushPendingBlock();
         }
-        else if ((delta & 0xffffffffffffc000) == 0)
+    }
+
+    void CompressedIntegerList::FlushPendingBlock()
+    {
+        assert(_pendingDeltas.size() == blockSize);
+
+        // figure out how many bits the widest delta needs
+        size_t maxDelta = 0;
+        for (size_t delta : _pendingDeltas)
         {
-            log2bytes = 1; // two bytes
+            maxDelta |= delta;
         }
-        else if ((delta & 0xffffffffc0000000) == 0)
+
+        int width = 0;
+        while ((maxDelta >> width) != 0)
         {
-            log2bytes = 2; // four bytes
+            ++width;
         }
-        else
+
+        // the decoder's 64-bit reservoir holds at most 56 payload bits plus a partial byte, so wider
+        // deltas are stored as whole 8-byte values instead
+        if (width > 56)
         {
-            log2bytes = 3; // 8 bytes
+            width = 64;
         }
 
-        int total_bytes = 1 << log2bytes;
-        _data.resize(_data.size() + total_bytes); // make room for new data
-        uint8_t* buf = _data.data() + _data.size() - total_bytes; // get pointer to correct place in array
-        unsigned int mask = log2bytes << 6; // mask == log2(# bytes) shifted to be high-order 2 bits of a byte
-        // splice the data length encoding in as the top 2 bits of the first byte
-        // So, move all high-order bits of the delta over by 2 to make room, Add the mask, and Add the residual low-order bits of the delta
-        size_t write_val = ((delta << 2) & 0xffffffffffffff00) | mask | (delta & 0x3f);
-        std::memcpy(buf, &write_val, total_bytes);
+        size_t numBytes = blockSize * width / 8;
+        _data.push_back(static_cast<uint8_t>(width));
+        size_t offset = _data.size();
+        _data.resize(offset + numBytes);
+        uint8_t* buf = _data.data() + offset;
 
-        ++_size;
+        if (width == 64)
+        {
+            for (size_t i = 0; i < blockSize; ++i)
+            {
+                std::memcpy(buf + 8 * i, &_pendingDeltas[i], 8);
+            }
+        }
+        else if (width > 0)
+        {
+            uint64_t reservoir = 0;
+            int bitsInReservoir = 0;
+            for (size_t delta : _pendingDeltas)
+            {
+                reservoir |= static_cast<uint64_t>(delta) << bitsInReservoir;
+                bitsInReservoir += width;
+                while (bitsInReservoir >= 8)
+                {
+                    *buf++ = static_cast<uint8_t>(reservoir);
+                    reservoir >>= 8;
+                    bitsInReservoir -= 8;
+                }
+            }
+            assert(bitsInReservoir == 0); // blockSize * width is a whole number of bytes
+        }
+
+        _pendingDeltas.clear();
     }
 
     void CompressedIntegerList::Reset()
     {
         _data.resize(0);
+        _pendingDeltas.resize(0);
         _last = UINT64_MAX;
         _size = 0;
     }
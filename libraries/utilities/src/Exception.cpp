@@ -0,0 +1,43 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     Exception.cpp (utilities)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Exception.h"
+
+namespace ell
+{
+namespace utilities
+{
+    const char* GetErrorMessage(InputExceptionErrors errorCode)
+    {
+        switch (errorCode)
+        {
+        case InputExceptionErrors::badStringFormat:
+            return "bad string format";
+        case InputExceptionErrors::badData:
+            return "bad data";
+        case InputExceptionErrors::indexOutOfRange:
+            return "index out of range";
+        case InputExceptionErrors::invalidArgument:
+            return "invalid argument";
+        case InputExceptionErrors::nullReference:
+            return "null reference";
+        case InputExceptionErrors::sizeMismatch:
+            return "operand sizes are incompatible";
+        case InputExceptionErrors::typeMismatch:
+            return "type mismatch";
+        default:
+            return "unknown input error";
+        }
+    }
+
+    void ThrowInputException(InputExceptionErrors errorCode)
+    {
+        throw InputException(errorCode, GetErrorMessage(errorCode));
+    }
+}
+}
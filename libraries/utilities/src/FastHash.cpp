@@ -0,0 +1,217 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     FastHash.cpp (utilities)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "FastHash.h"
+#include "JsonArchiver.h"
+
+// stl
+#include <cstring>
+#include <ostream>
+#include <streambuf>
+
+namespace ell
+{
+namespace utilities
+{
+    namespace
+    {
+        // the xxHash64 constants
+        constexpr uint64_t prime1 = 11400714785074694791ULL;
+        constexpr uint64_t prime2 = 14029467366897019727ULL;
+        constexpr uint64_t prime3 = 1609587929392839161ULL;
+        constexpr uint64_t prime4 = 9650029242287828579ULL;
+        constexpr uint64_t prime5 = 2870177450012600261ULL;
+
+        inline uint64_t RotateLeft(uint64_t value, int count)
+        {
+            return (value << count) | (value >> (64 - count));
+        }
+
+        inline uint64_t Read64(const unsigned char* data)
+        {
+            uint64_t value;
+            std::memcpy(&value, data, sizeof(value));
+            return value;
+        }
+
+        inline uint32_t Read32(const unsigned char* data)
+        {
+            uint32_t value;
+            std::memcpy(&value, data, sizeof(value));
+            return value;
+        }
+
+        inline uint64_t Round(uint64_t accumulator, uint64_t lane)
+        {
+            accumulator += lane * prime2;
+            accumulator = RotateLeft(accumulator, 31);
+            return accumulator * prime1;
+        }
+
+        inline uint64_t MergeRound(uint64_t hash, uint64_t accumulator)
+        {
+            hash ^= Round(0, accumulator);
+            return hash * prime1 + prime4;
+        }
+    }
+
+    FastHash::FastHash(uint64_t seed)
+        : _seed(seed)
+    {
+        _accumulators[0] = seed + prime1 + prime2;
+        _accumulators[1] = seed + prime2;
+        _accumulators[2] = seed;
+        _accumulators[3] = seed - prime1;
+    }
+
+    void FastHash::ProcessStripe(const unsigned char* stripe)
+    {
+        _accumulators[0] = Round(_accumulators[0], Read64(stripe));
+        _accumulators[1] = Round(_accumulators[1], Read64(stripe + 8));
+        _accumulators[2] = Round(_accumulators[2], Read64(stripe + 16));
+        _accumulators[3] = Round(_accumulators[3], Read64(stripe + 24));
+    }
+
+    void FastHash::Update(const void* data, size_t size)
+    {
+        auto current = static_cast<const unsigned char*>(data);
+        _totalBytes += size;
+
+        // top up a partially filled buffer first
+        if (_bufferedBytes > 0)
+        {
+            size_t needed = sizeof(_buffer) - _bufferedBytes;
+            size_t taken = size < needed ? size : needed;
+            std::memcpy(_buffer + _bufferedBytes, current, taken);
+            _bufferedBytes += taken;
+            current += taken;
+            size -= taken;
+            if (_bufferedBytes == sizeof(_buffer))
+            {
+                ProcessStripe(_buffer);
+                _bufferedBytes = 0;
+            }
+        }
+
+        // process whole 32-byte stripes straight from the input
+        while (size >= sizeof(_buffer))
+        {
+            ProcessStripe(current);
+            current += sizeof(_buffer);
+            size -= sizeof(_buffer);
+        }
+
+        // buffer the remainder
+        if (size > 0)
+        {
+            std::memcpy(_buffer, current, size);
+            _bufferedBytes = size;
+        }
+    }
+
+    uint64_t FastHash::Digest() const
+    {
+        uint64_t hash;
+        if (_totalBytes >= sizeof(_buffer))
+        {
+            hash = RotateLeft(_accumulators[0], 1) + RotateLeft(_accumulators[1], 7) + RotateLeft(_accumulators[2], 12) + RotateLeft(_accumulators[3], 18);
+            hash = MergeRound(hash, _accumulators[0]);
+            hash = MergeRound(hash, _accumulators[1]);
+            hash = MergeRound(hash, _accumulators[2]);
+            hash = MergeRound(hash, _accumulators[3]);
+        }
+        else
+        {
+            hash = _seed + prime5;
+        }
+        hash += _totalBytes;
+
+        // fold in the buffered tail
+        const unsigned char* current = _buffer;
+        size_t remaining = _bufferedBytes;
+        while (remaining >= 8)
+        {
+            hash ^= Round(0, Read64(current));
+            hash = RotateLeft(hash, 27) * prime1 + prime4;
+            current += 8;
+            remaining -= 8;
+        }
+        if (remaining >= 4)
+        {
+            hash ^= Read32(current) * prime1;
+            hash = RotateLeft(hash, 23) * prime2 + prime3;
+            current += 4;
+            remaining -= 4;
+        }
+        while (remaining > 0)
+        {
+            hash ^= *current * prime5;
+            hash = RotateLeft(hash, 11) * prime1;
+            ++current;
+            --remaining;
+        }
+
+        // final avalanche
+        hash ^= hash >> 33;
+        hash *= prime2;
+        hash ^= hash >> 29;
+        hash *= prime3;
+        hash ^= hash >> 32;
+        return hash;
+    }
+
+    uint64_t FastHash::Hash(const void* data, size_t size, uint64_t seed)
+    {
+        FastHash hasher(seed);
+        hasher.Update(data, size);
+        return hasher.Digest();
+    }
+
+    namespace
+    {
+        // a streambuf that feeds everything written to it into a hasher
+        class HashingStreambuf : public std::streambuf
+        {
+        public:
+            HashingStreambuf(FastHash& hash)
+                : _hash(hash) {}
+
+        protected:
+            virtual int overflow(int character) override
+            {
+                if (character != traits_type::eof())
+                {
+                    char byte = static_cast<char>(character);
+                    _hash.Update(&byte, 1);
+                }
+                return character;
+            }
+
+            virtual std::streamsize xsputn(const char* data, std::streamsize size) override
+            {
+                _hash.Update(data, static_cast<size_t>(size));
+                return size;
+            }
+
+        private:
+            FastHash& _hash;
+        };
+    }
+
+    uint64_t HashArchivedObject(const IArchivable& object, uint64_t seed)
+    {
+        FastHash hash(seed);
+        HashingStreambuf buffer(hash);
+        std::ostream stream(&buffer);
+        JsonArchiver archiver(stream);
+        archiver << object;
+        stream.flush();
+        return hash.Digest();
+    }
+}
+}
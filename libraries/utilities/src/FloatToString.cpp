@@ -0,0 +1,200 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     FloatToString.cpp (utilities)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "FloatToString.h"
+
+// stl
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+namespace ell
+{
+namespace utilities
+{
+    namespace
+    {
+        const double powersOfTen[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17 };
+
+        // Writes the decimal digits of a nonnegative integer, returning the number of characters written
+        size_t WriteDigits(char* buffer, uint64_t value)
+        {
+            char temp[24];
+            size_t numDigits = 0;
+            do
+            {
+                temp[numDigits++] = static_cast<char>('0' + (value % 10));
+                value /= 10;
+            } while (value != 0);
+
+            for (size_t index = 0; index < numDigits; ++index)
+            {
+                buffer[index] = temp[numDigits - 1 - index];
+            }
+            return numDigits;
+        }
+    }
+
+    size_t FormatDouble(char* buffer, double value, int precision)
+    {
+        if (precision < 1)
+        {
+            precision = 1;
+        }
+        else if (precision > 17)
+        {
+            precision = 17;
+        }
+
+        if (std::isnan(value))
+        {
+            std::memcpy(buffer, "nan", 3);
+            return 3;
+        }
+
+        char* out = buffer;
+        if (std::signbit(value))
+        {
+            *out++ = '-';
+            value = -value;
+        }
+
+        if (std::isinf(value))
+        {
+            std::memcpy(out, "inf", 3);
+            return (out - buffer) + 3;
+        }
+
+        if (value == 0)
+        {
+            *out++ = '0';
+            return out - buffer;
+        }
+
+        // decimal exponent of the leading digit
+        int e10 = static_cast<int>(std::floor(std::log10(value)));
+
+        // the integer digit-generation path scales the value by a power of ten; for extreme
+        // exponents and subnormals that scaling loses accuracy, so defer to snprintf there
+        if (e10 > 290 || e10 < -290)
+        {
+            auto length = std::snprintf(out, maxDoubleStringLength - (out - buffer), "%.*g", precision, value);
+            return (out - buffer) + length;
+        }
+
+        // scale the value so it has exactly `precision` integer digits, then round to an integer
+        int scale = precision - 1 - e10;
+        double scaled = (scale >= 0) ? ((scale < 18) ? value * powersOfTen[scale] : value * std::pow(10.0, scale))
+                                     : ((scale > -18) ? value / powersOfTen[-scale] : value / std::pow(10.0, -scale));
+        auto digits = static_cast<uint64_t>(std::llround(scaled));
+
+        // rounding may have carried into an extra digit (e.g. 9.99 -> 10.0), or log10 may
+        // have overestimated the exponent by one; correct the digit count either way
+        uint64_t limit = 1;
+        for (int index = 0; index < precision; ++index)
+        {
+            limit *= 10;
+        }
+        if (digits >= limit)
+        {
+            digits /= 10;
+            ++e10;
+        }
+        else if (digits < limit / 10 && digits != 0)
+        {
+            digits *= 10;
+            auto rescaled = static_cast<uint64_t>(std::llround(scaled * 10));
+            digits = (rescaled < limit) ? rescaled : digits;
+            --e10;
+        }
+
+        // strip trailing zeros ("%g" style)
+        int numDigits = precision;
+        while (numDigits > 1 && digits % 10 == 0)
+        {
+            digits /= 10;
+            --numDigits;
+        }
+
+        char digitBuffer[24];
+        WriteDigits(digitBuffer, digits);
+
+        if (e10 >= -4 && e10 < precision)
+        {
+            // fixed notation
+            if (e10 >= 0)
+            {
+                int intDigits = e10 + 1;
+                if (intDigits >= numDigits)
+                {
+                    std::memcpy(out, digitBuffer, numDigits);
+                    out += numDigits;
+                    for (int index = numDigits; index < intDigits; ++index)
+                    {
+                        *out++ = '0';
+                    }
+                }
+                else
+                {
+                    std::memcpy(out, digitBuffer, intDigits);
+                    out += intDigits;
+                    *out++ = '.';
+                    std::memcpy(out, digitBuffer + intDigits, numDigits - intDigits);
+                    out += numDigits - intDigits;
+                }
+            }
+            else
+            {
+                *out++ = '0';
+                *out++ = '.';
+                for (int index = -1; index > e10; --index)
+                {
+                    *out++ = '0';
+                }
+                std::memcpy(out, digitBuffer, numDigits);
+                out += numDigits;
+            }
+        }
+        else
+        {
+            // scientific notation: d.ddde±XX
+            *out++ = digitBuffer[0];
+            if (numDigits > 1)
+            {
+                *out++ = '.';
+                std::memcpy(out, digitBuffer + 1, numDigits - 1);
+                out += numDigits - 1;
+            }
+            *out++ = 'e';
+            if (e10 < 0)
+            {
+                *out++ = '-';
+                e10 = -e10;
+            }
+            else
+            {
+                *out++ = '+';
+            }
+            if (e10 < 10)
+            {
+                *out++ = '0';
+            }
+            out += WriteDigits(out, static_cast<uint64_t>(e10));
+        }
+
+        return out - buffer;
+    }
+
+    void AppendDouble(std::string& out, double value, int precision)
+    {
+        char buffer[maxDoubleStringLength];
+        out.append(buffer, FormatDouble(buffer, value, precision));
+    }
+}
+}
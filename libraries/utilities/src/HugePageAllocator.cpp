@@ -0,0 +1,79 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     HugePageAllocator.cpp (utilities)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "HugePageAllocator.h"
+
+// stl
+#include <cstdint>
+#include <new>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace ell
+{
+namespace utilities
+{
+    namespace
+    {
+        size_t RoundUpToHugePageMultiple(size_t size)
+        {
+            return (size + hugePageSize - 1) / hugePageSize * hugePageSize;
+        }
+    }
+
+#if defined(__linux__)
+    void* HugePageAllocate(size_t size)
+    {
+        // Over-map by one huge page so we can return a huge-page-aligned pointer, then trim the
+        // unaligned head and tail back off. The kernel can only collapse a range into huge pages
+        // if it is aligned, so the padding is what makes the madvise hint effective.
+        size_t length = RoundUpToHugePageMultiple(size);
+        void* mapping = mmap(nullptr, length + hugePageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (mapping == MAP_FAILED)
+        {
+            throw std::bad_alloc();
+        }
+
+        auto base = reinterpret_cast<uintptr_t>(mapping);
+        auto aligned = RoundUpToHugePageMultiple(base);
+        if (aligned != base)
+        {
+            munmap(mapping, aligned - base);
+        }
+        size_t tail = hugePageSize - (aligned - base);
+        if (tail != 0)
+        {
+            munmap(reinterpret_cast<void*>(aligned + length), tail);
+        }
+
+#if defined(MADV_HUGEPAGE)
+        // a hint - if transparent huge pages are disabled we still run, just on ordinary pages
+        madvise(reinterpret_cast<void*>(aligned), length, MADV_HUGEPAGE);
+#endif
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    void HugePageDeallocate(void* ptr, size_t size)
+    {
+        munmap(ptr, RoundUpToHugePageMultiple(size));
+    }
+#else
+    void* HugePageAllocate(size_t size)
+    {
+        return ::operator new(size);
+    }
+
+    void HugePageDeallocate(void* ptr, size_t size)
+    {
+        ::operator delete(ptr);
+    }
+#endif
+}
+}
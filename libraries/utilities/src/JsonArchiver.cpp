@@ -10,6 +10,7 @@
 #include "Archiver.h"
 #include "IArchivable.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cctype>
 #include <iostream>
@@ -418,5 +419,91 @@ namespace utilities
     {
         return str;
     }
+
+    static const char base64Alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    std::string JsonUtilities::EncodeBase64(const uint8_t* data, size_t size)
+    {
+        std::string result;
+        result.reserve(4 * ((size + 2) / 3));
+        size_t index = 0;
+        for (; index + 3 <= size; index += 3)
+        {
+            uint32_t group = (static_cast<uint32_t>(data[index]) << 16) | (static_cast<uint32_t>(data[index + 1]) << 8) | data[index + 2];
+            result.push_back(base64Alphabet[(group >> 18) & 0x3f]);
+            result.push_back(base64Alphabet[(group >> 12) & 0x3f]);
+            result.push_back(base64Alphabet[(group >> 6) & 0x3f]);
+            result.push_back(base64Alphabet[group & 0x3f]);
+        }
+
+        auto remainder = size - index;
+        if (remainder == 1)
+        {
+            uint32_t group = static_cast<uint32_t>(data[index]) << 16;
+            result.push_back(base64Alphabet[(group >> 18) & 0x3f]);
+            result.push_back(base64Alphabet[(group >> 12) & 0x3f]);
+            result.push_back('=');
+            result.push_back('=');
+        }
+        else if (remainder == 2)
+        {
+            uint32_t group = (static_cast<uint32_t>(data[index]) << 16) | (static_cast<uint32_t>(data[index + 1]) << 8);
+            result.push_back(base64Alphabet[(group >> 18) & 0x3f]);
+            result.push_back(base64Alphabet[(group >> 12) & 0x3f]);
+            result.push_back(base64Alphabet[(group >> 6) & 0x3f]);
+            result.push_back('=');
+        }
+        return result;
+    }
+
+    std::vector<uint8_t> JsonUtilities::DecodeBase64(const std::string& text)
+    {
+        if (text.size() % 4 != 0)
+        {
+            throw InputException(InputExceptionErrors::badStringFormat, "Base64 text length must be a multiple of 4");
+        }
+
+        int decodeTable[256];
+        std::fill(std::begin(decodeTable), std::end(decodeTable), -1);
+        for (int value = 0; value < 64; ++value)
+        {
+            decodeTable[static_cast<unsigned char>(base64Alphabet[value])] = value;
+        }
+
+        std::vector<uint8_t> result;
+        result.reserve(3 * (text.size() / 4));
+        for (size_t index = 0; index < text.size(); index += 4)
+        {
+            uint32_t group = 0;
+            int numPadding = 0;
+            for (size_t offset = 0; offset < 4; ++offset)
+            {
+                auto ch = static_cast<unsigned char>(text[index + offset]);
+                if (ch == '=' && index + 4 == text.size() && offset >= 2)
+                {
+                    ++numPadding;
+                    group <<= 6;
+                    continue;
+                }
+                auto value = decodeTable[ch];
+                if (value < 0 || numPadding > 0)
+                {
+                    throw InputException(InputExceptionErrors::badStringFormat, "Invalid base64 character");
+                }
+                group = (group << 6) | static_cast<uint32_t>(value);
+            }
+
+            result.push_back(static_cast<uint8_t>((group >> 16) & 0xff));
+            if (numPadding < 2)
+            {
+                result.push_back(static_cast<uint8_t>((group >> 8) & 0xff));
+            }
+            if (numPadding < 1)
+            {
+                result.push_back(static_cast<uint8_t>(group & 0xff));
+            }
+        }
+        return result;
+    }
 }
 }
@@ -0,0 +1,85 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     MemoryArena.cpp (utilities)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "MemoryArena.h"
+#include "Exception.h"
+
+// stl
+#include <cstdint>
+
+namespace ell
+{
+namespace utilities
+{
+    MemoryArena::MemoryArena(size_t blockSize)
+        : _blockSize(blockSize)
+    {
+        if (blockSize == 0)
+        {
+            throw InputException(InputExceptionErrors::invalidArgument, "arena block size must be positive");
+        }
+    }
+
+    void* MemoryArena::Allocate(size_t size, size_t alignment)
+    {
+        if (alignment == 0 || (alignment & (alignment - 1)) != 0)
+        {
+            throw InputException(InputExceptionErrors::invalidArgument, "alignment must be a power of two");
+        }
+
+        if (_blocks.empty())
+        {
+            AddBlock(size + alignment);
+        }
+
+        auto* block = &_blocks.back();
+        auto address = reinterpret_cast<uintptr_t>(block->data.get()) + block->used;
+        auto alignedAddress = (address + alignment - 1) & ~(uintptr_t)(alignment - 1);
+        auto padding = alignedAddress - address;
+
+        if (block->used + padding + size > block->size)
+        {
+            // doesn't fit in the current block - start a new one (the new block comes from
+            // operator new, so its start is suitably aligned for any ordinary type)
+            block = &AddBlock(size + alignment);
+            address = reinterpret_cast<uintptr_t>(block->data.get());
+            alignedAddress = (address + alignment - 1) & ~(uintptr_t)(alignment - 1);
+            padding = alignedAddress - address;
+        }
+
+        block->used += padding + size;
+        _allocatedSize += size;
+        return reinterpret_cast<void*>(alignedAddress);
+    }
+
+    void MemoryArena::Clear()
+    {
+        _blocks.clear();
+        _allocatedSize = 0;
+    }
+
+    size_t MemoryArena::GetCapacity() const
+    {
+        size_t capacity = 0;
+        for (const auto& block : _blocks)
+        {
+            capacity += block.size;
+        }
+        return capacity;
+    }
+
+    MemoryArena::Block& MemoryArena::AddBlock(size_t minimumSize)
+    {
+        Block block;
+        block.size = minimumSize > _blockSize ? minimumSize : _blockSize;
+        block.data = std::make_unique<unsigned char[]>(block.size);
+        _blocks.push_back(std::move(block));
+        return _blocks.back();
+    }
+}
+}
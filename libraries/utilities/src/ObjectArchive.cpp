@@ -43,6 +43,7 @@ namespace utilities
     {
         if (HasValue())
         {
+            MaterializeValue();
             return _value.ToString();
         }
         else
@@ -51,6 +52,24 @@ namespace utilities
         }
     }
 
+    void ObjectArchive::SetValueFactory(const std::string& typeName, std::function<Variant()> factory)
+    {
+        _typeName = typeName;
+        _value = Variant();
+        _valueFactory = std::move(factory);
+    }
+
+    void ObjectArchive::MaterializeValue() const
+    {
+        if (_value.IsEmpty() && _valueFactory != nullptr)
+        {
+            // materializing is logically const: callers observe the same value either way
+            auto self = const_cast<ObjectArchive*>(this);
+            self->_value = _valueFactory();
+            self->_valueFactory = nullptr;
+        }
+    }
+
     const ObjectArchive& ObjectArchive::operator[](const std::string& propertyName) const
     {
         auto iter = _properties.find(propertyName);
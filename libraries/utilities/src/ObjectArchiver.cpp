@@ -7,6 +7,7 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "ObjectArchiver.h"
+#include "AllocationTracker.h"
 #include "Archiver.h"
 #include "IArchivable.h"
 
@@ -63,6 +64,7 @@ namespace utilities
 
     void ObjectArchiver::ArchiveObject(const char* name, const IArchivable& value)
     {
+        ScopedAllocationTag tag(AllocationTag::archiving);
         if (std::string{ "" } == name)
         {
             Archiver::ArchiveObject(name, value);
@@ -141,6 +143,7 @@ namespace utilities
     // IArchivable
     void ObjectArchiver::UnarchiveObject(const char* name, IArchivable& value)
     {
+        ScopedAllocationTag tag(AllocationTag::archiving);
         if (std::string{ "" } == name)
         {
             Unarchiver::UnarchiveObject(name, value);
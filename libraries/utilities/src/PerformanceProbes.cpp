@@ -0,0 +1,205 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     PerformanceProbes.cpp (utilities)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PerformanceProbes.h"
+
+// stl
+#include <algorithm>
+#include <iostream>
+
+namespace ell
+{
+namespace utilities
+{
+    namespace detail
+    {
+        std::atomic<bool> performanceProbesEnabled{ false };
+    }
+
+    namespace
+    {
+        // The registry outlives the probes that register with it: probes have static storage
+        // duration, and construct-on-first-use avoids initialization-order problems between
+        // translation units.
+        struct ProbeRegistry
+        {
+            std::mutex mutex;
+            std::vector<PerformanceProbe*> probes;
+        };
+
+        ProbeRegistry& GetProbeRegistry()
+        {
+            static ProbeRegistry registry;
+            return registry;
+        }
+
+        std::atomic<int64_t> reportIntervalMilliseconds{ 0 };
+        std::atomic<int64_t> lastReportTimeMilliseconds{ 0 };
+
+        int64_t SteadyNowMilliseconds()
+        {
+            return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        // Writes a report to stderr if the report interval has elapsed. Compare-and-swap on the
+        // last report time makes sure only one thread emits each report.
+        void MaybeReportPerformanceProbes()
+        {
+            auto interval = reportIntervalMilliseconds.load(std::memory_order_relaxed);
+            if (interval == 0)
+            {
+                return;
+            }
+
+            auto now = SteadyNowMilliseconds();
+            auto lastReport = lastReportTimeMilliseconds.load(std::memory_order_relaxed);
+            if (now - lastReport >= interval && lastReportTimeMilliseconds.compare_exchange_strong(lastReport, now))
+            {
+                ReportPerformanceProbes(std::cerr);
+            }
+        }
+    }
+
+    //
+    // PerformanceProbe
+    //
+    PerformanceProbe::PerformanceProbe(const std::string& name)
+        : _name(name)
+    {
+        _recentSamples.reserve(sampleWindowSize);
+        auto& registry = GetProbeRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.probes.push_back(this);
+    }
+
+    void PerformanceProbe::Record(int64_t elapsedNanoseconds)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        ++_count;
+        _totalNanoseconds += elapsedNanoseconds;
+        if (_recentSamples.size() < sampleWindowSize)
+        {
+            _recentSamples.push_back(elapsedNanoseconds);
+        }
+        else
+        {
+            _recentSamples[_nextSample] = elapsedNanoseconds;
+        }
+        _nextSample = (_nextSample + 1) % sampleWindowSize;
+    }
+
+    PerformanceProbeStatistics PerformanceProbe::GetStatistics() const
+    {
+        PerformanceProbeStatistics statistics;
+        statistics.name = _name;
+
+        std::vector<int64_t> samples;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            statistics.count = _count;
+            if (_count > 0)
+            {
+                statistics.meanMicroseconds = (_totalNanoseconds / 1.0e3) / _count;
+            }
+            samples = _recentSamples;
+        }
+
+        if (!samples.empty())
+        {
+            auto p99Index = (samples.size() * 99) / 100;
+            if (p99Index >= samples.size())
+            {
+                p99Index = samples.size() - 1;
+            }
+            std::nth_element(samples.begin(), samples.begin() + p99Index, samples.end());
+            statistics.p99Microseconds = samples[p99Index] / 1.0e3;
+        }
+        return statistics;
+    }
+
+    void PerformanceProbe::Reset()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _count = 0;
+        _totalNanoseconds = 0;
+        _recentSamples.clear();
+        _nextSample = 0;
+    }
+
+    //
+    // ScopedPerformanceProbe
+    //
+    ScopedPerformanceProbe::~ScopedPerformanceProbe()
+    {
+        if (_enabled)
+        {
+            auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _start).count();
+            _probe.Record(elapsed);
+            MaybeReportPerformanceProbes();
+        }
+    }
+
+    //
+    // Global probe functions
+    //
+    void EnablePerformanceProbes(bool enable)
+    {
+        detail::performanceProbesEnabled.store(enable, std::memory_order_relaxed);
+    }
+
+    std::vector<PerformanceProbeStatistics> GetPerformanceProbeStatistics()
+    {
+        auto& registry = GetProbeRegistry();
+        std::vector<PerformanceProbe*> probes;
+        {
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            probes = registry.probes;
+        }
+
+        std::vector<PerformanceProbeStatistics> statistics;
+        statistics.reserve(probes.size());
+        for (auto probe : probes)
+        {
+            statistics.push_back(probe->GetStatistics());
+        }
+        return statistics;
+    }
+
+    void ReportPerformanceProbes(std::ostream& stream)
+    {
+        stream << "performance probes:\n";
+        for (const auto& statistics : GetPerformanceProbeStatistics())
+        {
+            stream << "  " << statistics.name << ": count " << statistics.count
+                   << ", mean " << statistics.meanMicroseconds << " us"
+                   << ", p99 " << statistics.p99Microseconds << " us\n";
+        }
+    }
+
+    void ResetPerformanceProbes()
+    {
+        auto& registry = GetProbeRegistry();
+        std::vector<PerformanceProbe*> probes;
+        {
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            probes = registry.probes;
+        }
+
+        for (auto probe : probes)
+        {
+            probe->Reset();
+        }
+    }
+
+    void SetPerformanceProbeReportInterval(std::chrono::milliseconds interval)
+    {
+        reportIntervalMilliseconds.store(interval.count(), std::memory_order_relaxed);
+        lastReportTimeMilliseconds.store(SteadyNowMilliseconds(), std::memory_order_relaxed);
+    }
+}
+}
@@ -0,0 +1,173 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ThreadPool.cpp (utilities)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "ThreadPool.h"
+
+#define DEFAULT_NUM_THREADS 8
+
+namespace ell
+{
+namespace utilities
+{
+    namespace
+    {
+        // identifies the pool (if any) the current thread belongs to, so tasks submitted from
+        // inside a pool task go to the submitting worker's own queue
+        thread_local const ThreadPool* t_ownerPool = nullptr;
+        thread_local size_t t_workerIndex = 0;
+    }
+
+    ThreadPool::ThreadPool(size_t numThreads)
+    {
+        if (numThreads == 0)
+        {
+            numThreads = std::thread::hardware_concurrency();
+            if (numThreads == 0) // if std::thread::hardware_concurrency isn't implemented
+            {
+                numThreads = DEFAULT_NUM_THREADS;
+            }
+        }
+
+        for (size_t workerIndex = 0; workerIndex < numThreads; ++workerIndex)
+        {
+            _queues.push_back(std::make_unique<TaskQueue>());
+        }
+        for (size_t workerIndex = 0; workerIndex < numThreads; ++workerIndex)
+        {
+            _workers.emplace_back([this, workerIndex]() { WorkerLoop(workerIndex); });
+        }
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_wakeupMutex);
+            _shuttingDown = true;
+        }
+        _wakeupCondition.notify_all();
+        for (auto& worker : _workers)
+        {
+            worker.join();
+        }
+    }
+
+    bool ThreadPool::TryExecutePendingTask()
+    {
+        Task task;
+        bool found = false;
+        if (t_ownerPool == this)
+        {
+            found = TryPopOwnTask(t_workerIndex, task) || TryStealTask(t_workerIndex, task);
+        }
+        else
+        {
+            found = TryStealTask(_queues.size(), task); // not a worker: steal from any queue
+        }
+
+        if (!found)
+        {
+            return false;
+        }
+        --_numPendingTasks;
+        task();
+        return true;
+    }
+
+    void ThreadPool::Enqueue(Task task)
+    {
+        size_t queueIndex;
+        if (t_ownerPool == this)
+        {
+            queueIndex = t_workerIndex; // nested submission: stay on this worker's queue
+        }
+        else
+        {
+            queueIndex = _submitIndex++ % _queues.size();
+        }
+
+        {
+            std::lock_guard<std::mutex> queueLock(_queues[queueIndex]->mutex);
+            _queues[queueIndex]->tasks.push_back(std::move(task));
+        }
+        {
+            // taking the wakeup mutex here prevents a worker from missing the notification
+            // between checking for work and going to sleep
+            std::lock_guard<std::mutex> lock(_wakeupMutex);
+            ++_numPendingTasks;
+        }
+        _wakeupCondition.notify_one();
+    }
+
+    void ThreadPool::WorkerLoop(size_t workerIndex)
+    {
+        t_ownerPool = this;
+        t_workerIndex = workerIndex;
+
+        for (;;)
+        {
+            Task task;
+            if (TryPopOwnTask(workerIndex, task) || TryStealTask(workerIndex, task))
+            {
+                --_numPendingTasks;
+                task();
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(_wakeupMutex);
+            _wakeupCondition.wait(lock, [this]() { return _shuttingDown || _numPendingTasks > 0; });
+            if (_shuttingDown && _numPendingTasks == 0)
+            {
+                return;
+            }
+        }
+    }
+
+    bool ThreadPool::TryPopOwnTask(size_t workerIndex, Task& task)
+    {
+        auto& queue = *_queues[workerIndex];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.tasks.empty())
+        {
+            return false;
+        }
+        // pop our own work newest-first, for locality
+        task = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+        return true;
+    }
+
+    bool ThreadPool::TryStealTask(size_t workerIndex, Task& task)
+    {
+        auto numQueues = _queues.size();
+        for (size_t offset = 1; offset <= numQueues; ++offset)
+        {
+            auto victimIndex = (workerIndex + offset) % numQueues;
+            if (victimIndex == workerIndex)
+            {
+                continue;
+            }
+            auto& queue = *_queues[victimIndex];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (!queue.tasks.empty())
+            {
+                // steal the victim's work oldest-first, opposite the end the victim pops from
+                task = std::move(queue.tasks.front());
+                queue.tasks.pop_front();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    ThreadPool& GetThreadPool()
+    {
+        static ThreadPool pool;
+        return pool;
+    }
+}
+}
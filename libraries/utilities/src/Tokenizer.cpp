@@ -12,16 +12,47 @@
 // stl
 #include <cassert>
 #include <cctype>
+#include <cstring>
 #include <iostream>
-#include <sstream>
 
 namespace ell
 {
 namespace utilities
 {
+    namespace
+    {
+        const size_t bufferCapacity = 64 * 1024;
+    }
+
     //
     // Tokenizer
     //
+    Tokenizer::Tokenizer(std::istream& inputStream, const std::string tokenStartChars)
+        : _in(inputStream), _tokenStartChars(tokenStartChars), _buffer(bufferCapacity)
+    {
+        for (int ch = 0; ch < 256; ++ch)
+        {
+            _isStopChar[ch] = std::isspace(ch) != 0 || _tokenStartChars.find(static_cast<char>(ch)) != std::string::npos;
+        }
+    }
+
+    bool Tokenizer::FillBuffer()
+    {
+        _in.read(_buffer.data(), static_cast<std::streamsize>(_buffer.size()));
+        _bufferLength = static_cast<size_t>(_in.gcount());
+        _bufferPosition = 0;
+        return _bufferLength > 0;
+    }
+
+    int Tokenizer::GetNextCharacter()
+    {
+        if (_bufferPosition >= _bufferLength && !FillBuffer())
+        {
+            return EOF;
+        }
+        return static_cast<unsigned char>(_buffer[_bufferPosition++]);
+    }
+
     std::string Tokenizer::ReadNextToken()
     {
         const char escapeChar = '\\';
@@ -32,28 +63,28 @@ namespace utilities
             _peekedTokens.pop_back();
             return temp;
         }
-        std::stringstream tokenStream;
+        std::string token;
 
         // eat whitespace and add first char
-        while (_in)
+        while (true)
         {
-            auto ch = _in.get();
+            auto ch = GetNextCharacter();
             if (ch == EOF)
             {
-                return tokenStream.str();
+                return token;
             }
             else if (!std::isspace(ch))
             {
-                tokenStream << (char)ch;
+                token.push_back(static_cast<char>(ch));
                 bool isParsingString = _currentStringDelimiter != '\0';
-                bool isStringDelimiter = _stringDelimiters.find(ch) != std::string::npos;
+                bool isStringDelimiter = _stringDelimiters.find(static_cast<char>(ch)) != std::string::npos;
                 if (isParsingString) // we're in the middle of parsing a string: probably because we just read in a quotation mark last time
                 {
                     if (isStringDelimiter)
                     {
                         assert(_currentStringDelimiter == ch);
                         _currentStringDelimiter = '\0';
-                        return tokenStream.str(); // return the end-delimiter
+                        return token; // return the end-delimiter
                     }
                     else
                     {
@@ -63,54 +94,98 @@ namespace utilities
                 }
                 else // not parsing a string currently, set the string delimiter if we hit one
                 {
-                    _currentStringDelimiter = isStringDelimiter ? ch : '\0';
+                    _currentStringDelimiter = isStringDelimiter ? static_cast<char>(ch) : '\0';
 
-                    if (_tokenStartChars.find(ch) == std::string::npos) // if we didn't hit a token-stop char, break out of this loop and keep reading
+                    if (_tokenStartChars.find(static_cast<char>(ch)) == std::string::npos) // if we didn't hit a token-stop char, break out of this loop and keep reading
                     {
                         break;
                     }
                     else
                     {
-                        return tokenStream.str(); // we did hit a token-stop char. Return it.
+                        return token; // we did hit a token-stop char. Return it.
                     }
                 }
             }
         }
-        // At this point, the first char of a token will be in the tokenStream
+        // At this point, the first char of a token will be in the token string
 
-        // If we're in read-string mode, read until we get an unescaped string delimiter that matches the current string delimiter
-        bool prevEscaped = false;
-        while (_in)
+        if (_currentStringDelimiter != '\0')
         {
-            auto ch = _in.get();
-            if (ch == EOF)
+            // read-string mode: scan the buffer for the string delimiter or an escape character
+            // with memchr and append everything before it in one chunk, instead of testing each
+            // character individually
+            while (true)
             {
-                break;
-            }
+                if (_bufferPosition >= _bufferLength && !FillBuffer())
+                {
+                    break;
+                }
 
-            if (_currentStringDelimiter != '\0') // we're in read-string mode
-            {
-                if (!prevEscaped)
+                const char* start = _buffer.data() + _bufferPosition;
+                size_t available = _bufferLength - _bufferPosition;
+                auto delimiter = static_cast<const char*>(std::memchr(start, _currentStringDelimiter, available));
+                size_t scanLength = (delimiter != nullptr) ? static_cast<size_t>(delimiter - start) : available;
+                auto escape = static_cast<const char*>(std::memchr(start, escapeChar, scanLength));
+
+                auto stop = (escape != nullptr) ? escape : delimiter;
+                if (stop == nullptr)
+                {
+                    // no delimiter or escape in the buffer: take it all and refill
+                    token.append(start, available);
+                    _bufferPosition = _bufferLength;
+                    continue;
+                }
+
+                token.append(start, static_cast<size_t>(stop - start));
+                _bufferPosition += static_cast<size_t>(stop - start);
+                if (stop == escape)
                 {
-                    // only break if we're done reading a string
-                    if (ch == _currentStringDelimiter)
+                    // keep the escape character and the character it escapes verbatim; an escaped
+                    // delimiter must not end the string
+                    token.push_back(static_cast<char>(GetNextCharacter())); // the escape char itself
+                    auto escaped = GetNextCharacter();
+                    if (escaped == EOF)
                     {
-                        _in.unget();
                         break;
                     }
+                    token.push_back(static_cast<char>(escaped));
+                }
+                else
+                {
+                    // unescaped string delimiter: leave it in the buffer so the next token is the end-delimiter
+                    break;
                 }
             }
-            else if (std::isspace(ch) || _tokenStartChars.find(ch) != std::string::npos) // not in read-string mode, break on token or space
+        }
+        else
+        {
+            // regular token: scan the buffer for the next whitespace or token-start character and
+            // append everything before it in one chunk
+            while (true)
             {
-                _in.unget();
-                break;
-            }
+                if (_bufferPosition >= _bufferLength && !FillBuffer())
+                {
+                    break;
+                }
+
+                const char* start = _buffer.data() + _bufferPosition;
+                const char* end = _buffer.data() + _bufferLength;
+                const char* current = start;
+                while (current < end && !_isStopChar[static_cast<unsigned char>(*current)])
+                {
+                    ++current;
+                }
 
-            tokenStream << (char)ch;
-            prevEscaped = !prevEscaped && ch == escapeChar;
+                token.append(start, static_cast<size_t>(current - start));
+                _bufferPosition += static_cast<size_t>(current - start);
+                if (current < end)
+                {
+                    break; // leave the stopping character in the buffer
+                }
+            }
         }
 
-        return tokenStream.str();
+        return token;
     }
 
     std::string Tokenizer::PeekNextToken()
@@ -8,10 +8,121 @@
 
 #include "Variant.h"
 
+// stl
+#include <mutex>
+#include <vector>
+
 namespace ell
 {
 namespace utilities
 {
+    namespace VariantDetail
+    {
+        namespace
+        {
+            // Slab allocator for boxed values too large for the inline buffer. Blocks are
+            // carved from page-sized slabs and recycled through per-size-class free lists;
+            // the slabs themselves are never returned to the system. A mutex guards the free
+            // lists: overflow boxing is the rare case, so contention here is negligible.
+            constexpr size_t slabSize = 4096;
+            constexpr size_t blockSizes[] = { 64, 128, 256, 512 };
+            constexpr int numBlockSizes = static_cast<int>(sizeof(blockSizes) / sizeof(blockSizes[0]));
+
+            struct FreeBlock
+            {
+                FreeBlock* next;
+            };
+
+            class VariantSlabAllocator
+            {
+            public:
+                void* Allocate(size_t size)
+                {
+                    auto sizeClass = GetSizeClass(size);
+                    if (sizeClass < 0)
+                    {
+                        return ::operator new(size);
+                    }
+
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    auto& freeList = _freeLists[sizeClass];
+                    if (freeList == nullptr)
+                    {
+                        Refill(sizeClass);
+                    }
+                    auto block = freeList;
+                    freeList = block->next;
+                    return block;
+                }
+
+                void Deallocate(void* block, size_t size)
+                {
+                    auto sizeClass = GetSizeClass(size);
+                    if (sizeClass < 0)
+                    {
+                        ::operator delete(block);
+                        return;
+                    }
+
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    auto freeBlock = static_cast<FreeBlock*>(block);
+                    freeBlock->next = _freeLists[sizeClass];
+                    _freeLists[sizeClass] = freeBlock;
+                }
+
+            private:
+                int GetSizeClass(size_t size) const
+                {
+                    for (int index = 0; index < numBlockSizes; ++index)
+                    {
+                        if (size <= blockSizes[index])
+                        {
+                            return index;
+                        }
+                    }
+                    return -1; // bigger than the largest size class: use the default heap
+                }
+
+                void Refill(int sizeClass)
+                {
+                    auto blockSize = blockSizes[sizeClass];
+                    auto slab = new unsigned char[slabSize];
+                    _slabs.emplace_back(slab);
+                    for (size_t offset = 0; offset + blockSize <= slabSize; offset += blockSize)
+                    {
+                        auto freeBlock = reinterpret_cast<FreeBlock*>(slab + offset);
+                        freeBlock->next = _freeLists[sizeClass];
+                        _freeLists[sizeClass] = freeBlock;
+                    }
+                }
+
+                std::mutex _mutex;
+                FreeBlock* _freeLists[numBlockSizes] = {};
+                std::vector<std::unique_ptr<unsigned char[]>> _slabs;
+            };
+
+            VariantSlabAllocator& GetVariantSlabAllocator()
+            {
+                // intentionally leaked, so variants destroyed during static teardown can
+                // still return their blocks safely
+                static auto allocator = new VariantSlabAllocator();
+                return *allocator;
+            }
+        }
+
+        void* AllocateVariantBlock(size_t size)
+        {
+            RecordAllocation(size); // overflow boxing is the only variant heap (or slab) hit left
+            return GetVariantSlabAllocator().Allocate(size);
+        }
+
+        void FreeVariantBlock(void* block, size_t size)
+        {
+            RecordDeallocation(size);
+            GetVariantSlabAllocator().Deallocate(block, size);
+        }
+    }
+
     //
     // Variant implementation
     //
@@ -24,28 +135,15 @@ namespace utilities
     Variant::Variant(const Variant& other)
         : _type(other._type)
     {
-        if (other._value)
-        {
-            _value = other._value->Clone();
-        }
-        else
-        {
-            _value = nullptr;
-        }
-    }
-
-    Variant::Variant(std::type_index type, std::unique_ptr<VariantDetail::VariantBase> variantValue)
-        : _type(type)
-    {
-        _value = std::move(variantValue);
+        _value = other._value;
     }
 
     Variant& Variant::operator=(const Variant& other)
     {
-        if (other._value != _value)
+        if (&other != this)
         {
             _type = other._type;
-            _value = other._value->Clone();
+            _value = other._value;
         }
         return *this;
     }
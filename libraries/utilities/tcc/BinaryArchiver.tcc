@@ -0,0 +1,92 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     BinaryArchiver.tcc (utilities)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ell
+{
+namespace utilities
+{
+    //
+    // Serialization
+    //
+    template <typename ValueType, IsFundamental<ValueType> concept>
+    void BinaryArchiver::WriteScalar(const char* name, const ValueType& value)
+    {
+        WriteBytes(&value, sizeof(ValueType));
+    }
+
+    // Specialization for bool --- stored as a single byte, since sizeof(bool) is implementation-defined
+    template <>
+    inline void BinaryArchiver::WriteScalar(const char* name, const bool& value)
+    {
+        unsigned char byte = value ? 1 : 0;
+        WriteBytes(&byte, 1);
+    }
+
+    template <typename ValueType>
+    void BinaryArchiver::WriteArray(const char* name, const std::vector<ValueType>& array)
+    {
+        WriteCount(array.size());
+        if (!array.empty())
+        {
+            WriteBytes(array.data(), array.size() * sizeof(ValueType));
+        }
+    }
+
+    // Specialization for bool --- std::vector<bool> isn't a contiguous array of bools
+    template <>
+    inline void BinaryArchiver::WriteArray(const char* name, const std::vector<bool>& array)
+    {
+        WriteCount(array.size());
+        for (bool value : array)
+        {
+            WriteScalar("", value);
+        }
+    }
+
+    //
+    // Deserialization
+    //
+    template <typename ValueType, IsFundamental<ValueType> concept>
+    void BinaryUnarchiver::ReadScalar(const char* name, ValueType& value)
+    {
+        ReadBytes(&value, sizeof(ValueType));
+    }
+
+    template <>
+    inline void BinaryUnarchiver::ReadScalar(const char* name, bool& value)
+    {
+        unsigned char byte = 0;
+        ReadBytes(&byte, 1);
+        value = byte != 0;
+    }
+
+    template <typename ValueType, IsFundamental<ValueType> concept>
+    void BinaryUnarchiver::ReadArray(const char* name, std::vector<ValueType>& array)
+    {
+        auto count = ReadCount();
+        array.resize(count);
+        if (count > 0)
+        {
+            ReadBytes(array.data(), count * sizeof(ValueType));
+        }
+    }
+
+    template <>
+    inline void BinaryUnarchiver::ReadArray(const char* name, std::vector<bool>& array)
+    {
+        auto count = ReadCount();
+        array.resize(count);
+        for (uint64_t index = 0; index < count; ++index)
+        {
+            bool value = false;
+            ReadScalar("", value);
+            array[index] = value;
+        }
+    }
+}
+}
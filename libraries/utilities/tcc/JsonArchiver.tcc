@@ -10,6 +10,10 @@ namespace ell
 {
 namespace utilities
 {
+    // arrays below this size stay in the readable per-element form even when compact numeric
+    // arrays are enabled
+    constexpr size_t compactArrayThreshold = 16;
+
     //
     // Serialization
     //
@@ -26,7 +30,18 @@ namespace utilities
         {
             _out << "\"" << name << "\": ";
         }
-        _out << value;
+        if (std::is_floating_point<ValueType>::value)
+        {
+            // write at round-trip precision, so values restored from the archive (e.g. trainer
+            // checkpoints) are bit-identical to the values that were saved
+            auto originalPrecision = _out.precision(std::numeric_limits<ValueType>::max_digits10);
+            _out << value;
+            _out.precision(originalPrecision);
+        }
+        else
+        {
+            _out << value;
+        }
         SetEndOfLine(endOfLine);
     }
 
@@ -81,9 +96,51 @@ namespace utilities
         SetEndOfLine(endOfLine);
     }
 
+    template <typename ValueType>
+    bool JsonArchiver::TryWriteCompactArray(const char* name, const std::vector<ValueType>& array)
+    {
+        using IsRawCopyable = std::integral_constant<bool, std::is_arithmetic<ValueType>::value && !std::is_same<ValueType, bool>::value>;
+        if (!_compactNumericArrays || array.size() < compactArrayThreshold)
+        {
+            return false;
+        }
+        return WriteCompactArray(name, array, IsRawCopyable{});
+    }
+
+    template <typename ValueType>
+    bool JsonArchiver::WriteCompactArray(const char* name, const std::vector<ValueType>& array, std::true_type)
+    {
+        auto indent = GetCurrentIndent();
+        bool hasName = name != std::string("");
+
+        FinishPreviousLine();
+        _out << indent;
+        if (hasName)
+        {
+            _out << "\"" << name << "\": ";
+        }
+
+        _out << "\"b64[" << array.size() << "]:";
+        _out << JsonUtilities::EncodeBase64(reinterpret_cast<const uint8_t*>(array.data()), array.size() * sizeof(ValueType));
+        _out << "\"";
+        SetEndOfLine(",\n");
+        return true;
+    }
+
+    template <typename ValueType>
+    bool JsonArchiver::WriteCompactArray(const char*, const std::vector<ValueType>&, std::false_type)
+    {
+        return false;
+    }
+
     template <typename ValueType>
     void JsonArchiver::WriteArray(const char* name, const std::vector<ValueType>& array)
     {
+        if (TryWriteCompactArray(name, array))
+        {
+            return;
+        }
+
         bool hasName = name != std::string("");
         auto indent = GetCurrentIndent();
         auto endOfLine = ",\n";
@@ -189,6 +246,36 @@ namespace utilities
         }
     }
 
+    template <typename ValueType>
+    void JsonUnarchiver::ReadCompactArray(std::vector<ValueType>& array, std::true_type)
+    {
+        _tokenizer.MatchToken("\"");
+        auto token = _tokenizer.ReadNextToken();
+        _tokenizer.MatchToken("\"");
+
+        auto countEnd = token.find("]:", 4);
+        if (token.compare(0, 4, "b64[") != 0 || countEnd == std::string::npos)
+        {
+            throw InputException(InputExceptionErrors::badStringFormat, "Malformed compact array: " + token.substr(0, 16));
+        }
+
+        size_t count = static_cast<size_t>(std::stoull(token.substr(4, countEnd - 4)));
+        auto bytes = JsonUtilities::DecodeBase64(token.substr(countEnd + 2));
+        if (bytes.size() != count * sizeof(ValueType))
+        {
+            throw InputException(InputExceptionErrors::badStringFormat, "Compact array payload size doesn't match its element count");
+        }
+
+        array.resize(count);
+        std::memcpy(array.data(), bytes.data(), bytes.size());
+    }
+
+    template <typename ValueType>
+    void JsonUnarchiver::ReadCompactArray(std::vector<ValueType>&, std::false_type)
+    {
+        throw InputException(InputExceptionErrors::badStringFormat, "Unexpected compact array for a non-numeric element type");
+    }
+
     template <typename ValueType, IsFundamental<ValueType> concept>
     void JsonUnarchiver::ReadArray(const char* name, std::vector<ValueType>& array)
     {
@@ -198,6 +285,22 @@ namespace utilities
             MatchFieldName(name);
         }
 
+        // a quoted value in array position is the compact base64 form written by JsonArchiver
+        // when compact numeric arrays are enabled
+        if (_tokenizer.PeekNextToken() == "\"")
+        {
+            using IsRawCopyable = std::integral_constant<bool, std::is_arithmetic<ValueType>::value && !std::is_same<ValueType, bool>::value>;
+            ReadCompactArray(array, IsRawCopyable{});
+            if (hasName)
+            {
+                if (_tokenizer.PeekNextToken() == ",")
+                {
+                    _tokenizer.ReadNextToken();
+                }
+            }
+            return;
+        }
+
         _tokenizer.MatchToken("[");
         while (true)
         {
@@ -22,12 +22,14 @@ namespace utilities
     template <typename ValueType>
     void ObjectArchive::CopyValueTo(ValueType&& value) const
     {
+        MaterializeValue();
         value = _value.GetValue<typename std::decay<ValueType>::type>();
     }
 
     template <typename ValueType>
     void ObjectArchive::operator>>(ValueType&& value) const
     {
+        MaterializeValue();
         value = _value.GetValue<typename std::decay<ValueType>::type>();
     }
 
@@ -36,6 +38,7 @@ namespace utilities
     {
         SetType(value);
         _value = value;
+        _valueFactory = nullptr;
     }
 
     template <typename ValueType>
@@ -0,0 +1,63 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     PairwiseReduction.tcc (utilities)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// utilities
+#include "Exception.h"
+
+// stl
+#include <utility>
+
+namespace ell
+{
+namespace utilities
+{
+    template <typename ValueType, typename CombineFunctionType>
+    ValueType ReducePairwise(std::vector<ValueType> partials, CombineFunctionType combine)
+    {
+        if (partials.empty())
+        {
+            throw InputException(InputExceptionErrors::invalidArgument, "ReducePairwise requires at least one partial result");
+        }
+
+        // Combine neighbors at doubling strides: (0,1) (2,3) ... then (0,2) (4,6) ... and so on.
+        // The tree shape is a function of the partial count alone, never of completion order.
+        for (size_t stride = 1; stride < partials.size(); stride *= 2)
+        {
+            for (size_t index = 0; index + stride < partials.size(); index += 2 * stride)
+            {
+                partials[index] = combine(std::move(partials[index]), std::move(partials[index + stride]));
+            }
+        }
+        return std::move(partials[0]);
+    }
+
+    template <typename ValueType>
+    ValueType PairwiseSum(const ValueType* values, size_t count)
+    {
+        constexpr size_t directSumThreshold = 16;
+        if (count <= directSumThreshold)
+        {
+            ValueType sum = 0;
+            for (size_t index = 0; index < count; ++index)
+            {
+                sum += values[index];
+            }
+            return sum;
+        }
+
+        size_t half = count / 2;
+        return PairwiseSum(values, half) + PairwiseSum(values + half, count - half);
+    }
+
+    template <typename ValueType>
+    ValueType PairwiseSum(const std::vector<ValueType>& values)
+    {
+        return PairwiseSum(values.data(), values.size());
+    }
+}
+}
@@ -6,7 +6,10 @@
 //
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include "ThreadPool.h"
+
 // stl
+#include <algorithm>
 #include <thread>
 
 #define DEFAULT_MAX_TASKS 8
@@ -20,25 +23,39 @@ namespace utilities
     //
 
     template <typename InputIteratorType, typename OutType, typename FuncType, int MaxTasks>
-    ParallelTransformIterator<InputIteratorType, OutType, FuncType, MaxTasks>::ParallelTransformIterator(InputIteratorType& inIter, FuncType transformFunction)
+    ParallelTransformIterator<InputIteratorType, OutType, FuncType, MaxTasks>::ParallelTransformIterator(InputIteratorType& inIter, FuncType transformFunction, size_t maxPendingBytes)
         : _inIter(inIter), _transformFunction(transformFunction), _currentOutputValid(false), _currentIndex(0), _endIndex(-1)
     {
-        // Fill the buffer with futures that are the result of calling std::async(transformFunction) on inIter
-        int maxTasks = MaxTasks == 0 ? std::thread::hardware_concurrency() : MaxTasks;
-        if (maxTasks == 0) // if std::thread::hardware_concurrency isn't implemented, use DEFAULT_MAX_TASKS tasks (maybe this should be 1)
+        size_t numSlots;
+        if (MaxTasks != 0)
+        {
+            numSlots = static_cast<size_t>(MaxTasks);
+        }
+        else
         {
-            maxTasks = DEFAULT_MAX_TASKS;
+            // keep more slots in flight than workers, so a slow element doesn't idle the pool
+            // once the other completed slots are consumed; the byte budget caps the ring so
+            // completed-but-not-yet-emitted outputs stay within maxPendingBytes
+            size_t numThreads = GetThreadPool().NumThreads();
+            if (numThreads == 0) // if std::thread::hardware_concurrency isn't implemented, use DEFAULT_MAX_TASKS tasks (maybe this should be 1)
+            {
+                numThreads = DEFAULT_MAX_TASKS;
+            }
+            size_t budgetSlots = std::max<size_t>(maxPendingBytes / sizeof(OutType), 1);
+            numSlots = std::min(4 * numThreads, budgetSlots);
         }
 
-        _futures.reserve(maxTasks);
-        for (int index = 0; index < maxTasks; index++)
+        // Fill the ring with futures for tasks submitted to the shared thread pool; the tasks
+        // complete out of order into their slots, and Get()/Next() emit them in input order
+        _futures.reserve(numSlots);
+        for (size_t index = 0; index < numSlots; index++)
         {
             if (!_inIter.IsValid())
             {
                 break;
             }
 
-            _futures.emplace_back(std::async(std::launch::async, _transformFunction, _inIter.Get()));
+            _futures.emplace_back(GetThreadPool().Submit(_transformFunction, _inIter.Get()));
             _inIter.Next();
         }
     }
@@ -55,7 +72,7 @@ namespace utilities
         // If necessary, create new std::future to handle next input
         if (_inIter.IsValid())
         {
-            _futures[_currentIndex] = std::async(std::launch::async, _transformFunction, _inIter.Get());
+            _futures[_currentIndex] = GetThreadPool().Submit(_transformFunction, _inIter.Get());
             _inIter.Next();
         }
         else
@@ -74,6 +91,7 @@ namespace utilities
         // Need to cache output of current std::future, because calling std::future::get() twice is an error
         if (!_currentOutputValid)
         {
+            GetThreadPool().Wait(_futures[_currentIndex]); // executes pending tasks while waiting
             _currentOutput = _futures[_currentIndex].get();
             _currentOutputValid = true;
         }
@@ -82,10 +100,10 @@ namespace utilities
     }
 
     template <typename InputIteratorType, typename FuncType>
-    auto MakeParallelTransformIterator(InputIteratorType& inIterator, FuncType transformFunction) -> ParallelTransformIterator<InputIteratorType, decltype(transformFunction(inIterator.Get())), FuncType>
+    auto MakeParallelTransformIterator(InputIteratorType& inIterator, FuncType transformFunction, size_t maxPendingBytes) -> ParallelTransformIterator<InputIteratorType, decltype(transformFunction(inIterator.Get())), FuncType>
     {
         using OutType = decltype(transformFunction(inIterator.Get()));
-        return ParallelTransformIterator<InputIteratorType, OutType, FuncType>(inIterator, transformFunction);
+        return ParallelTransformIterator<InputIteratorType, OutType, FuncType>(inIterator, transformFunction, maxPendingBytes);
     }
 }
 }
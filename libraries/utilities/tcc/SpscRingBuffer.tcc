@@ -0,0 +1,74 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     SpscRingBuffer.tcc (utilities)
+//  Authors:  Lisa Ong
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Exception.h"
+
+// stl
+#include <utility>
+
+namespace ell
+{
+namespace utilities
+{
+    template <typename ValueType>
+    SpscRingBuffer<ValueType>::SpscRingBuffer(size_t capacity)
+        : _buffer(capacity + 1), _head(0), _tail(0)
+    {
+        if (capacity == 0)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "ring buffer capacity must be positive");
+        }
+    }
+
+    template <typename ValueType>
+    bool SpscRingBuffer<ValueType>::TryPush(ValueType value)
+    {
+        auto tail = _tail.load(std::memory_order_relaxed);
+        auto next = NextIndex(tail);
+        if (next == _head.load(std::memory_order_acquire))
+        {
+            return false; // full - drop the value rather than wait for the consumer
+        }
+
+        _buffer[tail] = std::move(value);
+        _tail.store(next, std::memory_order_release); // publish the slot to the consumer
+        return true;
+    }
+
+    template <typename ValueType>
+    bool SpscRingBuffer<ValueType>::TryPop(ValueType& value)
+    {
+        auto head = _head.load(std::memory_order_relaxed);
+        if (head == _tail.load(std::memory_order_acquire))
+        {
+            return false; // empty
+        }
+
+        value = std::move(_buffer[head]);
+        _head.store(NextIndex(head), std::memory_order_release); // release the slot to the producer
+        return true;
+    }
+
+    template <typename ValueType>
+    bool SpscRingBuffer<ValueType>::TryPopLatest(ValueType& value)
+    {
+        bool popped = false;
+        while (TryPop(value))
+        {
+            popped = true;
+        }
+        return popped;
+    }
+
+    template <typename ValueType>
+    bool SpscRingBuffer<ValueType>::IsEmpty() const
+    {
+        return _head.load(std::memory_order_acquire) == _tail.load(std::memory_order_acquire);
+    }
+}
+}
@@ -0,0 +1,43 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ThreadPool.tcc (utilities)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// stl
+#include <chrono>
+
+namespace ell
+{
+namespace utilities
+{
+    template <typename FunctionType, typename... ArgTypes>
+    auto ThreadPool::Submit(FunctionType&& function, ArgTypes&&... args) -> std::future<typename std::result_of<FunctionType(ArgTypes...)>::type>
+    {
+        using ResultType = typename std::result_of<FunctionType(ArgTypes...)>::type;
+
+        // packaged_task is move-only, and std::function requires a copyable callable, so hold the
+        // task through a shared_ptr
+        auto boundFunction = std::bind(std::forward<FunctionType>(function), std::forward<ArgTypes>(args)...);
+        auto packagedTask = std::make_shared<std::packaged_task<ResultType()>>(std::move(boundFunction));
+        auto future = packagedTask->get_future();
+        Enqueue([packagedTask]() { (*packagedTask)(); });
+        return future;
+    }
+
+    template <typename ResultType>
+    void ThreadPool::Wait(std::future<ResultType>& future)
+    {
+        while (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        {
+            // help out with pending work instead of blocking a thread
+            if (!TryExecutePendingTask())
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+}
+}
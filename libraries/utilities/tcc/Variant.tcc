@@ -25,7 +25,9 @@ namespace utilities
 
         protected:
             VariantBase(std::type_index type);
-            virtual std::unique_ptr<VariantBase> Clone() const = 0;
+            virtual size_t GetObjectSize() const = 0;
+            virtual VariantBase* CloneInto(VariantStorage& storage) const = 0;
+            virtual VariantBase* MoveInto(VariantStorage& storage) = 0;
             virtual std::string ToString() const = 0;
             virtual std::string GetStoredTypeName() const = 0;
             virtual bool IsPrimitiveType() const = 0;
@@ -50,6 +52,7 @@ namespace utilities
 
         private:
             friend class ell::utilities::Variant;
+            friend class VariantStorage;
 
             template <typename ValueType>
             ValueType GetValue() const;
@@ -75,11 +78,18 @@ namespace utilities
             /// <param name="val"> Value to wrap in a variant </param>
             VariantDerived(const ValueType& val);
 
+            /// <summary> Move constructor </summary>
+            ///
+            /// <param name="val"> Value to wrap in a variant </param>
+            VariantDerived(ValueType&& val);
+
         protected:
             const ValueType& GetValue() const { return _value; }
             void SetValue(const ValueType& value);
 
-            virtual std::unique_ptr<VariantBase> Clone() const override;
+            virtual size_t GetObjectSize() const override { return sizeof(VariantDerived<ValueType>); }
+            virtual VariantBase* CloneInto(VariantStorage& storage) const override;
+            virtual VariantBase* MoveInto(VariantStorage& storage) override;
             virtual std::string ToString() const override;
             virtual std::string GetStoredTypeName() const override;
             virtual bool IsPrimitiveType() const override { return std::is_fundamental<ValueType>::value; }
@@ -107,7 +117,6 @@ namespace utilities
             friend class VariantBase;
 
             ValueType _value;
-            std::string _typeName;
         };
 
         // GetValueString
@@ -317,6 +326,131 @@ namespace utilities
             throw InputException(InputExceptionErrors::typeMismatch, "VariantBase::ArchiveProperty called with unarchivable type");
         }
 
+        //
+        // VariantStorage implementation
+        //
+        template <typename DerivedType, typename... Args>
+        DerivedType* VariantStorage::Emplace(Args&&... args)
+        {
+            Reset();
+            return EmplaceImpl<DerivedType>(std::integral_constant<bool, (sizeof(DerivedType) <= variantInlineBufferSize)>{}, std::forward<Args>(args)...);
+        }
+
+        template <typename DerivedType, typename... Args>
+        DerivedType* VariantStorage::EmplaceImpl(std::true_type, Args&&... args)
+        {
+            auto ptr = new (&_buffer) DerivedType(std::forward<Args>(args)...);
+            _ptr = ptr;
+            return ptr;
+        }
+
+        template <typename DerivedType, typename... Args>
+        DerivedType* VariantStorage::EmplaceImpl(std::false_type, Args&&... args)
+        {
+            auto block = AllocateVariantBlock(sizeof(DerivedType));
+            DerivedType* ptr = nullptr;
+            try
+            {
+                ptr = new (block) DerivedType(std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                FreeVariantBlock(block, sizeof(DerivedType));
+                throw;
+            }
+            _ptr = ptr;
+            return ptr;
+        }
+
+        inline void VariantStorage::Reset()
+        {
+            if (_ptr == nullptr)
+            {
+                return;
+            }
+
+            auto block = static_cast<void*>(_ptr);
+            auto size = _ptr->GetObjectSize();
+            bool wasInline = IsInline();
+            _ptr->~VariantBase();
+            if (!wasInline)
+            {
+                FreeVariantBlock(block, size);
+            }
+            _ptr = nullptr;
+        }
+
+        inline void VariantStorage::MoveFrom(VariantStorage&& other) noexcept
+        {
+            if (other._ptr == nullptr)
+            {
+                return;
+            }
+
+            if (other.IsInline())
+            {
+                // an inline value of a given type always fits inline in the destination too,
+                // so this move-constructs into our buffer without allocating
+                other._ptr->MoveInto(*this);
+                other.Reset();
+            }
+            else
+            {
+                _ptr = other._ptr; // steal the slab block
+                other._ptr = nullptr;
+            }
+        }
+
+        inline VariantStorage::VariantStorage(const VariantStorage& other)
+        {
+            if (other._ptr != nullptr)
+            {
+                other._ptr->CloneInto(*this);
+            }
+        }
+
+        inline VariantStorage::VariantStorage(VariantStorage&& other) noexcept
+        {
+            MoveFrom(std::move(other));
+        }
+
+        inline VariantStorage& VariantStorage::operator=(const VariantStorage& other)
+        {
+            if (this != &other)
+            {
+                if (other._ptr != nullptr)
+                {
+                    other._ptr->CloneInto(*this); // CloneInto resets the destination first
+                }
+                else
+                {
+                    Reset();
+                }
+            }
+            return *this;
+        }
+
+        inline VariantStorage& VariantStorage::operator=(VariantStorage&& other) noexcept
+        {
+            if (this != &other)
+            {
+                Reset();
+                MoveFrom(std::move(other));
+            }
+            return *this;
+        }
+
+        inline VariantStorage& VariantStorage::operator=(std::nullptr_t)
+        {
+            Reset();
+            return *this;
+        }
+
+        inline VariantStorage::~VariantStorage()
+        {
+            Reset();
+        }
+
         //
         // VariantBase implementation
         //
@@ -341,7 +475,7 @@ namespace utilities
             auto thisPtr = dynamic_cast<VariantDetail::VariantDerived<std::decay_t<ValueType>>*>(this);
             if (thisPtr == nullptr)
             {
-                throw InputException(InputExceptionErrors::typeMismatch, std::string{ "VariantBase::SetValue called with wrong type. Type: " + TypeName<ValueType>::GetName() });
+                throw InputException(InputExceptionErrors::typeMismatch, std::string{ "VariantBase::SetValue called with wrong type. Type: " + TypeName<std::decay_t<ValueType>>::GetName() });
             }
             thisPtr->SetValue(value);
         }
@@ -351,13 +485,19 @@ namespace utilities
         //
         template <typename ValueType>
         VariantDerived<ValueType>::VariantDerived()
-            : VariantBase(typeid(ValueType)), _value(ValueType()), _typeName(TypeName<ValueType>::GetName())
+            : VariantBase(typeid(ValueType)), _value(ValueType())
         {
         }
 
         template <typename ValueType>
         VariantDerived<ValueType>::VariantDerived(const ValueType& val)
-            : VariantBase(typeid(ValueType)), _value(val), _typeName(TypeName<ValueType>::GetName())
+            : VariantBase(typeid(ValueType)), _value(val)
+        {
+        }
+
+        template <typename ValueType>
+        VariantDerived<ValueType>::VariantDerived(ValueType&& val)
+            : VariantBase(typeid(ValueType)), _value(std::move(val))
         {
         }
 
@@ -368,10 +508,15 @@ namespace utilities
         }
 
         template <typename ValueType>
-        std::unique_ptr<VariantBase> VariantDerived<ValueType>::Clone() const
+        VariantBase* VariantDerived<ValueType>::CloneInto(VariantStorage& storage) const
+        {
+            return storage.Emplace<VariantDerived<ValueType>>(_value);
+        }
+
+        template <typename ValueType>
+        VariantBase* VariantDerived<ValueType>::MoveInto(VariantStorage& storage)
         {
-            auto ptr = static_cast<VariantBase*>(new VariantDerived<ValueType>(_value));
-            return std::unique_ptr<VariantBase>(ptr);
+            return storage.Emplace<VariantDerived<ValueType>>(std::move(_value));
         }
 
         template <typename ValueType>
@@ -454,9 +599,7 @@ namespace utilities
     Variant::Variant()
         : _type(std::type_index(typeid(ValueType)))
     {
-        auto derivedPtr = new VariantDetail::VariantDerived<std::decay_t<ValueType>>(Default);
-        auto basePtr = static_cast<VariantDetail::VariantBase*>(derivedPtr);
-        _value = std::unique_ptr<VariantDetail::VariantBase>(basePtr);
+        _value.Emplace<VariantDetail::VariantDerived<std::decay_t<ValueType>>>(Default);
     }
 
     template <typename ValueType>
@@ -464,9 +607,7 @@ namespace utilities
         : _type(std::type_index(typeid(ValueType)))
     {
         static_assert(!std::is_same<std::decay_t<ValueType>, Variant>(), "Can't make a Variant of a Variant");
-        auto derivedPtr = new VariantDetail::VariantDerived<std::decay_t<ValueType>>(std::forward<ValueType>(value));
-        auto basePtr = static_cast<VariantDetail::VariantBase*>(derivedPtr);
-        _value = std::unique_ptr<VariantDetail::VariantBase>(basePtr);
+        _value.Emplace<VariantDetail::VariantDerived<std::decay_t<ValueType>>>(std::forward<ValueType>(value));
     }
 
     template <typename ValueType>
@@ -524,9 +665,7 @@ namespace utilities
         static_assert(!std::is_same<std::decay_t<ValueType>, Variant>(), "Can't make a Variant of a Variant");
 
         _type = std::type_index(typeid(ValueType));
-        auto derivedPtr = new VariantDetail::VariantDerived<std::decay_t<ValueType>>(std::forward<ValueType>(value));
-        auto basePtr = static_cast<VariantDetail::VariantBase*>(derivedPtr);
-        _value = std::unique_ptr<VariantDetail::VariantBase>(basePtr);
+        _value.Emplace<VariantDetail::VariantDerived<std::decay_t<ValueType>>>(std::forward<ValueType>(value));
     }
 
     template <typename ValueType>
@@ -642,14 +781,7 @@ namespace utilities
     {
         if (IsSameTypeAs(other))
         {
-            if (other._value)
-            {
-                _value = other._value->Clone();
-            }
-            else
-            {
-                _value = nullptr;
-            }
+            _value = other._value;
             return true;
         }
 
@@ -677,13 +809,11 @@ namespace utilities
         return false;
     }
 
-    template <typename ValueType>
+    template <typename ValueType, typename>
     Variant& Variant::operator=(ValueType&& value)
     {
         _type = std::type_index(typeid(ValueType));
-        auto derivedPtr = new VariantDetail::VariantDerived<std::decay_t<ValueType>>(std::forward<ValueType>(value));
-        auto basePtr = static_cast<VariantDetail::VariantBase*>(derivedPtr);
-        _value = std::unique_ptr<VariantDetail::VariantBase>(basePtr);
+        _value.Emplace<VariantDetail::VariantDerived<std::decay_t<ValueType>>>(std::forward<ValueType>(value));
         return *this;
     }
 
@@ -696,9 +826,10 @@ namespace utilities
     template <typename ValueType, typename... Args>
     Variant MakeVariant(Args&&... args)
     {
-        auto derivedPtr = new VariantDetail::VariantDerived<std::decay_t<ValueType>>(std::forward<Args>(args)...);
-        auto basePtr = static_cast<VariantDetail::VariantBase*>(derivedPtr);
-        return Variant(std::type_index(typeid(ValueType)), std::unique_ptr<VariantDetail::VariantBase>(basePtr));
+        Variant variant;
+        variant._type = std::type_index(typeid(ValueType));
+        variant._value.Emplace<VariantDetail::VariantDerived<std::decay_t<ValueType>>>(std::forward<Args>(args)...);
+        return variant;
     }
 
     //
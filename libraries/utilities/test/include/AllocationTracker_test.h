@@ -0,0 +1,17 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     AllocationTracker_test.h (utilities)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+namespace ell
+{
+void TestAllocationTrackingDisabled();
+void TestAllocationTagging();
+void TestAllocationHighWater();
+void TestAllocationSnapshotDiff();
+}
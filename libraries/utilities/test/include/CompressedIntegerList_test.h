@@ -0,0 +1,16 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     CompressedIntegerList_test.h (utilities)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+namespace ell
+{
+void TestCompressedIntegerListRoundTrip();
+void TestCompressedIntegerListBlockBoundaries();
+void TestCompressedIntegerListReset();
+}
@@ -12,7 +12,11 @@ namespace ell
 {
 void TestJsonArchiver();
 void TestJsonUnarchiver();
+void TestJsonCompactArrays();
 
 void TestXmlArchiver();
 void TestXmlUnarchiver();
+
+void TestBinaryArchiver();
+void TestBinaryUnarchiver();
 }
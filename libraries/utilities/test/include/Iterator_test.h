@@ -11,4 +11,5 @@ namespace ell
 void TestIteratorAdapter();
 void TestTransformIterator();
 void TestParallelTransformIterator();
+void TestParallelTransformIteratorSkewed();
 }
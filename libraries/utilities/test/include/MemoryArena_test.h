@@ -0,0 +1,14 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     MemoryArena_test.h (utilities)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ell
+{
+void TestMemoryArenaAllocate();
+void TestMemoryArenaAlignment();
+void TestMemoryArenaClear();
+}
@@ -12,6 +12,7 @@ namespace ell
 {
 void TestGetTypeDescription();
 void TestGetObjectArchive();
+void TestLazyObjectArchive();
 void TestSerializeIArchivable();
 void TestObjectArchiver();
 }
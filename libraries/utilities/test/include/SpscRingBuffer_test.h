@@ -0,0 +1,16 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     SpscRingBuffer_test.h (utilities)
+//  Authors:  Lisa Ong
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+namespace ell
+{
+void TestSpscRingBufferPushPop();
+void TestSpscRingBufferPopLatest();
+void TestSpscRingBufferConcurrent();
+}
@@ -0,0 +1,14 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ThreadPool_test.h (utilities)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ell
+{
+void TestThreadPoolSubmit();
+void TestThreadPoolNestedTasks();
+void TestThreadPoolExceptions();
+}
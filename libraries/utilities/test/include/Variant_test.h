@@ -22,4 +22,6 @@ void TestParsePortElementsProxyVariant();
 void TestParseObjVariant();
 
 void TestVariantToString();
+
+void TestVariantStorage();
 }
@@ -0,0 +1,91 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     AllocationTracker_test.cpp (utilities)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "AllocationTracker_test.h"
+
+// utilities
+#include "AllocationTracker.h"
+
+// testing
+#include "testing.h"
+
+namespace ell
+{
+using namespace utilities;
+
+void TestAllocationTrackingDisabled()
+{
+    ResetAllocationCounters();
+    EnableAllocationTracking(false);
+
+    RecordAllocation(100);
+
+    auto snapshot = GetAllocationSnapshot();
+    testing::ProcessTest("Disabled tracking records nothing", snapshot.GetCounters(AllocationTag::other).allocationCount == 0);
+}
+
+void TestAllocationTagging()
+{
+    ResetAllocationCounters();
+    EnableAllocationTracking(true);
+
+    RecordAllocation(100);
+    {
+        ScopedAllocationTag tag(AllocationTag::dataLoading);
+        RecordAllocation(200);
+        {
+            ScopedAllocationTag nestedTag(AllocationTag::archiving);
+            RecordAllocation(300);
+        }
+        RecordAllocation(400); // the nested scope restored the dataLoading tag
+    }
+
+    EnableAllocationTracking(false);
+
+    auto snapshot = GetAllocationSnapshot();
+    testing::ProcessTest("Untagged allocation", snapshot.GetCounters(AllocationTag::other).allocatedBytes == 100);
+    testing::ProcessTest("Tagged allocations", snapshot.GetCounters(AllocationTag::dataLoading).allocationCount == 2 && snapshot.GetCounters(AllocationTag::dataLoading).allocatedBytes == 600);
+    testing::ProcessTest("Nested tag", snapshot.GetCounters(AllocationTag::archiving).allocatedBytes == 300);
+}
+
+void TestAllocationHighWater()
+{
+    ResetAllocationCounters();
+    EnableAllocationTracking(true);
+
+    RecordAllocation(1000);
+    RecordAllocation(500);
+    RecordDeallocation(1000);
+    RecordAllocation(200);
+
+    EnableAllocationTracking(false);
+
+    auto counters = GetAllocationSnapshot().GetCounters(AllocationTag::other);
+    testing::ProcessTest("Live bytes", counters.liveBytes == 700);
+    testing::ProcessTest("High water", counters.highWaterBytes == 1500);
+}
+
+void TestAllocationSnapshotDiff()
+{
+    ResetAllocationCounters();
+    EnableAllocationTracking(true);
+
+    RecordAllocation(100);
+    auto before = GetAllocationSnapshot();
+    RecordAllocation(250);
+    RecordAllocation(250);
+    auto after = GetAllocationSnapshot();
+
+    EnableAllocationTracking(false);
+
+    auto difference = GetAllocationDifference(before, after);
+    auto counters = difference.GetCounters(AllocationTag::other);
+    testing::ProcessTest("Snapshot diff count", counters.allocationCount == 2);
+    testing::ProcessTest("Snapshot diff bytes", counters.allocatedBytes == 500);
+}
+}
@@ -0,0 +1,129 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     CompressedIntegerList_test.cpp (utilities)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "CompressedIntegerList_test.h"
+
+// utilities
+#include "CompressedIntegerList.h"
+
+// testing
+#include "testing.h"
+
+// stl
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace ell
+{
+using namespace utilities;
+
+namespace
+{
+    // appends the values and checks that iterating the list gets them all back in order
+    bool RoundTripsExactly(const std::vector<size_t>& values)
+    {
+        CompressedIntegerList list;
+        for (size_t value : values)
+        {
+            list.Append(value);
+        }
+
+        if (list.Size() != values.size())
+        {
+            return false;
+        }
+
+        size_t index = 0;
+        for (auto iterator = list.GetIterator(); iterator.IsValid(); iterator.Next())
+        {
+            if (index >= values.size() || iterator.Get() != values[index])
+            {
+                return false;
+            }
+            ++index;
+        }
+        return index == values.size();
+    }
+}
+
+void TestCompressedIntegerListRoundTrip()
+{
+    testing::ProcessTest("CompressedIntegerList empty", RoundTripsExactly({}));
+    testing::ProcessTest("CompressedIntegerList zero start", RoundTripsExactly({ 0, 1, 2 }));
+
+    // small deltas
+    std::vector<size_t> dense;
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        dense.push_back(3 * i);
+    }
+    testing::ProcessTest("CompressedIntegerList small deltas", RoundTripsExactly(dense));
+
+    // deltas spanning the 1-, 2-, 4- and 8-byte width classes of the old per-integer encoding
+    std::vector<size_t> mixed = { 5, 6, 300, 100000, size_t{ 1 } << 33, size_t{ 1 } << 62 };
+    testing::ProcessTest("CompressedIntegerList mixed deltas", RoundTripsExactly(mixed));
+
+    // a sparse run of 56-bit deltas, the widest the packed encoding supports
+    std::vector<size_t> wide;
+    for (size_t i = 1; i <= 200; ++i)
+    {
+        wide.push_back(i * (size_t{ 1 } << 55));
+    }
+    testing::ProcessTest("CompressedIntegerList wide deltas", RoundTripsExactly(wide));
+
+    // one delta over 56 bits in a full block forces the whole-word fallback for that block
+    std::vector<size_t> huge;
+    for (size_t i = 0; i < 127; ++i)
+    {
+        huge.push_back(i);
+    }
+    huge.push_back(size_t{ 1 } << 60);
+    huge.push_back((size_t{ 1 } << 60) + 5);
+    testing::ProcessTest("CompressedIntegerList huge deltas", RoundTripsExactly(huge));
+
+    CompressedIntegerList list;
+    list.Append(17);
+    list.Append(90);
+    testing::ProcessTest("CompressedIntegerList max", list.Max() == 90);
+}
+
+void TestCompressedIntegerListBlockBoundaries()
+{
+    // lengths straddling the 128-delta block size: one short of a block, exact blocks, and a tail
+    for (size_t count : { size_t{ 127 }, size_t{ 128 }, size_t{ 129 }, size_t{ 256 }, size_t{ 300 } })
+    {
+        std::vector<size_t> values;
+        for (size_t i = 0; i < count; ++i)
+        {
+            values.push_back(7 * i + (i % 5)); // irregular but increasing
+        }
+        testing::ProcessTest("CompressedIntegerList length " + std::to_string(count), RoundTripsExactly(values));
+    }
+}
+
+void TestCompressedIntegerListReset()
+{
+    CompressedIntegerList list;
+    for (size_t i = 0; i < 200; ++i)
+    {
+        list.Append(2 * i);
+    }
+    list.Reset();
+    testing::ProcessTest("CompressedIntegerList reset size", list.Size() == 0);
+    testing::ProcessTest("CompressedIntegerList reset iterator", !list.GetIterator().IsValid());
+
+    // the first value appended after a reset may again be zero
+    list.Append(0);
+    list.Append(10);
+    auto iterator = list.GetIterator();
+    testing::ProcessTest("CompressedIntegerList append after reset", iterator.IsValid() && iterator.Get() == 0);
+    iterator.Next();
+    testing::ProcessTest("CompressedIntegerList append after reset 2", iterator.IsValid() && iterator.Get() == 10);
+}
+}
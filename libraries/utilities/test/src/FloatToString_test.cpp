@@ -0,0 +1,80 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     FloatToString_test.cpp (utilities)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "FloatToString_test.h"
+#include "FloatToString.h"
+
+// testing
+#include "testing.h"
+
+// stl
+#include <cmath>
+#include <cstdlib>
+#include <random>
+#include <string>
+
+namespace ell
+{
+namespace
+{
+    std::string Format(double value, int precision = 6)
+    {
+        char buffer[utilities::maxDoubleStringLength];
+        auto length = utilities::FormatDouble(buffer, value, precision);
+        return std::string(buffer, length);
+    }
+}
+
+void TestFormatDoubleExactValues()
+{
+    testing::ProcessTest("FormatDouble(0)", Format(0.0) == "0");
+    testing::ProcessTest("FormatDouble(-0)", Format(-0.0) == "-0");
+    testing::ProcessTest("FormatDouble(1)", Format(1.0) == "1");
+    testing::ProcessTest("FormatDouble(-1.5)", Format(-1.5) == "-1.5");
+    testing::ProcessTest("FormatDouble(0.25)", Format(0.25) == "0.25");
+    testing::ProcessTest("FormatDouble(100)", Format(100.0) == "100");
+    testing::ProcessTest("FormatDouble(0.0001)", Format(0.0001) == "0.0001");
+    testing::ProcessTest("FormatDouble(1e-5)", Format(1e-5) == "1e-05");
+    testing::ProcessTest("FormatDouble(1e7)", Format(1e7) == "1e+07");
+    testing::ProcessTest("FormatDouble(123456)", Format(123456.0) == "123456");
+    testing::ProcessTest("FormatDouble(3.14159, 3)", Format(3.14159, 3) == "3.14");
+    testing::ProcessTest("FormatDouble(9.999, 2)", Format(9.999, 2) == "10");
+    testing::ProcessTest("FormatDouble(nan)", Format(std::nan("")) == "nan");
+    testing::ProcessTest("FormatDouble(inf)", Format(HUGE_VAL) == "inf");
+    testing::ProcessTest("FormatDouble(-inf)", Format(-HUGE_VAL) == "-inf");
+}
+
+void TestFormatDoubleRoundTrip()
+{
+    // at full precision, formatting then parsing should reproduce the value to within
+    // a unit or two in the last place; check a spread of magnitudes
+    std::default_random_engine generator(123);
+    std::uniform_real_distribution<double> mantissa(-1.0, 1.0);
+    std::uniform_int_distribution<int> exponent(-300, 300);
+
+    bool ok = true;
+    for (int index = 0; index < 1000; ++index)
+    {
+        double value = mantissa(generator) * std::pow(10.0, exponent(generator));
+        auto parsed = std::strtod(Format(value, 17).c_str(), nullptr);
+        auto error = std::abs(parsed - value);
+        auto tolerance = std::abs(value) * 1e-15;
+        ok = ok && (error <= tolerance);
+    }
+    testing::ProcessTest("FormatDouble round trip", ok);
+}
+
+void TestAppendDouble()
+{
+    std::string line = "x=";
+    utilities::AppendDouble(line, 2.5);
+    line += ", y=";
+    utilities::AppendDouble(line, -0.125);
+    testing::ProcessTest("AppendDouble", line == "x=2.5, y=-0.125");
+}
+}
@@ -10,6 +10,7 @@
 
 // utilities
 #include "Archiver.h"
+#include "BinaryArchiver.h"
 #include "IArchivable.h"
 #include "JsonArchiver.h"
 #include "UniqueId.h"
@@ -328,6 +329,44 @@ void TestJsonUnarchiver()
     TestUnarchiver<utilities::JsonArchiver, utilities::JsonUnarchiver>();
 }
 
+void TestJsonCompactArrays()
+{
+    std::vector<double> doubleVec(100);
+    for (size_t index = 0; index < doubleVec.size(); ++index)
+    {
+        doubleVec[index] = 0.5 * index - 17.25;
+    }
+    std::vector<int> intVec(32);
+    for (size_t index = 0; index < intVec.size(); ++index)
+    {
+        intVec[index] = static_cast<int>(index * index) - 100;
+    }
+    std::vector<double> smallVec{ 1.0, 2.0, 3.0 };
+
+    std::stringstream strstream;
+    {
+        utilities::JsonArchiver archiver(strstream);
+        archiver.SetCompactNumericArrays(true);
+        archiver.Archive("big", doubleVec);
+        archiver.Archive("ints", intVec);
+        archiver.Archive("small", smallVec);
+    }
+
+    // large numeric arrays become base64 blocks; small ones stay in the readable form
+    auto text = strstream.str();
+    testing::ProcessTest("Testing compact array encoding", text.find("b64[100]:") != std::string::npos && text.find("b64[32]:") != std::string::npos && text.find("b64[3]:") == std::string::npos);
+
+    utilities::SerializationContext context;
+    utilities::JsonUnarchiver unarchiver(strstream, context);
+    std::vector<double> newDoubleVec;
+    std::vector<int> newIntVec;
+    std::vector<double> newSmallVec;
+    unarchiver.Unarchive("big", newDoubleVec);
+    unarchiver.Unarchive("ints", newIntVec);
+    unarchiver.Unarchive("small", newSmallVec);
+    testing::ProcessTest("Testing compact array round trip", newDoubleVec == doubleVec && newIntVec == intVec && newSmallVec == smallVec);
+}
+
 void TestXmlArchiver()
 {
     TestArchiver<utilities::XmlArchiver>();
@@ -337,4 +376,14 @@ void TestXmlUnarchiver()
 {
     TestUnarchiver<utilities::XmlArchiver, utilities::XmlUnarchiver>();
 }
+
+void TestBinaryArchiver()
+{
+    TestArchiver<utilities::BinaryArchiver>();
+}
+
+void TestBinaryUnarchiver()
+{
+    TestUnarchiver<utilities::BinaryArchiver, utilities::BinaryUnarchiver>();
+}
 }
@@ -136,4 +136,50 @@ void TestParallelTransformIterator()
     auto elapsed = timer.Elapsed();
     std::cout << "Elapsed time: " << elapsed << " ms" << std::endl;
 }
+
+void TestParallelTransformIteratorSkewed()
+{
+    std::vector<int> vec(48);
+    std::iota(vec.begin(), vec.end(), 0);
+
+    // a skewed transform: every 16th element is much slower than the rest
+    auto skewedTransform = [](int x) {
+        if (x % 16 == 0)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        return 2 * x;
+    };
+
+    // results must still come out in input order
+    auto srcIt = utilities::MakeStlContainerReferenceIterator(vec.begin(), vec.end());
+    auto transIt = MakeParallelTransformIterator(srcIt, skewedTransform);
+
+    bool passed = true;
+    int index = 0;
+    while (transIt.IsValid())
+    {
+        passed = passed && transIt.Get() == 2 * vec[index];
+        transIt.Next();
+        index++;
+    }
+    passed = passed && (index == static_cast<int>(vec.size()));
+    testing::ProcessTest("utilities::ParallelTransformIterator (skewed, in order)", passed);
+
+    // a byte budget that only admits a couple of in-flight outputs must still produce every
+    // result, in order
+    auto tinySrcIt = utilities::MakeStlContainerReferenceIterator(vec.begin(), vec.end());
+    auto tinyTransIt = MakeParallelTransformIterator(tinySrcIt, skewedTransform, 2 * sizeof(int));
+
+    passed = true;
+    index = 0;
+    while (tinyTransIt.IsValid())
+    {
+        passed = passed && tinyTransIt.Get() == 2 * vec[index];
+        tinyTransIt.Next();
+        index++;
+    }
+    passed = passed && (index == static_cast<int>(vec.size()));
+    testing::ProcessTest("utilities::ParallelTransformIterator (tiny byte budget)", passed);
+}
 }
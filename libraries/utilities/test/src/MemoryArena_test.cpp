@@ -0,0 +1,67 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     MemoryArena_test.cpp (utilities)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "MemoryArena_test.h"
+
+#include "MemoryArena.h"
+
+// testing
+#include "testing.h"
+
+// stl
+#include <cstdint>
+#include <cstring>
+
+namespace ell
+{
+void TestMemoryArenaAllocate()
+{
+    utilities::MemoryArena arena(256);
+
+    // many small allocations, spanning several blocks
+    bool ok = true;
+    for (int i = 0; i < 100; ++i)
+    {
+        auto* p = static_cast<int*>(arena.Allocate(sizeof(int), alignof(int)));
+        ok &= (p != nullptr);
+        *p = i; // the storage must be writable
+    }
+    testing::ProcessTest("MemoryArena::Allocate", ok);
+    testing::ProcessTest("MemoryArena::GetAllocatedSize", arena.GetAllocatedSize() == 100 * sizeof(int));
+    testing::ProcessTest("MemoryArena::GetCapacity", arena.GetCapacity() >= arena.GetAllocatedSize());
+
+    // an allocation bigger than the block size gets a dedicated block
+    auto* big = arena.Allocate(4096, alignof(double));
+    testing::ProcessTest("MemoryArena::Allocate (oversized)", big != nullptr);
+    std::memset(big, 0, 4096);
+}
+
+void TestMemoryArenaAlignment()
+{
+    utilities::MemoryArena arena;
+    bool ok = true;
+    for (size_t alignment : { size_t(1), size_t(2), size_t(8), size_t(64) })
+    {
+        arena.Allocate(1, 1); // misalign the bump pointer
+        auto address = reinterpret_cast<uintptr_t>(arena.Allocate(16, alignment));
+        ok &= (address % alignment == 0);
+    }
+    testing::ProcessTest("MemoryArena alignment", ok);
+}
+
+void TestMemoryArenaClear()
+{
+    utilities::MemoryArena arena(128);
+    for (int i = 0; i < 10; ++i)
+    {
+        arena.Allocate(100, 8);
+    }
+    arena.Clear();
+    testing::ProcessTest("MemoryArena::Clear", arena.GetAllocatedSize() == 0 && arena.GetCapacity() == 0);
+}
+}
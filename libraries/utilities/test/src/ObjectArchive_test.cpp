@@ -195,6 +195,31 @@ void TestGetObjectArchive()
     testing::ProcessTest("ObjectArchive", derivedDescription["c"].GetValue<std::string>() == "derived");
 }
 
+void TestLazyObjectArchive()
+{
+    int factoryCalls = 0;
+    utilities::ObjectArchive description;
+    description["weights"].SetValueFactory("std::vector<double>", [&factoryCalls]() {
+        ++factoryCalls;
+        return utilities::MakeVariant<std::vector<double>>(std::vector<double>{ 1.0, 2.0, 3.0 });
+    });
+    description["rows"] << 3;
+
+    // inspecting metadata doesn't materialize the deferred value
+    testing::ProcessTest("Lazy ObjectArchive", description["weights"].HasValue());
+    testing::ProcessTest("Lazy ObjectArchive", !description["weights"].HasMaterializedValue());
+    testing::ProcessTest("Lazy ObjectArchive", description["rows"].GetValue<int>() == 3);
+    testing::ProcessTest("Lazy ObjectArchive", factoryCalls == 0);
+
+    // the first read invokes the factory; subsequent reads use the cached value
+    auto weights = description["weights"].GetValue<std::vector<double>>();
+    testing::ProcessTest("Lazy ObjectArchive", weights == (std::vector<double>{ 1.0, 2.0, 3.0 }));
+    testing::ProcessTest("Lazy ObjectArchive", factoryCalls == 1);
+    testing::ProcessTest("Lazy ObjectArchive", description["weights"].HasMaterializedValue());
+    weights = description["weights"].GetValue<std::vector<double>>();
+    testing::ProcessTest("Lazy ObjectArchive", factoryCalls == 1);
+}
+
 void TestSerializeIArchivable()
 {
     utilities::SerializationContext context;
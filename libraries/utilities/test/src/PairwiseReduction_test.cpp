@@ -0,0 +1,69 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     PairwiseReduction_test.cpp (utilities)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PairwiseReduction_test.h"
+
+// utilities
+#include "PairwiseReduction.h"
+
+// testing
+#include "testing.h"
+
+// stl
+#include <numeric>
+#include <vector>
+
+namespace ell
+{
+void TestPairwiseSum()
+{
+    std::vector<int> intValues(100);
+    std::iota(intValues.begin(), intValues.end(), 1);
+    testing::ProcessTest("PairwiseSum: integers", utilities::PairwiseSum(intValues) == 5050);
+
+    std::vector<double> doubleValues(1000, 0.1);
+    auto sum = utilities::PairwiseSum(doubleValues);
+    testing::ProcessTest("PairwiseSum: doubles", testing::IsEqual(sum, 100.0, 1.0e-9));
+
+    testing::ProcessTest("PairwiseSum: empty", utilities::PairwiseSum(std::vector<double>{}) == 0.0);
+}
+
+void TestReducePairwise()
+{
+    std::vector<double> partials{ 1, 2, 3, 4, 5, 6, 7 };
+    auto result = utilities::ReducePairwise(partials, [](double a, double b) { return a + b; });
+    testing::ProcessTest("ReducePairwise: scalars", testing::IsEqual(result, 28.0));
+
+    // vector-valued partials, as produced by per-thread accumulators
+    std::vector<std::vector<double>> vectorPartials(5, std::vector<double>{ 1.0, 2.0 });
+    auto combined = utilities::ReducePairwise(vectorPartials, [](std::vector<double> a, const std::vector<double>& b) {
+        for (size_t i = 0; i < a.size(); ++i)
+        {
+            a[i] += b[i];
+        }
+        return a;
+    });
+    testing::ProcessTest("ReducePairwise: vectors", testing::IsEqual(combined[0], 5.0) && testing::IsEqual(combined[1], 10.0));
+}
+
+void TestReducePairwiseDeterminism()
+{
+    // values chosen so that different association orders round differently
+    std::vector<double> partials;
+    for (int i = 0; i < 33; ++i)
+    {
+        partials.push_back((i % 2 == 0) ? 1.0e16 : 1.0);
+    }
+
+    auto combine = [](double a, double b) { return a + b; };
+    auto first = utilities::ReducePairwise(partials, combine);
+    auto second = utilities::ReducePairwise(partials, combine);
+    testing::ProcessTest("ReducePairwise: bit-stable across runs", first == second);
+    testing::ProcessTest("ReducePairwise: plausible value", testing::IsEqual(first, 17.0e16, 1.0e3));
+}
+}
@@ -0,0 +1,72 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     PerformanceProbes_test.cpp (utilities)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PerformanceProbes_test.h"
+
+// utilities
+#include "PerformanceProbes.h"
+
+// testing
+#include "testing.h"
+
+namespace ell
+{
+using namespace utilities;
+
+void TestPerformanceProbeDisabled()
+{
+    static PerformanceProbe probe("TestPerformanceProbeDisabled");
+    probe.Reset();
+    EnablePerformanceProbes(false);
+
+    {
+        ScopedPerformanceProbe measure(probe);
+    }
+
+    auto statistics = probe.GetStatistics();
+    testing::ProcessTest("Disabled probe records nothing", statistics.count == 0);
+}
+
+void TestPerformanceProbeStatistics()
+{
+    static PerformanceProbe probe("TestPerformanceProbeStatistics");
+    probe.Reset();
+
+    // 99 measurements of 1us and two of 1ms: the outliers make up the top 2%, so the mean pulls
+    // above 1us and the p99 lands on an outlier
+    for (int i = 0; i < 99; ++i)
+    {
+        probe.Record(1000);
+    }
+    probe.Record(1000000);
+    probe.Record(1000000);
+
+    auto statistics = probe.GetStatistics();
+    testing::ProcessTest("Probe count", statistics.count == 101);
+    testing::ProcessTest("Probe mean", statistics.meanMicroseconds > 1.0 && statistics.meanMicroseconds < 1000.0);
+    testing::ProcessTest("Probe p99", testing::IsEqual(statistics.p99Microseconds, 1000.0));
+}
+
+void TestScopedPerformanceProbe()
+{
+    static PerformanceProbe probe("TestScopedPerformanceProbe");
+    probe.Reset();
+    EnablePerformanceProbes(true);
+
+    for (int i = 0; i < 10; ++i)
+    {
+        ScopedPerformanceProbe measure(probe);
+    }
+
+    EnablePerformanceProbes(false);
+
+    auto statistics = probe.GetStatistics();
+    testing::ProcessTest("Scoped probe count", statistics.count == 10);
+    testing::ProcessTest("Scoped probe mean", statistics.meanMicroseconds >= 0);
+}
+}
@@ -0,0 +1,89 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     SpscRingBuffer_test.cpp (utilities)
+//  Authors:  Lisa Ong
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "SpscRingBuffer_test.h"
+
+#include "SpscRingBuffer.h"
+
+// testing
+#include "testing.h"
+
+// stl
+#include <thread>
+#include <vector>
+
+namespace ell
+{
+void TestSpscRingBufferPushPop()
+{
+    utilities::SpscRingBuffer<int> buffer(3);
+    testing::ProcessTest("SpscRingBuffer::Capacity", buffer.Capacity() == 3);
+    testing::ProcessTest("SpscRingBuffer::IsEmpty", buffer.IsEmpty());
+
+    testing::ProcessTest("SpscRingBuffer::TryPush", buffer.TryPush(1));
+    testing::ProcessTest("SpscRingBuffer::TryPush", buffer.TryPush(2));
+    testing::ProcessTest("SpscRingBuffer::TryPush", buffer.TryPush(3));
+
+    // the buffer is full, so the push fails and the value is dropped
+    testing::ProcessTest("SpscRingBuffer::TryPush full", !buffer.TryPush(4));
+
+    int value = 0;
+    testing::ProcessTest("SpscRingBuffer::TryPop", buffer.TryPop(value) && value == 1);
+    testing::ProcessTest("SpscRingBuffer::TryPop", buffer.TryPop(value) && value == 2);
+    testing::ProcessTest("SpscRingBuffer::TryPush after pop", buffer.TryPush(5));
+    testing::ProcessTest("SpscRingBuffer::TryPop", buffer.TryPop(value) && value == 3);
+    testing::ProcessTest("SpscRingBuffer::TryPop", buffer.TryPop(value) && value == 5);
+    testing::ProcessTest("SpscRingBuffer::TryPop empty", !buffer.TryPop(value));
+}
+
+void TestSpscRingBufferPopLatest()
+{
+    utilities::SpscRingBuffer<int> buffer(4);
+
+    int value = 0;
+    testing::ProcessTest("SpscRingBuffer::TryPopLatest empty", !buffer.TryPopLatest(value));
+
+    buffer.TryPush(1);
+    buffer.TryPush(2);
+    buffer.TryPush(3);
+    testing::ProcessTest("SpscRingBuffer::TryPopLatest", buffer.TryPopLatest(value) && value == 3);
+    testing::ProcessTest("SpscRingBuffer::IsEmpty after TryPopLatest", buffer.IsEmpty());
+}
+
+void TestSpscRingBufferConcurrent()
+{
+    const int numValues = 100000;
+    utilities::SpscRingBuffer<int> buffer(16);
+
+    // the producer pushes an increasing sequence, retrying when the buffer is full, and the
+    // consumer checks that the values arrive in order without loss
+    std::thread producer([&buffer]() {
+        for (int i = 0; i < numValues; ++i)
+        {
+            while (!buffer.TryPush(i))
+            {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    bool inOrder = true;
+    for (int i = 0; i < numValues; ++i)
+    {
+        int value = 0;
+        while (!buffer.TryPop(value))
+        {
+            std::this_thread::yield();
+        }
+        inOrder &= (value == i);
+    }
+    producer.join();
+
+    testing::ProcessTest("SpscRingBuffer concurrent push/pop", inOrder && buffer.IsEmpty());
+}
+}
@@ -0,0 +1,98 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ThreadPool_test.cpp (utilities)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "ThreadPool_test.h"
+
+#include "ThreadPool.h"
+
+// testing
+#include "testing.h"
+
+// stl
+#include <atomic>
+#include <future>
+#include <numeric>
+#include <vector>
+
+namespace ell
+{
+void TestThreadPoolSubmit()
+{
+    auto& pool = utilities::GetThreadPool();
+    testing::ProcessTest("ThreadPool::NumThreads", pool.NumThreads() > 0);
+
+    const int numTasks = 1000;
+    std::vector<std::future<int>> futures;
+    futures.reserve(numTasks);
+    for (int i = 0; i < numTasks; ++i)
+    {
+        futures.push_back(pool.Submit([i]() { return 2 * i; }));
+    }
+
+    int sum = 0;
+    for (auto& future : futures)
+    {
+        pool.Wait(future);
+        sum += future.get();
+    }
+    testing::ProcessTest("ThreadPool::Submit", sum == numTasks * (numTasks - 1));
+}
+
+void TestThreadPoolNestedTasks()
+{
+    auto& pool = utilities::GetThreadPool();
+
+    // each outer task submits inner tasks and waits for them from inside the pool - Wait
+    // executes pending tasks on the waiting thread, so this can't deadlock even when the
+    // number of outer tasks equals the number of workers
+    auto numOuterTasks = pool.NumThreads();
+    std::vector<std::future<int>> outerFutures;
+    for (size_t i = 0; i < numOuterTasks; ++i)
+    {
+        outerFutures.push_back(pool.Submit([&pool]() {
+            std::vector<std::future<int>> innerFutures;
+            for (int j = 0; j < 10; ++j)
+            {
+                innerFutures.push_back(pool.Submit([j]() { return j; }));
+            }
+            int innerSum = 0;
+            for (auto& future : innerFutures)
+            {
+                pool.Wait(future);
+                innerSum += future.get();
+            }
+            return innerSum;
+        }));
+    }
+
+    int total = 0;
+    for (auto& future : outerFutures)
+    {
+        pool.Wait(future);
+        total += future.get();
+    }
+    testing::ProcessTest("ThreadPool nested tasks", total == static_cast<int>(numOuterTasks) * 45);
+}
+
+void TestThreadPoolExceptions()
+{
+    auto& pool = utilities::GetThreadPool();
+    auto future = pool.Submit([]() -> int { throw std::runtime_error("expected"); });
+    pool.Wait(future);
+    bool caught = false;
+    try
+    {
+        future.get();
+    }
+    catch (const std::runtime_error&)
+    {
+        caught = true;
+    }
+    testing::ProcessTest("ThreadPool exception propagation", caught);
+}
+}
@@ -207,4 +207,44 @@ void TestVariantToString()
     testing::ProcessTest("Variant ToString", v4.ToString() == "0");
 }
 
+namespace
+{
+    // bigger than the inline buffer, so boxing it goes through the slab allocator
+    struct BigTestPayload
+    {
+        double values[16] = {};
+        static std::string GetTypeName() { return "BigTestPayload"; }
+    };
+}
+
+void TestVariantStorage()
+{
+    // inline boxing: scalars and strings must not touch the heap
+    utilities::EnableAllocationTracking(true);
+    utilities::ResetAllocationCounters();
+    {
+        utilities::Variant v1(5);
+        utilities::Variant v2(std::string("small"));
+        utilities::Variant v3 = v2;
+        utilities::Variant v4 = std::move(v3);
+        testing::ProcessTest("Variant inline copy/move", v4.GetValue<std::string>() == "small");
+    }
+    auto snapshot = utilities::GetAllocationSnapshot();
+    testing::ProcessTest("Variant inline boxing allocates nothing", snapshot.GetCounters(utilities::AllocationTag::other).allocationCount == 0);
+
+    // overflow boxing: comes from the slab and is returned on destruction
+    {
+        BigTestPayload payload;
+        payload.values[0] = 2.5;
+        utilities::Variant big(payload);
+        utilities::Variant bigCopy = big;
+        utilities::Variant bigMoved = std::move(bigCopy);
+        testing::ProcessTest("Variant slab copy/move", bigMoved.GetValue<BigTestPayload>().values[0] == 2.5);
+    }
+    snapshot = utilities::GetAllocationSnapshot();
+    testing::ProcessTest("Variant slab boxing recorded", snapshot.GetCounters(utilities::AllocationTag::other).allocationCount == 2);
+    testing::ProcessTest("Variant slab boxing freed", snapshot.GetCounters(utilities::AllocationTag::other).liveBytes == 0);
+    utilities::EnableAllocationTracking(false);
+}
+
 } // end namespace
@@ -6,11 +6,19 @@
 //
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include "CompressedIntegerList_test.h"
+#include "FloatToString_test.h"
 #include "Format_test.h"
 #include "FunctionUtils_test.h"
 #include "IArchivable_test.h"
 #include "Iterator_test.h"
+#include "MemoryArena_test.h"
 #include "ObjectArchive_test.h"
+#include "PairwiseReduction_test.h"
+#include "AllocationTracker_test.h"
+#include "PerformanceProbes_test.h"
+#include "SpscRingBuffer_test.h"
+#include "ThreadPool_test.h"
 #include "TypeFactory_test.h"
 #include "TypeName_test.h"
 #include "Variant_test.h"
@@ -36,6 +44,11 @@ int main()
 {
     try
     {
+        // CompressedIntegerList tests
+        TestCompressedIntegerListRoundTrip();
+        TestCompressedIntegerListBlockBoundaries();
+        TestCompressedIntegerListReset();
+
         // Format tests
         TestMatchFormat();
 
@@ -43,6 +56,41 @@ int main()
         TestIteratorAdapter();
         TestTransformIterator();
         TestParallelTransformIterator();
+        TestParallelTransformIteratorSkewed();
+
+        // MemoryArena tests
+        TestMemoryArenaAllocate();
+        TestMemoryArenaAlignment();
+        TestMemoryArenaClear();
+
+        // PerformanceProbes tests
+        TestAllocationTrackingDisabled();
+        TestAllocationTagging();
+        TestAllocationHighWater();
+        TestAllocationSnapshotDiff();
+
+        TestFormatDoubleExactValues();
+        TestFormatDoubleRoundTrip();
+        TestAppendDouble();
+
+        TestPerformanceProbeDisabled();
+        TestPerformanceProbeStatistics();
+        TestScopedPerformanceProbe();
+
+        // PairwiseReduction tests
+        TestPairwiseSum();
+        TestReducePairwise();
+        TestReducePairwiseDeterminism();
+
+        // SpscRingBuffer tests
+        TestSpscRingBufferPushPop();
+        TestSpscRingBufferPopLatest();
+        TestSpscRingBufferConcurrent();
+
+        // ThreadPool tests
+        TestThreadPoolSubmit();
+        TestThreadPoolNestedTasks();
+        TestThreadPoolExceptions();
 
         // TypeFactory tests
         TypeFactoryTest();
@@ -53,6 +101,7 @@ int main()
         TestObjectVariant();
         TestVariantGetValueAs();
         TestVariantToString();
+        TestVariantStorage();
         TestVariantParseSimple();
         TestParseVectorVaraint();
         TestParsePortElementsProxyVariant();
@@ -61,13 +110,18 @@ int main()
         // Serialization tests
         TestJsonArchiver();
         TestJsonUnarchiver();
+        TestJsonCompactArrays();
 
         // TestXmlArchiver();
         // TestXmlUnarchiver();
 
+        TestBinaryArchiver();
+        TestBinaryUnarchiver();
+
         // ObjectArchive tests
         TestGetTypeDescription();
         TestGetObjectArchive();
+        TestLazyObjectArchive();
         TestSerializeIArchivable();
         TestObjectArchiver();
 
@@ -113,7 +113,7 @@ def get_float_vector_from_cntk_trainable_parameter(tensorParameter):
     tensorShape = tensorParameter.shape
     tensorValue = tensorParameter.value
 
-    orderedWeights = np.zeros(tensorValue.size, dtype=np.float)
+    orderedWeights = np.zeros(tensorValue.size, dtype=np.float32)
     i = 0
     for columnValue in tensorValue:
         orderedWeights[i] = columnValue
@@ -128,7 +128,7 @@ def get_float_vector_from_cntk_array(inputArray):
        ELL's ordering is row, column, channel.
     """
     tensorShape = inputArray.shape
-    orderedWeights = np.zeros(inputArray.size, dtype=np.float)
+    orderedWeights = np.zeros(inputArray.size, dtype=np.float32)
     if (len(tensorShape) == 4):
         i = 0
         for filter in range(tensorShape[0]):
@@ -187,19 +187,19 @@ def get_float_tensor_from_cntk_dense_weight_parameter(tensorParameter):
         orderedWeights = tensorValue
         orderedWeights = np.moveaxis(orderedWeights, 0, -1)
         orderedWeights = np.moveaxis(orderedWeights, 2, 0)
-        orderedWeights = orderedWeights.ravel().astype(np.float).reshape(
+        orderedWeights = orderedWeights.ravel().astype(np.float32).reshape(
             tensorShape[3] * tensorShape[1], tensorShape[2], tensorShape[0])
     elif (len(tensorShape) == 3):
         orderedWeights = np.moveaxis(tensorValue, 0, -1)
-        orderedWeights = orderedWeights.ravel().astype(np.float).reshape(
+        orderedWeights = orderedWeights.ravel().astype(np.float32).reshape(
             tensorShape[1], tensorShape[2], tensorShape[0])
     elif (len(tensorShape) == 2):
         orderedWeights = np.moveaxis(tensorValue, 0, -1)
         orderedWeights = orderedWeights.ravel().astype(
-            np.float).reshape(tensorShape[1], 1, tensorShape[0])
+            np.float32).reshape(tensorShape[1], 1, tensorShape[0])
     else:
         orderedWeights = tensorValue.ravel().astype(
-            np.float).reshape(1, 1, tensorValue.size)
+            np.float32).reshape(1, 1, tensorValue.size)
 
     return ELL.FloatTensor(orderedWeights)
 
@@ -215,19 +215,19 @@ def get_float_tensor_from_cntk_convolutional_weight_parameter(tensorParameter):
 
     if (len(tensorShape) == 4):
         orderedWeights = np.moveaxis(tensorValue, 1, -1)
-        orderedWeights = orderedWeights.ravel().astype(np.float).reshape(
+        orderedWeights = orderedWeights.ravel().astype(np.float32).reshape(
             tensorShape[0] * tensorShape[2], tensorShape[3], tensorShape[1])
     elif (len(tensorShape) == 3):
         orderedWeights = np.moveaxis(tensorValue, 0, -1)
-        orderedWeights = orderedWeights.ravel().astype(np.float).reshape(
+        orderedWeights = orderedWeights.ravel().astype(np.float32).reshape(
             tensorShape[1], tensorShape[2], tensorShape[0])
     elif (len(tensorShape) == 2):
         orderedWeights = np.moveaxis(tensorValue, 0, -1)
         orderedWeights = orderedWeights.ravel().astype(
-            np.float).reshape(tensorShape[1], tensorShape[0], 1)
+            np.float32).reshape(tensorShape[1], tensorShape[0], 1)
     else:
         orderedWeights = tensorValue.ravel().astype(
-            np.float).reshape(1, 1, tensorValue.size)
+            np.float32).reshape(1, 1, tensorValue.size)
     return ELL.FloatTensor(orderedWeights)
 
 
@@ -436,7 +436,7 @@ def process_element_times_layer(layer, ellLayers):
         scaleValue = layer.constants[0].value
         # Workaround: For some reason, np.full is not returning a type that SWIG can parse. So just manually walk the array setting the scalar
         scaleArray = np.arange(
-            layerParameters.outputShape.channels, dtype=np.float)
+            layerParameters.outputShape.channels, dtype=np.float32)
         for i in range(scaleArray.size):
             scaleArray[i] = scaleValue
         scalesVector = ELL.FloatVector(scaleArray)
@@ -559,6 +559,33 @@ def process_softmax_layer(layer, ellLayers):
     return
 
 
+def convert_cntk_layer_to_ell_layers(cntkLayer):
+    """Converts a single CNTK layer and returns the equivalent ELL Layer objects"""
+
+    ellLayers = []
+    if (cntkLayer.op_name == 'Convolution'):
+        process_convolutional_layer(cntkLayer, ellLayers)
+    elif (cntkLayer.op_name == 'Dense'):
+        process_dense_layer(cntkLayer, ellLayers)
+    elif (cntkLayer.op_name == 'linear'):
+        process_linear_layer(cntkLayer, ellLayers)
+    elif (cntkLayer.op_name == 'ElementTimes'):
+        process_element_times_layer(cntkLayer, ellLayers)
+    elif (cntkLayer.op_name == 'MaxPooling'):
+        process_max_pooling_layer(cntkLayer, ellLayers)
+    elif (cntkLayer.op_name == 'AveragePooling'):
+        process_average_pooling_layer(cntkLayer, ellLayers)
+    elif (cntkLayer.op_name == 'Pooling'):
+        process_pooling_layer(cntkLayer, ellLayers)
+    elif (cntkLayer.op_name == 'ReLU'):
+        process_relu_layer(cntkLayer, ellLayers)
+    elif (cntkLayer.op_name == 'LeakyReLU'):
+        process_leakyrelu_layer(cntkLayer, ellLayers)
+    elif (cntkLayer.op_name == 'Softmax'):
+        process_softmax_layer(cntkLayer, ellLayers)
+    return ellLayers
+
+
 def convert_cntk_layers_to_ell_layers(layersToConvert):
     """Walks a list of CNTK layers and returns a list of ELL Layer objects that is used to construct a Neural Network Predictor"""
 
@@ -566,26 +593,7 @@ def convert_cntk_layers_to_ell_layers(layersToConvert):
     ellLayers = []
     for cntkLayer in layersToConvert:
         print("Converting layer ", cntkLayer)
-        if (cntkLayer.op_name == 'Convolution'):
-            process_convolutional_layer(cntkLayer, ellLayers)
-        elif (cntkLayer.op_name == 'Dense'):
-            process_dense_layer(cntkLayer, ellLayers)
-        elif (cntkLayer.op_name == 'linear'):
-            process_linear_layer(cntkLayer, ellLayers)
-        elif (cntkLayer.op_name == 'ElementTimes'):
-            process_element_times_layer(cntkLayer, ellLayers)
-        elif (cntkLayer.op_name == 'MaxPooling'):
-            process_max_pooling_layer(cntkLayer, ellLayers)
-        elif (cntkLayer.op_name == 'AveragePooling'):
-            process_average_pooling_layer(cntkLayer, ellLayers)
-        elif (cntkLayer.op_name == 'Pooling'):
-            process_pooling_layer(cntkLayer, ellLayers)
-        elif (cntkLayer.op_name == 'ReLU'):
-            process_relu_layer(cntkLayer, ellLayers)
-        elif (cntkLayer.op_name == 'LeakyReLU'):
-            process_leakyrelu_layer(cntkLayer, ellLayers)
-        elif (cntkLayer.op_name == 'Softmax'):
-            process_softmax_layer(cntkLayer, ellLayers)
+        ellLayers += convert_cntk_layer_to_ell_layers(cntkLayer)
     print("\n...Finished constructing ELL layers.")
 
     return ellLayers
@@ -780,10 +788,15 @@ def predictor_from_cntk_model(modelFile):
     predictor = None
 
     try:
-        # Create a list of ELL layers from the CNTK layers
-        ellLayers = convert_cntk_layers_to_ell_layers(layersToConvert)
-        # Create an ELL neural network predictor from the layers
-        predictor = ELL.FloatNeuralNetworkPredictor(ellLayers)
+        # Stream the layers into the predictor one CNTK layer at a time, so only one
+        # layer's weights are materialized on the Python side at any moment
+        print("\nConstructing equivalent ELL layers from CNTK...")
+        predictor = ELL.FloatNeuralNetworkPredictor()
+        for cntkLayer in layersToConvert:
+            print("Converting layer ", cntkLayer)
+            for ellLayer in convert_cntk_layer_to_ell_layers(cntkLayer):
+                predictor.AddLayer(ellLayer)
+        print("\n...Finished constructing ELL layers.")
 
     except:
         print("Error occurrred attempting to convert cntk layers to ELL layers")
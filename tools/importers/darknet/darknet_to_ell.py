@@ -11,7 +11,6 @@
 import os
 import configparser
 import re
-import struct
 import sys, getopt
 import numpy as np
 import ELL
@@ -176,10 +175,14 @@ def create_layer_parameters(inputShape, inputPadding, inputPaddingScheme, output
 
     return ELL.LayerParameters(inputShape, inputPaddingParameters, outputShape, outputPaddingParameters)
 
+def read_float32_array(bin_data, count):
+    """Reads count float32 values from the weights file as a numpy array in a single call"""
+    return np.frombuffer(bin_data.read(4 * count), dtype=np.float32, count=count)
+
 def get_weights_tensor(weightsShape, values):
     """Returns an ELL tensor from Darknet weights. The weights are re-ordered
        to rows, columns, channels"""
-    weights = np.array(values, dtype=np.float).reshape(weightsShape)
+    weights = np.array(values, dtype=np.float32).reshape(weightsShape)
     if (len(weights.shape) == 3):
         orderedWeights = np.rollaxis(weights, 0, 3)
     elif (len(weights.shape) == 4):
@@ -257,31 +260,19 @@ def process_convolutional_layer(layer, bin_data, convolution_order):
     # Convolution layer in Darknet corresponds to ConvolutionalLayer, BatchNormalizationLayer, BiasLayer and ActivationLayer in ELL
     layers = []
 
-    # Read in binary values
-    bias_vals = []
-    for i in range(int(layer['filters'])):
-        bias_vals.append(struct.unpack('f', bin_data.read(4)))
-    bias_vals = np.array(bias_vals, dtype=np.float)
+    # Read in binary values in bulk rather than one struct.unpack call per element
+    bias_vals = read_float32_array(bin_data, int(layer['filters']))
     # now we need to check if these weights have batch normalization data
-    scale_vals = []
-    mean_vals = []
-    variance_vals = []
+    scale_vals = np.array([], dtype=np.float32)
+    mean_vals = np.array([], dtype=np.float32)
+    variance_vals = np.array([], dtype=np.float32)
     if ('batch_normalize' in layer) and ('dontloadscales' not in layer):
-        for i in range(int(layer['filters'])):
-            scale_vals.append(struct.unpack('f', bin_data.read(4)))
-        for i in range(int(layer['filters'])):
-            mean_vals.append(struct.unpack('f'   , bin_data.read(4)))
-        for i in range(int(layer['filters'])):
-            variance_vals.append(struct.unpack('f', bin_data.read(4)))
-    scale_vals = np.array(scale_vals, dtype=np.float)
-    mean_vals = np.array(mean_vals, dtype=np.float)
-    variance_vals = np.array(variance_vals, dtype=np.float)
+        scale_vals = read_float32_array(bin_data, int(layer['filters']))
+        mean_vals = read_float32_array(bin_data, int(layer['filters']))
+        variance_vals = read_float32_array(bin_data, int(layer['filters']))
     # now we can load the convolutional weights
-    weight_vals = []
     num_weights = int(layer['size'])*int(layer['size'])*int(layer['c'])*int(layer['filters'])
-    for i in range(num_weights):
-        weight_vals.append(struct.unpack('f', bin_data.read(4)))
-    weight_vals = np.array(weight_vals, dtype=np.float)
+    weight_vals = read_float32_array(bin_data, num_weights)
 
 
     layerParameters = create_layer_parameters(layer['inputShape'], layer['inputPadding'], layer['inputPaddingScheme'], layer['outputShapeMinusPadding'], 0, ELL.PaddingScheme.zeros)
@@ -354,16 +345,10 @@ def process_fully_connected_layer(layer, weightsData):
     else:
         layerParameters = create_layer_parameters(layer['outputShapeMinusPadding'], 0, ELL.PaddingScheme.zeros, layer['outputShapeMinusPadding'], 0, ELL.PaddingScheme.zeros)
 
-    bias_vals = []
-    for i in range(int(layer['output'])):
-        bias_vals.append(struct.unpack('f', weightsData.read(4)))
-    bias_vals = np.array(bias_vals, dtype=np.float)
-        
-    weight_vals = []
+    bias_vals = read_float32_array(weightsData, int(layer['output']))
+
     num_weights = int(layer['output'])*int(layer['inputs'])
-    for i in range(num_weights):
-        weight_vals.append(struct.unpack('f', weightsData.read(4)))
-    weight_vals = np.array(weight_vals, dtype=np.float)
+    weight_vals = read_float32_array(weightsData, num_weights)
 
     orderedWeights = weight_vals.reshape(layer['c'], layer['h'], layer['w'], (layer['out_h'] * layer['out_w'] * layer['out_c']))
     orderedWeights = np.moveaxis(orderedWeights, 0, 2)
@@ -386,27 +371,34 @@ def process_fully_connected_layer(layer, weightsData):
     return layers
 
 def process_network(network, weightsData, convolutionOrder):
-    """Returns an ELL.FloatNeuralNetworkPredictor as a result of parsing the network layers"""
-    ellLayers = []
+    """Returns an ELL.FloatNeuralNetworkPredictor as a result of parsing the network layers.
+       Layers are streamed into the predictor as they are parsed, so only one layer's
+       weights are materialized on the Python side at a time"""
+    predictor = ELL.FloatNeuralNetworkPredictor()
 
     for layer in network:
         if layer['type'] == 'net':
-            pass
+            continue
         elif layer['type'] == 'convolutional':
-            ellLayers += process_convolutional_layer(layer, weightsData, convolutionOrder)
+            ellLayers = process_convolutional_layer(layer, weightsData, convolutionOrder)
         elif layer['type'] == 'connected':
-            ellLayers += process_fully_connected_layer(layer, weightsData)
+            ellLayers = process_fully_connected_layer(layer, weightsData)
         elif layer['type'] == 'maxpool':
-            ellLayers.append(get_pooling_layer(layer, ELL.PoolingType.max))
+            ellLayers = [get_pooling_layer(layer, ELL.PoolingType.max)]
         elif layer['type'] == 'avgpool':
-            ellLayers.append(get_pooling_layer(layer, ELL.PoolingType.mean))
+            ellLayers = [get_pooling_layer(layer, ELL.PoolingType.mean)]
         elif layer['type'] == 'softmax':
-            ellLayers.append(get_softmax_layer(layer))
+            ellLayers = [get_softmax_layer(layer)]
         else:
             print("Skipping, ", layer['type'], "layer")
             print()
+            continue
+
+        # hand each layer to the predictor as soon as it is built; the weights copy into
+        # the underlying predictor during AddLayer, so the Python-side copy is released here
+        for ellLayer in ellLayers:
+            predictor.AddLayer(ellLayer)
 
-    predictor = ELL.FloatNeuralNetworkPredictor(ellLayers)
     return predictor
 
 # Function to import a Darknet model and output the corresponding ELL neural network predictor
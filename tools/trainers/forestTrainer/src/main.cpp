@@ -7,6 +7,7 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 // utilities
+#include "AllocationTracker.h"
 #include "CommandLineParser.h"
 #include "Exception.h"
 #include "Files.h"
@@ -66,6 +67,11 @@ int main(int argc, char* argv[])
         // parse command line
         commandLineParser.Parse();
 
+        if (trainerArguments.logAllocationProfile)
+        {
+            utilities::EnableAllocationTracking(true);
+        }
+
         if (trainerArguments.verbose)
         {
             std::cout << "Sorting Tree Trainer" << std::endl;
@@ -81,7 +87,7 @@ int main(int argc, char* argv[])
         // load dataset
         if (trainerArguments.verbose) std::cout << "Loading data ..." << std::endl;
         auto stream = utilities::OpenIfstream(dataLoadArguments.inputDataFilename);
-        auto mappedDataset = common::GetMappedDataset(stream, map);
+        auto mappedDataset = common::GetMappedDataset(stream, map, dataLoadArguments.datasetLayout);
 
         // predictor type
         using PredictorType = predictors::SimpleForestPredictor;
@@ -118,6 +124,11 @@ int main(int argc, char* argv[])
             auto model = common::AppendNodeToModel<nodes::SimpleForestPredictorNode, PredictorType>(map, predictor);
             common::SaveModel(model, modelSaveArguments.outputModelFilename);
         }
+
+        if (trainerArguments.logAllocationProfile)
+        {
+            utilities::ReportAllocations(std::cerr, utilities::GetAllocationSnapshot());
+        }
     }
     catch (const utilities::CommandLineParserPrintHelpException& exception)
     {
@@ -30,6 +30,7 @@ namespace ell
     size_t maxEpochs;
     bool permute;
     std::string randomSeedString;
+    size_t numWorkers;
 };
 
 /// <summary> Parsed version of LinearTrainerArguments. </summary>
@@ -0,0 +1,43 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ParallelSGD.h (linearTrainer)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// trainers
+#include "SGDTrainer.h"
+
+// data
+#include "Dataset.h"
+
+// predictors
+#include "LinearPredictor.h"
+
+// stl
+#include <cstddef>
+
+namespace ell
+{
+    /// <summary>
+    /// Trains a linear predictor with multiple worker processes, each running SGD epochs on a shard
+    /// of the dataset. Workers are forked after the dataset is loaded, so the examples are shared
+    /// read-only (copy-on-write, or directly when the dataset is memory-mapped) rather than
+    /// duplicated. After every epoch the workers meet at a shared-memory barrier and their weight
+    /// vectors are averaged; each worker then continues from the averaged weights (iterative
+    /// parameter mixing). The result approximates sequential SGD while running the epochs in
+    /// parallel. Only available on POSIX platforms; throws notImplemented elsewhere.
+    /// </summary>
+    ///
+    /// <param name="trainer"> The SGD trainer to run in each worker. Must support SetPredictor. </param>
+    /// <param name="dataset"> The dataset to shard across the workers. </param>
+    /// <param name="numWorkers"> The number of worker processes to fork. </param>
+    /// <param name="numEpochs"> The number of epochs each worker runs. </param>
+    /// <param name="verbose"> If true, the first worker prints per-epoch progress. </param>
+    ///
+    /// <returns> The averaged predictor from the final epoch. </returns>
+    predictors::LinearPredictor TrainParallelSGD(trainers::SGDTrainerBase& trainer, const data::AutoSupervisedDataset& dataset, size_t numWorkers, size_t numEpochs, bool verbose);
+}
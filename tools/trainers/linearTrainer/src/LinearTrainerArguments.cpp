@@ -55,5 +55,11 @@ namespace ell
             "seed",
             "The random seed string",
             "ABCDEFG");
+
+        parser.AddOption(numWorkers,
+            "numWorkers",
+            "nw",
+            "The number of worker processes for parallel SGD training (1 trains in-process; requires the SGD algorithm and a POSIX platform)",
+            1);
     }
 }
@@ -0,0 +1,195 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ParallelSGD.cpp (linearTrainer)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "ParallelSGD.h"
+
+// utilities
+#include "Exception.h"
+
+#if !defined(_WIN32)
+
+// stl
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <new>
+#include <thread>
+#include <vector>
+
+// POSIX
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace ell
+{
+    namespace
+    {
+        // Lives at the front of the shared-memory segment, followed by one weight slot per worker
+        // and a consensus slot, each (dimension + 1) doubles (weights then bias). The segment is an
+        // anonymous shared mapping created before the fork, so every worker sees the same memory.
+        struct SharedCoordinationState
+        {
+            std::atomic<int> arrivalCount;
+            std::atomic<int> generation;
+        };
+
+        // A sense-reversing barrier across the worker processes. The last worker to arrive runs
+        // onLastArrival (with every slot written and no worker reading yet), then releases the rest.
+        template <typename OnLastArrivalFunction>
+        void WaitAtBarrier(SharedCoordinationState* state, int numWorkers, OnLastArrivalFunction onLastArrival)
+        {
+            int myGeneration = state->generation.load();
+            if (state->arrivalCount.fetch_add(1) + 1 == numWorkers)
+            {
+                onLastArrival();
+                state->arrivalCount.store(0);
+                state->generation.fetch_add(1);
+            }
+            else
+            {
+                while (state->generation.load() == myGeneration)
+                {
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+        void CopyPredictorToSlot(const predictors::LinearPredictor& predictor, double* slot, size_t dimension)
+        {
+            const auto& weights = predictor.GetWeights();
+            size_t numWeights = std::min(static_cast<size_t>(weights.Size()), dimension);
+            for (size_t i = 0; i < dimension; ++i)
+            {
+                slot[i] = (i < numWeights) ? weights[i] : 0.0;
+            }
+            slot[dimension] = predictor.GetBias();
+        }
+
+        predictors::LinearPredictor MakePredictorFromSlot(const double* slot, size_t dimension)
+        {
+            predictors::LinearPredictor predictor(dimension);
+            auto& weights = predictor.GetWeights();
+            for (size_t i = 0; i < dimension; ++i)
+            {
+                weights[i] = slot[i];
+            }
+            predictor.GetBias() = slot[dimension];
+            return predictor;
+        }
+    }
+
+    predictors::LinearPredictor TrainParallelSGD(trainers::SGDTrainerBase& trainer, const data::AutoSupervisedDataset& dataset, size_t numWorkers, size_t numEpochs, bool verbose)
+    {
+        if (numWorkers == 0)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "numWorkers must be positive");
+        }
+
+        size_t dimension = dataset.NumFeatures();
+        size_t slotSize = dimension + 1; // weights plus bias
+        size_t segmentSize = sizeof(SharedCoordinationState) + (numWorkers + 1) * slotSize * sizeof(double);
+
+        auto segment = mmap(nullptr, segmentSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+        if (segment == MAP_FAILED)
+        {
+            throw utilities::LogicException(utilities::LogicExceptionErrors::illegalState, "unable to allocate shared memory for parallel SGD");
+        }
+
+        auto state = new (segment) SharedCoordinationState{};
+        double* slots = reinterpret_cast<double*>(static_cast<char*>(segment) + sizeof(SharedCoordinationState));
+        double* consensusSlot = slots + numWorkers * slotSize;
+
+        // fork the workers; each child breaks out of the loop knowing its index
+        size_t workerIndex = numWorkers;
+        std::vector<pid_t> workerPids;
+        for (size_t i = 0; i < numWorkers; ++i)
+        {
+            pid_t pid = fork();
+            if (pid < 0)
+            {
+                throw utilities::LogicException(utilities::LogicExceptionErrors::illegalState, "unable to fork worker process");
+            }
+            if (pid == 0)
+            {
+                workerIndex = i;
+                break;
+            }
+            workerPids.push_back(pid);
+        }
+
+        if (workerIndex < numWorkers)
+        {
+            // worker process: train on a contiguous shard of the examples
+            size_t numExamples = dataset.NumExamples();
+            size_t shardStart = workerIndex * numExamples / numWorkers;
+            size_t shardSize = (workerIndex + 1) * numExamples / numWorkers - shardStart;
+            trainer.SetDataset(dataset.GetAnyDataset(shardStart, shardSize));
+
+            for (size_t epoch = 0; epoch < numEpochs; ++epoch)
+            {
+                trainer.Update();
+                CopyPredictorToSlot(trainer.GetPredictor(), slots + workerIndex * slotSize, dimension);
+
+                WaitAtBarrier(state, static_cast<int>(numWorkers), [&]() {
+                    for (size_t j = 0; j < slotSize; ++j)
+                    {
+                        double sum = 0;
+                        for (size_t w = 0; w < numWorkers; ++w)
+                        {
+                            sum += slots[w * slotSize + j];
+                        }
+                        consensusSlot[j] = sum / numWorkers;
+                    }
+                });
+
+                trainer.SetPredictor(MakePredictorFromSlot(consensusSlot, dimension));
+                if (verbose && workerIndex == 0)
+                {
+                    std::cout << "Parallel SGD epoch " << (epoch + 1) << " of " << numEpochs << " averaged" << std::endl;
+                }
+            }
+
+            // exit without running the parent's atexit handlers or flushing its inherited buffers
+            _exit(0);
+        }
+
+        // coordinator process: wait for the workers, then read the final averaged weights
+        bool workerFailed = false;
+        for (auto pid : workerPids)
+        {
+            int status = 0;
+            waitpid(pid, &status, 0);
+            if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+            {
+                workerFailed = true;
+            }
+        }
+        if (workerFailed)
+        {
+            munmap(segment, segmentSize);
+            throw utilities::LogicException(utilities::LogicExceptionErrors::illegalState, "a parallel SGD worker process failed");
+        }
+
+        auto predictor = MakePredictorFromSlot(consensusSlot, dimension);
+        munmap(segment, segmentSize);
+        return predictor;
+    }
+}
+
+#else // _WIN32
+
+namespace ell
+{
+    predictors::LinearPredictor TrainParallelSGD(trainers::SGDTrainerBase&, const data::AutoSupervisedDataset&, size_t, size_t, bool)
+    {
+        throw utilities::LogicException(utilities::LogicExceptionErrors::notImplemented, "multi-worker training is only available on POSIX platforms");
+    }
+}
+
+#endif // _WIN32
@@ -7,8 +7,10 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "LinearTrainerArguments.h"
+#include "ParallelSGD.h"
 
 // utilities
+#include "AllocationTracker.h"
 #include "CommandLineParser.h"
 #include "Exception.h"
 #include "Files.h"
@@ -38,6 +40,7 @@
 
 // trainers
 #include "MeanCalculator.h"
+#include "TelemetryTrainer.h"
 
 // evaluators
 #include "Evaluator.h"
@@ -76,6 +79,11 @@ int main(int argc, char* argv[])
         // parse command line
         commandLineParser.Parse();
 
+        if (trainerArguments.logAllocationProfile)
+        {
+            utilities::EnableAllocationTracking(true);
+        }
+
         if (trainerArguments.verbose)
         {
             std::cout << "Linear Trainer" << std::endl;
@@ -89,7 +97,7 @@ int main(int argc, char* argv[])
         // load dataset
         if (trainerArguments.verbose) std::cout << "Loading data ..." << std::endl;
         auto stream = utilities::OpenIfstream(dataLoadArguments.inputDataFilename);
-        auto mappedDataset = common::GetMappedDataset(stream, map);
+        auto mappedDataset = common::GetMappedDataset(stream, map, dataLoadArguments.datasetLayout);
         auto mappedDatasetDimension = map.GetOutput(0).Size();
 
         // normalize data
@@ -141,17 +149,48 @@ int main(int argc, char* argv[])
         // create an evaluator
         auto evaluator = common::MakeEvaluator<PredictorType>(mappedDataset.GetAnyDataset(), evaluatorArguments, trainerArguments.lossFunctionArguments);
 
+        // optionally wrap the trainer with progress telemetry (multi-worker mode drives the SGD
+        // trainer directly, so the wrapper would get in the way there)
+        trainers::TelemetryTrainer<PredictorType>* telemetry = nullptr;
+        if (trainerArguments.telemetryInterval > 0 && linearTrainerArguments.numWorkers <= 1)
+        {
+            trainers::TelemetryTrainerParameters telemetryParameters{ trainerArguments.telemetryInterval, trainerArguments.telemetryJson, trainerArguments.numEpochs };
+            auto telemetryTrainer = trainers::MakeTelemetryTrainer(std::move(trainer), telemetryParameters, std::cerr, evaluator);
+            telemetry = telemetryTrainer.get();
+            trainer = std::move(telemetryTrainer);
+        }
+
         // Train the predictor
         if (trainerArguments.verbose) std::cout << "Training ..." << std::endl;
-        trainer->SetDataset(mappedDataset.GetAnyDataset());
-        
-        for (size_t epoch = 0; epoch < trainerArguments.numEpochs; ++epoch)
+        predictors::LinearPredictor predictor;
+        if (linearTrainerArguments.numWorkers > 1)
         {
-            trainer->Update();
-            evaluator->Evaluate(trainer->GetPredictor());
+            // multi-worker mode: forked workers each run epochs on a shard and mix weights through
+            // shared memory after every epoch; the evaluator only sees the final averaged predictor
+            auto sgdTrainer = dynamic_cast<trainers::SGDTrainerBase*>(trainer.get());
+            if (sgdTrainer == nullptr || linearTrainerArguments.algorithm != LinearTrainerArguments::Algorithm::SGD)
+            {
+                throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "multi-worker training requires the SGD algorithm");
+            }
+            predictor = TrainParallelSGD(*sgdTrainer, mappedDataset, linearTrainerArguments.numWorkers, trainerArguments.numEpochs, trainerArguments.verbose);
+            evaluator->Evaluate(predictor);
+        }
+        else
+        {
+            trainer->SetDataset(mappedDataset.GetAnyDataset());
+
+            for (size_t epoch = 0; epoch < trainerArguments.numEpochs; ++epoch)
+            {
+                trainer->Update();
+                evaluator->Evaluate(trainer->GetPredictor());
+            }
+
+            predictor = trainer->GetPredictor();
+        }
+        if (telemetry != nullptr)
+        {
+            telemetry->ReportNow();
         }
-        
-        predictors::LinearPredictor predictor(trainer->GetPredictor());
         predictor.Resize(mappedDatasetDimension);
 
         // Print loss and errors
@@ -172,6 +211,11 @@ int main(int argc, char* argv[])
             auto model = common::AppendNodeToModel<nodes::LinearPredictorNode, PredictorType>(map, predictor);
             common::SaveModel(model, modelSaveArguments.outputModelFilename);
         }
+
+        if (trainerArguments.logAllocationProfile)
+        {
+            utilities::ReportAllocations(std::cerr, utilities::GetAllocationSnapshot());
+        }
     }
     catch (const utilities::CommandLineParserPrintHelpException& exception)
     {
@@ -7,6 +7,7 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 // utilities
+#include "AllocationTracker.h"
 #include "CommandLineParser.h"
 #include "Exception.h"
 #include "Files.h"
@@ -78,6 +79,11 @@ int main(int argc, char* argv[])
         // parse command line
         commandLineParser.Parse();
 
+        if (trainerArguments.logAllocationProfile)
+        {
+            utilities::EnableAllocationTracking(true);
+        }
+
         if (protoNNTrainerArguments.verbose)
         {
             std::cout << "ProtoNN Trainer" << std::endl;
@@ -90,7 +96,7 @@ int main(int argc, char* argv[])
         mapLoadArguments.defaultInputSize = dataLoadArguments.parsedDataDimension;
         auto map = common::LoadMap(mapLoadArguments);
         auto stream = utilities::OpenIfstream(dataLoadArguments.inputDataFilename);
-        auto mappedDataset = common::GetMappedDataset(stream, map);
+        auto mappedDataset = common::GetMappedDataset(stream, map, dataLoadArguments.datasetLayout);
         auto mappedDatasetDimension = map.GetOutput(0).Size();
 
         // create protonn trainer
@@ -144,6 +150,11 @@ int main(int argc, char* argv[])
             auto model = common::AppendNodeToModel<nodes::ProtoNNPredictorNode, PredictorType>(map, predictor);
             common::SaveModel(model, modelSaveArguments.outputModelFilename);
         }
+
+        if (trainerArguments.logAllocationProfile)
+        {
+            utilities::ReportAllocations(std::cerr, utilities::GetAllocationSnapshot());
+        }
     }
     catch (const utilities::CommandLineParserPrintHelpException& exception)
     {
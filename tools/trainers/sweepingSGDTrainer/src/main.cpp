@@ -7,6 +7,7 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 // utilities
+#include "AllocationTracker.h"
 #include "CommandLineParser.h"
 #include "Exception.h"
 #include "Files.h"
@@ -70,6 +71,11 @@ int main(int argc, char* argv[])
         // parse command line
         commandLineParser.Parse();
 
+        if (trainerArguments.logAllocationProfile)
+        {
+            utilities::EnableAllocationTracking(true);
+        }
+
         // manually define regularization parameters to sweep over
         std::vector<double> regularization{ 1.0e-0, 1.0e-1, 1.0e-2, 1.0e-3, 1.0e-4, 1.0e-5, 1.0e-6 };
 
@@ -86,7 +92,7 @@ int main(int argc, char* argv[])
         // load dataset
         if (trainerArguments.verbose) std::cout << "Loading data ..." << std::endl;
         auto stream = utilities::OpenIfstream(dataLoadArguments.inputDataFilename);
-        auto mappedDataset = common::GetMappedDataset(stream, map);
+        auto mappedDataset = common::GetMappedDataset(stream, map, dataLoadArguments.datasetLayout);
         auto mappedDatasetDimension = map.GetOutput(0).Size();
 
         // get predictor type
@@ -106,14 +112,25 @@ int main(int argc, char* argv[])
             evaluatingTrainers.push_back(trainers::MakeEvaluatingTrainer(std::move(SGDTrainer), evaluators.back()));
         }
 
-        // create meta trainer
-        auto trainer = trainers::MakeSweepingTrainer(std::move(evaluatingTrainers));
+        // create meta trainer; run the sweep candidates concurrently and retire the
+        // worse-scoring half of the candidates after each epoch
+        trainers::SweepingTrainerParameters sweepParameters;
+        sweepParameters.parallel = true;
+        sweepParameters.successiveHalving = true;
+        trainers::SweepingTrainer<PredictorType> trainer(std::move(evaluatingTrainers), sweepParameters);
 
         // train
         if (trainerArguments.verbose) std::cout << "Training ..." << std::endl;
-        trainer->SetDataset(mappedDataset.GetAnyDataset());
-        trainer->Update();
-        predictors::LinearPredictor predictor(trainer->GetPredictor());
+        trainer.SetDataset(mappedDataset.GetAnyDataset());
+        for (size_t epoch = 0; epoch < trainerArguments.numEpochs; ++epoch)
+        {
+            trainer.Update();
+            if (trainerArguments.verbose)
+            {
+                std::cout << "Epoch " << epoch << ": " << trainer.NumActiveTrainers() << " active trainers" << std::endl;
+            }
+        }
+        predictors::LinearPredictor predictor(trainer.GetPredictor());
         predictor.Resize(mappedDatasetDimension);
 
         // print loss and errors
@@ -137,6 +154,11 @@ int main(int argc, char* argv[])
             auto model = common::AppendNodeToModel<nodes::LinearPredictorNode, PredictorType>(map, predictor);
             common::SaveModel(model, modelSaveArguments.outputModelFilename);
         }
+
+        if (trainerArguments.logAllocationProfile)
+        {
+            utilities::ReportAllocations(std::cerr, utilities::GetAllocationSnapshot());
+        }
     }
     catch (const utilities::CommandLineParserPrintHelpException& exception)
     {
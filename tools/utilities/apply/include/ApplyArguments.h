@@ -24,6 +24,27 @@ struct ApplyArguments
 
     /// <summary> Instead of raw output, report a summary. </summary>
     bool summarize = false;
+
+    /// <summary> If nonzero, process this many examples at a time through the compiled map's
+    /// batched compute, with reading, computing, and formatting overlapped on separate threads.
+    /// Zero selects the one-example-at-a-time path. </summary>
+    size_t batchSize = 0;
+
+    /// <summary> Path to a shard manifest, enabling distributed scoring. With --shardCount the
+    /// manifest is created; with --shard a single shard is scored; with --mergeShards the shard
+    /// outputs are merged in order. </summary>
+    std::string shardManifestFilename;
+
+    /// <summary> If nonzero, split the input dataset into this many byte-range shards, write the
+    /// manifest, and exit. </summary>
+    size_t shardCount = 0;
+
+    /// <summary> If nonnegative, score only this shard of the manifest, writing to the shard's
+    /// output file. </summary>
+    int shardIndex = -1;
+
+    /// <summary> Merge the ordered shard outputs named by the manifest and exit. </summary>
+    bool mergeShards = false;
 };
 
 /// <summary> Parsed command line arguments for the compile executable. </summary>
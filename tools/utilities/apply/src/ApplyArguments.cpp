@@ -25,11 +25,50 @@ void ParsedApplyArguments::AddArgs(utilities::CommandLineParser& parser)
         "s",
         "Aggregate and summarize map output.",
         false);
+
+    parser.AddOption(
+        batchSize,
+        "batchSize",
+        "bs",
+        "If nonzero, compile the map and apply it to this many examples at a time, overlapping read, compute, and write stages on separate threads. Not used in summarization mode.",
+        0);
+
+    parser.AddOption(
+        shardManifestFilename,
+        "shardManifest",
+        "sm",
+        "Path to a shard manifest for distributed scoring. Used together with --shardCount (create the manifest), --shard (score one shard), or --mergeShards (merge the ordered shard outputs).",
+        "");
+
+    parser.AddOption(
+        shardCount,
+        "shardCount",
+        "sc",
+        "If nonzero, split the input dataset into this many byte-range shards, write the shard manifest, and exit.",
+        0);
+
+    parser.AddOption(
+        shardIndex,
+        "shard",
+        "sh",
+        "If nonnegative, score only this shard of the manifest, writing to the shard's output file.",
+        -1);
+
+    parser.AddOption(
+        mergeShards,
+        "mergeShards",
+        "ms",
+        "Merge the ordered shard outputs named by the manifest into the output and exit.",
+        false);
 }
 
 utilities::CommandLineParseResult ParsedApplyArguments::PostProcess(const utilities::CommandLineParser& parser)
 {
     std::vector<std::string> errors;
+    if ((shardCount != 0 || shardIndex >= 0 || mergeShards) && shardManifestFilename.empty())
+    {
+        errors.push_back("--shardCount, --shard, and --mergeShards require --shardManifest");
+    }
     return errors;
 }
 }
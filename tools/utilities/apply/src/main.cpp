@@ -12,7 +12,9 @@
 #include "CommandLineParser.h"
 #include "Exception.h"
 #include "Files.h"
+#include "FloatToString.h"
 #include "OutputStreamImpostor.h"
+#include "SpscRingBuffer.h"
 
 // data
 #include "DataVector.h"
@@ -29,18 +31,158 @@
 #include "DataSaveArguments.h"
 #include "LoadModel.h"
 #include "MapLoadArguments.h"
+#include "ShardedDataset.h"
 
 // model
 #include "DynamicMap.h"
+#include "IRCompiledMap.h"
+#include "IRMapCompiler.h"
 #include "OutputNode.h"
 
 // stl
+#include <algorithm>
+#include <fstream>
 #include <iostream>
+#include <memory>
+#include <sstream>
 #include <stdexcept>
 #include <string>
+#include <thread>
+#include <vector>
 
 using namespace ell;
 
+namespace
+{
+    // A batch of examples in flight through the read -> compute -> write pipeline
+    struct ExampleBatch
+    {
+        std::vector<data::WeightLabel> metadata;
+        std::vector<double> inputs; // row-major, one row of map input size per example
+        std::vector<double> outputs; // row-major, one row of map output size per example
+    };
+
+    using BatchQueue = utilities::SpscRingBuffer<std::unique_ptr<ExampleBatch>>;
+
+    void PushBatch(BatchQueue& queue, std::unique_ptr<ExampleBatch> batch)
+    {
+        while (!queue.TryPush(std::move(batch)))
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    std::unique_ptr<ExampleBatch> PopBatch(BatchQueue& queue)
+    {
+        std::unique_ptr<ExampleBatch> batch;
+        while (!queue.TryPop(batch))
+        {
+            std::this_thread::yield();
+        }
+        return batch;
+    }
+
+    // Applies a compiled map to the dataset in batches, overlapping the read, compute, and
+    // write stages: a reader thread parses examples into dense batches, the calling thread
+    // runs the compiled map's batched compute, and a writer thread formats the output lines
+    // without going through iostream formatting. An empty batch signals end of input.
+    void ApplyBatched(model::DynamicMap& map, data::AutoSupervisedExampleIterator& exampleIterator, std::ostream& outputStream, size_t batchSize)
+    {
+        model::IRMapCompiler compiler;
+        auto compiledMap = compiler.Compile(map);
+        auto inputSize = map.GetInputSize();
+        auto outputSize = map.GetOutputSize();
+
+        BatchQueue toCompute(4);
+        BatchQueue toWrite(4);
+
+        std::thread readerThread([&]() {
+            for (;;)
+            {
+                auto batch = std::make_unique<ExampleBatch>();
+                while (exampleIterator.IsValid() && batch->metadata.size() < batchSize)
+                {
+                    auto example = exampleIterator.Get();
+                    batch->metadata.push_back(example.GetMetadata());
+                    auto values = example.GetDataVector().ToArray(inputSize); // zero-padded (or truncated) to the map's input size
+                    batch->inputs.insert(batch->inputs.end(), values.begin(), values.end());
+                    exampleIterator.Next();
+                }
+                bool done = batch->metadata.empty();
+                PushBatch(toCompute, std::move(batch));
+                if (done)
+                {
+                    break;
+                }
+            }
+        });
+
+        std::thread writerThread([&]() {
+            std::string line;
+            for (;;)
+            {
+                auto batch = PopBatch(toWrite);
+                auto count = batch->metadata.size();
+                if (count == 0)
+                {
+                    break;
+                }
+                for (size_t rowIndex = 0; rowIndex < count; ++rowIndex)
+                {
+                    // same format as Example::Print: "(weight, label)" then tab-separated index:value pairs
+                    const auto& metadata = batch->metadata[rowIndex];
+                    line.clear();
+                    line += '(';
+                    utilities::AppendDouble(line, metadata.weight);
+                    line += ", ";
+                    utilities::AppendDouble(line, metadata.label);
+                    line += ')';
+                    line += '\t';
+                    const double* row = batch->outputs.data() + rowIndex * outputSize;
+                    bool first = true;
+                    for (size_t index = 0; index < outputSize; ++index)
+                    {
+                        if (row[index] != 0)
+                        {
+                            if (!first)
+                            {
+                                line += '\t';
+                            }
+                            first = false;
+                            line += std::to_string(index);
+                            line += ':';
+                            utilities::AppendDouble(line, row[index]);
+                        }
+                    }
+                    line += '\n';
+                    outputStream.write(line.data(), line.size());
+                }
+            }
+        });
+
+        // compute stage, on the calling thread
+        for (;;)
+        {
+            auto batch = PopBatch(toCompute);
+            auto count = batch->metadata.size();
+            if (count > 0)
+            {
+                batch->outputs.resize(count * outputSize);
+                compiledMap.ComputeBatch<double, double>(batch->inputs.data(), batch->outputs.data(), static_cast<int>(count));
+            }
+            bool done = (count == 0);
+            PushBatch(toWrite, std::move(batch));
+            if (done)
+            {
+                break;
+            }
+        }
+
+        readerThread.join();
+        writerThread.join();
+    }
+}
+
 int main(int argc, char* argv[])
 {
     try
@@ -62,11 +204,39 @@ int main(int argc, char* argv[])
         // parse command line
         commandLineParser.Parse();
 
+        // distributed scoring modes that don't need the map: create the shard manifest, or
+        // merge the ordered shard outputs back into one stream
+        if (applyArguments.shardCount != 0)
+        {
+            auto manifest = common::CreateShardManifest(dataLoadArguments.inputDataFilename, applyArguments.shardCount, dataLoadArguments.inputDataFilename + ".out");
+            common::SaveShardManifest(manifest, applyArguments.shardManifestFilename);
+            return 0;
+        }
+        if (applyArguments.mergeShards)
+        {
+            auto manifest = common::LoadShardManifest(applyArguments.shardManifestFilename);
+            common::MergeShardOutputs(manifest, dataSaveArguments.outputDataStream);
+            return 0;
+        }
+
         // load map
         auto map = common::LoadMap(mapLoadArguments);
 
-        // get data iterator
-        auto stream = utilities::OpenIfstream(dataLoadArguments.inputDataFilename);
+        // get data iterator; shard workers iterate over their shard's byte range and write to
+        // the shard's output file, so merged outputs come back in dataset order
+        std::ifstream fileStream;
+        std::istringstream shardStream;
+        if (applyArguments.shardIndex >= 0)
+        {
+            auto manifest = common::LoadShardManifest(applyArguments.shardManifestFilename);
+            shardStream.str(common::ReadShard(manifest, static_cast<size_t>(applyArguments.shardIndex)));
+            dataSaveArguments.outputDataStream = utilities::OutputStreamImpostor(manifest.shards[applyArguments.shardIndex].outputFilename);
+        }
+        else
+        {
+            fileStream = utilities::OpenIfstream(dataLoadArguments.inputDataFilename);
+        }
+        std::istream& stream = (applyArguments.shardIndex >= 0) ? static_cast<std::istream&>(shardStream) : fileStream;
         auto exampleIterator = common::GetExampleIterator(stream);
 
         // get output stream
@@ -117,6 +287,10 @@ int main(int argc, char* argv[])
         }
 
         // output new dataset mode
+        else if (applyArguments.batchSize != 0)
+        {
+            ApplyBatched(map, exampleIterator, outputStream, applyArguments.batchSize);
+        }
         else
         {
             while (exampleIterator.IsValid())
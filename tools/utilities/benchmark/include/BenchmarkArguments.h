@@ -0,0 +1,56 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     BenchmarkArguments.h (benchmark)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// utilities
+#include "CommandLineParser.h"
+
+// stl
+#include <string>
+
+namespace ell
+{
+/// <summary> Command line arguments for the benchmark executable. </summary>
+struct BenchmarkArguments
+{
+    /// <summary> The number of timed batches to run. </summary>
+    size_t numBatches = 10;
+
+    /// <summary> The number of examples per batch. </summary>
+    size_t batchSize = 1000;
+
+    /// <summary> The number of untimed warmup batches to run before measuring. </summary>
+    size_t numWarmupBatches = 1;
+
+    /// <summary> Skip the reference (interpreted) compute path. </summary>
+    bool skipReference = false;
+
+    /// <summary> Skip the compiled (jitted) compute path. </summary>
+    bool skipCompiled = false;
+
+    /// <summary> The seed for the random input generator. </summary>
+    std::string randomSeedString = "123";
+};
+
+/// <summary> Parsed command line arguments for the benchmark executable. </summary>
+struct ParsedBenchmarkArguments : public BenchmarkArguments, public utilities::ParsedArgSet
+{
+    /// <summary> Adds the arguments to the command line parser. </summary>
+    ///
+    /// <param name="parser"> [in,out] The parser. </param>
+    virtual void AddArgs(utilities::CommandLineParser& parser) override;
+
+    /// <summary> Check the parsed arguments. </summary>
+    ///
+    /// <param name="parser"> The parser. </param>
+    ///
+    /// <returns> An utilities::CommandLineParseResult. </returns>
+    virtual utilities::CommandLineParseResult PostProcess(const utilities::CommandLineParser& parser) override;
+};
+}
@@ -0,0 +1,71 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     BenchmarkArguments.cpp (benchmark)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "BenchmarkArguments.h"
+
+namespace ell
+{
+void ParsedBenchmarkArguments::AddArgs(utilities::CommandLineParser& parser)
+{
+    parser.AddOption(
+        numBatches,
+        "numBatches",
+        "nb",
+        "The number of timed batches to run.",
+        10);
+
+    parser.AddOption(
+        batchSize,
+        "batchSize",
+        "bs",
+        "The number of examples per batch.",
+        1000);
+
+    parser.AddOption(
+        numWarmupBatches,
+        "numWarmupBatches",
+        "wb",
+        "The number of untimed warmup batches to run before measuring.",
+        1);
+
+    parser.AddOption(
+        skipReference,
+        "skipReference",
+        "sr",
+        "Skip the reference (interpreted) compute path.",
+        false);
+
+    parser.AddOption(
+        skipCompiled,
+        "skipCompiled",
+        "sc",
+        "Skip the compiled (jitted) compute path.",
+        false);
+
+    parser.AddOption(
+        randomSeedString,
+        "randomSeedString",
+        "seed",
+        "The seed for the random input generator.",
+        "123");
+}
+
+utilities::CommandLineParseResult ParsedBenchmarkArguments::PostProcess(const utilities::CommandLineParser& parser)
+{
+    std::vector<std::string> errors;
+    if (numBatches == 0)
+    {
+        errors.push_back("numBatches must be positive");
+    }
+    if (batchSize == 0)
+    {
+        errors.push_back("batchSize must be positive");
+    }
+    return errors;
+}
+}
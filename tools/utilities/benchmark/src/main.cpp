@@ -0,0 +1,226 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     main.cpp (benchmark)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "BenchmarkArguments.h"
+
+// utilities
+#include "CommandLineParser.h"
+#include "Exception.h"
+#include "OutputStreamImpostor.h"
+#include "RandomEngines.h"
+
+// common
+#include "DataSaveArguments.h"
+#include "LoadModel.h"
+#include "MapLoadArguments.h"
+
+// model
+#include "DynamicMap.h"
+#include "IRCompiledMap.h"
+#include "IRMapCompiler.h"
+
+// stl
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#if !defined(WIN32) && !defined(_WIN32)
+#include <sys/resource.h>
+#endif
+
+using namespace ell;
+
+namespace
+{
+    /// <summary> The timings measured for one compute path. </summary>
+    struct PathTimings
+    {
+        double nsPerExample = 0;
+        double cyclesPerExample = 0;
+    };
+
+    // Reads the processor's cycle counter, or returns 0 on architectures where it isn't available.
+    uint64_t GetCycleCount()
+    {
+#if (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))) || defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        return 0;
+#endif
+    }
+
+    // Returns the peak resident set size of this process in bytes, or 0 if unknown.
+    uint64_t GetPeakMemoryBytes()
+    {
+#if defined(WIN32) || defined(_WIN32)
+        return 0;
+#else
+        rusage usage;
+        getrusage(RUSAGE_SELF, &usage);
+#if defined(__APPLE__)
+        return static_cast<uint64_t>(usage.ru_maxrss); // reported in bytes
+#else
+        return static_cast<uint64_t>(usage.ru_maxrss) * 1024; // reported in kilobytes
+#endif
+#endif
+    }
+
+    // Runs the map over the batch repeatedly and reports the per-example timings. Works on both
+    // DynamicMap and IRCompiledMap, so the reference and compiled paths share one driver.
+    PathTimings TimeMap(const model::DynamicMap& map, const std::vector<std::vector<double>>& batch, const BenchmarkArguments& benchmarkArguments)
+    {
+        auto computeBatch = [&map, &batch]() {
+            for (const auto& input : batch)
+            {
+                map.SetInputValue(0, input);
+                map.ComputeOutput<double>(0);
+            }
+        };
+
+        for (size_t i = 0; i < benchmarkArguments.numWarmupBatches; ++i)
+        {
+            computeBatch();
+        }
+
+        auto startTime = std::chrono::steady_clock::now();
+        auto startCycles = GetCycleCount();
+        for (size_t i = 0; i < benchmarkArguments.numBatches; ++i)
+        {
+            computeBatch();
+        }
+        auto elapsedCycles = GetCycleCount() - startCycles;
+        auto elapsedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime).count();
+
+        double numExamples = static_cast<double>(benchmarkArguments.numBatches * benchmarkArguments.batchSize);
+        PathTimings timings;
+        timings.nsPerExample = elapsedNs / numExamples;
+        timings.cyclesPerExample = elapsedCycles / numExamples;
+        return timings;
+    }
+
+    std::string JsonEscape(const std::string& s)
+    {
+        std::string result;
+        for (auto ch : s)
+        {
+            if (ch == '\\' || ch == '"')
+            {
+                result.push_back('\\');
+            }
+            result.push_back(ch);
+        }
+        return result;
+    }
+
+    void WriteTimings(std::ostream& stream, const std::string& name, const PathTimings& timings)
+    {
+        stream << "    \"" << name << "\": { \"nsPerExample\": " << timings.nsPerExample << ", \"cyclesPerExample\": " << timings.cyclesPerExample << " },\n";
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    try
+    {
+        // create a command line parser
+        utilities::CommandLineParser commandLineParser(argc, argv);
+
+        // add arguments to the command line parser
+        common::ParsedMapLoadArguments mapLoadArguments;
+        common::ParsedDataSaveArguments dataSaveArguments;
+        ParsedBenchmarkArguments benchmarkArguments;
+
+        commandLineParser.AddOptionSet(mapLoadArguments);
+        commandLineParser.AddOptionSet(dataSaveArguments);
+        commandLineParser.AddOptionSet(benchmarkArguments);
+
+        // parse command line
+        commandLineParser.Parse();
+
+        // load map
+        auto map = common::LoadMap(mapLoadArguments);
+
+        // generate a batch of random inputs (the same batch is reused for every iteration, so the
+        // timings measure compute and not input generation)
+        auto engine = utilities::GetRandomEngine(benchmarkArguments.randomSeedString);
+        std::uniform_real_distribution<double> distribution(-1, 1);
+        std::vector<std::vector<double>> batch(benchmarkArguments.batchSize);
+        for (auto& input : batch)
+        {
+            input.resize(map.GetInputSize());
+            for (auto& value : input)
+            {
+                value = distribution(engine);
+            }
+        }
+
+        // time the reference and compiled paths
+        PathTimings referenceTimings;
+        if (!benchmarkArguments.skipReference)
+        {
+            referenceTimings = TimeMap(map, batch, benchmarkArguments);
+        }
+
+        PathTimings compiledTimings;
+        if (!benchmarkArguments.skipCompiled)
+        {
+            model::IRMapCompiler compiler;
+            auto compiledMap = compiler.Compile(map);
+            compiledTimings = TimeMap(compiledMap, batch, benchmarkArguments);
+        }
+
+        // report the results as JSON
+        auto& outputStream = dataSaveArguments.outputDataStream;
+        outputStream << "{\n";
+        outputStream << "    \"map\": \"" << JsonEscape(mapLoadArguments.inputMapFilename.empty() ? mapLoadArguments.inputModelFilename : mapLoadArguments.inputMapFilename) << "\",\n";
+        outputStream << "    \"inputSize\": " << map.GetInputSize() << ",\n";
+        outputStream << "    \"outputSize\": " << map.GetOutputSize() << ",\n";
+        outputStream << "    \"batchSize\": " << benchmarkArguments.batchSize << ",\n";
+        outputStream << "    \"numBatches\": " << benchmarkArguments.numBatches << ",\n";
+        if (!benchmarkArguments.skipReference)
+        {
+            WriteTimings(outputStream, "reference", referenceTimings);
+        }
+        if (!benchmarkArguments.skipCompiled)
+        {
+            WriteTimings(outputStream, "compiled", compiledTimings);
+        }
+        outputStream << "    \"peakMemoryBytes\": " << GetPeakMemoryBytes() << "\n";
+        outputStream << "}\n";
+    }
+    catch (const utilities::CommandLineParserPrintHelpException& exception)
+    {
+        std::cout << exception.GetHelpText() << std::endl;
+        return 0;
+    }
+    catch (const utilities::CommandLineParserErrorException& exception)
+    {
+        std::cerr << "Command line parse error:" << std::endl;
+        for (const auto& error : exception.GetParseErrors())
+        {
+            std::cerr << error.GetMessage() << std::endl;
+        }
+        return 1;
+    }
+    catch (const utilities::Exception& exception)
+    {
+        std::cerr << "exception: " << exception.GetMessage() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
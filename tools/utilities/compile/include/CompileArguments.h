@@ -28,6 +28,7 @@ struct CompileArguments
         ir,
         bitcode,
         assembly,
+        objectCode,
         swigInterface
     };
     OutputType outputType;
@@ -41,6 +42,15 @@ struct CompileArguments
     /// <summary> true to optimize. </summary>
     bool optimize = false;
 
+    /// <summary> true to use fast approximate math functions in the emitted code. </summary>
+    bool fastMath = false;
+
+    /// <summary> true to emit per-node performance instrumentation and the profiling API. </summary>
+    bool profile = false;
+
+    /// <summary> With profile, instrument only every Nth invocation (1 instruments every invocation). </summary>
+    size_t profileSampleInterval = 1;
+
     /// <summary> Name of the compiled function. </summary>
     std::string compiledFunctionName;
 
@@ -50,9 +60,27 @@ struct CompileArguments
     /// <summary> An output stream for the output data file. </summary>
     utilities::OutputStreamImpostor outputCodeStream;
 
-    /// <summary> If output type is ASM then we need a target cpu (cortex-m0 or cortex-m4). </summary>
+    /// <summary> If output type is 'asm' or 'obj' then we need a target cpu (cortex-m0 or cortex-m4). </summary>
     std::string cpu = "";
 
+    /// <summary> Optional path for a generated C header declaring the compiled API. </summary>
+    std::string outputHeaderFilename;
+
+    /// <summary> Bits per codebook index for weight clustering (0 disables, otherwise 4, 6, or 8). </summary>
+    size_t weightClusterBits = 0;
+
+    /// <summary> Optional path to a kernel tuning database file, merged over the shipped per-device defaults. </summary>
+    std::string tuningDatabaseFilename;
+
+    /// <summary> Emitted machine-code budget in bytes (0 disables). Shares node function bodies, caps unrolling, and prints a per-node-type size report. </summary>
+    size_t codeSizeBudget = 0;
+
+    /// <summary> true to emit Q-format integer arithmetic instead of float ops, for targets without an FPU. </summary>
+    bool fixedPoint = false;
+
+    /// <summary> Optional path to a data file run through the map to calibrate per-port fixed-point formats. </summary>
+    std::string calibrationDataFilename;
+
     /// <summary> Name of the compiled module. </summary>
     std::string compiledModuleName;
 };
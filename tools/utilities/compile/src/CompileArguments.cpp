@@ -19,8 +19,8 @@ void ParsedCompileArguments::AddArgs(utilities::CommandLineParser& parser)
         outputType,
         "outputType",
         "o",
-        "Choice of output type: refinedMap, compiledMap, ir, bc, asm, swig",
-        { { "refinedMap", OutputType::refinedMap }, { "compiledMap", OutputType::compiledMap }, { "ir", OutputType::ir }, { "bc", OutputType::bitcode }, { "asm", OutputType::assembly }, { "swig", OutputType::swigInterface } },
+        "Choice of output type: refinedMap, compiledMap, ir, bc, asm, obj, swig",
+        { { "refinedMap", OutputType::refinedMap }, { "compiledMap", OutputType::compiledMap }, { "ir", OutputType::ir }, { "bc", OutputType::bitcode }, { "asm", OutputType::assembly }, { "obj", OutputType::objectCode }, { "swig", OutputType::swigInterface } },
         "ir");
 
     parser.AddOption(
@@ -37,6 +37,27 @@ void ParsedCompileArguments::AddArgs(utilities::CommandLineParser& parser)
         "Optimize output code",
         false);
 
+    parser.AddOption(
+        fastMath,
+        "fastMath",
+        "fm",
+        "Use fast approximate math functions (exp accurate to about 1e-6 relative error) in the emitted code",
+        false);
+
+    parser.AddOption(
+        profile,
+        "profile",
+        "p",
+        "Emit per-node performance instrumentation and the profiling API functions",
+        false);
+
+    parser.AddOption(
+        profileSampleInterval,
+        "profileInterval",
+        "pi",
+        "With --profile, instrument only every Nth invocation; unsampled invocations skip the clock and hardware counter reads, so the counters keep aggregating real per-node latencies at production overhead. 1 instruments every invocation",
+        1);
+
     parser.AddOption(
         compiledFunctionName,
         "compiledFunctionName",
@@ -62,15 +83,67 @@ void ParsedCompileArguments::AddArgs(utilities::CommandLineParser& parser)
         cpu,
         "cpu",
         "cpu",
-        "The CPU target for generating assembly code (only valid if outputType is 'asm')",
+        "The CPU target for generating machine code (only valid if outputType is 'asm' or 'obj')",
         { { "cortex-m0", "cortex-m0" }, { "cortex-m4", "cortex-m4" } },
         "cortex-m0");
+
+    parser.AddOption(
+        outputHeaderFilename,
+        "header",
+        "oh",
+        "Path for a generated C header declaring the compiled API, so the output of 'obj' or 'asm' can be linked directly into a client build",
+        "");
+
+    parser.AddOption(
+        weightClusterBits,
+        "weightClusterBits",
+        "wcb",
+        "Cluster large floating-point constants into a shared codebook and store packed indices of this many bits (4, 6, or 8); 0 disables clustering. Prints an accuracy-vs-size report.",
+        0);
+
+    parser.AddOption(
+        tuningDatabaseFilename,
+        "tuningDatabase",
+        "td",
+        "Path to a kernel tuning database file whose entries override the shipped per-device defaults",
+        "");
+
+    parser.AddOption(
+        codeSizeBudget,
+        "codeSizeBudget",
+        "csb",
+        "Emitted machine-code budget in bytes (0 disables). Node function bodies are shared across identically-configured nodes, loop unrolling is capped, and a per-node-type size report is printed",
+        0);
+
+    parser.AddOption(
+        fixedPoint,
+        "fixedPoint",
+        "fp",
+        "Emit Q-format integer arithmetic instead of float ops, for targets without an FPU; use with --calibrationData",
+        false);
+
+    parser.AddOption(
+        calibrationDataFilename,
+        "calibrationData",
+        "cd",
+        "Path to a data file run through the map to calibrate per-port fixed-point formats",
+        "");
 }
 
 utilities::CommandLineParseResult ParsedCompileArguments::PostProcess(const utilities::CommandLineParser& parser)
 {
     std::vector<std::string> errors;
 
+    if (weightClusterBits != 0 && weightClusterBits != 4 && weightClusterBits != 6 && weightClusterBits != 8)
+    {
+        errors.push_back("weightClusterBits must be 0, 4, 6, or 8");
+    }
+
+    if (calibrationDataFilename != "" && !utilities::IsFileReadable(calibrationDataFilename))
+    {
+        errors.push_back("couldn't read calibration data file");
+    }
+
     if (outputType == OutputType::swigInterface)
     {
         if (outputFilename == "null" || outputFilename == "")
@@ -78,6 +151,14 @@ utilities::CommandLineParseResult ParsedCompileArguments::PostProcess(const util
             errors.push_back("outputFilename required for outputType 'swig'");
         }
     }
+    else if (outputType == OutputType::objectCode)
+    {
+        // object code is binary, so it must go to a real file rather than a stream
+        if (outputFilename == "null" || outputFilename == "")
+        {
+            errors.push_back("outputFilename required for outputType 'obj'");
+        }
+    }
     else
     {
         // create output stream impostor for code
@@ -11,11 +11,17 @@
 // utilities
 #include "CommandLineParser.h"
 #include "Exception.h"
+#include "Files.h"
 
 // dataset
 #include "Dataset.h"
 
+// emitters
+#include "IRAssemblyWriter.h"
+
 // common
+#include "DataLoaders.h"
+#include "FixedPointCalibration.h"
 #include "LoadModel.h"
 #include "MapLoadArguments.h"
 
@@ -26,8 +32,16 @@
 #include "IRSteppableMapCompiler.h"
 #include "OutputNode.h"
 
+// nodes
+#include "ConstantNode.h"
+#include "EliminateTypeCasts.h"
+#include "OptimizeReorderDataNodes.h"
+#include "SkipSoftmaxOnArgMax.h"
+#include "WeightClustering.h"
+
 // stl
 #include <chrono>
+#include <iomanip>
 #include <iostream>
 #include <stdexcept>
 #include <string>
@@ -36,15 +50,87 @@ using namespace ell;
 
 typedef std::function<void(const double*, double*)> FnInputOutput;
 
+emitters::MachineCodeOutputOptions GetMachineCodeOutputOptions(const CompileArguments& compileArguments)
+{
+    emitters::MachineCodeOutputOptions options;
+    options.optimizationLevel = emitters::OptimizationLevel::Default;
+    options.targetDevice.cpu = compileArguments.cpu;
+    if ("cortex-m4" == compileArguments.cpu)
+    {
+        options.targetDevice.triple = "arm-none-eabi";
+        options.targetDevice.features = "+armv7e-m,+v7,soft-float";
+    }
+    if ("cortex-m0" == compileArguments.cpu || "cortex-m4" == compileArguments.cpu)
+    {
+        // bare-metal parts get the freestanding runtime profile: external clock/callback shims
+        // and a static arena instead of libc time and malloc
+        options.targetDevice.freestanding = true;
+    }
+    return options;
+}
+
+template <typename ValueType>
+void ReportClusteredConstants(const model::Model& model, size_t bitsPerIndex, size_t threshold, size_t& totalOriginalBytes, size_t& totalCompressedBytes)
+{
+    for (auto node : model.GetNodesByType<nodes::ConstantNode<ValueType>>())
+    {
+        const auto& values = node->GetValues();
+        if (values.size() < threshold)
+        {
+            continue;
+        }
+        auto clustering = nodes::ClusterWeights(values, static_cast<size_t>(1) << bitsPerIndex);
+        auto packedIndices = nodes::PackWeightIndices(clustering.indices, bitsPerIndex);
+        auto originalBytes = values.size() * sizeof(ValueType);
+        auto compressedBytes = clustering.codebook.size() * sizeof(ValueType) + packedIndices.size() * sizeof(int);
+        totalOriginalBytes += originalBytes;
+        totalCompressedBytes += compressedBytes;
+        std::cerr << "  node " << node->GetId() << ": " << values.size() << " weights, "
+                  << originalBytes << " -> " << compressedBytes << " bytes ("
+                  << std::fixed << std::setprecision(1) << static_cast<double>(originalBytes) / compressedBytes << "x), "
+                  << std::scientific << std::setprecision(3)
+                  << "max abs error " << clustering.maxAbsoluteError << ", mean abs error " << clustering.meanAbsoluteError << "\n";
+    }
+}
+
+// Prints the accuracy-vs-size report for weight clustering: one line per clustered constant and a
+// total. The report goes to stderr so it doesn't mix with code written to stdout.
+void PrintWeightClusterReport(const model::Model& model, const model::MapCompilerParameters& settings)
+{
+    std::cerr << "Weight clustering (" << settings.weightClusterBits << "-bit indices, threshold "
+              << settings.weightClusterThreshold << " elements):\n";
+    size_t totalOriginalBytes = 0;
+    size_t totalCompressedBytes = 0;
+    ReportClusteredConstants<float>(model, settings.weightClusterBits, settings.weightClusterThreshold, totalOriginalBytes, totalCompressedBytes);
+    ReportClusteredConstants<double>(model, settings.weightClusterBits, settings.weightClusterThreshold, totalOriginalBytes, totalCompressedBytes);
+    if (totalOriginalBytes == 0)
+    {
+        std::cerr << "  no constants above the clustering threshold\n";
+    }
+    else
+    {
+        std::cerr << "  total: " << totalOriginalBytes << " -> " << totalCompressedBytes << " bytes ("
+                  << std::fixed << std::setprecision(1) << static_cast<double>(totalOriginalBytes) / totalCompressedBytes << "x)\n";
+    }
+}
+
 template <typename MapType, typename MapCompilerType>
 void ProduceMapOutput(const common::MapLoadArguments& mapLoadArguments, ParsedCompileArguments& compileArguments, MapType& map)
 {
     // create the desired output type
     if (CompileArguments::OutputType::refinedMap == compileArguments.outputType)
     {
-        model::TransformContext context;
-        map.Refine(context, compileArguments.maxRefinementIterations);
-        common::SaveMap(map, compileArguments.outputCodeStream);
+        if (utilities::GetFileExtension(compileArguments.outputFilename, true) == common::GetRefinedMapFileExtension())
+        {
+            // stamped, compilation-ready export: loaders verify the version stamp and skip refinement
+            common::SaveRefinedMap(map, compileArguments.outputCodeStream, compileArguments.maxRefinementIterations);
+        }
+        else
+        {
+            model::TransformContext context;
+            map.Refine(context, compileArguments.maxRefinementIterations);
+            common::SaveMap(map, compileArguments.outputCodeStream);
+        }
     }
     else
     {
@@ -52,6 +138,44 @@ void ProduceMapOutput(const common::MapLoadArguments& mapLoadArguments, ParsedCo
         settings.mapFunctionName = compileArguments.compiledFunctionName;
         settings.moduleName = compileArguments.compiledModuleName;
         settings.compilerSettings.optimize = compileArguments.optimize;
+        settings.compilerSettings.useFastMath = compileArguments.fastMath;
+        settings.profile = compileArguments.profile;
+        settings.profileSampleInterval = compileArguments.profileSampleInterval;
+        settings.compilerSettings.tuningDatabaseFilename = compileArguments.tuningDatabaseFilename;
+        settings.weightClusterBits = compileArguments.weightClusterBits;
+        settings.codeSizeBudget = compileArguments.codeSizeBudget;
+        settings.compilerSettings.useFixedPoint = compileArguments.fixedPoint;
+        settings.compilerSettings.targetDevice.cpu = compileArguments.cpu;
+        if ("cortex-m0" == compileArguments.cpu || "cortex-m4" == compileArguments.cpu)
+        {
+            // emit the freestanding runtime profile so the generated module links against firmware
+            // shims instead of libc; see IRRuntime
+            settings.compilerSettings.targetDevice.freestanding = true;
+        }
+
+        if (compileArguments.fixedPoint && compileArguments.calibrationDataFilename != "")
+        {
+            // run the calibration data through the map to pick per-port Q formats
+            auto calibrationStream = utilities::OpenIfstream(compileArguments.calibrationDataFilename);
+            settings.portQFormats = common::CalibrateQFormats(map, common::GetExampleIterator(calibrationStream), settings.compilerSettings.fixedPointWordBits);
+        }
+
+        if (settings.weightClusterBits != 0)
+        {
+            PrintWeightClusterReport(map.GetModel(), settings);
+        }
+
+        if (compileArguments.optimize)
+        {
+            // refine now and collapse the redundant layout transitions the layer refinements
+            // insert; compiling the already-refined map below is then a no-op refinement
+            model::TransformContext context;
+            map.Refine(context, compileArguments.maxRefinementIterations);
+            map.Transform(nodes::OptimizeReorderDataNodes, context);
+            map.Transform(nodes::SkipSoftmaxOnArgMax, context);
+            map.Transform(nodes::EliminateTypeCasts, context);
+            map.Prune(); // drop the casts (and anything else) left unread by the transforms
+        }
 
         MapCompilerType compiler(settings);
         auto compiledMap = compiler.Compile(map);
@@ -72,16 +196,17 @@ void ProduceMapOutput(const common::MapLoadArguments& mapLoadArguments, ParsedCo
 
             case CompileArguments::OutputType::assembly:
             {
-                emitters::MachineCodeOutputOptions compileAssemblyOptions;
-                compileAssemblyOptions.optimizationLevel = emitters::OptimizationLevel::Default;
-                compileAssemblyOptions.targetDevice.cpu = compileArguments.cpu;
-                if ("cortex-m4" == compileArguments.cpu)
-                {
-                    compileAssemblyOptions.targetDevice.triple = "arm-none-eabi";
-                    compileAssemblyOptions.targetDevice.features = "+armv7e-m,+v7,soft-float";
-                }
-
+                auto compileAssemblyOptions = GetMachineCodeOutputOptions(compileArguments);
                 compiledMap.WriteCode(compileArguments.outputCodeStream, emitters::ModuleOutputFormat::assembly, compileAssemblyOptions);
+                break;
+            }
+
+            case CompileArguments::OutputType::objectCode:
+            {
+                // write straight to the file so the stream is opened in binary mode
+                auto compileObjectOptions = GetMachineCodeOutputOptions(compileArguments);
+                compiledMap.WriteCode(compileArguments.outputFilename, emitters::ModuleOutputFormat::objectCode, compileObjectOptions);
+                break;
             }
 
             case CompileArguments::OutputType::swigInterface:
@@ -91,6 +216,21 @@ void ProduceMapOutput(const common::MapLoadArguments& mapLoadArguments, ParsedCo
             default:
                 throw emitters::EmitterException(emitters::EmitterError::notSupported);
         }
+
+        // optionally write a C header next to the main output, so an object file (or assembly)
+        // can be linked into a client build without any further tooling
+        if (!compileArguments.outputHeaderFilename.empty())
+        {
+            compiledMap.WriteCodeHeader(compileArguments.outputHeaderFilename);
+        }
+
+        // with a code-size budget, measure the compiled module against it; the report goes to
+        // stderr so it doesn't mix with code written to stdout
+        if (compileArguments.codeSizeBudget != 0)
+        {
+            auto sizeReportOptions = GetMachineCodeOutputOptions(compileArguments);
+            emitters::WriteCodeSizeReport(std::cerr, compiledMap.GetModule(), sizeReportOptions, compileArguments.codeSizeBudget);
+        }
     }
 }
 
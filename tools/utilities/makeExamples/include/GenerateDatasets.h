@@ -0,0 +1,40 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     GenerateDatasets.h (makeExamples)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// model
+#include "DynamicMap.h"
+
+// stl
+#include <cstddef>
+#include <ostream>
+#include <string>
+
+namespace ell
+{
+/// <summary> Parameters for synthesizing a benchmark dataset. </summary>
+struct DatasetGenerateParameters
+{
+    size_t dimension = 100;
+    size_t numExamples = 1000;
+    double density = 1.0; // expected fraction of nonzero features per example (1.0 == dense)
+    std::string seed = "benchmark"; // seed string; the same parameters and seed always produce identical bits
+};
+
+/// <summary> Writes a deterministic synthetic dataset in the sparse text format the data loaders
+/// read (`label index:value ...`), labeled by a random linear model drawn from the same seed, and
+/// returns a map computing that linear model. A verify harness can run the map (computed or
+/// compiled) over the dataset and check its outputs against the labels bit-for-bit. </summary>
+///
+/// <param name="parameters"> The dataset parameters. </param>
+/// <param name="dataStream"> The stream to write the dataset to. </param>
+///
+/// <returns> The ground-truth map. </returns>
+model::DynamicMap GenerateBenchmarkDataset(const DatasetGenerateParameters& parameters, std::ostream& dataStream);
+}
@@ -11,6 +11,10 @@
 // utilities
 #include "CommandLineParser.h"
 
+// stl
+#include <cstddef>
+#include <string>
+
 namespace ell
 {
 /// <summary> A struct that holds command line parameters for generating models. </summary>
@@ -20,9 +24,17 @@ struct ModelGenerateArguments
     enum class OutputType
     {
         model,
-        map
+        map,
+        dataset
     };
     OutputType outputType;
+
+    /// <summary> Parameters for the 'dataset' output type. </summary>
+    std::string datasetFilenamePrefix;
+    size_t datasetDimension;
+    size_t datasetExamples;
+    double datasetDensity;
+    std::string datasetSeed;
 };
 
 /// <summary> A version of ModelGenerateArguments that adds its members to the command line parser. </summary>
@@ -0,0 +1,79 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     GenerateDatasets.cpp (makeExamples)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "GenerateDatasets.h"
+
+// model
+#include "InputNode.h"
+#include "Model.h"
+#include "OutputNode.h"
+
+// nodes
+#include "LinearPredictorNode.h"
+
+// predictors
+#include "LinearPredictor.h"
+
+// utilities
+#include "RandomEngines.h"
+
+// stl
+#include <iomanip>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace ell
+{
+model::DynamicMap GenerateBenchmarkDataset(const DatasetGenerateParameters& parameters, std::ostream& dataStream)
+{
+    auto engine = utilities::GetRandomEngine(parameters.seed);
+    std::uniform_real_distribution<double> weightDistribution(-1.0, 1.0);
+    std::uniform_real_distribution<double> valueDistribution(-2.0, 2.0);
+    std::bernoulli_distribution nonzeroDistribution(parameters.density);
+
+    // the ground-truth linear model, drawn from the same seed as the data
+    predictors::LinearPredictor predictor(parameters.dimension);
+    for (size_t j = 0; j < parameters.dimension; ++j)
+    {
+        predictor.GetWeights()[j] = weightDistribution(engine);
+    }
+    predictor.GetBias() = weightDistribution(engine);
+
+    // write the examples, labeled by the model; full precision so lab and production runs read
+    // identical bits
+    dataStream << std::setprecision(std::numeric_limits<double>::max_digits10);
+    std::vector<double> values(parameters.dimension);
+    for (size_t i = 0; i < parameters.numExamples; ++i)
+    {
+        double label = predictor.GetBias();
+        for (size_t j = 0; j < parameters.dimension; ++j)
+        {
+            values[j] = nonzeroDistribution(engine) ? valueDistribution(engine) : 0.0;
+            label += predictor.GetWeights()[j] * values[j];
+        }
+
+        dataStream << label;
+        for (size_t j = 0; j < parameters.dimension; ++j)
+        {
+            if (values[j] != 0.0)
+            {
+                dataStream << '\t' << j << ':' << values[j];
+            }
+        }
+        dataStream << '\n';
+    }
+
+    // the matching ground-truth map
+    model::Model model;
+    auto inputNode = model.AddNode<model::InputNode<double>>(parameters.dimension);
+    auto predictorNode = model.AddNode<nodes::LinearPredictorNode>(inputNode->output, predictor);
+    auto outputNode = model.AddNode<model::OutputNode<double>>(predictorNode->output);
+    return model::DynamicMap(model, { { "input", inputNode } }, { { "output", outputNode->output } });
+}
+}
@@ -16,8 +16,43 @@ void ParsedModelGenerateArguments::AddArgs(utilities::CommandLineParser& parser)
         outputType,
         "outputType",
         "o",
-        "Choice of output type: model, map",
-        { { "model", OutputType::model }, { "map", OutputType::map } },
+        "Choice of output type: model, map, dataset",
+        { { "model", OutputType::model }, { "map", OutputType::map }, { "dataset", OutputType::dataset } },
         "model");
+
+    parser.AddOption(
+        datasetFilenamePrefix,
+        "datasetFilenamePrefix",
+        "dfp",
+        "Filename prefix for the generated benchmark dataset and its ground-truth map",
+        "benchmark");
+
+    parser.AddOption(
+        datasetDimension,
+        "datasetDimension",
+        "dd",
+        "Number of features in the generated benchmark dataset",
+        100);
+
+    parser.AddOption(
+        datasetExamples,
+        "datasetExamples",
+        "de",
+        "Number of examples in the generated benchmark dataset",
+        1000);
+
+    parser.AddOption(
+        datasetDensity,
+        "datasetDensity",
+        "dden",
+        "Expected fraction of nonzero features per example (1 == dense)",
+        1.0);
+
+    parser.AddOption(
+        datasetSeed,
+        "datasetSeed",
+        "dseed",
+        "Seed string for the dataset generator; the same parameters and seed always produce identical bits",
+        "benchmark");
 }
 }
@@ -6,6 +6,7 @@
 //
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include "GenerateDatasets.h"
 #include "GenerateModels.h"
 #include "ModelGenerateArguments.h"
 
@@ -14,6 +15,7 @@
 
 // utilities
 #include "CommandLineParser.h"
+#include "Files.h"
 
 // stl
 #include <iostream>
@@ -49,6 +51,19 @@ void SaveMaps(const std::string& ext)
     common::SaveMap(GenerateSteppableMap(10, 50), "ELL_step10." + ext);
 }
 
+void SaveDatasets(const ModelGenerateArguments& arguments)
+{
+    DatasetGenerateParameters parameters;
+    parameters.dimension = arguments.datasetDimension;
+    parameters.numExamples = arguments.datasetExamples;
+    parameters.density = arguments.datasetDensity;
+    parameters.seed = arguments.datasetSeed;
+
+    auto dataStream = utilities::OpenOfstream(arguments.datasetFilenamePrefix + ".txt");
+    auto truthMap = GenerateBenchmarkDataset(parameters, dataStream);
+    common::SaveMap(truthMap, arguments.datasetFilenamePrefix + "_truth.map");
+}
+
 int main(int argc, char* argv[])
 {
     try
@@ -68,6 +83,10 @@ int main(int argc, char* argv[])
         {
             SaveMaps("map");
         }
+        else if (ModelGenerateArguments::OutputType::dataset == arguments.outputType)
+        {
+            SaveDatasets(arguments);
+        }
         else
         {
             // Default to generating models
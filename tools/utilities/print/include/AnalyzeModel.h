@@ -0,0 +1,29 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     AnalyzeModel.h (print)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// model
+#include "Model.h"
+
+// stl
+#include <ostream>
+#include <string>
+
+namespace ell
+{
+/// <summary> Prints per-node and cumulative cost statistics for a model: estimated FLOPs, bytes
+/// moved, parameter count, and arithmetic intensity, with a roofline classification against a
+/// target device profile. </summary>
+///
+/// <param name="model"> The model. </param>
+/// <param name="out"> The output stream. </param>
+/// <param name="targetDeviceName"> Name of the device profile to classify against (e.g. "pi0",
+/// "pi3", "linux"). </param>
+void AnalyzeModel(const model::Model& model, std::ostream& out, const std::string& targetDeviceName);
+}
@@ -22,6 +22,8 @@ struct PrintArguments
 {
     std::string outputFilename;
     utilities::OutputStreamImpostor outputStream;
+    bool analyze;
+    std::string targetDevice;
 };
 
 /// <summary> Arguments for parsed print. </summary>
@@ -0,0 +1,279 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     AnalyzeModel.cpp (print)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "AnalyzeModel.h"
+
+// nodes
+#include "ConvolutionalLayerNode.h"
+
+// model
+#include "InputPort.h"
+#include "Node.h"
+#include "OutputPort.h"
+
+// stl
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <map>
+#include <string>
+
+namespace ell
+{
+namespace
+{
+    // estimated costs of one node
+    struct NodeStatistics
+    {
+        double flops = 0;
+        double bytesMoved = 0;
+        double parameterCount = 0;
+    };
+
+    // peak floating-point throughput and sustained memory bandwidth used for the roofline
+    // classification. These are order-of-magnitude figures for the device class -- good enough to
+    // tell a compute-bound layer from a memory-bound one, not a substitute for measurement.
+    struct DeviceProfile
+    {
+        double peakGigaFlopsPerSecond;
+        double memoryBandwidthGigabytesPerSecond;
+    };
+
+    DeviceProfile GetDeviceProfile(const std::string& targetDeviceName)
+    {
+        static const std::map<std::string, DeviceProfile> profiles =
+        {
+            { "pi0", { 0.5, 1.0 } },
+            { "pi3", { 9.6, 2.0 } },
+            { "pi3_64", { 9.6, 2.0 } },
+            { "aarch64", { 19.2, 4.0 } },
+            { "ios", { 20.0, 10.0 } },
+            { "mac", { 100.0, 20.0 } },
+            { "linux", { 100.0, 20.0 } },
+            { "windows", { 100.0, 20.0 } }
+        };
+
+        auto match = profiles.find(targetDeviceName);
+        if (match == profiles.end())
+        {
+            return { 100.0, 20.0 }; // desktop-class fallback
+        }
+        return match->second;
+    }
+
+    size_t GetPortTypeSize(model::Port::PortType type)
+    {
+        switch (type)
+        {
+        case model::Port::PortType::smallReal:
+            return 4;
+        case model::Port::PortType::integer:
+            return 4;
+        case model::Port::PortType::boolean:
+            return 1;
+        default:
+            return 8;
+        }
+    }
+
+    double GetInputSize(const model::Node& node)
+    {
+        double size = 0;
+        for (const auto& inputPort : node.GetInputPorts())
+        {
+            size += inputPort->Size();
+        }
+        return size;
+    }
+
+    double GetOutputSize(const model::Node& node)
+    {
+        double size = 0;
+        for (const auto& outputPort : node.GetOutputPorts())
+        {
+            size += outputPort->Size();
+        }
+        return size;
+    }
+
+    double GetBytesMoved(const model::Node& node)
+    {
+        double bytes = 0;
+        for (const auto& inputPort : node.GetInputPorts())
+        {
+            bytes += inputPort->Size() * GetPortTypeSize(inputPort->GetType());
+        }
+        for (const auto& outputPort : node.GetOutputPorts())
+        {
+            bytes += outputPort->Size() * GetPortTypeSize(outputPort->GetType());
+        }
+        return bytes;
+    }
+
+    double GetShapeSize(const nodes::Shape& shape)
+    {
+        double size = 1;
+        for (auto dimension : shape)
+        {
+            size *= dimension;
+        }
+        return size;
+    }
+
+    template <typename ValueType>
+    bool TryGetConvolutionalLayerNodeStatistics(const model::Node& node, NodeStatistics& statistics)
+    {
+        auto pLayerNode = dynamic_cast<const nodes::ConvolutionalLayerNode<ValueType>*>(&node);
+        if (pLayerNode == nullptr)
+        {
+            return false;
+        }
+
+        const auto& inputLayout = pLayerNode->GetInputMemoryLayout();
+        const auto& outputLayout = pLayerNode->GetOutputMemoryLayout();
+        const auto& layer = pLayerNode->GetLayer();
+        double receptiveField = layer.GetConvolutionalParameters().receptiveField;
+        double fieldVolume = receptiveField * receptiveField * inputLayout.size[2];
+        statistics.flops = 2 * GetShapeSize(outputLayout.size) * fieldVolume;
+
+        const auto& weights = layer.GetWeights();
+        statistics.parameterCount = static_cast<double>(weights.NumRows()) * weights.NumColumns() * weights.NumChannels();
+        return true;
+    }
+
+    // works for the refined convolution nodes (diagonal, direct, winograd), which all expose the
+    // same layout and parameter accessors. The figure is useful multiply-adds; winograd performs
+    // fewer actual multiplies, but useful work is what the roofline compares.
+    template <typename NodeType>
+    bool TryGetRefinedConvolutionStatistics(const model::Node& node, NodeStatistics& statistics)
+    {
+        auto pConvNode = dynamic_cast<const NodeType*>(&node);
+        if (pConvNode == nullptr)
+        {
+            return false;
+        }
+
+        const auto& inputLayout = pConvNode->GetInputMemoryLayout();
+        const auto& outputLayout = pConvNode->GetOutputMemoryLayout();
+        double receptiveField = pConvNode->GetConvolutionalParameters().receptiveField;
+        double fieldVolume = receptiveField * receptiveField * inputLayout.size[2];
+        statistics.flops = 2 * GetShapeSize(outputLayout.size) * fieldVolume;
+        statistics.parameterCount = node.GetInputPorts()[1]->Size(); // the filterWeights port
+        return true;
+    }
+
+    NodeStatistics GetNodeStatistics(const model::Node& node)
+    {
+        NodeStatistics statistics;
+        statistics.bytesMoved = GetBytesMoved(node);
+
+        if (TryGetConvolutionalLayerNodeStatistics<float>(node, statistics)) return statistics;
+        if (TryGetConvolutionalLayerNodeStatistics<double>(node, statistics)) return statistics;
+        if (TryGetRefinedConvolutionStatistics<nodes::DiagonalConvolutionNode<float>>(node, statistics)) return statistics;
+        if (TryGetRefinedConvolutionStatistics<nodes::DiagonalConvolutionNode<double>>(node, statistics)) return statistics;
+        if (TryGetRefinedConvolutionStatistics<nodes::DirectConvolutionNode<float>>(node, statistics)) return statistics;
+        if (TryGetRefinedConvolutionStatistics<nodes::DirectConvolutionNode<double>>(node, statistics)) return statistics;
+        if (TryGetRefinedConvolutionStatistics<nodes::WinogradConvolutionNode<float>>(node, statistics)) return statistics;
+        if (TryGetRefinedConvolutionStatistics<nodes::WinogradConvolutionNode<double>>(node, statistics)) return statistics;
+
+        // the remaining estimates only need the port sizes
+        auto typeName = node.GetRuntimeTypeName();
+        double inputSize = GetInputSize(node);
+        double outputSize = GetOutputSize(node);
+        if (typeName.find("ConstantNode") == 0)
+        {
+            statistics.parameterCount = outputSize;
+        }
+        else if (typeName.find("MatrixMatrixMultiplyNode") == 0)
+        {
+            // for C = A*B the port sizes are m*k, k*n and m*n, so m*n*k is the square root of their product
+            double in1 = node.GetInputPorts()[0]->Size();
+            double in2 = node.GetInputPorts()[1]->Size();
+            statistics.flops = 2 * std::sqrt(in1 * in2 * outputSize);
+        }
+        else if (typeName.find("MatrixVectorMultiplyNode") == 0 || typeName.find("DotProductNode") == 0)
+        {
+            // a multiply and an add per element of the larger operand
+            double largestInput = 0;
+            for (const auto& inputPort : node.GetInputPorts())
+            {
+                largestInput = std::max(largestInput, static_cast<double>(inputPort->Size()));
+            }
+            statistics.flops = 2 * largestInput;
+        }
+        else if (typeName.find("FullyConnectedLayerNode") == 0 || typeName.find("LinearPredictorNode") == 0)
+        {
+            statistics.flops = 2 * inputSize * outputSize;
+            statistics.parameterCount = inputSize * outputSize + outputSize; // weights plus bias
+        }
+        else if (typeName.find("BatchNormalizationLayerNode") == 0)
+        {
+            statistics.flops = 2 * outputSize; // scale and shift per element
+        }
+        else if (typeName.find("PoolingLayerNode") == 0)
+        {
+            statistics.flops = inputSize; // each input element enters one max or one sum
+        }
+        else if (typeName.find("BiasLayerNode") == 0 || typeName.find("ScalingLayerNode") == 0 ||
+                 typeName.find("ActivationLayerNode") == 0 || typeName.find("SoftmaxLayerNode") == 0 ||
+                 typeName.find("UnaryOperationNode") == 0 || typeName.find("BinaryOperationNode") == 0)
+        {
+            statistics.flops = outputSize; // one arithmetic operation per element
+        }
+        // everything else (input, output, reorder, splice, ...) moves data without arithmetic
+
+        return statistics;
+    }
+}
+
+void AnalyzeModel(const model::Model& model, std::ostream& out, const std::string& targetDeviceName)
+{
+    auto profile = GetDeviceProfile(targetDeviceName);
+    double ridgePoint = profile.peakGigaFlopsPerSecond / profile.memoryBandwidthGigabytesPerSecond; // FLOP/byte at which compute and bandwidth limits meet
+
+    out << std::setprecision(4); // these are order-of-magnitude estimates; don't print them to 15 digits
+    out << "cost statistics against device profile '" << targetDeviceName << "' (peak "
+        << profile.peakGigaFlopsPerSecond << " GFLOP/s, " << profile.memoryBandwidthGigabytesPerSecond
+        << " GB/s, ridge point " << ridgePoint << " FLOP/byte)\n\n";
+
+    NodeStatistics total;
+    double totalSeconds = 0;
+    model.Visit([&](const model::Node& node) {
+        auto statistics = GetNodeStatistics(node);
+        total.flops += statistics.flops;
+        total.bytesMoved += statistics.bytesMoved;
+        total.parameterCount += statistics.parameterCount;
+
+        // lower-bound time: the node can't run faster than its compute or its memory traffic allows
+        double seconds = std::max(statistics.flops / (profile.peakGigaFlopsPerSecond * 1.0e9),
+                                  statistics.bytesMoved / (profile.memoryBandwidthGigabytesPerSecond * 1.0e9));
+        totalSeconds += seconds;
+
+        out << "node_" << node.GetId() << " " << node.GetRuntimeTypeName()
+            << ": flops " << statistics.flops
+            << ", bytes " << statistics.bytesMoved
+            << ", params " << statistics.parameterCount;
+        if (statistics.flops > 0 && statistics.bytesMoved > 0)
+        {
+            double intensity = statistics.flops / statistics.bytesMoved;
+            out << ", intensity " << intensity << " FLOP/byte ("
+                << (intensity >= ridgePoint ? "compute-bound" : "memory-bound") << ")";
+        }
+        out << "\n";
+    });
+
+    out << "\ntotal: flops " << total.flops << ", bytes " << total.bytesMoved << ", params " << total.parameterCount << "\n";
+    if (total.flops > 0 && total.bytesMoved > 0)
+    {
+        double intensity = total.flops / total.bytesMoved;
+        out << "overall arithmetic intensity " << intensity << " FLOP/byte: the model is "
+            << (intensity >= ridgePoint ? "compute-bound" : "memory-bound") << " on this device\n";
+    }
+    out << "estimated lower-bound latency: " << (totalSeconds * 1000) << " ms\n";
+}
+}
@@ -16,6 +16,8 @@ namespace ell
 void ParsedPrintArguments::AddArgs(utilities::CommandLineParser& parser)
 {
     parser.AddOption(outputFilename, "outputFilename", "of", "Path to the output file", "");
+    parser.AddOption(analyze, "analyze", "a", "Print estimated cost statistics (FLOPs, bytes moved, parameters, arithmetic intensity) instead of the model structure", false);
+    parser.AddOption(targetDevice, "targetDevice", "td", "Device profile to classify the costs against in analyze mode", "pi3");
 }
 
 utilities::CommandLineParseResult ParsedPrintArguments::PostProcess(const utilities::CommandLineParser& parser)
@@ -6,6 +6,7 @@
 //
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include "AnalyzeModel.h"
 #include "PrintArguments.h"
 #include "PrintModel.h"
 
@@ -45,7 +46,14 @@ int main(int argc, char* argv[])
 
         // print model
         utilities::OutputStreamImpostor out = printArguments.outputStream;
-        PrintModel(model, out);
+        if (printArguments.analyze)
+        {
+            AnalyzeModel(model, out, printArguments.targetDevice);
+        }
+        else
+        {
+            PrintModel(model, out);
+        }
     }
     catch (const utilities::CommandLineParserPrintHelpException& exception)
     {
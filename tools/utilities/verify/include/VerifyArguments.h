@@ -0,0 +1,61 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     VerifyArguments.h (verify)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// utilities
+#include "CommandLineParser.h"
+
+// stl
+#include <string>
+
+namespace ell
+{
+/// <summary> Command line arguments for the verify executable. </summary>
+struct VerifyArguments
+{
+    /// <summary> The number of random examples to verify on, when no dataset is given. </summary>
+    size_t numRandomExamples = 1000;
+
+    /// <summary> The largest elementwise absolute difference between the reference and compiled
+    /// outputs that still counts as a match. </summary>
+    double maxAbsoluteError = 1.0e-5;
+
+    /// <summary> The largest elementwise relative difference that still counts as a match;
+    /// elements within maxAbsoluteError are never counted as breaches. </summary>
+    double maxRelativeError = 1.0e-3;
+
+    /// <summary> Enable optimization in the compiled path under verification. </summary>
+    bool optimize = true;
+
+    /// <summary> Enable fast-math in the compiled path under verification. </summary>
+    bool fastMath = false;
+
+    /// <summary> Skip the per-node profiling report. </summary>
+    bool skipProfiling = false;
+
+    /// <summary> The seed for the random input generator. </summary>
+    std::string randomSeedString = "123";
+};
+
+/// <summary> Parsed command line arguments for the verify executable. </summary>
+struct ParsedVerifyArguments : public VerifyArguments, public utilities::ParsedArgSet
+{
+    /// <summary> Adds the arguments to the command line parser. </summary>
+    ///
+    /// <param name="parser"> [in,out] The parser. </param>
+    virtual void AddArgs(utilities::CommandLineParser& parser) override;
+
+    /// <summary> Check the parsed arguments. </summary>
+    ///
+    /// <param name="parser"> The parser. </param>
+    ///
+    /// <returns> An utilities::CommandLineParseResult. </returns>
+    virtual utilities::CommandLineParseResult PostProcess(const utilities::CommandLineParser& parser) override;
+};
+}
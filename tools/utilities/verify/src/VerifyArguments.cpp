@@ -0,0 +1,74 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     VerifyArguments.cpp (verify)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "VerifyArguments.h"
+
+namespace ell
+{
+void ParsedVerifyArguments::AddArgs(utilities::CommandLineParser& parser)
+{
+    parser.AddOption(
+        numRandomExamples,
+        "numRandomExamples",
+        "ne",
+        "The number of random examples to verify on, when no input data file is given.",
+        1000);
+
+    parser.AddOption(
+        maxAbsoluteError,
+        "maxAbsoluteError",
+        "abs",
+        "The largest elementwise absolute difference between the reference and compiled outputs that still counts as a match.",
+        1.0e-5);
+
+    parser.AddOption(
+        maxRelativeError,
+        "maxRelativeError",
+        "rel",
+        "The largest elementwise relative difference that still counts as a match; elements within maxAbsoluteError are never counted as breaches.",
+        1.0e-3);
+
+    parser.AddOption(
+        optimize,
+        "optimize",
+        "opt",
+        "Enable optimization in the compiled path under verification.",
+        true);
+
+    parser.AddOption(
+        fastMath,
+        "fastMath",
+        "fm",
+        "Enable fast-math in the compiled path under verification.",
+        false);
+
+    parser.AddOption(
+        skipProfiling,
+        "skipProfiling",
+        "sp",
+        "Skip the per-node profiling report.",
+        false);
+
+    parser.AddOption(
+        randomSeedString,
+        "randomSeedString",
+        "seed",
+        "The seed for the random input generator.",
+        "123");
+}
+
+utilities::CommandLineParseResult ParsedVerifyArguments::PostProcess(const utilities::CommandLineParser& parser)
+{
+    std::vector<std::string> errors;
+    if (maxAbsoluteError < 0 || maxRelativeError < 0)
+    {
+        errors.push_back("tolerances must be non-negative");
+    }
+    return errors;
+}
+}
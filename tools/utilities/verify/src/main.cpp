@@ -0,0 +1,255 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     main.cpp (verify)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "VerifyArguments.h"
+
+// utilities
+#include "CommandLineParser.h"
+#include "Exception.h"
+#include "Files.h"
+#include "RandomEngines.h"
+
+// common
+#include "DataLoadArguments.h"
+#include "DataLoaders.h"
+#include "LoadModel.h"
+#include "MapLoadArguments.h"
+
+// model
+#include "DynamicMap.h"
+#include "IRCompiledMap.h"
+#include "IRMapCompiler.h"
+
+// stl
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace ell;
+
+namespace
+{
+    /// <summary> Elementwise divergence statistics between the reference and compiled outputs. </summary>
+    struct DivergenceStatistics
+    {
+        double maxAbsoluteError = 0;
+        double meanAbsoluteError = 0;
+        double maxRelativeError = 0;
+        size_t numBreaches = 0;
+        size_t firstBreachExample = 0;
+        size_t numElements = 0;
+    };
+
+    // Builds the verification inputs: the examples from the given data file, or random inputs
+    // when no file is given. Both paths compute on the exact same vectors.
+    std::vector<std::vector<double>> GetVerificationInputs(const common::ParsedDataLoadArguments& dataLoadArguments, const VerifyArguments& verifyArguments, size_t inputSize)
+    {
+        std::vector<std::vector<double>> inputs;
+        if (dataLoadArguments.inputDataFilename != "")
+        {
+            auto stream = utilities::OpenIfstream(dataLoadArguments.inputDataFilename);
+            auto exampleIterator = common::GetExampleIterator(stream);
+            while (exampleIterator.IsValid())
+            {
+                inputs.push_back(exampleIterator.Get().GetDataVector().ToArray(inputSize));
+                exampleIterator.Next();
+            }
+        }
+        else
+        {
+            auto engine = utilities::GetRandomEngine(verifyArguments.randomSeedString);
+            std::uniform_real_distribution<double> distribution(-1, 1);
+            inputs.resize(verifyArguments.numRandomExamples);
+            for (auto& input : inputs)
+            {
+                input.resize(inputSize);
+                for (auto& value : input)
+                {
+                    value = distribution(engine);
+                }
+            }
+        }
+        return inputs;
+    }
+
+    // Runs the map over every input and returns the outputs, reporting the total time taken.
+    // Works on both DynamicMap and IRCompiledMap, so the reference and compiled paths share one
+    // driver.
+    std::vector<std::vector<double>> ComputeOutputs(const model::DynamicMap& map, const std::vector<std::vector<double>>& inputs, double& elapsedMs)
+    {
+        std::vector<std::vector<double>> outputs;
+        outputs.reserve(inputs.size());
+        auto startTime = std::chrono::steady_clock::now();
+        for (const auto& input : inputs)
+        {
+            map.SetInputValue(0, input);
+            outputs.push_back(map.ComputeOutput<double>(0));
+        }
+        elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+        return outputs;
+    }
+
+    DivergenceStatistics ComputeDivergence(const std::vector<std::vector<double>>& reference, const std::vector<std::vector<double>>& compiled, const VerifyArguments& verifyArguments)
+    {
+        DivergenceStatistics statistics;
+        double sumAbsoluteError = 0;
+        for (size_t exampleIndex = 0; exampleIndex < reference.size(); ++exampleIndex)
+        {
+            const auto& referenceOutput = reference[exampleIndex];
+            const auto& compiledOutput = compiled[exampleIndex];
+            for (size_t i = 0; i < referenceOutput.size(); ++i)
+            {
+                double absoluteError = std::abs(referenceOutput[i] - compiledOutput[i]);
+                statistics.maxAbsoluteError = std::max(statistics.maxAbsoluteError, absoluteError);
+                sumAbsoluteError += absoluteError;
+                ++statistics.numElements;
+
+                bool breach = false;
+                if (absoluteError > verifyArguments.maxAbsoluteError)
+                {
+                    double relativeError = absoluteError / std::abs(referenceOutput[i]);
+                    statistics.maxRelativeError = std::max(statistics.maxRelativeError, relativeError);
+                    breach = relativeError > verifyArguments.maxRelativeError;
+                }
+
+                if (breach)
+                {
+                    if (statistics.numBreaches == 0)
+                    {
+                        statistics.firstBreachExample = exampleIndex;
+                    }
+                    ++statistics.numBreaches;
+                }
+            }
+        }
+        if (statistics.numElements > 0)
+        {
+            statistics.meanAbsoluteError = sumAbsoluteError / statistics.numElements;
+        }
+        return statistics;
+    }
+
+    // Prints the per-node timing table collected by the emitted profiling instrumentation, with
+    // each node's share of the total model time, so regressions introduced by a new optimization
+    // pass can be pinned to a node.
+    void PrintNodeProfile(model::IRCompiledMap& compiledMap)
+    {
+        auto numNodes = compiledMap.GetNumProfiledNodes();
+        double totalTime = 0;
+        for (int i = 0; i < numNodes; ++i)
+        {
+            totalTime += compiledMap.GetNodePerformanceCounters(i)->totalTime;
+        }
+
+        std::cout << "\nPer-node timings (compiled path):\n";
+        for (int i = 0; i < numNodes; ++i)
+        {
+            auto info = compiledMap.GetNodeInfo(i);
+            auto counters = compiledMap.GetNodePerformanceCounters(i);
+            double share = totalTime > 0 ? 100.0 * counters->totalTime / totalTime : 0.0;
+            std::cout << "  " << std::left << std::setw(40) << info->nodeType
+                      << " count: " << std::setw(8) << counters->count
+                      << " time: " << std::setw(12) << counters->totalTime
+                      << " (" << std::fixed << std::setprecision(1) << share << "%)\n";
+            std::cout.unsetf(std::ios::fixed);
+        }
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    try
+    {
+        // create a command line parser
+        utilities::CommandLineParser commandLineParser(argc, argv);
+
+        // add arguments to the command line parser
+        common::ParsedMapLoadArguments mapLoadArguments;
+        common::ParsedDataLoadArguments dataLoadArguments;
+        ParsedVerifyArguments verifyArguments;
+
+        commandLineParser.AddOptionSet(mapLoadArguments);
+        commandLineParser.AddOptionSet(dataLoadArguments);
+        commandLineParser.AddOptionSet(verifyArguments);
+
+        // parse command line
+        commandLineParser.Parse();
+
+        // load map
+        auto map = common::LoadMap(mapLoadArguments);
+        auto inputs = GetVerificationInputs(dataLoadArguments, verifyArguments, map.GetInputSize());
+
+        // run the reference path
+        double referenceMs = 0;
+        auto referenceOutputs = ComputeOutputs(map, inputs, referenceMs);
+
+        // compile with the settings under verification and run the jitted code on the same inputs
+        model::MapCompilerParameters settings;
+        settings.profile = !verifyArguments.skipProfiling;
+        settings.compilerSettings.optimize = verifyArguments.optimize;
+        settings.compilerSettings.useFastMath = verifyArguments.fastMath;
+        model::IRMapCompiler compiler(settings);
+        auto compiledMap = compiler.Compile(map);
+
+        double compiledMs = 0;
+        auto compiledOutputs = ComputeOutputs(compiledMap, inputs, compiledMs);
+
+        // report divergence statistics and timings
+        auto statistics = ComputeDivergence(referenceOutputs, compiledOutputs, verifyArguments);
+        std::cout << "Verified " << inputs.size() << " examples (" << statistics.numElements << " output elements)\n";
+        std::cout << "  max absolute error:  " << statistics.maxAbsoluteError << "\n";
+        std::cout << "  mean absolute error: " << statistics.meanAbsoluteError << "\n";
+        std::cout << "  max relative error:  " << statistics.maxRelativeError << " (over elements outside the absolute tolerance)\n";
+        std::cout << "  reference time: " << referenceMs << " ms, compiled time: " << compiledMs << " ms";
+        if (compiledMs > 0)
+        {
+            std::cout << " (" << referenceMs / compiledMs << "x)";
+        }
+        std::cout << "\n";
+
+        if (!verifyArguments.skipProfiling)
+        {
+            PrintNodeProfile(compiledMap);
+        }
+
+        if (statistics.numBreaches > 0)
+        {
+            std::cout << "\nFAILED: " << statistics.numBreaches << " elements diverge beyond tolerance"
+                      << " (first at example " << statistics.firstBreachExample << ")\n";
+            return 1;
+        }
+        std::cout << "\nPASSED\n";
+    }
+    catch (const utilities::CommandLineParserPrintHelpException& exception)
+    {
+        std::cout << exception.GetHelpText() << std::endl;
+        return 0;
+    }
+    catch (const utilities::CommandLineParserErrorException& exception)
+    {
+        std::cerr << "Command line parse error:" << std::endl;
+        for (const auto& error : exception.GetParseErrors())
+        {
+            std::cerr << error.GetMessage() << std::endl;
+        }
+        return 1;
+    }
+    catch (const utilities::Exception& exception)
+    {
+        std::cerr << "exception: " << exception.GetMessage() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}